@@ -9,27 +9,101 @@
 #ifndef APPLICATION_H_
 #define APPLICATION_H_
 
-#define MAX_LETTERS 5 // Max amount of letters per word
-#define MAX_GUESSES 6 // Max amount of guesses for Player 2
+#define MAX_LETTERS SCORE_WORD_LENGTH // Max amount of letters per word; build with -DSCORE_WORD_LENGTH=4 to 8
+#ifndef MAX_GUESSES
+#define MAX_GUESSES 6 // Max amount of guesses for Player 2; build with -DMAX_GUESSES=1 to 8
+#endif
+#define HINT_BUDGET_MS 3000 // Longest the joystick hint thinks before it shows its best guess so far
+#define STATUS_CHARACTERS 21 // Characters across the status line at the bottom of the guess screen
+
+// The tasks of the super-loop, see HAL/Scheduler.h: their priorities, highest first, and their budgets per run. A task
+// waits for at most the run in progress, and the tasks above it, so the budgets bound how late input is handled. The
+// input budget and any other add up to less than a character time at 57600 baud, 173.6 us, so the run in progress and
+// a run of the input task never hold up the game's next character for longer than it takes to arrive.
+#define TASK_INPUT_PRIORITY 3
+#define TASK_GAME_PRIORITY 2
+#define TASK_RENDER_PRIORITY 1
+#define TASK_TELEMETRY_PRIORITY 0
+#define TASK_INPUT_BUDGET_US 50 // Runs out the timers due and refreshes the buttons
+#define TASK_GAME_BUDGET_US 120 // A character or tap, or a slice of a hint search, the board's choice or narrowing
+#define TASK_RENDER_BUDGET_US 120 // A slice of the display list, at least a character, or one dirty rectangle's window
+#define TASK_TELEMETRY_BUDGET_US 100 // Formats and queues half a transmit buffer of the profiling table
+
+// A slice of the hint search, the board's choice or the narrowing of the candidates does granules of work until this is
+// up, so with the granule that runs over it, it fits in the budget of its task. A slice of the display list stops
+// before the piece which would run over it instead. The Absurdle_step row of the profiling table has what a slice
+// takes on the board.
+#define TASK_SLICE_US 40
 
 #include <HAL/HAL.h>
+#include <Wordle/Score.h>
+#include <Wordle/Dictionary.h>
+#include <Wordle/Candidates.h>
+#include <Wordle/Hint.h>
+#include <Wordle/Strategy.h>
+#include <Wordle/Absurdle.h>
+
+#if MAX_GUESSES < 1 || MAX_GUESSES > 8
+#error "MAX_GUESSES must be 1 to 8"
+#endif
+
+// Turns a number macro into a string literal, for screen text
+#define APPLICATION_STRINGIFY(x) #x
+#define APPLICATION_STRING(x) APPLICATION_STRINGIFY(x)
+
+// Layout of the guess screen, worked out from MAX_LETTERS and MAX_GUESSES. A row is the guess in the 6x8 font,
+// a gap of one tile pitch and a square tile per letter, centred across the LCD; for five letters the tiles are
+// 8 pixels, 12 apart. The rows share out the space between the title and the result lines, 12 pixels apart at most.
+#define LAYOUT_CHAR_WIDTH 6 // g_sFontFixed6x8
+#define LAYOUT_MAX_PITCH 12
+#define LAYOUT_MIN_MARGIN 2
+#define LAYOUT_FIRST_ROW_Y 20 // Top of the first guess's letters; its tiles start 2 pixels higher
+#define LAYOUT_RESULT_Y 94 // Top of the result lines under the guesses
+#define LAYOUT_RESULT_PITCH 15 // From one result line to the next, in g_sFontCmsc12
+#define LAYOUT_TILE_PITCH_FIT ((LCD_HORIZONTAL_MAX - 2 * LAYOUT_MIN_MARGIN - LAYOUT_CHAR_WIDTH * MAX_LETTERS) \
+                               / (MAX_LETTERS + 1))
+#define LAYOUT_TILE_PITCH ((LAYOUT_TILE_PITCH_FIT < LAYOUT_MAX_PITCH) ? LAYOUT_TILE_PITCH_FIT : LAYOUT_MAX_PITCH)
+#define LAYOUT_TILE_SIZE (LAYOUT_TILE_PITCH * 2 / 3)
+#define LAYOUT_TEXT_X ((LCD_HORIZONTAL_MAX - LAYOUT_CHAR_WIDTH * MAX_LETTERS - (MAX_LETTERS + 1) * LAYOUT_TILE_PITCH) / 2)
+#define LAYOUT_TILE_X (LAYOUT_TEXT_X + LAYOUT_CHAR_WIDTH * MAX_LETTERS + LAYOUT_TILE_PITCH)
+#define LAYOUT_ROW_PITCH_FIT ((LAYOUT_RESULT_Y - LAYOUT_FIRST_ROW_Y) / MAX_GUESSES)
+#define LAYOUT_ROW_PITCH ((LAYOUT_ROW_PITCH_FIT < LAYOUT_MAX_PITCH) ? LAYOUT_ROW_PITCH_FIT : LAYOUT_MAX_PITCH)
+#define LAYOUT_TILE_HEIGHT ((LAYOUT_TILE_SIZE < LAYOUT_ROW_PITCH - 3) ? LAYOUT_TILE_SIZE : LAYOUT_ROW_PITCH - 3)
+
+#if LAYOUT_ROW_PITCH < 9 || LAYOUT_TILE_SIZE < 4
+#error "the guesses do not fit on the LCD"
+#endif
+
+#if LAYOUT_RESULT_Y + 2 * LAYOUT_RESULT_PITCH > LCD_VERTICAL_MAX
+#error "the result lines do not fit on the LCD"
+#endif
+
+// The SRAM of the MSP432P401R, and what the firmware keeps there besides the buffers which grow with the word
+// length: the stack and heap of msp432p401r.cmd, the UART buffers, the profiling table and the rest. "make flash"
+// in Host/ measures every byte; this catches a word length whose framebuffer, hint and Absurdle buffers overflow.
+#define APPLICATION_SRAM_BYTES 65536
+#define APPLICATION_SRAM_RESERVE 12288
+
+#if LCD_FRAMEBUFFER_BYTES + HINT_SRAM_BYTES + ABSURDLE_SRAM_BYTES > APPLICATION_SRAM_BYTES - APPLICATION_SRAM_RESERVE
+#error "the framebuffer, hint and Absurdle buffers do not fit in SRAM at this word length"
+#endif
 
 
 enum _GameState
 {
-    TITLE_SCREEN, CREATE_WORD, GUESS_WORD
+    TITLE_SCREEN, CREATE_WORD, GUESS_WORD, ABSURDLE // In ABSURDLE the board is player 1 and picks the answer late
 };
 typedef enum _GameState GameState; // All application states
 
 enum _LetterState
 {
-    FIRST = 0, SECOND = 1, THIRD = 2, FOURTH = 3, FIFTH = 4, END = 5
+    FIRST = 0, END = MAX_LETTERS // One state per letter typed so far, FIRST + n after n letters
 };
 typedef enum _LetterState LetterState; // All Letter states
 
 enum _GuessAmount
 {
-    ONE =0 , TWO = 1, THREE = 2, FOUR = 3, FIVE = 4, SIX = 5, RESULT = 6
+    ONE = 0, LAST_GUESS = MAX_GUESSES - 1, RESULT = MAX_GUESSES // ONE + n after n guesses
 };
 typedef enum _GuessAmount GuessAmount; // Guess ammount states
 
@@ -49,14 +123,25 @@ struct _Application
     unsigned char guessWord[MAX_LETTERS];
     int counter;
     int correct;
+    bool statusShown; // Whether there is a message on the status line
+    bool hinting; // Whether the hint engine is searching
+    uint32_t hintProgress; // The progress last shown on the status line
+    WheelTimer hintTimer; // Runs out when the hint has to show what it has
+    bool judging; // Whether the board is choosing the feedback for a guess in ABSURDLE
+    bool narrowing; // Whether the candidates are being narrowed by the last feedback; a hint or judging waits for it
 };
 typedef struct _Application Application;
 
 // Called only a single time - inside of main(), where the application is constructed
 Application Application_construct();
 
-// Called once per super-loop of the main application.
-void Application_loop(Application* app, HAL* hal);
+// Called on every run of the game task. Handles the inputs and does a slice of any search in progress.
+// Returns true while there is more to do before an input changes or a timer runs out.
+bool Application_update(Application* app, HAL* hal);
+
+// Adds the input, game, render and telemetry tasks to the scheduler, and signals the game task so
+// that it shows the title screen
+void Application_schedule(Application* app, HAL* hal);
 
 // Called whenever the UART module needs to be updated
 void Application_updateCommunications(Application* app_p, HAL* hal);
@@ -76,13 +161,27 @@ void Application_handleGameScreen(Application* app_p, HAL* hal_p);
 void Application_showTitleScreen(Application* app_p, HAL* hal_p);
 void Application_showCreateWord(Application* app_p, HAL* hal_p);
 void Application_showGuessWord(Application* app_p, HAL* hal_p);
+void Application_showAbsurdle(Application* app_p, HAL* hal_p);
 // All letter / guess related functions
 char Application_upperCase(char rxChar);
 void Application_letterUpdate(Application* app_p, HAL* hal_p);
 void Application_letterDisplay(Application* app_p, HAL* hal_p);
 void Application_guessDisplay(Application *app_p, HAL *hal_p);
+bool Application_checkGuess(Application *app_p, HAL *hal_p);
+void Application_showStatus(Application *app_p, HAL *hal_p, const char* text);
+// Hint related functions
+void Application_startHint(Application *app_p, HAL *hal_p);
+void Application_beginHint(Application *app_p, HAL *hal_p);
+void Application_showHint(Application *app_p, HAL *hal_p, PackedWord word);
+void Application_updateHint(Application *app_p, HAL *hal_p);
 void Application_wordleAlgo(Application *app_p, HAL *hal_p);
+void Application_showFeedback(Application *app_p, HAL *hal_p, FeedbackCode code);
+void Application_updateNarrowing(Application *app_p, HAL *hal_p);
+// Absurdle related functions
+void Application_startAbsurdle(Application *app_p, HAL *hal_p);
+void Application_updateAbsurdle(Application *app_p, HAL *hal_p);
 void Application_correctResult(Application *app_p, HAL *hal_p);
+void Application_showLoss(Application *app_p, HAL *hal_p);
 // UART related function
 void Application_begin(Application* app_p, HAL* hal_p);
 #endif /* APPLICATION_H_ */
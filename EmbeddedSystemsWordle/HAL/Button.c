@@ -7,6 +7,98 @@
  */
 
 #include <HAL/Button.h>
+#include <HAL/Event.h>
+
+/**
+ * Makes the pin interrupt on the edge away from the level it is at now, so
+ * that every change of level wakes the super-loop, however it bounces. If the
+ * level changes while the edge is being selected, the edge may already have
+ * passed, so the level is read again until it holds still.
+ *
+ * @param port:     The GPIO port of the button
+ * @param pin:      The GPIO pin of the button
+ */
+static void Button_selectNextEdge(uint8_t port, uint16_t pin)
+{
+    uint8_t level;
+
+    do {
+        level = GPIO_getInputPinValue(port, pin);
+        GPIO_interruptEdgeSelect(port, pin, (level == PRESSED) ? GPIO_LOW_TO_HIGH_TRANSITION
+                                                               : GPIO_HIGH_TO_LOW_TRANSITION);
+    } while (GPIO_getInputPinValue(port, pin) != level);
+}
+
+/**
+ * Handles the interrupt of a port with buttons on it: turns each pin which
+ * changed around to catch its next edge, and posts EVENT_BUTTON. The flags are
+ * cleared first, so an edge which comes meanwhile raises the interrupt again.
+ *
+ * @param port:     The GPIO port whose interrupt was raised
+ */
+static void Button_handlePortInterrupt(uint8_t port)
+{
+    uint16_t pins = GPIO_getEnabledInterruptStatus(port);
+    uint16_t pin;
+
+    GPIO_clearInterruptFlag(port, pins);
+    for (pin = GPIO_PIN0; pin <= GPIO_PIN7; pin <<= 1) {
+        if (pins & pin) {
+            Button_selectNextEdge(port, pin);
+        }
+    }
+
+    Event_post(EVENT_BUTTON);
+}
+
+// Every port with pin interrupts, so a button works on any of them. DO NOT DIRECTLY INVOKE THESE FUNCTIONS FROM YOUR CODE.
+void PORT1_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P1); }
+void PORT2_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P2); }
+void PORT3_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P3); }
+void PORT4_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P4); }
+void PORT5_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P5); }
+void PORT6_IRQHandler() { Button_handlePortInterrupt(GPIO_PORT_P6); }
+
+/** Returns the NVIC interrupt of a GPIO port, or 0 for a port with no pin interrupts. */
+static uint32_t Button_portInterrupt(uint8_t port)
+{
+    switch (port)
+    {
+        case GPIO_PORT_P1:
+            return INT_PORT1;
+        case GPIO_PORT_P2:
+            return INT_PORT2;
+        case GPIO_PORT_P3:
+            return INT_PORT3;
+        case GPIO_PORT_P4:
+            return INT_PORT4;
+        case GPIO_PORT_P5:
+            return INT_PORT5;
+        case GPIO_PORT_P6:
+            return INT_PORT6;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * The debounce timer's callback: the input has stayed the same for
+ * DEBOUNCE_TIME_MS, so the transition is over. It runs from HAL_refreshInputs()
+ * before the buttons are refreshed, so the new state is output the same run.
+ *
+ * @param context:  The Button whose timer ran out
+ */
+static void Button_settle(void* context)
+{
+    Button* button = (Button*) context;
+
+    if (button->debounceState == TransitionRP) {
+        button->debounceState = StableP;
+    }
+    else if (button->debounceState == TransitionPR) {
+        button->debounceState = StableR;
+    }
+}
 
 /**
  * Constructs a button as a GPIO pushbutton, given a proper port and pin.
@@ -31,14 +123,24 @@ Button Button_construct(uint8_t port, uint16_t pin)
     // input voltage of the button.
     GPIO_setAsInputPinWithPullUpResistor(port, pin);
 
+    // Wake the super-loop on every edge of the pin, so it can sleep while
+    // nobody touches the button. Ports 7 and up have no pin interrupts, so
+    // a button there is only seen once something else wakes the loop.
+    if (Button_portInterrupt(port) != 0) {
+        Button_selectNextEdge(port, pin);
+        GPIO_clearInterruptFlag(port, pin);
+        GPIO_enableInterrupt(port, pin);
+        Interrupt_enableInterrupt(Button_portInterrupt(port));
+    }
+
     // Initialize all FSM variables for the button to their RELEASED states
     button.debounceState = StableR;
-    button.timer = SWTimer_construct(DEBOUNCE_TIME_MS);
-    SWTimer_start(&button.timer);
+    button.timer = WheelTimer_construct(Button_settle);
 
     // Initialize all buffered outputs of the button
     button.pushState = RELEASED;
     button.isTapped = false;
+    button.tapLatched = false;
 
     // Return the constructed Button object to the user
     return button;
@@ -76,6 +178,24 @@ bool Button_isTapped(Button* button)
     return button->isTapped;
 }
 
+/**
+ * Returns whether the button was tapped in any refresh since this was last
+ * called, and forgets the tap. Unlike [Button_isTapped()], a tap is not lost
+ * when the button is refreshed again before it is looked at, as happens when
+ * the input task of HAL/Scheduler.h runs more often than the game's.
+ *
+ * @param button:   The Button object from which to take the tap
+ *
+ * @return true if the button was tapped since the last call
+ */
+bool Button_takeTap(Button* button)
+{
+    bool tapped = button->tapLatched;
+
+    button->tapLatched = false;
+    return tapped;
+}
+
 /**
  * Refreshes the input of the provided Button by polling for the new GPIO input
  * pin value and advancing the debouncing FSM by one step.
@@ -98,7 +218,7 @@ void Button_refresh(Button* button)
         // Released State - transition only if the new raw state is pressed
         case StableR:
             if (rawButtonStatus == PRESSED) {
-                SWTimer_start(&button->timer);
+                WheelTimer_arm(&button->timer, DEBOUNCE_TIME_MS, button);
                 button->debounceState = TransitionRP;
             }
             newPushState = RELEASED;
@@ -107,40 +227,37 @@ void Button_refresh(Button* button)
         // Pressed State - transition only if the new raw state is released
         case StableP:
             if (rawButtonStatus == RELEASED) {
-                SWTimer_start(&button->timer);
+                WheelTimer_arm(&button->timer, DEBOUNCE_TIME_MS, button);
                 button->debounceState = TransitionPR;
             }
             newPushState = PRESSED;
             break;
 
-        // Transition State - transition if either the timer expires OR if
-        //                    the input becomes polluted with an erroneous
-        //                    RELEASED input.
+        // Transition State - transition if the input becomes polluted with an
+        //                    erroneous RELEASED input. When the timer
+        //                    expires, Button_settle() moves on to StableP.
         case TransitionRP:
             if (rawButtonStatus == RELEASED) {
+                WheelTimer_cancel(&button->timer);
                 button->debounceState = StableR;
             }
-            else if (SWTimer_expired(&button->timer)) {
-                button->debounceState = StableP;
-            }
             newPushState = RELEASED;
             break;
 
-        // Transition State - transition if either the timer expires OR if
-        //                    the input becomes polluted with an erroneous
-        //                    PRESSED input.
+        // Transition State - transition if the input becomes polluted with an
+        //                    erroneous PRESSED input. When the timer expires,
+        //                    Button_settle() moves on to StableR.
         case TransitionPR:
             if (rawButtonStatus == PRESSED) {
+                WheelTimer_cancel(&button->timer);
                 button->debounceState = StableP;
             }
-            else if (SWTimer_expired(&button->timer)) {
-                button->debounceState = StableR;
-            }
             newPushState = PRESSED;
     }
 
     // Outputs of the FSM: The button is tapped if the old debounced state was
     // RELEASED and the new state is PRESSED.
     button->isTapped = newPushState == PRESSED && button->pushState == RELEASED;
+    button->tapLatched = button->tapLatched || button->isTapped;
     button->pushState = newPushState;
 }
@@ -10,7 +10,7 @@
 #define HAL_BUTTON_H_
 
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
-#include <HAL/Timer.h>
+#include <HAL/TimerWheel.h>
 
 #define DEBOUNCE_TIME_MS    5
 #define PRESSED             0
@@ -77,16 +77,19 @@ struct _Button
     // Keeps track of FSM progress in the Debouncing FSM
     DebounceState debounceState;
 
-    // The timer which is used to wait out a bouncy input
-    SWTimer timer;
+    // The timer which is used to wait out a bouncy input. It is on the timer
+    // wheel, so it is only armed from Button_refresh(), once the button is in
+    // its final place.
+    WheelTimer timer;
 
     // The outputs of the FSM.
     int pushState;  // The output of the debouncing FSM (PRESSED or RELEASED)
     bool isTapped;  // The output of the buttonpushed FSM (true or false).
+    bool tapLatched; // Whether it was tapped since Button_takeTap() last asked
 };
 typedef struct _Button Button;
 
-/** Constructs a new button object, given a valid port and pin. */
+/** Constructs a new button object, given a valid port and pin. Only a button on ports 1 to 6 wakes a sleeping loop. */
 Button Button_construct(uint8_t port, uint16_t pin);
 
 /** Given a button, determines if the switch is currently pushed down */
@@ -95,6 +98,9 @@ bool Button_isPressed(Button* button);
 /** Given a button, determines if it was "tapped" - pressed down and released */
 bool Button_isTapped(Button* button);
 
+/** Determines if it was tapped in any refresh since the last call, and forgets the tap */
+bool Button_takeTap(Button* button);
+
 /** Refreshes this button so the Button FSM now has new outputs to interpret */
 void Button_refresh(Button* button);
 
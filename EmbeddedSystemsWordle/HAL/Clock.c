@@ -0,0 +1,66 @@
+/*
+ * Clock.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <HAL/Clock.h>
+
+/**
+ * The number of times TIMER32_0_BASE has rolled over. 32 bits, so that the
+ * main loop reads it in one access which an interrupt cannot split.
+ */
+static volatile uint32_t clockRollovers = 0;
+
+/**
+ * Counts a rollover of TIMER32_0_BASE. DO NOT DIRECTLY INVOKE THIS FUNCTION
+ * FROM YOUR CODE, or every time in the program will jump 89 seconds.
+ */
+void T32_INT1_IRQHandler()
+{
+    clockRollovers++;
+    Timer32_clearInterruptFlag(TIMER32_0_BASE);
+}
+
+/**
+ * Starts TIMER32_0_BASE as a periodic timer with the maximum load value and a
+ * prescaler of 1, so that it interrupts as seldom as it can while counting
+ * every cycle, and enables the interrupt which counts its rollovers.
+ */
+void Clock_init(void)
+{
+    Timer32_initModule(TIMER32_0_BASE, TIMER32_PRESCALER_1, TIMER32_32BIT, TIMER32_PERIODIC_MODE);
+    Timer32_setCount(TIMER32_0_BASE, LOADVALUE);
+    Timer32_startTimer(TIMER32_0_BASE, false);
+
+    Interrupt_enableInterrupt(INT_T32_INT1);
+}
+
+/**
+ * Reads the rollovers, the counter and whether a rollover is waiting to be
+ * counted, and starts over if the interrupt counted one meanwhile. A waiting
+ * rollover is in the counter only if the counter was read after it reloaded,
+ * which leaves it in the upper half; if it was read in the lower half, it
+ * reached zero only after the read.
+ *
+ * @return the number of cycles since Clock_init()
+ */
+uint64_t Clock_cycles(void)
+{
+    uint32_t rollovers, counter;
+    bool pending;
+
+    do
+    {
+        rollovers = clockRollovers;
+        counter = Timer32_getValue(TIMER32_0_BASE);
+        pending = Timer32_getInterruptStatus(TIMER32_0_BASE);
+    } while (rollovers != clockRollovers);
+
+    if (pending && counter > (LOADVALUE >> 1))
+    {
+        rollovers++;
+    }
+
+    return ((uint64_t) rollovers << 32) | (LOADVALUE - counter);
+}
@@ -0,0 +1,93 @@
+/*
+ * Clock.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A 64-bit count of system clock cycles since start-up, one cycle resolution
+ * (21 ns at 48 MHz), which does not wrap for 12000 years. Clock.c keeps it on
+ * the TIMER32_0_BASE counter, with an interrupt counting its rollovers; the
+ * POSIX HAL keeps it on CLOCK_MONOTONIC. SWTimers and the timer wheel are
+ * built on it.
+ *
+ * A read must not pair the rollovers before one with the counter after it, or
+ * the time is off by 2^32 cycles, 89 seconds. Clock_cycles() reads the
+ * rollovers again after the counter and starts over if they changed, and also
+ * counts a rollover whose interrupt has not been taken yet, so it is right
+ * with interrupts off too, and in a handler.
+ *
+ * The conversions are fixed point: a factor in 32.32 bits, multiplied in
+ * three 32 by 64-bit products, with no division. A result is within one of
+ * the exact one, and off by at most one more per 2^33 units converted, so a
+ * time in nanoseconds is good to the nanosecond for three minutes.
+ */
+
+#ifndef HAL_CLOCK_H_
+#define HAL_CLOCK_H_
+
+#include <stdint.h>
+#include <HAL/Timer.h>
+
+// A conversion factor of numerator / denominator in 32.32 fixed point, rounded to nearest
+#define CLOCK_Q32(numerator, denominator) \
+    ((uint64_t) ((((uint64_t) (numerator) << 32) + (denominator) / 2) / (denominator)))
+
+#define CLOCK_HZ                (SYSTEM_CLOCK / PRESCALER)
+#define CLOCK_NS_PER_CYCLE      CLOCK_Q32(1000000000u, CLOCK_HZ)
+#define CLOCK_US_PER_CYCLE      CLOCK_Q32(US_DIVISION_FACTOR, CLOCK_HZ)
+#define CLOCK_MS_PER_CYCLE      CLOCK_Q32(MS_DIVISION_FACTOR, CLOCK_HZ)
+#define CLOCK_CYCLES_PER_NS     CLOCK_Q32(CLOCK_HZ, 1000000000u)
+
+#if CLOCK_HZ % US_DIVISION_FACTOR != 0
+#error "the clock must run at a whole number of MHz"
+#endif
+
+// Starts the clock at zero; InitSystemTiming() calls this
+void Clock_init(void);
+
+// Returns the number of clock cycles since Clock_init()
+uint64_t Clock_cycles(void);
+
+// Multiplies by a 32.32 fixed-point factor, rounding down
+static inline uint64_t Clock_scale(uint64_t value, uint64_t factor)
+{
+    uint32_t whole = (uint32_t) (factor >> 32);
+    uint32_t fraction = (uint32_t) factor;
+    uint32_t high = (uint32_t) (value >> 32);
+    uint32_t low = (uint32_t) value;
+
+    return value * whole + (uint64_t) high * fraction + (((uint64_t) low * fraction) >> 32);
+}
+
+// Converts a number of cycles to nanoseconds, microseconds or milliseconds
+static inline uint64_t Clock_toNs(uint64_t cycles)
+{
+    return Clock_scale(cycles, CLOCK_NS_PER_CYCLE);
+}
+
+static inline uint64_t Clock_toUs(uint64_t cycles)
+{
+    return Clock_scale(cycles, CLOCK_US_PER_CYCLE);
+}
+
+static inline uint64_t Clock_toMs(uint64_t cycles)
+{
+    return Clock_scale(cycles, CLOCK_MS_PER_CYCLE);
+}
+
+// Converts nanoseconds, microseconds or milliseconds to a number of cycles
+static inline uint64_t Clock_fromNs(uint64_t ns)
+{
+    return Clock_scale(ns, CLOCK_CYCLES_PER_NS);
+}
+
+static inline uint64_t Clock_fromUs(uint64_t us)
+{
+    return us * (CLOCK_HZ / US_DIVISION_FACTOR);
+}
+
+static inline uint64_t Clock_fromMs(uint64_t ms)
+{
+    return ms * (CLOCK_HZ / MS_DIVISION_FACTOR);
+}
+
+#endif /* HAL_CLOCK_H_ */
@@ -0,0 +1,181 @@
+/*
+ * DisplayList.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+
+#include <HAL/Clock.h>
+#include <HAL/DisplayList.h>
+
+/** A clear or a rectangle to fill, or a string to draw, with what the context had when it was queued. */
+struct _DisplayOp
+{
+    Graphics_Rectangle rect;        // The rectangle to fill; a string starts at its top left corner
+    int16_t x;                      // Where a string starts, as the rectangle moves along it
+    uint32_t foreground;            // The color of a fill, or of the glyphs of a string
+    uint32_t background;
+    const Graphics_Font* font;
+    char text[DISPLAY_TEXT_SIZE];
+    uint8_t length;                 // Characters of a string, 0 for a fill
+    uint8_t drawn;                  // Characters of a string drawn so far
+    bool opaque;
+};
+typedef struct _DisplayOp DisplayOp;
+
+// The operations waiting, oldest first, in a ring
+static DisplayOp ops[DISPLAY_LIST_SIZE];
+static uint32_t first = 0;
+static uint32_t count = 0;
+
+// The most cycles a piece has taken to draw
+static uint64_t longestPiece = 0;
+
+/** Draws the next band of a fill or character of a string, and returns true once the operation is done. */
+static bool DisplayList_drawPiece(const Graphics_Context* context_p, DisplayOp* op_p)
+{
+    Graphics_Context context = *context_p;
+
+    context.foreground = op_p->foreground;
+    context.background = op_p->background;
+    context.font = op_p->font;
+
+    if (op_p->length == 0)
+    {
+        Graphics_Rectangle band = op_p->rect;
+
+        if (band.yMax - band.yMin >= DISPLAY_BAND_ROWS)
+        {
+            band.yMax = band.yMin + DISPLAY_BAND_ROWS - 1;
+        }
+        Graphics_fillRectangle(&context, &band);
+        op_p->rect.yMin = band.yMax + 1;
+        return op_p->rect.yMin > op_p->rect.yMax;
+    }
+
+    // The x of a character is kept in the rectangle, for fonts whose characters differ in width
+    Graphics_drawString(&context, (int8_t*) &op_p->text[op_p->drawn], 1, op_p->rect.xMin, op_p->rect.yMin,
+                        op_p->opaque);
+    op_p->rect.xMin += Graphics_getStringWidth(&context, (int8_t*) &op_p->text[op_p->drawn], 1);
+    op_p->drawn++;
+    return op_p->drawn == op_p->length;
+}
+
+/** Returns a free operation at the end of the list, drawing the oldest one first if the list is full. */
+static DisplayOp* DisplayList_add(const Graphics_Context* context_p)
+{
+    DisplayOp* op_p;
+
+    if (count == DISPLAY_LIST_SIZE)
+    {
+        while (!DisplayList_drawPiece(context_p, &ops[first]))
+        {
+        }
+        first = (first + 1) % DISPLAY_LIST_SIZE;
+        count--;
+    }
+
+    op_p = &ops[(first + count) % DISPLAY_LIST_SIZE];
+    count++;
+
+    op_p->foreground = context_p->foreground;
+    op_p->background = context_p->background;
+    op_p->font = context_p->font;
+    op_p->length = 0;
+    op_p->drawn = 0;
+    op_p->opaque = false;
+    return op_p;
+}
+
+void DisplayList_clear(const Graphics_Context* context_p)
+{
+    DisplayOp* op_p;
+
+    count = 0;
+    op_p = DisplayList_add(context_p);
+    op_p->foreground = context_p->background;
+    op_p->rect.xMin = 0;
+    op_p->rect.yMin = 0;
+    op_p->rect.xMax = context_p->display->width - 1;
+    op_p->rect.yMax = context_p->display->heigth - 1;
+}
+
+void DisplayList_fillRectangle(const Graphics_Context* context_p, const Graphics_Rectangle* rect_p)
+{
+    DisplayOp* op_p;
+
+    if (rect_p->yMin > rect_p->yMax)
+    {
+        return;
+    }
+    op_p = DisplayList_add(context_p);
+    op_p->rect = *rect_p;
+}
+
+void DisplayList_drawString(const Graphics_Context* context_p, const char* text, int32_t length,
+                            int32_t x, int32_t y, bool opaque)
+{
+    DisplayOp* op_p = &ops[(first + count + DISPLAY_LIST_SIZE - 1) % DISPLAY_LIST_SIZE];
+
+    if (length < 0)
+    {
+        length = (int32_t) strlen(text);
+    }
+    if (length > DISPLAY_TEXT_SIZE)
+    {
+        length = DISPLAY_TEXT_SIZE;
+    }
+    if (length == 0)
+    {
+        return;
+    }
+
+    // A string over the same place as the last one queued, such as a status line counting up, is drawn in its stead
+    if ((count == 0) || (op_p->length != length) || (op_p->x != x) || (op_p->rect.yMin != y) ||
+        (op_p->opaque != opaque) || (op_p->font != context_p->font) ||
+        (op_p->foreground != context_p->foreground) || (op_p->background != context_p->background))
+    {
+        op_p = DisplayList_add(context_p);
+    }
+    memcpy(op_p->text, text, (size_t) length);
+    op_p->length = (uint8_t) length;
+    op_p->drawn = 0;
+    op_p->x = (int16_t) x;
+    op_p->rect.xMin = (int16_t) x;
+    op_p->rect.yMin = (int16_t) y;
+    op_p->opaque = opaque;
+}
+
+/**
+ * Draws pieces while the longest one so far would still be done by the
+ * deadline, and always one, so that a piece longer than the time given still
+ * gets drawn.
+ */
+bool DisplayList_step(const Graphics_Context* context_p, uint64_t deadline)
+{
+    uint64_t now = Clock_cycles();
+
+    while (count > 0)
+    {
+        uint64_t start = now;
+
+        if (DisplayList_drawPiece(context_p, &ops[first]))
+        {
+            first = (first + 1) % DISPLAY_LIST_SIZE;
+            count--;
+        }
+        now = Clock_cycles();
+        longestPiece = (now - start > longestPiece) ? now - start : longestPiece;
+        if ((now >= deadline) || (deadline - now < longestPiece))
+        {
+            break;
+        }
+    }
+    return count > 0;
+}
+
+bool DisplayList_isEmpty(void)
+{
+    return count == 0;
+}
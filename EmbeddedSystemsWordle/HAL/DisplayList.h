@@ -0,0 +1,57 @@
+/*
+ * DisplayList.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The drawing the game asks for, kept in order and drawn into the LCD
+ * framebuffer a piece at a time, in place of grlib calls which draw all of
+ * it at once. A screen of text takes milliseconds to draw on the M4, far
+ * more than a run of a task may take, so the game queues a clear, a
+ * rectangle or a string with the font and colors of the context at the time,
+ * and the render task draws what is queued with DisplayList_step() until its
+ * slice is up: a band of DISPLAY_BAND_ROWS rows of a clear or a rectangle, or
+ * one character of a string, at a time. A clear drops whatever was queued
+ * before it, since it would be drawn over anyway, and a string queued over
+ * the last one, such as a status line counting up, takes its place.
+ *
+ * The list is one for the program, like the timer wheel, so that it is not
+ * copied along with the HAL or the Application.
+ */
+
+#ifndef HAL_DISPLAYLIST_H_
+#define HAL_DISPLAYLIST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <ti/grlib/grlib.h>
+
+// Drawing operations the list holds. A full screen of text is a clear and a dozen strings; should the list
+// fill up all the same, the oldest operation is drawn right away to make room.
+#define DISPLAY_LIST_SIZE   24
+
+// The longest string kept, a line across the display in the fixed 6x8 font
+#define DISPLAY_TEXT_SIZE   21
+
+// Rows of a clear or a rectangle drawn at a time
+#define DISPLAY_BAND_ROWS   4
+
+// Queues clearing the whole display to the background color of the context, and drops what is queued before it
+void DisplayList_clear(const Graphics_Context* context_p);
+
+// Queues filling a rectangle with the foreground color of the context
+void DisplayList_fillRectangle(const Graphics_Context* context_p, const Graphics_Rectangle* rect_p);
+
+// Queues a string with its top left corner at (x, y), in the font and colors of the context. A length of -1
+// draws up to the terminating null; only the first DISPLAY_TEXT_SIZE characters are kept.
+void DisplayList_drawString(const Graphics_Context* context_p, const char* text, int32_t length,
+                            int32_t x, int32_t y, bool opaque);
+
+// Draws what is queued onto the display of the context, a band or a character at a time, until all of it is
+// drawn or the longest piece so far would not be done by the deadline, in Clock_cycles(). It draws at least one
+// piece. Returns true if there is more to draw.
+bool DisplayList_step(const Graphics_Context* context_p, uint64_t deadline);
+
+// Returns true if nothing is left to draw
+bool DisplayList_isEmpty(void);
+
+#endif /* HAL_DISPLAYLIST_H_ */
@@ -0,0 +1,107 @@
+/*
+ * Event.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <HAL/Event.h>
+#include <HAL/Profile.h>
+#include <HAL/Timer.h>
+#include <HAL/TimerWheel.h>
+
+/**
+ * The events posted since the loop last took them. Every interrupt has the
+ * same priority, so handlers do not interrupt each other's read-modify-write,
+ * and the loop takes the flags with interrupts off.
+ */
+static volatile EventSet pending = 0;
+
+/**
+ * Posts EVENT_TIMER when TIMER32_1_BASE runs out, which Event_wait() starts
+ * to run out when the next timer on the wheel is due. DO NOT DIRECTLY INVOKE
+ * THIS FUNCTION FROM YOUR CODE.
+ */
+void T32_INT2_IRQHandler()
+{
+    Timer32_clearInterruptFlag(TIMER32_1_BASE);
+    Event_post(EVENT_TIMER);
+}
+
+/**
+ * Sets TIMER32_1_BASE up to count down once, at MCLK like the clock, each time
+ * it is started, and enables its interrupt. TIMER32_0_BASE keeps running the
+ * clock, so the wheel's time goes on while the CPU sleeps.
+ */
+void Event_init(void)
+{
+    Timer32_initModule(TIMER32_1_BASE, TIMER32_PRESCALER_1, TIMER32_32BIT, TIMER32_PERIODIC_MODE);
+    Interrupt_enableInterrupt(INT_T32_INT2);
+}
+
+void Event_post(EventSet events)
+{
+    pending |= events;
+}
+
+/**
+ * Lets the loop see what was posted while it was busy, which Event_wait()
+ * only tells it once it has nothing left to do. A timer which came due while
+ * the CPU was awake posted nothing, so the wheel is asked.
+ */
+EventSet Event_take(void)
+{
+    EventSet events;
+
+    Interrupt_disableMaster();
+    events = pending;
+    pending = 0;
+    Interrupt_enableMaster();
+
+    return events | ((TimerWheel_cyclesUntilDue() == 0) ? EVENT_TIMER : 0);
+}
+
+/**
+ * Checks for events with interrupts off, so that one posted after the check
+ * cannot be missed: WFI wakes the CPU for an interrupt even while interrupts
+ * are masked, and turning them on for a moment lets its handler run and post.
+ * Interrupts which post nothing, such as the UART's transmit interrupt or the
+ * clock's rollover, put the CPU back to sleep. Unless the wheel is idle,
+ * TIMER32_1_BASE is started to run out when its next timer is due, and halted
+ * again on waking.
+ *
+ * @return the events posted, with EVENT_TIMER if a timer was due already
+ */
+EventSet Event_wait(void)
+{
+    uint64_t until = TimerWheel_cyclesUntilDue();
+    EventSet events;
+
+    Interrupt_disableMaster();
+
+    if (pending == 0 && until > 0)
+    {
+        PROFILE_BEGIN(PROFILE_SLEEP);
+
+        if (until != TIMER_WHEEL_IDLE)
+        {
+            Timer32_setCount(TIMER32_1_BASE, (until < LOADVALUE) ? (uint32_t) until : LOADVALUE);
+            Timer32_startTimer(TIMER32_1_BASE, true);
+        }
+
+        while (pending == 0)
+        {
+            PCM_gotoLPM0();
+            Interrupt_enableMaster();
+            Interrupt_disableMaster();
+        }
+
+        Timer32_haltTimer(TIMER32_1_BASE);
+        PROFILE_END(PROFILE_SLEEP);
+    }
+
+    events = pending | ((until == 0) ? EVENT_TIMER : 0);
+    pending = 0;
+    Interrupt_enableMaster();
+
+    return events;
+}
@@ -0,0 +1,47 @@
+/*
+ * Event.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * What wakes the super-loop. Interrupt handlers post an event when something
+ * the loop has to look at happens: a character arrives on the UART, a button
+ * pin changes level, or the timer which stands in for the timer wheel runs
+ * out. When the loop has nothing left to do, Event_wait() puts the CPU to
+ * sleep in LPM0 until one is posted. LPM0 stops only the CPU, so the UART,
+ * the LCD's DMA and the timers carry on meanwhile, and an interrupt which
+ * posts nothing, such as the UART sending the next character, lets the CPU go
+ * straight back to sleep.
+ *
+ * Events are flags, not a queue: the loop polls its inputs as before once it
+ * is awake, so it only needs to know that something happened.
+ */
+
+#ifndef HAL_EVENT_H_
+#define HAL_EVENT_H_
+
+#include <stdint.h>
+
+// The events, one bit each
+#define EVENT_UART_RX       0x01    // A character is waiting in the UART's receive buffer
+#define EVENT_BUTTON        0x02    // A button pin changed level
+#define EVENT_TIMER         0x04    // A timer on the wheel is due
+#define EVENT_LCD           0x08    // The LCD finished a transfer by DMA
+#define EVENT_UART_TX       0x10    // The UART sent everything in its transmit buffer
+
+typedef uint32_t EventSet;
+
+// Sets up the timer which wakes the CPU for the timer wheel. HAL_construct() calls this.
+void Event_init(void);
+
+// Posts events from an interrupt handler, or from the loop itself
+void Event_post(EventSet events);
+
+// Returns the events posted since the last call, with EVENT_TIMER if a timer is due, and clears them.
+// Never sleeps.
+EventSet Event_take(void);
+
+// Sleeps in LPM0 until an event is posted, unless one is posted already or a timer is due. Returns the
+// events posted since the last call, and clears them.
+EventSet Event_wait(void);
+
+#endif /* HAL_EVENT_H_ */
@@ -8,8 +8,15 @@
 
 #include <HAL/HAL.h>
 
+#if LCD_RUN_BENCHMARK
+#include <stdio.h>
+#endif
+
 void Init_LCD();
 void InitGraphics(Graphics_Context *g_sContext_p);
+#if LCD_RUN_BENCHMARK
+void ReportLcdBenchmark(UART *uart_p);
+#endif
 /**
  * Constructs a new API object. The API constructor should simply call the constructors of each
  * of its sub-members with the proper inputs.
@@ -21,6 +28,12 @@ HAL HAL_construct()
     // The API object which will be returned at the end of construction
     HAL hal;
 
+    // Start the cycle counter the profiling regions are timed with
+    Profile_init();
+
+    // Set up the timer which wakes the super-loop from sleep for the timer wheel
+    Event_init();
+
     // Initialize all LEDs by calling their constructors with correctly-defined arguments.
     hal.launchpadLED1 = LED_construct(LAUNCHPAD_LED1_PORT, LAUNCHPAD_LED1_PIN);
 
@@ -45,23 +58,50 @@ HAL HAL_construct()
 
     // Enable the UART at 9600 BPS
     // TODO: Call UART_SetBaud_Enable to achieve the above goal
-    UART_SetBaud_Enable(&hal.uart, NUM_BAUD_CHOICES);
+    UART_SetBaud_Enable(&hal.uart, BAUD_9600);
     InitGraphics(&hal.g_sContext);
+#if LCD_RUN_BENCHMARK
+    ReportLcdBenchmark(&hal.uart);
+#endif
     // Once we have finished building the API, return the completed struct.
     return hal;
 }
 
 /**
- * Upon every new cycle of the main super-loop, we MUST UPDATE the status of
- * all inputs. In this program, this function is called only once in the
- * Application_loop() function. Since the Application_loop() function is called
- * once per loop of the while (true) loop in main, we are effectively polling
- * all inputs once per loop.
+ * Refreshes the inputs, draws all that the display list holds, then sends
+ * the whole framebuffer and waits for the LCD. The game's super-loop does
+ * these apart, from its input and render tasks (see Application_schedule());
+ * this is for a loop which does everything in turn, as the HAL's own
+ * benchmarks do.
  *
  * @param hal:  The API whose input modules we wish to refresh
  */
 void HAL_refresh(HAL* hal)
 {
+    HAL_refreshInputs(hal);
+
+    // Draw what the previous loop queued, then send whatever it drew into the LCD
+    // framebuffer to the screen. In direct mode there is never anything to send.
+    DisplayList_step(&hal->g_sContext, UINT64_MAX);
+    Graphics_flushBuffer(&hal->g_sContext);
+}
+
+/**
+ * Upon every run of the input task, we MUST UPDATE the status of all inputs.
+ * The inputs are refreshed without touching the LCD, so that a loop which
+ * sends the framebuffer a piece at a time with HAL_flushStep() never waits
+ * for it here.
+ *
+ * @param hal:  The API whose input modules we wish to refresh
+ */
+void HAL_refreshInputs(HAL* hal)
+{
+    PROFILE_BEGIN(PROFILE_HAL_REFRESH_INPUTS);
+
+    // Run out the timers which are due, the buttons' debounce timers among
+    // them, so the buttons see their new states below
+    TimerWheel_service();
+
     // Refresh Launchpad buttons
     Button_refresh(&hal->launchpadS1);
     Button_refresh(&hal->launchpadS2);
@@ -72,6 +112,55 @@ void HAL_refresh(HAL* hal)
     Button_refresh(&hal->boosterpackJS);
 
     // Not real TODO: No need to add anything for UART
+
+    PROFILE_END(PROFILE_HAL_REFRESH_INPUTS);
+}
+
+/**
+ * Sends the framebuffer a dirty rectangle at a time, where HAL_refresh()
+ * sends all of it and waits for each rectangle but the last. The DMA posts
+ * EVENT_LCD once a rectangle is out, so a loop can sleep or do other work
+ * meanwhile and come back for the next one.
+ *
+ * @param hal:  The API whose LCD to send to
+ *
+ * @return true if another rectangle could be started right away
+ */
+bool HAL_flushStep(HAL* hal)
+{
+    bool more;
+
+    (void) hal;
+
+    PROFILE_BEGIN(PROFILE_HAL_FLUSH_STEP);
+    more = Crystalfontz128x128_FlushStep();
+    PROFILE_END(PROFILE_HAL_FLUSH_STEP);
+
+    return more;
+}
+
+EventSet HAL_takeEvents(HAL* hal)
+{
+    (void) hal;
+
+    return Event_take();
+}
+
+/**
+ * Once the super-loop has handled everything, it sleeps here instead of
+ * polling again straight away. The LCD goes on sending by DMA while the CPU
+ * sleeps. The UART, the buttons, the timer wheel and the LCD's DMA each post
+ * an event to wake it, see HAL/Event.h.
+ *
+ * @param hal:  The API whose inputs wake the loop
+ *
+ * @return the events which woke it
+ */
+EventSet HAL_sleep(HAL* hal)
+{
+    (void) hal;
+
+    return Event_wait();
 }
 
 void Init_LCD() { // Initialize LCD
@@ -79,12 +168,19 @@ void Init_LCD() { // Initialize LCD
     Crystalfontz128x128_SetOrientation(LCD_ORIENTATION_UP);
 }
 
-// This function initializes the graphics
+// This function initializes the graphics. With LCD_USE_FRAMEBUFFER set, all drawing
+// goes into RAM and reaches the LCD in HAL_flushStep(), or all at once in HAL_refresh().
 void InitGraphics(Graphics_Context *g_sContext_p) {
 
+#if LCD_USE_FRAMEBUFFER
+    Graphics_initContext(g_sContext_p,
+                         &g_sCrystalfontz128x128,
+                         &g_sCrystalfontz128x128_framebufferFuncs);
+#else
     Graphics_initContext(g_sContext_p,
                          &g_sCrystalfontz128x128,
                          &g_sCrystalfontz128x128_funcs);
+#endif
     Graphics_setForegroundColor(g_sContext_p, GRAPHICS_COLOR_WHITE);
     Graphics_setBackgroundColor(g_sContext_p, GRAPHICS_COLOR_BLACK);
     Graphics_setFont(g_sContext_p, &g_sFontFixed6x8);
@@ -92,4 +188,23 @@ void InitGraphics(Graphics_Context *g_sContext_p) {
     Init_LCD();
 
     Graphics_clearDisplay(g_sContext_p);
+    Graphics_flushBuffer(g_sContext_p);
+}
+
+#if LCD_RUN_BENCHMARK
+// Times a full-screen clear with the old byte-at-a-time SPI writes and with the
+// streaming writes, and sends both over UART. We wait for the message to leave
+// the transmit buffer, since the application re-initializes the UART right after.
+void ReportLcdBenchmark(UART *uart_p) {
+    char message[96];
+    uint64_t before = HAL_LCD_timeFullScreenClear(false);
+    uint64_t after = HAL_LCD_timeFullScreenClear(true);
+
+    snprintf(message, sizeof(message), "LCD clear: %lu us per-byte, %lu us streaming\r\n",
+             (unsigned long) (before / (SYSTEM_CLOCK / US_DIVISION_FACTOR)),
+             (unsigned long) (after / (SYSTEM_CLOCK / US_DIVISION_FACTOR)));
+    UART_sendString(uart_p, message);
+
+    while (UART_txPending(uart_p) > 0);
 }
+#endif
@@ -10,12 +10,18 @@
 #define HAL_HAL_H_
 
 #include <HAL/Button.h>
+#include <HAL/DisplayList.h>
+#include <HAL/Event.h>
 #include <HAL/LED.h>
+#include <HAL/Profile.h>
+#include <HAL/Scheduler.h>
 #include <HAL/Timer.h>
+#include <HAL/TimerWheel.h>
 #include <HAL/UART.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <ti/grlib/grlib.h>
 #include "LcdDriver/Crystalfontz128x128_ST7735.h"
+#include "LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h"
 
 /**============================================================================
  * The main HAL struct. This struct encapsulates all of the other input structs
@@ -65,7 +71,24 @@ typedef struct _HAL HAL;
 // Constructs an HAL object by calling the constructor of each individual member
 HAL HAL_construct();
 
-// Refreshes all necessary inputs in the HAL
+// Refreshes all necessary inputs in the HAL, draws what the display list holds and sends what has been drawn
+// to the LCD, waiting for it.
+// For loops which do everything in turn; the game's scheduled super-loop does the two apart.
 void HAL_refresh(HAL* api);
 
+// Refreshes the inputs alone: runs out the timers due and refreshes the buttons. The input task of
+// the scheduled super-loop calls this.
+void HAL_refreshInputs(HAL* api);
+
+// Starts sending the next part of what has been drawn to the LCD, without waiting for the LCD.
+// Returns true if another part could be started right away.
+bool HAL_flushStep(HAL* api);
+
+// Returns the events posted since the last call, see HAL/Event.h. Never sleeps.
+EventSet HAL_takeEvents(HAL* api);
+
+// Sleeps until an input changes, a timer is due or the LCD finishes a transfer, and returns the events
+// which woke it. The super-loop calls this when it has nothing left to do.
+EventSet HAL_sleep(HAL* api);
+
 #endif /* HAL_HAL_H_ */
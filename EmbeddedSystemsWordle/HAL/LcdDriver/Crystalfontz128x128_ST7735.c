@@ -38,6 +38,7 @@
 
 #include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
 #include <HAL/LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h>
+#include <HAL/Profile.h>
 #include <ti/grlib/grlib.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <stdint.h>
@@ -46,6 +47,18 @@ uint8_t Lcd_Orientation;
 uint16_t Lcd_ScreenWidth, Lcd_ScreenHeigth;
 uint8_t Lcd_PenSolid, Lcd_FontSolid, Lcd_FlagRead;
 uint16_t Lcd_TouchTrim;
+uint32_t Lcd_FlushBytes;
+
+#if LCD_USE_FRAMEBUFFER
+// The off-screen copy of the display, indexed [y][x] in the current orientation.
+// Pixels are stored high byte first, the order the display expects them in, so
+// a flush can send them straight from memory.
+static uint16_t Lcd_Framebuffer[LCD_VERTICAL_MAX][LCD_HORIZONTAL_MAX];
+
+// Regions of Lcd_Framebuffer which changed since the last flush
+static Graphics_Rectangle Lcd_DirtyRects[LCD_MAX_DIRTY_RECTS];
+static uint8_t Lcd_NumDirtyRects;
+#endif
 
 //*****************************************************************************
 //
@@ -99,12 +112,7 @@ void Crystalfontz128x128_Init(void)
 
     Crystalfontz128x128_SetDrawFrame(0, 0, 127, 127);
     HAL_LCD_writeCommand(CM_RAMWR);
-    int i;
-    for (i = 0; i < 16384; i++)
-    {
-        HAL_LCD_writeData(0xFF);
-        HAL_LCD_writeData(0xFF);
-    }
+    HAL_LCD_writeRepeatedColor(0xFFFF, LCD_HORIZONTAL_MAX * LCD_VERTICAL_MAX);
 
     HAL_LCD_delay(10);
     HAL_LCD_writeCommand(CM_DISPON);
@@ -142,17 +150,31 @@ void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uin
             break;
     }
 
+    uint8_t columns[4] = { (uint8_t)(x0 >> 8), (uint8_t)(x0), (uint8_t)(x1 >> 8), (uint8_t)(x1) };
+    uint8_t rows[4]    = { (uint8_t)(y0 >> 8), (uint8_t)(y0), (uint8_t)(y1 >> 8), (uint8_t)(y1) };
+
     HAL_LCD_writeCommand(CM_CASET);
-    HAL_LCD_writeData((uint8_t)(x0 >> 8));
-    HAL_LCD_writeData((uint8_t)(x0));
-    HAL_LCD_writeData((uint8_t)(x1 >> 8));
-    HAL_LCD_writeData((uint8_t)(x1));
+    HAL_LCD_writeBytes(columns, 4);
 
     HAL_LCD_writeCommand(CM_RASET);
-    HAL_LCD_writeData((uint8_t)(y0 >> 8));
-    HAL_LCD_writeData((uint8_t)(y0));
-    HAL_LCD_writeData((uint8_t)(y1 >> 8));
-    HAL_LCD_writeData((uint8_t)(y1));
+    HAL_LCD_writeBytes(rows, 4);
+}
+
+
+//*****************************************************************************
+//
+//! Determines whether the display has finished the last fill or flush.
+//!
+//! Fills and flushes started through grlib may continue in the background
+//! by DMA.  The next drawing call waits for them on its own, so this only
+//! needs to be called by code which wants to do other work meanwhile.
+//!
+//! \return true if nothing is being sent to the display any more.
+//
+//*****************************************************************************
+bool Crystalfontz128x128_TransferDone(void)
+{
+    return !HAL_LCD_isBusy();
 }
 
 
@@ -220,8 +242,7 @@ static void Crystalfontz128x128_PixelDraw(const Graphics_Display *pDisplay,
     // Write the pixel value.
     //
     HAL_LCD_writeCommand(CM_RAMWR);
-    HAL_LCD_writeData(ulValue>>8);
-    HAL_LCD_writeData(ulValue);
+    HAL_LCD_writeRepeatedColor(ulValue, 1);
 }
 
 
@@ -260,6 +281,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(const Graphics_Display *pDispl
                                                   const uint32_t *pucPalette)
 {
     uint16_t Data;
+    PROFILE_BEGIN(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
 
     //
     // Set the cursor increment to left to right, followed by top to bottom.
@@ -376,23 +398,11 @@ static void Crystalfontz128x128_PixelDrawMultiple(const Graphics_Display *pDispl
         //
         case 16:
         {
-            uint16_t usData;
-
-            // Loop while there are more pixels to draw.
-
-            while(lCount--)
-            {
-                // Get the next byte of pixel data and extract the
-                // corresponding entry from the palette
-                usData = *((uint16_t *)pucData);
-                pucData += 2;
-
-                // Translate this palette entry and write it to the screen
-                HAL_LCD_writeData(usData>>8);
-                HAL_LCD_writeData(usData);
-            }
+            // Stream the whole row of native pixels
+            HAL_LCD_writePixelRow((const uint16_t *)pucData, lCount);
         }
     }
+    PROFILE_END(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
 }
 
 
@@ -426,13 +436,8 @@ static void Crystalfontz128x128_LineDrawH(const Graphics_Display *pDisplay,
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lX1; i <= lX2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_writeRepeatedColor(ulValue, lX2 - lX1 + 1);
 }
 
 
@@ -464,13 +469,8 @@ static void Crystalfontz128x128_LineDrawV(const Graphics_Display *pDisplay,
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lY1; i <= lY2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_writeRepeatedColor(ulValue, lY2 - lY1 + 1);
 }
 
 
@@ -486,7 +486,8 @@ static void Crystalfontz128x128_LineDrawV(const Graphics_Display *pDisplay,
 //! This function fills a rectangle on the display.  The coordinates of the
 //! rectangle are assumed to be within the extents of the display, and the
 //! rectangle specification is fully inclusive (in other words, both sXMin and
-//! sXMax are drawn, along with sYMin and sYMax).
+//! sXMax are drawn, along with sYMin and sYMax).  Large rectangles are filled
+//! by DMA in the background, see Crystalfontz128x128_TransferDone().
 //!
 //! \return None.
 //
@@ -499,20 +500,17 @@ static void Crystalfontz128x128_RectFill(const Graphics_Display *pDisplay,
     int16_t x1 = pRect->sXMax;
     int16_t y0 = pRect->sYMin;
     int16_t y1 = pRect->sYMax;
+    PROFILE_BEGIN(PROFILE_LCD_RECT_FILL);
 
     Crystalfontz128x128_SetDrawFrame(x0, y0, x1, y1);
 
     //
     // Write the pixel value.
     //
-    int16_t i;
-    int16_t pixels = (x1 - x0 + 1) * (y1 - y0 + 1);
+    uint32_t pixels = (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = 0; i <= pixels; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_startFill(ulValue, pixels);
+    PROFILE_END(PROFILE_LCD_RECT_FILL);
 }
 
 //*****************************************************************************
@@ -544,6 +542,35 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 }
 
 
+#if LCD_USE_FRAMEBUFFER
+//*****************************************************************************
+//
+//! Sends one dirty rectangle of the framebuffer to the display as one window.
+//!
+//! The pixels go out with HAL_LCD_startBlit(), so they may still be going out
+//! by DMA when this returns.
+//!
+//! \return the number of SPI bytes sent.
+//
+//*****************************************************************************
+static uint32_t Crystalfontz128x128_SendRect(const Graphics_Rectangle *pRect)
+{
+    Crystalfontz128x128_SetDrawFrame(pRect->sXMin, pRect->sYMin,
+                                     pRect->sXMax, pRect->sYMax);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    HAL_LCD_startBlit((const uint8_t *) &Lcd_Framebuffer[pRect->sYMin][pRect->sXMin],
+                      2 * (pRect->sXMax - pRect->sXMin + 1),
+                      sizeof(Lcd_Framebuffer[0]),
+                      pRect->sYMax - pRect->sYMin + 1);
+
+    // CASET and RASET with 4 bytes each, RAMWR, then 2 bytes per pixel
+    return 11 + 2 * (uint32_t) (pRect->sXMax - pRect->sXMin + 1)
+                  * (uint32_t) (pRect->sYMax - pRect->sYMin + 1);
+}
+#endif
+
+
 //*****************************************************************************
 //
 //! Flushes any cached drawing operations.
@@ -553,8 +580,11 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 //!
 //! This functions flushes any cached drawing operations to the display.  This
 //! is useful when a local frame buffer is used for drawing operations, and the
-//! flush would copy the local frame buffer to the display.  For the SSD2119
-//! driver, the flush is a no operation.
+//! flush would copy the local frame buffer to the display.  Each dirty
+//! rectangle is sent as one window with HAL_LCD_startBlit(), so the last one
+//! may still be going out by DMA when this returns.  The number of SPI bytes
+//! sent is left in Lcd_FlushBytes.  In direct mode nothing is ever marked
+//! dirty, so the flush does nothing.
 //!
 //! \return None.
 //
@@ -562,12 +592,364 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 static void
 Crystalfontz128x128_Flush(const Graphics_Display *pDisplay)
 {
-    //
-    // There is nothing to be done.
-    //
+    uint32_t bytes = 0;
+
+#if LCD_USE_FRAMEBUFFER
+    uint8_t r;
+
+    for (r = 0; r < Lcd_NumDirtyRects; r++)
+    {
+        bytes += Crystalfontz128x128_SendRect(&Lcd_DirtyRects[r]);
+    }
+
+    Lcd_NumDirtyRects = 0;
+#endif
+
+    Lcd_FlushBytes = bytes;
+}
+
+
+//*****************************************************************************
+//
+//! Starts sending the next dirty rectangle, unless the display is still busy.
+//!
+//! Unlike Graphics_flushBuffer(), this never waits for a transfer by DMA to
+//! finish: it returns at once while one is going, and starts at most one
+//! rectangle, whose window setup is the only part the CPU waits for.  Drawing
+//! may go on between calls; what it changes is marked dirty as usual, and is
+//! sent again if it was already on its way.  The DMA interrupt posts
+//! EVENT_LCD once a rectangle is sent.  Lcd_FlushBytes is left alone.
+//!
+//! \return true if another rectangle could be started right away, false if
+//! there is none or the display is busy.
+//
+//*****************************************************************************
+bool Crystalfontz128x128_FlushStep(void)
+{
+#if LCD_USE_FRAMEBUFFER
+    if (Lcd_NumDirtyRects == 0 || HAL_LCD_isBusy())
+    {
+        return false;
+    }
+
+    Lcd_NumDirtyRects--;
+    Crystalfontz128x128_SendRect(&Lcd_DirtyRects[Lcd_NumDirtyRects]);
+
+    return Lcd_NumDirtyRects > 0 && !HAL_LCD_isBusy();
+#else
+    return false;
+#endif
+}
+
+
+#if LCD_USE_FRAMEBUFFER
+//*****************************************************************************
+//
+//! Computes the number of pixels in a rectangle.
+//
+//*****************************************************************************
+static int32_t Crystalfontz128x128_RectArea(const Graphics_Rectangle *pRect)
+{
+    return (int32_t) (pRect->sXMax - pRect->sXMin + 1) *
+           (int32_t) (pRect->sYMax - pRect->sYMin + 1);
+}
+
+
+//*****************************************************************************
+//
+//! Grows a rectangle so that it also covers a second one.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_RectUnion(Graphics_Rectangle *pDest,
+                                          const Graphics_Rectangle *pRect)
+{
+    if (pRect->sXMin < pDest->sXMin) pDest->sXMin = pRect->sXMin;
+    if (pRect->sYMin < pDest->sYMin) pDest->sYMin = pRect->sYMin;
+    if (pRect->sXMax > pDest->sXMax) pDest->sXMax = pRect->sXMax;
+    if (pRect->sYMax > pDest->sYMax) pDest->sYMax = pRect->sYMax;
+}
+
+
+//*****************************************************************************
+//
+//! Computes how many pixels the union of two rectangles covers beyond the
+//! pixels of the two rectangles themselves.  Overlapping rectangles give a
+//! negative result, since their union then sends fewer pixels.
+//
+//*****************************************************************************
+static int32_t Crystalfontz128x128_UnionGrowth(const Graphics_Rectangle *pA,
+                                               const Graphics_Rectangle *pB)
+{
+    Graphics_Rectangle merged = *pA;
+    Crystalfontz128x128_RectUnion(&merged, pB);
+
+    return Crystalfontz128x128_RectArea(&merged) -
+           Crystalfontz128x128_RectArea(pA) - Crystalfontz128x128_RectArea(pB);
+}
+
+
+//*****************************************************************************
+//
+//! Records that a region of the framebuffer changed.
+//!
+//! \param x0, y0, x1, y1 are the inclusive corners of the region.
+//!
+//! The region is merged into an existing dirty rectangle when that costs at
+//! most LCD_DIRTY_MERGE_SLACK extra pixels, and the grown rectangle is then
+//! merged with any others it now reaches, so the list stays short.  When the
+//! list is full the region is merged into the rectangle it grows the least.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_MarkDirty(int16_t x0, int16_t y0,
+                                          int16_t x1, int16_t y1)
+{
+    Graphics_Rectangle rect = { x0, y0, x1, y1 };
+    int32_t growth, bestGrowth;
+    uint8_t i, best;
+
+    for (i = 0; i < Lcd_NumDirtyRects; i++)
+    {
+        if (Crystalfontz128x128_UnionGrowth(&Lcd_DirtyRects[i], &rect) <= LCD_DIRTY_MERGE_SLACK)
+        {
+            break;
+        }
+    }
+
+    if (i == Lcd_NumDirtyRects)
+    {
+        if (Lcd_NumDirtyRects < LCD_MAX_DIRTY_RECTS)
+        {
+            Lcd_DirtyRects[Lcd_NumDirtyRects++] = rect;
+            return;
+        }
+
+        best = 0;
+        bestGrowth = Crystalfontz128x128_UnionGrowth(&Lcd_DirtyRects[0], &rect);
+        for (i = 1; i < Lcd_NumDirtyRects; i++)
+        {
+            growth = Crystalfontz128x128_UnionGrowth(&Lcd_DirtyRects[i], &rect);
+            if (growth < bestGrowth)
+            {
+                best = i;
+                bestGrowth = growth;
+            }
+        }
+        i = best;
+    }
+
+    Crystalfontz128x128_RectUnion(&Lcd_DirtyRects[i], &rect);
+
+    // The grown rectangle may now be worth merging with others. Each one that
+    // is merged is replaced by the last entry of the list.
+    rect = Lcd_DirtyRects[i];
+    for (best = 0; best < Lcd_NumDirtyRects; )
+    {
+        if ((best != i) &&
+            (Crystalfontz128x128_UnionGrowth(&rect, &Lcd_DirtyRects[best]) <= LCD_DIRTY_MERGE_SLACK))
+        {
+            Crystalfontz128x128_RectUnion(&rect, &Lcd_DirtyRects[best]);
+            Lcd_DirtyRects[best] = Lcd_DirtyRects[--Lcd_NumDirtyRects];
+            if (i == Lcd_NumDirtyRects)
+            {
+                i = best;
+            }
+            best = 0;
+        }
+        else
+        {
+            best++;
+        }
+    }
+    Lcd_DirtyRects[i] = rect;
+}
+
+
+//*****************************************************************************
+//
+//! Swaps the bytes of a 5-6-5 color between CPU order and display order.
+//
+//*****************************************************************************
+static inline uint16_t Crystalfontz128x128_SwapBytes(uint16_t ulValue)
+{
+    return (uint16_t) ((ulValue << 8) | (ulValue >> 8));
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_ColorTranslate().  The color is
+//! returned in display byte order, so every primitive stores it as it is.
+//
+//*****************************************************************************
+static uint32_t Crystalfontz128x128_FramebufferColorTranslate(const Graphics_Display *pDisplay,
+                                                              uint32_t ulValue)
+{
+    return Crystalfontz128x128_SwapBytes(Crystalfontz128x128_ColorTranslate(pDisplay, ulValue));
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_PixelDraw().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FramebufferPixelDraw(const Graphics_Display *pDisplay,
+                                                     int16_t lX,
+                                                     int16_t lY,
+                                                     uint16_t ulValue)
+{
+    Lcd_Framebuffer[lY][lX] = ulValue;
+    Crystalfontz128x128_MarkDirty(lX, lY, lX, lY);
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_PixelDrawMultiple().  Palette
+//! entries are interpreted exactly as in the direct version.  1 bit per pixel
+//! palettes were translated by the framebuffer table and are already in
+//! display byte order; everything else is swapped.  Pixels past the right
+//! edge of the display are dropped.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FramebufferPixelDrawMultiple(const Graphics_Display *pDisplay,
+                                                             int16_t lX,
+                                                             int16_t lY,
+                                                             int16_t lX0,
+                                                             int16_t lCount,
+                                                             int16_t lBPP,
+                                                             const uint8_t *pucData,
+                                                             const uint32_t *pucPalette)
+{
+    uint16_t *pPixel = &Lcd_Framebuffer[lY][lX];
+    int16_t i;
+
+    if (lX + lCount > LCD_HORIZONTAL_MAX)
+    {
+        lCount = LCD_HORIZONTAL_MAX - lX;
+    }
+    if (lCount <= 0)
+    {
+        return;
+    }
+
+    PROFILE_BEGIN(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
+    Crystalfontz128x128_MarkDirty(lX, lY, lX + lCount - 1, lY);
+
+    // Track the pixel position in bits so that 1 and 4 bit per pixel data can
+    // start part way through its first byte.
+    for (i = 0; i < lCount; i++)
+    {
+        uint16_t bit = (uint16_t) (lX0 + i) * lBPP;
+
+        switch (lBPP)
+        {
+            case 1:
+                pPixel[i] = pucPalette[(pucData[bit >> 3] >> (7 - (bit & 7))) & 1];
+                break;
+            case 4:
+                pPixel[i] = Crystalfontz128x128_SwapBytes(
+                    *(uint16_t *) (pucPalette + ((pucData[bit >> 3] >> (4 - (bit & 7))) & 15)));
+                break;
+            case 8:
+                pPixel[i] = Crystalfontz128x128_SwapBytes(*(uint16_t *) (pucPalette + pucData[i]));
+                break;
+            case 16:
+                pPixel[i] = Crystalfontz128x128_SwapBytes(((const uint16_t *) pucData)[i]);
+                break;
+        }
+    }
+    PROFILE_END(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_LineDrawH().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FramebufferLineDrawH(const Graphics_Display *pDisplay,
+                                                     int16_t lX1,
+                                                     int16_t lX2,
+                                                     int16_t lY,
+                                                     uint16_t ulValue)
+{
+    int16_t x;
+
+    for (x = lX1; x <= lX2; x++)
+    {
+        Lcd_Framebuffer[lY][x] = ulValue;
+    }
+    Crystalfontz128x128_MarkDirty(lX1, lY, lX2, lY);
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_LineDrawV().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FramebufferLineDrawV(const Graphics_Display *pDisplay,
+                                                     int16_t lX,
+                                                     int16_t lY1,
+                                                     int16_t lY2,
+                                                     uint16_t ulValue)
+{
+    int16_t y;
+
+    for (y = lY1; y <= lY2; y++)
+    {
+        Lcd_Framebuffer[y][lX] = ulValue;
+    }
+    Crystalfontz128x128_MarkDirty(lX, lY1, lX, lY2);
+}
+
+
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_RectFill().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FramebufferRectFill(const Graphics_Display *pDisplay,
+                                                    const Graphics_Rectangle *pRect,
+                                                    uint16_t ulValue)
+{
+    int16_t x, y;
+    PROFILE_BEGIN(PROFILE_LCD_RECT_FILL);
+
+    for (y = pRect->sYMin; y <= pRect->sYMax; y++)
+    {
+        for (x = pRect->sXMin; x <= pRect->sXMax; x++)
+        {
+            Lcd_Framebuffer[y][x] = ulValue;
+        }
+    }
+    Crystalfontz128x128_MarkDirty(pRect->sXMin, pRect->sYMin,
+                                  pRect->sXMax, pRect->sYMax);
+    PROFILE_END(PROFILE_LCD_RECT_FILL);
 }
 
 
+//*****************************************************************************
+//
+//! Framebuffer version of Crystalfontz128x128_ClearScreen().  The whole
+//! screen becomes the only dirty rectangle.
+//
+//*****************************************************************************
+static void
+Crystalfontz128x128_FramebufferClearScreen(const Graphics_Display *pDisplay,
+                                           uint16_t ulValue)
+{
+    Graphics_Rectangle rect = { 0, 0, LCD_HORIZONTAL_MAX-1, LCD_VERTICAL_MAX-1};
+
+    Lcd_NumDirtyRects = 0;
+    Crystalfontz128x128_FramebufferRectFill(pDisplay, &rect, ulValue);
+}
+#endif
+
+
 //*****************************************************************************
 //
 //! Send command to clear screen.
@@ -616,3 +998,17 @@ const Graphics_Display_Functions g_sCrystalfontz128x128_funcs =
     Crystalfontz128x128_ClearScreen
 
 };
+
+#if LCD_USE_FRAMEBUFFER
+const Graphics_Display_Functions g_sCrystalfontz128x128_framebufferFuncs =
+{
+    Crystalfontz128x128_FramebufferPixelDraw,
+    Crystalfontz128x128_FramebufferPixelDrawMultiple,
+    Crystalfontz128x128_FramebufferLineDrawH,
+    Crystalfontz128x128_FramebufferLineDrawV,
+    Crystalfontz128x128_FramebufferRectFill,
+    Crystalfontz128x128_FramebufferColorTranslate,
+    Crystalfontz128x128_Flush,
+    Crystalfontz128x128_FramebufferClearScreen
+};
+#endif
@@ -48,6 +48,28 @@
 #define LCD_VERTICAL_MAX                   128
 #define LCD_HORIZONTAL_MAX                 128
 
+// Set to 1 to draw into a 32 KB RAM framebuffer which is only sent to the LCD,
+// one dirty rectangle at a time, by Graphics_flushBuffer(). Set to 0 to send
+// every grlib primitive straight to the LCD.
+#ifndef LCD_USE_FRAMEBUFFER
+#define LCD_USE_FRAMEBUFFER                1
+#endif
+
+#if LCD_USE_FRAMEBUFFER
+#define LCD_FRAMEBUFFER_BYTES              (LCD_VERTICAL_MAX * LCD_HORIZONTAL_MAX * 2)
+#else
+#define LCD_FRAMEBUFFER_BYTES              0
+#endif
+
+// Most separate dirty rectangles tracked between two flushes. When a new one
+// does not fit, it is merged into the rectangle it grows the least.
+#define LCD_MAX_DIRTY_RECTS                8
+
+// Two dirty rectangles are merged when their union covers at most this many
+// more pixels than the two of them do, since a window setup costs about as
+// many SPI bytes as that many pixels.
+#define LCD_DIRTY_MERGE_SLACK              32
+
 #define LCD_ORIENTATION_UP    0
 #define LCD_ORIENTATION_LEFT  1
 #define LCD_ORIENTATION_DOWN  2
@@ -101,12 +123,23 @@ extern Graphics_Display g_sCrystalfontz128x128;
 
 extern const Graphics_Display_Functions g_sCrystalfontz128x128_funcs;
 
+#if LCD_USE_FRAMEBUFFER
+extern const Graphics_Display_Functions g_sCrystalfontz128x128_framebufferFuncs;
+#endif
+
+// Number of SPI bytes (commands and data) sent by the most recent flush
+extern uint32_t Lcd_FlushBytes;
+
 extern void Crystalfontz128x128_Init(void);
 
 extern void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
 extern void Crystalfontz128x128_SetOrientation(uint8_t orientation);
 
+extern bool Crystalfontz128x128_TransferDone(void);
+
+extern bool Crystalfontz128x128_FlushStep(void);
+
 
 
 #endif /* __CRYSTALFONTZLCD_H__ */
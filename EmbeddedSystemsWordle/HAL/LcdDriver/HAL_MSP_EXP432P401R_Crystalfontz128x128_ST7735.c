@@ -38,10 +38,46 @@
 //*****************************************************************************
 
 #include <HAL/LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h>
+#include <HAL/Event.h>
 #include <ti/grlib/grlib.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <stdint.h>
 
+#if LCD_RUN_BENCHMARK
+#include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
+#include <HAL/Timer.h>
+#endif
+
+#if LCD_USE_DMA
+// The uDMA control table. The controller requires it to be aligned to 1024 bytes.
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(LcdDmaControlTable, 1024)
+#elif defined(__IAR_SYSTEMS_ICC__)
+#pragma data_alignment=1024
+#elif defined(__GNUC__)
+__attribute__ ((aligned (1024)))
+#elif defined(__CC_ARM)
+__align(1024)
+#endif
+static DMA_ControlTable LcdDmaControlTable[32];
+
+// The transfer the uDMA controller is working through: rows of rowBytes bytes,
+// the start of each row stride bytes after the previous one. Each row is sent
+// in chunks of at most LCD_DMA_MAX_CHUNK bytes. When fixedSource is set, every
+// byte is read from the same address.
+static volatile bool LcdDmaBusy = false;
+static const uint8_t *LcdDmaRowStart;
+static const uint8_t *LcdDmaSource;
+static uint32_t LcdDmaRowBytes;
+static uint32_t LcdDmaStride;
+static uint32_t LcdDmaRows;
+static uint32_t LcdDmaRowLeft;
+static bool LcdDmaFixedSource;
+
+// Source of fills: a single byte, or LCD_DMA_PATTERN_PIXELS copies of the color
+static uint8_t LcdDmaPattern[2 * LCD_DMA_PATTERN_PIXELS];
+#endif
+
 void HAL_LCD_PortInit(void)
 {
     // LCD_SCK
@@ -74,23 +110,163 @@ void HAL_LCD_SpiInit(void)
     GPIO_setOutputLowOnPin(LCD_CS_PORT, LCD_CS_PIN);
 
     GPIO_setOutputHighOnPin(LCD_DC_PORT, LCD_DC_PIN);
+
+#if LCD_USE_DMA
+    DMA_enableModule();
+    DMA_setControlBase(LcdDmaControlTable);
+
+    DMA_assignChannel(LCD_DMA_TRIGGER);
+    DMA_disableChannelAttribute(LCD_DMA_TRIGGER,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+
+    DMA_assignInterrupt(LCD_DMA_INTERRUPT, LCD_DMA_CHANNEL);
+    DMA_clearInterruptFlag(LCD_DMA_CHANNEL);
+    Interrupt_enableInterrupt(INT_DMA_INT1);
+#endif
+}
+
+
+#if LCD_USE_DMA
+//*****************************************************************************
+//
+// Arms the uDMA channel with the next chunk of the current row.  The channel
+// is triggered by UCTXIFG, which is already set while the transmit buffer is
+// empty, so the transfer starts as soon as the channel is enabled.
+//
+//*****************************************************************************
+static void HAL_LCD_startDmaChunk(void)
+{
+    uint32_t chunk = LcdDmaRowLeft;
+
+    if (chunk > LCD_DMA_MAX_CHUNK)
+    {
+        chunk = LCD_DMA_MAX_CHUNK;
+    }
+
+    DMA_setChannelControl(UDMA_PRI_SELECT | LCD_DMA_TRIGGER,
+                          UDMA_SIZE_8 | UDMA_DST_INC_NONE | UDMA_ARB_1 |
+                          (LcdDmaFixedSource ? UDMA_SRC_INC_NONE : UDMA_SRC_INC_8));
+    DMA_setChannelTransfer(UDMA_PRI_SELECT | LCD_DMA_TRIGGER, UDMA_MODE_BASIC,
+                           (void *) LcdDmaSource,
+                           (void *) (uintptr_t) SPI_getTransmitBufferAddressForDMA(LCD_EUSCI_BASE),
+                           chunk);
+
+    if (!LcdDmaFixedSource)
+    {
+        LcdDmaSource += chunk;
+    }
+    LcdDmaRowLeft -= chunk;
+
+    DMA_enableChannel(LCD_DMA_CHANNEL);
+}
+
+
+//*****************************************************************************
+//
+// Starts a transfer of rows of bytes in the background.
+//
+//*****************************************************************************
+static void HAL_LCD_startDma(const uint8_t *data, uint32_t rowBytes,
+                             uint32_t stride, uint32_t rows, bool fixedSource)
+{
+    LcdDmaRowStart = data;
+    LcdDmaSource = data;
+    LcdDmaRowBytes = rowBytes;
+    LcdDmaStride = stride;
+    LcdDmaRows = rows;
+    LcdDmaRowLeft = rowBytes;
+    LcdDmaFixedSource = fixedSource;
+
+    LcdDmaBusy = true;
+    HAL_LCD_startDmaChunk();
+}
+
+
+//*****************************************************************************
+//
+// The uDMA completion ISR for the LCD channel.  Each time a chunk is done,
+// the next chunk of the row, or the first chunk of the next row, is armed.
+// After the last row the transfer is marked as finished and EVENT_LCD is
+// posted, so the loop can start the next one; its last byte may still be in
+// the SPI shift register, which HAL_LCD_writeCommand() waits for.
+//
+//*****************************************************************************
+void DMA_INT1_IRQHandler(void)
+{
+    DMA_clearInterruptFlag(LCD_DMA_CHANNEL);
+
+    if (LcdDmaRowLeft == 0)
+    {
+        if (--LcdDmaRows == 0)
+        {
+            LcdDmaBusy = false;
+            Event_post(EVENT_LCD);
+            return;
+        }
+
+        LcdDmaRowStart += LcdDmaStride;
+        LcdDmaSource = LcdDmaRowStart;
+        LcdDmaRowLeft = LcdDmaRowBytes;
+    }
+
+    HAL_LCD_startDmaChunk();
+}
+#endif
+
+
+//*****************************************************************************
+//
+// Determines whether a background transfer is still feeding the SPI module.
+//
+//*****************************************************************************
+bool HAL_LCD_isBusy(void)
+{
+#if LCD_USE_DMA
+    return LcdDmaBusy;
+#else
+    return false;
+#endif
+}
+
+
+//*****************************************************************************
+//
+// Waits until the transmit buffer can take another byte and hands it over.
+// The byte which is still being shifted out keeps going, so the CPU prepares
+// the next byte while the bus is busy instead of waiting for the bus to go
+// idle after every byte.
+//
+//*****************************************************************************
+static inline void HAL_LCD_pushByte(uint8_t data)
+{
+    while (!(UCB0IFG & UCTXIFG));
+
+    UCB0TXBUF = data;
 }
 
 
 //*****************************************************************************
 //
 // Writes a command to the CFAF128128B-0145T.  This function implements the basic SPI
-// interface to the LCD display.
+// interface to the LCD display.  DC may only change while the bus is idle, so
+// this is the only place which waits for UCBUSY.
 //
 //*****************************************************************************
 void HAL_LCD_writeCommand(uint8_t command)
 {
+    // Let any background transfer and any data still being shifted out finish
+    // before DC changes. Every drawing operation starts with a command, so this
+    // also keeps the CPU from writing into the middle of a DMA transfer.
+    while (HAL_LCD_isBusy())
+    {
+        HAL_LCD_spinWait();
+    }
+    while (UCB0STATW & UCBUSY);
+
     // Set to command mode
     GPIO_setOutputLowOnPin(LCD_DC_PORT, LCD_DC_PIN);
 
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
-
     // Transmit data
     UCB0TXBUF = command;
 
@@ -110,15 +286,172 @@ void HAL_LCD_writeCommand(uint8_t command)
 //*****************************************************************************
 void HAL_LCD_writeData(uint8_t data)
 {
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
+    HAL_LCD_pushByte(data);
+}
 
-    // Transmit data
-    UCB0TXBUF = data;
 
-    // USCI_B0 Busy? //
+//*****************************************************************************
+//
+// Streams a block of data bytes to the CFAF128128B-0145T.
+//
+//*****************************************************************************
+void HAL_LCD_writeBytes(const uint8_t *data, uint32_t count)
+{
+    while (count--)
+    {
+        HAL_LCD_pushByte(*data++);
+    }
+}
+
+
+//*****************************************************************************
+//
+// Streams the same 16-bit color to the CFAF128128B-0145T count times, high
+// byte first.  This is the inner loop of every fill.
+//
+//*****************************************************************************
+void HAL_LCD_writeRepeatedColor(uint16_t color, uint32_t count)
+{
+    uint8_t high = color >> 8;
+    uint8_t low = color;
+
+    while (count--)
+    {
+        HAL_LCD_pushByte(high);
+        HAL_LCD_pushByte(low);
+    }
+}
+
+
+//*****************************************************************************
+//
+// Streams a row of 16-bit pixels to the CFAF128128B-0145T, high byte first.
+//
+//*****************************************************************************
+void HAL_LCD_writePixelRow(const uint16_t *pixels, uint32_t count)
+{
+    while (count--)
+    {
+        HAL_LCD_pushByte(*pixels >> 8);
+        HAL_LCD_pushByte(*pixels++);
+    }
+}
+
+
+//*****************************************************************************
+//
+// Sends the same 16-bit color count times, high byte first.  Large fills are
+// handed to the uDMA controller and this function returns while they are
+// still running; HAL_LCD_isBusy() reports when they are done.  If both bytes
+// of the color are the same, the DMA reads one fixed byte.  Otherwise it
+// reads a pattern of LCD_DMA_PATTERN_PIXELS pixels over and over, and the
+// pixels which do not fill a whole pattern are written by the CPU first.
+//
+//*****************************************************************************
+void HAL_LCD_startFill(uint16_t color, uint32_t count)
+{
+#if LCD_USE_DMA
+    uint32_t i;
+
+    if (count >= LCD_DMA_MIN_PIXELS)
+    {
+        LcdDmaPattern[0] = color >> 8;
+        LcdDmaPattern[1] = color;
+
+        if (LcdDmaPattern[0] == LcdDmaPattern[1])
+        {
+            HAL_LCD_startDma(LcdDmaPattern, 2 * count, 0, 1, true);
+            return;
+        }
+
+        for (i = 2; i < sizeof(LcdDmaPattern); i++)
+        {
+            LcdDmaPattern[i] = LcdDmaPattern[i & 1];
+        }
+
+        HAL_LCD_writeRepeatedColor(color, count % LCD_DMA_PATTERN_PIXELS);
+        HAL_LCD_startDma(LcdDmaPattern, sizeof(LcdDmaPattern), 0,
+                         count / LCD_DMA_PATTERN_PIXELS, false);
+        return;
+    }
+#endif
+
+    HAL_LCD_writeRepeatedColor(color, count);
+}
+
+
+//*****************************************************************************
+//
+// Sends rows of bytes which are already in the order the display expects,
+// such as a region of a framebuffer.  The start of each row is stride bytes
+// after the start of the previous one.  With DMA, the blit continues in the
+// background and the data must stay in place until HAL_LCD_isBusy() is false.
+//
+//*****************************************************************************
+void HAL_LCD_startBlit(const uint8_t *data, uint32_t rowBytes, uint32_t stride, uint32_t rows)
+{
+    // Contiguous rows are sent as a single long row
+    if (rowBytes == stride)
+    {
+        rowBytes *= rows;
+        rows = 1;
+    }
+
+#if LCD_USE_DMA
+    HAL_LCD_startDma(data, rowBytes, stride, rows, false);
+#else
+    while (rows--)
+    {
+        HAL_LCD_writeBytes(data, rowBytes);
+        data += stride;
+    }
+#endif
+}
+
+
+#if LCD_RUN_BENCHMARK
+//*****************************************************************************
+//
+// Times one full-screen clear in system clock cycles.  With streaming false
+// every byte is written the way this driver used to write it, waiting for
+// UCBUSY before and after the byte; with streaming true the clear goes
+// through HAL_LCD_startFill(), which uses DMA when LCD_USE_DMA is set.
+//
+//*****************************************************************************
+uint64_t HAL_LCD_timeFullScreenClear(bool streaming)
+{
+    SWTimer timer = SWTimer_construct(0);
+    uint32_t i;
+
+    Crystalfontz128x128_SetDrawFrame(0, 0, LCD_HORIZONTAL_MAX - 1, LCD_VERTICAL_MAX - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    SWTimer_start(&timer);
+
+    if (streaming)
+    {
+        HAL_LCD_startFill(0x0000, LCD_HORIZONTAL_MAX * LCD_VERTICAL_MAX);
+        while (HAL_LCD_isBusy())
+        {
+            HAL_LCD_spinWait();
+        }
+    }
+    else
+    {
+        for (i = 0; i < 2 * LCD_HORIZONTAL_MAX * LCD_VERTICAL_MAX; i++)
+        {
+            while (UCB0STATW & UCBUSY);
+            UCB0TXBUF = 0x00;
+            while (UCB0STATW & UCBUSY);
+        }
+    }
+
     while (UCB0STATW & UCBUSY);
+
+    return SWTimer_elapsedCycles(&timer);
 }
+#endif
+
 
 //*****************************************************************************
 //
@@ -154,7 +487,7 @@ SysCtlDelay(uint32_t ui32Count)
           "    bx      lr");
 }
 #endif
-#if defined(codered) || defined( __GNUC__ ) || defined(sourcerygxx)
+#if defined(codered) || (defined( __GNUC__ ) && defined( __arm__ )) || defined(sourcerygxx)
 void __attribute__((naked))
 SysCtlDelay(uint32_t ui32Count)
 {
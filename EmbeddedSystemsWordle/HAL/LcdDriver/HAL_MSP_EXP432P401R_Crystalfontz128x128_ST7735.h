@@ -42,6 +42,7 @@
 
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 //*****************************************************************************
 //
@@ -73,6 +74,35 @@
 // Definition of USCI base address to be used for SPI communication
 #define LCD_EUSCI_BASE        EUSCI_B0_BASE
 
+// Set to 1 to feed large fills and framebuffer blits to the SPI transmit buffer
+// with the uDMA controller, so they continue in the background
+#ifndef LCD_USE_DMA
+#define LCD_USE_DMA           1
+#endif
+
+// uDMA channel 0 with source 1 is the eUSCI_B0 transmit trigger. Its completion
+// interrupt is routed to DMA_INT1.
+#define LCD_DMA_CHANNEL       0
+#define LCD_DMA_TRIGGER       DMA_CH0_EUSCIB0TX0
+#define LCD_DMA_INTERRUPT     DMA_INT1
+
+// The uDMA controller moves at most 1024 items per transfer
+#define LCD_DMA_MAX_CHUNK     1024
+
+// Fills whose color has two different bytes are sent from a pattern of this
+// many pixels, since the DMA source can only stay fixed on a single byte
+#define LCD_DMA_PATTERN_PIXELS 128
+
+// Fills shorter than this many pixels are written by the CPU, which is faster
+// than setting up a DMA transfer for them. Must be at least LCD_DMA_PATTERN_PIXELS.
+#define LCD_DMA_MIN_PIXELS    LCD_DMA_PATTERN_PIXELS
+
+// Set to 1 to build HAL_LCD_timeFullScreenClear(), which HAL_construct() uses to
+// report over UART how long a full-screen clear takes with and without streaming
+#ifndef LCD_RUN_BENCHMARK
+#define LCD_RUN_BENCHMARK     0
+#endif
+
 //*****************************************************************************
 //
 // Prototypes for the globals exported by this driver.
@@ -80,9 +110,19 @@
 //*****************************************************************************
 extern void HAL_LCD_writeCommand(uint8_t command);
 extern void HAL_LCD_writeData(uint8_t data);
+extern void HAL_LCD_writeBytes(const uint8_t *data, uint32_t count);
+extern void HAL_LCD_writeRepeatedColor(uint16_t color, uint32_t count);
+extern void HAL_LCD_writePixelRow(const uint16_t *pixels, uint32_t count);
+extern void HAL_LCD_startFill(uint16_t color, uint32_t count);
+extern void HAL_LCD_startBlit(const uint8_t *data, uint32_t rowBytes, uint32_t stride, uint32_t rows);
+extern bool HAL_LCD_isBusy(void);
 extern void HAL_LCD_PortInit(void);
 extern void HAL_LCD_SpiInit(void);
 
+#if LCD_RUN_BENCHMARK
+extern uint64_t HAL_LCD_timeFullScreenClear(bool streaming);
+#endif
+
 // Custom __delay_cycles() for non CCS Compiler
 #if !defined( __TI_ARM__ )
 #undef __delay_cycles
@@ -92,4 +132,11 @@ void SysCtlDelay(uint32_t);
 
 #define HAL_LCD_delay(x)      __delay_cycles(x * 48)
 
+// The body of the loops which wait for the DMA interrupt to finish a transfer.
+// On the MSP432 there is nothing to do; the host simulator defines it so that
+// simulated time passes while the CPU spins.
+#ifndef HAL_LCD_spinWait
+#define HAL_LCD_spinWait()
+#endif
+
 #endif /* HAL_MSP_EXP432P401R_CRYSTALFONTZ128X128_ST7735_H_ */
@@ -0,0 +1,224 @@
+/*
+ * Profile.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// For clock_gettime(), on hosts which time regions with CLOCK_MONOTONIC
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <string.h>
+
+#include <HAL/Profile.h>
+
+#ifdef PROFILE_MONOTONIC
+#include <time.h>
+#endif
+
+// Room for the longest row of the CSV: a name, four numbers of up to 20 digits and PROFILE_BUCKETS of up to 10
+#define PROFILE_LINE_SIZE   512
+
+// The dump fills the transmit buffer only this far, so the echoes of what the player types still fit
+#define PROFILE_DUMP_FILL   (UART_TX_BUFFER_SIZE / 2)
+
+static ProfileStats table[PROFILE_REGIONS];
+
+static const char* const names[PROFILE_REGIONS] =
+{
+    "HAL_refreshInputs",
+    "HAL_flushStep",
+    "Application_update",
+    "Application_showTitleScreen",
+    "Application_showCreateWord",
+    "Application_showGuessWord",
+    "Application_showAbsurdle",
+    "Application_showStatus",
+    "Application_showHint",
+    "Application_showFeedback",
+    "Application_wordleAlgo",
+    "Absurdle_step",
+    "LCD RectFill",
+    "LCD PixelDrawMultiple",
+    "Event_wait sleep",
+};
+
+/**
+ * Where the dump has got to: the line of the CSV being sent, with line 0 the
+ * header, and how much of it is already in the transmit buffer. The line is
+ * formatted once, when it is started, so a row is sent as it was at that time.
+ */
+static bool dumping = false;
+static uint32_t dumpLine;
+static uint32_t dumpLength;
+static uint32_t dumpSent;
+static char line[PROFILE_LINE_SIZE];
+
+/** Returns the bucket of the histogram a time falls into. */
+static uint32_t Profile_bucket(ProfileCount elapsed)
+{
+    uint32_t bucket = 0;
+
+#if defined(__GNUC__)
+    // One instruction on the Cortex-M4 and on hosts
+    if (elapsed > 1)
+    {
+        bucket = (uint32_t) (63 - __builtin_clzll((unsigned long long) elapsed));
+    }
+#else
+    while (elapsed > 1)
+    {
+        elapsed >>= 1;
+        bucket++;
+    }
+#endif
+
+    return (bucket < PROFILE_BUCKETS) ? bucket : PROFILE_BUCKETS - 1;
+}
+
+/**
+ * Enables the DWT unit's cycle counter on the board. It runs at MCLK, wraps
+ * around every 89 seconds, and is read in a single load; regions take their
+ * difference in 32 bits, so a region shorter than a wrap is always right.
+ */
+void Profile_init(void)
+{
+#if !defined(PROFILE_OWN_COUNTER) && (defined(__TI_ARM__) || defined(__arm__))
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    Profile_reset();
+}
+
+void Profile_reset(void)
+{
+    uint32_t region;
+
+    memset(table, 0, sizeof(table));
+    for (region = 0; region < PROFILE_REGIONS; region++)
+    {
+        table[region].min = (ProfileCount) -1;
+    }
+}
+
+void Profile_record(ProfileRegion region, ProfileCount elapsed)
+{
+    ProfileStats* stats_p = &table[region];
+
+    stats_p->count++;
+    stats_p->total += elapsed;
+    stats_p->min = (elapsed < stats_p->min) ? elapsed : stats_p->min;
+    stats_p->max = (elapsed > stats_p->max) ? elapsed : stats_p->max;
+    stats_p->histogram[Profile_bucket(elapsed)]++;
+}
+
+const ProfileStats* Profile_stats(ProfileRegion region)
+{
+    return &table[region];
+}
+
+const char* Profile_name(ProfileRegion region)
+{
+    return names[region];
+}
+
+#ifdef PROFILE_MONOTONIC
+ProfileCount Profile_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ProfileCount) ts.tv_sec * 1000000000u + (ProfileCount) ts.tv_nsec;
+}
+#endif
+
+/**
+ * Formats a line of the CSV: the header for line 0, and after it the row of
+ * region line - 1. A region which has not run has no least or mean time, so
+ * those are left empty.
+ */
+static uint32_t Profile_formatLine(uint32_t number)
+{
+    const ProfileStats* stats_p = (number > 0) ? &table[number - 1] : NULL;
+    uint32_t length, bucket;
+
+    if (stats_p == NULL)
+    {
+        length = snprintf(line, sizeof(line), "region,unit,count,min,mean,max");
+        for (bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, ",2^%u", (unsigned) bucket);
+        }
+    }
+    else if (stats_p->count == 0)
+    {
+        length = snprintf(line, sizeof(line), "%s,%s,0,,,0", names[number - 1], PROFILE_UNIT);
+        for (bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, ",0");
+        }
+    }
+    else
+    {
+        length = snprintf(line, sizeof(line), "%s,%s,%lu,%llu,%llu,%llu", names[number - 1], PROFILE_UNIT,
+                          (unsigned long) stats_p->count, (unsigned long long) stats_p->min,
+                          (unsigned long long) (stats_p->total / stats_p->count),
+                          (unsigned long long) stats_p->max);
+        for (bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, ",%lu",
+                               (unsigned long) stats_p->histogram[bucket]);
+        }
+    }
+
+    length += snprintf(line + length, sizeof(line) - length, "\r\n");
+    return length;
+}
+
+bool Profile_isDumping(void)
+{
+    return dumping;
+}
+
+void Profile_startDump(void)
+{
+    dumping = true;
+    dumpLine = 0;
+    dumpLength = Profile_formatLine(0);
+    dumpSent = 0;
+}
+
+/**
+ * Tops the transmit buffer up to PROFILE_DUMP_FILL with the current line,
+ * moving on to the next line once one is all queued. A row is longer than the
+ * buffer, so it goes out over many super-loops, and nothing is ever dropped.
+ */
+bool Profile_dumpStep(UART* uart_p)
+{
+    uint32_t pending, room, chunk;
+
+    while (dumping)
+    {
+        pending = UART_txPending(uart_p);
+        room = (pending < PROFILE_DUMP_FILL) ? PROFILE_DUMP_FILL - pending : 0;
+        chunk = dumpLength - dumpSent;
+        chunk = (chunk < room) ? chunk : room;
+        if (chunk == 0)
+        {
+            break;
+        }
+
+        dumpSent += UART_sendBytes(uart_p, (const uint8_t*) line + dumpSent, chunk);
+        if (dumpSent == dumpLength)
+        {
+            dumpLine++;
+            dumping = dumpLine <= PROFILE_REGIONS;
+            dumpLength = dumping ? Profile_formatLine(dumpLine) : 0;
+            dumpSent = 0;
+        }
+    }
+
+    return dumping;
+}
@@ -0,0 +1,146 @@
+/*
+ * Profile.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Profiling regions around the hot paths of the program, so there is some
+ * visibility into where the 48 MHz go. PROFILE_BEGIN(region) reads a cycle
+ * counter into a local and PROFILE_END(region) records the difference in the
+ * region's row of a static table: how often it ran, the least, the most and
+ * the mean time it took, and a histogram with a bucket per power of two. The
+ * counter is the Cortex-M4's DWT->CYCCNT on the board, a read of one register
+ * with no interrupt to service, the simulator's clock in builds against Sim/,
+ * and the time stamp counter or CLOCK_MONOTONIC on other hosts.
+ *
+ * PROFILE_SLEEP is the time Event_wait() keeps the CPU in LPM0, so the share
+ * of the time the CPU is awake is what is left over.
+ *
+ * Regions may nest; each one counts the time of the regions inside it too.
+ * They are recorded from the super-loop only, never from an interrupt, and the
+ * time of any interrupt taken inside a region counts towards it.
+ *
+ * The table goes out over UART as CSV, a row per region, when the application
+ * receives PROFILE_DUMP_KEY. Build with -DPROFILE_ENABLED=0 to leave the
+ * regions, the table and the command out.
+ */
+
+#ifndef HAL_PROFILE_H_
+#define HAL_PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <HAL/UART.h>
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED     1
+#endif
+
+// Ctrl-P on the terminal dumps the table
+#define PROFILE_DUMP_KEY    0x10
+
+// Buckets in a region's histogram. Bucket b counts the times from 2^b up to 2^(b+1) - 1, and bucket
+// 0 counts 0 and 1 too; the last bucket also counts everything longer.
+#define PROFILE_BUCKETS     32
+
+// The regions, a row of the table each
+enum _ProfileRegion
+{
+    PROFILE_HAL_REFRESH_INPUTS,
+    PROFILE_HAL_FLUSH_STEP,
+    PROFILE_APPLICATION_UPDATE,
+    PROFILE_SHOW_TITLE_SCREEN,
+    PROFILE_SHOW_CREATE_WORD,
+    PROFILE_SHOW_GUESS_WORD,
+    PROFILE_SHOW_ABSURDLE,
+    PROFILE_SHOW_STATUS,
+    PROFILE_SHOW_HINT,
+    PROFILE_SHOW_FEEDBACK,
+    PROFILE_WORDLE_ALGO,
+    PROFILE_ABSURDLE_STEP,
+    PROFILE_LCD_RECT_FILL,
+    PROFILE_LCD_PIXEL_DRAW_MULTIPLE,
+    PROFILE_SLEEP,
+    PROFILE_REGIONS
+};
+typedef enum _ProfileRegion ProfileRegion;
+
+// The counter regions are timed with, and the unit the table is in. A build with a counter of its own, such as the
+// simulator in Host/, defines PROFILE_NOW() and PROFILE_UNIT ahead of this header, and counts in 64 bits.
+#if defined(PROFILE_NOW)
+#define PROFILE_OWN_COUNTER
+typedef uint64_t ProfileCount;
+#elif defined(__TI_ARM__) || defined(__arm__)
+typedef uint32_t ProfileCount;
+#define PROFILE_NOW()       (DWT->CYCCNT)
+#define PROFILE_UNIT        "cycles"
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+typedef uint64_t ProfileCount;
+#define PROFILE_NOW()       __rdtsc()
+#define PROFILE_UNIT        "tsc"
+#else
+typedef uint64_t ProfileCount;
+#define PROFILE_NOW()       Profile_now()
+#define PROFILE_UNIT        "ns"
+#define PROFILE_MONOTONIC   1
+#endif
+
+/**=================================================================================================
+ * The row of the table for one region. Only functions whose names start with "Profile_*" may
+ * write to it.
+ */
+struct _ProfileStats
+{
+    uint32_t count;
+    ProfileCount min;
+    ProfileCount max;
+    uint64_t total;
+    uint32_t histogram[PROFILE_BUCKETS];
+};
+typedef struct _ProfileStats ProfileStats;
+
+#if PROFILE_ENABLED
+
+// Starts timing a region, in the scope the matching PROFILE_END() is in
+#define PROFILE_BEGIN(region)   ProfileCount profileStart_##region = PROFILE_NOW()
+
+// Records the time since the matching PROFILE_BEGIN()
+#define PROFILE_END(region)     Profile_record((region), PROFILE_NOW() - profileStart_##region)
+
+#else
+
+#define PROFILE_BEGIN(region)
+#define PROFILE_END(region)     ((void) 0)
+
+#endif
+
+// Starts the cycle counter, if there is one to start, and empties the table. HAL_construct() calls this.
+void Profile_init(void);
+
+// Empties the table
+void Profile_reset(void);
+
+// Adds one time to a region's row
+void Profile_record(ProfileRegion region, ProfileCount elapsed);
+
+// Returns a region's row of the table
+const ProfileStats* Profile_stats(ProfileRegion region);
+
+// Returns the name a region goes by in the CSV
+const char* Profile_name(ProfileRegion region);
+
+#ifdef PROFILE_MONOTONIC
+// Returns nanoseconds from CLOCK_MONOTONIC, on hosts with no cycle counter to read
+ProfileCount Profile_now(void);
+#endif
+
+// Starts sending the table over UART as CSV, a header and then a row per region, from the next Profile_dumpStep()
+void Profile_startDump(void);
+
+// Returns true from Profile_startDump() until the whole CSV is queued
+bool Profile_isDumping(void);
+
+// Queues as much of the CSV as fits in the transmit buffer without waiting. Returns true while there is more to send.
+bool Profile_dumpStep(UART* uart_p);
+
+#endif /* HAL_PROFILE_H_ */
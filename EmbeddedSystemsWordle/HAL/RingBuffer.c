@@ -0,0 +1,124 @@
+/*
+ * RingBuffer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <HAL/RingBuffer.h>
+
+/**
+ * Constructs an empty ring buffer which stores its bytes in the given array.
+ *
+ * @param storage:  The array which holds the queued bytes
+ * @param size:     The number of bytes in the array. MUST be a power of two.
+ *
+ * @return an empty RingBuffer
+ */
+RingBuffer RingBuffer_construct(volatile uint8_t* storage, uint32_t size)
+{
+    RingBuffer buffer;
+
+    buffer.data = storage;
+    buffer.mask = size - 1;
+    buffer.head = 0;
+    buffer.tail = 0;
+    buffer.drops = 0;
+    buffer.highWater = 0;
+
+    return buffer;
+}
+
+/**
+ * Queues one byte. The byte is written into the array BEFORE the head index is
+ * published, so the consumer never sees an index pointing at a byte which has
+ * not been stored yet. Only the producer writes the head index, so no locking
+ * is needed. The high-water mark is also only written here, so it may lag the
+ * true peak by the bytes popped while we were checking, but never exceeds it.
+ *
+ * @param buffer_p: The buffer to push into
+ * @param value:    The byte to queue
+ *
+ * @return true if the byte was queued, false if the buffer was full
+ */
+bool RingBuffer_push(RingBuffer* buffer_p, uint8_t value)
+{
+    uint32_t head = buffer_p->head;
+    uint32_t tail = RING_BUFFER_LOAD(buffer_p->tail);
+
+    if (head - tail > buffer_p->mask)
+    {
+        buffer_p->drops++;
+        return false;
+    }
+
+    buffer_p->data[head & buffer_p->mask] = value;
+    RING_BUFFER_STORE(buffer_p->head, head + 1);
+
+    if (head + 1 - tail > buffer_p->highWater)
+    {
+        buffer_p->highWater = head + 1 - tail;
+    }
+
+    return true;
+}
+
+/**
+ * Removes the oldest byte. The byte is read out of the array BEFORE the tail
+ * index is published, so the producer can never overwrite it while we are
+ * still reading it. Only the consumer writes the tail index.
+ *
+ * @param buffer_p: The buffer to pop from
+ * @param value_p:  Where to store the removed byte
+ *
+ * @return true if a byte was removed, false if the buffer was empty
+ */
+bool RingBuffer_pop(RingBuffer* buffer_p, uint8_t* value_p)
+{
+    uint32_t tail = buffer_p->tail;
+    uint32_t head = RING_BUFFER_LOAD(buffer_p->head);
+
+    if (head == tail)
+    {
+        return false;
+    }
+
+    *value_p = buffer_p->data[tail & buffer_p->mask];
+    RING_BUFFER_STORE(buffer_p->tail, tail + 1);
+
+    return true;
+}
+
+/**
+ * Determines if the buffer is empty by comparing the two indices.
+ *
+ * @param buffer_p: The buffer to check
+ * @return true if there is no byte to pop
+ */
+bool RingBuffer_isEmpty(RingBuffer* buffer_p)
+{
+    return RING_BUFFER_LOAD(buffer_p->head) == RING_BUFFER_LOAD(buffer_p->tail);
+}
+
+/**
+ * Determines if the buffer is full. The difference of the indices can never
+ * be larger than the size of the array.
+ *
+ * @param buffer_p: The buffer to check
+ * @return true if the next push would be dropped
+ */
+bool RingBuffer_isFull(RingBuffer* buffer_p)
+{
+    return RingBuffer_count(buffer_p) > buffer_p->mask;
+}
+
+/**
+ * Computes how many bytes are queued. Since both indices are free-running,
+ * their difference is correct even after they wrap around 2^32.
+ *
+ * @param buffer_p: The buffer to check
+ * @return the number of queued bytes
+ */
+uint32_t RingBuffer_count(RingBuffer* buffer_p)
+{
+    return RING_BUFFER_LOAD(buffer_p->head) - RING_BUFFER_LOAD(buffer_p->tail);
+}
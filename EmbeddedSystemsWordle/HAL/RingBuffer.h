@@ -0,0 +1,72 @@
+/*
+ * RingBuffer.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef HAL_RINGBUFFER_H_
+#define HAL_RINGBUFFER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The TI compiler and the single-core Cortex-M4 keep volatile accesses in program order, which is
+// all an ISR-to-main-loop handoff needs. Host builds run producer and consumer on different cores,
+// so there the index updates need acquire/release ordering.
+#if defined(__GNUC__) && !defined(__TI_ARM__)
+#define RING_BUFFER_LOAD(index)             __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define RING_BUFFER_STORE(index, value)     __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+#else
+#define RING_BUFFER_LOAD(index)             (index)
+#define RING_BUFFER_STORE(index, value)     ((index) = (value))
+#endif
+
+/**=================================================================================================
+ * A lock-free single-producer/single-consumer byte queue, implemented in the C object-oriented
+ * style. Use the constructor [RingBuffer_construct()] with a storage array whose size is a power of
+ * two. Exactly one context (for example an ISR) may call [RingBuffer_push()] and exactly one other
+ * context (for example the main super-loop) may call [RingBuffer_pop()].
+ * =================================================================================================
+ * USAGE WARNINGS
+ * =================================================================================================
+ * When using this object, DO NOT DIRECTLY ACCESS ANY MEMBER VARIABLES of a RingBuffer struct. The
+ * head index is owned by the producer and the tail index by the consumer, and that ownership is the
+ * only thing which keeps the buffer consistent without disabling interrupts.
+ */
+struct _RingBuffer
+{
+    // The storage array and its size minus one, used to wrap the free-running indices
+    volatile uint8_t* data;
+    uint32_t mask;
+
+    // Free-running indices. The number of queued bytes is always head - tail.
+    volatile uint32_t head;
+    volatile uint32_t tail;
+
+    // The number of bytes the producer had to throw away because the buffer was full
+    volatile uint32_t drops;
+
+    // The largest number of bytes that have ever been queued at once, kept by the producer
+    volatile uint32_t highWater;
+};
+typedef struct _RingBuffer RingBuffer;
+
+// Constructs an empty ring buffer on top of a storage array. The size must be a power of two.
+RingBuffer RingBuffer_construct(volatile uint8_t* storage, uint32_t size);
+
+// Producer side: queues one byte. Returns false and counts a drop if the buffer is full.
+bool RingBuffer_push(RingBuffer* buffer_p, uint8_t value);
+
+// Consumer side: removes the oldest byte. Returns false if the buffer is empty.
+bool RingBuffer_pop(RingBuffer* buffer_p, uint8_t* value_p);
+
+// Returns true if there is nothing to pop
+bool RingBuffer_isEmpty(RingBuffer* buffer_p);
+
+// Returns true if a push would be dropped
+bool RingBuffer_isFull(RingBuffer* buffer_p);
+
+// Returns the number of bytes currently queued
+uint32_t RingBuffer_count(RingBuffer* buffer_p);
+
+#endif /* HAL_RINGBUFFER_H_ */
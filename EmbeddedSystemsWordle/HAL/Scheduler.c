@@ -0,0 +1,162 @@
+/*
+ * Scheduler.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <HAL/Scheduler.h>
+
+// The tasks added, highest priority first
+static Task* tasks = NULL;
+
+Task Task_construct(const char* name, TaskFunction run, void* context, uint32_t priority, EventSet events,
+                    uint32_t budget_us)
+{
+    Task task;
+
+    task.next = NULL;
+    task.name = name;
+    task.run = run;
+    task.context = context;
+    task.priority = priority;
+    task.events = events;
+    task.budgetCycles = Clock_fromUs(budget_us);
+    task.ready = false;
+    task.yielded = false;
+    task.signalled = 0;
+    memset(&task.stats, 0, sizeof(task.stats));
+
+    return task;
+}
+
+/**
+ * A task which is ready already keeps the time of its first signal, and one
+ * which yielded the time it yielded, so its wait counts from the oldest thing
+ * it has to handle. A signal makes a task which yielded ready straight away,
+ * since it has something new to handle.
+ */
+void Task_signal(Task* task_p)
+{
+    if (!task_p->ready)
+    {
+        task_p->ready = true;
+        if (!task_p->yielded)
+        {
+            task_p->signalled = Clock_cycles();
+        }
+        task_p->yielded = false;
+    }
+}
+
+const TaskStats* Task_stats(Task* task_p)
+{
+    return &task_p->stats;
+}
+
+uint64_t Task_budgetCycles(Task* task_p)
+{
+    return task_p->budgetCycles;
+}
+
+void Task_resetStats(Task* task_p)
+{
+    memset(&task_p->stats, 0, sizeof(task_p->stats));
+}
+
+void Scheduler_add(Task* task_p)
+{
+    Task** link_p = &tasks;
+
+    while (*link_p != NULL && (*link_p)->priority >= task_p->priority)
+    {
+        link_p = &(*link_p)->next;
+    }
+
+    task_p->next = *link_p;
+    *link_p = task_p;
+}
+
+void Scheduler_signal(EventSet events)
+{
+    Task* task_p;
+
+    if (events == 0)
+    {
+        return;
+    }
+
+    for (task_p = tasks; task_p != NULL; task_p = task_p->next)
+    {
+        if ((task_p->events & events) != 0)
+        {
+            Task_signal(task_p);
+        }
+    }
+}
+
+/** Returns the ready task of highest priority, or NULL. */
+static Task* Scheduler_firstReady(void)
+{
+    Task* task_p = tasks;
+
+    while (task_p != NULL && !task_p->ready)
+    {
+        task_p = task_p->next;
+    }
+    return task_p;
+}
+
+/**
+ * The task is no longer ready while it runs, so it, or a task it signals, can
+ * make it ready again. A task which yields is left out until no task is
+ * ready, and then every task which yielded is ready again at once.
+ */
+bool Scheduler_runNext(void)
+{
+    Task* task_p = Scheduler_firstReady();
+    uint64_t start, end, elapsed;
+    bool more;
+
+    if (task_p == NULL)
+    {
+        for (task_p = tasks; task_p != NULL; task_p = task_p->next)
+        {
+            task_p->ready = task_p->ready || task_p->yielded;
+            task_p->yielded = false;
+        }
+
+        task_p = Scheduler_firstReady();
+        if (task_p == NULL)
+        {
+            return false;
+        }
+    }
+
+    task_p->ready = false;
+    start = Clock_cycles();
+    more = task_p->run(task_p->context);
+    end = Clock_cycles();
+    elapsed = end - start;
+
+    task_p->stats.runs++;
+    task_p->stats.total += elapsed;
+    task_p->stats.overruns += elapsed > task_p->budgetCycles;
+    task_p->stats.longestRun = (elapsed > task_p->stats.longestRun) ? elapsed : task_p->stats.longestRun;
+    task_p->stats.longestWait = (start - task_p->signalled > task_p->stats.longestWait) ?
+                                start - task_p->signalled : task_p->stats.longestWait;
+
+    if (more && !task_p->ready)
+    {
+        task_p->yielded = true;
+        task_p->signalled = end;
+    }
+    return true;
+}
+
+Task* Scheduler_next(Task* task_p)
+{
+    return (task_p == NULL) ? tasks : task_p->next;
+}
@@ -0,0 +1,113 @@
+/*
+ * Scheduler.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A run-to-completion scheduler for the super-loop, in place of one call
+ * per loop which does everything in turn. The work is split
+ * into tasks, each a function which does a bounded piece of its job and
+ * returns. A task runs once it is signalled, by one of the events from
+ * HAL/Event.h it waits for or by another task, and Scheduler_runNext() always
+ * runs the ready task of highest priority. Tasks never interrupt each other,
+ * so once a task is signalled it waits for at most the run already in
+ * progress, whatever its priority, and then for the tasks above it. A long
+ * job, such as sending a whole screen or searching for a hint, does a slice
+ * and returns true to yield. It runs again once every task which is ready has
+ * had a run, those below it too, so a search does not hold up the screen
+ * which shows its progress; the tasks which yield take turns.
+ *
+ * Every task has a budget of cycles per run. Each run is timed with
+ * Clock_cycles() and a run over budget counts as an overrun, and the longest
+ * wait from being signalled to running is kept too. As long as no task
+ * overruns, the wait of a task is bounded by the budgets of the others, which
+ * is how a latency target for input is shown to hold.
+ */
+
+#ifndef HAL_SCHEDULER_H_
+#define HAL_SCHEDULER_H_
+
+#include <stdbool.h>
+#include <HAL/Clock.h>
+#include <HAL/Event.h>
+
+// Does a piece of a task's work. Returns true if it yields with more to do, and should run again.
+typedef bool (*TaskFunction)(void* context);
+
+/**
+ * What the scheduler has measured of a task. Times are in cycles of
+ * Clock_cycles(). The wait of a task is timed from the signal, so it leaves
+ * out the part of the run in progress which went by before the loop saw the
+ * event; the budget of that run bounds it.
+ */
+struct _TaskStats
+{
+    uint32_t runs;
+    uint32_t overruns;      // Runs which took longer than the budget
+    uint64_t total;         // Cycles of all runs together
+    uint64_t longestRun;
+    uint64_t longestWait;   // From being signalled to starting to run
+};
+typedef struct _TaskStats TaskStats;
+
+/**=================================================================================================
+ * A task of the scheduler, implemented in the C object-oriented style. Construct it with
+ * [Task_construct()] and hand it to [Scheduler_add()] once, where it lives for good.
+ * =================================================================================================
+ * USAGE WARNINGS
+ * =================================================================================================
+ * The scheduler holds the task by its address from [Scheduler_add()] on, so DO NOT COPY OR MOVE
+ * a task once it is added. Treat all members as PRIVATE - only functions whose names start with
+ * "Task_*" or "Scheduler_*" may access them.
+ */
+struct _Task
+{
+    // The next task, of the same or lower priority
+    struct _Task* next;
+
+    const char* name;
+    TaskFunction run;
+    void* context;
+
+    uint32_t priority;      // Higher runs first
+    EventSet events;        // The events which signal it
+    uint64_t budgetCycles;  // The longest a run should take
+
+    bool ready;
+    bool yielded;           // Whether it yielded, and waits for the ready tasks to have a run
+    uint64_t signalled;     // When it was signalled or yielded, while it waits
+
+    TaskStats stats;
+};
+typedef struct _Task Task;
+
+// Constructs a task which runs run(context) with the given priority and budget per run once one of
+// the given events, or another task, signals it. It is not ready until it is signalled.
+Task Task_construct(const char* name, TaskFunction run, void* context, uint32_t priority, EventSet events,
+                    uint32_t budget_us);
+
+// Makes a task ready to run, if it is not already
+void Task_signal(Task* task_p);
+
+// Returns what the scheduler has measured of a task
+const TaskStats* Task_stats(Task* task_p);
+
+// Returns the budget of a task per run, in cycles of Clock_cycles()
+uint64_t Task_budgetCycles(Task* task_p);
+
+// Forgets what the scheduler has measured of a task
+void Task_resetStats(Task* task_p);
+
+// Adds a task to the scheduler, after the tasks of the same priority already added
+void Scheduler_add(Task* task_p);
+
+// Signals every task which waits for one of the given events
+void Scheduler_signal(EventSet events);
+
+// Runs the ready task of highest priority once. Returns false if no task is ready, when the
+// super-loop may sleep until an event comes.
+bool Scheduler_runNext(void);
+
+// Returns the task added after the given one, or the first task for NULL, or NULL after the last
+Task* Scheduler_next(Task* task_p);
+
+#endif /* HAL_SCHEDULER_H_ */
@@ -5,22 +5,9 @@
  *      Author: Matthew Zhong
  */
 
+#include <HAL/Clock.h>
 #include <HAL/Timer.h>
 
-/** The reference counter which tracks how many rollovers have occurred. Used in timing SWTimers. */
-static volatile uint64_t hwTimerRollovers = 0;
-
-/**
- * The ISR used to increment the total number of rollovers which have passed. When the
- * TIMER32_0_BASE timer expires, this ISR is automatically called. DO NOT DIRECTLY INVOKE THIS
- * FUNCTION FROM YOUR CODE, or you WILL destroy the accuracy of ALL software timers in your code.
- */
-void T32_INT1_IRQHandler()
-{
-    hwTimerRollovers++;
-    Timer32_clearInterruptFlag(TIMER32_0_BASE);
-}
-
 /**
  * Initializes the global system timing. This function should be called immediately after the
  * Watchdog timer is reset, so that the system clock is set appropriately.
@@ -57,26 +44,19 @@ void InitSystemTiming()
     CS_initClockSignal(CS_SMCLK , CS_DCOCLK_SELECT , CS_CLOCK_DIVIDER_1);
     CS_initClockSignal(CS_ACLK  , CS_REFOCLK_SELECT, CS_CLOCK_DIVIDER_1);
 
-    // Initialize the main hardware timer under which all other software timers are based. This
-    // should be a periodic timer with the maximum load value supported and a prescaler of 1 in
-    // order to minimize the frequency of interrupts while keeping a high timer resolution.
-    Timer32_initModule(TIMER32_0_BASE, TIMER32_PRESCALER_1, TIMER32_32BIT, TIMER32_PERIODIC_MODE);
-    Timer32_setCount(TIMER32_0_BASE, LOADVALUE);
-
-    // Starts the main reference hardware timer and enables an interrupt which counts rollovers
-    Timer32_startTimer(TIMER32_0_BASE, false);
+    // Start the clock under which all software timers are based. It runs on the main hardware
+    // timer, TIMER32_0_BASE, and enables the interrupt which counts its rollovers.
+    Clock_init();
 
     // Enable interrupts again, after all system timing has been set up properly
     Interrupt_enableMaster();
-    Interrupt_enableInterrupt(INT_T32_INT1);
 }
 
 /**
- * Constructs a new Software Timer, using a wait time in milliseconds. The timer uses the
- * hwTimerRollovers variable to keep track of its reference time, and is based off of time passing
- * under the TIMER32_0_BASE. When first constructed, this timer is NOT conditioned to start. Before
- * any calls to SWTimer_expired(), SWTimer_elapsedTimeUS(), or SWTimer_percentElapsed(), you MUST
- * FIRST CALL the SWTimer_start() method.
+ * Constructs a new Software Timer, using a wait time in milliseconds. The timer is based on the
+ * cycles counted by Clock_cycles(). When first constructed, this timer is NOT conditioned to start.
+ * Before any calls to SWTimer_expired(), SWTimer_elapsedTimeUS(), or SWTimer_percentElapsed(), you
+ * MUST FIRST CALL the SWTimer_start() method.
  *
  * @param waitTime_ms:  The amount of time this timer measures before expiration
  * @return a SWTimer object
@@ -85,26 +65,23 @@ SWTimer SWTimer_construct(uint64_t waitTime_ms)
 {
     SWTimer timer;
 
-    timer.startCounter = 0;
-    timer.startRollovers = 0;
+    timer.startCycles = 0;
+    timer.cyclesToWait = Clock_fromMs(waitTime_ms);
 
-    uint64_t counterClock = SYSTEM_CLOCK / PRESCALER;
-    uint64_t cyclesPerMillisecond = counterClock / MS_DIVISION_FACTOR;
-    timer.cyclesToWait = cyclesPerMillisecond * waitTime_ms;
+    // The one division of the timer, here rather than each time the progress is asked for
+    timer.percentPerCycle = (timer.cyclesToWait == 0) ? 0 : CLOCK_Q32(100, timer.cyclesToWait);
 
     return timer;
 }
 
 /**
- * Starts a constructed timer by reading the current number of rollovers and current load value in
- * TIMER32_0_BASE.
+ * Starts a constructed timer by reading the current time from the clock.
  *
  * @param timer_p:    The SWTimer to start
  */
 void SWTimer_start(SWTimer* timer_p)
 {
-    timer_p->startCounter = Timer32_getValue(TIMER32_0_BASE);
-    timer_p->startRollovers = hwTimerRollovers;
+    timer_p->startCycles = Clock_cycles();
 }
 
 /**
@@ -119,12 +96,7 @@ void SWTimer_start(SWTimer* timer_p)
  */
 uint64_t SWTimer_elapsedCycles(SWTimer* timer_p)
 {
-    uint64_t rollovers = hwTimerRollovers - timer_p->startRollovers;
-    uint64_t startCounter = timer_p->startCounter;
-    uint64_t currentCounter = Timer32_getValue(TIMER32_0_BASE);
-    uint64_t elapsedCycles = (rollovers * (LOADVALUE + 1)) + startCounter - currentCounter;
-
-    return elapsedCycles;
+    return Clock_cycles() - timer_p->startCycles;
 }
 
 /**
@@ -142,22 +114,14 @@ bool SWTimer_expired(SWTimer* timer_p)
 /**
  * Returns the number of MICROSECONDS which have elapsed since the timer was started. If the timer
  * was never started, this function returns the number of MICROSECONDS since the program started
- * running. We compute the time elapsed in microseconds and NOT in milliseconds because more precise
- * calculations can be made using microseconds.
+ * running. The conversion is a fixed-point multiply (see Clock.h), not a division.
  *
  * @param timer_p:    The target timer used in determining the elapsed time
  * @return the number of microseconds elapsed since the timer was started
  */
 uint64_t SWTimer_elapsedTimeUS(SWTimer* timer_p)
 {
-    uint64_t elapsedCycles = SWTimer_elapsedCycles(timer_p);
-
-    uint64_t counterClock = SYSTEM_CLOCK / PRESCALER;
-    uint64_t cyclesPerMicrosecond = counterClock / US_DIVISION_FACTOR;
-
-    uint64_t elapsedTime_us = elapsedCycles / cyclesPerMicrosecond;
-
-    return elapsedTime_us;
+    return Clock_toUs(SWTimer_elapsedCycles(timer_p));
 }
 
 /**
@@ -185,3 +149,22 @@ double SWTimer_percentElapsed(SWTimer* timer_p)
 
     return result;
 }
+
+/**
+ * The same progress as SWTimer_percentElapsed(), as a whole percentage from 0 to 100: 70 where that
+ * returns 0.7. It multiplies by the fixed-point percentPerCycle the constructor worked out, so it
+ * needs neither double math nor a division.
+ *
+ * @param timer_p:    The target timer used in determining the percent progress elapsed
+ * @return the whole percentage of time which has elapsed since the timer was started.
+ */
+uint32_t SWTimer_percentElapsedInt(SWTimer* timer_p)
+{
+    uint64_t elapsedCycles = SWTimer_elapsedCycles(timer_p);
+
+    if (elapsedCycles >= timer_p->cyclesToWait) {
+        return 100;
+    }
+
+    return (uint32_t) Clock_scale(elapsedCycles, timer_p->percentPerCycle);
+}
@@ -40,11 +40,12 @@ struct _SWTimer
     // The number of hardware timer cycles which must elapse before the timer expires
     uint64_t cyclesToWait;
 
-    // The starting counter value of the hardware timer, set when the timer is started
-    uint32_t startCounter;
+    // The percentage of cyclesToWait one cycle is, in 32.32 fixed point, worked out when the timer
+    // is constructed so that SWTimer_percentElapsedInt() needs no division
+    uint64_t percentPerCycle;
 
-    // The starting rollover value of the hardware timer, set when the timer is started
-    uint32_t startRollovers;
+    // The time from Clock_cycles() at which the timer was started
+    uint64_t startCycles;
 };
 typedef struct _SWTimer SWTimer;
 
@@ -61,6 +62,15 @@ uint64_t SWTimer_elapsedCycles(SWTimer* timer);
 // Returns true if the timer has expired, and false otherwise
 bool SWTimer_expired(SWTimer* timer);
 
+// Returns the number of microseconds since the timer was started
+uint64_t SWTimer_elapsedTimeUS(SWTimer* timer);
+
+// Returns how much of the wait time has elapsed, from 0.0 to 1.0
+double SWTimer_percentElapsed(SWTimer* timer);
+
+// Returns how much of the wait time has elapsed, from 0 to 100 percent, without floating point or division
+uint32_t SWTimer_percentElapsedInt(SWTimer* timer);
+
 // Initializes the global clock system for the MSP432, as well as a hardware
 // timer under which all of the software timers are based.
 void InitSystemTiming();
@@ -0,0 +1,236 @@
+/*
+ * TimerWheel.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stddef.h>
+
+#include <HAL/TimerWheel.h>
+
+#define SLOT_MASK           (TIMER_WHEEL_SLOTS - 1)
+
+// The occupancy bitmap has a bit per slot, 32 to an element
+#define BITS_PER_ELEMENT    32
+#define OCCUPANCY_WORDS     (TIMER_WHEEL_SLOTS / BITS_PER_ELEMENT)
+
+#if TIMER_WHEEL_SLOTS < BITS_PER_ELEMENT
+#error "TIMER_WHEEL_SLOTS must be at least 32, an element of the occupancy bitmap"
+#endif
+
+// The bit of a slot in its element of the occupancy bitmap: slot 0 is the most significant, so CLZ finds the lowest
+#define SLOT_BIT(slot)      (0x80000000u >> ((slot) % BITS_PER_ELEMENT))
+
+// The timers due at each tick modulo TIMER_WHEEL_SLOTS, in the order they were armed, newest first
+static WheelTimer* slots[TIMER_WHEEL_SLOTS];
+
+// The slots with a timer in them, kept up to date by arming and cancelling
+static uint32_t occupied[OCCUPANCY_WORDS];
+
+// The last tick whose slot has been walked
+static uint32_t currentTick = 0;
+
+static uint32_t armedCount = 0;
+
+/** Returns the current tick. */
+static uint32_t TimerWheel_now(void)
+{
+    return (uint32_t) (Clock_cycles() >> TIMER_TICK_SHIFT);
+}
+
+/** Converts milliseconds to ticks, rounding up: a multiply and a shift, with no division. */
+static uint32_t TimerWheel_ticksFor(uint32_t delay_ms)
+{
+    return (uint32_t) ((Clock_fromMs(delay_ms) + TIMER_TICK_CYCLES - 1) >> TIMER_TICK_SHIFT);
+}
+
+/**
+ * Runs out every timer in a slot which is due by the current tick. A callback
+ * may arm or cancel any timer, including the next one in the list, so after
+ * each one the walk starts the slot over; a timer it arms is due at a later
+ * tick, so the walk always ends.
+ */
+static void TimerWheel_expireSlot(uint32_t slot)
+{
+    WheelTimer* timer_p = slots[slot];
+
+    while (timer_p != NULL)
+    {
+        if ((int32_t) (timer_p->expiryTick - currentTick) <= 0)
+        {
+            WheelTimer_cancel(timer_p);
+            if (timer_p->callback != NULL)
+            {
+                timer_p->callback(timer_p->context);
+            }
+            timer_p = slots[slot];
+        }
+        else
+        {
+            timer_p = timer_p->next;
+        }
+    }
+}
+
+WheelTimer WheelTimer_construct(WheelTimerCallback callback)
+{
+    WheelTimer timer;
+
+    timer.next = NULL;
+    timer.link = NULL;
+    timer.expiryTick = 0;
+    timer.callback = callback;
+    timer.context = NULL;
+
+    return timer;
+}
+
+/**
+ * Puts the timer at the head of the slot for its expiry tick. The tick is
+ * counted from the hardware's tick rather than from the last one serviced,
+ * so a loop running late does not make the timer run out early; the extra
+ * tick covers the part of the current tick which has already gone.
+ *
+ * @param timer_p:    The timer to arm
+ * @param delay_ms:   The least time until it runs out
+ * @param context:    What to pass its callback
+ */
+void WheelTimer_arm(WheelTimer* timer_p, uint32_t delay_ms, void* context)
+{
+    uint32_t now = TimerWheel_now();
+    uint32_t slot;
+
+    WheelTimer_cancel(timer_p);
+
+    // With nothing armed the wheel stops turning, so catch it up rather than walk the idle ticks later
+    if (armedCount == 0)
+    {
+        currentTick = now;
+    }
+
+    timer_p->expiryTick = now + TimerWheel_ticksFor(delay_ms) + 1;
+    timer_p->context = context;
+
+    slot = timer_p->expiryTick & SLOT_MASK;
+    timer_p->next = slots[slot];
+    timer_p->link = &slots[slot];
+    if (timer_p->next != NULL)
+    {
+        timer_p->next->link = &timer_p->next;
+    }
+    slots[slot] = timer_p;
+    occupied[slot / BITS_PER_ELEMENT] |= SLOT_BIT(slot);
+    armedCount++;
+}
+
+void WheelTimer_cancel(WheelTimer* timer_p)
+{
+    uint32_t slot = timer_p->expiryTick & SLOT_MASK;
+
+    if (timer_p->link == NULL)
+    {
+        return;
+    }
+
+    *timer_p->link = timer_p->next;
+    if (timer_p->next != NULL)
+    {
+        timer_p->next->link = timer_p->link;
+    }
+    if (slots[slot] == NULL)
+    {
+        occupied[slot / BITS_PER_ELEMENT] &= ~SLOT_BIT(slot);
+    }
+    timer_p->next = NULL;
+    timer_p->link = NULL;
+    armedCount--;
+}
+
+bool WheelTimer_isArmed(WheelTimer* timer_p)
+{
+    return timer_p->link != NULL;
+}
+
+/**
+ * Walks the slot of every tick from the last one serviced up to now. With no
+ * timer armed, or once the last one runs out, the wheel jumps straight to
+ * now, so a loop that has not run for a long time costs nothing to catch up.
+ */
+void TimerWheel_service(void)
+{
+    uint32_t now = TimerWheel_now();
+
+    // A callback which arms the only timer moves the wheel on to its own reading of the tick, which may be past now
+    while ((int32_t) (now - currentTick) > 0)
+    {
+        if (armedCount == 0)
+        {
+            currentTick = now;
+            return;
+        }
+
+        currentTick++;
+        TimerWheel_expireSlot(currentTick & SLOT_MASK);
+    }
+}
+
+uint32_t TimerWheel_armedCount(void)
+{
+    return armedCount;
+}
+
+/**
+ * Returns how many slots on from a slot the first one with a timer in it is,
+ * 0 if that slot has one, going round the wheel. The bits of the slot's own
+ * element from it on, every other element, and then the bits of the slot's
+ * element before it are looked at, one CLZ each, so it takes at most
+ * OCCUPANCY_WORDS + 1 steps, however the timers are spread. At least one
+ * timer must be armed.
+ */
+static uint32_t TimerWheel_slotsToOccupied(uint32_t slot)
+{
+    uint32_t distance = 0;
+    uint32_t offset, bits;
+
+    while (true)
+    {
+        offset = slot % BITS_PER_ELEMENT;
+        bits = occupied[slot / BITS_PER_ELEMENT] & (~0u >> offset);
+        if (bits != 0)
+        {
+            return distance + (uint32_t) __builtin_clz(bits) - offset;
+        }
+
+        distance += BITS_PER_ELEMENT - offset;
+        slot = (slot + BITS_PER_ELEMENT - offset) & SLOT_MASK;
+    }
+}
+
+/**
+ * Finds the first tick after the last one serviced whose slot has a timer in
+ * it from the occupancy bitmap, in constant time, without walking the slots
+ * or their lists. The timers in that slot may be due on a later turn of the
+ * wheel, so the loop may wake early for a timer which is far off, at most
+ * once a turn, and find nothing due; it never wakes late.
+ */
+uint64_t TimerWheel_cyclesUntilDue(void)
+{
+    uint64_t cycles;
+    uint32_t tick, ticks;
+
+    if (armedCount == 0)
+    {
+        return TIMER_WHEEL_IDLE;
+    }
+
+    tick = currentTick + 1 + TimerWheel_slotsToOccupied((currentTick + 1) & SLOT_MASK);
+
+    // Due at the start of the tick, so the part of the current tick which has gone comes off
+    cycles = Clock_cycles();
+    ticks = tick - (uint32_t) (cycles >> TIMER_TICK_SHIFT);
+    if ((int32_t) ticks <= 0)
+    {
+        return 0;
+    }
+    return ((uint64_t) ticks << TIMER_TICK_SHIFT) - (cycles & (TIMER_TICK_CYCLES - 1));
+}
@@ -0,0 +1,107 @@
+/*
+ * TimerWheel.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * One service for every timeout in the program, in place of a SWTimer per
+ * object which each polls the hardware timer and does its 64-bit arithmetic
+ * on every loop. Timers are kept on a hashed wheel of TIMER_WHEEL_SLOTS
+ * slots, one per tick of TIMER_TICK_CYCLES; a timer due at tick t sits in slot
+ * t % TIMER_WHEEL_SLOTS, in a list which arming adds to and cancelling
+ * unlinks from in constant time. Once per super-loop, TimerWheel_service()
+ * reads the tick once and, only when it has moved on, walks the slots of the
+ * ticks that have passed and runs the callbacks of the timers due. A timer
+ * more than a turn of the wheel away stays in its slot until its own turn
+ * comes, so the work per tick is the timers in one slot, however many are
+ * armed.
+ *
+ * Callbacks run from TimerWheel_service(), in the super-loop, never from an
+ * interrupt, so they may use anything the loop does, including arming and
+ * cancelling timers.
+ */
+
+#ifndef HAL_TIMERWHEEL_H_
+#define HAL_TIMERWHEEL_H_
+
+#include <stdbool.h>
+#include <HAL/Clock.h>
+
+// The tick of the wheel: 2^15 cycles of Clock_cycles(), or 683 us at 48 MHz. A power of two,
+// so that the tick is a shift of the clock. The tick count wraps around after 34 days, so
+// ticks are compared by the sign of their difference.
+#define TIMER_TICK_SHIFT    15
+#define TIMER_TICK_CYCLES   (1u << TIMER_TICK_SHIFT)
+
+// Slots on the wheel, a power of two and at least 32. At 128 a turn takes 87 ms, so a debounce timer is
+// always due on the current turn, and a timer of a few seconds waits a few dozen.
+#ifndef TIMER_WHEEL_SLOTS
+#define TIMER_WHEEL_SLOTS   128
+#endif
+
+#if (TIMER_WHEEL_SLOTS & (TIMER_WHEEL_SLOTS - 1)) != 0
+#error "TIMER_WHEEL_SLOTS must be a power of two"
+#endif
+
+// What TimerWheel_cyclesUntilDue() returns while no timer is armed
+#define TIMER_WHEEL_IDLE    UINT64_MAX
+
+// Called when a timer runs out, with the context it was armed with
+typedef void (*WheelTimerCallback)(void* context);
+
+/**=================================================================================================
+ * A timer on the wheel, implemented in the C object-oriented style. Construct it with its
+ * callback using [WheelTimer_construct()], then arm it with [WheelTimer_arm()] each time it should
+ * run. When it runs out it is disarmed before its callback runs, so the callback may arm it again.
+ * =================================================================================================
+ * USAGE WARNINGS
+ * =================================================================================================
+ * While it is armed, the wheel holds the timer by its address. DO NOT COPY an armed timer, or the
+ * struct it is part of, and do not let it go out of scope: cancel it first. A timer may be copied
+ * freely while it is not armed, so objects which are returned by value from their constructors
+ * should arm their timers later, through a pointer to where they live.
+ *
+ * Treat all members as PRIVATE - only functions whose names start with "WheelTimer_*" or
+ * "TimerWheel_*" may access them.
+ */
+struct _WheelTimer
+{
+    // The next timer in the same slot
+    struct _WheelTimer* next;
+
+    // The pointer in the slot's list which points at this timer, or NULL while it is not armed
+    struct _WheelTimer** link;
+
+    // The tick at which the timer runs out
+    uint32_t expiryTick;
+
+    // What to call when it runs out, or NULL for a timer which is only polled with WheelTimer_isArmed()
+    WheelTimerCallback callback;
+    void* context;
+};
+typedef struct _WheelTimer WheelTimer;
+
+// Constructs a timer which is not armed
+WheelTimer WheelTimer_construct(WheelTimerCallback callback);
+
+// Arms a timer to run out in at least delay_ms and at most a tick more, calling back with the given
+// context. A timer which is already armed is moved to the new time. Takes constant time.
+void WheelTimer_arm(WheelTimer* timer_p, uint32_t delay_ms, void* context);
+
+// Disarms a timer, if it is armed, so that it does not run out. Takes constant time.
+void WheelTimer_cancel(WheelTimer* timer_p);
+
+// Returns true if the timer is armed and has not run out yet
+bool WheelTimer_isArmed(WheelTimer* timer_p);
+
+// Runs out every timer due by now. HAL_refreshInputs() calls this on every run of the input task.
+void TimerWheel_service(void);
+
+// Returns the number of timers armed
+uint32_t TimerWheel_armedCount(void);
+
+// Returns the cycles of Clock_cycles() until the next tick whose slot has a timer in it, 0 if that tick has come
+// already, or TIMER_WHEEL_IDLE if no timer is armed. No timer is due before then, so the super-loop may sleep this
+// long. Takes constant time: an occupancy bitmap of the slots, kept by arming and cancelling, is searched with CLZ.
+uint64_t TimerWheel_cyclesUntilDue(void);
+
+#endif /* HAL_TIMERWHEEL_H_ */
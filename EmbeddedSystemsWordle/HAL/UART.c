@@ -6,9 +6,68 @@
  *  Supervisor: Leyla Nazhand-Ali
  */
 
+#include <HAL/Event.h>
 #include <HAL/Timer.h>
 #include <HAL/UART.h>
 
+#include <string.h>
+
+/** Storage and queue for characters received on USB_UART_INSTANCE, filled by EUSCIA0_IRQHandler. */
+static volatile uint8_t rxStorage[UART_RX_BUFFER_SIZE];
+static RingBuffer rxBuffer;
+
+/** Storage and queue for characters waiting to be sent on USB_UART_INSTANCE, drained by EUSCIA0_IRQHandler. */
+static volatile uint8_t txStorage[UART_TX_BUFFER_SIZE];
+static RingBuffer txBuffer;
+
+/** The number of receive overrun (UCOE) errors seen by EUSCIA0_IRQHandler. */
+static volatile uint32_t rxOverruns = 0;
+
+/**
+ * The ISR for the USB UART. Every received character is moved straight from the
+ * receive register into rxBuffer, so characters are no longer lost while the
+ * super-loop is busy with something slow like clearing the LCD. Reading the
+ * receive register clears both the receive flag and the overrun flag, so the
+ * overrun flag has to be checked first. Each character posts EVENT_UART_RX, to
+ * wake a sleeping super-loop.
+ *
+ * Whenever the transmit register is empty and the transmit interrupt is enabled,
+ * the next character of txBuffer is written into it. Once txBuffer runs dry the
+ * transmit interrupt is switched off again, since the empty transmit register
+ * would otherwise keep firing it, and EVENT_UART_TX is posted for anything
+ * waiting for room to send more.
+ */
+void EUSCIA0_IRQHandler()
+{
+    uint32_t status = UART_getEnabledInterruptStatus(EUSCI_A0_BASE);
+
+    if (status & EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG)
+    {
+        if (UART_queryStatusFlags(EUSCI_A0_BASE, EUSCI_A_UART_OVERRUN_ERROR))
+        {
+            rxOverruns++;
+        }
+
+        RingBuffer_push(&rxBuffer, UART_receiveData(EUSCI_A0_BASE));
+        Event_post(EVENT_UART_RX);
+    }
+
+    if (status & EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG)
+    {
+        uint8_t txChar;
+
+        if (RingBuffer_pop(&txBuffer, &txChar))
+        {
+            UART_transmitData(EUSCI_A0_BASE, txChar);
+        }
+        else
+        {
+            UART_disableInterrupt(EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+            Event_post(EVENT_UART_TX);
+        }
+    }
+}
+
 /**
  * Initializes the UART module except for the baudrate generation
  * Except for baudrate generation, all other uart configuration should match that of basic_example_UART
@@ -40,6 +99,12 @@ UART UART_construct(uint32_t moduleInstance, uint32_t port, uint32_t pins)
     uart.config.msborLsbFirst    = EUSCI_A_UART_LSB_FIRST;    // LSB First
     uart.config.uartMode         = EUSCI_A_UART_MODE;         // UART mode
     uart.config.dataLength       = EUSCI_A_UART_8_BIT_LEN;    //Data Length
+
+    // Start with empty receive and transmit buffers. The receive interrupt is
+    // enabled along with the module, the transmit interrupt once there is something to send.
+    rxBuffer = RingBuffer_construct(rxStorage, UART_RX_BUFFER_SIZE);
+    txBuffer = RingBuffer_construct(txStorage, UART_TX_BUFFER_SIZE);
+
     // Return the completed UART instance
     return uart;
 }
@@ -78,14 +143,24 @@ void UART_SetBaud_Enable(UART *uart_p, UART_Baudrate baudChoice)
     UART_initModule(uart_p->moduleInstance, &uart_p->config);
     UART_enableModule(uart_p->moduleInstance);
 
+    // Re-initializing the module clears its interrupt enables, so the receive
+    // interrupt which fills rxBuffer has to be turned back on every time.
+    UART_enableInterrupt(uart_p->moduleInstance, EUSCI_A_UART_RECEIVE_INTERRUPT);
+    Interrupt_enableInterrupt(INT_EUSCIA0);
+
+    // Characters queued before the baudrate change are sent at the new baudrate.
+    if (!RingBuffer_isEmpty(&txBuffer))
+    {
+        UART_enableInterrupt(uart_p->moduleInstance, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+    }
+
 }
 
 
-// Not-a-real TODO: read this function and its comment to learn how to implement the other functions
-// Notice how we use uart_p's module instance instead of the name of the instance from the basic example where we used no HAL
 /**
- * Determines if the user has sent a UART data packet to the board by checking
- * the interrupt status of the proper system UART module.
+ * Determines if the user has sent a UART data packet to the board. Characters
+ * are moved into rxBuffer by EUSCIA0_IRQHandler as soon as they arrive, so we
+ * only have to check whether that buffer holds anything.
  *
  * @param uart_p: The pointer to the UART instance with which to handle our operations.
  *
@@ -93,47 +168,112 @@ void UART_SetBaud_Enable(UART *uart_p, UART_Baudrate baudChoice)
  */
 bool UART_hasChar(UART* uart_p)
 {
-    uint8_t interruptStatus = UART_getInterruptStatus(
-            uart_p->moduleInstance, EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG);
+    (void) uart_p;
 
-    return (interruptStatus == EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG);
+    return !RingBuffer_isEmpty(&rxBuffer);
 }
 
-// TODO: Complete the UART_getChar() function.
-// TODO: Write a descriptive comment explaining HOW the function is implemented.
-//       In the implementation file, prefer explaining HOW the function is
-//       implemented over simply WHAT the function does.
-// This function takes in a UART pointer and receives the data, which is taken in as an unsigned int,
-// which is then assigned to the uart's pointer's module instance. Returns a char
+// This function takes in a UART pointer and pops the oldest character out of the
+// receive buffer filled by EUSCIA0_IRQHandler. If the buffer is empty it returns 0,
+// so callers should check UART_hasChar() first. Returns a char
 char UART_getChar(UART* uart_p)
 {
-    // TODO: change this
-    return UART_receiveData(uart_p->moduleInstance);
+    uint8_t rxChar = 0;
+
+    (void) uart_p;
+
+    RingBuffer_pop(&rxBuffer, &rxChar);
+    return rxChar;
 }
 
-// TODO: Complete the UART_canSend() function.
-// TODO: Write a descriptive comment explaining HOW the function is implemented.
-//       In the implementation file, prefer explaining HOW the function is
-//       implemented over simply WHAT the function does.
-// This function takes in a UART pointer, and sets an unsigned int to get the transfer status to see
-// if it can transfer the data without any blockage. Returns a boolean
+// This function takes in a UART pointer and checks whether the transmit buffer drained by
+// EUSCIA0_IRQHandler has room for one more character. Returns a boolean
 bool UART_canSend(UART* uart_p)
 {
-    uint8_t transferStatus = UART_getInterruptStatus(
-    uart_p->moduleInstance, EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG);
-    return (transferStatus == EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG);
+    (void) uart_p;
+
+    return !RingBuffer_isFull(&txBuffer);
 }
 
-// TODO: Complete the UART_sendChar() function.
-// TODO: Write a descriptive comment explaining HOW the function is implemented.
-//       In the implementation file, prefer explaining HOW the function is
-//       implemented over simply WHAT the function does.
-// This function takes in a UART pointer and a char, which then transmits the char c into the moduleInstance
-// of the pointer. Returns nothing.
+// This function takes in a UART pointer and a char, which is queued in the transmit buffer.
+// It never waits for the wire; if the buffer is full the character is dropped and counted.
+// Returns nothing.
 void UART_sendChar(UART* uart_p, char c)
 {
-  // TODO: add some lines here
-    UART_transmitData(uart_p->moduleInstance, c);
-    return;
+    UART_sendBytes(uart_p, (const uint8_t*) &c, 1);
 }
 
+/**
+ * Queues a block of bytes for transmission. Each byte is pushed into txBuffer,
+ * and the transmit interrupt is enabled AFTER the bytes are queued. If the ISR
+ * had already disabled the interrupt because the buffer was empty, this starts
+ * it again; since the transmit register is empty, the interrupt fires right away.
+ *
+ * @param uart_p:   The pointer to the UART instance with which to send
+ * @param data:     The bytes to send
+ * @param length:   The number of bytes to send
+ *
+ * @return the number of bytes which fit in the transmit buffer
+ */
+uint32_t UART_sendBytes(UART* uart_p, const uint8_t* data, uint32_t length)
+{
+    uint32_t queued = 0;
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        queued += RingBuffer_push(&txBuffer, data[i]);
+    }
+
+    UART_enableInterrupt(uart_p->moduleInstance, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+
+    return queued;
+}
+
+// Queues every character of a null-terminated string through UART_sendBytes().
+uint32_t UART_sendString(UART* uart_p, const char* string)
+{
+    return UART_sendBytes(uart_p, (const uint8_t*) string, strlen(string));
+}
+
+// Returns the overrun counter kept by EUSCIA0_IRQHandler.
+uint32_t UART_getOverrunCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return rxOverruns;
+}
+
+// Returns the drop counter of the receive buffer, which the ISR increments when
+// it receives a character while the buffer is already full.
+uint32_t UART_getRxDropCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return rxBuffer.drops;
+}
+
+// Returns the fill level of the transmit buffer, which drops as EUSCIA0_IRQHandler sends.
+uint32_t UART_txPending(UART* uart_p)
+{
+    (void) uart_p;
+
+    return RingBuffer_count(&txBuffer);
+}
+
+// Returns the peak fill level of the transmit buffer, kept by RingBuffer_push().
+uint32_t UART_getTxHighWater(UART* uart_p)
+{
+    (void) uart_p;
+
+    return txBuffer.highWater;
+}
+
+// Returns the drop counter of the transmit buffer, which UART_sendBytes() increments
+// through RingBuffer_push() when it queues a character while the buffer is already full.
+uint32_t UART_getTxDropCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return txBuffer.drops;
+}
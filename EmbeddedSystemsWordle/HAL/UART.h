@@ -10,6 +10,7 @@
 #define HAL_UART_H_
 
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <HAL/RingBuffer.h>
 
 // Ever since the new API update in mid 2019, the UART configuration struct's
 // name changed from [eUSCI_UART_Config] to [eUSCI_UART_ConfigV1]. If your code
@@ -26,6 +27,12 @@
 #define USB_UART_PINS (GPIO_PIN2 | GPIO_PIN3) // The pins are given to you for guidance. Also, because many students miss the parentheses
 #define USB_UART_INSTANCE  EUSCI_A0_BASE
 
+// Size of the receive buffer filled by EUSCIA0_IRQHandler. Must be a power of two.
+#define UART_RX_BUFFER_SIZE 64
+
+// Size of the transmit buffer drained by EUSCIA0_IRQHandler. Must be a power of two.
+#define UART_TX_BUFFER_SIZE 128
+
 
 // An enum outlining what baud rates the UART_construct() function can use in
 // its initialization.
@@ -58,10 +65,31 @@ void UART_SetBaud_Enable(UART *, UART_Baudrate baudrate);
 // TODO: Write a comment which explains what each of these functions does. In the
 //       header, prefer explaining WHAT the function does, as opposed to HOW it is
 //       implemented.
-bool UART_hasChar(UART* uart_p); // Checks to see if user entered a character
-char UART_getChar(UART* uart_p); // Gets the character given within UART and takes in the char
-bool UART_canSend(UART* uart_p); // Checks to see if user can send the given character
-void UART_sendChar(UART* uart_p, char c); // Transfers the character from modelInstance to UART
+bool UART_hasChar(UART* uart_p); // Checks to see if a received character is waiting in the receive buffer
+char UART_getChar(UART* uart_p); // Removes and returns the oldest received character
+bool UART_canSend(UART* uart_p); // Checks to see if the transmit buffer has room for another character
+void UART_sendChar(UART* uart_p, char c); // Queues the character to be sent without waiting for the wire
+
+// Queues bytes to be sent in the background. Returns how many fit; the rest are dropped and counted.
+uint32_t UART_sendBytes(UART* uart_p, const uint8_t* data, uint32_t length);
+
+// Queues a null-terminated string to be sent in the background. Returns how many characters fit.
+uint32_t UART_sendString(UART* uart_p, const char* string);
+
+// Returns how many characters the hardware lost because a new one arrived before the old one was read
+uint32_t UART_getOverrunCount(UART* uart_p);
+
+// Returns how many characters were thrown away because the receive buffer was full
+uint32_t UART_getRxDropCount(UART* uart_p);
+
+// Returns how many characters are still waiting in the transmit buffer
+uint32_t UART_txPending(UART* uart_p);
+
+// Returns the largest number of characters that have ever waited in the transmit buffer
+uint32_t UART_getTxHighWater(UART* uart_p);
+
+// Returns how many characters were thrown away because the transmit buffer was full
+uint32_t UART_getTxDropCount(UART* uart_p);
 
 // Updates the UART baudrate to use the new baud choice.
 void UART_updateBaud(UART* uart_p, UART_Baudrate baudChoice);
@@ -0,0 +1,109 @@
+/*
+ * Absurdle.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Absurdle.h>
+#include <Wordle/Dictionary.h>
+#include <Wordle/Candidates.h>
+
+static DictionaryCursor cursor;
+static PackedWord guess = 0;
+static uint32_t wordIndex = 0;
+static bool done = true;
+
+// How many candidates gave each feedback code so far, and the code chosen
+static uint16_t histogram[ABSURDLE_HISTOGRAM_CODES];
+static FeedbackCode chosen = 0;
+
+/** Returns how much a feedback code tells: any green counts for more than all the yellows. */
+static uint32_t Absurdle_information(FeedbackCode code)
+{
+    uint32_t yellows = 0;
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        yellows += (Score_letterAt(code, i) == YELLOW);
+    }
+    return (uint32_t) Score_greenCount(code) * (SCORE_WORD_LENGTH + 1) + yellows;
+}
+
+/** Picks the largest group, and of groups of the same size the one which tells the least, then the lowest code. */
+static void Absurdle_choose(void)
+{
+    uint32_t code, bestInformation = 0;
+
+    chosen = 0;
+    for (code = 0; code < ABSURDLE_HISTOGRAM_CODES; code++)
+    {
+        uint32_t information;
+
+        if (histogram[code] < histogram[chosen] || histogram[code] == 0)
+        {
+            continue;
+        }
+
+        information = Absurdle_information(code);
+        if (histogram[code] > histogram[chosen] || information < bestInformation)
+        {
+            chosen = code;
+            bestInformation = information;
+        }
+    }
+}
+
+void Absurdle_start(PackedWord word)
+{
+    uint32_t code;
+
+    for (code = 0; code < ABSURDLE_HISTOGRAM_CODES; code++)
+    {
+        histogram[code] = 0;
+    }
+    guess = word;
+    cursor = Dictionary_cursor();
+    wordIndex = 0;
+    done = false;
+}
+
+bool Absurdle_step(uint32_t maxWords)
+{
+    PackedWord word;
+    uint32_t visited;
+
+    for (visited = 0; visited < maxWords && !done; visited++)
+    {
+        if (!Dictionary_next(&cursor, &word))
+        {
+            Absurdle_choose();
+            done = true;
+        }
+        else if (Candidates_contains(wordIndex++))
+        {
+            histogram[Score_feedback(guess, word)]++;
+        }
+    }
+    return done;
+}
+
+uint32_t Absurdle_progress(void)
+{
+    return done ? 100 : wordIndex * 100 / Dictionary_wordCount();
+}
+
+FeedbackCode Absurdle_feedback(void)
+{
+    return chosen;
+}
+
+uint32_t Absurdle_remaining(void)
+{
+    return histogram[chosen];
+}
+
+PackedWord Absurdle_answer(void)
+{
+    return Candidates_first();
+}
@@ -0,0 +1,57 @@
+/*
+ * Absurdle.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The board as an adversarial player 1, who puts off choosing the answer for as
+ * long as it can. After each guess it sorts the candidates (Candidates.h) by
+ * the feedback the guess would get from them, and gives the feedback of the
+ * largest group, so that as many answers as possible are still open. The
+ * caller then adds that feedback to the candidates like any other.
+ *
+ * Early in a game that is a score for each of thousands of candidates, so the
+ * sort is done a slice at a time with Absurdle_step(), like a hint search.
+ * There is a single judge, for the game in progress.
+ */
+
+#ifndef WORDLE_ABSURDLE_H_
+#define WORDLE_ABSURDLE_H_
+
+#include <Wordle/Score.h>
+#include <Wordle/Dictionary.h>
+
+// Dictionary words visited by one Absurdle_step() call: a granule of about two thousand M4 cycles, so the caller can
+// stop on a deadline
+#ifndef ABSURDLE_STEP_WORDS
+#define ABSURDLE_STEP_WORDS     4
+#endif
+
+// The histogram of feedback codes kept in SRAM. Without a dictionary there are no candidates to sort.
+#if DICTIONARY_AVAILABLE
+#define ABSURDLE_HISTOGRAM_CODES    SCORE_NUM_CODES
+#else
+#define ABSURDLE_HISTOGRAM_CODES    1
+#endif
+#define ABSURDLE_SRAM_BYTES         (ABSURDLE_HISTOGRAM_CODES * 2)
+
+// Starts sorting the candidates by the feedback they would give a guess
+void Absurdle_start(PackedWord guess);
+
+// Visits about maxWords dictionary words. Returns true once the feedback is chosen.
+bool Absurdle_step(uint32_t maxWords);
+
+// Returns how far the sort has come, in percent
+uint32_t Absurdle_progress(void);
+
+// Returns the feedback the board gives the guess, once Absurdle_step() has returned true. Of groups of the same
+// size it keeps the one with the fewest greens, then the fewest yellows, so the guess learns as little as it can.
+FeedbackCode Absurdle_feedback(void);
+
+// Returns the number of candidates which gave that feedback
+uint32_t Absurdle_remaining(void);
+
+// Returns the first candidate in dictionary order, or 0 if there are none; the answer the board owns up to when the
+// game is over. It reads one packed word (see Candidates_first()).
+PackedWord Absurdle_answer(void);
+
+#endif /* WORDLE_ABSURDLE_H_ */
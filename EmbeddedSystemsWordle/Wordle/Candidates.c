@@ -0,0 +1,305 @@
+/*
+ * Candidates.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Candidates.h>
+#include <Wordle/CandidatesTables.h>
+
+#define BITS_PER_ELEMENT    32
+
+// The bits of a letter count in Constraint.fields, and the top one, which a count at or over a bound carries into
+// once the bias of the bound is added. A count and a bias are both at most 8, so nothing carries out of the field.
+#define COUNT_BITS          4
+#define COUNT_TOP           0x8
+
+// The top bit of a letter of a packed word, and of every letter, with the bits below it
+#define LETTER_TOP          (1u << (SCORE_BITS_PER_LETTER - 1))
+#define LETTER_ONES         ((((PackedWord) 1 << (SCORE_BITS_PER_LETTER * SCORE_WORD_LENGTH)) - 1) / SCORE_LETTER_MASK)
+#define LETTER_TOPS         (LETTER_ONES * LETTER_TOP)
+#define LETTER_LOWS         (LETTER_ONES * (LETTER_TOP - 1))
+
+/**
+ * What the feedback of a guess says about the answer: for every position,
+ * whether it has the guess's letter there, and for every letter of the guess,
+ * how many of it the answer has at least and at most. Both are checked a
+ * whole word at a time. A word XORed with the guess has a letter of 0 at the
+ * positions where they agree, and adding LETTER_TOP - 1 to the low bits of
+ * each letter carries into its top bit at every other one. A letter count in
+ * its slot's field plus COUNT_TOP - atLeast carries into COUNT_TOP if the
+ * count is at least that, and plus COUNT_TOP - 1 - atMost if it is over that.
+ */
+struct _Constraint
+{
+    PackedWord guess;
+    PackedWord differs;                         // LETTER_TOP of every position which is not GREEN
+
+    // For every letter code, 1 in the COUNT_BITS field of its slot if the guess has it, else 0
+    uint32_t fields[SCORE_ALPHABET_SIZE];
+    uint32_t atLeastBias, atLeastTops;          // COUNT_TOP of the slots with an atLeast above 0
+    uint32_t atMostBias, atMostTops;            // COUNT_TOP of the slots with an atMost below the word length
+};
+typedef struct _Constraint Constraint;
+
+// The number of words in CandidatesTables_live
+static uint32_t liveCount = 0;
+
+// The narrowing in progress: the constraint of its feedback, the next element to narrow, and the words kept so far.
+// None is in progress once nextElement is past the last element.
+static Constraint narrowing;
+static uint32_t nextElement = UINT32_MAX;
+static uint32_t narrowedCount = 0;
+
+/** Counts the set bits of a value, the same way as Dictionary.c. */
+static uint32_t Candidates_popCount(uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0F0F0F0F;
+    return (value * 0x01010101) >> 24;
+}
+
+/** Returns the bits of a bitset element which are words in [start, end). */
+static uint32_t Candidates_rangeBits(uint32_t start, uint32_t end, uint32_t element)
+{
+    uint32_t first = element * BITS_PER_ELEMENT;
+    uint32_t from, to;
+
+    if (end <= first || start >= first + BITS_PER_ELEMENT)
+    {
+        return 0;
+    }
+
+    from = (start > first) ? start - first : 0;
+    to = (end < first + BITS_PER_ELEMENT) ? end - first : BITS_PER_ELEMENT;
+
+    return ((to == BITS_PER_ELEMENT) ? ~0u : ((1u << to) - 1)) & ~((1u << from) - 1);
+}
+
+/**
+ * Turns the feedback of a guess into a constraint. A GREEN letter is at its
+ * position in the answer, and any other is not. For each letter of the guess,
+ * its GREEN and YELLOW occurrences say the answer has at least that many of
+ * it, and a GRAY one says it has no more than that. Each letter of the guess
+ * gets a slot, and its count in a word is kept in that slot's field. Bounds
+ * which every word meets, none at least or up to the word length at most,
+ * are left out.
+ */
+static void Candidates_constrain(Constraint* constraint, PackedWord guess, FeedbackCode code)
+{
+    int position, other;
+    uint32_t slotShift = 0;
+
+    constraint->guess = guess;
+    constraint->differs = 0;
+    constraint->atLeastBias = 0;
+    constraint->atLeastTops = 0;
+    constraint->atMostBias = 0;
+    constraint->atMostTops = 0;
+    for (position = 0; position < SCORE_ALPHABET_SIZE; position++)
+    {
+        constraint->fields[position] = 0;
+    }
+
+    for (position = 0; position < SCORE_WORD_LENGTH; position++)
+    {
+        uint32_t letter = SCORE_LETTER(guess, position);
+        bool gray = false;
+        uint32_t marked = 0;
+
+        if (Score_letterAt(code, position) != GREEN)
+        {
+            constraint->differs |= (PackedWord) LETTER_TOP
+                                   << (SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1 - position));
+        }
+        if (constraint->fields[letter] != 0)
+        {
+            continue;
+        }
+
+        for (other = position; other < SCORE_WORD_LENGTH; other++)
+        {
+            if (SCORE_LETTER(guess, other) == letter)
+            {
+                gray |= (Score_letterAt(code, other) == GRAY);
+                marked += (Score_letterAt(code, other) != GRAY);
+            }
+        }
+        constraint->fields[letter] = 1u << slotShift;
+        if (marked > 0)
+        {
+            constraint->atLeastBias |= (COUNT_TOP - marked) << slotShift;
+            constraint->atLeastTops |= COUNT_TOP << slotShift;
+        }
+        if (gray)
+        {
+            constraint->atMostBias |= (COUNT_TOP - 1 - marked) << slotShift;
+            constraint->atMostTops |= COUNT_TOP << slotShift;
+        }
+        slotShift += COUNT_BITS;
+    }
+}
+
+/**
+ * Checks the candidates of an element against a constraint from their packed
+ * letters. The positions which have the guess's letter, which must be the
+ * GREEN ones only, are found for the whole word at once. Then a table lookup
+ * per letter adds it to the count of its slot, and the counts of every slot
+ * are checked against their bounds at once. Only the words whose bits are set
+ * are read, so the cost is in the candidates left, not the 32 words of the
+ * element.
+ *
+ * @param constraint:   The constraint
+ * @param words:        The packed words of the element's chunk
+ * @param bits:         The candidates of the element
+ * @return the bits of the candidates which meet the constraint
+ */
+static uint32_t Candidates_chunkBits(const Constraint* constraint, const PackedWord* words, uint32_t bits)
+{
+    uint32_t keep = 0;
+    uint32_t i;
+
+    for (i = 0; bits != 0; i++, bits >>= 1)
+    {
+        PackedWord word = words[i];
+        PackedWord other = word ^ constraint->guess;
+        PackedWord differs = (((other & LETTER_LOWS) + LETTER_LOWS) | other) & LETTER_TOPS;
+        uint32_t counts = 0;
+        int position;
+
+        if (((bits & 1) == 0) || (differs != constraint->differs))
+        {
+            continue;
+        }
+
+        for (position = 0; position < SCORE_WORD_LENGTH; position++)
+        {
+            counts += constraint->fields[SCORE_LETTER(word, position)];
+        }
+
+        keep |= (uint32_t) ((((counts + constraint->atLeastBias) & constraint->atLeastTops) == constraint->atLeastTops)
+                            && (((counts + constraint->atMostBias) & constraint->atMostTops) == 0)) << i;
+    }
+
+    return keep;
+}
+
+void Candidates_reset(void)
+{
+    uint32_t element;
+
+    for (element = 0; element < CandidatesTables_bitsetWords; element++)
+    {
+        CandidatesTables_live[element] = Candidates_rangeBits(0, CandidatesTables_wordCount, element);
+    }
+    liveCount = CandidatesTables_wordCount;
+    nextElement = UINT32_MAX; // A narrowing in progress was for the last game
+}
+
+void Candidates_addFeedback(PackedWord guess, FeedbackCode code)
+{
+    Candidates_startFeedback(guess, code);
+    Candidates_step(UINT32_MAX);
+}
+
+void Candidates_startFeedback(PackedWord guess, FeedbackCode code)
+{
+    // The feedback before has to be in every element before this one is
+    Candidates_step(UINT32_MAX);
+    Candidates_constrain(&narrowing, guess, code);
+    nextElement = 0;
+    narrowedCount = 0;
+}
+
+/**
+ * Narrows each element of the set which has candidates by the bits of its
+ * candidates which meet the feedback, read from the packed words in flash.
+ * The elements without candidates, which after the first guess or two are
+ * most of them, cost nothing and do not count towards maxChunks. The count of
+ * candidates changes only once every element is done.
+ *
+ * @param maxChunks:    The most chunks to walk
+ * @return true if the narrowing is done, or was never started
+ */
+bool Candidates_step(uint32_t maxChunks)
+{
+    uint32_t chunks = 0;
+
+    for (; nextElement < CandidatesTables_bitsetWords && chunks < maxChunks; nextElement++)
+    {
+        if (CandidatesTables_live[nextElement] == 0)
+        {
+            continue;
+        }
+
+        CandidatesTables_live[nextElement] =
+            Candidates_chunkBits(&narrowing, &CandidatesTables_words[nextElement * BITS_PER_ELEMENT],
+                                 CandidatesTables_live[nextElement]);
+        narrowedCount += Candidates_popCount(CandidatesTables_live[nextElement]);
+        chunks++;
+    }
+
+    if (nextElement == CandidatesTables_bitsetWords)
+    {
+        liveCount = narrowedCount;
+        nextElement = UINT32_MAX;
+    }
+    return nextElement == UINT32_MAX;
+}
+
+uint32_t Candidates_count(void)
+{
+    return liveCount;
+}
+
+/**
+ * Finds the first element with a candidate, and the lowest set bit of it.
+ */
+PackedWord Candidates_first(void)
+{
+    uint32_t element, bits, bit;
+
+    element = 0;
+    while (element < CandidatesTables_bitsetWords && CandidatesTables_live[element] == 0)
+    {
+        element++;
+    }
+    if (element == CandidatesTables_bitsetWords)
+    {
+        return 0;
+    }
+
+    bits = CandidatesTables_live[element];
+    for (bit = 0; (bits & 1) == 0; bit++)
+    {
+        bits >>= 1;
+    }
+    return CandidatesTables_words[element * BITS_PER_ELEMENT + bit];
+}
+
+bool Candidates_contains(uint32_t index)
+{
+    return (CandidatesTables_live[index / BITS_PER_ELEMENT] >> (index % BITS_PER_ELEMENT)) & 1;
+}
+
+const uint32_t* Candidates_bitset(void)
+{
+    return CandidatesTables_live;
+}
+
+uint32_t Candidates_bitsetWords(void)
+{
+    return CandidatesTables_bitsetWords;
+}
+
+uint32_t Candidates_ramBytes(void)
+{
+    return CandidatesTables_bitsetWords * sizeof(CandidatesTables_live[0]) + sizeof(liveCount)
+           + sizeof(narrowing) + sizeof(nextElement) + sizeof(narrowedCount);
+}
+
+uint32_t Candidates_flashBytes(void)
+{
+    return CandidatesTables_wordCount * sizeof(CandidatesTables_words[0]);
+}
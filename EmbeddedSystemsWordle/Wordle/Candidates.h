@@ -0,0 +1,65 @@
+/*
+ * Candidates.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The dictionary words which are still possible answers: those which, had
+ * they been the answer, would have given every guess so far the feedback it
+ * got. They are kept as a bitset over the dictionary in SRAM, next to every
+ * word packed in flash (see CandidatesTables.h). A feedback code is turned
+ * into a constraint on the letter at each position and on the count of each
+ * letter of the guess. Each 32-bit element of the set is narrowed by checking
+ * the packed words of its candidates against it, the positions and the counts
+ * a whole word at a time. Bitsets of every word for every position, letter
+ * and count would take over 100 KB of flash, two fifths of the MSP432's; the
+ * packed words take 23 KB, and only the candidates left are read, so late in
+ * a game there is little to check.
+ *
+ * Narrowing the set by a guess checks every element which still has
+ * candidates, which after the first guess is the whole dictionary, so it can
+ * be done a chunk of 32 words at a time with Candidates_step(). There is a
+ * single set, for the game in progress.
+ */
+
+#ifndef WORDLE_CANDIDATES_H_
+#define WORDLE_CANDIDATES_H_
+
+#include <Wordle/Score.h>
+
+// Chunks narrowed by one Candidates_step() call: up to 32 candidates, so the caller can stop on a deadline
+#define CANDIDATES_STEP_CHUNKS  1
+
+// Makes every dictionary word a candidate again, for a new game
+void Candidates_reset(void);
+
+// Keeps only the candidates which would have given a guess the feedback it got
+void Candidates_addFeedback(PackedWord guess, FeedbackCode code);
+
+// Starts narrowing the candidates by the feedback a guess got; Candidates_step() does the work. Until it is done the
+// set is part way between the old candidates and the new, so nothing else may look at it. A narrowing still in
+// progress is finished first.
+void Candidates_startFeedback(PackedWord guess, FeedbackCode code);
+
+// Narrows at most maxChunks chunks which have candidates. Returns true once the set is narrowed, or was never started.
+bool Candidates_step(uint32_t maxChunks);
+
+// Returns the number of candidates
+uint32_t Candidates_count(void);
+
+// Returns the first candidate in dictionary order, or 0 if there are none
+PackedWord Candidates_first(void);
+
+// Returns true if the word Dictionary_next() visits as the index-th is a candidate
+bool Candidates_contains(uint32_t index);
+
+// Returns the candidate bitset, Candidates_bitsetWords() elements of 32 bits
+const uint32_t* Candidates_bitset(void);
+uint32_t Candidates_bitsetWords(void);
+
+// Returns the number of bytes of SRAM the candidate set uses
+uint32_t Candidates_ramBytes(void);
+
+// Returns the number of bytes of flash the packed words take
+uint32_t Candidates_flashBytes(void);
+
+#endif /* WORDLE_CANDIDATES_H_ */
@@ -0,0 +1,997 @@
+/*
+ * CandidatesTables.c
+ *
+ * Generated by Host/MakeDictionary from Wordle/words.txt. Do not edit; run
+ * "make dictionary" in Host/ after changing the word list.
+ *
+ * 5752 words, 23008 bytes of flash, 720 bytes of SRAM.
+ */
+
+#include <Wordle/Score.h>
+#include <Wordle/CandidatesTables.h>
+
+#if SCORE_WORD_LENGTH == 5
+
+#define BITSET_WORDS    180
+
+const PackedWord CandidatesTables_words[5752] =
+{
+    0x010C8E8, 0x011046B, 0x01104D4, 0x0110665, 0x0110668, 0x0110685,
+    0x01108B3, 0x01108B9, 0x01109F4, 0x011142D, 0x0111693, 0x01121F2,
+    0x0112485, 0x01130B2, 0x0113C85, 0x0113E54, 0x0113EB4, 0x0113EC5,
+    0x0115665, 0x0115693, 0x011575A, 0x0116673, 0x011A0A4, 0x011A0B3,
+    0x011A1EF, 0x011A493, 0x011A5C7, 0x011B4B3, 0x011B8A4, 0x011B8B3,
+    0x011BE4E, 0x011C8B3, 0x011C924, 0x011CB2C, 0x011D0A4, 0x011D12E,
+    0x011D1F2, 0x011D685, 0x01204E5, 0x0120614, 0x01210A4, 0x01210B2,
+    0x0121185, 0x0121614, 0x01224B5, 0x01225F3, 0x012342E, 0x01234AE,
+    0x012352E, 0x0123534, 0x0123538, 0x0123C45, 0x0123E14, 0x0123E45,
+    0x0123E4E, 0x0125594, 0x01268A4, 0x01268B3, 0x0129D33, 0x012BDD3,
+    0x012C925, 0x0131938, 0x0132645, 0x0133DF4, 0x0133E45, 0x0133EAC,
+    0x01350B2, 0x013852E, 0x0138605, 0x0138653, 0x0138685, 0x01386C5,
+    0x01395D4, 0x0139E4F, 0x013A585, 0x013A5C7, 0x013B1F7, 0x013BDD9,
+    0x013C8A5, 0x013D4B3, 0x0141424, 0x01415B3, 0x0143F33, 0x01490A4,
+    0x01490B2, 0x01490B3, 0x014B0A4, 0x014B4A4, 0x014B4B2, 0x014C8A4,
+    0x014C8B2, 0x014CD85, 0x014D068, 0x016046B, 0x016064D, 0x0160AAD,
+    0x01610B2, 0x0161608, 0x0161654, 0x0161C25, 0x0161C2C, 0x0162433,
+    0x0162449, 0x01624AE, 0x01624EE, 0x0162565, 0x01626C5, 0x0162F24,
+    0x0162F2C, 0x0163039, 0x01630B9, 0x01631F4, 0x01631F7, 0x01631F9,
+    0x0163CB3, 0x0163CD4, 0x0163D01, 0x0163DC5, 0x0163DC7, 0x0163DE6,
+    0x0163EA4, 0x0164101, 0x0165032, 0x01650B2, 0x01651F3, 0x01655B3,
+    0x0168673, 0x0168745, 0x01688B2, 0x0168934, 0x0168985, 0x01695C4,
+    0x01695D3, 0x016A485, 0x016A4EF, 0x016A5C5, 0x016A5CF, 0x016A673,
+    0x016A699, 0x016B5F3, 0x016BDC7, 0x016BEB2, 0x016C0A4, 0x016C185,
+    0x016C199, 0x016D46B, 0x016D665, 0x01710A4, 0x01715D4, 0x0171CAC,
+    0x0171CB2, 0x0171D85, 0x0171E59, 0x0171E74, 0x01725A1, 0x01725A5,
+    0x01725EE, 0x0172665, 0x0172D13, 0x0172D85, 0x017382C, 0x01738B8,
+    0x01739F9, 0x0173AAC, 0x0173AAD, 0x0173C85, 0x0173DD3, 0x01750A4,
+    0x01750B3, 0x0175123, 0x0175133, 0x0175241, 0x0175279, 0x017592C,
+    0x017CA81, 0x0180465, 0x0180654, 0x0181659, 0x0182124, 0x01825C7,
+    0x0182668, 0x018402C, 0x0184185, 0x0184199, 0x01849EE, 0x0184CB3,
+    0x0184D33, 0x01850B2, 0x0185199, 0x018D433, 0x01909F2, 0x0190CA4,
+    0x01911F2, 0x019142C, 0x0191433, 0x01915C1, 0x0191DEE, 0x0191DF4,
+    0x0191EA5, 0x0192433, 0x0192665, 0x0192688, 0x01934A4, 0x01934B2,
+    0x01935F2, 0x0193DA1, 0x0193E65, 0x0194833, 0x0194839, 0x01949F7,
+    0x0194CA4, 0x0194CB3, 0x0194DEE, 0x0195279, 0x01955B3, 0x01985C1,
+    0x0198DF4, 0x019A0A4, 0x019A0AE, 0x019A0B2, 0x019A0B3, 0x019A485,
+    0x019ACA4, 0x019ACB2, 0x019ACB7, 0x019C0AE, 0x019C123, 0x019CC39,
+    0x019CCAE, 0x019CCB3, 0x019CCB4, 0x019CDE3, 0x019D0B2, 0x019D132,
+    0x01A2594, 0x01A3033, 0x01A3D8C, 0x01A3DB3, 0x01A3DC5, 0x01A3DD9,
+    0x01A3E19, 0x01A4921, 0x01A5032, 0x01A5123, 0x01A9038, 0x01A912F,
+    0x01A9134, 0x01A9CB2, 0x01A9D14, 0x01A9EB2, 0x01ABA93, 0x01ABA99,
+    0x01AC82C, 0x01AC833, 0x01AC923, 0x01AD1F3, 0x01AE12E, 0x01B052C,
+    0x01B05D4, 0x01B0674, 0x01B15D3, 0x01B1653, 0x01B1654, 0x01B1C33,
+    0x01B242E, 0x01B3D24, 0x01B3EF3, 0x01B8534, 0x01B8565, 0x01B8644,
+    0x01B8645, 0x01B8668, 0x01B9AAC, 0x01BA5C7, 0x01BB8A4, 0x01BBD65,
+    0x01C242C, 0x01C2593, 0x01C25C7, 0x01C25ED, 0x01C30B3, 0x01C3DD3,
+    0x01C8513, 0x01D5645, 0x02084A4, 0x02088AC, 0x02088B3, 0x0208C79,
+    0x0208D73, 0x0208DEE, 0x0209099, 0x02090E5, 0x0209199, 0x0209CAC,
+    0x0209CF9, 0x020A293, 0x020A593, 0x020A64E, 0x020A693, 0x020A745,
+    0x020ACA4, 0x020ACB2, 0x020ACB3, 0x020B093, 0x020B099, 0x020B0A4,
+    0x020B0B2, 0x020B0B3, 0x020B173, 0x020B179, 0x020B193, 0x020B199,
+    0x020B1B3, 0x020B1B9, 0x020B261, 0x020B2AE, 0x020B82C, 0x020B893,
+    0x020B899, 0x020B8B3, 0x020B8F3, 0x020B94F, 0x020B973, 0x020B9D3,
+    0x020C853, 0x020C893, 0x020C8A4, 0x020C8B2, 0x020C8B3, 0x020C8D3,
+    0x020C8E5, 0x020C8F9, 0x020C973, 0x020C9B9, 0x020C9D3, 0x020C9EE,
+    0x020CA45, 0x020CC2C, 0x020CCA4, 0x020CCB2, 0x020CCB3, 0x020CD23,
+    0x020CD2C, 0x020CD2E, 0x020CD33, 0x020CD73, 0x020CE6F, 0x020CE85,
+    0x020D068, 0x020D0A4, 0x020D0B2, 0x020D0B3, 0x020D105, 0x020D113,
+    0x020D12B, 0x020D1EE, 0x020D293, 0x020D299, 0x020D493, 0x020D58B,
+    0x020DC93, 0x020DC99, 0x020DD93, 0x020E4A4, 0x020E5F5, 0x0228468,
+    0x0228493, 0x0228499, 0x0228573, 0x02285B3, 0x02285CF, 0x02285D3,
+    0x0228644, 0x0228653, 0x0228674, 0x0228693, 0x02286B3, 0x02286B4,
+    0x02286B8, 0x02289F0, 0x0228D73, 0x022912D, 0x0229468, 0x02294D3,
+    0x02294D9, 0x0229613, 0x0229653, 0x0229659, 0x0229693, 0x0229934,
+    0x02299E7, 0x0229C2E, 0x0229C34, 0x0229CB4, 0x0229D2E, 0x0229DF4,
+    0x0229EAD, 0x0229EAE, 0x022A4E5, 0x022A5C7, 0x022B039, 0x022B068,
+    0x022B125, 0x022B185, 0x022B193, 0x022B199, 0x022B1F7, 0x022B293,
+    0x022B42E, 0x022B868, 0x022B893, 0x022B899, 0x022BA93, 0x022C8B4,
+    0x022C8F3, 0x022C973, 0x022C9B3, 0x022CA59, 0x022CA88, 0x022CB2C,
+    0x022CCB4, 0x022CDED, 0x022CDF4, 0x022CE93, 0x022D033, 0x022D0AC,
+    0x022D8AC, 0x022DAD9, 0x022E8AC, 0x0240549, 0x0248985, 0x0248CB0,
+    0x0249099, 0x02490A4, 0x02490B2, 0x02490B3, 0x02490B4, 0x0249653,
+    0x02498D3, 0x0249924, 0x0249D01, 0x0249D14, 0x0249DF4, 0x024A9F5,
+    0x024ACA4, 0x024ACB2, 0x024ACB3, 0x024B059, 0x024B0B3, 0x024B0E5,
+    0x024B173, 0x024B193, 0x024B199, 0x024B44F, 0x024B893, 0x024B8E5,
+    0x024B8EF, 0x024BCF3, 0x024BDA5, 0x024BE81, 0x024C0A4, 0x024C868,
+    0x024C893, 0x024CA88, 0x024CDEE, 0x024D068, 0x024D0B2, 0x024D0B3,
+    0x024D299, 0x0260453, 0x026046B, 0x0260485, 0x02604F3, 0x0260513,
+    0x02605A5, 0x02605C3, 0x02605C4, 0x02605CB, 0x0260645, 0x0260665,
+    0x0260674, 0x0260693, 0x0260745, 0x026142B, 0x0261432, 0x0261434,
+    0x02614A4, 0x02614B0, 0x02615C4, 0x0261673, 0x02625B0, 0x02625C4,
+    0x02625C7, 0x02625C9, 0x02625CB, 0x0262613, 0x0262673, 0x026269A,
+    0x0263C34, 0x0263C53, 0x0263C6B, 0x0263C73, 0x0263CF3, 0x0263D65,
+    0x0263DC4, 0x0263DE4, 0x0263DED, 0x0263DF0, 0x0263E93, 0x0263EEE,
+    0x0263EF3, 0x0263EF9, 0x02654A4, 0x02654B2, 0x02654B3, 0x02654B4,
+    0x02654B9, 0x02654C6, 0x02655D4, 0x0265642, 0x0265653, 0x0265654,
+    0x0265668, 0x0278644, 0x0278653, 0x0278674, 0x0278693, 0x0278859,
+    0x0278C65, 0x0278D73, 0x02790A4, 0x02790B3, 0x02790E5, 0x02798CF,
+    0x0279C2E, 0x0279CB9, 0x0279CF9, 0x0279D25, 0x0279DEE, 0x0279EB3,
+    0x027A593, 0x027A5C7, 0x027A5CB, 0x027ACA8, 0x027B033, 0x027B0B3,
+    0x027B193, 0x027B293, 0x027B2B3, 0x027B453, 0x027B865, 0x027B893,
+    0x027B8A4, 0x027B8B2, 0x027B8B3, 0x027B8EF, 0x027B8F3, 0x027B973,
+    0x027B9D9, 0x027BAB3, 0x027BC53, 0x027BC59, 0x027BCA4, 0x027BD73,
+    0x027BDB3, 0x027BDB9, 0x027BDD3, 0x027BE53, 0x027BE74, 0x027BE88,
+    0x027BE93, 0x027BE99, 0x027BF45, 0x027BF59, 0x027C838, 0x027C8A4,
+    0x027C8B2, 0x027C8B3, 0x027C923, 0x027C9C5, 0x027C9EE, 0x027CDED,
+    0x027CDEE, 0x027CE79, 0x027CEAE, 0x027D068, 0x027D119, 0x027D299,
+    0x027D4E8, 0x027D5C4, 0x027D693, 0x027DCA4, 0x027DCAC, 0x027DCB2,
+    0x027DD25, 0x027DD93, 0x027E0A4, 0x027E0AE, 0x027E0B2, 0x027E0B3,
+    0x027E4B2, 0x027E9F3, 0x0290465, 0x0290474, 0x0290493, 0x02904B3,
+    0x02904F3, 0x0290524, 0x029052E, 0x0290565, 0x02905C4, 0x02905D3,
+    0x0290668, 0x0290673, 0x0290693, 0x02906C5, 0x02906CF, 0x02906EC,
+    0x02906EE, 0x0290733, 0x0290745, 0x0291424, 0x029142B, 0x029142D,
+    0x02914A4, 0x02916C5, 0x02916F3, 0x0292432, 0x0292445, 0x029246B,
+    0x0292485, 0x02924A6, 0x02924B2, 0x02924F3, 0x029258C, 0x02925B3,
+    0x02925C5, 0x02925C7, 0x02925CB, 0x02925D9, 0x029266B, 0x0293C24,
+    0x0293D2C, 0x0293D65, 0x0293DC3, 0x0293DE4, 0x0293DEB, 0x0293DED,
+    0x0293E65, 0x0293E88, 0x0293EEE, 0x0293EF3, 0x029552E, 0x0295534,
+    0x02955D4, 0x0295668, 0x0295685, 0x02A8D73, 0x02A9099, 0x02A90E5,
+    0x02A98CF, 0x02A98D3, 0x02A9CF9, 0x02A9D85, 0x02AA584, 0x02AA594,
+    0x02AB053, 0x02AB0E5, 0x02AB0F9, 0x02AB173, 0x02AB179, 0x02AB181,
+    0x02AB193, 0x02AB199, 0x02AB608, 0x02AB613, 0x02AB619, 0x02AB868,
+    0x02AB86F, 0x02AB8F3, 0x02AB973, 0x02AB9D9, 0x02ABA93, 0x02ABF33,
+    0x02AC853, 0x02AC8E8, 0x02AC8F3, 0x02AC961, 0x02AC993, 0x02AC999,
+    0x02AC9D3, 0x02AC9D4, 0x02ACA13, 0x02ACA21, 0x02ACA4F, 0x02ACA53,
+    0x02ACA61, 0x02ACA74, 0x02ACC59, 0x02ACCA4, 0x02ACCB3, 0x02ACD19,
+    0x02ACD73, 0x02ACE93, 0x02ACE99, 0x02AD068, 0x02AD285, 0x02AD293,
+    0x02AD299, 0x02AD32C, 0x02AE1ED, 0x02AE4B2, 0x02AEB59, 0x02C9653,
+    0x02CB037, 0x02CC8B3, 0x02CCE69, 0x02CD0B3, 0x02CDC39, 0x030882C,
+    0x0308859, 0x03088B2, 0x030892E, 0x0308985, 0x0308C2F, 0x0308D05,
+    0x0308E89, 0x0309099, 0x03090B4, 0x03090E5, 0x0309245, 0x0309461,
+    0x03098B3, 0x03098D3, 0x0309CA4, 0x0309CB2, 0x0309CB3, 0x0309CB9,
+    0x030A64E, 0x030ACA4, 0x030ACB3, 0x030B173, 0x030B181, 0x030B193,
+    0x030B1B3, 0x030B2C5, 0x030B338, 0x030B4AC, 0x030B4AF, 0x030B613,
+    0x030B619, 0x030B82C, 0x030B899, 0x030B8A4, 0x030B8B2, 0x030B8B3,
+    0x030B9D9, 0x030B9E5, 0x030B9EE, 0x030BA74, 0x030BA8F, 0x030BA93,
+    0x030C0A4, 0x030C0B2, 0x030C0B3, 0x030C1EE, 0x030C1F3, 0x030C834,
+    0x030C853, 0x030C893, 0x030C8A4, 0x030C8B2, 0x030C8B3, 0x030C8B4,
+    0x030C8EF, 0x030C973, 0x030C9D9, 0x030C9E2, 0x030C9EC, 0x030C9ED,
+    0x030CA09, 0x030CA13, 0x030CA59, 0x030CA85, 0x030CA93, 0x030CAC5,
+    0x030CCA4, 0x030CCB3, 0x030CD73, 0x030CE85, 0x030CE93, 0x030D068,
+    0x030D0B2, 0x030D299, 0x030D58B, 0x030D665, 0x030D8A4, 0x030D8B2,
+    0x030D8B3, 0x030D92C, 0x030DCA4, 0x0328665, 0x0328C2C, 0x0328EAD,
+    0x0329032, 0x03290A4, 0x03290B2, 0x03290B3, 0x032B0A2, 0x032B18F,
+    0x032B193, 0x032BA93, 0x032C8A4, 0x032CA93, 0x0340493, 0x03404C5,
+    0x03404C6, 0x034052E, 0x0340532, 0x034058B, 0x03405B0, 0x03405D4,
+    0x03405F3, 0x0340613, 0x0340644, 0x034064D, 0x0340653, 0x0340654,
+    0x0340659, 0x0340665, 0x034066D, 0x0340693, 0x0341430, 0x0341434,
+    0x034146B, 0x03414AB, 0x03414B0, 0x03414B2, 0x03414D3, 0x03415AF,
+    0x0341654, 0x0341673, 0x0341674, 0x03416F3, 0x03416F9, 0x034246B,
+    0x0342485, 0x03424A6, 0x0342584, 0x0342589, 0x034258C, 0x03425A5,
+    0x03425B0, 0x03425C1, 0x03425C5, 0x03425C7, 0x03425CB, 0x03425CF,
+    0x03425D3, 0x0342613, 0x0342650, 0x0342652, 0x0342693, 0x03426C5,
+    0x03426D9, 0x0343C6B, 0x0343C73, 0x0343D32, 0x0343D65, 0x0343DB0,
+    0x0343DEB, 0x0343E13, 0x0343E44, 0x0343E45, 0x0343E65, 0x0343EB8,
+    0x0343EF3, 0x0345453, 0x034546B, 0x03454C6, 0x03454F3, 0x03455B0,
+    0x03455B3, 0x03455CB, 0x034564C, 0x034564E, 0x0345652, 0x0345685,
+    0x03465A5, 0x03485F3, 0x03490B2, 0x0349C32, 0x034B121, 0x034B868,
+    0x034C861, 0x034CA49, 0x034CE79, 0x034D0A4, 0x034D0B3, 0x034D8B4,
+    0x034D923, 0x034D92C, 0x036046B, 0x0360485, 0x0360493, 0x036052D,
+    0x03605B0, 0x03605B3, 0x03605C7, 0x03605CB, 0x03605D3, 0x0360613,
+    0x0360668, 0x0360670, 0x0360673, 0x0360674, 0x03606C5, 0x03606F3,
+    0x0360733, 0x036142E, 0x0361432, 0x0361434, 0x03614D3, 0x03614D4,
+    0x036164B, 0x03616F3, 0x036246B, 0x03624C6, 0x03625A2, 0x03625A5,
+    0x03625C7, 0x03625CB, 0x0362613, 0x0362693, 0x0363C2B, 0x0363C6B,
+    0x0363C93, 0x0363CF3, 0x0363DB0, 0x0363DC5, 0x0363DCB, 0x0363E13,
+    0x0363E65, 0x0363E88, 0x0363E93, 0x0363EA4, 0x0363EB4, 0x0363EC5,
+    0x0363EEE, 0x0363F33, 0x0365453, 0x036546B, 0x03654A4, 0x03654B3,
+    0x03655B0, 0x03655C7, 0x03655CB, 0x0365929, 0x0366129, 0x0366136,
+    0x0366138, 0x03662C9, 0x0378468, 0x0378593, 0x0378674, 0x0378693,
+    0x0378985, 0x0378A41, 0x0378C33, 0x0378C69, 0x0378D73, 0x0378D79,
+    0x0378DE1, 0x0378DF3, 0x0379033, 0x03790A3, 0x03790A4, 0x03790B2,
+    0x03790B3, 0x03790B8, 0x03791EE, 0x0379493, 0x037A1F3, 0x037A4D3,
+    0x037A593, 0x037A5D3, 0x037ACA4, 0x037ACB3, 0x037ACB9, 0x037B033,
+    0x037B093, 0x037B0B9, 0x037B123, 0x037B1EE, 0x037B1F2, 0x037B293,
+    0x037B425, 0x037B433, 0x037B44F, 0x037B453, 0x037B4B2, 0x037B4B3,
+    0x037B4B4, 0x037B4D9, 0x037B523, 0x037B5A1, 0x037B5B3, 0x037B60F,
+    0x037B613, 0x037B868, 0x037B88F, 0x037B8A4, 0x037B8B3, 0x037B8E1,
+    0x037B923, 0x037B973, 0x037BA84, 0x037BCA4, 0x037BCA5, 0x037BD73,
+    0x037BD93, 0x037BDD3, 0x037BE13, 0x037BE93, 0x037C039, 0x037C0A4,
+    0x037C0B2, 0x037C0B3, 0x037C241, 0x037C265, 0x037C82C, 0x037C893,
+    0x037C8A4, 0x037C8B2, 0x037C8B3, 0x037C8E9, 0x037C973, 0x037C979,
+    0x037C9B3, 0x037C9D3, 0x037C9D9, 0x037CA13, 0x037CCB3, 0x037CE93,
+    0x037D0B3, 0x037D468, 0x037D4E8, 0x037D584, 0x037D5D4, 0x037D605,
+    0x037D613, 0x037D654, 0x037D8A4, 0x037D8AE, 0x037D8B2, 0x037D8B3,
+    0x037D8B4, 0x037D8B9, 0x037DCA4, 0x037DCB2, 0x037DD93, 0x037E0A4,
+    0x037E0B3, 0x037E4A4, 0x037E4B2, 0x037E599, 0x037E615, 0x037E8AE,
+    0x0390453, 0x039046B, 0x03904D4, 0x03904F3, 0x03905B0, 0x03905B3,
+    0x03905C5, 0x03905CB, 0x0390605, 0x0390613, 0x0390668, 0x0390673,
+    0x0390685, 0x03906C5, 0x03906EC, 0x03906F3, 0x0390733, 0x0390745,
+    0x0390759, 0x039142B, 0x039142D, 0x039148F, 0x03914A4, 0x03914AB,
+    0x03914AC, 0x03914B0, 0x03915A5, 0x0391605, 0x0391614, 0x0391673,
+    0x0391674, 0x03916F3, 0x0392453, 0x039246B, 0x03924A4, 0x03924B2,
+    0x03924B3, 0x03925A5, 0x03925B0, 0x0392670, 0x0392673, 0x0393C2B,
+    0x0393C6B, 0x0393CD4, 0x0393DC5, 0x0393DD9, 0x0393DEB, 0x0393DEE,
+    0x0393E13, 0x0393E73, 0x0393EB0, 0x0393EE4, 0x0393EEE, 0x0393EF3,
+    0x0395485, 0x0395493, 0x03954AC, 0x03954B4, 0x03954D4, 0x03955A2,
+    0x03955B0, 0x0395641, 0x0395665, 0x0395668, 0x0395674, 0x0396614,
+    0x03A88A4, 0x03A88B2, 0x03A88B3, 0x03A8923, 0x03A8934, 0x03A98D3,
+    0x03AA5C7, 0x03AB193, 0x03AB201, 0x03AB293, 0x03AB52E, 0x03ABA93,
+    0x03AC124, 0x03AC201, 0x03AC853, 0x03AC893, 0x03AC8A4, 0x03AC8B2,
+    0x03AC8B3, 0x03AC921, 0x03AC925, 0x03AC92F, 0x03AC993, 0x03AC999,
+    0x03ACA59, 0x03ACA65, 0x03ACA6F, 0x03ACAC5, 0x03ACAD9, 0x03ACD19,
+    0x03ACE13, 0x03AD0B2, 0x03AD0B3, 0x03AD0B9, 0x03AD125, 0x03AD2B0,
+    0x03C85D3, 0x03C88B2, 0x03C8C24, 0x03C8D85, 0x03C90B2, 0x03CB923,
+    0x03CCE93, 0x03D0653, 0x0408CB3, 0x0408D01, 0x0409099, 0x04091F3,
+    0x04098D9, 0x0409CF9, 0x0409DF3, 0x040A599, 0x040A659, 0x040A679,
+    0x040B0B3, 0x040B199, 0x040B4B3, 0x040B5D3, 0x040B613, 0x040B865,
+    0x040B899, 0x040B8F3, 0x040C8A4, 0x040C8B2, 0x040C8B3, 0x040C973,
+    0x040C9D3, 0x040CA93, 0x040D0A4, 0x040D0B2, 0x040D0B3, 0x040D2AD,
+    0x040D453, 0x040D5D4, 0x040D934, 0x040DDD3, 0x040E42E, 0x040E8A4,
+    0x040E8B3, 0x04225C7, 0x0428593, 0x0428594, 0x04285D3, 0x0428653,
+    0x0428659, 0x0428688, 0x0428832, 0x0428934, 0x0428A93, 0x0428AA7,
+    0x0428AB4, 0x0428C26, 0x0428C2C, 0x0428C39, 0x0428D73, 0x0428DF2,
+    0x0428DF9, 0x0428E59, 0x0429493, 0x04295B3, 0x0429613, 0x0429834,
+    0x04298B2, 0x04299E7, 0x0429C33, 0x042A465, 0x042A4D9, 0x042A4EE,
+    0x042A66D, 0x042A674, 0x042A699, 0x042B039, 0x042B0B3, 0x042B0D4,
+    0x042B133, 0x042B193, 0x042B281, 0x042B2C5, 0x042B534, 0x042B5E2,
+    0x042B5E9, 0x042B5EE, 0x042B5F3, 0x042B6B2, 0x042B92D, 0x042BA65,
+    0x042BA93, 0x042C1F4, 0x042C288, 0x042C859, 0x042CCB8, 0x042CD73,
+    0x042D0B2, 0x042D1F8, 0x042D465, 0x042D92C, 0x042DC32, 0x042DCA4,
+    0x042E0B3, 0x0443E89, 0x0443EF3, 0x0448593, 0x0448659, 0x0448CA4,
+    0x0448CB2, 0x0448CB3, 0x0448CB9, 0x0448D73, 0x0448DF4, 0x0448E81,
+    0x0449274, 0x0449693, 0x04498D3, 0x0449D34, 0x044ACA4, 0x044ACB2,
+    0x044ACB3, 0x044B08F, 0x044B193, 0x044B199, 0x044B4B2, 0x044B4B3,
+    0x044B599, 0x044B832, 0x044B8A4, 0x044B8B2, 0x044B8B3, 0x044B8EF,
+    0x044B8F3, 0x044B8F9, 0x044B979, 0x044BA93, 0x044BC85, 0x044C219,
+    0x044C26F, 0x044C8B2, 0x044C8E5, 0x044C973, 0x044CA93, 0x044CA99,
+    0x044CC6F, 0x044CC73, 0x044CD19, 0x044CD73, 0x044D068, 0x044D279,
+    0x044D28F, 0x044D299, 0x044D82E, 0x044D833, 0x044D8A4, 0x044D8B2,
+    0x044D8B3, 0x044D9F4, 0x044DAD9, 0x044EB59, 0x0478A41, 0x0478A4F,
+    0x0478D73, 0x04790E5, 0x04790F9, 0x04791F3, 0x0479653, 0x0479674,
+    0x04798D3, 0x0479CB3, 0x0479CEF, 0x0479CF9, 0x0479D25, 0x0479DA1,
+    0x047A599, 0x047A5C7, 0x047A9F3, 0x047B0A4, 0x047B0B3, 0x047B193,
+    0x047B199, 0x047B1F2, 0x047B293, 0x047B4A4, 0x047B4B3, 0x047B833,
+    0x047B8F3, 0x047B9F2, 0x047BDB3, 0x047BDB9, 0x047BE53, 0x047C033,
+    0x047C0A4, 0x047C0B2, 0x047C0B3, 0x047C0B9, 0x047C973, 0x047C979,
+    0x047C9B3, 0x047CA61, 0x047CCA4, 0x047CCB3, 0x047D0A4, 0x047D0B2,
+    0x047D0B3, 0x047D299, 0x047D454, 0x047D4E8, 0x047D665, 0x047D8B3,
+    0x047DC99, 0x047DCAC, 0x047DCB2, 0x047DDD3, 0x047DDD9, 0x047DE59,
+    0x047DE65, 0x047E4AE, 0x047E8A4, 0x047E8AE, 0x047E8B2, 0x047E8B3,
+    0x0490453, 0x04904D4, 0x04904F3, 0x049052E, 0x0490565, 0x04905A1,
+    0x04905B3, 0x04905CB, 0x0490605, 0x0490693, 0x04906EC, 0x04906EE,
+    0x04906F3, 0x0490733, 0x0491424, 0x049142D, 0x0491432, 0x049146B,
+    0x04914F3, 0x0491673, 0x04924A4, 0x04924B2, 0x04924B3, 0x04924D4,
+    0x049258C, 0x0492599, 0x04925CB, 0x0492613, 0x04926C5, 0x0493D24,
+    0x0493D8C, 0x0493DC5, 0x0493DEC, 0x0493DF0, 0x0493E13, 0x0493E73,
+    0x0493EC5, 0x0493EEE, 0x0495453, 0x04954F3, 0x0495524, 0x04955B3,
+    0x04955CB, 0x0495605, 0x0496424, 0x04964B2, 0x0496599, 0x04A8593,
+    0x04A8C2C, 0x04A8C34, 0x04A8D19, 0x04A8D73, 0x04A8D79, 0x04A8E93,
+    0x04A90A4, 0x04A90B3, 0x04A9593, 0x04A9693, 0x04A98D3, 0x04AACB3,
+    0x04AB193, 0x04AB199, 0x04AB44F, 0x04AB5B9, 0x04AB613, 0x04AB619,
+    0x04AB865, 0x04AB8B3, 0x04AB8F3, 0x04AB973, 0x04AB9CF, 0x04AB9D9,
+    0x04AC0A4, 0x04AC0B2, 0x04AC0B3, 0x04AC185, 0x04ACA74, 0x04ACAAD,
+    0x04ACD73, 0x04ACD79, 0x04ACE93, 0x04ACE99, 0x04AD068, 0x04AD8B4,
+    0x04AE0B3, 0x04B8646, 0x04B94A2, 0x04B958C, 0x04B9594, 0x04C8493,
+    0x04C9653, 0x04CA5C7, 0x04CACB3, 0x0509CB2, 0x0509D85, 0x050C8A4,
+    0x050C993, 0x050C999, 0x050C9D3, 0x050CA88, 0x050CCA4, 0x050CCAC,
+    0x050CCB2, 0x050CCB3, 0x050D0AE, 0x050D0B2, 0x050D8B3, 0x05108A4,
+    0x0513DD9, 0x051A1F3, 0x051B034, 0x05215A1, 0x0521CA4, 0x0521CB2,
+    0x0521CB3, 0x0522474, 0x05224D9, 0x0522693, 0x0525465, 0x052C925,
+    0x05318A4, 0x0539CA4, 0x0539CB2, 0x053C8B4, 0x05490B2, 0x0549D14,
+    0x0551474, 0x055A5C7, 0x05605C4, 0x05605D3, 0x0560685, 0x05609F7,
+    0x05610B2, 0x0561474, 0x05614F9, 0x056192E, 0x0562485, 0x0562685,
+    0x0563E05, 0x0565485, 0x0565685, 0x056582E, 0x05658AE, 0x05658B2,
+    0x05658B3, 0x056852C, 0x05688A4, 0x05688B2, 0x0568CA5, 0x05695C4,
+    0x0569659, 0x056A653, 0x056A693, 0x056B4B4, 0x056BD49, 0x056BE85,
+    0x056C293, 0x056C299, 0x0570474, 0x05710A4, 0x05710B2, 0x05711F7,
+    0x05712A5, 0x05715A1, 0x05715B9, 0x05729F9, 0x0573AA9, 0x05749EC,
+    0x0574EA5, 0x05750B2, 0x0575259, 0x05759F9, 0x05814B3, 0x0582473,
+    0x0583C68, 0x0583F19, 0x058D42C, 0x058D530, 0x058D536, 0x0590665,
+    0x0591474, 0x0591DF4, 0x0593C85, 0x05948A4, 0x05949F2, 0x0595474,
+    0x0595614, 0x059CC39, 0x059D0B2, 0x05A20B2, 0x05A2123, 0x05A21CF,
+    0x05A21F3, 0x05A232C, 0x05A5485, 0x05AC9F3, 0x05B0485, 0x05B15D3,
+    0x05B15D4, 0x05B1654, 0x05B1659, 0x05B2474, 0x05B2593, 0x05B3D65,
+    0x05B9653, 0x05C0474, 0x05C0594, 0x05C05B3, 0x05C0CAC, 0x05C1473,
+    0x05C1654, 0x05C2585, 0x05C2674, 0x05C2693, 0x05C4034, 0x05C40AC,
+    0x05C41F3, 0x05C51EC, 0x05C5241, 0x05C5485, 0x05C5594, 0x05C5642,
+    0x05C9653, 0x05CC8B3, 0x0608985, 0x0608CA4, 0x0608CB2, 0x0608CB3,
+    0x0608CB4, 0x0608E8F, 0x0608E93, 0x0609099, 0x06090A4, 0x06090B2,
+    0x06090B3, 0x06091F3, 0x0609659, 0x06098D3, 0x0609DF4, 0x060A593,
+    0x060A5D4, 0x060A645, 0x060A653, 0x060A659, 0x060A688, 0x060ACA4,
+    0x060ACB2, 0x060ACB3, 0x060AD25, 0x060AD32, 0x060B193, 0x060B265,
+    0x060B4A4, 0x060B4B3, 0x060B879, 0x060B8F3, 0x060B9D9, 0x060C824,
+    0x060C865, 0x060C8A4, 0x060C8B2, 0x060C8B3, 0x060C9B3, 0x060CA93,
+    0x060CE93, 0x060D02C, 0x060D0A4, 0x060D0B3, 0x060D199, 0x060D26F,
+    0x060D299, 0x060D2E1, 0x060D594, 0x060D5C1, 0x060D5D3, 0x060D8B3,
+    0x060D9F2, 0x060DDD3, 0x060E0A4, 0x060E0B3, 0x060E4B2, 0x060E645,
+    0x060E8A4, 0x060E8B3, 0x0628653, 0x0628674, 0x0628693, 0x0628C2C,
+    0x0628CB3, 0x0629493, 0x0629593, 0x0629599, 0x062A4EE, 0x062A5D4,
+    0x062B181, 0x062B193, 0x062B1EE, 0x062B293, 0x062B5A5, 0x062B6B2,
+    0x062B865, 0x062B893, 0x062C82C, 0x062C9D3, 0x062C9D9, 0x062C9F8,
+    0x062CA4F, 0x062CA59, 0x062CE93, 0x062D02C, 0x062D033, 0x062D068,
+    0x062D0A4, 0x062D0B3, 0x062D124, 0x062D2B3, 0x062D493, 0x062D8B2,
+    0x062DCB2, 0x062E4B2, 0x0648693, 0x06488B2, 0x0648A45, 0x0648D05,
+    0x0648D15, 0x0648EB3, 0x06494D3, 0x0649584, 0x06495C4, 0x0649659,
+    0x06498A4, 0x06498B2, 0x06498B3, 0x0649A88, 0x0649A99, 0x0649CF9,
+    0x0649D14, 0x064B068, 0x064B0A4, 0x064B0B2, 0x064B0B3, 0x064B0B4,
+    0x064B193, 0x064B199, 0x064B1B3, 0x064B1B9, 0x064B288, 0x064B82C,
+    0x064B868, 0x064B893, 0x064B8A4, 0x064B8B2, 0x064B8B3, 0x064B933,
+    0x064B973, 0x064B9D9, 0x064BE44, 0x064C8A4, 0x064C8B2, 0x064C8B3,
+    0x064C9B3, 0x064CA74, 0x064CA88, 0x064CD19, 0x064CE93, 0x064D199,
+    0x064D8B2, 0x064D8B3, 0x064E0A4, 0x064E0B2, 0x064E0B3, 0x064EB59,
+    0x0653E44, 0x0660453, 0x066046B, 0x06604F3, 0x066052C, 0x0660532,
+    0x0660565, 0x0660573, 0x0660579, 0x06605A5, 0x06605B9, 0x06605CB,
+    0x06605D3, 0x0660613, 0x0660645, 0x0660668, 0x066066B, 0x0660693,
+    0x06606F3, 0x0660733, 0x0661433, 0x066146B, 0x06614B2, 0x06614B3,
+    0x06614B4, 0x0661668, 0x06616F3, 0x066246B, 0x06624A4, 0x06624B2,
+    0x06624B3, 0x06625C7, 0x06625D4, 0x0662613, 0x0662654, 0x0662693,
+    0x0663C34, 0x0663C6B, 0x0663CB3, 0x0663CF3, 0x0663DE4, 0x0663DF2,
+    0x0663E13, 0x0663E41, 0x0663E73, 0x0663EB2, 0x0663EB4, 0x0663EEE,
+    0x0663EF3, 0x0665453, 0x06654B3, 0x06654C6, 0x0665524, 0x0665565,
+    0x0665579, 0x06655A5, 0x06655C7, 0x06655CB, 0x0665668, 0x0665685,
+    0x0665699, 0x0666459, 0x06664B2, 0x0678593, 0x06785B3, 0x06785B9,
+    0x0678C2C, 0x0678EB3, 0x0679CB9, 0x0679CF9, 0x067A593, 0x067A674,
+    0x067B093, 0x067B123, 0x067B12F, 0x067B173, 0x067B199, 0x067BA93,
+    0x067BC93, 0x067BD93, 0x067BE93, 0x067BE99, 0x067C839, 0x067C853,
+    0x067C865, 0x067C893, 0x067C8B3, 0x067C8E5, 0x067C8EF, 0x067C973,
+    0x067C9A1, 0x067C9B3, 0x067CA85, 0x067CA88, 0x067CA93, 0x067CA99,
+    0x067CAAD, 0x067CE61, 0x067D593, 0x067D5C4, 0x067D5D4, 0x067D653,
+    0x067D8A1, 0x067DD93, 0x067E0A4, 0x067E0B3, 0x067E4B2, 0x069046B,
+    0x06904F3, 0x069052C, 0x06905A5, 0x06905C3, 0x06905CB, 0x0690613,
+    0x0690693, 0x06906A4, 0x0690733, 0x069142B, 0x06914A4, 0x06914B2,
+    0x06914B3, 0x06915EE, 0x0691668, 0x0691693, 0x0692432, 0x06924A4,
+    0x06924B3, 0x06924F3, 0x069258C, 0x069266B, 0x069269A, 0x069275A,
+    0x0693C6B, 0x0693CF3, 0x0693D24, 0x0693DC4, 0x0693DD3, 0x0693DD4,
+    0x0693E68, 0x0693E74, 0x0693E88, 0x0693EEE, 0x0693F45, 0x0695534,
+    0x06955B0, 0x06964B2, 0x06A8D73, 0x06A90E5, 0x06A9593, 0x06A9C2C,
+    0x06A9CF9, 0x06A9EA5, 0x06AB193, 0x06AB199, 0x06AB4A4, 0x06AB4B3,
+    0x06AB889, 0x06AB893, 0x06AB8E9, 0x06AB973, 0x06AB979, 0x06AB9D9,
+    0x06AC993, 0x06AC9F2, 0x06ACA59, 0x06ACB45, 0x06ACCA4, 0x06ACCA5,
+    0x06ACCAC, 0x06ACCB3, 0x06ACE79, 0x06ACE99, 0x06AD1EE, 0x06AEB59,
+    0x0708859, 0x0708985, 0x07098C5, 0x07098D3, 0x0709CB3, 0x070A599,
+    0x070A5D3, 0x070A693, 0x070B028, 0x070B033, 0x070B0A1, 0x070B0AE,
+    0x070B0B3, 0x070B193, 0x070B4A4, 0x070B4B2, 0x070B4B3, 0x070B52E,
+    0x070B5A1, 0x070B5B9, 0x070B6B4, 0x070B8F3, 0x070B941, 0x070BD93,
+    0x070C0A4, 0x070C0B2, 0x070C0B3, 0x070C853, 0x070C885, 0x070CCB3,
+    0x070CE13, 0x070CE79, 0x070D0A4, 0x070D0B3, 0x070D1F2, 0x070D499,
+    0x070D4E5, 0x070D5D4, 0x070D673, 0x070D745, 0x070D759, 0x070D8AC,
+    0x070DD73, 0x070DD79, 0x070DE13, 0x070E4B2, 0x070E8A4, 0x070E8B2,
+    0x070E8B3, 0x0728653, 0x0728D6F, 0x0729573, 0x0729579, 0x0729665,
+    0x072B093, 0x072B124, 0x072B5B9, 0x072B8B3, 0x072B8B4, 0x072B925,
+    0x072B929, 0x072BA45, 0x072BA93, 0x072BAB3, 0x072BC85, 0x072BD24,
+    0x072C9B3, 0x072CE6F, 0x072D2B0, 0x0740693, 0x0743E74, 0x0743EAC,
+    0x07485D4, 0x07488A4, 0x07488B2, 0x07488B3, 0x0749099, 0x0749A93,
+    0x074B093, 0x074B0B4, 0x074B193, 0x074B293, 0x074B5A5, 0x074B613,
+    0x074B619, 0x074C279, 0x074C893, 0x074C993, 0x074C999, 0x074C9F3,
+    0x074CA88, 0x074CA93, 0x074CDAF, 0x074CE93, 0x074D0B3, 0x074D8AE,
+    0x074D8B2, 0x074D8B3, 0x074E9AF, 0x0760465, 0x0760485, 0x0760493,
+    0x07605B3, 0x07605C4, 0x07605D3, 0x0760645, 0x0760673, 0x0760745,
+    0x076142D, 0x076142E, 0x07614B3, 0x07615D3, 0x0762485, 0x07625D4,
+    0x076269A, 0x0763C34, 0x0763C45, 0x0763C53, 0x0763DB3, 0x0763DED,
+    0x0763DF0, 0x0763E59, 0x0763E73, 0x0763EC5, 0x0763EF3, 0x0763EF9,
+    0x07654A4, 0x07654B2, 0x07654B3, 0x07654B9, 0x07655B3, 0x07655EE,
+    0x0765693, 0x0766608, 0x076852C, 0x077064C, 0x0770668, 0x0770693,
+    0x07706F3, 0x0773DA5, 0x0778493, 0x0778593, 0x0778693, 0x0778699,
+    0x0779199, 0x0779653, 0x07798B2, 0x077A5C7, 0x077B093, 0x077B0D3,
+    0x077B199, 0x077B824, 0x077B8B2, 0x077B8F3, 0x077B973, 0x077B9C1,
+    0x077BB4F, 0x077BC93, 0x077BC99, 0x077BCB9, 0x077BCD3, 0x077BCD9,
+    0x077BD73, 0x077BDD3, 0x077BE19, 0x077BE65, 0x077C8A4, 0x077C8B3,
+    0x077C8E5, 0x077CA13, 0x077CA65, 0x077D113, 0x077D281, 0x077D4E5,
+    0x077D644, 0x077D693, 0x077D699, 0x077DDD3, 0x0790453, 0x0790465,
+    0x0790485, 0x0790493, 0x07904D4, 0x079052C, 0x079052E, 0x07905B3,
+    0x07905C4, 0x07905D3, 0x07905D4, 0x0790605, 0x0790608, 0x0790670,
+    0x0790673, 0x0790685, 0x07906C5, 0x07906D9, 0x0790733, 0x0790745,
+    0x0791434, 0x0791445, 0x07914A4, 0x07914AE, 0x07914B4, 0x0791613,
+    0x0791733, 0x0792493, 0x07924A6, 0x079258C, 0x07925A5, 0x07925B9,
+    0x07925C4, 0x07925D3, 0x07925F4, 0x0792605, 0x0792613, 0x0792674,
+    0x0792693, 0x0793C2E, 0x0793C34, 0x0793D2E, 0x0793D73, 0x0793DED,
+    0x0793E05, 0x0793E73, 0x0793EB0, 0x0793EB4, 0x0793EC5, 0x0793EEC,
+    0x0793EEE, 0x0793EF3, 0x0795453, 0x07954AC, 0x07954B3, 0x07954C6,
+    0x07955A5, 0x07955B0, 0x07955D4, 0x07A85CF, 0x07A8644, 0x07A86C1,
+    0x07A9673, 0x07A9674, 0x07A98D3, 0x07AA485, 0x07AA584, 0x07AA585,
+    0x07AA594, 0x07AA665, 0x07AB027, 0x07AB068, 0x07AB0D3, 0x07AB193,
+    0x07AB199, 0x07AB213, 0x07AB44F, 0x07AB5B9, 0x07AB8E5, 0x07AB8F9,
+    0x07AB973, 0x07AB979, 0x07AB9D9, 0x07ABB21, 0x07AC219, 0x07ACAB3,
+    0x07ACD19, 0x07ACE79, 0x07ACE8F, 0x07ACE93, 0x07ACE99, 0x07AD279,
+    0x07AD281, 0x07AD299, 0x07AE4A4, 0x07AE4B2, 0x07C88A4, 0x07C88B3,
+    0x07CC279, 0x07CC9F3, 0x07CD8A4, 0x07CD8B3, 0x07D2613, 0x0808934,
+    0x0808D73, 0x08090B3, 0x0809274, 0x08095B3, 0x0809A93, 0x080A575,
+    0x080A593, 0x080A653, 0x080A659, 0x080A949, 0x080ACB3, 0x080B02C,
+    0x080B0A4, 0x080B0B2, 0x080B0B3, 0x080B18F, 0x080B193, 0x080B1EE,
+    0x080B1F3, 0x080B293, 0x080B2C5, 0x080B4B3, 0x080B5B9, 0x080B893,
+    0x080B899, 0x080B8E9, 0x080B8F3, 0x080B973, 0x080B979, 0x080C199,
+    0x080C219, 0x080C893, 0x080C899, 0x080C8A4, 0x080C8AD, 0x080C8B3,
+    0x080C973, 0x080C9B3, 0x080CA13, 0x080CA19, 0x080CA59, 0x080CA68,
+    0x080CA93, 0x080CE13, 0x080CE85, 0x080CE99, 0x080D068, 0x080D0A4,
+    0x080D0B2, 0x080D0B3, 0x080D593, 0x080D5D4, 0x080D8AE, 0x080D8B2,
+    0x080D8B3, 0x080D9E3, 0x080DCA4, 0x080DD73, 0x080E4A4, 0x080E4B2,
+    0x080E8A4, 0x080E8AC, 0x080E8B2, 0x080E8B3, 0x0824653, 0x0828493,
+    0x0828499, 0x0828593, 0x0828613, 0x0828644, 0x0828653, 0x0828654,
+    0x0828688, 0x0828693, 0x08286C5, 0x08286D9, 0x08290E5, 0x0829493,
+    0x0829593, 0x0829A93, 0x0829A99, 0x082A4E8, 0x082A653, 0x082A674,
+    0x082B138, 0x082B18F, 0x082B193, 0x082B1B3, 0x082B1F4, 0x082B213,
+    0x082B2C5, 0x082B613, 0x082B865, 0x082B8E5, 0x082B9C1, 0x082BA59,
+    0x082C853, 0x082C859, 0x082C893, 0x082C9EE, 0x082CA9A, 0x082DCA4,
+    0x082DCB2, 0x082E0A4, 0x082E0B2, 0x082E0B3, 0x0848D73, 0x08490A4,
+    0x08490B2, 0x08490B3, 0x08490B9, 0x0849D13, 0x0849D14, 0x084ACA4,
+    0x084ACB2, 0x084ACB3, 0x084B193, 0x084B199, 0x084B293, 0x084B893,
+    0x084B8E5, 0x084B8F3, 0x084BA93, 0x084C20F, 0x084C219, 0x084C8A4,
+    0x084C8B2, 0x084C8B3, 0x084D068, 0x084D8A4, 0x084D8B3, 0x0878644,
+    0x0878659, 0x0878859, 0x08789F3, 0x0878D73, 0x0878EB3, 0x08790E5,
+    0x0879653, 0x0879C2E, 0x087A46B, 0x087A674, 0x087A699, 0x087ACA4,
+    0x087ACB3, 0x087ACB9, 0x087AEAD, 0x087B093, 0x087B0A4, 0x087B0B3,
+    0x087B0B9, 0x087B199, 0x087B4A4, 0x087B4B2, 0x087B4B3, 0x087B4B9,
+    0x087B5F3, 0x087B8A4, 0x087B8B2, 0x087B8B3, 0x087B8B9, 0x087B973,
+    0x087B979, 0x087B9F2, 0x087BC68, 0x087BC93, 0x087BC99, 0x087BCB9,
+    0x087BCD3, 0x087BD73, 0x087BD79, 0x087BDD3, 0x087BE13, 0x087BE93,
+    0x087C0A4, 0x087C0B2, 0x087C0B3, 0x087C833, 0x087C885, 0x087C9D3,
+    0x087C9D9, 0x087CA65, 0x087CA79, 0x087CCA4, 0x087CCB3, 0x087CE93,
+    0x087D0AC, 0x087D199, 0x087D299, 0x087D4E8, 0x087D5C4, 0x087D649,
+    0x087D653, 0x087D665, 0x087D8AC, 0x087D8B2, 0x087DC99, 0x087DD93,
+    0x08A5213, 0x08A8859, 0x08A98D3, 0x08A98D9, 0x08A9CB2, 0x08AB033,
+    0x08AB173, 0x08AB18F, 0x08AB193, 0x08AB42E, 0x08AB524, 0x08AB5F2,
+    0x08AB608, 0x08AB613, 0x08AB619, 0x08AB6B3, 0x08AB868, 0x08AB973,
+    0x08AB979, 0x08ABA93, 0x08AC993, 0x08AC999, 0x08ACA59, 0x08ACA93,
+    0x08ACD73, 0x08ACD79, 0x08ACE79, 0x08AD068, 0x08C9241, 0x08C924F,
+    0x08C95C1, 0x08CA5C7, 0x08CB4AE, 0x08CB5D3, 0x08CC0A4, 0x08CC0B2,
+    0x08CC0B3, 0x08CC1F3, 0x08CC838, 0x090B449, 0x090B453, 0x091A4B2,
+    0x091A599, 0x091A5C7, 0x091BDD3, 0x091D2B3, 0x092142C, 0x0921433,
+    0x09225ED, 0x09225F4, 0x09230A4, 0x09230B2, 0x09230B3, 0x0923D93,
+    0x092658C, 0x093B1EF, 0x09616AD, 0x0962423, 0x09626AD, 0x09632B3,
+    0x09684E5, 0x09684EF, 0x09685B3, 0x0968AA5, 0x096C0A4, 0x096C0AC,
+    0x096C0B2, 0x096C199, 0x09705C5, 0x0970614, 0x09709F8, 0x0970CA4,
+    0x0970EB2, 0x09710B8, 0x0971125, 0x0971614, 0x0971654, 0x09718B2,
+    0x0971938, 0x09719F3, 0x0971A41, 0x0971DF4, 0x0972CA4, 0x0972CB2,
+    0x0973039, 0x09730B4, 0x09738B2, 0x0973934, 0x09742B4, 0x0974CB4,
+    0x0974E92, 0x09750B2, 0x0975241, 0x097524F, 0x0975645, 0x0978E8C,
+    0x097B82C, 0x097B923, 0x097D033, 0x09841EE, 0x0990685, 0x09925C7,
+    0x0992CA4, 0x0993DD3, 0x0993DD9, 0x099B0B3, 0x099B0B4, 0x099CEA5,
+    0x09A0D19, 0x09A15B3, 0x09B24A4, 0x09B24B3, 0x09B3E59, 0x0A089F4,
+    0x0A08D73, 0x0A090A4, 0x0A090B3, 0x0A098C1, 0x0A09CF9, 0x0A0A593,
+    0x0A0B453, 0x0A0B5B9, 0x0A0C02E, 0x0A0C0A4, 0x0A0C0B3, 0x0A0D1F3,
+    0x0A0D5D4, 0x0A0DCA4, 0x0A0EB59, 0x0A285D3, 0x0A29613, 0x0A29653,
+    0x0A29745, 0x0A2B18F, 0x0A2B193, 0x0A2B199, 0x0A2B5B9, 0x0A2B9D9,
+    0x0A2C973, 0x0A2C979, 0x0A2CA59, 0x0A2CE93, 0x0A2D299, 0x0A2DCAC,
+    0x0A488A4, 0x0A488B3, 0x0A498D3, 0x0A498D9, 0x0A4A024, 0x0A4B293,
+    0x0A4B5B9, 0x0A4B8EF, 0x0A4B973, 0x0A4B9C9, 0x0A4B9D3, 0x0A4D275,
+    0x0A4D8A4, 0x0A4D8B3, 0x0A78D73, 0x0A79733, 0x0A7A1D3, 0x0A7A5D3,
+    0x0A7A5D4, 0x0A7A674, 0x0A7ACA4, 0x0A7ACB2, 0x0A7ACB3, 0x0A7ACB9,
+    0x0A7B199, 0x0A7B293, 0x0A7B8E7, 0x0A7D585, 0x0A7D674, 0x0A7DD93,
+    0x0A7DD99, 0x0A7E4A4, 0x0AA90E5, 0x0AA91F3, 0x0AAA465, 0x0AAA479,
+    0x0AAB0B0, 0x0AAB44F, 0x0AAB613, 0x0AAB619, 0x0AAB86F, 0x0AAB973,
+    0x0AAB979, 0x0AABA81, 0x0AAC9F2, 0x0AACE93, 0x0AAD0B3, 0x0B089E2,
+    0x0B0B0B3, 0x0B0B949, 0x0B0BDD3, 0x0B0C1EB, 0x0B0C201, 0x0B0C2B4,
+    0x0B0C834, 0x0B0C9A1, 0x0B0CA93, 0x0B0D649, 0x0B0E42B, 0x0B0E5F3,
+    0x0B0E9EF, 0x0B16685, 0x0B28822, 0x0B29593, 0x0B295D3, 0x0B29613,
+    0x0B2B213, 0x0B2B88F, 0x0B2C133, 0x0B2C853, 0x0B2D068, 0x0B2E4A4,
+    0x0B2E4B2, 0x0B40569, 0x0B405D3, 0x0B48D73, 0x0B48D79, 0x0B4908F,
+    0x0B4ACB3, 0x0B4B193, 0x0B4B1D3, 0x0B4B1F3, 0x0B4B293, 0x0B4B881,
+    0x0B4B893, 0x0B4B8B3, 0x0B4B8F3, 0x0B4B973, 0x0B4B979, 0x0B4BE6B,
+    0x0B4C973, 0x0B4D0A4, 0x0B4D0B2, 0x0B4D0B3, 0x0B4D113, 0x0B4D299,
+    0x0B4DD33, 0x0B654E5, 0x0B6569A, 0x0B7046B, 0x0B706C5, 0x0B71424,
+    0x0B714A4, 0x0B714AC, 0x0B714B3, 0x0B7158C, 0x0B71594, 0x0B7246B,
+    0x0B724C5, 0x0B72668, 0x0B72693, 0x0B73C53, 0x0B73C6B, 0x0B73D8C,
+    0x0B73E93, 0x0B73EEE, 0x0B73EF3, 0x0B7564C, 0x0B78581, 0x0B785D3,
+    0x0B7B033, 0x0B7BD73, 0x0B7BD79, 0x0B7C9A1, 0x0B9042C, 0x0B904D4,
+    0x0B906B4, 0x0B9258C, 0x0B93DC1, 0x0B93DC5, 0x0BA91F3, 0x0BA9355,
+    0x0BCB0B3, 0x0BCB125, 0x0BCD48F, 0x0C088AC, 0x0C08921, 0x0C089F2,
+    0x0C08CA4, 0x0C08CB2, 0x0C08CB3, 0x0C08D73, 0x0C090A4, 0x0C090AE,
+    0x0C090B3, 0x0C09185, 0x0C09CB2, 0x0C0A644, 0x0C0A653, 0x0C0A699,
+    0x0C0ACB3, 0x0C0B433, 0x0C0B453, 0x0C0B4A4, 0x0C0B4B2, 0x0C0B4B3,
+    0x0C0B613, 0x0C0B829, 0x0C0B865, 0x0C0B893, 0x0C0B8B3, 0x0C0B979,
+    0x0C0C0AC, 0x0C0C12E, 0x0C0C133, 0x0C0C265, 0x0C0C868, 0x0C0C893,
+    0x0C0C899, 0x0C0C8E5, 0x0C0C8EF, 0x0C0C973, 0x0C0CAC1, 0x0C0CCA4,
+    0x0C0CCB2, 0x0C0CCB3, 0x0C0CE6F, 0x0C0CE93, 0x0C0D068, 0x0C0D0B2,
+    0x0C0D0B8, 0x0C0D105, 0x0C0D113, 0x0C0D285, 0x0C0D493, 0x0C0D4E8,
+    0x0C0D833, 0x0C0D8A4, 0x0C0D8B3, 0x0C0DDD3, 0x0C0E0B2, 0x0C0E0B3,
+    0x0C0E199, 0x0C0E4B2, 0x0C0E6B0, 0x0C0E8A4, 0x0C0E8B3, 0x0C28468,
+    0x0C28493, 0x0C284D3, 0x0C284D9, 0x0C28573, 0x0C28579, 0x0C285D3,
+    0x0C285D4, 0x0C28613, 0x0C28614, 0x0C2864E, 0x0C28665, 0x0C28668,
+    0x0C28674, 0x0C286C5, 0x0C290E5, 0x0C29468, 0x0C29573, 0x0C29653,
+    0x0C29659, 0x0C29A93, 0x0C29A99, 0x0C29C2C, 0x0C29CF9, 0x0C29D34,
+    0x0C2B5A1, 0x0C2B5A5, 0x0C2B5EE, 0x0C2B6B2, 0x0C2B893, 0x0C2BA8F,
+    0x0C2C0B2, 0x0C2C281, 0x0C2CC4F, 0x0C2D2B0, 0x0C2D8A5, 0x0C2D8AC,
+    0x0C2D8B2, 0x0C2DD33, 0x0C2E0B2, 0x0C2E0B3, 0x0C2E133, 0x0C485C1,
+    0x0C485C5, 0x0C48653, 0x0C488AC, 0x0C48A41, 0x0C48CB4, 0x0C48D34,
+    0x0C48D73, 0x0C491F3, 0x0C494E5, 0x0C495D3, 0x0C496B4, 0x0C496B8,
+    0x0C498B2, 0x0C49A93, 0x0C49D14, 0x0C4ACA4, 0x0C4ACAE, 0x0C4ACB2,
+    0x0C4ACB3, 0x0C4B023, 0x0C4B199, 0x0C4B1F3, 0x0C4B293, 0x0C4B44F,
+    0x0C4B453, 0x0C4B4A4, 0x0C4B4B3, 0x0C4B4B9, 0x0C4B534, 0x0C4B5D3,
+    0x0C4B5F3, 0x0C4B613, 0x0C4B8A4, 0x0C4B8AE, 0x0C4B8B2, 0x0C4B8B3,
+    0x0C4B8EF, 0x0C4B8F3, 0x0C4B973, 0x0C4BA93, 0x0C4BA99, 0x0C4BDD3,
+    0x0C4C124, 0x0C4C219, 0x0C4CD85, 0x0C4CE13, 0x0C4CE93, 0x0C4D0B2,
+    0x0C4D0B3, 0x0C4D105, 0x0C4D245, 0x0C4D8A4, 0x0C4D8AE, 0x0C4D8B2,
+    0x0C4D8B3, 0x0C4D924, 0x0C605A1, 0x0C605CF, 0x0C78493, 0x0C784D3,
+    0x0C785B3, 0x0C785B9, 0x0C785D3, 0x0C78688, 0x0C78832, 0x0C78859,
+    0x0C788A4, 0x0C788B3, 0x0C78C2C, 0x0C78D13, 0x0C78D73, 0x0C78DF3,
+    0x0C78EAD, 0x0C78EB3, 0x0C790B3, 0x0C790E5, 0x0C79A93, 0x0C79A99,
+    0x0C79CB3, 0x0C79D21, 0x0C79D23, 0x0C79D2E, 0x0C79DEE, 0x0C79DF3,
+    0x0C7A5D3, 0x0C7B193, 0x0C7B199, 0x0C7B8B2, 0x0C7B8F3, 0x0C7BD73,
+    0x0C7BDB3, 0x0C7BDD3, 0x0C7BDD9, 0x0C7BE13, 0x0C7BE19, 0x0C7BE65,
+    0x0C7BE93, 0x0C7C0A4, 0x0C7C0B2, 0x0C7C0B3, 0x0C7C893, 0x0C7C8B3,
+    0x0C7C933, 0x0C7CA59, 0x0C7CCB2, 0x0C7CCB3, 0x0C7CE79, 0x0C7D28F,
+    0x0C7D2B3, 0x0C7D4E8, 0x0C7D605, 0x0C7D653, 0x0C7D665, 0x0C7D679,
+    0x0C7D693, 0x0C7D8A4, 0x0C7D8B2, 0x0C7D8B3, 0x0C7D8B9, 0x0C7DCA4,
+    0x0C7DCB2, 0x0C7DD99, 0x0C7E42C, 0x0CA86B3, 0x0CA88A4, 0x0CA88B3,
+    0x0CA8A41, 0x0CA8D24, 0x0CA8D73, 0x0CA8D79, 0x0CA8E45, 0x0CA9123,
+    0x0CA98D3, 0x0CA9CB2, 0x0CA9CB3, 0x0CAB193, 0x0CAB2B3, 0x0CAB4AE,
+    0x0CAB613, 0x0CAB619, 0x0CAB832, 0x0CAB868, 0x0CAB8E5, 0x0CAB8F3,
+    0x0CAC12E, 0x0CAC2B3, 0x0CAC868, 0x0CAC8A4, 0x0CAC8B2, 0x0CAC8B3,
+    0x0CAC8B8, 0x0CAC8F9, 0x0CAC924, 0x0CAC973, 0x0CACE93, 0x0CACE99,
+    0x0CAD0A4, 0x0CAD0B3, 0x0CAE0B3, 0x0CC5929, 0x0CC8CA5, 0x0CCA5C7,
+    0x0CCB608, 0x0CCB868, 0x0CCC8B3, 0x0CCC923, 0x0CCD123, 0x0D08C37,
+    0x0D08CA4, 0x0D08CB2, 0x0D08CB3, 0x0D08D0F, 0x0D08E4F, 0x0D0902D,
+    0x0D09199, 0x0D09921, 0x0D09923, 0x0D09CB3, 0x0D09D23, 0x0D09DA1,
+    0x0D09EB3, 0x0D0A493, 0x0D0A593, 0x0D0A5B3, 0x0D0A5D3, 0x0D0A745,
+    0x0D0A9F2, 0x0D0ACB2, 0x0D0ACB3, 0x0D0B032, 0x0D0B0B3, 0x0D0B193,
+    0x0D0B293, 0x0D0B299, 0x0D0B433, 0x0D0B441, 0x0D0B44F, 0x0D0B5A1,
+    0x0D0B5B9, 0x0D0B8A4, 0x0D0B8B3, 0x0D0B8E1, 0x0D0B8E5, 0x0D0B8EF,
+    0x0D0B8F9, 0x0D0B921, 0x0D0B923, 0x0D0B979, 0x0D0B999, 0x0D0B9C1,
+    0x0D0B9F2, 0x0D0BA65, 0x0D0BA81, 0x0D0C185, 0x0D0C825, 0x0D0C833,
+    0x0D0C868, 0x0D0C8B3, 0x0D0C8E5, 0x0D0C921, 0x0D0C973, 0x0D0C993,
+    0x0D0CA59, 0x0D0CA68, 0x0D0CA93, 0x0D0CCB2, 0x0D0CD73, 0x0D0CDEE,
+    0x0D0CE93, 0x0D0D029, 0x0D0D068, 0x0D0D0A4, 0x0D0D0B2, 0x0D0D0B3,
+    0x0D0D0B9, 0x0D0D113, 0x0D0D285, 0x0D0D34F, 0x0D0D593, 0x0D0D6C5,
+    0x0D0D8AE, 0x0D0DCA4, 0x0D0E0A4, 0x0D0E0B3, 0x0D0E12D, 0x0D0E133,
+    0x0D0E445, 0x0D0E5F2, 0x0D0E674, 0x0D0E8A4, 0x0D0E8B2, 0x0D0E8B3,
+    0x0D28493, 0x0D28593, 0x0D28599, 0x0D285D3, 0x0D285D4, 0x0D285D9,
+    0x0D28693, 0x0D28699, 0x0D28C61, 0x0D2902C, 0x0D29121, 0x0D29123,
+    0x0D29493, 0x0D29693, 0x0D2B093, 0x0D2B0A5, 0x0D2B1EE, 0x0D2B293,
+    0x0D2B4B3, 0x0D2B5F3, 0x0D2B893, 0x0D2BAB3, 0x0D2BEF3, 0x0D2C879,
+    0x0D2C8B2, 0x0D2C8B3, 0x0D2C8E5, 0x0D2C934, 0x0D2CA59, 0x0D2CC33,
+    0x0D2CDEE, 0x0D2CE79, 0x0D2D02C, 0x0D2D0A4, 0x0D2D0B2, 0x0D2D0B3,
+    0x0D2D113, 0x0D2D245, 0x0D2D24F, 0x0D2DCA4, 0x0D2DD93, 0x0D2EB4F,
+    0x0D48C33, 0x0D48D73, 0x0D48E4F, 0x0D49099, 0x0D490E5, 0x0D49133,
+    0x0D49274, 0x0D495D3, 0x0D498D3, 0x0D49D14, 0x0D4ACA4, 0x0D4ACB3,
+    0x0D4B068, 0x0D4B093, 0x0D4B0B2, 0x0D4B0B3, 0x0D4B0D3, 0x0D4B173,
+    0x0D4B179, 0x0D4B193, 0x0D4B293, 0x0D4B4A4, 0x0D4B4AF, 0x0D4B4B2,
+    0x0D4B4B3, 0x0D4B523, 0x0D4B833, 0x0D4B865, 0x0D4B893, 0x0D4B8A4,
+    0x0D4B8B2, 0x0D4B8B3, 0x0D4B8F9, 0x0D4B92D, 0x0D4B933, 0x0D4B965,
+    0x0D4B973, 0x0D4B9F2, 0x0D4BA93, 0x0D4BA99, 0x0D4BAB3, 0x0D4C8A4,
+    0x0D4C8B3, 0x0D4CA88, 0x0D4CC8F, 0x0D4CCB2, 0x0D4CCB3, 0x0D4CE93,
+    0x0D4CE99, 0x0D4D0B2, 0x0D4D0B3, 0x0D4D245, 0x0D4D293, 0x0D4E0A4,
+    0x0D4E0B2, 0x0D4E0B3, 0x0D785D3, 0x0D78693, 0x0D78D01, 0x0D78D73,
+    0x0D7902C, 0x0D790AC, 0x0D790AD, 0x0D790B3, 0x0D792B3, 0x0D79CF9,
+    0x0D79EAC, 0x0D7A593, 0x0D7A645, 0x0D7A674, 0x0D7B02C, 0x0D7B032,
+    0x0D7B093, 0x0D7B099, 0x0D7B0B3, 0x0D7B193, 0x0D7B199, 0x0D7B293,
+    0x0D7B5A1, 0x0D7B5B9, 0x0D7B824, 0x0D7B8B9, 0x0D7B8F3, 0x0D7B973,
+    0x0D7B9F3, 0x0D7BA88, 0x0D7BC68, 0x0D7BC93, 0x0D7BC99, 0x0D7BCA4,
+    0x0D7BDD3, 0x0D7BE53, 0x0D7BE65, 0x0D7BE93, 0x0D7C0A4, 0x0D7C0B2,
+    0x0D7C0B3, 0x0D7C0B9, 0x0D7C82C, 0x0D7C839, 0x0D7C8AC, 0x0D7C8B3,
+    0x0D7C9D3, 0x0D7C9EE, 0x0D7CA08, 0x0D7CCB9, 0x0D7CE79, 0x0D7D0AC,
+    0x0D7D0B3, 0x0D7D0B4, 0x0D7D113, 0x0D7D126, 0x0D7D1F2, 0x0D7D28F,
+    0x0D7D4A4, 0x0D7D4B3, 0x0D7D584, 0x0D7D594, 0x0D7D5C4, 0x0D7D5D4,
+    0x0D7D64E, 0x0D7D665, 0x0D7D679, 0x0D7D688, 0x0D7D8A4, 0x0D7D8B2,
+    0x0D7D8B3, 0x0D7D925, 0x0D7DCA4, 0x0D7DCB2, 0x0D7E125, 0x0DA8D73,
+    0x0DA8D79, 0x0DA8EB3, 0x0DA9099, 0x0DA98D3, 0x0DA9A89, 0x0DA9CF9,
+    0x0DAB068, 0x0DAB074, 0x0DAB0A4, 0x0DAB0B3, 0x0DAB193, 0x0DAB289,
+    0x0DAB44F, 0x0DAB5B9, 0x0DAB613, 0x0DAB868, 0x0DAB8E1, 0x0DAB8E5,
+    0x0DAB8F3, 0x0DABDD3, 0x0DAC82C, 0x0DAC973, 0x0DAC979, 0x0DACA49,
+    0x0DACCA4, 0x0DACCB2, 0x0DACCB3, 0x0DACD19, 0x0DACD23, 0x0DACD79,
+    0x0DACE79, 0x0DACE93, 0x0DACE99, 0x0DAD0A4, 0x0DAD0B2, 0x0DAD0B3,
+    0x0DAD293, 0x0DAE82B, 0x0DAEB59, 0x0DCB828, 0x0DCB833, 0x0DCCA48,
+    0x0DCD113, 0x0E085D3, 0x0E089E2, 0x0E08D0F, 0x0E08E45, 0x0E09132,
+    0x0E0A424, 0x0E0A4D3, 0x0E0A593, 0x0E0A6C5, 0x0E0ACA4, 0x0E0B459,
+    0x0E0B4A4, 0x0E0B4B2, 0x0E0B4B3, 0x0E0B9D9, 0x0E0C0B3, 0x0E0C219,
+    0x0E0C873, 0x0E0C973, 0x0E0C979, 0x0E0CC2C, 0x0E0CE99, 0x0E0D02C,
+    0x0E0D068, 0x0E0D299, 0x0E0D82C, 0x0E0D8AC, 0x0E0D8B3, 0x0E0D927,
+    0x0E0DAD9, 0x0E28613, 0x0E28653, 0x0E28688, 0x0E28D73, 0x0E29493,
+    0x0E29499, 0x0E29613, 0x0E29E4F, 0x0E2A4E8, 0x0E2BDD3, 0x0E2C893,
+    0x0E2C899, 0x0E2CAC5, 0x0E2CAD9, 0x0E2CE93, 0x0E2D293, 0x0E2D8B2,
+    0x0E2DAB3, 0x0E2DCAC, 0x0E2DCB2, 0x0E2DD99, 0x0E2DE79, 0x0E2DE93,
+    0x0E2E2B3, 0x0E48CB2, 0x0E48D05, 0x0E48D73, 0x0E49465, 0x0E498D9,
+    0x0E49A99, 0x0E49CE1, 0x0E49D14, 0x0E4B199, 0x0E4B449, 0x0E4B459,
+    0x0E4B8B3, 0x0E4B941, 0x0E4B9D9, 0x0E4BA88, 0x0E4C219, 0x0E4CCA9,
+    0x0E4D0B2, 0x0E4D124, 0x0E4D245, 0x0E4D24F, 0x0E4E0A4, 0x0E4E0B3,
+    0x0E78985, 0x0E78999, 0x0E78D73, 0x0E7902C, 0x0E79099, 0x0E790B3,
+    0x0E79593, 0x0E7A1F7, 0x0E7A645, 0x0E7A653, 0x0E7A665, 0x0E7A679,
+    0x0E7B424, 0x0E7B865, 0x0E7B8B3, 0x0E7B8F3, 0x0E7BC53, 0x0E7BD73,
+    0x0E7BD79, 0x0E7BDD3, 0x0E7BE65, 0x0E7C9B3, 0x0E7CA88, 0x0E7CCA4,
+    0x0E7CCB3, 0x0E7CCB9, 0x0E7D068, 0x0E7D0A4, 0x0E7D0B3, 0x0E7D5D3,
+    0x0E7D825, 0x0E7D833, 0x0E7D8AC, 0x0E7DC39, 0x0E93CC6, 0x0EA8859,
+    0x0EA90B2, 0x0EA90B3, 0x0EA90E5, 0x0EAACA4, 0x0EAACB3, 0x0EAB193,
+    0x0EAB453, 0x0EACA65, 0x0EAD299, 0x0ECB1EE, 0x0ECB608, 0x0F0ACA4,
+    0x0F0ACAE, 0x0F0AEAD, 0x0F0C8A4, 0x0F0CCB3, 0x0F0CD33, 0x0F0D0AE,
+    0x0F0D113, 0x0F11665, 0x0F11733, 0x0F12693, 0x0F13CB3, 0x0F18EB2,
+    0x0F1942E, 0x0F1A0B2, 0x0F1A245, 0x0F1ACB2, 0x0F1D02C, 0x0F1D0B4,
+    0x0F210B2, 0x0F21199, 0x0F226AD, 0x0F23E53, 0x0F23EB2, 0x0F28EB3,
+    0x0F3182C, 0x0F318A4, 0x0F318B2, 0x0F350AE, 0x0F3A6C5, 0x0F3B0A4,
+    0x0F3B0B2, 0x0F3B0B3, 0x0F3C8B3, 0x0F425C7, 0x0F43523, 0x0F4B0A4,
+    0x0F4B0B2, 0x0F4B973, 0x0F58609, 0x0F58733, 0x0F5C833, 0x0F610AE,
+    0x0F610B2, 0x0F61125, 0x0F615F3, 0x0F626C5, 0x0F63CF9, 0x0F694E1,
+    0x0F695D3, 0x0F6A693, 0x0F70CB2, 0x0F71645, 0x0F725EE, 0x0F74CB4,
+    0x0F7A0A4, 0x0F7B608, 0x0F7E8A4, 0x0F7E8B3, 0x0F80593, 0x0F815D3,
+    0x0F81641, 0x0F825C5, 0x0F825C7, 0x0F826AD, 0x0F850A4, 0x0F85123,
+    0x0F90593, 0x0F905C7, 0x0F90685, 0x0F908A4, 0x0F90934, 0x0F90C33,
+    0x0F910B2, 0x0F91C2E, 0x0F924AC, 0x0F94933, 0x0F9510F, 0x0F9A4B2,
+    0x0FA20B2, 0x0FA50B2, 0x0FA9D14, 0x0FAB865, 0x0FACE93, 0x0FAD08F,
+    0x0FAD0A4, 0x0FAD0B2, 0x0FAD0EF, 0x0FAD245, 0x0FAD281, 0x0FAE9F3,
+    0x0FB0593, 0x0FB0659, 0x0FB0685, 0x0FB15D3, 0x0FB1653, 0x0FB1654,
+    0x0FB3D24, 0x0FB5585, 0x0FB55B3, 0x0FBA5C7, 0x0FBB0B4, 0x0FBB8A4,
+    0x0FBB8B2, 0x0FC09F7, 0x0FC2485, 0x0FD3DC5, 0x1008CA4, 0x1008CAD,
+    0x1008CB2, 0x1008CB3, 0x1008CB9, 0x1008D73, 0x1008E93, 0x1009099,
+    0x1009245, 0x100942E, 0x1009C2E, 0x1009CA4, 0x1009CB2, 0x1009CB3,
+    0x100A593, 0x100A5D3, 0x100A5D4, 0x100A653, 0x100B0A1, 0x100B0A4,
+    0x100B0B2, 0x100B0B3, 0x100B193, 0x100B199, 0x100B1B3, 0x100B1B9,
+    0x100B209, 0x100B213, 0x100B279, 0x100B459, 0x100B838, 0x100B881,
+    0x100B8A4, 0x100B8AC, 0x100B8B3, 0x100B8F3, 0x100B923, 0x100B979,
+    0x100BA79, 0x100BA8F, 0x100BA93, 0x100C02C, 0x100C033, 0x100C037,
+    0x100C0B2, 0x100C209, 0x100C219, 0x100C833, 0x100C868, 0x100C8A4,
+    0x100C8B2, 0x100C8B3, 0x100C961, 0x100C973, 0x100C979, 0x100CA59,
+    0x100CA65, 0x100CA93, 0x100CA99, 0x100CD01, 0x100CE65, 0x100CE81,
+    0x100CE85, 0x100CE93, 0x100CE99, 0x100D068, 0x100D0AE, 0x100D0B2,
+    0x100D0B3, 0x100D113, 0x100D12F, 0x100D279, 0x100D299, 0x100D665,
+    0x100D8A4, 0x100D8B2, 0x100D8B3, 0x100DCA4, 0x100DD93, 0x100DDD3,
+    0x100E0B3, 0x100E4A4, 0x100E4A5, 0x100E4B2, 0x1028465, 0x1028468,
+    0x1028573, 0x1028579, 0x1028593, 0x102864C, 0x1028653, 0x1028693,
+    0x1028699, 0x1028C2E, 0x1028D73, 0x102902C, 0x1029573, 0x1029593,
+    0x10295D3, 0x1029613, 0x1029619, 0x1029653, 0x10296C5, 0x1029CF9,
+    0x102ACB3, 0x102ADE5, 0x102B293, 0x102B82C, 0x102B865, 0x102B893,
+    0x102B933, 0x102B9C5, 0x102B9D9, 0x102BA93, 0x102BDD3, 0x102BDD9,
+    0x102C219, 0x102C868, 0x102C92C, 0x102C973, 0x102C979, 0x102C9B3,
+    0x102CA59, 0x102CA93, 0x102CAD3, 0x102CD79, 0x102CDF3, 0x102CE8F,
+    0x102CE93, 0x102D02C, 0x102D0B2, 0x102D299, 0x102DCA5, 0x102DD34,
+    0x10404E5, 0x1040665, 0x10416F3, 0x104242C, 0x1042668, 0x10431F8,
+    0x1043DC5, 0x1043DD9, 0x1043E8F, 0x1046581, 0x10485CF, 0x1048C33,
+    0x1048D73, 0x1048D79, 0x1048DF4, 0x1049465, 0x1049653, 0x1049699,
+    0x1049CF9, 0x104A5C7, 0x104ACA4, 0x104ACB2, 0x104ACB3, 0x104B026,
+    0x104B0A4, 0x104B0B3, 0x104B193, 0x104B1F4, 0x104B613, 0x104B865,
+    0x104B868, 0x104B8A4, 0x104B8B3, 0x104B8B9, 0x104B8F3, 0x104B96F,
+    0x104B973, 0x104B979, 0x104B9C1, 0x104B9D9, 0x104B9EE, 0x104BA8F,
+    0x104BA93, 0x104BAB0, 0x104BDD3, 0x104BEB3, 0x104C0A4, 0x104C0B2,
+    0x104C0B3, 0x104C0B4, 0x104C134, 0x104C6A5, 0x104C973, 0x104CE79,
+    0x104CE85, 0x104D033, 0x104D068, 0x104D113, 0x104D119, 0x104D1EE,
+    0x104D281, 0x104D9F4, 0x104E0AC, 0x104E125, 0x104EB41, 0x1060465,
+    0x10604E5, 0x1060524, 0x106052E, 0x1060534, 0x10605C5, 0x10605CB,
+    0x10605D3, 0x10605D4, 0x1060668, 0x106066D, 0x1060685, 0x1060693,
+    0x1060699, 0x1060733, 0x1060741, 0x1061424, 0x1061433, 0x1061434,
+    0x1061445, 0x1061453, 0x10624A4, 0x10624B3, 0x1063C93, 0x1063DCB,
+    0x1063E13, 0x1063E93, 0x1063EF3, 0x1063F33, 0x106546B, 0x10654F3,
+    0x10655A2, 0x10655A5, 0x10655B0, 0x10655B3, 0x10655B9, 0x10655CB,
+    0x1065668, 0x1078468, 0x1078D73, 0x1078EB3, 0x10790F9, 0x10795B3,
+    0x1079679, 0x1079693, 0x107A5D4, 0x107A665, 0x107ACA4, 0x107ACB2,
+    0x107ACB3, 0x107ACB9, 0x107B032, 0x107B0A4, 0x107B0B2, 0x107B0B3,
+    0x107B12F, 0x107B161, 0x107B193, 0x107B1F3, 0x107B330, 0x107B333,
+    0x107B5B9, 0x107B613, 0x107B865, 0x107B879, 0x107B893, 0x107B8B3,
+    0x107B8F3, 0x107BC68, 0x107BCA4, 0x107BCD3, 0x107BD13, 0x107BD93,
+    0x107BE13, 0x107C0B3, 0x107C201, 0x107C219, 0x107C868, 0x107C8A4,
+    0x107C8B3, 0x107C8F9, 0x107C973, 0x107C979, 0x107C9CF, 0x107C9D3,
+    0x107CA93, 0x107CCA4, 0x107CCB2, 0x107CCB3, 0x107CCB9, 0x107CD34,
+    0x107CE65, 0x107CE93, 0x107D299, 0x107D468, 0x107D4D3, 0x107D5C4,
+    0x107D653, 0x107D693, 0x107DCB2, 0x107E0B3, 0x10905B3, 0x10905C7,
+    0x10905CB, 0x1090685, 0x1090693, 0x10906EE, 0x1090733, 0x1091465,
+    0x10914AE, 0x10915B3, 0x1091613, 0x1091673, 0x1091733, 0x1092465,
+    0x109246B, 0x1092485, 0x10924A4, 0x10924B2, 0x10924B3, 0x10924F3,
+    0x10925A5, 0x10925B0, 0x10925D4, 0x10925EE, 0x10925F2, 0x1092665,
+    0x109266D, 0x10926D9, 0x1092745, 0x1093C45, 0x1093C93, 0x1093CD3,
+    0x1093D85, 0x1093DAF, 0x1093DB3, 0x1093DC5, 0x1093DC7, 0x1093DE6,
+    0x1093E13, 0x1093E65, 0x1093E79, 0x1093EA4, 0x1093EC5, 0x1093EEC,
+    0x1093EF3, 0x1093F19, 0x1095485, 0x10955C5, 0x109858D, 0x10996A4,
+    0x109A037, 0x109CE93, 0x109E468, 0x10A88B3, 0x10A8923, 0x10A8933,
+    0x10A8CB3, 0x10A8D73, 0x10A90F9, 0x10A98D3, 0x10A98D9, 0x10AACA4,
+    0x10AACB3, 0x10AAD61, 0x10AB0A4, 0x10AB0B3, 0x10AB193, 0x10AB213,
+    0x10AB219, 0x10AB265, 0x10AB433, 0x10AB613, 0x10AB868, 0x10AB973,
+    0x10AB979, 0x10ABA93, 0x10AC025, 0x10AC02C, 0x10AC12C, 0x10AC219,
+    0x10AC8A5, 0x10AC8B2, 0x10AC8E5, 0x10AC933, 0x10AC993, 0x10ACA53,
+    0x10ACA65, 0x10ACD19, 0x10ACE79, 0x10AD293, 0x10AD299, 0x10BB8A4,
+    0x10C9DB9, 0x10CB1EE, 0x10CC8B3, 0x10CE0B3, 0x10CE133, 0x10D075A,
+    0x11A846B, 0x11A8493, 0x11A84C6, 0x11A852C, 0x11A8565, 0x11A8579,
+    0x11A858D, 0x11A864B, 0x11A8654, 0x11A8668, 0x11A8669, 0x11A8733,
+    0x11A8934, 0x11A94AE, 0x11A94B2, 0x11A958C, 0x11A964E, 0x11A9659,
+    0x11A9674, 0x11A96A5, 0x11AA46B, 0x11AA493, 0x11AA4B4, 0x11AA4C6,
+    0x11AA58C, 0x11AA594, 0x11AA5C5, 0x11AA5D3, 0x11AA5D4, 0x11AA613,
+    0x11AA645, 0x11AA64B, 0x11AA654, 0x11AA685, 0x11AA693, 0x11ABD2E,
+    0x11ABD34, 0x11ABD8C, 0x11ABE81, 0x11ABE85, 0x11ABE88, 0x1208849,
+    0x1208924, 0x1208CA4, 0x1208CB2, 0x1208CB3, 0x1208D73, 0x1209032,
+    0x1209129, 0x120912F, 0x1209138, 0x12091EE, 0x1209A93, 0x1209C33,
+    0x1209CA4, 0x1209CB3, 0x1209CE1, 0x120A493, 0x120A593, 0x120A5D3,
+    0x120A5D9, 0x120A665, 0x120A828, 0x120ACA4, 0x120ACB2, 0x120ACB3,
+    0x120B199, 0x120B525, 0x120B613, 0x120B868, 0x120B899, 0x120B8A5,
+    0x120B8E5, 0x120B8F9, 0x120B973, 0x120BA93, 0x120C0A4, 0x120C0B2,
+    0x120C0B3, 0x120C124, 0x120C8A4, 0x120C8B2, 0x120C8B3, 0x120CE13,
+    0x120CE19, 0x120D0A4, 0x120D0B2, 0x120D0B3, 0x120D12F, 0x120D299,
+    0x120D8A4, 0x120D8AC, 0x120D8AE, 0x120D8B2, 0x120D8B3, 0x120DCB2,
+    0x120DD99, 0x120E4A4, 0x120E5EE, 0x120E8A4, 0x120E8B3, 0x120E9F2,
+    0x1228468, 0x1228474, 0x1228484, 0x1228493, 0x1228499, 0x122858D,
+    0x1228593, 0x12285B3, 0x1228613, 0x122864D, 0x1228653, 0x1228832,
+    0x12288AC, 0x1228924, 0x1228AB3, 0x1228AB4, 0x1228C30, 0x1228C65,
+    0x1228DEE, 0x1228E89, 0x1228E8F, 0x1228EB2, 0x1229099, 0x1229124,
+    0x1229199, 0x12291F8, 0x1229325, 0x1229493, 0x1229499, 0x12294D3,
+    0x1229573, 0x1229593, 0x12296C5, 0x12298B2, 0x1229934, 0x1229C2C,
+    0x1229CB8, 0x122A022, 0x122A4EE, 0x122A569, 0x122A5D3, 0x122A927,
+    0x122B038, 0x122B039, 0x122B123, 0x122B134, 0x122B430, 0x122B534,
+    0x122B538, 0x122B82C, 0x122B893, 0x122B8B7, 0x122BA93, 0x122BE47,
+    0x122C039, 0x122C0AC, 0x122C199, 0x122C1F3, 0x122C82E, 0x122CAAE,
+    0x122CC34, 0x122CCB4, 0x122CCB7, 0x122CD2E, 0x122CD34, 0x122CDF7,
+    0x122CE93, 0x122D068, 0x122D125, 0x122D24F, 0x122D259, 0x122D665,
+    0x122D8AC, 0x122D8B4, 0x122DAA5, 0x122DCA4, 0x1241433, 0x12415A5,
+    0x12416AD, 0x12425CF, 0x12465A5, 0x1248593, 0x1248CA4, 0x1248CB2,
+    0x1248CB3, 0x1248D73, 0x12490B2, 0x12490B3, 0x12490E5, 0x12490F9,
+    0x12498B2, 0x12498D3, 0x1249985, 0x1249A93, 0x1249D14, 0x1249D24,
+    0x1249DF2, 0x124B0A4, 0x124B0B3, 0x124B193, 0x124B4A4, 0x124B4B3,
+    0x124B893, 0x124B8F3, 0x124B973, 0x124BA65, 0x124BE93, 0x124C0AE,
+    0x124C0B2, 0x124CCAE, 0x124CCB2, 0x124CCB3, 0x124CD73, 0x124CD79,
+    0x124D0B3, 0x124D359, 0x124D82C, 0x124D8A4, 0x124D8AE, 0x124D8B2,
+    0x124D8B3, 0x124D8B4, 0x124E42C, 0x1278468, 0x1278493, 0x12785B3,
+    0x12785D3, 0x1278653, 0x1278674, 0x12788A4, 0x12788B3, 0x127892E,
+    0x12789F4, 0x1278D73, 0x1278D79, 0x12790AF, 0x1279CB2, 0x1279EA5,
+    0x127A593, 0x127B0B3, 0x127B193, 0x127B42E, 0x127B4AF, 0x127B613,
+    0x127B88F, 0x127BC93, 0x127BCD3, 0x127BD73, 0x127BDB3, 0x127BDB9,
+    0x127BE74, 0x127BE93, 0x127C0A4, 0x127C0B2, 0x127C0B3, 0x127C0B9,
+    0x127CCB3, 0x127CD2E, 0x127D033, 0x127D1F2, 0x127D4B3, 0x127D4E5,
+    0x127D4E8, 0x127D5C4, 0x127D665, 0x127D674, 0x127D685, 0x127D693,
+    0x127D8A4, 0x127D8B2, 0x127D8B3, 0x127DC2E, 0x127DC99, 0x127DCA4,
+    0x127DCAC, 0x127DCB2, 0x127E42C, 0x12A88B3, 0x12A8985, 0x12A8D05,
+    0x12A8D73, 0x12A9099, 0x12A90B2, 0x12A98D3, 0x12A9C59, 0x12AA5C7,
+    0x12AA5D3, 0x12AB0A4, 0x12AB0B2, 0x12AB0B3, 0x12AB441, 0x12AB4AE,
+    0x12AB5B9, 0x12AB5F2, 0x12AB613, 0x12AB8B3, 0x12AB8F3, 0x12AB923,
+    0x12AB9D9, 0x12ABA93, 0x12ABA99, 0x12AC0A5, 0x12AC82C, 0x12ACCB3,
+    0x12ACD19, 0x12ACD73, 0x12ACE93, 0x12ACE99, 0x12AD299, 0x13088B2,
+    0x1308985, 0x13089F4, 0x1308A41, 0x1308A45, 0x1308D73, 0x1308E41,
+    0x13090B3, 0x1309115, 0x1309199, 0x13098B2, 0x13098B3, 0x1309C33,
+    0x1309CB2, 0x1309CB3, 0x1309CF9, 0x1309DF3, 0x130A122, 0x130A593,
+    0x130A5D4, 0x130A688, 0x130ACB2, 0x130ACB3, 0x130B024, 0x130B0B3,
+    0x130B199, 0x130B1EE, 0x130B261, 0x130B293, 0x130B299, 0x130B2C5,
+    0x130B2CF, 0x130B441, 0x130B4B3, 0x130B4B9, 0x130B893, 0x130B899,
+    0x130B8B2, 0x130B8F3, 0x130C219, 0x130C82E, 0x130C8E5, 0x130C933,
+    0x130C979, 0x130CE79, 0x130D039, 0x130D0A4, 0x130D0B3, 0x130D12E,
+    0x130D332, 0x130D465, 0x130D479, 0x130D5C1, 0x130D685, 0x130D8A4,
+    0x130D8B2, 0x130D8B3, 0x130D9F2, 0x130D9F9, 0x130DAD9, 0x130DCA4,
+    0x130E0B3, 0x130E4B2, 0x1318453, 0x1318493, 0x13184F3, 0x1318584,
+    0x1318585, 0x1318590, 0x1318599, 0x13185B0, 0x13185B3, 0x13185D3,
+    0x13185D4, 0x1318605, 0x1318645, 0x1318646, 0x1318650, 0x1318653,
+    0x1318659, 0x1318693, 0x13195C5, 0x13195D4, 0x131A1AF, 0x131A2E1,
+    0x131A5EE, 0x131BCC6, 0x131BD84, 0x131BDC5, 0x131BDF0, 0x131BDF4,
+    0x131BE05, 0x131BE45, 0x131BE4E, 0x131BEB2, 0x131BEB4, 0x131BEEC,
+    0x131BEF3, 0x131C827, 0x131C82D, 0x131C830, 0x131C8A5, 0x131C8B7,
+    0x131C92D, 0x131C930, 0x131C9E4, 0x131C9E7, 0x131CAA2, 0x131CAAD,
+    0x131D441, 0x131D493, 0x131D4C6, 0x131D58C, 0x131D5B3, 0x131D646,
+    0x131D685, 0x1328593, 0x13285B3, 0x13285B9, 0x1328653, 0x1328693,
+    0x1328AAD, 0x1328E93, 0x132902E, 0x13290E5, 0x13290F9, 0x13292AD,
+    0x1329493, 0x1329499, 0x1329573, 0x13295B3, 0x1329613, 0x1329653,
+    0x1329EA5, 0x132A5C5, 0x132A745, 0x132B0D9, 0x132B193, 0x132B4AE,
+    0x132B533, 0x132B893, 0x132B9C1, 0x132B9F2, 0x132BA65, 0x132C02C,
+    0x132C121, 0x132C1F9, 0x132C281, 0x132C8B2, 0x132C8D3, 0x132C8E5,
+    0x132C926, 0x132CAAD, 0x132CAC5, 0x132CACF, 0x132D025, 0x132D02C,
+    0x132D293, 0x132D2B0, 0x132D8AE, 0x132D8B2, 0x132DCA4, 0x132DCB2,
+    0x132E0A4, 0x132E0B2, 0x132E0B3, 0x134046B, 0x1340485, 0x1340493,
+    0x1340499, 0x13404D4, 0x13404F3, 0x1340513, 0x1340565, 0x1340579,
+    0x1340585, 0x134058C, 0x1340594, 0x1340599, 0x13405A5, 0x13405B3,
+    0x13405CB, 0x1340605, 0x1340644, 0x1340645, 0x134064B, 0x1340650,
+    0x13406C5, 0x13406EC, 0x13406ED, 0x1340733, 0x1340D09, 0x1341426,
+    0x1341432, 0x1341493, 0x13414AE, 0x13414B0, 0x13414B2, 0x13414B4,
+    0x134152B, 0x1341586, 0x134158C, 0x13416EE, 0x13416F3, 0x13424A4,
+    0x13424B2, 0x13424B3, 0x13424D4, 0x134258C, 0x13425B3, 0x13425C5,
+    0x13425D3, 0x13425D9, 0x1342613, 0x1342645, 0x134264B, 0x1342652,
+    0x1342654, 0x1342693, 0x13426D3, 0x1343C2C, 0x1343C34, 0x1343C6B,
+    0x1343CB3, 0x1343DC5, 0x1343DEB, 0x1343DF3, 0x1343DF4, 0x1343E13,
+    0x1343E45, 0x1343E4E, 0x1343E54, 0x1343E93, 0x1343EB4, 0x1343EC5,
+    0x1343EEE, 0x1343EF3, 0x1343EF9, 0x13448A4, 0x13448B7, 0x1344AA2,
+    0x1344AA7, 0x134546B, 0x13455D3, 0x13455D4, 0x1345668, 0x1345693,
+    0x13464B2, 0x1346599, 0x1348B2C, 0x1348D6F, 0x1348D73, 0x13490A4,
+    0x13490B3, 0x1349185, 0x13494E5, 0x13496C5, 0x1349A93, 0x1349D13,
+    0x1349D14, 0x1349D2C, 0x1349DA1, 0x1349DD3, 0x134B173, 0x134B179,
+    0x134B193, 0x134B199, 0x134B1F3, 0x134B293, 0x134B299, 0x134B5EE,
+    0x134B865, 0x134B8B3, 0x134B8B7, 0x134B8E5, 0x134B8F3, 0x134B973,
+    0x134BAB3, 0x134C8A4, 0x134C8AE, 0x134C8B3, 0x134CC2C, 0x134CCB3,
+    0x134CE79, 0x134D032, 0x134D0A4, 0x134D0B3, 0x134E0B2, 0x134E0B3,
+    0x134E288, 0x134E299, 0x134E8A4, 0x134E8B2, 0x134E8B3, 0x1358685,
+    0x13594B4, 0x135952E, 0x13596F3, 0x135A493, 0x135A4A4, 0x135A4B2,
+    0x135A4B3, 0x135A4C6, 0x135A58C, 0x135A5B0, 0x135A5B3, 0x135A5D3,
+    0x135A5D4, 0x135A613, 0x135A654, 0x135A685, 0x135A693, 0x135A6C5,
+    0x135BC2C, 0x135D433, 0x135D58B, 0x135D58C, 0x135D5CB, 0x135E4B9,
+    0x1360453, 0x136046B, 0x13604F3, 0x136052E, 0x1360565, 0x13605B3,
+    0x13605C7, 0x13605D4, 0x1360613, 0x1360668, 0x1360685, 0x1360693,
+    0x1360699, 0x13606C5, 0x13606F3, 0x1360733, 0x1361493, 0x13614AB,
+    0x13614B0, 0x13614B4, 0x1361614, 0x13616F3, 0x1362465, 0x136246B,
+    0x1362485, 0x13624B2, 0x13625A5, 0x13625B3, 0x13625B9, 0x13625C7,
+    0x13625CB, 0x1362613, 0x1362693, 0x1363C53, 0x1363CB3, 0x1363CF3,
+    0x1363DF0, 0x1363E05, 0x1363E13, 0x1363E68, 0x1363E88, 0x1363E93,
+    0x1363EF3, 0x13654A4, 0x13654B3, 0x13654F3, 0x13655B0, 0x13655B3,
+    0x13655C7, 0x13655CB, 0x1365650, 0x1365653, 0x1365668, 0x1365693,
+    0x13664B2, 0x1366599, 0x136846B, 0x136858C, 0x1368654, 0x1368668,
+    0x1369432, 0x136958C, 0x1369594, 0x136A585, 0x136A599, 0x136A64B,
+    0x136A685, 0x136A688, 0x136BC6B, 0x136BCF3, 0x136BD65, 0x136BD6F,
+    0x136BD79, 0x136BD94, 0x136BE85, 0x136D646, 0x136D693, 0x137046B,
+    0x13704D5, 0x13704F3, 0x137052C, 0x1370565, 0x1370579, 0x1370613,
+    0x1370645, 0x1370646, 0x137064B, 0x137064C, 0x137142B, 0x13714B2,
+    0x137246B, 0x1372485, 0x13724C6, 0x1372605, 0x1372613, 0x1372693,
+    0x1373C53, 0x1373CF3, 0x1373DE4, 0x1373DEB, 0x1373DF0, 0x1373DF4,
+    0x1373E45, 0x1373E54, 0x1373E93, 0x1373EB4, 0x1373EF3, 0x1373EF9,
+    0x1375453, 0x13754C6, 0x13754F3, 0x1378573, 0x1378613, 0x1378619,
+    0x1378653, 0x13788B2, 0x1378D2F, 0x1378D73, 0x1379033, 0x1379833,
+    0x1379A99, 0x1379CF9, 0x137A593, 0x137B032, 0x137B0A4, 0x137B0B3,
+    0x137B124, 0x137B1F3, 0x137B2C5, 0x137B832, 0x137B8F3, 0x137B923,
+    0x137B9D9, 0x137BD73, 0x137BE88, 0x137BE99, 0x137C219, 0x137C8B2,
+    0x137C8B3, 0x137CA59, 0x137CA81, 0x137CA93, 0x137D4E8, 0x137D573,
+    0x137D593, 0x137D5C4, 0x137D613, 0x137D619, 0x137D653, 0x137D665,
+    0x137D688, 0x137DCA4, 0x137DCB2, 0x1380465, 0x1380485, 0x1380565,
+    0x13805B3, 0x13805CB, 0x13805D3, 0x1380645, 0x138064B, 0x1380653,
+    0x138066D, 0x1380685, 0x1380693, 0x13806EE, 0x1380733, 0x138142B,
+    0x1381432, 0x138146B, 0x1381473, 0x13814A4, 0x138158C, 0x1381594,
+    0x13815C4, 0x13815D4, 0x138164D, 0x13816F3, 0x1382465, 0x1382473,
+    0x1382479, 0x13824A4, 0x13824AC, 0x13824B3, 0x13824C6, 0x1382565,
+    0x1382579, 0x138258C, 0x1382594, 0x13825C5, 0x13825D3, 0x13825D9,
+    0x1382645, 0x1382659, 0x1382685, 0x1382693, 0x13826D3, 0x1383034,
+    0x1383039, 0x1383134, 0x1383D2C, 0x1383D65, 0x1383DE6, 0x1383DEB,
+    0x1383DEC, 0x1383DEE, 0x1383DF2, 0x1383E45, 0x1383E54, 0x1383E93,
+    0x1383EB4, 0x1384834, 0x1384839, 0x13848A5, 0x1384927, 0x13849E7,
+    0x1384AA5, 0x1385493, 0x13855A5, 0x13855B9, 0x13855CB, 0x138564E,
+    0x1385653, 0x1385654, 0x1385681, 0x138D422, 0x138D424, 0x138D434,
+    0x138D437, 0x138D4A5, 0x138D522, 0x138D524, 0x13A0453, 0x13A046B,
+    0x13A04C6, 0x13A04E5, 0x13A04F3, 0x13A04F9, 0x13A0524, 0x13A052E,
+    0x13A0532, 0x13A0565, 0x13A0585, 0x13A058B, 0x13A058C, 0x13A05B0,
+    0x13A05C4, 0x13A05CB, 0x13A0608, 0x13A0645, 0x13A064B, 0x13A0653,
+    0x13A0654, 0x13A0668, 0x13A0685, 0x13A0693, 0x13A06C5, 0x13A0733,
+    0x13A112F, 0x13A1424, 0x13A142B, 0x13A142C, 0x13A142D, 0x13A14A4,
+    0x13A14AC, 0x13A14B0, 0x13A14B2, 0x13A152E, 0x13A15B3, 0x13A15CF,
+    0x13A15D4, 0x13A1613, 0x13A164E, 0x13A1693, 0x13A16F3, 0x13A246B,
+    0x13A24B3, 0x13A24C6, 0x13A2585, 0x13A258C, 0x13A2594, 0x13A25C7,
+    0x13A25CB, 0x13A25D4, 0x13A2653, 0x13A3C34, 0x13A3C6B, 0x13A3D23,
+    0x13A3D65, 0x13A3D85, 0x13A3DA1, 0x13A3DB0, 0x13A3DC5, 0x13A3DD9,
+    0x13A3DE4, 0x13A3DEC, 0x13A3DF0, 0x13A3E13, 0x13A3E45, 0x13A3E4B,
+    0x13A3E4D, 0x13A3E59, 0x13A3EB0, 0x13A3EB4, 0x13A3EC5, 0x13A3EF3,
+    0x13A4830, 0x13A4837, 0x13A4839, 0x13A48B0, 0x13A48B7, 0x13A4921,
+    0x13A492D, 0x13A4930, 0x13A49F0, 0x13A4AAD, 0x13A4AB4, 0x13A5453,
+    0x13A546B, 0x13A5493, 0x13A5499, 0x13A54C6, 0x13A55B0, 0x13A55B3,
+    0x13A55C7, 0x13A55CB, 0x13A55D3, 0x13A55D4, 0x13A6585, 0x13A6589,
+    0x13A86C5, 0x13A8D73, 0x13A9279, 0x13A9485, 0x13A9653, 0x13A9699,
+    0x13A9C32, 0x13AA5C7, 0x13AA685, 0x13AA693, 0x13AB0C1, 0x13AB173,
+    0x13AB179, 0x13AB199, 0x13AB423, 0x13AB5F3, 0x13AB613, 0x13AB9D9,
+    0x13ABAB0, 0x13AC0B2, 0x13AC20C, 0x13AC241, 0x13AC8B2, 0x13AC8D3,
+    0x13AC8E5, 0x13AC999, 0x13ACD09, 0x13B8453, 0x13B84F3, 0x13B852E,
+    0x13B85A9, 0x13B85B0, 0x13B85CB, 0x13B85D3, 0x13B8613, 0x13B8644,
+    0x13B864D, 0x13B8654, 0x13B8668, 0x13B8688, 0x13B8693, 0x13B8733,
+    0x13B9432, 0x13B9434, 0x13B9485, 0x13B94B0, 0x13B94B4, 0x13B958C,
+    0x13B9614, 0x13BA4D4, 0x13BA4F3, 0x13BA58C, 0x13BA5B3, 0x13BA5C5,
+    0x13BA5C7, 0x13BA605, 0x13BA64C, 0x13BA668, 0x13BA75A, 0x13BBDEE,
+    0x13BBDF0, 0x13BBE44, 0x13BBE45, 0x13BBE4E, 0x13BBE93, 0x13BD5C7,
+    0x13CB208, 0x13CB868, 0x13CB873, 0x13CB9E4, 0x13CBA88, 0x13CCAB0,
+    0x13CCDF0, 0x1408859, 0x1408981, 0x1408985, 0x14089EF, 0x14089F2,
+    0x1408D34, 0x1408D73, 0x1408D79, 0x1408DF3, 0x14098D9, 0x1409DA1,
+    0x140A4E1, 0x140A593, 0x140A5D4, 0x140ACAE, 0x140ACB2, 0x140ACB3,
+    0x140B0B3, 0x140B173, 0x140B179, 0x140B199, 0x140B1EE, 0x140B2B3,
+    0x140B4A4, 0x140B4B2, 0x140B4B3, 0x140B613, 0x140B8EF, 0x140B8F3,
+    0x140B8F9, 0x140B973, 0x140BA79, 0x140C033, 0x140C0A4, 0x140C0B2,
+    0x140C0B3, 0x140C132, 0x140C899, 0x140C8A4, 0x140C8B3, 0x140C9D3,
+    0x140C9F3, 0x140C9F4, 0x140CA13, 0x140CA59, 0x140CA69, 0x140CA93,
+    0x140CA99, 0x140CCB2, 0x140CD73, 0x140CE85, 0x140CE99, 0x140D0B2,
+    0x140D299, 0x140D5D4, 0x140D605, 0x140DDD9, 0x140E0A4, 0x140E0B2,
+    0x140E0B3, 0x140E133, 0x140E1EE, 0x1428468, 0x1428573, 0x1428593,
+    0x14285B3, 0x1428653, 0x1428659, 0x1428665, 0x1428693, 0x1428D13,
+    0x1428D19, 0x1429099, 0x14295B3, 0x14295D3, 0x14295D9, 0x1429688,
+    0x142B06F, 0x142B0B8, 0x142B193, 0x142B199, 0x142B609, 0x142B60F,
+    0x142B613, 0x142B614, 0x142B868, 0x142B893, 0x142B8B4, 0x142B9EE,
+    0x142B9F2, 0x142BA65, 0x142BA88, 0x142BA93, 0x142C0A5, 0x142C124,
+    0x142C9B3, 0x142C9D3, 0x142CA59, 0x142CA65, 0x142CE93, 0x142CE99,
+    0x142D241, 0x142E293, 0x14405C5, 0x14405CB, 0x14406F3, 0x1441461,
+    0x14414B3, 0x14414D4, 0x1441532, 0x14415A5, 0x1441645, 0x144164D,
+    0x1441665, 0x1441681, 0x14416F3, 0x144246B, 0x14424A6, 0x14424E8,
+    0x14425C5, 0x14425C7, 0x14425CB, 0x14425D3, 0x1442644, 0x1443D85,
+    0x1443DC7, 0x1443E4E, 0x1443E65, 0x1443EB3, 0x14448A5, 0x14448B7,
+    0x14449E2, 0x14449E5, 0x14449F7, 0x1444AAD, 0x1445493, 0x14454F3,
+    0x14455A2, 0x14455B0, 0x14455CB, 0x14465A5, 0x1448641, 0x1448921,
+    0x1448D73, 0x144902C, 0x14490A4, 0x14490B3, 0x1449653, 0x14498D3,
+    0x1449CB2, 0x1449D14, 0x144AD33, 0x144B085, 0x144B0A4, 0x144B0B2,
+    0x144B0B3, 0x144B193, 0x144B288, 0x144B293, 0x144B4A4, 0x144B4B2,
+    0x144B4B3, 0x144B524, 0x144B8B3, 0x144B8E5, 0x144B8F3, 0x144B9D9,
+    0x144BA93, 0x144C279, 0x144C8A4, 0x144C8B3, 0x144D02E, 0x144D068,
+    0x144D105, 0x144D185, 0x144D245, 0x144D299, 0x144EB59, 0x1478493,
+    0x1478499, 0x1478674, 0x1478D73, 0x1479039, 0x1479099, 0x14798D3,
+    0x1479AB3, 0x1479C33, 0x147A593, 0x147A699, 0x147ACA4, 0x147ACAE,
+    0x147ACB3, 0x147B193, 0x147B453, 0x147B4B3, 0x147B82C, 0x147B8A4,
+    0x147B8B2, 0x147B8B3, 0x147B8F3, 0x147B923, 0x147B9C5, 0x147BD93,
+    0x147BE88, 0x147BE93, 0x147C03A, 0x147C0A5, 0x147C0B2, 0x147C123,
+    0x147C279, 0x147C6A5, 0x147C868, 0x147CA6F, 0x147CA85, 0x147CA93,
+    0x147CAB3, 0x147D02C, 0x147D0A4, 0x147D0AD, 0x147D0B3, 0x147D468,
+    0x147D4E8, 0x147D653, 0x147D693, 0x147DCA4, 0x147DCAC, 0x147DCB2,
+    0x147DDD3, 0x147E123, 0x147E12E, 0x147E4A4, 0x1490465, 0x149046B,
+    0x1490474, 0x1490485, 0x14904E9, 0x149052C, 0x149052E, 0x1490534,
+    0x14905B0, 0x14905B3, 0x14905D3, 0x1490613, 0x1490668, 0x14906EC,
+    0x1490733, 0x1491424, 0x1491433, 0x1491434, 0x14914A4, 0x14914B3,
+    0x1491573, 0x14915C4, 0x1491673, 0x14916F3, 0x1491733, 0x1492424,
+    0x149242C, 0x1492445, 0x1492465, 0x149246B, 0x14924A4, 0x14924B2,
+    0x14924B3, 0x14924F3, 0x1492565, 0x149258C, 0x14925B3, 0x14925C5,
+    0x14925F3, 0x1492605, 0x1492613, 0x1492685, 0x1493D8C, 0x1493DB0,
+    0x1493DD3, 0x1493DF0, 0x1493E05, 0x1493E88, 0x1493E93, 0x1493EB4,
+    0x1493EC5, 0x1493EF3, 0x1493F33, 0x1495465, 0x149546B, 0x14954A4,
+    0x14954B2, 0x14954B3, 0x14954F3, 0x1495599, 0x14955B0, 0x14955CB,
+    0x1495673, 0x1495674, 0x1495688, 0x1496674, 0x1498653, 0x14A882C,
+    0x14A8833, 0x14A8859, 0x14A88A4, 0x14A88B2, 0x14A88B3, 0x14A8D73,
+    0x14A9A93, 0x14A9A99, 0x14AB130, 0x14AB185, 0x14AB524, 0x14AB5B9,
+    0x14AB5F2, 0x14AB833, 0x14AB8A4, 0x14AB8B2, 0x14AB8B3, 0x14AB923,
+    0x14AB9D9, 0x14AC185, 0x14AC6A5, 0x14AC84F, 0x14AC893, 0x14AC8D3,
+    0x14AC8D9, 0x14AC9D3, 0x14ACA13, 0x14ACAD9, 0x14ACD73, 0x14AD1F2,
+    0x14AD289, 0x14AD2B3, 0x14AE0B3, 0x14B852E, 0x14B85C7, 0x14B8693,
+    0x14B942B, 0x14B94A4, 0x14B94AE, 0x14B94B2, 0x14B94B4, 0x14B964B,
+    0x14B9650, 0x14BA465, 0x14BA4F3, 0x14BA58C, 0x14BA5C5, 0x14BA5CB,
+    0x14BA5D3, 0x14BA64C, 0x14BA674, 0x14BA693, 0x14BA714, 0x14CA5C7,
+    0x14CACB3, 0x14CC0A4, 0x14CC0B3, 0x14CC1F3, 0x14CC8A4, 0x14CC8B3,
+    0x14CC9F3, 0x14D0653, 0x15210B2, 0x1558665, 0x1560CB2, 0x1563825,
+    0x1563832, 0x1565241, 0x15688AC, 0x15688B2, 0x15689F3, 0x1568A41,
+    0x156A42B, 0x156C0A4, 0x157064D, 0x1570659, 0x157082E, 0x1570832,
+    0x1570924, 0x1570C30, 0x1570D85, 0x1570EB4, 0x15710B2, 0x1571124,
+    0x15712A5, 0x15718A4, 0x1571934, 0x1571938, 0x15724D9, 0x15725EE,
+    0x1572685, 0x1572693, 0x1572699, 0x157282D, 0x1573030, 0x1573039,
+    0x15730B4, 0x1573134, 0x157342E, 0x15734B4, 0x15740A7, 0x157412E,
+    0x1574C39, 0x1574CB4, 0x1574CB8, 0x1575125, 0x157512C, 0x1575CA4,
+    0x1576930, 0x15815C4, 0x15840A4, 0x15840B2, 0x1584CB4, 0x159082E,
+    0x1591CA4, 0x1591CB3, 0x15925C5, 0x15984E5, 0x1599653, 0x159A0B2,
+    0x159A5C7, 0x159D42C, 0x159D650, 0x159D659, 0x15A05D3, 0x15A1649,
+    0x15A164F, 0x15A2585, 0x15A50B2, 0x15B5581, 0x1608EA1, 0x1609EA5,
+    0x1609EB3, 0x160B0B3, 0x160B0B4, 0x160B124, 0x160B1F2, 0x160B2A5,
+    0x160B2C5, 0x160B613, 0x160B8B3, 0x160C0A4, 0x160C0B3, 0x160C124,
+    0x160C1F2, 0x160C938, 0x160CCB3, 0x160CE93, 0x160D594, 0x160D5D4,
+    0x1629613, 0x1629653, 0x1629C2E, 0x1629CB3, 0x162A593, 0x162A5D3,
+    0x162B032, 0x162B093, 0x162B094, 0x162B2AD, 0x162B82C, 0x162B893,
+    0x162B9ED, 0x162BA93, 0x162BAA5, 0x162C853, 0x162C8E5, 0x162CA61,
+    0x162CA65, 0x162CA6F, 0x162CA93, 0x162CAC5, 0x162CE93, 0x162D068,
+    0x162E0A4, 0x162E0B3, 0x1648593, 0x16485C4, 0x16488B3, 0x1648C32,
+    0x1648CA4, 0x1648CB3, 0x16490AF, 0x16496F3, 0x1649D2C, 0x1649DF2,
+    0x164B0B2, 0x164B181, 0x164B189, 0x164B8B3, 0x164BB2C, 0x164BD81,
+    0x164BD93, 0x164C0B2, 0x164C82C, 0x164C8AF, 0x164CAB3, 0x164CC33,
+    0x164CCA4, 0x164CCB3, 0x164CD34, 0x164CDF2, 0x164CE81, 0x164D025,
+    0x164D02C, 0x164D24F, 0x164D833, 0x164D924, 0x164E0AE, 0x1678C22,
+    0x1678C2C, 0x1679161, 0x1679EA5, 0x167A465, 0x167A493, 0x167A581,
+    0x167A585, 0x167B0B3, 0x167B285, 0x167B293, 0x167B534, 0x167D0A4,
+    0x167D0B2, 0x167D0B3, 0x167D468, 0x167DCA4, 0x167DCAC, 0x1693DED,
+    0x16AB2C1, 0x16CA5C7, 0x1708D6F, 0x1708D73, 0x1708D79, 0x1709099,
+    0x17090A4, 0x17090B2, 0x17090B3, 0x17090E5, 0x1709133, 0x17098B2,
+    0x1709A93, 0x1709CA4, 0x1709CB2, 0x1709CB3, 0x1709DEE, 0x170A4D3,
+    0x170A593, 0x170A5D3, 0x170A674, 0x170A693, 0x170A6C5, 0x170ACA4,
+    0x170ACAE, 0x170ACB3, 0x170B08F, 0x170B0A4, 0x170B0B3, 0x170B173,
+    0x170B193, 0x170B199, 0x170B29A, 0x170B893, 0x170B8A4, 0x170B8B3,
+    0x170B973, 0x170B979, 0x170B999, 0x170B9C1, 0x170BA93, 0x170C893,
+    0x170C8B3, 0x170C8BA, 0x170C9B3, 0x170C9D3, 0x170CA13, 0x170CA93,
+    0x170CA99, 0x170CD19, 0x170CE13, 0x170CE85, 0x170D068, 0x170D0B2,
+    0x170D293, 0x170D8A4, 0x170D8B2, 0x170D8B3, 0x170E0A4, 0x170E0AE,
+    0x170E0B3, 0x170E9EF, 0x1728593, 0x17285D3, 0x1728653, 0x1728659,
+    0x17286C5, 0x17290E5, 0x1729493, 0x1729499, 0x1729573, 0x17295D3,
+    0x17295D9, 0x1729613, 0x1729619, 0x1729674, 0x1729A93, 0x172A4E8,
+    0x172A644, 0x172A653, 0x172B093, 0x172B193, 0x172B199, 0x172B268,
+    0x172B293, 0x172B868, 0x172B893, 0x172D199, 0x174046B, 0x1740585,
+    0x17405B3, 0x1740645, 0x1740646, 0x1740693, 0x174142C, 0x1741434,
+    0x17414AC, 0x174158B, 0x174158D, 0x1741590, 0x17415D3, 0x1741645,
+    0x1741693, 0x1742468, 0x17424C6, 0x1742585, 0x17425B3, 0x17425C5,
+    0x17425D9, 0x1742613, 0x174264C, 0x1742652, 0x1742653, 0x174266B,
+    0x1742674, 0x1742685, 0x1742693, 0x1743D85, 0x1743DF0, 0x1743E13,
+    0x1743E45, 0x1743E4C, 0x1743E65, 0x1743E6F, 0x1745613, 0x1748D73,
+    0x17490AE, 0x17490B2, 0x17491F7, 0x1749288, 0x1749584, 0x1749D14,
+    0x174AD33, 0x174B093, 0x174B0A4, 0x174B0B3, 0x174B193, 0x174B199,
+    0x174B293, 0x174B613, 0x174B619, 0x174B865, 0x174B868, 0x174B893,
+    0x174B899, 0x174B8A4, 0x174B8B3, 0x174B8F3, 0x174B973, 0x174B9F3,
+    0x174C0A4, 0x174C0B2, 0x174C0B3, 0x174C8A4, 0x174C8B2, 0x174C8B3,
+    0x174CCA4, 0x174CCB2, 0x174CCB3, 0x174CD19, 0x174CE13, 0x174CE19,
+    0x174D068, 0x174D105, 0x174D299, 0x174D8A4, 0x174D8B3, 0x174E8AE,
+    0x17790E5, 0x177ACAE, 0x177B093, 0x177B0D3, 0x177B42E, 0x177B453,
+    0x177B4AE, 0x177B973, 0x177B979, 0x177BC93, 0x177BC99, 0x177BCA4,
+    0x177BCB2, 0x177BCD3, 0x177BD93, 0x177BE68, 0x177BF59, 0x177C893,
+    0x177C899, 0x177C973, 0x177C984, 0x177C9B3, 0x177C9B9, 0x177CA59,
+    0x177CA65, 0x177CA74, 0x177CA88, 0x177D584, 0x177D5C4, 0x177D8AE,
+    0x177DCA4, 0x179046B, 0x1790613, 0x1790688, 0x179142B, 0x179146B,
+    0x17915D3, 0x1791674, 0x17925C7, 0x1792674, 0x1792685, 0x1792693,
+    0x1793DC7, 0x1793E85, 0x1793E88, 0x17955C7, 0x17964B2, 0x1796599,
+    0x17ACA74, 0x17ACE79, 0x181D929, 0x182B9EE, 0x182C9F8, 0x18914D3,
+    0x18A164D, 0x18B2529, 0x18C2529, 0x18C5929, 0x18C6129, 0x18C6136,
+    0x18C6138, 0x18C62C9, 0x18CB0AD, 0x18CB1EC, 0x1908859, 0x1908D14,
+    0x1908D73, 0x190A1EF, 0x190AD61, 0x190B973, 0x190C893, 0x190C9D3,
+    0x190DCA4, 0x190DD93, 0x190DDD3, 0x1928513, 0x192864E, 0x1928653,
+    0x1928674, 0x1929CF3, 0x192B193, 0x192B213, 0x192CCB3, 0x192D133,
+    0x1949584, 0x194ACB3, 0x197884F, 0x19790AC, 0x1979D23, 0x1979D33,
+    0x197ACA4, 0x197ACAC, 0x197ACB3, 0x197B173, 0x197B973, 0x197C973,
+    0x197D5C7, 0x197D653, 0x197D688, 0x197DD93, 0x19A8C61, 0x19A8D79,
+    0x19AAD79, 0x19AB5B9, 0x19ACA93, 0x1A0C219, 0x1A28A41, 0x1A28AB3,
+    0x1A2C9F3, 0x1A2CE93, 0x1A2CE99, 0x1A2D033, 0x1A4B068, 0x1A4B873,
+    0x1A4B8B3, 0x1A4B8F3, 0x1A4B8F9, 0x1A4C219, 0x1A63E99, 0x1A7B82C,
+    0x1A7B8A4, 0x1A7B8B3, 0x1A7BDB3, 0x1A7C868,
+};
+
+const uint32_t CandidatesTables_wordCount = 5752;
+const uint32_t CandidatesTables_bitsetWords = BITSET_WORDS;
+
+// Filled in by Candidates_reset()
+uint32_t CandidatesTables_live[BITSET_WORDS];
+
+#else
+
+// Generated for 5-letter words: no words at any other length
+
+const PackedWord CandidatesTables_words[1] = { 0 };
+
+const uint32_t CandidatesTables_wordCount = 0;
+const uint32_t CandidatesTables_bitsetWords = 0;
+
+uint32_t CandidatesTables_live[1];
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * CandidatesTables.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The candidate bitset behind Candidates.c, sized for the dictionary.
+ * CandidatesTables.c defines it and is generated by Host/MakeDictionary; run
+ * "make dictionary" in Host/ after changing Wordle/words.txt.
+ *
+ * The bitset has a bit for each dictionary word, in alphabetical order: bit
+ * (i % 32) of element i / 32 stands for the i-th word, the one the i-th call
+ * of Dictionary_next() returns. It takes CandidatesTables_bitsetWords 32-bit
+ * elements of SRAM. The only table in flash is every word packed, in the same
+ * order, so that the letters of a candidate are read by its index instead of
+ * walking the dictionary to it: 4 bytes a word, 23 KB for the list shipped.
+ */
+
+#ifndef WORDLE_CANDIDATESTABLES_H_
+#define WORDLE_CANDIDATESTABLES_H_
+
+#include <Wordle/Score.h>
+
+// The word of every bit
+extern const PackedWord CandidatesTables_words[];
+
+extern const uint32_t CandidatesTables_wordCount;
+extern const uint32_t CandidatesTables_bitsetWords;
+
+// The words which agree with the feedback so far, in SRAM
+extern uint32_t CandidatesTables_live[];
+
+#endif /* WORDLE_CANDIDATESTABLES_H_ */
@@ -0,0 +1,412 @@
+/*
+ * Dictionary.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Dictionary.h>
+
+#if DICTIONARY_BACKEND == DICTIONARY_DAWG
+
+#include <Wordle/DictionaryDawg.h>
+
+void Dictionary_init(void)
+{
+}
+
+/**
+ * Counts the set bits of a value. The Cortex-M4 has no population count
+ * instruction, so the bits are added up in parallel, in pairs, nibbles and
+ * then bytes, which takes a dozen instructions without any branches.
+ */
+static uint32_t Dictionary_popCount(uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0F0F0F0F;
+    return (value * 0x01010101) >> 24;
+}
+
+/**
+ * Walks the DAWG from the root, one node per letter. Each letter is a bit
+ * test on the node's mask and, for every letter but the last, one table read
+ * to find the child. Letter codes outside 1 to 26 have no bit in any mask, so
+ * they are rejected without a separate check.
+ *
+ * @param word:     The packed word to look up
+ * @return true if the word is in the dictionary
+ */
+bool Dictionary_contains(PackedWord word)
+{
+    uint32_t node = 0;
+    uint32_t mask;
+    uint32_t letterBit;
+    int position;
+
+    for (position = 0; position < SCORE_WORD_LENGTH - 1; position++)
+    {
+        mask = DictionaryDawg_masks[node];
+        letterBit = 1u << SCORE_LETTER(word, position);
+
+        if ((mask & letterBit) == 0)
+        {
+            return false;
+        }
+
+        node = DictionaryDawg_edges[DictionaryDawg_firstEdge[node] + Dictionary_popCount(mask & (letterBit - 1))];
+    }
+
+    return (DictionaryDawg_masks[node] & (1u << SCORE_LETTER(word, SCORE_WORD_LENGTH - 1))) != 0;
+}
+
+DictionaryCursor Dictionary_cursor(void)
+{
+    DictionaryCursor cursor;
+
+    cursor.nodes[0] = 0;
+    cursor.unvisited[0] = DictionaryDawg_masks[0];
+    cursor.word = 0;
+    cursor.depth = 0;
+
+    return cursor;
+}
+
+/**
+ * Walks down the graph along the word, as Dictionary_contains() does, and
+ * leaves unvisited at every node only the letters after the word's. At the
+ * last depth the word's own letter is left too, so it is the next word.
+ *
+ * @param word:     A packed word of the dictionary
+ * @return a walk whose next word is the given one
+ */
+DictionaryCursor Dictionary_cursorAt(PackedWord word)
+{
+    DictionaryCursor cursor;
+    uint32_t node = 0;
+    int depth;
+
+    for (depth = 0; depth < SCORE_WORD_LENGTH; depth++)
+    {
+        uint32_t mask = DictionaryDawg_masks[node];
+        uint32_t letterBit = 1u << SCORE_LETTER(word, depth);
+
+        cursor.nodes[depth] = (uint16_t) node;
+        cursor.unvisited[depth] = mask & ~(letterBit | (letterBit - 1));
+        if (depth < SCORE_WORD_LENGTH - 1)
+        {
+            node = DictionaryDawg_edges[DictionaryDawg_firstEdge[node] + Dictionary_popCount(mask & (letterBit - 1))];
+        }
+        else
+        {
+            cursor.unvisited[depth] |= letterBit;
+        }
+    }
+    cursor.word = word;
+    cursor.depth = SCORE_WORD_LENGTH - 1;
+
+    return cursor;
+}
+
+/**
+ * Visits the graph depth first, lowest letter first. The cursor climbs back
+ * to the deepest node with a letter it has not visited yet, takes that
+ * letter and then goes down along the lowest letter of every node below.
+ *
+ * @param cursor:   The walk
+ * @param word_p:   Where to store the next word
+ * @return false if the walk has visited every word
+ */
+bool Dictionary_next(DictionaryCursor* cursor, PackedWord* word_p)
+{
+    int depth = cursor->depth;
+    int shift;
+
+    while (depth >= 0 && cursor->unvisited[depth] == 0)
+    {
+        depth--;
+    }
+    if (depth < 0)
+    {
+        cursor->depth = depth;
+        return false;
+    }
+
+    for (;;)
+    {
+        uint32_t mask = cursor->unvisited[depth];
+        uint32_t letterBit = mask & (~mask + 1);
+        uint32_t node = cursor->nodes[depth];
+
+        cursor->unvisited[depth] = mask & ~letterBit;
+
+        // Replace the letter at this depth; the ones after it are overwritten on the way down
+        shift = SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1 - depth);
+        cursor->word = (cursor->word & ~((PackedWord) SCORE_LETTER_MASK << shift))
+                       | (Dictionary_popCount(letterBit - 1) << shift);
+
+        if (depth == SCORE_WORD_LENGTH - 1)
+        {
+            break;
+        }
+
+        node = DictionaryDawg_edges[DictionaryDawg_firstEdge[node]
+                                    + Dictionary_popCount(DictionaryDawg_masks[node] & (letterBit - 1))];
+        depth++;
+        cursor->nodes[depth] = (uint16_t) node;
+        cursor->unvisited[depth] = DictionaryDawg_masks[node];
+    }
+
+    cursor->depth = depth;
+    *word_p = cursor->word;
+    return true;
+}
+
+uint32_t Dictionary_wordCount(void)
+{
+    return DictionaryDawg_wordCount;
+}
+
+uint32_t Dictionary_flashBytes(void)
+{
+    return DictionaryDawg_flashBytes;
+}
+
+uint32_t Dictionary_ramBytes(void)
+{
+    return 0;
+}
+
+#elif DICTIONARY_BACKEND == DICTIONARY_PACKED
+
+#include <Wordle/DictionaryPacked.h>
+
+// Interpolation works on the top bits of words only, so that the product of a
+// word distance and an index distance fits into 32 bits
+#define INTERPOLATION_SHIFT 10
+
+// The bits of a packed word below its first letter
+#define FIRST_LETTER_SHIFT  (SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1))
+
+/**
+ * For every first letter code, the number of index entries whose word starts
+ * with an earlier letter. Filled in by Dictionary_init().
+ */
+static uint16_t letterEntries[SCORE_ALPHABET_SIZE + 1];
+
+/** Decodes the difference at an offset of the table and moves the offset past it. */
+static uint32_t Dictionary_readDelta(uint32_t* offset_p)
+{
+    uint32_t delta = 0;
+    uint8_t byte;
+
+    do
+    {
+        byte = DictionaryPacked_deltas[(*offset_p)++];
+        delta = (delta << DICTIONARY_PACKED_BITS) | (byte & ~DICTIONARY_PACKED_MORE);
+    } while (byte & DICTIONARY_PACKED_MORE);
+
+    return delta;
+}
+
+/**
+ * Walks every difference once and keeps every DICTIONARY_PACKED_STRIDE-th
+ * word and the offset of the difference after it.
+ */
+void Dictionary_init(void)
+{
+    uint32_t offset = 0;
+    uint32_t word = 0;
+    uint32_t i;
+
+    for (i = 0; i < DictionaryPacked_wordCount; i++)
+    {
+        word += Dictionary_readDelta(&offset);
+        if (i % DICTIONARY_PACKED_STRIDE == 0)
+        {
+            DictionaryPacked_indexWords[i / DICTIONARY_PACKED_STRIDE] = word;
+            DictionaryPacked_indexOffsets[i / DICTIONARY_PACKED_STRIDE] = (uint16_t) offset;
+        }
+    }
+
+    for (i = 0, word = 0; word <= SCORE_ALPHABET_SIZE; word++)
+    {
+        while (i < DictionaryPacked_indexEntries && (DictionaryPacked_indexWords[i] >> FIRST_LETTER_SHIFT) < word)
+        {
+            i++;
+        }
+        letterEntries[word] = (uint16_t) i;
+    }
+}
+
+/**
+ * Finds the last index entry which is not after the word by interpolation:
+ * the next entry to look at is where the word would be if the entries were
+ * spread evenly between the two that bound it. Words bunch up under common
+ * first letters (there are far more S words than X words), so the search
+ * starts from the entries of the word's first letter only, and whenever a
+ * guess fails to halve the range the next one is the middle of the range
+ * instead, which keeps the worst case logarithmic.
+ *
+ * @param word:     A packed word, not before the first entry
+ * @return the index entry to decode from
+ */
+static uint32_t Dictionary_searchIndex(PackedWord word)
+{
+    uint32_t last = DictionaryPacked_indexEntries - 1;
+    uint32_t letter = word >> FIRST_LETTER_SHIFT;
+    uint32_t low = letterEntries[letter] ? letterEntries[letter] - 1 : 0;
+    uint32_t high = (letterEntries[letter + 1] < last) ? letterEntries[letter + 1] : last;
+    bool bisect = false;
+
+    if (word >= DictionaryPacked_indexWords[last])
+    {
+        return last;
+    }
+
+    // indexWords[low] <= word < indexWords[high]
+    while (high - low > 1)
+    {
+        uint32_t range = high - low;
+        uint32_t probe;
+
+        if (bisect)
+        {
+            probe = low + range / 2;
+        }
+        else
+        {
+            uint32_t span = ((DictionaryPacked_indexWords[high] - DictionaryPacked_indexWords[low]) >> INTERPOLATION_SHIFT) + 1;
+            uint32_t distance = (word - DictionaryPacked_indexWords[low]) >> INTERPOLATION_SHIFT;
+
+            probe = low + 1 + distance * (range - 1) / span;
+        }
+
+        if (DictionaryPacked_indexWords[probe] <= word)
+        {
+            low = probe;
+        }
+        else
+        {
+            high = probe;
+        }
+        bisect = 2 * (high - low) > range;
+    }
+
+    return low;
+}
+
+/**
+ * Searches the SRAM index for the stride the word would be in, then decodes
+ * the words of that stride until one is not before it.
+ *
+ * @param word:     The packed word to look up
+ * @return true if the word is in the dictionary
+ */
+bool Dictionary_contains(PackedWord word)
+{
+    uint32_t entry, offset, remaining;
+    uint32_t current;
+
+    if (DictionaryPacked_indexEntries == 0 || word < DictionaryPacked_indexWords[0])
+    {
+        return false;
+    }
+
+    entry = Dictionary_searchIndex(word);
+    current = DictionaryPacked_indexWords[entry];
+    offset = DictionaryPacked_indexOffsets[entry];
+    remaining = DictionaryPacked_wordCount - entry * DICTIONARY_PACKED_STRIDE - 1;
+    if (remaining > DICTIONARY_PACKED_STRIDE - 1)
+    {
+        remaining = DICTIONARY_PACKED_STRIDE - 1;
+    }
+
+    while (current < word && remaining-- > 0)
+    {
+        current += Dictionary_readDelta(&offset);
+    }
+
+    return current == word;
+}
+
+DictionaryCursor Dictionary_cursor(void)
+{
+    DictionaryCursor cursor;
+
+    cursor.word = 0;
+    cursor.offset = 0;
+    cursor.remaining = DictionaryPacked_wordCount;
+
+    return cursor;
+}
+
+/**
+ * Searches the SRAM index for the stride the word is in and starts from the
+ * entry before it, since a walk holds the word before its next one. Then it
+ * decodes words until the next one is the given word.
+ *
+ * @param word:     A packed word of the dictionary
+ * @return a walk whose next word is the given one
+ */
+DictionaryCursor Dictionary_cursorAt(PackedWord word)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    uint32_t entry, offset;
+
+    if (DictionaryPacked_indexEntries == 0 || word <= DictionaryPacked_indexWords[0])
+    {
+        return cursor;
+    }
+
+    entry = Dictionary_searchIndex(word - 1);
+    cursor.word = DictionaryPacked_indexWords[entry];
+    cursor.offset = DictionaryPacked_indexOffsets[entry];
+    cursor.remaining = DictionaryPacked_wordCount - entry * DICTIONARY_PACKED_STRIDE - 1;
+
+    for (offset = cursor.offset; cursor.remaining > 0; cursor.offset = offset)
+    {
+        uint32_t next = cursor.word + Dictionary_readDelta(&offset);
+
+        if (next >= word)
+        {
+            break;
+        }
+        cursor.word = next;
+        cursor.remaining--;
+    }
+
+    return cursor;
+}
+
+bool Dictionary_next(DictionaryCursor* cursor, PackedWord* word_p)
+{
+    if (cursor->remaining == 0)
+    {
+        return false;
+    }
+
+    cursor->word += Dictionary_readDelta(&cursor->offset);
+    cursor->remaining--;
+    *word_p = cursor->word;
+    return true;
+}
+
+uint32_t Dictionary_wordCount(void)
+{
+    return DictionaryPacked_wordCount;
+}
+
+uint32_t Dictionary_flashBytes(void)
+{
+    return DictionaryPacked_flashBytes;
+}
+
+uint32_t Dictionary_ramBytes(void)
+{
+    return DictionaryPacked_indexEntries * (sizeof(DictionaryPacked_indexWords[0]) + sizeof(DictionaryPacked_indexOffsets[0]))
+           + sizeof(letterEntries);
+}
+
+#else
+#error "DICTIONARY_BACKEND must be DICTIONARY_DAWG or DICTIONARY_PACKED"
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Dictionary.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The list of words which are accepted as guesses. The words live in const
+ * tables in flash, generated from Wordle/words.txt by Host/MakeDictionary.
+ * How they are stored is chosen at build time with DICTIONARY_BACKEND; every
+ * backend has the same API, so the game does not change with it.
+ */
+
+#ifndef WORDLE_DICTIONARY_H_
+#define WORDLE_DICTIONARY_H_
+
+#include <Wordle/Score.h>
+
+// The ways the dictionary can be stored:
+//   DICTIONARY_DAWG    a directed acyclic word graph: the fastest lookup and no RAM,
+//                      but the most flash (see DictionaryDawg.h)
+//   DICTIONARY_PACKED  the sorted packed words as variable-length deltas: less than half
+//                      the flash of the DAWG, plus a small index in SRAM (see DictionaryPacked.h)
+#define DICTIONARY_DAWG             1
+#define DICTIONARY_PACKED           2
+
+#ifndef DICTIONARY_BACKEND
+#define DICTIONARY_BACKEND          DICTIONARY_DAWG
+#endif
+
+// The word length of Wordle/words.txt, which the generated tables are for. Built
+// for another SCORE_WORD_LENGTH the tables are empty and the game has no
+// dictionary: any guess is accepted, and there are no hints and no Absurdle.
+#define DICTIONARY_WORD_LENGTH      5
+#define DICTIONARY_AVAILABLE        (SCORE_WORD_LENGTH == DICTIONARY_WORD_LENGTH)
+
+// Every how many words the packed backend keeps an entry in its SRAM index. A
+// lookup decodes up to this many deltas, and the index takes 6 bytes per entry
+// plus 66 bytes for where each first letter starts in it.
+#ifndef DICTIONARY_PACKED_STRIDE
+#define DICTIONARY_PACKED_STRIDE    32
+#endif
+
+// Set to 1 to have main() time Dictionary_contains() and report the result
+// over UART before the game starts
+#ifndef DICTIONARY_RUN_BENCHMARK
+#define DICTIONARY_RUN_BENCHMARK    0
+#endif
+
+/**
+ * A position in a walk over every word of the dictionary, in alphabetical
+ * order. What it holds depends on the backend; only Dictionary_*() functions
+ * should touch its members.
+ */
+struct _DictionaryCursor
+{
+#if DICTIONARY_BACKEND == DICTIONARY_DAWG
+    // The nodes along the current word, and the letters of each not visited yet
+    uint16_t nodes[SCORE_WORD_LENGTH];
+    uint32_t unvisited[SCORE_WORD_LENGTH];
+    PackedWord word;
+    int depth;
+#else
+    PackedWord word;
+    uint32_t offset;
+    uint32_t remaining;
+#endif
+};
+typedef struct _DictionaryCursor DictionaryCursor;
+
+// Prepares the dictionary for lookups. Must be called once before Dictionary_contains().
+void Dictionary_init(void);
+
+// Returns true if the packed word is in the dictionary
+bool Dictionary_contains(PackedWord word);
+
+// Starts a walk over every word of the dictionary
+DictionaryCursor Dictionary_cursor(void);
+
+// Starts a walk at a word of the dictionary, which the first Dictionary_next() returns
+DictionaryCursor Dictionary_cursorAt(PackedWord word);
+
+// Moves a walk on to its next word. Returns false once every word has been visited.
+bool Dictionary_next(DictionaryCursor* cursor, PackedWord* word_p);
+
+// Returns the number of words in the dictionary
+uint32_t Dictionary_wordCount(void);
+
+// Returns the number of bytes of flash the dictionary tables take up
+uint32_t Dictionary_flashBytes(void);
+
+// Returns the number of bytes of SRAM the dictionary uses
+uint32_t Dictionary_ramBytes(void);
+
+#endif /* WORDLE_DICTIONARY_H_ */
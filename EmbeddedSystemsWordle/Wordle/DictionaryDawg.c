@@ -0,0 +1,852 @@
+/*
+ * DictionaryDawg.c
+ *
+ * Generated by Host/MakeDictionary from Wordle/words.txt. Do not edit; run
+ * "make dictionary" in Host/ after changing the word list.
+ *
+ * 5752 words, 1681 nodes, 5703 edges, 20996 bytes.
+ */
+
+#include <Wordle/Dictionary.h>
+#include <Wordle/DictionaryDawg.h>
+
+#if DICTIONARY_BACKEND == DICTIONARY_DAWG
+
+#if SCORE_WORD_LENGTH == 5
+
+const uint32_t DictionaryDawg_masks[1681] =
+{
+    0x7FFFFFE, 0x7FFF3FE, 0x2249322, 0x6249322, 0x2A48332, 0x3FF7EFE, 0x0249622, 0x624F322,
+    0x2308232, 0x05DF09A, 0x0208222, 0x224D326, 0x3209222, 0x2208222, 0x2248222, 0x5FDFBFE,
+    0x6AC9322, 0x0200000, 0x0208322, 0x2B3FB2A, 0x6AC8322, 0x05D7810, 0x2248222, 0x0248322,
+    0x3540028, 0x0208222, 0x0009222, 0x0040000, 0x2209326, 0x034E300, 0x420A232, 0x0048080,
+    0x0108240, 0x02492A2, 0x0008020, 0x01C3010, 0x0319AB6, 0x021A226, 0x050CAB0, 0x0040000,
+    0x01D0322, 0x0200000, 0x03CA2BC, 0x0190B0A, 0x0149200, 0x1144090, 0x00082A2, 0x000C242,
+    0x0009200, 0x0000002, 0x0200000, 0x2BC5B9E, 0x45C72FE, 0x0000002, 0x01DFCFC, 0x0208222,
+    0x7BCFADE, 0x0208222, 0x71CF2D8, 0x09C1020, 0x0FD7AFC, 0x004501A, 0x2208222, 0x05C5092,
+    0x1608222, 0x7FDFB3E, 0x2208222, 0x01D7244, 0x008401E, 0x0000002, 0x6F472D8, 0x0000200,
+    0x1FD72EE, 0x0008000, 0x45DF8FA, 0x6FDF6FC, 0x2208222, 0x15D787A, 0x0000022, 0x0000A22,
+    0x05C0080, 0x0008004, 0x0001100, 0x02002A0, 0x0040000, 0x0000040, 0x0040080, 0x0000090,
+    0x0000020, 0x0608276, 0x001A22E, 0x05C4432, 0x0008220, 0x0200000, 0x02480A2, 0x0180000,
+    0x0200100, 0x0040000, 0x0008222, 0x0000020, 0x031022A, 0x0040020, 0x7FC7AFC, 0x2FC722A,
+    0x55CD0EE, 0x0008000, 0x2208222, 0x3ECD28A, 0x2208222, 0x41C70B8, 0x6FDF2C4, 0x01CF02A,
+    0x0008002, 0x45D3056, 0x2208222, 0x0000002, 0x0008002, 0x0B4D272, 0x0208222, 0x21D7262,
+    0x0450004, 0x0000200, 0x6FD7E7C, 0x0020000, 0x1847272, 0x0555898, 0x0FDFABE, 0x0100000,
+    0x01C70C4, 0x0052230, 0x0002000, 0x0108200, 0x2009220, 0x0001000, 0x0001220, 0x0010006,
+    0x03958FE, 0x0104008, 0x0010000, 0x0008A02, 0x0081000, 0x0000028, 0x0008200, 0x4B122DC,
+    0x09C7022, 0x0507144, 0x2A05B28, 0x01C7210, 0x625D004, 0x2000000, 0x2155024, 0x0000002,
+    0x094D818, 0x0200000, 0x0208222, 0x0049002, 0x0008202, 0x0000010, 0x0201000, 0x7FD6A9C,
+    0x1D960F2, 0x059F8FE, 0x0000002, 0x2FDD2DE, 0x11D70DE, 0x0400000, 0x0146208, 0x7FD7ED8,
+    0x49CF03A, 0x11C78F8, 0x1FDF29A, 0x41CF0D8, 0x0144000, 0x05D6A1E, 0x1DC82AA, 0x11970E8,
+    0x0FCE33C, 0x0008000, 0x0143814, 0x0003000, 0x01C0800, 0x0008220, 0x0100928, 0x0008210,
+    0x0000008, 0x0100040, 0x0041200, 0x0002200, 0x0005000, 0x0040002, 0x0008230, 0x0000220,
+    0x0080228, 0x4002100, 0x0100222, 0x014029E, 0x0000200, 0x0100100, 0x4184080, 0x0208022,
+    0x0005200, 0x0000204, 0x0008000, 0x3FD72B8, 0x09DD8BA, 0x2009222, 0x55FFAAA, 0x0208222,
+    0x1BDFA3A, 0x0208222, 0x2080122, 0x01D785C, 0x0004000, 0x1041080, 0x0000002, 0x0008226,
+    0x6DD7EDC, 0x0FDF7FE, 0x2000220, 0x259F0DA, 0x2F9F29E, 0x01D72DC, 0x3FD7BDC, 0x0248322,
+    0x1D572BE, 0x224822A, 0x51C70FC, 0x2208222, 0x2208222, 0x0208222, 0x0208222, 0x0A5D2DE,
+    0x0249222, 0x0200000, 0x2248232, 0x00D72BA, 0x0208222, 0x00C5000, 0x1BD7ACC, 0x11D703A,
+    0x2248222, 0x41578FE, 0x3B7FADA, 0x2208222, 0x11F704C, 0x0000222, 0x0050A00, 0x0000010,
+    0x0000002, 0x0104008, 0x0010204, 0x499365E, 0x0090020, 0x0000284, 0x0200322, 0x0100222,
+    0x0200000, 0x02D7088, 0x11C52A0, 0x15DD0BE, 0x0B03298, 0x0008000, 0x0001000, 0x55C5AD8,
+    0x0105272, 0x0208222, 0x45D78B8, 0x0E4F810, 0x2208222, 0x00C0000, 0x0044000, 0x0000020,
+    0x0000020, 0x0000200, 0x1400200, 0x0001000, 0x084490C, 0x0181082, 0x0000820, 0x0A45894,
+    0x0042808, 0x0010000, 0x01C0004, 0x0015000, 0x0008000, 0x004C000, 0x0000080, 0x0180048,
+    0x0008020, 0x0100002, 0x0008000, 0x0000010, 0x0000020, 0x0640010, 0x4180000, 0x0080000,
+    0x0008020, 0x0004010, 0x0000020, 0x0000020, 0x0040000, 0x2000220, 0x0008220, 0x0100000,
+    0x0010080, 0x0001020, 0x0010000, 0x0008020, 0x0000222, 0x0050004, 0x0001000, 0x0000200,
+    0x0004000, 0x0000200, 0x0000200, 0x0040000, 0x0248000, 0x0550200, 0x0004000, 0x0040000,
+    0x0005000, 0x0008000, 0x0004000, 0x0000020, 0x0002002, 0x2000000, 0x0000020, 0x0000020,
+    0x0000020, 0x0001000, 0x0000008, 0x0040008, 0x0200000, 0x0050000, 0x0000002, 0x04008A6,
+    0x2000000, 0x0008022, 0x020C160, 0x0000100, 0x0008022, 0x0002000, 0x4080000, 0x0001220,
+    0x0004000, 0x0184090, 0x0008000, 0x0204000, 0x0001020, 0x0080008, 0x00C1020, 0x008A000,
+    0x0001100, 0x0208022, 0x0004010, 0x00C0220, 0x0000200, 0x0100000, 0x0040008, 0x0040000,
+    0x0000200, 0x0084000, 0x0001002, 0x0008000, 0x0000220, 0x0001020, 0x0000002, 0x0004002,
+    0x0208000, 0x0180002, 0x0008020, 0x0082000, 0x0008002, 0x0008020, 0x0080000, 0x0004000,
+    0x0008000, 0x0000020, 0x0000020, 0x0000220, 0x0008022, 0x0000220, 0x0017000, 0x0000200,
+    0x0000202, 0x0000202, 0x0200120, 0x0100000, 0x0000202, 0x0000200, 0x0084200, 0x0044000,
+    0x0000002, 0x0800200, 0x00C0A00, 0x0200000, 0x0004000, 0x0000800, 0x000D002, 0x0000100,
+    0x0000020, 0x0008808, 0x0001090, 0x00000A0, 0x0100000, 0x4141000, 0x0283830, 0x0004CB2,
+    0x004E8F4, 0x0180A22, 0x0108328, 0x0001010, 0x0001010, 0x0008020, 0x03C6818, 0x0008000,
+    0x0000800, 0x0000200, 0x0150048, 0x0008200, 0x0208222, 0x0004080, 0x010920A, 0x0100018,
+    0x21428A0, 0x0108020, 0x0000022, 0x0400020, 0x0000020, 0x0000400, 0x0000020, 0x0000030,
+    0x0040000, 0x0000240, 0x0008100, 0x0008000, 0x00018A4, 0x0000004, 0x0000090, 0x0102080,
+    0x0100018, 0x0100028, 0x41C619C, 0x0084022, 0x0196000, 0x090C88E, 0x00C4060, 0x01C0000,
+    0x0000004, 0x0000808, 0x00000A0, 0x0000040, 0x02082A2, 0x0005000, 0x0000020, 0x0301022,
+    0x0000004, 0x02048B8, 0x41C6824, 0x000C222, 0x0288000, 0x0100108, 0x0104080, 0x0001220,
+    0x6D84AB8, 0x0C00022, 0x00870BE, 0x098CA02, 0x0184200, 0x0000090, 0x0000040, 0x0001080,
+    0x0001000, 0x0001884, 0x0010000, 0x0104888, 0x00F5884, 0x0100924, 0x2100008, 0x0008000,
+    0x4000000, 0x0000002, 0x0080000, 0x0000002, 0x0001226, 0x0100102, 0x00400B0, 0x0000008,
+    0x0000060, 0x0000020, 0x2403800, 0x0010020, 0x018C032, 0x0008020, 0x055C8B6, 0x0100820,
+    0x0100028, 0x0081000, 0x0000220, 0x0080000, 0x0200002, 0x0000022, 0x0001020, 0x0100020,
+    0x01DF250, 0x08C206A, 0x0557038, 0x0ADAA08, 0x01460CC, 0x0002000, 0x0000002, 0x0040008,
+    0x0000220, 0x2C96218, 0x0840042, 0x0116048, 0x2F9609A, 0x000602C, 0x0000200, 0x0400200,
+    0x0181008, 0x0041000, 0x000880A, 0x0008022, 0x0000010, 0x0005040, 0x0000020, 0x0108232,
+    0x0012266, 0x0100AB8, 0x0115820, 0x00C0022, 0x00168B2, 0x0100020, 0x0055088, 0x0000020,
+    0x0001020, 0x0011020, 0x0000020, 0x6D960CC, 0x0892032, 0x008202C, 0x0A9C04A, 0x00C2070,
+    0x0000220, 0x0000040, 0x0111000, 0x0010200, 0x04C1234, 0x0010100, 0x0200220, 0x0001002,
+    0x0000200, 0x0000120, 0x0008010, 0x0000040, 0x0008080, 0x00C1000, 0x0001020, 0x0014020,
+    0x0000098, 0x0104820, 0x0200020, 0x0004004, 0x0000200, 0x0145000, 0x0300202, 0x0048802,
+    0x0012010, 0x0008022, 0x01800C8, 0x0501262, 0x0208200, 0x0180200, 0x0108000, 0x0000820,
+    0x0008020, 0x0000008, 0x0000022, 0x0900000, 0x0041000, 0x0108820, 0x0080000, 0x0001010,
+    0x0001020, 0x01008A2, 0x0090000, 0x01008A0, 0x0000908, 0x0180008, 0x0408022, 0x0040000,
+    0x0008080, 0x00C0000, 0x00022A0, 0x0005000, 0x0109020, 0x0008082, 0x0042000, 0x0000022,
+    0x0082800, 0x0100020, 0x0080084, 0x00C4030, 0x2916AC4, 0x008008A, 0x0415060, 0x0C9D200,
+    0x0016284, 0x0001022, 0x0001000, 0x0100902, 0x0101000, 0x0001000, 0x0012004, 0x00048A8,
+    0x0001020, 0x0280000, 0x0100800, 0x0000020, 0x0040000, 0x0001020, 0x0001020, 0x0105020,
+    0x0000020, 0x0000020, 0x0000002, 0x0002000, 0x0100048, 0x0000100, 0x0000008, 0x0104000,
+    0x0000088, 0x0100010, 0x0010000, 0x0000022, 0x0044000, 0x0140000, 0x0100400, 0x0208020,
+    0x0002000, 0x0008000, 0x0200000, 0x0008000, 0x0200000, 0x0040020, 0x0000008, 0x1000008,
+    0x0000202, 0x0008020, 0x0010008, 0x200C220, 0x0044000, 0x0001008, 0x0003008, 0x0040008,
+    0x0181000, 0x0008022, 0x0048000, 0x0041010, 0x0100020, 0x0008030, 0x0145000, 0x0000220,
+    0x0081000, 0x0004088, 0x010202A, 0x0981022, 0x0005000, 0x0008020, 0x0040020, 0x01C0000,
+    0x0000022, 0x0001010, 0x0004080, 0x0109000, 0x0202000, 0x0000018, 0x004C002, 0x020022A,
+    0x0200100, 0x0045040, 0x0100020, 0x0000180, 0x0103028, 0x0004A3A, 0x0040000, 0x0182020,
+    0x0100100, 0x0001000, 0x0000020, 0x29D6A8C, 0x088002A, 0x0154028, 0x0AD80AA, 0x0186A64,
+    0x0000024, 0x0003000, 0x0200002, 0x00000A0, 0x0081000, 0x0001A10, 0x0101010, 0x03028BE,
+    0x0080000, 0x0045000, 0x0000020, 0x2316288, 0x0188022, 0x41810A2, 0x4984288, 0x0002200,
+    0x0000080, 0x0200082, 0x0004890, 0x4049000, 0x0180020, 0x0001004, 0x0000040, 0x0105000,
+    0x0001022, 0x0202220, 0x0000480, 0x0000014, 0x0090020, 0x0008020, 0x4084090, 0x0010800,
+    0x0000800, 0x0080800, 0x0000210, 0x0002000, 0x0340220, 0x0000210, 0x0080000, 0x0200000,
+    0x0280000, 0x0000010, 0x0101030, 0x0012000, 0x0109010, 0x0102000, 0x0000020, 0x0002000,
+    0x40C6018, 0x0004022, 0x0104010, 0x0CCA006, 0x010A020, 0x0010000, 0x09C0000, 0x0001050,
+    0x40048A2, 0x0094870, 0x00900A0, 0x0100100, 0x0140080, 0x659625C, 0x2010026, 0x019F030,
+    0x0E98A02, 0x0006064, 0x0444000, 0x0080000, 0x0081010, 0x001104A, 0x0002004, 0x2004880,
+    0x0010000, 0x0200000, 0x0180100, 0x0180000, 0x0010000, 0x0080020, 0x0041800, 0x0509022,
+    0x0002020, 0x0000890, 0x0011000, 0x01D2830, 0x0110000, 0x0000028, 0x0005000, 0x0008020,
+    0x0000820, 0x0551010, 0x0001010, 0x00C0080, 0x041B200, 0x0044088, 0x0108014, 0x0000100,
+    0x0101000, 0x0100090, 0x0010000, 0x0040000, 0x0008004, 0x0200800, 0x0180008, 0x0200020,
+    0x0001030, 0x0008020, 0x0008820, 0x0114878, 0x0084012, 0x0100020, 0x0101020, 0x00C4080,
+    0x0000020, 0x0001010, 0x0000040, 0x0001802, 0x0218202, 0x0100808, 0x0141000, 0x0080800,
+    0x0004020, 0x0008020, 0x0000002, 0x0000004, 0x0005020, 0x0000002, 0x0008000, 0x0001000,
+    0x0008000, 0x0200002, 0x0002080, 0x0001020, 0x0014000, 0x0008000, 0x0200020, 0x0000220,
+    0x0050000, 0x0048220, 0x0000022, 0x0000220, 0x0200000, 0x0100020, 0x0040020, 0x0100000,
+    0x0000202, 0x0004000, 0x0000020, 0x0000100, 0x0000040, 0x0000080, 0x0002004, 0x0000022,
+    0x4050000, 0x0001000, 0x0040800, 0x0100000, 0x0000002, 0x0004880, 0x0080000, 0x0084000,
+    0x0101000, 0x0000080, 0x0081000, 0x0008080, 0x0000008, 0x0010004, 0x0100808, 0x0008000,
+    0x0218000, 0x0102002, 0x0040000, 0x0008002, 0x0000002, 0x0015000, 0x0000010, 0x0004800,
+    0x0000800, 0x010D000, 0x00008B0, 0x0080000, 0x0100120, 0x0100080, 0x0400008, 0x0001022,
+    0x0180048, 0x090100C, 0x0040000, 0x0005000, 0x0200042, 0x0004000, 0x4008000, 0x0000220,
+    0x0008220, 0x0000820, 0x0001020, 0x0140000, 0x0010026, 0x000083A, 0x0080220, 0x0400898,
+    0x0180020, 0x0100128, 0x0000090, 0x0000022, 0x0200020, 0x04D4858, 0x0040808, 0x0000282,
+    0x020A000, 0x0100010, 0x0100020, 0x0000020, 0x0000220, 0x0044000, 0x0040020, 0x0000A20,
+    0x0204080, 0x0100020, 0x0109002, 0x001C224, 0x01008A0, 0x0010200, 0x0111000, 0x0040120,
+    0x0000220, 0x0006000, 0x0106050, 0x0000026, 0x0208902, 0x00000A0, 0x0008220, 0x00000A0,
+    0x0196800, 0x0040230, 0x0080020, 0x0300000, 0x01D0080, 0x0001020, 0x0000002, 0x0040020,
+    0x0040A00, 0x0201000, 0x0010020, 0x000008A, 0x0200200, 0x0000AA8, 0x0000220, 0x0040122,
+    0x0001002, 0x0000200, 0x0202220, 0x4007010, 0x0101022, 0x0002006, 0x018DAA0, 0x01C1AAA,
+    0x0108820, 0x410012A, 0x0401000, 0x0000220, 0x0088004, 0x0105010, 0x0000202, 0x0100010,
+    0x0108030, 0x0008020, 0x0200010, 0x0800000, 0x00402A8, 0x0088002, 0x0040122, 0x0001020,
+    0x4000000, 0x0040802, 0x0080290, 0x0101878, 0x0000220, 0x0308ABA, 0x0100020, 0x0100030,
+    0x0140020, 0x0104000, 0x0000900, 0x0200022, 0x0200080, 0x00C1000, 0x0101032, 0x01088A2,
+    0x01C4038, 0x001C022, 0x0080020, 0x0108320, 0x01C5020, 0x0000220, 0x0200800, 0x0100040,
+    0x0101028, 0x0012004, 0x0000088, 0x0040802, 0x0180B20, 0x0100020, 0x4000002, 0x0000002,
+    0x0040000, 0x0040100, 0x0000200, 0x0401042, 0x0000024, 0x0010020, 0x0000808, 0x0100002,
+    0x010000A, 0x0400222, 0x0150000, 0x0010010, 0x0400010, 0x0200020, 0x0181020, 0x0000920,
+    0x0100040, 0x0000180, 0x0000004, 0x0104420, 0x0000020, 0x0040220, 0x0001000, 0x0000032,
+    0x00C0000, 0x00000A8, 0x0084804, 0x0102000, 0x0000028, 0x0000022, 0x0000040, 0x00000A0,
+    0x0200020, 0x0000120, 0x2080000, 0x0200000, 0x0000022, 0x0240000, 0x0000022, 0x0400000,
+    0x2010000, 0x0000220, 0x0004080, 0x0044000, 0x0204000, 0x0000220, 0x0105000, 0x0000220,
+    0x0000100, 0x01400B0, 0x0141000, 0x0003000, 0x0004000, 0x0100820, 0x0040010, 0x0000022,
+    0x0045000, 0x0093020, 0x0180AB2, 0x0010022, 0x01C082A, 0x0180100, 0x0180328, 0x0005020,
+    0x0000020, 0x0141808, 0x0000802, 0x0455800, 0x0008020, 0x010421A, 0x0542A08, 0x0108800,
+    0x0100022, 0x0000220, 0x0080080, 0x0080002, 0x0104000, 0x0001000, 0x0004000, 0x0008802,
+    0x0140008, 0x0009022, 0x030C8A8, 0x0204000, 0x0000220, 0x0180000, 0x010810A, 0x0000220,
+    0x4000000, 0x6184288, 0x0000006, 0x2914010, 0x0086088, 0x0182000, 0x0084000, 0x2009A22,
+    0x0012000, 0x00000B8, 0x0011168, 0x0010020, 0x01048A8, 0x0180220, 0x0144048, 0x2906000,
+    0x2092028, 0x448E0B8, 0x1E9F054, 0x0004010, 0x0001000, 0x0200000, 0x0000220, 0x0000820,
+    0x0000820, 0x0091020, 0x0010002, 0x0010202, 0x00C12A0, 0x0080100, 0x4000000, 0x20C1A58,
+    0x02C1020, 0x0155078, 0x0101200, 0x0000204, 0x0008202, 0x00000A2, 0x0085010, 0x0000002,
+    0x0010200, 0x01008B8, 0x0000220, 0x0010000, 0x0100220, 0x0000020, 0x0008020, 0x0053018,
+    0x0200222, 0x030800A, 0x2009210, 0x0401850, 0x0000022, 0x0004880, 0x0000200, 0x0000202,
+    0x0000202, 0x0100032, 0x0040000, 0x0009022, 0x0200002, 0x0108222, 0x0040208, 0x0200020,
+    0x0202002, 0x00000A0, 0x0101060, 0x0008300, 0x0001020, 0x0080890, 0x0000820, 0x4000020,
+    0x0000022, 0x00C6018, 0x0008220, 0x0000020, 0x0200020, 0x0001020, 0x0010022, 0x0182850,
+    0x0000220, 0x0008002, 0x01840A0, 0x0000032, 0x0001020, 0x0000900, 0x0000030, 0x0004000,
+    0x001A024, 0x01042A0, 0x0100920, 0x0049020, 0x0040800, 0x0001120, 0x00080A2, 0x0000200,
+    0x0105000, 0x0589022, 0x0000024, 0x00000B0, 0x0000A82, 0x2000222, 0x0104008, 0x0408020,
+    0x0157094, 0x0004000, 0x0802000, 0x0A5D040, 0x0208222, 0x0143054, 0x0143000, 0x0200082,
+    0x0052810, 0x4004000, 0x0001040, 0x0000220, 0x008C010, 0x0108202, 0x06002E0, 0x0300002,
+    0x2C579D8, 0x0000100, 0x0801232, 0x0557060, 0x0F5C02A, 0x0200020, 0x0184008, 0x2000000,
+    0x0000800, 0x0001020, 0x0400080, 0x0006300, 0x0109800, 0x02008A8, 0x0000020, 0x0080022,
+    0x0000022, 0x0100020, 0x0800220, 0x0557070, 0x0005002, 0x0000020, 0x2D96A8C, 0x0810030,
+    0x0116038, 0x09980A4, 0x01C60A0, 0x00C1008, 0x0001002, 0x0141000, 0x0101888, 0x0140000,
+    0x0050AC8, 0x0000022, 0x0110058, 0x0B48084, 0x00000C4, 0x0050800, 0x0000A00, 0x0100002,
+    0x0408222, 0x0004282, 0x0100800, 0x0140020, 0x01D5880, 0x29C6818, 0x084502A, 0x0545868,
+    0x0000202, 0x0348A00, 0x0208222, 0x0146010, 0x0000222, 0x25D7ACC, 0x0000200, 0x0956222,
+    0x0045068, 0x0E5FA0A, 0x0208222, 0x000605C, 0x0001000, 0x0140010, 0x0104000, 0x0001840,
+    0x0018002, 0x0204000, 0x0050020, 0x00010E0, 0x21D6284, 0x0011032, 0x40D70C0, 0x0148000,
+    0x0108008, 0x0009004, 0x0008A00, 0x0005080, 0x0209820, 0x0010020, 0x0080880, 0x0000222,
+    0x01DC030, 0x0100820, 0x0100020, 0x0014000, 0x0008220, 0x01C3808, 0x0000100, 0x0106000,
+    0x0001028, 0x0010000, 0x0188038, 0x0000220, 0x00C6000, 0x0040000, 0x0804000, 0x09C2268,
+    0x00440A8, 0x02C5000, 0x0208020, 0x0006090, 0x0000022, 0x0000120, 0x0101030, 0x01040A0,
+    0x014110A, 0x0080010, 0x0000012, 0x0200040, 0x0101000, 0x0000024, 0x00042A2, 0x0101000,
+    0x0080222, 0x0380008, 0x0000022, 0x0140088, 0x0004020, 0x0000200, 0x2896298, 0x2884822,
+    0x011F8AE, 0x2F1F000, 0x01870A8, 0x0000026, 0x0001200, 0x000A200, 0x0004222, 0x0414054,
+    0x0308000, 0x0104200, 0x0040022, 0x11C5088, 0x0008020, 0x0000002, 0x0048020, 0x0000002,
+    0x0040000, 0x0000202, 0x0201002, 0x0200220, 0x0000220, 0x0108040, 0x0000002, 0x0000222,
+    0x0000022, 0x0000220, 0x0000022, 0x0000200, 0x0000200, 0x0004000, 0x0040002, 0x0040000,
+    0x0200000, 0x0200000, 0x0608220, 0x0008220, 0x0005000, 0x0050000, 0x0000022, 0x0005000,
+    0x0200012, 0x0308012, 0x0580084, 0x0005000, 0x0008200, 0x0001020, 0x2000020, 0x0001000,
+    0x0200022, 0x0108222, 0x0040002, 0x0000202, 0x0000002, 0x0000800, 0x0001018, 0x0100020,
+    0x0000020, 0x0400000, 0x0000800, 0x00002B0, 0x0008020, 0x0585040, 0x0101830, 0x0105830,
+    0x0116030, 0x0110100, 0x0100028, 0x0445000, 0x0094810, 0x0040080, 0x0181010, 0x0000018,
+    0x0143008, 0x0145022, 0x01D7048, 0x00D9000, 0x0108020, 0x0001000, 0x0101030, 0x00088B8,
+    0x0010120, 0x0100108, 0x0000050, 0x0000026, 0x4081070, 0x01C3810, 0x0005000, 0x0110008,
+    0x008400A, 0x0184000, 0x0104000, 0x0040000, 0x0008020, 0x0000900, 0x0004010, 0x00C0100,
+    0x0000080, 0x0011000, 0x0000200, 0x0000020, 0x0144000, 0x0000808, 0x0000800, 0x0240000,
+    0x00000A8, 0x0000100, 0x0000800, 0x0100000, 0x0000120, 0x0000020, 0x2080000, 0x0002000,
+    0x0080000, 0x0040000, 0x4000000, 0x0080010, 0x0008000, 0x0000080, 0x0004000, 0x0000010,
+    0x0001000, 0x0040010, 0x0200000, 0x1104000, 0x0004020, 0x1000000, 0x0800000, 0x2000000,
+    0x00C0010, 0x0001020, 0x0000200, 0x0001010, 0x2900000, 0x0000002, 0x00000A0, 0x0000040,
+    0x0008020, 0x2000020, 0x0041000, 0x0000022, 0x0003000, 0x0080008, 0x0081000, 0x0104000,
+    0x00C4010, 0x0840010, 0x0000008, 0x0184000, 0x0108000, 0x0180000, 0x0000030, 0x0085008,
+    0x0080020, 0x0088000, 0x1180000, 0x0010000, 0x0006000, 0x2080020, 0x0102000, 0x01C0010,
+    0x0100002, 0x00C0000, 0x0000818, 0x0100020, 0x0140800, 0x0010010, 0x0000A90, 0x0080800,
+    0x0012010, 0x2084000, 0x21C0010, 0x0180004, 0x0000880, 0x2080100, 0x0041010, 0x0004010,
+    0x0080100, 0x0005000, 0x0002810, 0x0040040, 0x20008A0, 0x0084000, 0x0100010, 0x2080002,
+    0x0008100, 0x20C0010, 0x0080002, 0x0009000, 0x0003004, 0x0080200, 0x0000004, 0x0000060,
+    0x0044000, 0x2182010, 0x0002020, 0x0110000, 0x0050800, 0x0001210, 0x0010020, 0x00888A2,
+    0x0050000, 0x0090000, 0x0045000, 0x0001008, 0x0080880, 0x0190100, 0x0144000, 0x0000024,
+    0x0000820, 0x1400200, 0x10C0018, 0x2080010, 0x01C0000, 0x21C4010, 0x0002800, 0x0011810,
+    0x0004800, 0x0084010, 0x0101000, 0x0010004, 0x0100120, 0x0100008, 0x0008022, 0x20C0000,
+    0x0100080, 0x2001040, 0x2040000, 0x0084204, 0x2088000, 0x2008000, 0x0008002, 0x0085000,
+    0x0042010, 0x2001000, 0x0011000, 0x00C1010, 0x00C4000, 0x2000002, 0x0410000, 0x2100000,
+    0x0040020, 0x0200020, 0x2000100, 0x0000900, 0x0140000, 0x0008008, 0x2080120, 0x0000808,
+    0x0180010, 0x0100100, 0x0081030, 0x0084002, 0x0000220, 0x0012000, 0x0104010, 0x0100030,
+    0x0082010, 0x2000010, 0x0081010, 0x1040000, 0x0041020, 0x1100000, 0x0082000, 0x000400A,
+    0x10C0010, 0x000000A, 0x2008022, 0x2180000, 0x00C8010, 0x0083000, 0x0181000, 0x0080022,
+    0x2000200, 0x20C2010, 0x00C0012, 0x0881000, 0x2080022, 0x0040030, 0x0180820, 0x0002100,
+    0x2090024, 0x0100800, 0x0000300, 0x2004000, 0x0180020, 0x0100820, 0x0000122, 0x1008200,
+    0x00C5010, 0x0008200, 0x3000000, 0x0900000, 0x01C4010, 0x0080080, 0x2010030, 0x2090060,
+    0x0012080, 0x0800020, 0x0000090, 0x0002004, 0x2101020, 0x0010830, 0x0154000, 0x0001040,
+    0x0140820, 0x0180800, 0x0104020, 0x0800010, 0x0000084, 0x0880000, 0x0001800, 0x0110800,
+    0x2008020, 0x0001860, 0x0110810, 0x0080820, 0x0040800, 0x0045840, 0x0900014, 0x0000014,
+    0x0044010, 0x0001820, 0x0000810, 0x0003810, 0x0051010, 0x0101020, 0x0100880, 0x0010002,
+    0x0011010, 0x2002820, 0x2810000, 0x0810000, 0x0012002, 0x0180880, 0x0010200, 0x0102010,
+    0x0014000, 0x0004030, 0x0048000, 0x0188200, 0x00808A0, 0x0800024, 0x0004008, 0x0105000,
+    0x0144010, 0x0010800, 0x2002000, 0x2010000, 0x0000202, 0x0001004, 0x4080000, 0x0012800,
+    0x00C1000,
+};
+
+const uint16_t DictionaryDawg_firstEdge[1433] =
+{
+        0,    26,    50,    59,    69,    79,   102,   110,   122,   130,   143,   148,
+      159,   167,   173,   180,   203,   215,   216,   222,   238,   249,   259,   266,
+      273,   280,   285,   290,   291,   300,   308,   316,   319,   323,   331,   333,
+      339,   351,   359,   368,   369,   377,   378,   390,   398,   403,   409,   414,
+      419,   422,   423,   424,   440,   456,   457,   473,   478,   498,   503,   518,
+      524,   542,   548,   554,   563,   570,   592,   598,   608,   614,   615,   630,
+      631,   649,   650,   667,   688,   694,   709,   711,   715,   720,   722,   724,
+      728,   729,   730,   732,   734,   735,   744,   752,   761,   764,   765,   771,
+      773,   775,   776,   780,   781,   788,   790,   810,   824,   839,   840,   846,
+      860,   866,   877,   894,   904,   906,   918,   924,   925,   927,   939,   944,
+      956,   960,   961,   981,   982,   993,  1003,  1022,  1023,  1032,  1038,  1039,
+     1042,  1047,  1048,  1051,  1054,  1068,  1071,  1072,  1076,  1078,  1080,  1082,
+     1094,  1103,  1111,  1121,  1129,  1138,  1139,  1147,  1148,  1157,  1158,  1163,
+     1167,  1170,  1171,  1173,  1191,  1204,  1220,  1221,  1239,  1253,  1254,  1260,
+     1280,  1293,  1306,  1323,  1335,  1338,  1351,  1363,  1374,  1389,  1390,  1397,
+     1399,  1403,  1406,  1411,  1414,  1415,  1417,  1420,  1422,  1424,  1426,  1430,
+     1432,  1436,  1439,  1443,  1451,  1452,  1454,  1459,  1463,  1466,  1468,  1469,
+     1486,  1500,  1506,  1524,  1529,  1546,  1551,  1556,  1568,  1569,  1573,  1574,
+     1579,  1598,  1619,  1622,  1636,  1653,  1666,  1686,  1693,  1709,  1717,  1731,
+     1737,  1743,  1748,  1753,  1767,  1774,  1775,  1783,  1795,  1800,  1804,  1820,
+     1832,  1839,  1854,  1873,  1879,  1891,  1894,  1898,  1899,  1900,  1903,  1906,
+     1920,  1923,  1926,  1931,  1935,  1936,  1945,  1954,  1969,  1978,  1979,  1980,
+     1994,  2002,  2007,  2021,  2031,  2037,  2039,  2041,  2042,  2043,  2044,  2047,
+     2048,  2055,  2060,  2062,  2071,  2075,  2076,  2080,  2083,  2084,  2087,  2088,
+     2092,  2094,  2096,  2097,  2098,  2099,  2103,  2106,  2107,  2109,  2111,  2112,
+     2113,  2114,  2117,  2120,  2121,  2123,  2125,  2126,  2128,  2131,  2134,  2135,
+     2136,  2137,  2138,  2139,  2140,  2143,  2148,  2149,  2150,  2152,  2153,  2154,
+     2155,  2157,  2158,  2159,  2160,  2161,  2162,  2163,  2165,  2166,  2168,  2169,
+     2175,  2176,  2179,  2185,  2186,  2189,  2190,  2192,  2195,  2196,  2201,  2202,
+     2204,  2206,  2208,  2212,  2215,  2217,  2221,  2223,  2227,  2228,  2229,  2231,
+     2232,  2233,  2235,  2237,  2238,  2240,  2242,  2243,  2245,  2247,  2250,  2252,
+     2254,  2256,  2258,  2259,  2260,  2261,  2262,  2263,  2265,  2268,  2270,  2274,
+     2275,  2277,  2279,  2282,  2283,  2285,  2286,  2289,  2291,  2292,  2294,  2298,
+     2299,  2300,  2301,  2305,  2306,  2307,  2310,  2313,  2315,  2316,  2320,  2327,
+     2334,  2344,  2350,  2356,  2358,  2360,  2362,  2371,  2372,  2373,  2374,  2379,
+     2381,  2386,  2388,  2394,  2397,  2404,  2407,  2409,  2411,  2412,  2413,  2414,
+     2416,  2417,  2419,  2421,  2422,  2427,  2428,  2430,  2433,  2436,  2439,  2450,
+     2454,  2459,  2468,  2473,  2476,  2477,  2479,  2481,  2482,  2488,  2490,  2491,
+     2496,  2497,  2504,  2513,  2518,  2521,  2524,  2527,  2530,  2543,  2547,  2557,
+     2565,  2569,  2571,  2572,  2574,  2575,  2579,  2580,  2585,  2594,  2599,  2602,
+     2603,  2604,  2605,  2606,  2607,  2612,  2615,  2619,  2620,  2622,  2623,  2628,
+     2630,  2637,  2639,  2651,  2654,  2657,  2659,  2661,  2662,  2664,  2666,  2668,
+     2670,  2681,  2689,  2699,  2709,  2717,  2718,  2719,  2721,  2723,  2733,  2737,
+     2743,  2756,  2761,  2762,  2764,  2768,  2770,  2774,  2777,  2778,  2781,  2782,
+     2788,  2795,  2802,  2808,  2812,  2820,  2822,  2828,  2829,  2831,  2834,  2835,
+     2848,  2855,  2860,  2869,  2875,  2877,  2878,  2881,  2883,  2891,  2893,  2896,
+     2898,  2899,  2901,  2903,  2904,  2906,  2909,  2911,  2914,  2917,  2921,  2923,
+     2925,  2926,  2930,  2934,  2938,  2941,  2944,  2949,  2956,  2959,  2962,  2964,
+     2966,  2968,  2969,  2971,  2973,  2975,  2979,  2980,  2982,  2984,  2989,  2991,
+     2995,  2998,  3001,  3005,  3006,  3008,  3010,  3014,  3016,  3020,  3023,  3025,
+     3027,  3030,  3032,  3035,  3040,  3051,  3055,  3061,  3069,  3075,  3078,  3079,
+     3083,  3085,  3086,  3089,  3094,  3096,  3098,  3100,  3101,  3102,  3104,  3106,
+     3110,  3111,  3112,  3113,  3114,  3117,  3118,  3119,  3121,  3123,  3125,  3126,
+     3128,  3130,  3132,  3134,  3137,  3138,  3139,  3140,  3141,  3142,  3144,  3145,
+     3147,  3149,  3151,  3153,  3158,  3160,  3162,  3165,  3167,  3170,  3173,  3175,
+     3178,  3180,  3183,  3187,  3189,  3191,  3194,  3199,  3205,  3207,  3209,  3211,
+     3214,  3216,  3218,  3220,  3223,  3225,  3227,  3231,  3236,  3238,  3242,  3244,
+     3246,  3251,  3258,  3259,  3263,  3265,  3266,  3267,  3280,  3285,  3291,  3301,
+     3310,  3312,  3314,  3316,  3318,  3320,  3324,  3327,  3337,  3338,  3341,  3342,
+     3351,  3356,  3363,  3371,  3373,  3374,  3377,  3381,  3385,  3388,  3390,  3391,
+     3394,  3397,  3401,  3403,  3405,  3408,  3410,  3415,  3417,  3418,  3420,  3422,
+     3423,  3428,  3430,  3431,  3432,  3434,  3435,  3439,  3441,  3445,  3447,  3448,
+     3449,  3456,  3459,  3462,  3470,  3474,  3475,  3479,  3482,  3488,  3495,  3499,
+     3501,  3504,  3517,  3522,  3531,  3540,  3545,  3548,  3549,  3552,  3557,  3559,
+     3563,  3564,  3565,  3568,  3570,  3571,  3573,  3576,  3582,  3584,  3587,  3589,
+     3597,  3599,  3601,  3603,  3605,  3607,  3613,  3615,  3618,  3624,  3628,  3632,
+     3633,  3635,  3638,  3639,  3640,  3642,  3644,  3647,  3649,  3652,  3654,  3657,
+     3665,  3669,  3671,  3674,  3678,  3679,  3681,  3682,  3685,  3690,  3693,  3696,
+     3698,  3700,  3702,  3703,  3704,  3707,  3708,  3709,  3710,  3711,  3713,  3715,
+     3717,  3719,  3720,  3722,  3724,  3726,  3730,  3732,  3734,  3735,  3737,  3739,
+     3740,  3742,  3743,  3744,  3745,  3746,  3747,  3749,  3751,  3754,  3755,  3757,
+     3758,  3759,  3762,  3763,  3765,  3767,  3768,  3770,  3772,  3773,  3775,  3778,
+     3779,  3782,  3785,  3786,  3788,  3789,  3792,  3793,  3795,  3796,  3800,  3804,
+     3805,  3808,  3810,  3812,  3815,  3819,  3824,  3825,  3827,  3830,  3831,  3833,
+     3835,  3838,  3840,  3842,  3844,  3848,  3853,  3856,  3861,  3864,  3868,  3870,
+     3872,  3874,  3883,  3886,  3889,  3892,  3894,  3896,  3897,  3899,  3901,  3903,
+     3906,  3909,  3911,  3915,  3921,  3925,  3927,  3930,  3933,  3935,  3937,  3942,
+     3945,  3950,  3952,  3955,  3957,  3963,  3967,  3969,  3971,  3976,  3978,  3979,
+     3981,  3984,  3986,  3988,  3991,  3993,  3998,  4000,  4004,  4006,  4007,  4011,
+     4016,  4020,  4023,  4032,  4042,  4046,  4052,  4054,  4056,  4059,  4063,  4065,
+     4067,  4071,  4073,  4075,  4076,  4081,  4084,  4088,  4090,  4091,  4094,  4098,
+     4105,  4107,  4117,  4119,  4122,  4125,  4127,  4129,  4132,  4134,  4137,  4142,
+     4148,  4155,  4160,  4162,  4167,  4173,  4175,  4177,  4179,  4183,  4186,  4188,
+     4191,  4197,  4199,  4201,  4202,  4203,  4205,  4206,  4210,  4212,  4214,  4216,
+     4218,  4221,  4225,  4228,  4230,  4232,  4234,  4238,  4241,  4243,  4245,  4246,
+     4250,  4251,  4254,  4255,  4258,  4260,  4263,  4267,  4269,  4271,  4273,  4274,
+     4276,  4278,  4280,  4282,  4283,  4285,  4287,  4289,  4290,  4292,  4294,  4296,
+     4298,  4300,  4302,  4305,  4307,  4308,  4313,  4316,  4318,  4319,  4322,  4324,
+     4326,  4329,  4334,  4342,  4345,  4352,  4355,  4361,  4364,  4365,  4370,  4372,
+     4378,  4380,  4386,  4393,  4396,  4399,  4401,  4403,  4405,  4407,  4408,  4409,
+     4412,  4415,  4419,  4427,  4429,  4431,  4433,  4438,  4440,  4441,  4449,  4451,
+     4457,  4462,  4465,  4467,  4474,  4476,  4480,  4486,  4488,  4494,  4498,  4503,
+     4508,  4514,  4524,  4537,  4539,  4540,  4541,  4543,  4545,  4547,  4551,  4553,
+     4556,  4562,  4564,  4565,  4574,  4579,  4588,  4591,  4593,  4596,  4599,  4603,
+     4604,  4606,  4612,  4614,  4615,  4618,  4619,  4621,  4627,  4631,  4636,  4641,
+     4646,  4648,  4651,  4652,  4654,  4656,  4660,  4661,  4665,  4667,  4672,  4675,
+     4677,  4680,  4682,  4686,  4689,  4691,  4695,  4697,  4699,  4701,  4707,  4710,
+     4711,  4713,  4715,  4718,  4724,  4726,  4728,  4733,  4736,  4738,  4740,  4742,
+     4743,  4748,  4753,  4757,  4761,  4763,  4766,  4770,  4771,  4774,  4781,  4783,
+     4786,  4790,  4794,  4797,  4800,  4809,  4810,  4812,  4820,  4825,  4832,  4836,
+     4839,  4844,  4846,  4848,  4850,  4854,  4858,  4864,  4867,  4881,  4882,  4888,
+     4897,  4908,  4910,  4914,  4915,  4916,  4918,  4920,  4924,  4928,  4933,  4934,
+     4937,  4939,  4941,  4944,  4954,  4957,  4958,  4971,  4975,  4982,  4990,  4997,
+     5001,  5003,  5006,  5011,  5013,  5020,  5022,  5027,  5034,  5037,  5040,  5042,
+     5044,  5049,  5053,  5055,  5058,  5066,  5076,  5083,  5092,  5094,  5100,  5105,
+     5110,  5113,  5128,  5129,  5138,  5144,  5157,  5162,  5168,  5169,  5172,  5174,
+     5177,  5180,  5182,  5185,  5189,  5199,  5204,  5213,  5216,  5219,  5222,  5225,
+     5228,  5233,  5235,  5238,  5241,  5249,  5252,  5254,  5256,  5259,  5266,  5267,
+     5270,  5273,  5274,  5280,  5282,  5286,  5287,  5289,  5298,  5303,  5308,  5311,
+     5315,  5317,  5319,  5323,  5327,  5333,  5335,  5337,  5339,  5341,  5343,  5348,
+     5350,  5354,  5358,  5360,  5364,  5366,  5367,  5377,  5384,  5396,  5406,  5414,
+     5417,  5419,  5422,  5426,  5432,  5435,  5438,  5441,  5449,  5451,  5452,  5455,
+     5456,  5457,  5459,  5462,  5465,  5467,  5470,  5471,  5474,  5476,  5478,  5480,
+     5481,  5482,  5483,  5485,  5486,  5487,  5488,  5493,  5496,  5498,  5500,  5502,
+     5504,  5507,  5512,  5517,  5519,  5521,  5523,  5525,  5526,  5529,  5534,  5536,
+     5538,  5539,  5540,  5543,  5545,  5546,  5547,  5548,  5552,  5554,  5560,  5565,
+     5571,  5577,  5580,  5583,  5587,  5592,  5594,  5598,  5600,  5605,  5611,  5620,
+     5625,  5628,  5629,  5633,  5639,  5642,  5645,  5647,  5650,  5656,  5663,  5665,
+     5668,  5672,  5675,  5677,  5678,  5680,  5682,  5684,  5687,  5688,  5690,  5691,
+     5692,  5695,  5697,  5698,  5700,
+};
+
+const uint16_t DictionaryDawg_edges[5703] =
+{
+        1,     2,     3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+       13,    14,    15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+       49,    50,    51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+       73,    74,    75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+       85,    86,    87,    88,    71,    89,    90,    91,    92,    93,    94,    95,
+       96,    97,    98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+      108,   109,   110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+      120,   121,   122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+      132,   133,   134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+      156,   157,   158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+      168,   169,   170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+      180,   181,   182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+      192,   193,   194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+      204,   205,   206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+      216,   217,   218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+      228,   229,   230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+      240,   241,   242,   243,    69,   244,   245,   246,    69,   247,   248,   249,
+      250,   251,   252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+      262,    71,   263,   264,   265,   266,   267,   268,   269,   165,   270,   271,
+      272,   273,   274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+      284,   285,   286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+      296,   297,   298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+      308,   309,   310,   299,   311,   312,   313,   314,   315,   316,   292,   317,
+      318,   319,   320,   321,   322,   323,   298,   324,   325,   326,   327,   328,
+      328,   329,   330,   331,   332,   292,   333,   334,   335,   336,   337,   338,
+      339,   340,   341,   342,   343,   344,   345,   346,   347,   348,   349,   327,
+      318,   350,   351,   352,   353,   354,   355,   356,   357,   358,   359,   360,
+      361,   362,   363,   364,   365,   366,   290,   327,   290,   367,   368,   369,
+      370,   371,   372,   373,   374,   341,   375,   376,   377,   291,   378,   379,
+      380,   381,   310,   366,   382,   383,   384,   385,   386,   387,   388,   346,
+      389,   390,   391,   366,   392,   393,   394,   395,   396,   327,   397,   398,
+      298,   312,   399,   315,   327,   400,   401,   402,   403,   404,   405,   326,
+      406,   407,   408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+      418,   419,   420,   421,   422,   392,   423,   424,   425,   426,   427,   428,
+      429,   329,   430,   431,   432,   433,   434,   435,   326,   436,   437,   438,
+      439,   327,   440,   363,   441,   442,   443,   444,   445,   446,   447,   448,
+      449,   450,   451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
+      461,   462,   463,   377,   292,   346,   464,   465,   466,   467,   468,   416,
+      469,   470,   471,   472,   473,   474,   475,   325,   476,   477,   478,   479,
+      292,   480,   432,   481,   298,   482,   298,   483,   484,   485,   486,   487,
+      488,   489,   300,   299,   490,   491,   492,   493,   494,   495,   496,   497,
+      498,   327,   499,   500,   501,   502,   404,   503,   504,   505,   506,   507,
+      508,   509,   346,   292,   510,   383,   330,   511,   374,   299,   512,   513,
+      514,   515,   516,   517,   518,   519,   520,   521,   522,   523,   524,   346,
+      525,   526,   527,   528,   529,   530,   531,   532,   533,   298,   534,   535,
+      536,   299,   537,   538,   539,   540,   541,   542,   543,   306,   544,   545,
+      396,   546,   389,   404,   547,   548,   549,   550,   312,   292,   551,   292,
+      552,   404,   432,   553,   554,   555,   556,   557,   558,   559,   560,   561,
+      562,   563,   564,   312,   392,   299,   396,   565,   566,   567,   568,   569,
+      366,   570,   571,   572,   573,   574,   448,   575,   576,   577,   356,   578,
+      298,   579,   580,   581,   582,   404,   545,   564,   326,   583,   584,   585,
+      291,   586,   587,   588,   589,   590,   480,   591,   416,   592,   593,   545,
+      594,   595,   346,   596,   299,   597,   598,   599,   600,   299,   601,   602,
+      298,   603,   538,   377,   604,   605,   606,   607,   608,   609,   610,   611,
+      299,   612,   545,   298,   613,   614,   615,   616,   617,   618,   330,   619,
+      298,   620,   621,   524,   432,   396,   298,   622,   623,   624,   625,   298,
+      327,   322,   346,   626,   627,   326,   628,   577,   313,   327,   328,   619,
+      292,   629,   630,   631,   321,   292,   632,   389,   633,   634,   633,   635,
+      356,   328,   323,   636,   637,   619,   638,   387,   630,   639,   640,   641,
+      642,   643,   644,   645,   641,   298,   646,   647,   648,   499,   630,   376,
+      291,   649,   650,   483,   292,   651,   291,   346,   291,   652,   653,   397,
+      432,   654,   428,   655,   656,   657,   658,   659,   432,   298,   329,   660,
+      661,   359,   545,   376,   662,   663,   664,   299,   665,   666,   404,   667,
+      668,   669,   312,   299,   670,   299,   671,   672,   673,   674,   675,   676,
+      677,   678,   404,   679,   524,   292,   292,   292,   404,   670,   680,   681,
+      682,   683,   684,   685,   686,   687,   688,   689,   690,   326,   480,   686,
+      691,   692,   693,   694,   695,   696,   697,   698,   699,   700,   701,   404,
+      702,   703,   704,   705,   706,   610,   299,   292,   707,   708,   709,   710,
+      711,   292,   416,   712,   610,   713,   613,   299,   714,   715,   716,   363,
+      480,   717,   718,   298,   719,   720,   721,   722,   610,   326,   723,   724,
+      725,   726,   428,   727,   292,   326,   432,   728,   729,   730,   731,   732,
+      733,   341,   734,   735,   404,   736,   318,   326,   737,   404,   738,   739,
+      374,   740,   741,   298,   742,   743,   744,   745,   746,   747,   748,   749,
+      356,   750,   509,   702,   689,   432,   292,   396,   751,   752,   753,   754,
+      755,   756,   312,   757,   758,   759,   760,   761,   762,   763,   545,   764,
+      765,   766,   767,   768,   769,   770,   771,   328,   299,   374,   346,   299,
+      772,   564,   416,   773,   341,   404,   774,   429,   298,   775,   776,   777,
+      778,   779,   780,   781,   782,   783,   784,   328,   624,   432,   785,   712,
+      786,   387,   787,   788,   772,   789,   790,   328,   326,   416,   489,   791,
+      326,   792,   793,   794,   326,   330,   299,   795,   796,   797,   712,   432,
+      392,   798,   799,   800,   801,   802,   803,   326,   804,   805,   806,   807,
+      808,   809,   772,   448,   810,   292,   811,   812,   813,   814,   815,   330,
+      591,   375,   396,   816,   817,   818,   819,   820,   312,   769,   821,   822,
+      326,   610,   823,   824,   332,   825,   769,   826,   644,   827,   828,   829,
+      830,   831,   832,   833,   376,   328,   834,   835,   836,   837,   838,   315,
+      839,   840,   366,   363,   303,   396,   327,   841,   842,   644,   843,   341,
+      299,   359,   376,   416,   299,   844,   845,   610,   846,   847,   346,   318,
+      327,   480,   312,   848,   849,   731,   322,   850,   404,   851,   428,   299,
+      810,   852,   404,   731,   853,   854,   299,   416,   325,   312,   855,   489,
+      856,   857,   858,   613,   327,   859,   860,   430,   861,   862,   290,   404,
+      298,   863,   298,   429,   312,   864,   865,   866,   867,   824,   303,   868,
+      869,   772,   870,   311,   456,   330,   328,   871,   872,   870,   298,   873,
+      874,   875,   416,   876,   311,   877,   878,   879,   880,   881,   882,   883,
+      366,   872,   627,   884,   823,   885,   886,   887,   870,   888,   889,   890,
+      292,   891,   298,   892,   893,   894,   895,   896,   897,   898,   899,   312,
+      584,   900,   299,   901,   712,   902,   387,   903,   904,   905,   906,   437,
+      735,   907,   311,   908,   909,   910,   911,   346,   912,   913,   629,   377,
+      914,   915,   916,   312,   917,   918,   919,   920,   921,   922,   923,   924,
+      925,   387,   926,   312,   613,   927,   928,   326,   929,   930,   931,   932,
+      489,   933,   934,   769,   935,   936,   552,   545,   690,   937,   938,   939,
+      940,   941,   387,   299,   298,   518,   323,   396,   749,   330,   942,   552,
+      943,   944,   945,   946,   947,   290,   690,   948,   949,   950,   329,   951,
+      952,   953,   954,   538,   327,   955,   956,   326,   957,   487,   958,   959,
+      960,   961,   962,   963,   964,   965,   966,   967,   968,   969,   970,   312,
+      545,   629,   299,   971,   972,   973,   974,   975,   976,   326,   977,   978,
+      979,   980,   981,   982,   640,   983,   984,   489,   985,   986,   987,   988,
+      989,   328,   313,   990,   737,   991,   845,   992,   993,   994,   312,   995,
+      996,   997,   998,   999,  1000,   399,   312,   863,  1001,  1002,  1003,   327,
+     1004,   322,  1005,  1006,  1007,  1008,  1009,  1010,   416,  1011,   319,   286,
+      312,  1012,   404,   404,  1013,  1014,   769,  1015,   577,  1016,  1017,   689,
+     1018,  1019,   768,  1020,  1021,   299,  1022,   416,  1023,   610,   321,  1024,
+      852,  1025,  1026,  1027,   526,  1028,   312,  1029,   483,  1030,   448,  1031,
+      299,   610,   456,   499,   851,   363,   749,  1032,   327,   364,  1033,  1034,
+      404,   298,  1035,   392,   670,   292,  1036,   365,   332,  1037,   769,  1038,
+      538,  1039,   326,   298,   396,   552,   328,   416,  1040,   366,  1041,   346,
+     1039,   845,  1042,   404,   292,   315,   363,   619,   327,   749,   299,   610,
+     1043,  1044,  1045,  1046,  1047,   366,   292,   392,   428,   311,  1048,   292,
+      292,   292,   629,   577,   404,  1049,   346,  1050,   391,   360,  1051,   396,
+      619,   328,   321,   291,  1052,  1053,  1054,   392,  1055,  1056,  1057,   448,
+     1058,  1059,  1060,  1061,  1062,   499,   326,  1063,   298,  1064,  1065,  1066,
+      934,  1067,   845,  1068,   404,  1069,   841,   768,  1070,  1071,  1072,  1073,
+     1074,   963,  1075,   829,  1076,  1077,  1078,  1079,  1080,   845,   396,   326,
+     1081,   772,  1082,  1083,  1084,   644,   416,  1085,  1086,   376,  1087,  1088,
+     1089,  1090,   299,  1091,  1092,   330,   797,   845,  1093,  1094,   489,  1095,
+     1096,  1097,  1098,  1099,  1100,  1101,   851,  1102,   292,   298,  1103,  1104,
+     1105,  1106,  1107,  1108,  1109,   481,   404,   330,  1110,  1111,   845,   810,
+     1112,  1113,  1114,   813,  1115,  1116,  1117,   387,   327,   731,   363,   298,
+      364,  1118,  1119,   564,  1120,  1121,  1122,  1123,   889,  1124,   404,  1125,
+     1126,  1127,   326,   689,  1128,  1129,  1130,   326,  1131,  1132,  1133,   365,
+     1134,   725,  1135,  1136,  1137,  1138,  1139,   835,  1140,   868,  1141,  1142,
+     1143,  1144,  1145,  1146,  1147,  1148,  1149,  1150,   499,  1151,   327,  1152,
+     1078,   509,   610,   889,  1153,  1154,  1155,  1156,   299,  1157,   404,   625,
+     1158,  1159,  1160,   934,  1161,  1162,   872,  1163,  1164,   610,  1165,  1166,
+      870,  1167,   489,  1168,  1169,  1170,   326,  1171,   934,  1172,  1173,  1174,
+      545,   448,  1175,   326,  1176,  1177,   323,   934,  1178,   851,  1179,  1180,
+     1181,   690,  1182,  1183,  1184,   690,  1185,  1186,  1187,   768,  1188,   374,
+     1189,  1190,  1191,   327,   298,   292,  1192,  1193,  1194,   363,  1195,  1196,
+     1197,  1198,   332,   404,  1199,  1200,   644,  1201,  1202,  1203,  1204,  1205,
+     1206,  1207,   625,   328,   326,  1208,  1209,  1210,  1211,  1212,  1213,  1214,
+      365,  1215,  1216,  1217,  1218,   404,  1219,  1220,   363,  1221,  1222,  1223,
+     1224,  1225,   326,   303,  1226,  1227,   934,  1228,  1229,  1230,  1231,  1232,
+     1233,  1234,   365,  1235,  1236,  1237,  1238,  1239,  1240,  1241,  1242,  1243,
+     1244,  1245,   292,  1246,   366,  1247,   845,   610,  1248,  1249,  1250,   768,
+     1251,  1252,   328,  1253,  1254,  1255,  1256,  1257,  1258,  1259,  1260,  1261,
+     1262,  1263,  1264,  1265,  1266,  1267,  1268,  1039,   416,   374,  1269,   510,
+     1270,  1271,  1272,  1273,  1274,  1275,  1209,  1276,  1277,  1278,  1279,   396,
+      749,  1280,   735,   415,  1281,  1282,   555,   627,  1283,   742,  1284,  1285,
+     1286,  1287,  1288,  1289,  1290,  1291,   322,  1292,  1293,  1294,   737,  1295,
+     1296,  1297,  1298,  1299,  1300,   387,  1301,   404,  1302,  1303,  1304,  1305,
+     1306,  1307,   509,  1301,   383,   416,  1308,   432,   545,  1309,   311,  1310,
+     1130,  1311,   374,   299,  1312,   480,  1313,   416,  1314,  1315,   366,  1316,
+     1222,   610,  1317,  1318,  1319,  1320,   644,  1321,  1322,  1323,  1324,  1325,
+      327,  1326,  1327,  1328,  1329,  1330,   582,  1331,   416,   387,  1332,  1333,
+     1334,   329,   644,  1335,   416,  1336,   298,  1337,  1338,  1339,   396,   298,
+     1340,  1340,   292,   499,   292,  1341,  1301,  1342,  1343,   327,  1344,  1345,
+     1346,  1347,  1348,  1349,  1350,  1351,  1352,  1353,  1354,  1355,   327,  1356,
+     1357,   328,   619,   392,   299,  1052,   712,   432,   292,   396,  1358,   312,
+     1359,   329,   292,  1077,  1360,  1361,  1362,   772,   298,  1363,   314,   533,
+     1364,  1365,  1366,  1367,  1368,  1369,  1370,   404,   330,   299,  1371,   298,
+     1224,  1163,   963,  1372,  1373,  1374,  1375,   292,  1376,  1377,  1378,  1379,
+      538,  1380,  1381,   644,  1382,  1383,   564,   326,   330,  1384,   479,  1385,
+     1386,  1387,   913,  1388,  1389,  1222,  1390,  1391,  1392,  1393,  1394,   326,
+     1222,   824,  1395,   712,  1396,   404,  1397,  1398,  1399,   689,  1400,  1401,
+     1402,  1403,   772,   416,  1404,  1405,   629,   311,  1406,  1131,  1407,   326,
+      326,  1408,  1409,   299,   538,   712,   538,  1410,  1411,   872,  1412,  1413,
+     1414,   538,   327,  1415,  1416,  1417,  1418,   396,   365,   582,   374,   363,
+      829,   545,  1419,   518,   518,   518,   519,  1420,   448,  1421,   824,  1381,
+      416,  1422,  1063,  1423,  1424,  1425,   298,   311,  1405,   298,   437,   428,
+     1426,  1427,   416,   416,   416,  1428,   610,  1429,  1430,   731,   404,   768,
+     1431,   346,   387,   366,   330,  1432,   768,   851,  1308,   341,   330,  1433,
+     1434,  1435,  1436,  1437,  1438,  1435,  1439,  1440,  1441,  1437,  1441,  1437,
+     1435,  1435,  1437,  1437,  1440,  1442,  1440,  1443,  1444,  1440,  1445,  1440,
+     1443,  1446,  1440,  1447,  1448,  1447,  1446,  1441,  1437,  1437,  1435,  1449,
+     1437,  1435,  1450,  1440,  1446,  1446,  1451,  1437,  1435,  1452,  1435,  1440,
+     1440,  1437,  1453,  1437,  1435,  1437,  1448,  1446,  1437,  1440,  1437,  1437,
+     1435,  1444,  1437,  1445,  1454,  1455,  1437,  1447,  1440,  1440,  1456,  1447,
+     1449,  1437,  1433,  1434,  1439,  1439,  1433,  1435,  1457,  1440,  1458,  1446,
+     1446,  1437,  1437,  1459,  1455,  1455,  1460,  1440,  1435,  1461,  1462,  1463,
+     1447,  1461,  1441,  1441,  1440,  1440,  1440,  1437,  1441,  1435,  1437,  1443,
+     1437,  1444,  1464,  1440,  1455,  1440,  1445,  1441,  1447,  1465,  1434,  1437,
+     1466,  1437,  1455,  1435,  1467,  1446,  1437,  1440,  1437,  1448,  1453,  1455,
+     1468,  1437,  1440,  1443,  1469,  1461,  1455,  1448,  1461,  1437,  1435,  1455,
+     1447,  1445,  1433,  1448,  1465,  1446,  1440,  1440,  1441,  1455,  1440,  1470,
+     1461,  1471,  1437,  1440,  1437,  1433,  1449,  1441,  1461,  1437,  1438,  1454,
+     1443,  1446,  1455,  1461,  1435,  1472,  1473,  1446,  1474,  1455,  1475,  1474,
+     1441,  1441,  1448,  1440,  1465,  1455,  1461,  1441,  1474,  1453,  1476,  1441,
+     1435,  1441,  1438,  1470,  1474,  1446,  1448,  1435,  1435,  1440,  1477,  1446,
+     1447,  1440,  1435,  1437,  1478,  1433,  1448,  1445,  1437,  1448,  1440,  1445,
+     1439,  1440,  1470,  1455,  1440,  1446,  1455,  1437,  1455,  1448,  1455,  1440,
+     1440,  1446,  1440,  1437,  1438,  1456,  1438,  1438,  1438,  1461,  1446,  1448,
+     1438,  1440,  1440,  1444,  1440,  1440,  1440,  1440,  1456,  1440,  1465,  1440,
+     1455,  1440,  1446,  1437,  1448,  1456,  1479,  1440,  1444,  1437,  1433,  1456,
+     1480,  1434,  1446,  1438,  1440,  1434,  1438,  1440,  1447,  1450,  1433,  1438,
+     1440,  1440,  1481,  1443,  1435,  1440,  1482,  1483,  1440,  1439,  1433,  1438,
+     1440,  1438,  1440,  1435,  1445,  1471,  1435,  1446,  1435,  1484,  1437,  1445,
+     1455,  1433,  1437,  1485,  1454,  1440,  1433,  1438,  1440,  1435,  1440,  1440,
+     1440,  1455,  1433,  1448,  1435,  1486,  1440,  1440,  1448,  1448,  1455,  1448,
+     1458,  1483,  1455,  1487,  1440,  1440,  1447,  1488,  1435,  1450,  1455,  1440,
+     1437,  1440,  1438,  1444,  1440,  1464,  1440,  1437,  1461,  1433,  1440,  1433,
+     1433,  1489,  1455,  1440,  1434,  1437,  1440,  1440,  1437,  1490,  1437,  1491,
+     1440,  1437,  1492,  1493,  1447,  1440,  1483,  1494,  1440,  1440,  1442,  1435,
+     1440,  1495,  1440,  1437,  1447,  1496,  1440,  1497,  1498,  1463,  1435,  1499,
+     1433,  1443,  1435,  1440,  1455,  1437,  1440,  1443,  1437,  1444,  1446,  1455,
+     1455,  1437,  1446,  1440,  1440,  1500,  1433,  1440,  1440,  1440,  1440,  1440,
+     1440,  1437,  1440,  1456,  1481,  1440,  1455,  1440,  1438,  1447,  1440,  1438,
+     1440,  1440,  1435,  1501,  1465,  1453,  1456,  1474,  1437,  1446,  1484,  1455,
+     1446,  1433,  1455,  1455,  1433,  1447,  1440,  1502,  1437,  1440,  1491,  1440,
+     1440,  1440,  1503,  1437,  1443,  1504,  1440,  1464,  1505,  1440,  1437,  1506,
+     1447,  1437,  1440,  1441,  1437,  1434,  1437,  1507,  1440,  1448,  1440,  1508,
+     1434,  1447,  1448,  1437,  1474,  1506,  1437,  1433,  1509,  1471,  1435,  1433,
+     1437,  1455,  1437,  1481,  1455,  1437,  1510,  1440,  1465,  1438,  1511,  1501,
+     1512,  1440,  1440,  1455,  1440,  1440,  1504,  1461,  1438,  1477,  1440,  1461,
+     1481,  1488,  1455,  1443,  1455,  1440,  1438,  1433,  1485,  1448,  1439,  1455,
+     1454,  1458,  1455,  1448,  1455,  1441,  1446,  1437,  1444,  1437,  1458,  1455,
+     1435,  1437,  1437,  1461,  1440,  1440,  1513,  1440,  1514,  1440,  1437,  1453,
+     1515,  1438,  1448,  1455,  1456,  1455,  1452,  1435,  1481,  1456,  1509,  1435,
+     1440,  1440,  1487,  1444,  1440,  1455,  1516,  1517,  1455,  1480,  1437,  1443,
+     1440,  1480,  1433,  1441,  1455,  1434,  1437,  1456,  1448,  1437,  1448,  1439,
+     1441,  1456,  1518,  1481,  1447,  1440,  1440,  1519,  1520,  1434,  1483,  1435,
+     1440,  1440,  1521,  1522,  1440,  1523,  1434,  1524,  1440,  1444,  1435,  1477,
+     1438,  1434,  1437,  1463,  1525,  1526,  1527,  1440,  1528,  1440,  1465,  1495,
+     1441,  1437,  1483,  1434,  1440,  1478,  1437,  1453,  1440,  1440,  1434,  1463,
+     1440,  1529,  1434,  1530,  1437,  1437,  1441,  1461,  1458,  1435,  1531,  1434,
+     1480,  1439,  1529,  1532,  1440,  1533,  1437,  1440,  1440,  1534,  1477,  1434,
+     1440,  1434,  1463,  1535,  1500,  1440,  1440,  1434,  1434,  1440,  1440,  1483,
+     1536,  1440,  1437,  1504,  1510,  1437,  1446,  1440,  1440,  1434,  1443,  1483,
+     1500,  1458,  1537,  1458,  1433,  1440,  1435,  1440,  1437,  1461,  1440,  1458,
+     1438,  1514,  1440,  1538,  1446,  1440,  1440,  1440,  1440,  1539,  1440,  1440,
+     1455,  1474,  1520,  1440,  1480,  1481,  1540,  1455,  1474,  1514,  1481,  1433,
+     1444,  1443,  1461,  1474,  1440,  1447,  1478,  1440,  1440,  1440,  1440,  1440,
+     1455,  1456,  1461,  1437,  1448,  1440,  1456,  1458,  1438,  1440,  1438,  1440,
+     1440,  1440,  1433,  1433,  1447,  1435,  1480,  1435,  1541,  1449,  1440,  1449,
+     1455,  1450,  1446,  1440,  1434,  1435,  1440,  1529,  1536,  1480,  1504,  1437,
+     1437,  1470,  1440,  1465,  1542,  1444,  1543,  1437,  1491,  1477,  1440,  1440,
+     1434,  1456,  1526,  1529,  1434,  1434,  1435,  1465,  1544,  1440,  1440,  1483,
+     1545,  1480,  1546,  1435,  1547,  1461,  1548,  1456,  1549,  1440,  1440,  1461,
+     1440,  1447,  1461,  1440,  1440,  1456,  1550,  1438,  1455,  1464,  1465,  1455,
+     1440,  1551,  1437,  1483,  1447,  1437,  1474,  1440,  1461,  1455,  1440,  1455,
+     1455,  1440,  1455,  1455,  1455,  1440,  1455,  1440,  1440,  1440,  1437,  1455,
+     1440,  1456,  1440,  1440,  1440,  1456,  1439,  1440,  1435,  1435,  1477,  1440,
+     1438,  1433,  1441,  1435,  1440,  1552,  1553,  1440,  1554,  1455,  1440,  1440,
+     1440,  1435,  1441,  1445,  1437,  1455,  1446,  1486,  1455,  1455,  1440,  1435,
+     1440,  1440,  1461,  1437,  1435,  1555,  1441,  1439,  1437,  1440,  1435,  1433,
+     1453,  1440,  1441,  1453,  1437,  1441,  1447,  1458,  1440,  1440,  1455,  1513,
+     1440,  1435,  1461,  1435,  1444,  1438,  1489,  1455,  1441,  1456,  1556,  1455,
+     1440,  1455,  1444,  1441,  1437,  1440,  1438,  1481,  1455,  1440,  1433,  1455,
+     1557,  1509,  1456,  1435,  1455,  1558,  1465,  1440,  1440,  1435,  1440,  1557,
+     1437,  1461,  1455,  1445,  1443,  1438,  1441,  1440,  1440,  1440,  1441,  1438,
+     1440,  1440,  1513,  1438,  1440,  1461,  1456,  1455,  1435,  1433,  1437,  1455,
+     1466,  1438,  1455,  1437,  1440,  1435,  1440,  1446,  1437,  1514,  1434,  1437,
+     1440,  1559,  1440,  1560,  1434,  1440,  1440,  1456,  1435,  1561,  1434,  1440,
+     1437,  1447,  1448,  1437,  1562,  1440,  1440,  1437,  1446,  1440,  1440,  1447,
+     1440,  1434,  1437,  1447,  1441,  1455,  1440,  1546,  1455,  1438,  1440,  1440,
+     1440,  1438,  1444,  1455,  1438,  1437,  1440,  1440,  1440,  1557,  1456,  1437,
+     1435,  1439,  1438,  1438,  1435,  1463,  1518,  1546,  1441,  1437,  1447,  1438,
+     1440,  1433,  1563,  1520,  1435,  1461,  1435,  1455,  1440,  1435,  1435,  1443,
+     1437,  1435,  1455,  1437,  1437,  1437,  1446,  1564,  1447,  1455,  1440,  1440,
+     1458,  1437,  1449,  1454,  1437,  1565,  1455,  1458,  1448,  1437,  1441,  1455,
+     1440,  1433,  1455,  1448,  1566,  1447,  1441,  1435,  1435,  1441,  1474,  1444,
+     1440,  1448,  1477,  1567,  1435,  1440,  1435,  1435,  1440,  1440,  1435,  1437,
+     1435,  1440,  1435,  1448,  1440,  1448,  1461,  1437,  1435,  1518,  1487,  1481,
+     1455,  1456,  1440,  1440,  1435,  1485,  1433,  1456,  1568,  1440,  1437,  1455,
+     1440,  1455,  1447,  1437,  1456,  1440,  1440,  1448,  1443,  1455,  1444,  1455,
+     1461,  1435,  1514,  1440,  1441,  1441,  1437,  1440,  1435,  1440,  1448,  1440,
+     1440,  1438,  1446,  1435,  1514,  1446,  1440,  1437,  1441,  1437,  1440,  1448,
+     1438,  1453,  1557,  1470,  1433,  1443,  1447,  1440,  1569,  1440,  1440,  1447,
+     1447,  1455,  1456,  1570,  1455,  1435,  1433,  1487,  1438,  1438,  1433,  1448,
+     1433,  1440,  1456,  1440,  1440,  1455,  1447,  1456,  1440,  1435,  1433,  1455,
+     1440,  1455,  1489,  1440,  1434,  1440,  1466,  1485,  1465,  1495,  1440,  1437,
+     1571,  1440,  1440,  1440,  1440,  1434,  1540,  1433,  1440,  1434,  1456,  1552,
+     1440,  1435,  1440,  1435,  1434,  1440,  1440,  1449,  1440,  1461,  1440,  1572,
+     1509,  1440,  1440,  1463,  1447,  1465,  1437,  1500,  1433,  1465,  1455,  1441,
+     1440,  1438,  1448,  1440,  1455,  1455,  1440,  1435,  1440,  1573,  1440,  1455,
+     1440,  1440,  1438,  1455,  1440,  1437,  1440,  1440,  1464,  1440,  1514,  1574,
+     1439,  1461,  1440,  1510,  1440,  1461,  1434,  1440,  1448,  1437,  1575,  1440,
+     1440,  1447,  1440,  1434,  1456,  1446,  1433,  1440,  1441,  1443,  1440,  1448,
+     1434,  1442,  1442,  1434,  1440,  1447,  1576,  1577,  1433,  1446,  1437,  1435,
+     1483,  1437,  1448,  1455,  1437,  1517,  1458,  1438,  1455,  1440,  1441,  1455,
+     1437,  1578,  1455,  1455,  1455,  1437,  1480,  1455,  1440,  1440,  1504,  1579,
+     1440,  1456,  1446,  1565,  1435,  1440,  1461,  1440,  1437,  1440,  1440,  1455,
+     1443,  1441,  1455,  1437,  1435,  1440,  1465,  1438,  1440,  1444,  1438,  1437,
+     1440,  1447,  1455,  1477,  1580,  1437,  1440,  1440,  1437,  1447,  1444,  1483,
+     1435,  1448,  1455,  1440,  1435,  1440,  1440,  1437,  1438,  1440,  1438,  1440,
+     1504,  1444,  1440,  1564,  1444,  1437,  1480,  1440,  1443,  1437,  1440,  1437,
+     1484,  1440,  1440,  1437,  1435,  1442,  1435,  1480,  1440,  1581,  1455,  1440,
+     1437,  1438,  1513,  1440,  1446,  1440,  1433,  1448,  1433,  1440,  1440,  1440,
+     1440,  1455,  1447,  1441,  1440,  1440,  1461,  1444,  1438,  1455,  1438,  1440,
+     1440,  1455,  1437,  1443,  1437,  1440,  1437,  1440,  1461,  1437,  1447,  1438,
+     1440,  1437,  1480,  1435,  1505,  1440,  1576,  1436,  1529,  1437,  1465,  1440,
+     1437,  1435,  1437,  1582,  1440,  1440,  1440,  1463,  1448,  1465,  1443,  1435,
+     1480,  1435,  1440,  1471,  1446,  1440,  1439,  1437,  1440,  1523,  1437,  1559,
+     1440,  1470,  1463,  1526,  1435,  1444,  1447,  1461,  1477,  1437,  1583,  1437,
+     1445,  1433,  1440,  1438,  1440,  1444,  1455,  1465,  1438,  1455,  1461,  1455,
+     1440,  1455,  1455,  1556,  1455,  1565,  1440,  1440,  1435,  1450,  1440,  1438,
+     1448,  1456,  1481,  1509,  1440,  1437,  1440,  1455,  1438,  1517,  1438,  1455,
+     1455,  1438,  1584,  1440,  1440,  1438,  1455,  1433,  1440,  1440,  1465,  1433,
+     1456,  1440,  1435,  1564,  1474,  1447,  1440,  1438,  1440,  1440,  1576,  1504,
+     1465,  1440,  1440,  1433,  1440,  1435,  1453,  1481,  1440,  1435,  1440,  1437,
+     1437,  1437,  1461,  1455,  1438,  1440,  1446,  1442,  1477,  1438,  1440,  1440,
+     1480,  1440,  1557,  1585,  1455,  1440,  1440,  1440,  1434,  1435,  1455,  1539,
+     1439,  1440,  1539,  1455,  1513,  1440,  1513,  1438,  1441,  1433,  1438,  1455,
+     1440,  1438,  1440,  1440,  1440,  1440,  1437,  1438,  1465,  1443,  1440,  1448,
+     1455,  1455,  1433,  1447,  1517,  1437,  1466,  1455,  1440,  1438,  1440,  1440,
+     1481,  1446,  1447,  1441,  1501,  1440,  1433,  1438,  1440,  1438,  1455,  1440,
+     1438,  1455,  1446,  1440,  1456,  1440,  1453,  1517,  1441,  1455,  1445,  1470,
+     1486,  1448,  1444,  1474,  1439,  1464,  1440,  1502,  1455,  1437,  1435,  1453,
+     1447,  1441,  1453,  1437,  1435,  1435,  1441,  1453,  1440,  1461,  1455,  1435,
+     1441,  1435,  1435,  1435,  1441,  1441,  1558,  1448,  1448,  1474,  1438,  1477,
+     1455,  1461,  1455,  1440,  1455,  1446,  1443,  1440,  1440,  1437,  1556,  1438,
+     1455,  1455,  1447,  1444,  1440,  1517,  1450,  1477,  1435,  1455,  1440,  1445,
+     1437,  1435,  1437,  1440,  1465,  1444,  1438,  1444,  1438,  1461,  1518,  1434,
+     1461,  1435,  1435,  1461,  1440,  1458,  1434,  1440,  1518,  1440,  1440,  1440,
+     1444,  1458,  1440,  1438,  1440,  1440,  1440,  1440,  1514,  1440,  1440,  1438,
+     1434,  1456,  1440,  1455,  1437,  1442,  1434,  1437,  1447,  1586,  1546,  1434,
+     1437,  1433,  1440,  1440,  1434,  1448,  1440,  1509,  1448,  1461,  1440,  1448,
+     1435,  1435,  1467,  1440,  1450,  1440,  1437,  1448,  1461,  1441,  1456,  1440,
+     1545,  1437,  1443,  1455,  1440,  1440,  1456,  1440,  1458,  1437,  1440,  1440,
+     1455,  1448,  1509,  1437,  1433,  1438,  1464,  1440,  1461,  1456,  1444,  1440,
+     1433,  1587,  1480,  1437,  1440,  1433,  1440,  1443,  1441,  1483,  1433,  1440,
+     1438,  1438,  1477,  1477,  1446,  1548,  1437,  1433,  1440,  1438,  1448,  1455,
+     1435,  1467,  1446,  1441,  1440,  1444,  1441,  1461,  1588,  1489,  1440,  1467,
+     1440,  1448,  1461,  1435,  1435,  1440,  1437,  1440,  1589,  1441,  1440,  1474,
+     1455,  1440,  1440,  1481,  1539,  1435,  1440,  1440,  1440,  1472,  1481,  1440,
+     1438,  1447,  1455,  1437,  1440,  1440,  1489,  1437,  1437,  1472,  1447,  1461,
+     1444,  1440,  1440,  1438,  1440,  1433,  1441,  1455,  1443,  1448,  1440,  1440,
+     1440,  1590,  1440,  1437,  1440,  1591,  1509,  1441,  1440,  1440,  1440,  1438,
+     1438,  1437,  1440,  1440,  1440,  1440,  1455,  1489,  1455,  1444,  1440,  1433,
+     1437,  1440,  1465,  1440,  1449,  1455,  1448,  1443,  1461,  1447,  1438,  1437,
+     1440,  1440,  1446,  1438,  1441,  1433,  1480,  1446,  1440,  1433,  1592,  1455,
+     1447,  1440,  1440,  1474,  1454,  1456,  1444,  1444,  1439,  1455,  1593,  1440,
+     1474,  1461,  1440,  1440,  1440,  1440,  1440,  1437,  1441,  1440,  1440,  1438,
+     1440,  1558,  1565,  1443,  1594,  1593,  1455,  1455,  1461,  1441,  1437,  1461,
+     1480,  1433,  1440,  1437,  1461,  1440,  1440,  1455,  1433,  1440,  1441,  1440,
+     1446,  1440,  1458,  1433,  1513,  1440,  1437,  1444,  1440,  1437,  1443,  1590,
+     1437,  1441,  1435,  1440,  1438,  1595,  1438,  1448,  1593,  1440,  1440,  1440,
+     1437,  1446,  1440,  1440,  1440,  1440,  1440,  1440,  1455,  1489,  1437,  1435,
+     1455,  1440,  1446,  1455,  1448,  1456,  1440,  1464,  1447,  1440,  1444,  1440,
+     1440,  1444,  1455,  1437,  1440,  1435,  1433,  1440,  1489,  1440,  1438,  1440,
+     1440,  1596,  1474,  1440,  1437,  1440,  1456,  1455,  1590,  1480,  1441,  1438,
+     1440,  1443,  1433,  1444,  1489,  1438,  1489,  1437,  1440,  1440,  1440,  1461,
+     1440,  1448,  1597,  1440,  1455,  1448,  1440,  1437,  1435,  1466,  1438,  1440,
+     1438,  1440,  1447,  1455,  1440,  1440,  1440,  1433,  1433,  1438,  1447,  1440,
+     1440,  1437,  1440,  1561,  1470,  1440,  1446,  1433,  1455,  1455,  1598,  1440,
+     1463,  1441,  1444,  1443,  1510,  1510,  1446,  1465,  1433,  1456,  1437,  1438,
+     1440,  1440,  1458,  1577,  1443,  1440,  1458,  1444,  1455,  1440,  1433,  1599,
+     1448,  1438,  1458,  1456,  1455,  1474,  1455,  1455,  1438,  1456,  1440,  1434,
+     1455,  1504,  1433,  1444,  1437,  1441,  1447,  1440,  1440,  1437,  1455,  1456,
+     1440,  1455,  1440,  1438,  1448,  1455,  1448,  1433,  1455,  1448,  1470,  1445,
+     1455,  1440,  1440,  1433,  1438,  1440,  1438,  1465,  1441,  1440,  1466,  1455,
+     1455,  1440,  1441,  1437,  1440,  1455,  1455,  1461,  1435,  1600,  1440,  1461,
+     1455,  1433,  1458,  1441,  1447,  1464,  1465,  1448,  1455,  1440,  1480,  1465,
+     1437,  1440,  1440,  1440,  1438,  1440,  1437,  1440,  1433,  1433,  1443,  1480,
+     1448,  1463,  1489,  1437,  1503,  1439,  1446,  1440,  1437,  1440,  1441,  1448,
+     1435,  1440,  1441,  1448,  1449,  1437,  1458,  1440,  1520,  1437,  1461,  1440,
+     1440,  1461,  1462,  1439,  1447,  1474,  1440,  1445,  1437,  1447,  1435,  1444,
+     1444,  1449,  1444,  1437,  1461,  1440,  1455,  1437,  1437,  1440,  1437,  1601,
+     1440,  1440,  1455,  1437,  1446,  1456,  1440,  1477,  1440,  1602,  1438,  1438,
+     1517,  1455,  1453,  1461,  1586,  1440,  1474,  1455,  1455,  1481,  1603,  1441,
+     1600,  1440,  1433,  1456,  1511,  1455,  1437,  1438,  1461,  1437,  1604,  1433,
+     1564,  1440,  1444,  1455,  1455,  1447,  1440,  1440,  1605,  1436,  1438,  1440,
+     1470,  1438,  1446,  1440,  1440,  1440,  1440,  1438,  1440,  1437,  1440,  1437,
+     1448,  1437,  1440,  1440,  1465,  1440,  1433,  1448,  1438,  1440,  1455,  1440,
+     1440,  1455,  1440,  1481,  1448,  1441,  1455,  1437,  1435,  1437,  1437,  1448,
+     1433,  1465,  1444,  1461,  1444,  1440,  1438,  1435,  1437,  1440,  1455,  1463,
+     1443,  1440,  1435,  1436,  1539,  1440,  1556,  1565,  1446,  1481,  1483,  1440,
+     1440,  1487,  1435,  1455,  1437,  1440,  1433,  1438,  1446,  1461,  1448,  1437,
+     1461,  1437,  1437,  1582,  1606,  1607,  1485,  1440,  1461,  1576,  1480,  1440,
+     1434,  1440,  1440,  1440,  1440,  1434,  1440,  1608,  1434,  1433,  1440,  1455,
+     1440,  1435,  1437,  1441,  1456,  1444,  1461,  1440,  1440,  1529,  1455,  1440,
+     1465,  1440,  1440,  1440,  1433,  1447,  1440,  1440,  1440,  1440,  1440,  1565,
+     1433,  1443,  1455,  1438,  1481,  1440,  1513,  1435,  1437,  1440,  1433,  1440,
+     1447,  1440,  1440,  1440,  1500,  1480,  1446,  1440,  1437,  1446,  1440,  1440,
+     1440,  1440,  1536,  1437,  1456,  1440,  1526,  1435,  1520,  1522,  1455,  1437,
+     1437,  1440,  1440,  1437,  1481,  1462,  1463,  1440,  1465,  1447,  1437,  1470,
+     1455,  1437,  1437,  1439,  1447,  1440,  1469,  1440,  1440,  1443,  1461,  1443,
+     1440,  1438,  1437,  1440,  1440,  1457,  1448,  1455,  1568,  1437,  1440,  1440,
+     1440,  1437,  1455,  1455,  1442,  1434,  1440,  1463,  1448,  1465,  1439,  1609,
+     1610,  1440,  1520,  1448,  1611,  1435,  1437,  1434,  1440,  1435,  1463,  1546,
+     1612,  1440,  1613,  1480,  1471,  1448,  1614,  1458,  1447,  1441,  1615,  1446,
+     1440,  1443,  1461,  1440,  1440,  1438,  1437,  1433,  1437,  1440,  1433,  1455,
+     1437,  1465,  1440,  1440,  1456,  1447,  1438,  1456,  1444,  1455,  1616,  1447,
+     1446,  1577,  1539,  1590,  1440,  1440,  1590,  1441,  1448,  1447,  1477,  1483,
+     1437,  1446,  1617,  1441,  1455,  1447,  1455,  1453,  1437,  1438,  1440,  1440,
+     1440,  1437,  1448,  1453,  1446,  1458,  1440,  1445,  1618,  1549,  1483,  1589,
+     1448,  1440,  1454,  1440,  1445,  1455,  1448,  1455,  1440,  1446,  1446,  1435,
+     1619,  1471,  1454,  1440,  1433,  1437,  1557,  1546,  1437,  1440,  1437,  1439,
+     1489,  1465,  1441,  1440,  1437,  1440,  1435,  1447,  1441,  1443,  1440,  1440,
+     1440,  1440,  1437,  1564,  1438,  1440,  1455,  1448,  1620,  1433,  1440,  1440,
+     1440,  1440,  1435,  1443,  1446,  1435,  1444,  1441,  1437,  1440,  1440,  1446,
+     1444,  1440,  1440,  1440,  1440,  1438,  1435,  1440,  1440,  1446,  1440,  1441,
+     1440,  1436,  1447,  1491,  1480,  1446,  1455,  1502,  1440,  1437,  1437,  1440,
+     1455,  1441,  1621,  1461,  1446,  1455,  1441,  1440,  1440,  1440,  1474,  1455,
+     1438,  1440,  1455,  1440,  1438,  1441,  1437,  1435,  1467,  1440,  1461,  1440,
+     1450,  1455,  1440,  1489,  1455,  1440,  1518,  1440,  1435,  1433,  1447,  1440,
+     1455,  1446,  1461,  1438,  1464,  1461,  1438,  1438,  1441,  1440,  1446,  1437,
+     1440,  1455,  1455,  1443,  1446,  1441,  1465,  1461,  1437,  1456,  1554,  1455,
+     1440,  1440,  1440,  1622,  1529,  1477,  1437,  1623,  1440,  1491,  1444,  1461,
+     1463,  1447,  1437,  1523,  1437,  1452,  1572,  1470,  1624,  1625,  1581,  1626,
+     1627,  1461,  1440,  1463,  1448,  1440,  1463,  1437,  1440,  1438,  1440,  1440,
+     1446,  1465,  1439,  1438,  1440,  1440,  1440,  1440,  1437,  1437,  1455,  1440,
+     1446,  1440,  1440,  1461,  1441,  1437,  1448,  1461,  1455,  1461,  1441,  1440,
+     1437,  1463,  1439,  1464,  1457,  1440,  1483,  1434,  1485,  1435,  1440,  1440,
+     1465,  1628,  1480,  1434,  1437,  1629,  1437,  1468,  1440,  1458,  1507,  1440,
+     1630,  1434,  1631,  1509,  1456,  1435,  1448,  1440,  1485,  1440,  1632,  1440,
+     1440,  1546,  1434,  1440,  1437,  1633,  1440,  1634,  1440,  1435,  1437,  1497,
+     1635,  1636,  1434,  1477,  1433,  1440,  1448,  1481,  1443,  1437,  1437,  1437,
+     1477,  1448,  1461,  1440,  1438,  1438,  1440,  1438,  1437,  1637,  1480,  1440,
+     1440,  1545,  1448,  1440,  1455,  1441,  1443,  1489,  1570,  1435,  1446,  1440,
+     1440,  1456,  1463,  1448,  1529,  1477,  1440,  1435,  1480,  1437,  1440,  1638,
+     1434,  1455,  1440,  1434,  1440,  1446,  1437,  1440,  1552,  1440,  1433,  1485,
+     1437,  1440,  1440,  1440,  1639,  1435,  1440,  1536,  1437,  1441,  1485,  1500,
+     1440,  1440,  1440,  1440,  1440,  1483,  1480,  1433,  1504,  1440,  1443,  1440,
+     1529,  1500,  1529,  1433,  1440,  1434,  1448,  1435,  1433,  1441,  1546,  1465,
+     1434,  1436,  1434,  1440,  1640,  1435,  1437,  1463,  1440,  1434,  1450,  1440,
+     1448,  1465,  1440,  1641,  1434,  1441,  1434,  1437,  1463,  1480,  1440,  1440,
+     1440,  1642,  1491,  1440,  1435,  1438,  1440,  1463,  1440,  1440,  1438,  1440,
+     1444,  1440,  1440,  1455,  1441,  1443,  1447,  1440,  1437,  1441,  1440,  1474,
+     1455,  1440,  1570,  1489,  1455,  1514,  1433,  1440,  1440,  1447,  1438,  1440,
+     1437,  1433,  1437,  1437,  1437,  1440,  1495,  1643,  1439,  1480,  1446,  1440,
+     1644,  1495,  1447,  1546,  1510,  1439,  1440,  1485,  1586,  1463,  1465,  1546,
+     1485,  1465,  1480,  1440,  1567,  1435,  1448,  1437,  1645,  1491,  1440,  1435,
+     1567,  1437,  1445,  1445,  1437,  1440,  1465,  1434,  1475,  1461,  1646,  1437,
+     1647,  1440,  1434,  1463,  1485,  1648,  1437,  1649,  1483,  1650,  1433,  1606,
+     1433,  1480,  1437,  1440,  1444,  1651,  1652,  1446,  1440,  1476,  1440,  1446,
+     1440,  1440,  1434,  1440,  1463,  1653,  1654,  1440,  1435,  1434,  1474,  1437,
+     1437,  1655,  1465,  1656,  1440,  1657,  1523,  1437,  1440,  1658,  1659,  1660,
+     1483,  1486,  1440,  1434,  1438,  1463,  1529,  1661,  1580,  1437,  1440,  1455,
+     1445,  1480,  1461,  1438,  1455,  1474,  1440,  1440,  1455,  1483,  1441,  1448,
+     1461,  1441,  1440,  1437,  1455,  1440,  1440,  1446,  1662,  1495,  1440,  1663,
+     1433,  1504,  1440,  1572,  1437,  1523,  1448,  1435,  1435,  1440,  1448,  1440,
+     1462,  1437,  1448,  1433,  1442,  1664,  1665,  1440,  1504,  1447,  1433,  1455,
+     1467,  1666,  1435,  1438,  1440,  1461,  1440,  1435,  1440,  1438,  1455,  1446,
+     1440,  1456,  1440,  1556,  1440,  1455,  1440,  1456,  1441,  1455,  1443,  1440,
+     1477,  1440,  1455,  1458,  1438,  1441,  1440,  1465,  1441,  1455,  1435,  1437,
+     1456,  1440,  1446,  1433,  1440,  1440,  1440,  1438,  1437,  1440,  1438,  1440,
+     1438,  1433,  1444,  1453,  1438,  1667,  1433,  1440,  1435,  1520,  1437,  1504,
+     1437,  1447,  1440,  1440,  1455,  1437,  1461,  1536,  1440,  1461,  1440,  1435,
+     1441,  1437,  1522,  1437,  1461,  1440,  1434,  1463,  1433,  1668,  1447,  1437,
+     1445,  1446,  1437,  1440,  1625,  1669,  1439,  1440,  1440,  1547,  1434,  1448,
+     1443,  1441,  1435,  1437,  1456,  1440,  1504,  1440,  1480,  1455,  1440,  1446,
+     1433,  1437,  1437,  1437,  1455,  1438,  1435,  1455,  1455,  1440,  1440,  1440,
+     1455,  1440,  1440,  1448,  1456,  1440,  1474,  1437,  1440,  1504,  1442,  1568,
+     1474,  1455,  1433,  1444,  1480,  1440,  1448,  1584,  1433,  1433,  1440,  1440,
+     1502,  1440,  1670,  1613,  1437,  1458,  1671,  1529,  1440,  1440,  1433,  1448,
+     1440,  1576,  1443,  1440,  1447,  1440,  1440,  1440,  1459,  1437,  1536,  1456,
+     1440,  1437,  1448,  1440,  1437,  1440,  1480,  1437,  1448,  1483,  1440,  1483,
+     1437,  1504,  1435,  1437,  1440,  1440,  1536,  1456,  1440,  1455,  1483,  1434,
+     1477,  1433,  1470,  1455,  1456,  1483,  1437,  1447,  1455,  1441,  1440,  1456,
+     1474,  1455,  1444,  1440,  1438,  1440,  1440,  1455,  1441,  1458,  1440,  1446,
+     1445,  1440,  1434,  1672,  1673,  1437,  1440,  1448,  1643,  1448,  1435,  1440,
+     1435,  1443,  1440,  1568,  1466,  1440,  1461,  1434,  1674,  1520,  1447,  1483,
+     1437,  1435,  1441,  1447,  1437,  1447,  1589,  1455,  1446,  1485,  1439,  1675,
+     1435,  1435,  1446,  1435,  1445,  1446,  1455,  1589,  1457,  1483,  1447,  1448,
+     1675,  1617,  1461,  1480,  1477,  1447,  1441,  1437,  1437,  1443,  1447,  1441,
+     1435,  1435,  1440,  1440,  1446,  1440,  1440,  1440,  1441,  1477,  1439,  1448,
+     1440,  1439,  1440,  1437,  1440,  1437,  1550,  1440,  1437,  1440,  1447,  1448,
+     1441,  1441,  1676,  1440,  1448,  1514,  1448,  1444,  1440,  1440,  1443,  1435,
+     1441,  1461,  1457,  1444,  1440,  1447,  1677,  1461,  1437,  1440,  1467,  1440,
+     1480,  1459,  1461,  1556,  1455,  1456,  1437,  1440,  1456,  1446,  1440,  1440,
+     1440,  1435,  1440,  1437,  1444,  1443,  1440,  1438,  1442,  1440,  1443,  1438,
+     1455,  1461,  1440,  1440,  1678,  1440,  1440,  1440,  1438,  1455,  1440,  1437,
+     1433,  1441,  1440,  1440,  1440,  1438,  1437,  1438,  1440,  1438,  1438,  1435,
+     1433,  1443,  1440,  1438,  1433,  1440,  1433,  1440,  1434,  1437,  1440,  1519,
+     1440,  1546,  1448,  1679,  1440,  1437,  1440,  1433,  1463,  1437,  1440,  1465,
+     1440,  1680,  1609,  1480,  1437,  1483,  1440,  1457,  1464,  1520,  1454,  1433,
+     1447,  1440,  1443,  1438,  1440,  1436,  1438,  1443,  1440,  1440,  1440,  1456,
+     1455,  1438,  1433,  1437,  1455,  1440,  1440,  1446,  1440,  1446,  1438,  1449,
+     1440,  1440,  1433,  1455,  1438,  1440,  1447,  1438,  1455,  1491,  1433,  1447,
+     1447,  1434,  1440,  1433,  1434,  1434,  1440,  1435,  1445,  1435,  1480,  1445,
+     1436,  1439,  1439,  1448,  1435,  1440,  1440,  1440,  1440,  1509,  1435,  1440,
+     1440,  1440,  1469,  1586,  1445,  1440,  1433,  1461,  1455,  1455,  1461,  1440,
+     1440,  1440,  1438,
+};
+
+const uint32_t DictionaryDawg_wordCount = 5752;
+const uint32_t DictionaryDawg_flashBytes = 20996;
+
+#else
+
+// Generated for 5-letter words: no words at any other length
+
+const uint32_t DictionaryDawg_masks[1] = { 0 };
+const uint16_t DictionaryDawg_firstEdge[1] = { 0 };
+const uint16_t DictionaryDawg_edges[1] = { 0 };
+
+const uint32_t DictionaryDawg_wordCount = 0;
+const uint32_t DictionaryDawg_flashBytes = 0;
+
+#endif
+
+#endif
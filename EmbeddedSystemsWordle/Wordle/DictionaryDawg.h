@@ -0,0 +1,38 @@
+/*
+ * DictionaryDawg.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The tables of the directed acyclic word graph (DAWG) behind Dictionary.c.
+ * DictionaryDawg.c defines them and is generated by Host/MakeDictionary; run
+ * "make dictionary" in Host/ after changing Wordle/words.txt.
+ *
+ * The graph is a trie of the words with every set of identical subtrees
+ * merged into one node. A node at depth d stands for the first d letters of
+ * some words and has a mask with bit n set if letter n (1 = 'A' to 26 = 'Z')
+ * can come next. Nodes are stored one depth after another, the root first, so
+ * the nodes at depth SCORE_WORD_LENGTH - 1 are last: their masks are the last
+ * letters of words and they have no children. Every other node's children are
+ * stored in the order of their letters in DictionaryDawg_edges, starting at
+ * DictionaryDawg_firstEdge[node]. The child for a letter is found by counting
+ * the letters in the mask below it.
+ */
+
+#ifndef WORDLE_DICTIONARYDAWG_H_
+#define WORDLE_DICTIONARYDAWG_H_
+
+#include <stdint.h>
+
+// The letter mask of every node
+extern const uint32_t DictionaryDawg_masks[];
+
+// Where the children of every node with children start in DictionaryDawg_edges
+extern const uint16_t DictionaryDawg_firstEdge[];
+
+// The child nodes of every node, in letter order
+extern const uint16_t DictionaryDawg_edges[];
+
+extern const uint32_t DictionaryDawg_wordCount;
+extern const uint32_t DictionaryDawg_flashBytes;
+
+#endif /* WORDLE_DICTIONARYDAWG_H_ */
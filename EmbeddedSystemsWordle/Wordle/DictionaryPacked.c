@@ -0,0 +1,782 @@
+/*
+ * DictionaryPacked.c
+ *
+ * Generated by Host/MakeDictionary from Wordle/words.txt. Do not edit; run
+ * "make dictionary" in Host/ after changing the word list.
+ *
+ * 5752 words, 8820 bytes.
+ */
+
+#include <Wordle/Dictionary.h>
+#include <Wordle/DictionaryPacked.h>
+
+#if DICTIONARY_BACKEND == DICTIONARY_PACKED
+
+#if SCORE_WORD_LENGTH == 5
+
+#define WORD_COUNT      5752
+#define INDEX_ENTRIES   ((WORD_COUNT + DICTIONARY_PACKED_STRIDE - 1) / DICTIONARY_PACKED_STRIDE)
+
+const uint8_t DictionaryPacked_deltas[8820] =
+{
+    0xC3, 0x91, 0x68, 0xF7, 0x03, 0x69, 0x83, 0x11, 0x03, 0x1D, 0x84, 0x2E,
+    0x06, 0x82, 0x3B, 0x94, 0x39, 0x84, 0x66, 0x96, 0x5F, 0x85, 0x13, 0x98,
+    0x2D, 0x97, 0x53, 0x83, 0x4F, 0x60, 0x11, 0xAF, 0x20, 0x2E, 0x81, 0x47,
+    0x9E, 0x19, 0xF4, 0x31, 0x0F, 0x82, 0x3C, 0x85, 0x24, 0x82, 0x34, 0x9D,
+    0x6C, 0x87, 0x71, 0x0F, 0x8B, 0x1B, 0x94, 0x65, 0x71, 0x84, 0x08, 0x8A,
+    0x78, 0x81, 0x0A, 0x81, 0x44, 0x89, 0x13, 0xDC, 0x60, 0x82, 0x2F, 0x95,
+    0x10, 0x0E, 0x81, 0x53, 0x89, 0x0F, 0x9D, 0x21, 0x82, 0x3E, 0x9C, 0x3B,
+    0x81, 0x00, 0x81, 0x00, 0x06, 0x04, 0x8E, 0x0D, 0x83, 0x4F, 0x31, 0x09,
+    0xAE, 0x46, 0xA6, 0x10, 0x0F, 0xE9, 0x00, 0xC1, 0x20, 0x96, 0x52, 0x81,
+    0xA0, 0x13, 0x9A, 0x0D, 0xAF, 0x2F, 0x51, 0x67, 0xA4, 0x06, 0xE8, 0x7C,
+    0x81, 0x57, 0x4E, 0x32, 0x40, 0x9E, 0x0F, 0x90, 0x7B, 0x8E, 0x36, 0x42,
+    0x98, 0x30, 0x97, 0x62, 0x95, 0x4C, 0x98, 0x0E, 0xFE, 0x71, 0x83, 0x0F,
+    0xD3, 0x00, 0x81, 0xA2, 0x71, 0x0E, 0x01, 0xBF, 0x71, 0x88, 0x00, 0x0E,
+    0xA7, 0x72, 0x0E, 0x89, 0x53, 0x85, 0x63, 0x84, 0xE8, 0x03, 0x83, 0x62,
+    0x88, 0x60, 0x8C, 0x05, 0x8A, 0x56, 0x4C, 0x8B, 0x51, 0x07, 0x90, 0x07,
+    0x16, 0x65, 0x40, 0x77, 0x82, 0x60, 0x90, 0x5F, 0x08, 0x82, 0x0D, 0x81,
+    0x00, 0x82, 0x3B, 0x03, 0x02, 0x95, 0x3A, 0x21, 0x2D, 0x81, 0x44, 0x02,
+    0x1F, 0x81, 0x3E, 0x84, 0x5D, 0x9E, 0x31, 0x81, 0x00, 0x82, 0x41, 0x87,
+    0x40, 0xE1, 0x40, 0x81, 0x52, 0x82, 0x6D, 0x81, 0x02, 0x51, 0x98, 0x3F,
+    0x0F, 0x9D, 0x32, 0x6A, 0x81, 0x56, 0x0A, 0x81, 0x24, 0x26, 0x9E, 0x5A,
+    0x8F, 0x54, 0x81, 0x6B, 0x83, 0x72, 0x81, 0x61, 0x14, 0xA5, 0x52, 0x83,
+    0x7A, 0xF4, 0x3F, 0x8A, 0x30, 0x8D, 0x58, 0x06, 0x81, 0x53, 0x81, 0x54,
+    0x1B, 0x8E, 0x2D, 0x04, 0x49, 0x77, 0x8D, 0x2E, 0x72, 0x95, 0x27, 0x81,
+    0x0C, 0x82, 0x41, 0x81, 0x33, 0x01, 0x83, 0x58, 0x82, 0x4E, 0xA5, 0x51,
+    0x0F, 0x70, 0x10, 0x82, 0x0E, 0x38, 0x8D, 0x33, 0x81, 0xE2, 0x55, 0xF3,
+    0x64, 0x83, 0x6F, 0xA0, 0x05, 0x95, 0x4B, 0x89, 0x23, 0x81, 0x21, 0xB3,
+    0x44, 0x82, 0x59, 0x14, 0x90, 0x55, 0x85, 0x45, 0x81, 0x00, 0x86, 0x7F,
+    0x81, 0x67, 0x82, 0x85, 0x1A, 0xEB, 0x3F, 0x85, 0x32, 0x8A, 0x4E, 0x84,
+    0x3A, 0x07, 0x83, 0x0E, 0x90, 0x2D, 0x06, 0x81, 0x31, 0x8B, 0x0E, 0x84,
+    0x32, 0x23, 0x9C, 0x1C, 0x0E, 0x82, 0x40, 0x8F, 0x2F, 0x81, 0x44, 0x93,
+    0x4E, 0x06, 0x83, 0x3E, 0x85, 0x2D, 0x0F, 0x82, 0x3B, 0x89, 0x0B, 0x86,
+    0x3A, 0xE0, 0x0E, 0x90, 0x33, 0xA5, 0x30, 0x0A, 0x04, 0x01, 0x87, 0x52,
+    0x90, 0x1F, 0x0E, 0x05, 0xA7, 0x77, 0x75, 0x96, 0x16, 0x75, 0x05, 0x01,
+    0x82, 0x2F, 0x85, 0x4F, 0x81, 0x00, 0x81, 0xA8, 0x62, 0x95, 0x1F, 0x9A,
+    0x59, 0x27, 0x12, 0x14, 0x40, 0x96, 0x08, 0x8E, 0x11, 0x81, 0x71, 0xFE,
+    0x15, 0x81, 0x77, 0x05, 0x96, 0x7E, 0x62, 0x83, 0x1E, 0xB7, 0x61, 0x06,
+    0x9B, 0x13, 0x07, 0x81, 0x70, 0x91, 0x50, 0x9E, 0x3B, 0xC7, 0x7E, 0x81,
+    0x28, 0x81, 0x20, 0x9E, 0x5F, 0x81, 0x00, 0x01, 0x8B, 0x5F, 0x8F, 0x7B,
+    0xB1, 0x76, 0x83, 0x4F, 0x81, 0x8C, 0x41, 0x31, 0x81, 0x5F, 0x01, 0x23,
+    0xA8, 0x44, 0x96, 0x1B, 0xA5, 0x5D, 0x89, 0x41, 0x81, 0xCD, 0x47, 0x82,
+    0x67, 0x34, 0x26, 0x95, 0x46, 0x9A, 0x20, 0x81, 0x8E, 0x40, 0x83, 0xA2,
+    0x32, 0x8C, 0xDC, 0x5F, 0x88, 0x08, 0x07, 0x87, 0x46, 0x81, 0x7A, 0x7B,
+    0x85, 0x2B, 0x4C, 0x81, 0x34, 0x96, 0x13, 0x4D, 0x8B, 0x1A, 0x86, 0x00,
+    0x81, 0x3B, 0x45, 0x81, 0x32, 0x8A, 0x5F, 0x0E, 0x01, 0x87, 0x60, 0x06,
+    0x0B, 0x0E, 0x01, 0x81, 0x40, 0x06, 0x1A, 0x06, 0x1A, 0x06, 0x81, 0x28,
+    0x4D, 0x8A, 0x7E, 0x67, 0x06, 0x1A, 0x40, 0x5C, 0x24, 0x60, 0x9D, 0x00,
+    0x40, 0x11, 0x0E, 0x01, 0x20, 0x12, 0x14, 0x7A, 0x46, 0x1A, 0x1B, 0x57,
+    0x83, 0x67, 0x78, 0x0E, 0x01, 0x70, 0x09, 0x02, 0x05, 0x40, 0x81, 0x7C,
+    0x16, 0x83, 0x63, 0x3C, 0x0E, 0x01, 0x52, 0x0E, 0x18, 0x81, 0x43, 0x81,
+    0x25, 0x06, 0x83, 0x7A, 0x81, 0x78, 0x8E, 0x08, 0x06, 0x81, 0x7A, 0x8E,
+    0x11, 0x82, 0x51, 0x86, 0xBC, 0x73, 0x2B, 0x06, 0x81, 0x5A, 0x40, 0x1C,
+    0x04, 0x71, 0x0F, 0x21, 0x1F, 0x20, 0x01, 0x04, 0x86, 0x38, 0x87, 0x03,
+    0x87, 0x3A, 0x86, 0x3B, 0x6B, 0x06, 0x82, 0x3A, 0x40, 0x06, 0x3A, 0x85,
+    0x21, 0x81, 0x33, 0x84, 0x47, 0x06, 0x81, 0x00, 0x7A, 0x81, 0x46, 0x81,
+    0x39, 0x01, 0x8C, 0x37, 0x81, 0x62, 0x94, 0x72, 0x2F, 0x81, 0x3D, 0x60,
+    0x0E, 0x06, 0x5E, 0x81, 0x1C, 0x83, 0x1B, 0x88, 0x3A, 0x2B, 0x06, 0x83,
+    0x7A, 0x9C, 0x21, 0x3F, 0x81, 0x00, 0x40, 0x81, 0x26, 0x2F, 0x81, 0x24,
+    0x83, 0x08, 0x82, 0x39, 0x07, 0x81, 0x1F, 0x83, 0x20, 0x79, 0x90, 0x00,
+    0x84, 0x2D, 0x9B, 0x53, 0x84, 0xB9, 0x1D, 0x82, 0x88, 0x3C, 0x86, 0x2B,
+    0x87, 0x69, 0x0B, 0x0E, 0x01, 0x01, 0x8B, 0x1F, 0x85, 0x00, 0x51, 0x87,
+    0x5D, 0x13, 0x81, 0x60, 0x98, 0x01, 0x85, 0x2F, 0x0E, 0x01, 0x87, 0x26,
+    0x5A, 0x32, 0x81, 0x0E, 0x20, 0x06, 0x85, 0x36, 0x88, 0x44, 0x52, 0x0A,
+    0x88, 0x04, 0x81, 0x32, 0x81, 0x5C, 0x84, 0x23, 0x8F, 0x44, 0x2B, 0x83,
+    0x75, 0x86, 0x66, 0x84, 0x7A, 0x4A, 0x01, 0x83, 0x66, 0x84, 0xE3, 0x3A,
+    0x18, 0x1A, 0x6E, 0x20, 0x81, 0x12, 0x1E, 0x01, 0x07, 0x7A, 0x20, 0x0F,
+    0x1F, 0x81, 0x32, 0x99, 0x66, 0x07, 0x02, 0x70, 0x0C, 0x82, 0x14, 0x81,
+    0x2F, 0x9E, 0x3D, 0x14, 0x03, 0x02, 0x02, 0x48, 0x60, 0x27, 0xAB, 0x1A,
+    0x1F, 0x18, 0x08, 0x81, 0x00, 0x72, 0x5F, 0x20, 0x09, 0x03, 0x81, 0x23,
+    0x5B, 0x05, 0x06, 0xAB, 0x2B, 0x0E, 0x01, 0x01, 0x05, 0x0D, 0x82, 0x0E,
+    0x6E, 0x11, 0x01, 0x14, 0x84, 0xDF, 0x5C, 0x0F, 0x21, 0x1F, 0x83, 0x46,
+    0x88, 0x0C, 0x82, 0x0E, 0x86, 0x31, 0x0F, 0x32, 0x8F, 0x6A, 0x86, 0x5F,
+    0x81, 0x0B, 0x40, 0x2C, 0x81, 0x49, 0x81, 0x45, 0x8D, 0x60, 0x34, 0x04,
+    0x8D, 0x5D, 0x87, 0x0B, 0x81, 0x00, 0x81, 0x60, 0x82, 0x00, 0x20, 0x83,
+    0x20, 0x88, 0x12, 0x2E, 0x11, 0x0E, 0x01, 0x3C, 0x04, 0x81, 0x00, 0x66,
+    0x81, 0x5A, 0x83, 0x20, 0x06, 0x4B, 0x81, 0x4F, 0x40, 0x06, 0x1A, 0x81,
+    0x00, 0x21, 0x14, 0x0B, 0x06, 0x81, 0x2C, 0x14, 0x91, 0x5F, 0x6C, 0x0E,
+    0x01, 0x70, 0x81, 0x22, 0x29, 0x87, 0x7F, 0x01, 0x81, 0x0B, 0x35, 0x83,
+    0x3A, 0x81, 0x31, 0x83, 0x00, 0x84, 0x4F, 0x81, 0x5C, 0x81, 0x4F, 0x8C,
+    0x11, 0x08, 0x06, 0x73, 0x6E, 0x86, 0x11, 0x0A, 0x04, 0x01, 0x87, 0x7F,
+    0x8A, 0x41, 0x84, 0xB4, 0x72, 0x0F, 0x1F, 0x20, 0x40, 0x31, 0x0A, 0x37,
+    0x5F, 0x0F, 0x81, 0x15, 0x0B, 0x20, 0x32, 0x0A, 0x1D, 0x02, 0x45, 0x12,
+    0x99, 0x5F, 0x07, 0x02, 0x77, 0x84, 0x21, 0x2E, 0x9A, 0x3F, 0x13, 0x26,
+    0x1A, 0x21, 0x0C, 0x41, 0x81, 0x19, 0x27, 0x12, 0x02, 0x04, 0x0E, 0x81,
+    0x12, 0xAB, 0x39, 0x82, 0x08, 0x39, 0x5E, 0x21, 0x07, 0x02, 0x78, 0x23,
+    0x66, 0x05, 0xAC, 0x3B, 0x06, 0x81, 0x20, 0x81, 0x14, 0x1D, 0x84, 0xED,
+    0x6E, 0x86, 0x26, 0x4C, 0x8F, 0x6A, 0x04, 0x88, 0x26, 0x81, 0x0C, 0x8F,
+    0x7F, 0x10, 0x95, 0x3F, 0x81, 0x12, 0x14, 0x7A, 0x06, 0x08, 0x12, 0x06,
+    0x88, 0x6F, 0x0B, 0x06, 0x84, 0x4F, 0x07, 0x81, 0x04, 0x81, 0x00, 0x66,
+    0x81, 0x3A, 0x89, 0x20, 0x92, 0x20, 0x81, 0x15, 0x0B, 0x6E, 0x32, 0x06,
+    0x3A, 0x01, 0x3F, 0x0E, 0x2E, 0x04, 0x0E, 0x13, 0x83, 0x65, 0x4B, 0x0F,
+    0x66, 0x5A, 0x82, 0x20, 0x06, 0x83, 0x4F, 0x84, 0x1D, 0x0E, 0x06, 0x81,
+    0x13, 0x9D, 0x41, 0x85, 0x45, 0x8D, 0x27, 0x86, 0xD5, 0x7A, 0xB3, 0x64,
+    0xB0, 0x7C, 0x8B, 0x36, 0x84, 0x4A, 0x97, 0x06, 0x8E, 0xD7, 0x73, 0x2D,
+    0x59, 0x7C, 0x57, 0x85, 0x2A, 0x81, 0x56, 0x83, 0x04, 0x84, 0x10, 0x1B,
+    0x31, 0x82, 0x60, 0x84, 0x1C, 0x88, 0x52, 0x20, 0x87, 0x51, 0x0E, 0x01,
+    0x06, 0x93, 0x15, 0x8C, 0x56, 0x0F, 0x89, 0x40, 0x0E, 0x12, 0x20, 0x82,
+    0x12, 0x73, 0x82, 0x74, 0x03, 0x82, 0x64, 0x06, 0x84, 0x13, 0x6D, 0x0B,
+    0x0E, 0x01, 0x82, 0x26, 0x0C, 0x09, 0x81, 0x06, 0x1B, 0x04, 0x8C, 0x11,
+    0x0E, 0x01, 0x82, 0x3B, 0x05, 0x8C, 0x41, 0x1F, 0x40, 0x11, 0x0E, 0x01,
+    0x01, 0x3B, 0x81, 0x04, 0x66, 0x09, 0x0A, 0x01, 0x1C, 0x0A, 0x46, 0x2C,
+    0x0E, 0x32, 0x83, 0x5F, 0x0F, 0x81, 0x40, 0x82, 0x12, 0x0E, 0x83, 0x55,
+    0x4A, 0x83, 0x67, 0x85, 0x72, 0x81, 0x5A, 0x84, 0x3F, 0x0E, 0x01, 0x79,
+    0x86, 0x78, 0x86, 0xD3, 0x41, 0x8B, 0x47, 0x85, 0x01, 0x83, 0x05, 0x72,
+    0x0E, 0x01, 0xBF, 0x6F, 0x81, 0x6D, 0x04, 0x92, 0x00, 0x9C, 0x11, 0x83,
+    0x6F, 0x84, 0xF4, 0x00, 0x32, 0x01, 0x68, 0x04, 0x59, 0x25, 0x24, 0x1F,
+    0x20, 0x31, 0x09, 0x06, 0x01, 0x05, 0x0C, 0x08, 0x26, 0x9B, 0x1D, 0x04,
+    0x37, 0x40, 0x05, 0x02, 0x21, 0x81, 0x5C, 0x81, 0x25, 0x1F, 0x01, 0x7F,
+    0x06, 0x9A, 0x72, 0x1A, 0x21, 0x81, 0x5E, 0x05, 0x03, 0x19, 0x0B, 0x11,
+    0x04, 0x02, 0x04, 0x04, 0x04, 0x40, 0x3D, 0x02, 0x41, 0x32, 0x14, 0xAB,
+    0x12, 0x08, 0x81, 0x3F, 0x33, 0x4B, 0x3B, 0x28, 0x31, 0x01, 0x20, 0x53,
+    0x3B, 0xAA, 0x60, 0x18, 0x5B, 0x2D, 0x81, 0x3D, 0x03, 0x18, 0x81, 0x01,
+    0x02, 0x04, 0x33, 0x9E, 0x20, 0xC0, 0x4E, 0x95, 0x3F, 0x97, 0x00, 0xA9,
+    0x6F, 0x8E, 0x47, 0x9F, 0x79, 0x83, 0x68, 0x88, 0x30, 0x84, 0x2B, 0x0F,
+    0x90, 0x01, 0x6F, 0x09, 0x84, 0xD6, 0x3F, 0x1A, 0x0E, 0x81, 0x1A, 0x81,
+    0x03, 0x03, 0x14, 0x04, 0x08, 0x40, 0x55, 0x08, 0x03, 0x01, 0x51, 0x2E,
+    0x40, 0x99, 0x7B, 0x04, 0x02, 0x81, 0x1F, 0x01, 0x82, 0x77, 0x81, 0x28,
+    0x9A, 0x78, 0x5B, 0x81, 0x5C, 0x03, 0x22, 0x04, 0x48, 0x81, 0x00, 0xAB,
+    0x18, 0x40, 0x28, 0x60, 0x81, 0x3D, 0x15, 0x06, 0x48, 0x52, 0x23, 0x0B,
+    0x11, 0x10, 0x11, 0x29, 0x45, 0xAA, 0x20, 0x18, 0x39, 0x0F, 0x81, 0x7D,
+    0x17, 0x04, 0x86, 0x5E, 0x90, 0x00, 0x0D, 0x02, 0x83, 0x11, 0x84, 0xC3,
+    0x1F, 0x82, 0x2B, 0x81, 0x61, 0x1F, 0x85, 0x72, 0x81, 0x3C, 0x83, 0x72,
+    0x36, 0x82, 0x0A, 0x06, 0x68, 0x12, 0x84, 0x40, 0x70, 0x01, 0x0E, 0x01,
+    0x05, 0x82, 0x36, 0x85, 0x25, 0x9A, 0x60, 0x85, 0x60, 0x81, 0x40, 0x40,
+    0x8D, 0x51, 0x0F, 0x06, 0x86, 0x7A, 0x60, 0x26, 0x6A, 0x81, 0x4B, 0x04,
+    0x81, 0x21, 0x83, 0x12, 0x0E, 0x1C, 0x04, 0x5F, 0x01, 0x01, 0x25, 0x4A,
+    0x7E, 0x12, 0x5C, 0x04, 0x84, 0x55, 0x27, 0x15, 0x0F, 0x2E, 0x42, 0x50,
+    0x82, 0x11, 0x84, 0x20, 0x01, 0x81, 0x4E, 0x20, 0x40, 0x40, 0x81, 0x00,
+    0x83, 0x26, 0x6B, 0x0E, 0x01, 0x83, 0x0E, 0x24, 0x8B, 0x47, 0x67, 0x11,
+    0x0E, 0x01, 0x36, 0x81, 0x0A, 0x06, 0x3A, 0x20, 0x06, 0x3A, 0x85, 0x20,
+    0x83, 0x60, 0x84, 0x20, 0x87, 0x35, 0x81, 0x00, 0x81, 0x1C, 0x50, 0x31,
+    0x0E, 0x41, 0x84, 0x50, 0x0A, 0x04, 0x01, 0x01, 0x05, 0x87, 0x6B, 0x0E,
+    0x81, 0x61, 0x86, 0x11, 0x0F, 0x87, 0x71, 0x0E, 0x81, 0x67, 0x7C, 0x85,
+    0x19, 0x84, 0xB7, 0x25, 0x18, 0x69, 0x1F, 0x81, 0x3D, 0x03, 0x12, 0x06,
+    0x3A, 0x0E, 0x55, 0x0B, 0x12, 0x40, 0x27, 0x07, 0x40, 0x12, 0x14, 0x99,
+    0x52, 0x02, 0x62, 0x15, 0x07, 0x01, 0x04, 0x81, 0x75, 0x60, 0x0F, 0x5F,
+    0x01, 0x7F, 0x9A, 0x60, 0x18, 0x39, 0x0E, 0x01, 0x81, 0x72, 0x0B, 0x81,
+    0x40, 0x03, 0xAB, 0x38, 0x40, 0x69, 0x81, 0x71, 0x14, 0x12, 0x03, 0x25,
+    0x60, 0x3D, 0x34, 0x0A, 0x05, 0xAB, 0x12, 0x0E, 0x19, 0x08, 0x20, 0x81,
+    0x4E, 0x0E, 0x81, 0x11, 0x24, 0x03, 0x0C, 0x9F, 0x20, 0x84, 0xC5, 0x10,
+    0x0E, 0x01, 0x70, 0x11, 0x9F, 0x1F, 0x99, 0x74, 0x97, 0x4C, 0x6E, 0x81,
+    0x12, 0x85, 0x1B, 0x8A, 0x65, 0x8D, 0x11, 0x81, 0x5D, 0x8C, 0x52, 0x40,
+    0x11, 0x0E, 0x01, 0x6E, 0x04, 0x0A, 0x64, 0x06, 0x81, 0x40, 0x0C, 0x0A,
+    0x56, 0x14, 0x84, 0x40, 0x81, 0x7A, 0x85, 0x1F, 0x01, 0x06, 0x6C, 0x83,
+    0x0B, 0x86, 0xE6, 0x23, 0x85, 0x5F, 0x86, 0x72, 0x82, 0x61, 0x86, 0x2D,
+    0xD0, 0x71, 0xAA, 0x70, 0xEF, 0x40, 0x8E, 0x8C, 0x60, 0x4E, 0x87, 0x18,
+    0x82, 0x5A, 0x8D, 0x66, 0x88, 0x20, 0x81, 0x7A, 0x8F, 0x26, 0x81, 0x40,
+    0x20, 0x94, 0x3A, 0x81, 0x66, 0x86, 0x1A, 0x82, 0x20, 0x40, 0x84, 0x52,
+    0x34, 0x5A, 0x9F, 0x31, 0x0E, 0x01, 0x81, 0x40, 0x60, 0x81, 0x40, 0x8C,
+    0x11, 0x0E, 0x01, 0x83, 0x7A, 0x83, 0x26, 0x83, 0x01, 0x86, 0x60, 0x89,
+    0x1F, 0x8C, 0x5B, 0x88, 0x76, 0x0F, 0x84, 0xFA, 0x14, 0x81, 0xBF, 0x4C,
+    0x01, 0x3F, 0x81, 0x00, 0x06, 0x2F, 0x83, 0x2A, 0x82, 0x02, 0x82, 0x5F,
+    0x14, 0x0D, 0x82, 0x72, 0x06, 0x0D, 0x82, 0x3A, 0x7F, 0x07, 0x60, 0x8C,
+    0x3A, 0x82, 0x20, 0x60, 0x84, 0x21, 0x7E, 0x82, 0x35, 0x84, 0x4C, 0x90,
+    0x32, 0x74, 0x15, 0x82, 0x7F, 0x07, 0x25, 0x93, 0x20, 0x7A, 0x21, 0x5F,
+    0x60, 0x81, 0x6E, 0x44, 0x84, 0x6F, 0x81, 0x2E, 0x07, 0x05, 0x05, 0x81,
+    0x3F, 0x84, 0x7B, 0x82, 0x38, 0x2E, 0x8E, 0x61, 0x81, 0x14, 0x8B, 0x51,
+    0x88, 0x5F, 0x81, 0x3B, 0x86, 0x3F, 0x82, 0x46, 0x84, 0x6D, 0x89, 0x47,
+    0x86, 0x06, 0x72, 0x88, 0x0F, 0x85, 0xBB, 0x56, 0x6A, 0x81, 0x8D, 0x20,
+    0x81, 0x46, 0x8C, 0x4B, 0x0E, 0x01, 0x06, 0x81, 0x3A, 0x81, 0x01, 0x81,
+    0x0D, 0x87, 0x73, 0x88, 0x1F, 0x84, 0x40, 0x88, 0x61, 0x9E, 0x70, 0x0E,
+    0x01, 0x87, 0x5C, 0x82, 0x04, 0x06, 0x86, 0x19, 0x01, 0x81, 0x66, 0x85,
+    0x19, 0x72, 0x0E, 0x01, 0x3C, 0x04, 0x06, 0x81, 0x00, 0x82, 0x1A, 0x83,
+    0x72, 0x8B, 0x14, 0x56, 0x8C, 0x43, 0x33, 0x81, 0x0E, 0x82, 0x20, 0x06,
+    0x83, 0x56, 0x04, 0x81, 0x26, 0x5A, 0x85, 0x75, 0x84, 0x11, 0x16, 0x0A,
+    0x8B, 0x15, 0x05, 0x71, 0x0E, 0x01, 0x82, 0x41, 0x81, 0x65, 0xA1, 0x00,
+    0x8A, 0xBD, 0x68, 0x0E, 0x86, 0x24, 0x86, 0x72, 0x14, 0x81, 0x7A, 0x88,
+    0x60, 0x21, 0x84, 0x5F, 0x87, 0x60, 0x3C, 0x0A, 0x2C, 0x7C, 0x8F, 0x78,
+    0x2E, 0x88, 0x2C, 0x8D, 0x31, 0x0F, 0x81, 0x60, 0x06, 0x59, 0x81, 0x21,
+    0x84, 0x11, 0x0F, 0x87, 0x00, 0x81, 0x40, 0x81, 0x7F, 0x87, 0x41, 0x06,
+    0x81, 0x1A, 0x83, 0x60, 0x71, 0x0E, 0x01, 0x06, 0x91, 0x3A, 0x06, 0x3A,
+    0x81, 0x2E, 0x84, 0x43, 0x0F, 0x87, 0x71, 0x0E, 0x01, 0x83, 0x66, 0x83,
+    0x3B, 0x81, 0x14, 0x82, 0x7D, 0x84, 0x4E, 0x87, 0x66, 0x13, 0x06, 0x82,
+    0x21, 0x06, 0x81, 0x00, 0x0C, 0x8C, 0x49, 0x87, 0x76, 0x0A, 0x04, 0x01,
+    0x84, 0xB7, 0x20, 0x81, 0x01, 0x1F, 0x3B, 0x37, 0x3C, 0x12, 0x18, 0x3A,
+    0x81, 0x0E, 0x59, 0x02, 0x05, 0x40, 0x99, 0x71, 0x09, 0x05, 0x39, 0x81,
+    0x08, 0x83, 0x00, 0x9C, 0x31, 0x0E, 0x01, 0x21, 0x81, 0x38, 0x0D, 0x32,
+    0x48, 0x81, 0x32, 0xAC, 0x5F, 0x68, 0x39, 0x27, 0x04, 0x23, 0x60, 0x52,
+    0x29, 0xAA, 0x65, 0x81, 0x20, 0x31, 0x81, 0x0F, 0x18, 0x3A, 0x9C, 0x1F,
+    0x81, 0x0E, 0x81, 0x67, 0x84, 0xBF, 0x7A, 0x8D, 0x19, 0x08, 0x81, 0x65,
+    0x5A, 0x06, 0x82, 0x1A, 0x84, 0x11, 0x0F, 0x89, 0x60, 0x82, 0x00, 0x84,
+    0x40, 0xA7, 0x60, 0x89, 0x60, 0x06, 0x85, 0x36, 0x82, 0x6A, 0x5A, 0x06,
+    0x84, 0x4C, 0x4E, 0x40, 0x81, 0x00, 0x5C, 0x0A, 0x8D, 0x4B, 0x0E, 0x01,
+    0x81, 0x52, 0x91, 0x6F, 0x39, 0x85, 0x46, 0x06, 0x82, 0x1A, 0x06, 0x83,
+    0x4F, 0x90, 0x4C, 0x8F, 0x7F, 0x82, 0xCB, 0x13, 0x9C, 0x5C, 0x81, 0x6A,
+    0x08, 0x83, 0xDD, 0x7F, 0xA3, 0x40, 0x9E, 0x74, 0x8D, 0x6C, 0x8F, 0xDF,
+    0x7F, 0x81, 0x53, 0xD6, 0x1F, 0x81, 0x6F, 0x06, 0x3A, 0x81, 0x35, 0x84,
+    0x1C, 0x08, 0x06, 0x01, 0x87, 0x7B, 0x04, 0x90, 0x01, 0xDF, 0x71, 0xEA,
+    0x35, 0x81, 0xC8, 0x1A, 0x9C, 0x41, 0x81, 0xCA, 0x6D, 0x8E, 0x03, 0x0E,
+    0x01, 0x8F, 0x41, 0x65, 0x83, 0x3A, 0xDB, 0x52, 0x81, 0xE9, 0x40, 0x81,
+    0x9E, 0x7F, 0x82, 0x88, 0x00, 0x0E, 0xD8, 0x02, 0x83, 0x8F, 0x7E, 0x98,
+    0x62, 0x81, 0xEE, 0x60, 0x82, 0xA2, 0x53, 0x81, 0xBF, 0x7D, 0x0F, 0x81,
+    0x32, 0x86, 0x72, 0x8D, 0x3B, 0x87, 0x42, 0x81, 0x05, 0x88, 0x35, 0x96,
+    0x57, 0x84, 0x00, 0xAF, 0x00, 0xAD, 0x00, 0x84, 0x00, 0x83, 0x29, 0x81,
+    0x00, 0x04, 0x01, 0xD8, 0x79, 0x86, 0x78, 0x0E, 0x87, 0x73, 0x92, 0x1F,
+    0x81, 0x15, 0x9F, 0x7A, 0x40, 0x9C, 0x21, 0x91, 0x15, 0x82, 0x3C, 0x88,
+    0x0E, 0x06, 0x81, 0x83, 0x5B, 0x98, 0x30, 0x0E, 0x82, 0x45, 0x81, 0x2E,
+    0x85, 0x7C, 0x18, 0xA8, 0x40, 0xA1, 0x30, 0x9E, 0x43, 0x89, 0x39, 0x84,
+    0x0D, 0x83, 0x27, 0x8F, 0x20, 0x82, 0xF5, 0x3A, 0x9F, 0x40, 0xAF, 0x75,
+    0x85, 0x31, 0x82, 0xAA, 0x13, 0x82, 0x04, 0x06, 0xE2, 0x2F, 0x9C, 0x0F,
+    0x93, 0x00, 0xBD, 0x11, 0x98, 0x1F, 0x82, 0x4E, 0x95, 0x02, 0x83, 0x20,
+    0x81, 0xEC, 0x25, 0x88, 0x79, 0x81, 0xA0, 0x00, 0x71, 0x81, 0x2C, 0x24,
+    0x82, 0x39, 0xE2, 0x59, 0x81, 0xEA, 0x6E, 0xF5, 0x12, 0xA2, 0x4E, 0x01,
+    0x81, 0x00, 0x05, 0x9C, 0x1B, 0x82, 0x1F, 0xAF, 0x52, 0x81, 0xB1, 0x6E,
+    0x81, 0xDC, 0x21, 0x82, 0x20, 0x1F, 0x8D, 0x79, 0x8F, 0x47, 0x83, 0x61,
+    0x9E, 0x31, 0x81, 0x6F, 0x1F, 0xB3, 0x21, 0x78, 0x82, 0x47, 0x9F, 0x79,
+    0x55, 0x84, 0x44, 0x82, 0x0F, 0x81, 0x2E, 0x81, 0x80, 0x11, 0xE4, 0x60,
+    0x8F, 0x81, 0x52, 0x86, 0x1F, 0x0E, 0x01, 0x01, 0x83, 0x5B, 0x04, 0x84,
+    0x06, 0x0B, 0x0E, 0x01, 0x82, 0x40, 0x88, 0x66, 0x84, 0x7A, 0x8A, 0x21,
+    0x8F, 0x1F, 0x41, 0x71, 0x0E, 0x06, 0x2F, 0x8C, 0x1C, 0x0E, 0x01, 0x72,
+    0x0D, 0x88, 0x61, 0x81, 0x52, 0x84, 0x3F, 0x0F, 0x87, 0x46, 0x7A, 0x81,
+    0x66, 0x9C, 0x4B, 0x41, 0x3F, 0x0E, 0x01, 0x82, 0x00, 0x81, 0x60, 0x88,
+    0x00, 0x83, 0x19, 0x78, 0x0F, 0x81, 0x66, 0x81, 0x56, 0x2A, 0x48, 0x85,
+    0x33, 0x2D, 0x12, 0x85, 0x60, 0x82, 0x3F, 0x87, 0x61, 0x85, 0x51, 0x0F,
+    0x87, 0x7F, 0x83, 0x13, 0x84, 0x5F, 0x0F, 0x86, 0xBB, 0x20, 0x21, 0x1F,
+    0x8B, 0x19, 0x81, 0x07, 0x8F, 0x60, 0x82, 0x00, 0x06, 0x9E, 0x55, 0x81,
+    0x66, 0x97, 0x2D, 0x12, 0x5B, 0x81, 0x25, 0x86, 0x12, 0x82, 0x0D, 0x83,
+    0x33, 0x2E, 0x9F, 0x19, 0x83, 0x27, 0x06, 0x1F, 0x57, 0x0A, 0x88, 0x3A,
+    0x83, 0x19, 0x07, 0x35, 0x3C, 0x0F, 0x71, 0x83, 0x0F, 0x83, 0x60, 0x88,
+    0x1F, 0x88, 0x00, 0x90, 0x00, 0x86, 0xC3, 0x61, 0x84, 0x1F, 0x83, 0x13,
+    0x85, 0x40, 0x10, 0x83, 0x1E, 0x8C, 0x20, 0x81, 0x31, 0x40, 0x81, 0x15,
+    0x84, 0x4B, 0x0E, 0x01, 0x83, 0x55, 0x11, 0x84, 0x60, 0x1B, 0xA6, 0x54,
+    0x3C, 0x0E, 0x01, 0x01, 0x81, 0x5F, 0x06, 0x1A, 0x06, 0x81, 0x4F, 0x8B,
+    0x24, 0x3C, 0x2B, 0x11, 0x0E, 0x01, 0x81, 0x00, 0x40, 0x66, 0x88, 0x6B,
+    0x94, 0x60, 0x0E, 0x01, 0x82, 0x00, 0x81, 0x41, 0x14, 0x85, 0x11, 0x82,
+    0x7A, 0x86, 0x06, 0x8E, 0x19, 0x01, 0x8F, 0x71, 0x0E, 0x01, 0x95, 0x26,
+    0x81, 0xA5, 0x6B, 0x83, 0x8C, 0x0F, 0x18, 0x81, 0x08, 0x39, 0x06, 0x33,
+    0x0E, 0x06, 0x2C, 0x14, 0x12, 0x08, 0x40, 0x32, 0x23, 0x03, 0x28, 0x60,
+    0x40, 0x9A, 0x00, 0x38, 0x47, 0x01, 0x01, 0x83, 0x34, 0x81, 0x0B, 0x9A,
+    0x78, 0x39, 0x0E, 0x01, 0x82, 0x14, 0x0D, 0x3F, 0x41, 0x3F, 0xAB, 0x21,
+    0x37, 0x48, 0x40, 0x81, 0x71, 0x0E, 0x21, 0x2E, 0x32, 0x3F, 0x02, 0x3A,
+    0x05, 0xAA, 0x60, 0x60, 0x13, 0x5E, 0x41, 0x14, 0x2C, 0x22, 0x04, 0x81,
+    0x1D, 0x1D, 0x14, 0x9B, 0x40, 0x59, 0x84, 0xC1, 0x61, 0x20, 0x06, 0x8C,
+    0x73, 0x85, 0x07, 0x9C, 0x06, 0x40, 0x91, 0x1A, 0x81, 0x61, 0x94, 0x1F,
+    0x81, 0x10, 0x0C, 0x44, 0x26, 0x91, 0x7A, 0x84, 0x00, 0x82, 0x00, 0x82,
+    0x00, 0x06, 0x93, 0x20, 0x1A, 0x12, 0x2E, 0x20, 0x32, 0x0A, 0x81, 0x04,
+    0x2E, 0x12, 0x81, 0x52, 0x03, 0x0B, 0x06, 0x14, 0x87, 0x34, 0x8E, 0x32,
+    0x31, 0x10, 0x7F, 0x84, 0x4E, 0x89, 0x72, 0x86, 0x11, 0x0F, 0x87, 0x7F,
+    0x84, 0xBF, 0x39, 0x81, 0x08, 0x39, 0x79, 0x1E, 0x08, 0x48, 0x81, 0x00,
+    0x11, 0x81, 0x0F, 0x99, 0x78, 0x79, 0x0E, 0x01, 0x82, 0x3B, 0x7A, 0x2B,
+    0x9B, 0x1F, 0x72, 0x0F, 0x40, 0x81, 0x19, 0x81, 0x5F, 0x2F, 0x81, 0x40,
+    0xAA, 0x11, 0x81, 0x08, 0x31, 0x81, 0x20, 0x0F, 0x01, 0x81, 0x14, 0x0C,
+    0x14, 0x66, 0x57, 0xAB, 0x6F, 0x7C, 0x9E, 0x02, 0x84, 0xD1, 0x41, 0x86,
+    0x72, 0x89, 0x2E, 0x8D, 0x19, 0x81, 0x4D, 0x83, 0x2C, 0xA5, 0x6E, 0x06,
+    0x86, 0x0B, 0x0F, 0x87, 0x56, 0x0A, 0x56, 0x81, 0x0A, 0x06, 0x60, 0x9F,
+    0x3A, 0x5F, 0x67, 0x81, 0x6C, 0x82, 0x5F, 0x01, 0x07, 0x07, 0x83, 0x46,
+    0x20, 0x86, 0x55, 0xB2, 0x6B, 0x96, 0xBA, 0x00, 0x82, 0x2C, 0x9E, 0x40,
+    0x0E, 0x87, 0x60, 0x91, 0x66, 0x3A, 0x81, 0x40, 0x93, 0x15, 0x0B, 0x6E,
+    0x0D, 0x05, 0x81, 0x60, 0x86, 0x11, 0x0E, 0x01, 0x7B, 0x73, 0x18, 0x81,
+    0x7B, 0x84, 0x3F, 0x4E, 0x88, 0x52, 0x86, 0x11, 0x0E, 0x01, 0x8F, 0x20,
+    0x32, 0x88, 0x2E, 0x82, 0x60, 0x66, 0x84, 0x2B, 0x0F, 0x82, 0x3F, 0x85,
+    0x27, 0x4C, 0x81, 0x6F, 0x81, 0x1F, 0x81, 0x52, 0x14, 0x82, 0x53, 0x89,
+    0x47, 0x06, 0x81, 0x1A, 0x8D, 0x1F, 0x87, 0x72, 0x0E, 0x01, 0x86, 0xBB,
+    0x20, 0x8E, 0x1C, 0x90, 0x04, 0x06, 0x81, 0x6C, 0xB4, 0x2E, 0x81, 0x11,
+    0x89, 0x15, 0x85, 0x7A, 0x01, 0x71, 0x04, 0x82, 0x1C, 0x4E, 0x20, 0x83,
+    0x52, 0x81, 0x1F, 0x99, 0x0F, 0x89, 0x3C, 0x88, 0x41, 0x84, 0xE7, 0x63,
+    0xEF, 0x61, 0x38, 0x81, 0x8E, 0x28, 0x85, 0x50, 0x0E, 0x01, 0x8F, 0x66,
+    0x93, 0x7A, 0xAC, 0x00, 0x21, 0x81, 0x5F, 0x82, 0x00, 0x86, 0x12, 0x6E,
+    0x06, 0x98, 0x60, 0x8C, 0x1A, 0x82, 0x00, 0x06, 0x5A, 0x81, 0x15, 0x0B,
+    0x86, 0x1C, 0x81, 0x64, 0x84, 0x20, 0x8F, 0x7B, 0x04, 0x01, 0xA1, 0x7C,
+    0x84, 0xB5, 0x36, 0x20, 0x0E, 0x82, 0x20, 0x11, 0x0F, 0x72, 0x2E, 0x81,
+    0x52, 0x99, 0x68, 0x01, 0x81, 0x05, 0x82, 0x20, 0x9D, 0x32, 0x82, 0x4F,
+    0x81, 0x46, 0xAB, 0x1A, 0x11, 0x0E, 0x82, 0x60, 0x3A, 0x03, 0x69, 0x1A,
+    0x52, 0x2E, 0x06, 0xAB, 0x2B, 0x0E, 0x01, 0x06, 0x81, 0x7A, 0x3B, 0x81,
+    0x25, 0x9E, 0x75, 0xBE, 0x24, 0x82, 0x82, 0x20, 0x1C, 0x2B, 0x60, 0xED,
+    0x32, 0x81, 0x8D, 0x6E, 0x82, 0x00, 0x82, 0x00, 0x06, 0x96, 0x00, 0x89,
+    0x3A, 0x84, 0x5F, 0x9A, 0x15, 0x95, 0x4C, 0x40, 0x81, 0x46, 0x8D, 0x0B,
+    0x81, 0x0E, 0x41, 0x81, 0x00, 0x4E, 0x83, 0x0E, 0x82, 0x44, 0x06, 0x20,
+    0x1A, 0x06, 0x81, 0x1A, 0x60, 0x46, 0x4C, 0x94, 0x3F, 0x0F, 0x32, 0x82,
+    0x2E, 0x52, 0x8D, 0x2E, 0x82, 0x6E, 0x84, 0x64, 0x82, 0x5F, 0x4F, 0x06,
+    0x8E, 0x3A, 0x84, 0xCD, 0x00, 0x12, 0x20, 0x0E, 0x41, 0x58, 0x02, 0x81,
+    0x05, 0x11, 0x0F, 0x01, 0x31, 0x03, 0x68, 0x03, 0x12, 0x40, 0x14, 0x5A,
+    0x12, 0x99, 0x6F, 0x11, 0x5F, 0x0A, 0x06, 0x82, 0x5F, 0x82, 0x20, 0x9A,
+    0x60, 0x13, 0x81, 0x66, 0x19, 0x14, 0x0B, 0x0F, 0x21, 0x11, 0x0E, 0x61,
+    0x1F, 0xAB, 0x1B, 0x06, 0x81, 0x7A, 0x45, 0x7A, 0x18, 0x6E, 0x3D, 0x04,
+    0x11, 0x27, 0x02, 0x05, 0xAA, 0x60, 0x59, 0x07, 0x13, 0x81, 0x5F, 0x0B,
+    0x24, 0x84, 0xDF, 0x7B, 0x75, 0x7D, 0x9F, 0x32, 0x01, 0x84, 0x5F, 0x97,
+    0x32, 0x81, 0x7F, 0x01, 0x0F, 0x81, 0x51, 0x93, 0x42, 0x41, 0x6B, 0x81,
+    0x40, 0x06, 0x7A, 0x84, 0x3C, 0x82, 0x6A, 0x86, 0x2C, 0x14, 0x7A, 0x06,
+    0x60, 0x82, 0x48, 0x8D, 0x78, 0x91, 0x1A, 0x84, 0x66, 0x82, 0x60, 0x16,
+    0x04, 0x06, 0x87, 0x60, 0x08, 0x18, 0xA4, 0x0B, 0x0E, 0x86, 0xC7, 0x72,
+    0x0F, 0xF3, 0x46, 0x8E, 0x7A, 0x9D, 0x31, 0x0F, 0x81, 0x9A, 0x60, 0x8D,
+    0xC6, 0x21, 0x88, 0x3F, 0x86, 0x40, 0x83, 0x41, 0x86, 0x3F, 0x89, 0x60,
+    0x95, 0x62, 0x1E, 0x81, 0x40, 0x06, 0x85, 0x70, 0x86, 0x6A, 0x86, 0x79,
+    0x78, 0x0E, 0x01, 0x81, 0x5C, 0x04, 0x5B, 0x05, 0x81, 0x20, 0x32, 0x83,
+    0x6E, 0x82, 0x06, 0x85, 0x5A, 0x06, 0x50, 0x0A, 0x81, 0x00, 0x06, 0x90,
+    0x20, 0x81, 0x00, 0x8C, 0x7A, 0x06, 0x0B, 0x09, 0x06, 0x81, 0x40, 0x40,
+    0x60, 0x06, 0x40, 0x0F, 0x2B, 0x87, 0x00, 0x72, 0x14, 0x83, 0x4F, 0x3C,
+    0x0E, 0x01, 0x89, 0x60, 0x41, 0x85, 0x5A, 0x04, 0x01, 0x82, 0x30, 0x85,
+    0x41, 0x81, 0x4F, 0x8E, 0x31, 0x0E, 0x87, 0x72, 0x08, 0x06, 0x01, 0x85,
+    0xBB, 0x20, 0xFC, 0x40, 0x06, 0x81, 0x7A, 0x81, 0x00, 0x31, 0x0F, 0x01,
+    0x34, 0x0B, 0x32, 0x14, 0x94, 0x0C, 0x87, 0x2E, 0x82, 0x00, 0x8A, 0x00,
+    0x06, 0x94, 0x4F, 0x82, 0x6B, 0x21, 0x95, 0x44, 0x57, 0x04, 0x20, 0x41,
+    0x1F, 0x81, 0x32, 0x86, 0x4E, 0x84, 0x52, 0x81, 0x00, 0x81, 0x5C, 0x81,
+    0x18, 0x9B, 0x7A, 0x06, 0x3A, 0x82, 0x5B, 0x81, 0x2C, 0xA4, 0x0A, 0x0E,
+    0x87, 0x72, 0x0E, 0x01, 0x86, 0xD9, 0x40, 0x86, 0x31, 0x0E, 0x01, 0x06,
+    0x98, 0x5A, 0x01, 0x9F, 0x10, 0x0E, 0x01, 0x89, 0x60, 0x06, 0x81, 0x7A,
+    0x8C, 0x00, 0x52, 0x0E, 0x83, 0x20, 0x8E, 0x7C, 0x0A, 0x8D, 0x0B, 0x0E,
+    0x01, 0x8F, 0x35, 0x90, 0x3C, 0x0F, 0x8A, 0xDB, 0x11, 0x15, 0x84, 0x00,
+    0x83, 0x1A, 0x87, 0x00, 0x82, 0x40, 0x84, 0x32, 0x8A, 0x6E, 0x8B, 0x5B,
+    0x90, 0x3D, 0x84, 0x09, 0x25, 0x8C, 0x0B, 0x0F, 0x06, 0x83, 0x74, 0x83,
+    0x66, 0x11, 0x0F, 0x06, 0x81, 0x60, 0x86, 0x0B, 0x0E, 0x01, 0x06, 0x82,
+    0x3A, 0x85, 0x31, 0x0E, 0x01, 0x06, 0x81, 0x3A, 0x06, 0x79, 0x84, 0x76,
+    0x2B, 0x06, 0x20, 0x1A, 0x81, 0x20, 0x06, 0x5A, 0x40, 0x81, 0x00, 0x84,
+    0x11, 0x0E, 0x01, 0x8F, 0x00, 0x52, 0x82, 0x4E, 0x06, 0x81, 0x0C, 0x14,
+    0x84, 0x2B, 0x0F, 0x83, 0x60, 0x84, 0x19, 0x81, 0x6D, 0x82, 0x00, 0x84,
+    0x4F, 0x81, 0x5C, 0x81, 0x05, 0x0A, 0x12, 0x84, 0x47, 0x06, 0x87, 0x67,
+    0x81, 0x7A, 0x89, 0xE9, 0x00, 0xEC, 0x46, 0xA0, 0x7A, 0x06, 0x87, 0x59,
+    0xA7, 0x01, 0x82, 0x40, 0x1C, 0x04, 0x85, 0x1B, 0x81, 0x76, 0x81, 0x4E,
+    0x16, 0x0B, 0x06, 0x81, 0x1A, 0x83, 0x35, 0x82, 0x0B, 0x06, 0x82, 0x1A,
+    0x9E, 0x00, 0x06, 0x81, 0x40, 0x3A, 0x85, 0x60, 0x06, 0x82, 0x00, 0x83,
+    0x6F, 0x87, 0x83, 0x59, 0x0E, 0x86, 0x72, 0xA0, 0x06, 0x9D, 0x67, 0x82,
+    0x25, 0x95, 0x51, 0x0E, 0x01, 0x82, 0x40, 0x8C, 0x45, 0x8F, 0xD8, 0x11,
+    0x0A, 0x83, 0xE0, 0x5F, 0x81, 0x67, 0x2E, 0xB0, 0x0C, 0xA9, 0x60, 0x81,
+    0x82, 0x79, 0x07, 0xA3, 0x3A, 0x07, 0x95, 0x30, 0x0E, 0x01, 0x99, 0x60,
+    0xCF, 0x79, 0x85, 0x98, 0x63, 0x89, 0xC9, 0x3E, 0x9A, 0x76, 0x85, 0x0A,
+    0x98, 0x06, 0x81, 0xA4, 0x32, 0x0A, 0x81, 0x44, 0x89, 0x72, 0xEB, 0x7F,
+    0x08, 0x06, 0x81, 0x67, 0x81, 0x88, 0x2C, 0x4F, 0x87, 0x64, 0x85, 0x2C,
+    0x84, 0x0E, 0x84, 0x06, 0x6D, 0x89, 0x6F, 0x40, 0x84, 0x5E, 0x81, 0x06,
+    0x81, 0x3B, 0x4E, 0x87, 0x33, 0x9D, 0x30, 0x0E, 0x87, 0x07, 0x7B, 0x8F,
+    0x7E, 0x81, 0x02, 0x93, 0x00, 0x94, 0x00, 0x83, 0x5E, 0x84, 0x20, 0x83,
+    0x0F, 0x0E, 0x87, 0x76, 0xF0, 0x47, 0xD3, 0x20, 0x81, 0x77, 0xAE, 0x10,
+    0x81, 0xE3, 0x3B, 0x83, 0x89, 0x17, 0xBE, 0x42, 0x8D, 0x5D, 0xA2, 0x2F,
+    0x06, 0x81, 0xE5, 0x5A, 0x01, 0xBB, 0x71, 0xFC, 0x74, 0x91, 0x1A, 0x84,
+    0x9D, 0x71, 0x0F, 0xB3, 0x26, 0x95, 0x97, 0x1B, 0x86, 0x7F, 0x86, 0x31,
+    0x0F, 0x90, 0x0E, 0x88, 0x38, 0x91, 0x1A, 0x9D, 0x40, 0x82, 0x66, 0x94,
+    0x75, 0x76, 0x0F, 0xA2, 0x40, 0x87, 0x61, 0x8D, 0x50, 0x9D, 0x35, 0x86,
+    0xB4, 0x7A, 0xA0, 0x40, 0x40, 0x81, 0x72, 0xB4, 0x4A, 0x04, 0x06, 0x88,
+    0x20, 0x88, 0x20, 0x9F, 0x1A, 0x06, 0x81, 0x60, 0x88, 0x3A, 0x88, 0x06,
+    0x94, 0x13, 0x86, 0xD7, 0x78, 0x0F, 0xA0, 0x20, 0x06, 0x8E, 0x4B, 0xA4,
+    0x6F, 0x86, 0x26, 0x86, 0x36, 0x81, 0x04, 0x56, 0x0A, 0xB1, 0x22, 0x8C,
+    0x2F, 0x0F, 0x8A, 0xE9, 0x40, 0x93, 0x40, 0x95, 0x20, 0x88, 0x00, 0x01,
+    0x81, 0x20, 0x8C, 0x30, 0x0E, 0x01, 0x06, 0x89, 0x60, 0x81, 0x7A, 0x8C,
+    0x54, 0xB9, 0x1E, 0x81, 0x6F, 0x8E, 0x1F, 0x06, 0x8E, 0x0B, 0x8A, 0xD8,
+    0x41, 0x82, 0x0E, 0xA4, 0x72, 0x14, 0x98, 0x37, 0x87, 0x1F, 0x83, 0x44,
+    0x06, 0x84, 0x56, 0x82, 0x04, 0x06, 0x82, 0x08, 0x9E, 0x71, 0x89, 0x21,
+    0x84, 0x20, 0x96, 0xF2, 0x2F, 0xCD, 0x51, 0x91, 0x16, 0x89, 0x0A, 0x88,
+    0x18, 0x16, 0x81, 0x33, 0x8B, 0x00, 0x82, 0x6D, 0x81, 0x72, 0x97, 0x36,
+    0x9B, 0x62, 0x83, 0x48, 0x87, 0x7C, 0x81, 0xF9, 0x16, 0x84, 0xC3, 0x1D,
+    0x9A, 0x71, 0x40, 0x40, 0xB8, 0x00, 0x8C, 0x7C, 0x91, 0x24, 0x8E, 0x20,
+    0x90, 0x15, 0xA8, 0x3C, 0x0E, 0x84, 0xC1, 0x37, 0x6A, 0x82, 0x8F, 0x20,
+    0x06, 0x86, 0x16, 0xB8, 0x24, 0x89, 0x60, 0x40, 0x20, 0x81, 0x20, 0x8B,
+    0x6E, 0x12, 0x20, 0x40, 0x81, 0x00, 0x06, 0x89, 0x72, 0x96, 0x08, 0x8E,
+    0x31, 0x0E, 0x01, 0x60, 0x83, 0x06, 0x95, 0x1A, 0x85, 0xEF, 0x32, 0x83,
+    0x35, 0x82, 0xDB, 0x51, 0x84, 0x5A, 0x9A, 0x5F, 0x81, 0x00, 0x08, 0x07,
+    0x81, 0x59, 0x08, 0x9D, 0x57, 0x5A, 0x83, 0x23, 0x2B, 0xAB, 0x40, 0x18,
+    0x82, 0x21, 0x82, 0x07, 0x5B, 0x05, 0xAE, 0x59, 0xDE, 0x35, 0x52, 0xD4,
+    0x60, 0x9A, 0x40, 0x06, 0x98, 0x28, 0x84, 0xF5, 0x0B, 0x81, 0x28, 0x83,
+    0x60, 0xBD, 0x58, 0xB0, 0x35, 0x04, 0x85, 0xA8, 0x2E, 0x82, 0x62, 0x88,
+    0xBA, 0x5E, 0x72, 0xC6, 0x6A, 0x8E, 0xE8, 0x1D, 0x75, 0x81, 0x51, 0x85,
+    0x32, 0x0E, 0x01, 0x81, 0x40, 0x86, 0x31, 0x0A, 0x05, 0x81, 0x52, 0x96,
+    0x2D, 0x93, 0x12, 0x0F, 0x46, 0x8C, 0x1A, 0x8F, 0x00, 0x20, 0x51, 0x0E,
+    0x01, 0x82, 0x60, 0x84, 0x16, 0x3C, 0x2E, 0x20, 0x81, 0x46, 0x8E, 0x33,
+    0x81, 0x02, 0x05, 0x82, 0x32, 0x8C, 0x03, 0x2B, 0x06, 0x4C, 0x0A, 0x81,
+    0x04, 0x82, 0x4E, 0x83, 0x63, 0x0E, 0x01, 0x83, 0x3C, 0x24, 0x83, 0x55,
+    0x4A, 0x06, 0x4D, 0x0E, 0x82, 0x72, 0x84, 0x0E, 0x55, 0x86, 0x4B, 0x71,
+    0x0F, 0x8A, 0x20, 0x85, 0x5F, 0x01, 0x81, 0x66, 0x86, 0x19, 0x83, 0x7E,
+    0x83, 0x74, 0x0F, 0x86, 0xB7, 0x35, 0x2B, 0x40, 0x06, 0x81, 0x1A, 0x06,
+    0x5A, 0x01, 0x3F, 0x01, 0x3A, 0x17, 0x03, 0x0C, 0x51, 0x94, 0x20, 0x87,
+    0x03, 0x82, 0x0B, 0x81, 0x60, 0x06, 0x88, 0x3A, 0x06, 0x83, 0x13, 0x81,
+    0x4D, 0x3B, 0xB0, 0x6D, 0x04, 0x49, 0x81, 0x44, 0x83, 0x61, 0x83, 0x7C,
+    0x8C, 0x23, 0x83, 0x4F, 0x93, 0x4E, 0x8C, 0x61, 0x8B, 0x75, 0x07, 0x06,
+    0x89, 0x01, 0x86, 0x7F, 0x01, 0x81, 0x00, 0x86, 0xC9, 0x0E, 0x04, 0x81,
+    0x0E, 0x84, 0x59, 0x83, 0x15, 0x84, 0x73, 0x81, 0x00, 0x3F, 0x89, 0x00,
+    0x85, 0x72, 0x81, 0x6E, 0x81, 0x61, 0x04, 0x83, 0x7A, 0x83, 0x61, 0x85,
+    0x01, 0x9F, 0x10, 0x0A, 0x04, 0x01, 0x86, 0x70, 0x82, 0x76, 0x5A, 0x81,
+    0x20, 0x83, 0x3C, 0x04, 0x51, 0x0F, 0x06, 0x7B, 0x81, 0x1F, 0x20, 0x20,
+    0x85, 0x11, 0x0A, 0x04, 0x01, 0x3C, 0x04, 0x81, 0x00, 0x82, 0x20, 0x06,
+    0x86, 0x3A, 0x86, 0x51, 0x81, 0x75, 0x96, 0x6C, 0x81, 0x0E, 0x81, 0x00,
+    0x84, 0x1F, 0x01, 0x52, 0x82, 0x40, 0x8C, 0x5F, 0x0A, 0x04, 0x01, 0x71,
+    0x84, 0xD8, 0x7D, 0x2E, 0x85, 0xFD, 0x44, 0x40, 0x81, 0x60, 0x06, 0x1A,
+    0x81, 0x35, 0x83, 0x2A, 0x27, 0x4B, 0x0F, 0x86, 0x79, 0x81, 0x67, 0x60,
+    0x81, 0x00, 0x81, 0x3A, 0x06, 0x84, 0x00, 0x32, 0x93, 0x2E, 0x06, 0x84,
+    0x1A, 0x6E, 0x02, 0x0B, 0x81, 0x40, 0x05, 0x8F, 0x60, 0x97, 0x40, 0x06,
+    0x8E, 0x19, 0x41, 0x89, 0x00, 0x40, 0x20, 0x06, 0x3A, 0x06, 0x4C, 0x2E,
+    0x84, 0x11, 0x0E, 0x01, 0x8F, 0x60, 0x20, 0x81, 0x00, 0x82, 0x26, 0x84,
+    0x59, 0x01, 0x83, 0x46, 0x88, 0x16, 0x24, 0x84, 0x35, 0x82, 0x1D, 0x4E,
+    0x12, 0x14, 0x1A, 0x84, 0x11, 0x0E, 0x01, 0x06, 0x87, 0x6B, 0x0E, 0x81,
+    0x67, 0x8D, 0x13, 0x8A, 0xC5, 0x07, 0x83, 0x71, 0x0F, 0x83, 0x0E, 0x85,
+    0x63, 0x4F, 0x06, 0x81, 0x4C, 0x85, 0x5E, 0x8F, 0x30, 0x87, 0x5F, 0x01,
+    0xA9, 0x60, 0x82, 0x20, 0x83, 0x7B, 0x82, 0x65, 0x06, 0x84, 0x19, 0x36,
+    0x7D, 0x0E, 0x90, 0x3B, 0x83, 0x05, 0x8B, 0x35, 0x3C, 0x0E, 0x01, 0x05,
+    0x41, 0x2B, 0x4F, 0x8A, 0x20, 0x06, 0x84, 0x0B, 0x0F, 0xA0, 0x00, 0x85,
+    0xF0, 0x76, 0xE6, 0x7C, 0xB2, 0x22, 0xA0, 0x41, 0x84, 0x60, 0xA0, 0x4B,
+    0x70, 0x90, 0x00, 0x8E, 0xF6, 0x14, 0x6D, 0x0E, 0x01, 0x5C, 0x82, 0x40,
+    0x83, 0x5E, 0x82, 0x6C, 0x8F, 0x08, 0x02, 0x87, 0x10, 0x70, 0x7E, 0x82,
+    0x12, 0x8B, 0x60, 0x82, 0x00, 0x20, 0x20, 0x82, 0x72, 0x85, 0x2D, 0x85,
+    0x40, 0x01, 0x86, 0x7F, 0x81, 0x01, 0x81, 0x60, 0x82, 0x00, 0x06, 0x83,
+    0x1A, 0x0E, 0x0E, 0x82, 0x52, 0x18, 0x85, 0x6B, 0x0F, 0x2E, 0x04, 0x0A,
+    0x0A, 0x28, 0x02, 0x56, 0x20, 0x28, 0x31, 0x73, 0x1C, 0x8E, 0x04, 0x8D,
+    0x20, 0x0E, 0x35, 0x4B, 0x32, 0x3C, 0x52, 0x20, 0x81, 0x46, 0x0F, 0x2B,
+    0x84, 0x1F, 0x81, 0x41, 0x7B, 0x81, 0x25, 0x83, 0x16, 0x3F, 0x3C, 0x0E,
+    0x01, 0x06, 0x5A, 0x82, 0x72, 0x81, 0x4A, 0x84, 0x44, 0x82, 0x32, 0x83,
+    0x69, 0x87, 0x76, 0x88, 0x00, 0x0F, 0x7A, 0x06, 0x86, 0x12, 0x83, 0x2D,
+    0x81, 0x02, 0x84, 0x30, 0x0E, 0x01, 0x86, 0xB7, 0x60, 0x82, 0x00, 0x06,
+    0x3A, 0x01, 0x05, 0x81, 0x3A, 0x06, 0x8B, 0x48, 0x87, 0x4B, 0x81, 0x75,
+    0x02, 0x86, 0x70, 0x84, 0x00, 0xB4, 0x00, 0x12, 0x82, 0x49, 0x81, 0x25,
+    0x84, 0x20, 0x82, 0x40, 0x85, 0x20, 0x84, 0x20, 0x88, 0x40, 0x93, 0x06,
+    0x39, 0x01, 0x32, 0x4F, 0x82, 0x25, 0x83, 0x5A, 0x83, 0x3B, 0x81, 0x0B,
+    0x83, 0x33, 0x78, 0x0E, 0x01, 0x60, 0x82, 0x32, 0x0A, 0x94, 0x55, 0x81,
+    0x6F, 0x9B, 0x3C, 0x86, 0xC1, 0x64, 0x82, 0x40, 0x81, 0x5C, 0x84, 0x4A,
+    0x4C, 0x4E, 0x82, 0x41, 0x86, 0x5F, 0x86, 0x00, 0x88, 0x41, 0x9F, 0x10,
+    0x0F, 0x87, 0x35, 0x2B, 0x1F, 0x01, 0x20, 0x81, 0x20, 0x06, 0x1A, 0x82,
+    0x00, 0x84, 0x11, 0x0B, 0x03, 0x01, 0x70, 0x86, 0x10, 0x32, 0x2E, 0x11,
+    0x0E, 0x01, 0x46, 0x34, 0x06, 0x32, 0x0E, 0x7F, 0x81, 0x21, 0x06, 0x1A,
+    0x9B, 0x71, 0x0F, 0x83, 0x55, 0x84, 0x07, 0x23, 0x01, 0x83, 0x60, 0x06,
+    0x84, 0x19, 0x01, 0x83, 0x12, 0x4E, 0x9C, 0x11, 0x0E, 0x01, 0x8A, 0xCA,
+    0x20, 0x81, 0x40, 0x8C, 0x6E, 0x72, 0x85, 0x39, 0x81, 0x00, 0x01, 0x06,
+    0x84, 0x00, 0x94, 0x46, 0x83, 0x33, 0x8D, 0x67, 0x81, 0x32, 0x2F, 0x93,
+    0x38, 0x06, 0x61, 0x06, 0x1A, 0x81, 0x60, 0x06, 0x81, 0x7A, 0x86, 0x0E,
+    0x18, 0x84, 0x6B, 0x81, 0x15, 0x3A, 0x81, 0x00, 0x81, 0x00, 0x81, 0x15,
+    0x83, 0x60, 0x2B, 0x06, 0x0B, 0x82, 0x2F, 0x81, 0x00, 0x12, 0x2E, 0x84,
+    0x11, 0x0E, 0x01, 0x06, 0x8E, 0x73, 0x0D, 0x73, 0x07, 0x82, 0x20, 0x1B,
+    0x1A, 0x85, 0x31, 0x83, 0x40, 0x84, 0x33, 0x07, 0x01, 0x5F, 0x13, 0x81,
+    0x4C, 0x81, 0x1D, 0x84, 0x15, 0x0F, 0x81, 0x51, 0x10, 0x30, 0x10, 0x7A,
+    0x17, 0x14, 0x0F, 0x84, 0x1C, 0x0E, 0x01, 0x72, 0x86, 0x7F, 0x0E, 0x88,
+    0x73, 0x8A, 0xD8, 0x4E, 0x06, 0x82, 0x3A, 0x83, 0x66, 0x90, 0x3A, 0x83,
+    0x36, 0x84, 0x70, 0xA6, 0x6F, 0x0C, 0x30, 0x0F, 0x81, 0x60, 0x81, 0x76,
+    0x83, 0x46, 0x82, 0x6A, 0x5A, 0x84, 0x55, 0x79, 0x04, 0x0E, 0x89, 0x60,
+    0x94, 0x59, 0x82, 0x47, 0x06, 0x81, 0x50, 0x84, 0x5B, 0x0E, 0x01, 0x66,
+    0x0A, 0x56, 0x82, 0x00, 0x1A, 0x06, 0x84, 0x0B, 0x0E, 0x01, 0x83, 0x60,
+    0xAB, 0x18, 0x86, 0x2E, 0x87, 0x99, 0x4F, 0x0B, 0xA4, 0x15, 0x8D, 0x4B,
+    0x8E, 0xE9, 0x40, 0x88, 0x0F, 0x86, 0x2D, 0x82, 0x36, 0x85, 0x6D, 0xA5,
+    0x72, 0x81, 0x2F, 0x81, 0x40, 0x82, 0x32, 0x8B, 0x5F, 0x8F, 0x35, 0x4B,
+    0x0E, 0x01, 0x8A, 0x26, 0x8D, 0x5A, 0x82, 0x66, 0x8C, 0x5A, 0x82, 0x00,
+    0x06, 0x85, 0x33, 0x84, 0x6D, 0x83, 0x13, 0x3C, 0x84, 0x31, 0x8B, 0x13,
+    0x81, 0x00, 0x07, 0x74, 0x83, 0x32, 0x86, 0xD6, 0x3A, 0x40, 0x35, 0x8D,
+    0x6B, 0x8E, 0x20, 0x06, 0x82, 0x7A, 0x90, 0x3C, 0x8D, 0x19, 0xB1, 0x6B,
+    0x95, 0x40, 0x06, 0x84, 0x2C, 0x14, 0x87, 0x3A, 0x88, 0x00, 0x8C, 0x1F,
+    0x84, 0x01, 0x83, 0x79, 0x06, 0x81, 0x67, 0x81, 0x60, 0x1A, 0x88, 0x20,
+    0x86, 0xD3, 0x7F, 0x53, 0x6E, 0x8D, 0x72, 0x88, 0x74, 0x83, 0x40, 0x84,
+    0x48, 0x33, 0xA9, 0x05, 0x85, 0x30, 0x10, 0x88, 0x5A, 0x81, 0x0E, 0x81,
+    0x18, 0x81, 0x2F, 0x8F, 0x11, 0x95, 0x10, 0x88, 0x09, 0x72, 0x82, 0x21,
+    0x0A, 0x9C, 0x55, 0x0F, 0x8A, 0xD1, 0x52, 0x14, 0x87, 0x5A, 0x85, 0x39,
+    0x6D, 0x1A, 0x89, 0x60, 0x98, 0x64, 0x88, 0x4E, 0x0E, 0x12, 0x14, 0x9B,
+    0x2B, 0x88, 0x41, 0x4E, 0x40, 0x86, 0x60, 0x82, 0x20, 0x06, 0x5A, 0x81,
+    0x12, 0x96, 0x4E, 0x81, 0x55, 0x84, 0x1C, 0x0F, 0x06, 0x87, 0x2F, 0x3C,
+    0x0F, 0x8A, 0x20, 0x84, 0x52, 0x0E, 0x79, 0x87, 0x0D, 0x85, 0xC1, 0x0D,
+    0x85, 0x97, 0x13, 0x90, 0x59, 0x01, 0x32, 0xB7, 0x3F, 0x0F, 0x89, 0x60,
+    0x85, 0x40, 0xAC, 0x12, 0x90, 0x34, 0x87, 0xBE, 0x55, 0x88, 0x1A, 0x8F,
+    0xED, 0x1C, 0x0A, 0x83, 0x7F, 0xB3, 0x77, 0x88, 0x0F, 0x81, 0x00, 0x86,
+    0x7B, 0x65, 0x81, 0x8A, 0x52, 0x81, 0x4E, 0x9E, 0x60, 0xAC, 0x20, 0x81,
+    0xA3, 0x7F, 0x8A, 0x7C, 0x99, 0x04, 0x83, 0x13, 0x94, 0x6D, 0xC6, 0x7A,
+    0x81, 0x08, 0xFF, 0x7E, 0x81, 0x67, 0xAA, 0x14, 0xAF, 0x26, 0x5F, 0x81,
+    0xA0, 0x01, 0x82, 0x92, 0x79, 0x78, 0x0E, 0xEF, 0x7C, 0x81, 0xAC, 0x17,
+    0x93, 0x5F, 0x0E, 0x01, 0xB0, 0x00, 0x81, 0xBA, 0x14, 0x9E, 0x5C, 0x81,
+    0xF7, 0x01, 0x0E, 0x91, 0x41, 0x83, 0x99, 0x16, 0x82, 0x2A, 0x81, 0x82,
+    0x00, 0x81, 0x90, 0x7B, 0x04, 0x73, 0x89, 0x4E, 0xA1, 0x52, 0xAC, 0x34,
+    0x81, 0xAF, 0x68, 0x81, 0x72, 0xA1, 0x40, 0x81, 0xCC, 0x1F, 0x93, 0x13,
+    0x9F, 0x29, 0xCD, 0x46, 0x81, 0xA7, 0x70, 0xAA, 0x64, 0xE5, 0x1C, 0x0F,
+    0xB9, 0x60, 0xA0, 0x40, 0x6E, 0x9F, 0x04, 0x02, 0x81, 0x66, 0xD3, 0x77,
+    0x7F, 0x82, 0xE8, 0x70, 0x34, 0x81, 0x3E, 0x84, 0x1F, 0x81, 0x10, 0x85,
+    0x7F, 0x88, 0x7F, 0x96, 0x7C, 0x90, 0x7E, 0xC9, 0x07, 0x8F, 0x5C, 0x81,
+    0xA7, 0x23, 0x81, 0xF8, 0x00, 0xE0, 0x00, 0x81, 0x98, 0x62, 0xB6, 0x51,
+    0xAC, 0x2E, 0x83, 0x7C, 0x15, 0x0E, 0x3D, 0x82, 0x56, 0x3C, 0xAE, 0x72,
+    0xB7, 0x20, 0x81, 0x46, 0x2C, 0x9E, 0x4E, 0x81, 0x00, 0x01, 0xCD, 0x50,
+    0xB0, 0x61, 0x2E, 0x81, 0xA0, 0x14, 0x95, 0x6D, 0x8F, 0x70, 0x0E, 0x81,
+    0xA2, 0x45, 0xB5, 0x0E, 0x84, 0xB2, 0x40, 0x8D, 0x9D, 0x5F, 0x09, 0x05,
+    0x01, 0x06, 0x81, 0x3A, 0x82, 0x20, 0x84, 0x06, 0x83, 0x2C, 0x83, 0x69,
+    0x90, 0x00, 0x76, 0x0E, 0x01, 0x91, 0x60, 0x40, 0x01, 0x7F, 0x94, 0x4E,
+    0x03, 0x0E, 0x01, 0x81, 0x60, 0x06, 0x1A, 0x06, 0x50, 0x0A, 0x66, 0x83,
+    0x60, 0x87, 0x5F, 0x49, 0x23, 0x08, 0x07, 0x40, 0x30, 0x56, 0x82, 0x00,
+    0x16, 0x04, 0x8B, 0x19, 0x07, 0x04, 0x7B, 0x82, 0x57, 0x10, 0x8C, 0x1A,
+    0x35, 0x3C, 0x0E, 0x01, 0x81, 0x2E, 0x12, 0x06, 0x81, 0x60, 0x0C, 0x2E,
+    0x06, 0x84, 0x68, 0x82, 0x64, 0x1C, 0x04, 0x0E, 0x06, 0x83, 0x4F, 0x46,
+    0x04, 0x01, 0x60, 0x1C, 0x82, 0x4A, 0x20, 0x87, 0x4C, 0x84, 0x3F, 0x0E,
+    0x01, 0x87, 0x71, 0x81, 0x6F, 0x40, 0x85, 0x60, 0x87, 0x71, 0x01, 0x0D,
+    0x86, 0xBF, 0x33, 0x03, 0x82, 0x0B, 0x06, 0x1A, 0x81, 0x39, 0x07, 0x40,
+    0x06, 0x8B, 0x15, 0x82, 0x45, 0x85, 0x39, 0x8A, 0x47, 0x20, 0x40, 0x40,
+    0x06, 0x3A, 0x72, 0x8C, 0x34, 0x9F, 0x3A, 0x82, 0x32, 0x89, 0x2E, 0x8B,
+    0x19, 0x39, 0x2E, 0x81, 0x20, 0x81, 0x12, 0x14, 0x81, 0x3A, 0x86, 0x40,
+    0x06, 0x88, 0x40, 0x8C, 0x4F, 0x81, 0x44, 0x47, 0x06, 0x3A, 0x81, 0x26,
+    0x3A, 0x40, 0x85, 0x26, 0x7A, 0x81, 0x1C, 0x04, 0x83, 0x19, 0x81, 0x06,
+    0x83, 0x67, 0x94, 0x0C, 0x81, 0x0F, 0x84, 0xCF, 0x31, 0x83, 0x00, 0xA1,
+    0x0E, 0x9A, 0x39, 0x84, 0x3C, 0x97, 0x10, 0x97, 0x4D, 0x14, 0x81, 0x36,
+    0xCD, 0x72, 0xC0, 0x4E, 0x8C, 0x64, 0x82, 0x40, 0x06, 0x7B, 0x8C, 0x71,
+    0x83, 0x6E, 0x46, 0x8C, 0x60, 0x91, 0x4E, 0x8D, 0x5D, 0x0E, 0x01, 0x86,
+    0x73, 0x7E, 0x0F, 0x81, 0x60, 0x61, 0x88, 0x1F, 0x84, 0x52, 0x03, 0x3C,
+    0x0F, 0x06, 0x3A, 0x7C, 0x04, 0x06, 0x48, 0x18, 0x15, 0x81, 0x21, 0x04,
+    0x1D, 0x86, 0x23, 0x81, 0x60, 0x83, 0x71, 0x0E, 0x01, 0x01, 0x81, 0x00,
+    0x8A, 0x71, 0x85, 0x4E, 0x8A, 0x06, 0x0C, 0x83, 0x2E, 0x35, 0x81, 0x2B,
+    0x06, 0x81, 0x55, 0x81, 0x13, 0x8E, 0x73, 0x8D, 0x38, 0x79, 0x94, 0x1C,
+    0x84, 0xB2, 0x24, 0x81, 0x00, 0x3F, 0x0A, 0x06, 0x81, 0x11, 0x06, 0x08,
+    0x01, 0x81, 0x14, 0x05, 0x18, 0x0E, 0x06, 0x81, 0x1A, 0x0E, 0x99, 0x63,
+    0x0F, 0x01, 0x11, 0x0E, 0xA0, 0x51, 0x0F, 0xAF, 0x60, 0x82, 0x38, 0x48,
+    0x81, 0x00, 0x60, 0x40, 0xAA, 0x38, 0x81, 0x08, 0x81, 0x2F, 0x03, 0x0B,
+    0x03, 0x06, 0x12, 0x81, 0x1D, 0x84, 0xDC, 0x00, 0x92, 0x0B, 0x82, 0x40,
+    0x84, 0x46, 0x89, 0x3A, 0x81, 0x46, 0x1A, 0x9E, 0x41, 0x81, 0x11, 0x8C,
+    0x3F, 0x0E, 0x01, 0x06, 0x86, 0x79, 0x72, 0x0E, 0x01, 0x7C, 0x32, 0x32,
+    0x60, 0x82, 0x3D, 0x03, 0x85, 0x06, 0x5A, 0x84, 0x52, 0x14, 0x1A, 0x20,
+    0x40, 0x86, 0x75, 0x3C, 0x2F, 0x40, 0x81, 0x00, 0x81, 0x00, 0x85, 0x20,
+    0x82, 0x4E, 0x18, 0x8C, 0x4F, 0x3C, 0x0F, 0x46, 0x7A, 0x06, 0x56, 0x04,
+    0x81, 0x40, 0x84, 0x11, 0x0E, 0x01, 0x06, 0x7B, 0x82, 0x31, 0x2E, 0x88,
+    0x06, 0x83, 0x4F, 0x6B, 0x81, 0x71, 0x81, 0x0F, 0x40, 0x8C, 0x1F, 0x88,
+    0x01, 0x84, 0xCA, 0x00, 0x14, 0x04, 0x81, 0x3A, 0x0E, 0x5B, 0x45, 0x9A,
+    0x32, 0x49, 0x82, 0x05, 0x60, 0x60, 0x81, 0x40, 0x9A, 0x32, 0x06, 0x1A,
+    0x1F, 0x0E, 0x01, 0x40, 0x81, 0x32, 0x0B, 0x24, 0x1A, 0x04, 0x73, 0x08,
+    0x6C, 0x6C, 0xAA, 0x00, 0x4E, 0x40, 0x81, 0x32, 0x2A, 0x04, 0x12, 0x02,
+    0x1F, 0x2D, 0x52, 0x14, 0x2B, 0x21, 0x27, 0x07, 0x26, 0xAA, 0x6C, 0x82,
+    0x40, 0xDF, 0x48, 0xA2, 0x17, 0x93, 0x13, 0xDC, 0x5C, 0xAB, 0x55, 0x82,
+    0xC8, 0x4B, 0x70, 0x10, 0x87, 0x00, 0x81, 0x40, 0x87, 0x06, 0x8F, 0x5A,
+    0x06, 0xA7, 0x4B, 0x0F, 0x81, 0x2E, 0x86, 0x43, 0x0F, 0x81, 0x60, 0x81,
+    0x00, 0x06, 0x4C, 0x83, 0x4E, 0x83, 0x60, 0x84, 0x55, 0x82, 0x0B, 0x06,
+    0x82, 0x1A, 0x8B, 0x12, 0x07, 0x82, 0x00, 0x81, 0x6D, 0x8D, 0x0C, 0x0D,
+    0x33, 0x4E, 0x60, 0x81, 0x40, 0x12, 0x85, 0x34, 0x82, 0x60, 0x88, 0x1A,
+    0x06, 0x83, 0xCC, 0x0B, 0x83, 0xCA, 0x15, 0xA8, 0x35, 0xAD, 0x45, 0xB0,
+    0x00, 0x81, 0x00, 0xCC, 0x27, 0xB5, 0xFA, 0x11, 0x28, 0x33, 0x66, 0x39,
+    0x14, 0x14, 0x81, 0x3E, 0x09, 0x14, 0x01, 0x81, 0x4A, 0x84, 0x01, 0x96,
+    0x7A, 0x04, 0x81, 0x5A, 0x81, 0x42, 0x0B, 0x1B, 0x31, 0x9B, 0x46, 0x28,
+    0x21, 0x12, 0x81, 0x46, 0x08, 0x31, 0x0E, 0x01, 0x3F, 0x32, 0x06, 0x09,
+    0x31, 0x0E, 0xAD, 0x1B, 0x06, 0x58, 0x81, 0x75, 0x04, 0x03, 0x97, 0x93,
+    0x41, 0x81, 0x5B, 0x87, 0x00, 0x0E, 0x01, 0x81, 0x40, 0x85, 0x3F, 0x81,
+    0x77, 0x06, 0x09, 0x81, 0x36, 0x91, 0x25, 0x83, 0x20, 0x71, 0x0F, 0x2E,
+    0x8F, 0x32, 0x82, 0x00, 0x40, 0x06, 0x81, 0x0C, 0x83, 0x43, 0x88, 0x7C,
+    0x0E, 0x01, 0x89, 0x66, 0x87, 0x0C, 0x81, 0x6E, 0x84, 0x55, 0x31, 0x0C,
+    0x40, 0x14, 0x7A, 0x82, 0x20, 0x8C, 0x11, 0x0E, 0x01, 0x71, 0x8F, 0x00,
+    0x0E, 0x01, 0x8A, 0x60, 0x06, 0x85, 0x0B, 0x0E, 0x01, 0x7C, 0x82, 0x6A,
+    0x8C, 0x0B, 0x08, 0x02, 0x04, 0x01, 0x87, 0x7F, 0x81, 0x67, 0x8E, 0x0B,
+    0x82, 0x4A, 0x85, 0x36, 0x0F, 0x82, 0x3F, 0x86, 0xB4, 0x76, 0x0C, 0x10,
+    0x0F, 0x06, 0x81, 0x74, 0x06, 0x20, 0x60, 0x3A, 0x06, 0x83, 0x5F, 0x7A,
+    0x78, 0x83, 0x0F, 0x01, 0x82, 0x7C, 0x35, 0x83, 0x09, 0x81, 0x1B, 0x06,
+    0x23, 0x83, 0x67, 0x81, 0x0B, 0x75, 0x5F, 0x82, 0x2D, 0x82, 0x6E, 0x06,
+    0x3A, 0x81, 0x20, 0x20, 0x82, 0x32, 0x83, 0x6D, 0x81, 0x02, 0x85, 0x78,
+    0x81, 0x0C, 0x86, 0x6A, 0x89, 0x4C, 0x7B, 0x6A, 0x86, 0x54, 0x8E, 0x11,
+    0x01, 0x81, 0x6A, 0x11, 0x85, 0x7C, 0x82, 0x04, 0x04, 0x85, 0x74, 0x67,
+    0x24, 0x83, 0x5C, 0x87, 0x34, 0x83, 0x72, 0x73, 0x81, 0x6D, 0x5A, 0x8C,
+    0x3B, 0x85, 0x00, 0x83, 0x06, 0x81, 0x00, 0x03, 0x77, 0x06, 0x81, 0x43,
+    0x81, 0x1C, 0x83, 0x55, 0x81, 0x3D, 0x82, 0x2A, 0x0A, 0x88, 0x0C, 0x84,
+    0x47, 0x08, 0x83, 0x71, 0x83, 0x7F, 0x84, 0xEF, 0x0F, 0x82, 0x72, 0x82,
+    0x08, 0x9E, 0x22, 0xFF, 0x56, 0xBF, 0x6E, 0x8E, 0x11, 0x0E, 0x01, 0x81,
+    0x40, 0x86, 0x3F, 0x01, 0x32, 0x14, 0x8F, 0x39, 0x21, 0x81, 0x32, 0x82,
+    0x0E, 0x85, 0x01, 0x10, 0x81, 0x4E, 0xA5, 0x32, 0x0F, 0x81, 0x60, 0x86,
+    0x11, 0x0F, 0x87, 0x60, 0x60, 0x81, 0x00, 0x81, 0x72, 0x88, 0x2E, 0x84,
+    0x1B, 0x04, 0x97, 0x7C, 0x04, 0x01, 0x81, 0x40, 0x06, 0x86, 0x3A, 0x85,
+    0x26, 0x89, 0x53, 0x78, 0x0A, 0x04, 0x01, 0x01, 0x96, 0x78, 0x8A, 0xC0,
+    0x3C, 0x2B, 0x82, 0x20, 0x20, 0x81, 0x00, 0x21, 0x84, 0x30, 0x0F, 0x7B,
+    0x81, 0x46, 0x86, 0x7F, 0x06, 0x86, 0x36, 0x98, 0x03, 0x83, 0x73, 0x8D,
+    0x6E, 0x96, 0x20, 0x81, 0x60, 0x85, 0x1B, 0x81, 0x01, 0x82, 0x64, 0x84,
+    0x7C, 0x88, 0x04, 0x40, 0x81, 0x20, 0x40, 0x06, 0x81, 0x3B, 0x1F, 0x84,
+    0x11, 0x0E, 0x01, 0x06, 0x97, 0x7A, 0x7B, 0x86, 0x05, 0x83, 0x3F, 0x85,
+    0x41, 0x32, 0x03, 0x81, 0x5C, 0x81, 0x21, 0x0F, 0x11, 0x0E, 0x84, 0x11,
+    0x0E, 0x01, 0x86, 0x7B, 0x6B, 0x0B, 0x08, 0x06, 0x8E, 0x7A, 0x8A, 0xC9,
+    0x07, 0x81, 0x52, 0x87, 0x00, 0x6E, 0x86, 0x26, 0x19, 0x90, 0x21, 0x87,
+    0x06, 0x92, 0x6E, 0x0C, 0x95, 0x51, 0x0E, 0x01, 0x87, 0x0E, 0x6D, 0x82,
+    0x0B, 0x39, 0x21, 0x85, 0x20, 0x40, 0x30, 0x81, 0x36, 0x81, 0x3A, 0x06,
+    0x8C, 0x0C, 0x8F, 0x07, 0x89, 0x07, 0x66, 0x5A, 0x82, 0x20, 0x06, 0x88,
+    0x00, 0x96, 0xEC, 0x19, 0x81, 0x53, 0x6F, 0x4D, 0x04, 0x86, 0x2E, 0x81,
+    0x4E, 0x84, 0x72, 0x62, 0x81, 0x04, 0x8E, 0x19, 0x01, 0x87, 0x00, 0x7F,
+    0x01, 0x46, 0x81, 0x7A, 0x86, 0x2F, 0x88, 0x71, 0x41, 0x81, 0x34, 0x8C,
+    0x2A, 0x01, 0x86, 0x71, 0x81, 0x0F, 0x81, 0x66, 0x55, 0x73, 0x32, 0x06,
+    0x2C, 0x0A, 0x82, 0x72, 0x72, 0x06, 0x87, 0x5A, 0x06, 0x19, 0x41, 0x92,
+    0x26, 0x8C, 0x15, 0x81, 0x37, 0x4E, 0x46, 0x8A, 0x00, 0x83, 0x40, 0x6B,
+    0x0F, 0x7B, 0x84, 0x04, 0x82, 0x33, 0x14, 0x82, 0x48, 0x81, 0x44, 0x84,
+    0x1F, 0x0E, 0x01, 0x82, 0x3F, 0x07, 0x81, 0x60, 0x83, 0x4B, 0x88, 0x0F,
+    0x87, 0x7F, 0x82, 0xBF, 0x21, 0x40, 0x60, 0x81, 0x11, 0x01, 0x0B, 0x09,
+    0x17, 0x03, 0x20, 0x01, 0x31, 0x40, 0x01, 0x0A, 0x03, 0x06, 0x3A, 0x9E,
+    0x32, 0x0F, 0x97, 0x5B, 0x82, 0x32, 0x86, 0x0D, 0xAD, 0x58, 0x81, 0x3E,
+    0x41, 0x2B, 0x04, 0x11, 0x40, 0x09, 0x64, 0x02, 0x38, 0x07, 0x92, 0x34,
+    0x06, 0x03, 0x75, 0x12, 0x76, 0x03, 0x81, 0x34, 0x03, 0x81, 0x3B, 0x0B,
+    0x93, 0x14, 0x52, 0x33, 0x81, 0x46, 0x27, 0x81, 0x13, 0x3F, 0x82, 0xDE,
+    0x0E, 0x20, 0x06, 0x81, 0x1A, 0x40, 0x88, 0x1A, 0x87, 0x66, 0x83, 0x1B,
+    0x81, 0x37, 0x14, 0x83, 0x34, 0x83, 0x66, 0x06, 0x81, 0x5A, 0x40, 0x60,
+    0x40, 0x90, 0x52, 0x8E, 0x20, 0x83, 0x00, 0x93, 0x14, 0x81, 0x3A, 0x86,
+    0x1B, 0x81, 0x05, 0x86, 0x60, 0x82, 0x2E, 0x31, 0x73, 0x8B, 0x47, 0x81,
+    0x75, 0x81, 0x58, 0x81, 0x08, 0x8C, 0x31, 0x21, 0x12, 0x41, 0x83, 0x07,
+    0x18, 0x0A, 0x8A, 0x56, 0x07, 0x84, 0x67, 0x1D, 0x8B, 0x7E, 0x04, 0x87,
+    0x72, 0x0E, 0x87, 0x72, 0x0E, 0x01, 0x84, 0xC7, 0x38, 0x1A, 0x0E, 0x06,
+    0x3B, 0x1F, 0x20, 0x52, 0x14, 0x0C, 0x07, 0x08, 0x05, 0x0C, 0x0E, 0x18,
+    0x3A, 0x3F, 0x01, 0x06, 0x05, 0x75, 0x27, 0x01, 0x46, 0x8B, 0x56, 0x8E,
+    0x1D, 0x0C, 0x61, 0x1B, 0x02, 0x02, 0x02, 0x77, 0x5B, 0x06, 0x82, 0x62,
+    0x05, 0x9B, 0x31, 0x0E, 0x01, 0x21, 0x81, 0x38, 0x27, 0x12, 0x0E, 0x06,
+    0x3A, 0x32, 0x06, 0x07, 0x02, 0x3F, 0x40, 0xAA, 0x59, 0x08, 0x37, 0x48,
+    0x82, 0x12, 0x26, 0x08, 0x01, 0x1F, 0x32, 0x09, 0x06, 0x3F, 0x21, 0x11,
+    0x29, 0x05, 0x06, 0x93, 0x2B, 0x13, 0x83, 0x6B, 0x05, 0x93, 0x44, 0x82,
+    0x68, 0x01, 0x81, 0x14, 0x2B, 0x9C, 0x1F, 0x81, 0x67, 0xCB, 0x13, 0x84,
+    0x43, 0x04, 0x86, 0x31, 0x0F, 0x81, 0x52, 0x86, 0x60, 0x83, 0x60, 0x87,
+    0x4E, 0x85, 0x00, 0x01, 0x18, 0x75, 0x32, 0xA7, 0x20, 0x06, 0x1A, 0x06,
+    0x5A, 0x81, 0x20, 0x06, 0x86, 0x55, 0x84, 0x77, 0x4E, 0x04, 0x2E, 0x0E,
+    0x81, 0x00, 0x82, 0x40, 0x9B, 0x71, 0x0A, 0x05, 0x86, 0x79, 0x81, 0x07,
+    0x83, 0x46, 0x83, 0x39, 0x72, 0x0F, 0x9F, 0x7F, 0x01, 0x83, 0x55, 0x11,
+    0x8C, 0x0B, 0x0E, 0x01, 0x82, 0xBB, 0x52, 0x9C, 0x2F, 0x7A, 0x83, 0x45,
+    0x9B, 0x20, 0x11, 0x0E, 0x01, 0x13, 0x81, 0x46, 0x24, 0x03, 0x20, 0x01,
+    0x3F, 0x41, 0x31, 0x0E, 0x32, 0xAA, 0x67, 0xB0, 0x07, 0x82, 0x58, 0x01,
+    0x3F, 0x9D, 0x6E, 0xBF, 0x1A, 0x18, 0x81, 0x08, 0x3B, 0x37, 0x4E, 0x14,
+    0x0D, 0x3F, 0x55, 0x1D, 0x0E, 0x06, 0x2C, 0x2E, 0x40, 0x9A, 0x60, 0x18,
+    0x05, 0x04, 0x82, 0x60, 0x81, 0x5F, 0x9A, 0x72, 0x06, 0x1A, 0x2D, 0x81,
+    0x73, 0x0E, 0x06, 0x0E, 0x04, 0x48, 0x81, 0x00, 0xAB, 0x40, 0x60, 0x40,
+    0x81, 0x7D, 0x15, 0x0E, 0x55, 0x20, 0x0B, 0x60, 0xAB, 0x31, 0x0F, 0x40,
+    0x81, 0x3D, 0x03, 0x14, 0x04, 0x81, 0x05, 0x03, 0x15, 0x2B, 0x9C, 0x1F,
+    0x81, 0x67, 0xBD, 0x52, 0x82, 0x21, 0x81, 0x48, 0x14, 0x9B, 0x4A, 0x82,
+    0x5A, 0x08, 0x9F, 0x71, 0x14, 0x81, 0x32, 0x3A, 0x03, 0xAB, 0x63, 0x81,
+    0x08, 0x72, 0x0A, 0x0A, 0x1B, 0x81, 0x71, 0xAF, 0x41, 0x4D, 0xDB, 0x58,
+    0x6A, 0x1E, 0x39, 0x39, 0x14, 0x81, 0x1A, 0x32, 0x01, 0x05, 0x01, 0x9B,
+    0x5F, 0x81, 0x07, 0x9F, 0x39, 0x1A, 0x41, 0x82, 0x3F, 0x0E, 0x81, 0x00,
+    0xAB, 0x40, 0x81, 0x20, 0x81, 0x71, 0x07, 0x05, 0x04, 0x51, 0x0F, 0x3F,
+    0x21, 0x3F, 0x06, 0xAA, 0x5A, 0x73, 0x2D, 0xE1, 0x00, 0x81, 0x20, 0x06,
+    0x3A, 0x84, 0x5F, 0x88, 0x7D, 0x44, 0x85, 0x40, 0x90, 0x00, 0x84, 0x66,
+    0x84, 0x60, 0x91, 0x1A, 0x95, 0x1F, 0x72, 0x0F, 0x71, 0x81, 0x4F, 0x81,
+    0x52, 0x8A, 0x6D, 0x81, 0x41, 0x30, 0x81, 0x36, 0x87, 0x1A, 0x82, 0x15,
+    0x11, 0x87, 0x00, 0x8D, 0x19, 0x01, 0x83, 0x26, 0x28, 0x12, 0x94, 0x55,
+    0x81, 0x0B, 0x20, 0x31, 0x4F, 0x06, 0x3A, 0x12, 0x23, 0x8C, 0x1C, 0x0E,
+    0xCF, 0x33, 0x20, 0x81, 0x60, 0x4E, 0x18, 0x08, 0x72, 0x06, 0x08, 0x1A,
+    0x18, 0x0E, 0x5B, 0x45, 0x99, 0x78, 0x07, 0x39, 0x08, 0x31, 0x81, 0x68,
+    0x08, 0x30, 0x10, 0x79, 0x81, 0x26, 0x9A, 0x72, 0x0E, 0x06, 0x2B, 0x08,
+    0x07, 0x13, 0x81, 0x1F, 0x14, 0x13, 0x08, 0x31, 0x0E, 0x06, 0x6C, 0x14,
+    0x2C, 0x0E, 0x40, 0x92, 0x61, 0x05, 0x81, 0x7B, 0x97, 0x78, 0x39, 0x81,
+    0x01, 0x05, 0x01, 0x02, 0x04, 0x53, 0x0F, 0x3F, 0x21, 0x93, 0x00, 0x05,
+    0x6C, 0x81, 0x02, 0x81, 0x40, 0x81, 0x3E, 0x93, 0x6E, 0x82, 0x12, 0x14,
+    0x12, 0x81, 0x03, 0x05, 0x01, 0x2D, 0x81, 0xFB, 0x21, 0x02, 0x10, 0x03,
+    0x6E, 0x7D, 0x02, 0x84, 0xDE, 0x2F, 0x18, 0x5B, 0x1F, 0x0E, 0x06, 0x2B,
+    0x0A, 0x04, 0x33, 0x20, 0x06, 0x01, 0x24, 0x14, 0x07, 0x3D, 0x3D, 0x06,
+    0x08, 0x01, 0x14, 0x1D, 0x0E, 0x32, 0x6E, 0x93, 0x7C, 0x85, 0x75, 0x07,
+    0x01, 0x01, 0x77, 0x08, 0x04, 0x02, 0x7C, 0x81, 0x05, 0x1C, 0x05, 0x3F,
+    0x3B, 0x45, 0x60, 0x9A, 0x78, 0x48, 0x13, 0x81, 0x3F, 0x07, 0x08, 0x33,
+    0x04, 0x09, 0x7F, 0xAB, 0x61, 0x37, 0x81, 0x38, 0x42, 0x20, 0x1C, 0x0F,
+    0x15, 0x14, 0x0B, 0x08, 0x04, 0x23, 0x32, 0x06, 0x02, 0x0C, 0x57, 0x04,
+    0x11, 0x2E, 0x92, 0x3D, 0x07, 0x02, 0x77, 0x07, 0x6A, 0x0C, 0x03, 0x81,
+    0x40, 0x81, 0x3D, 0x07, 0x93, 0x1F, 0x18, 0x28, 0x06, 0x2D, 0x81, 0x6A,
+    0x03, 0x14, 0x04, 0x08, 0x01, 0x9F, 0x31, 0x04, 0xC2, 0x3C, 0x8D, 0x2E,
+    0x8A, 0x06, 0x84, 0x0C, 0x83, 0x4E, 0x46, 0x8B, 0x19, 0x93, 0x15, 0x81,
+    0x3E, 0x0E, 0x94, 0x2E, 0x81, 0x32, 0x06, 0x20, 0x85, 0x0A, 0x83, 0x50,
+    0x20, 0x87, 0x46, 0x81, 0x57, 0x8C, 0x02, 0x82, 0x5A, 0x35, 0x8C, 0x71,
+    0x21, 0x12, 0x81, 0x34, 0x86, 0x70, 0x82, 0xEE, 0x4A, 0x81, 0x20, 0x3B,
+    0x7B, 0x07, 0x1B, 0x08, 0x40, 0x31, 0x09, 0x07, 0x14, 0x20, 0x0B, 0x81,
+    0x20, 0x99, 0x7F, 0x02, 0x51, 0x2B, 0x04, 0x81, 0x58, 0x81, 0x08, 0x9D,
+    0x40, 0x1F, 0x81, 0x19, 0x27, 0x12, 0x02, 0x3E, 0x47, 0x1C, 0x81, 0x72,
+    0xAD, 0x14, 0x02, 0x54, 0x01, 0x09, 0x45, 0xAE, 0x34, 0x83, 0xB8, 0x41,
+    0x8C, 0x60, 0x0B, 0x82, 0x71, 0x81, 0x24, 0xA0, 0x28, 0x86, 0x40, 0x8E,
+    0xF4, 0x69, 0x82, 0x28, 0x04, 0x6A, 0x03, 0x86, 0x42, 0x3F, 0x06, 0x7A,
+    0x95, 0x66, 0x89, 0x48, 0x8E, 0x40, 0x81, 0x32, 0x41, 0x8D, 0x5A, 0x04,
+    0x01, 0x88, 0x00, 0x81, 0x40, 0x06, 0x20, 0x55, 0x81, 0x45, 0x83, 0x71,
+    0x0E, 0x01, 0x82, 0x60, 0x85, 0x5C, 0x04, 0x06, 0x7A, 0x82, 0x06, 0x8B,
+    0x3A, 0x71, 0x0E, 0x01, 0x7F, 0x8E, 0x67, 0x0B, 0x0F, 0x82, 0x20, 0x20,
+    0x01, 0x1F, 0x46, 0x10, 0x2A, 0x06, 0x84, 0x19, 0x81, 0x41, 0x82, 0x12,
+    0x14, 0x84, 0x19, 0x83, 0x67, 0x86, 0x3B, 0x31, 0x8F, 0x54, 0x85, 0x4B,
+    0x0E, 0x01, 0x81, 0x00, 0x81, 0x3B, 0x86, 0xC4, 0x7A, 0x82, 0x0B, 0x20,
+    0x20, 0x81, 0x20, 0x06, 0x0C, 0x2E, 0x8D, 0x00, 0x06, 0x87, 0x00, 0x8A,
+    0x1A, 0x20, 0x06, 0x81, 0x2F, 0xB3, 0x67, 0x49, 0x81, 0x5B, 0x06, 0x88,
+    0x70, 0x06, 0x04, 0x01, 0x84, 0x54, 0x2B, 0x21, 0x82, 0x3A, 0x04, 0x73,
+    0x23, 0x0B, 0x8C, 0x12, 0x7F, 0x91, 0x0F, 0x20, 0x81, 0x06, 0x0C, 0x88,
+    0x2E, 0x06, 0x87, 0x28, 0xA0, 0x52, 0x84, 0xC6, 0x32, 0x06, 0x82, 0x28,
+    0x9A, 0x6E, 0x52, 0x21, 0x5E, 0x73, 0x81, 0x20, 0x08, 0x18, 0x1C, 0x72,
+    0x9A, 0x78, 0x3B, 0x42, 0x81, 0x5D, 0x02, 0x04, 0x08, 0x71, 0xAE, 0x41,
+    0x42, 0x81, 0x07, 0x17, 0x4E, 0x93, 0x72, 0x12, 0x82, 0x2B, 0x03, 0x12,
+    0x81, 0x36, 0x93, 0x66, 0x60, 0x81, 0x2F, 0x0E, 0x1B, 0x9F, 0x5A, 0xC1,
+    0x1C, 0x85, 0x60, 0x88, 0x52, 0x85, 0x39, 0x78, 0x0F, 0x8B, 0x20, 0x85,
+    0x00, 0x87, 0x5F, 0x62, 0xA0, 0x1F, 0x86, 0x52, 0x1F, 0x0E, 0x01, 0x81,
+    0x60, 0x81, 0x75, 0x0B, 0x84, 0x11, 0x0E, 0x01, 0x71, 0x87, 0x0F, 0x32,
+    0x0E, 0x81, 0x66, 0x81, 0x3A, 0x8F, 0x66, 0x8C, 0x2B, 0x0F, 0x8E, 0x7B,
+    0x3A, 0x81, 0x1D, 0x81, 0x00, 0x81, 0x40, 0x54, 0xB1, 0x40, 0x8A, 0xB2,
+    0x3A, 0x06, 0x83, 0x5B, 0x8D, 0x7F, 0x85, 0x46, 0x60, 0x90, 0x3A, 0x83,
+    0x60, 0x83, 0x00, 0x92, 0x60, 0x82, 0x06, 0x8C, 0x0B, 0x0A, 0x05, 0x89,
+    0x60, 0x85, 0x40, 0x60, 0x86, 0x79, 0x78, 0x0E, 0x01, 0x40, 0x30, 0x81,
+    0x22, 0x87, 0x4E, 0x81, 0x75, 0x0B, 0x83, 0x27, 0x6B, 0x0D, 0x71, 0x82,
+    0x56, 0x88, 0x2C, 0x83, 0x43, 0x84, 0x07, 0x16, 0x0E, 0x20, 0x8A, 0x79,
+    0x78, 0x09, 0x06, 0x87, 0x35, 0x81, 0x00, 0x82, 0x6B, 0x40, 0x8C, 0x11,
+    0x08, 0x06, 0x82, 0x21, 0x86, 0x50, 0x0B, 0x86, 0x76, 0x84, 0xBF, 0x41,
+    0x06, 0x09, 0x11, 0x64, 0x43, 0x02, 0x06, 0x7C, 0x03, 0x20, 0x40, 0x55,
+    0x81, 0x04, 0x47, 0x99, 0x71, 0x0F, 0x01, 0x70, 0x0F, 0x81, 0x40, 0x51,
+    0x81, 0x2F, 0x81, 0x00, 0x40, 0x99, 0x71, 0x08, 0x19, 0x20, 0x06, 0x39,
+    0x0E, 0x01, 0x40, 0x72, 0x27, 0x27, 0x12, 0x2E, 0x12, 0x0E, 0x72, 0xAE,
+    0x07, 0x24, 0x23, 0x1D, 0x15, 0x81, 0x03, 0x0B, 0x21, 0x11, 0x2E, 0x40,
+    0xAA, 0x32, 0x06, 0x39, 0x0E, 0x01, 0x40, 0x81, 0x26, 0x17, 0x1B, 0x81,
+    0x28, 0x01, 0x14, 0x9F, 0x6C, 0xBF, 0x5F, 0x84, 0x83, 0x59, 0x07, 0x26,
+    0x4B, 0x0E, 0x01, 0x89, 0x40, 0x9A, 0x20, 0x06, 0xAD, 0x17, 0x55, 0x87,
+    0x1F, 0x81, 0x15, 0x39, 0x84, 0x41, 0x71, 0x0E, 0x01, 0x70, 0x81, 0x36,
+    0x8F, 0x2C, 0x8A, 0x20, 0x83, 0x2A, 0x44, 0x40, 0x06, 0x81, 0x7A, 0x40,
+    0x81, 0x46, 0x85, 0x1A, 0x88, 0x7F, 0x81, 0x17, 0x2A, 0x9C, 0x00, 0x82,
+    0xC8, 0x7B, 0x81, 0x19, 0x81, 0x4C, 0x9B, 0x18, 0x79, 0x0A, 0x04, 0x02,
+    0x83, 0x17, 0x05, 0x9C, 0x15, 0x81, 0x0E, 0x81, 0x19, 0x39, 0x06, 0x08,
+    0x79, 0x28, 0x1F, 0x81, 0x01, 0x83, 0xFD, 0x33, 0x8D, 0x6C, 0xA7, 0x71,
+    0x0F, 0x82, 0x40, 0x8D, 0x31, 0x0F, 0x82, 0x40, 0xF8, 0x60, 0x94, 0x94,
+    0x5F, 0x8D, 0xEB, 0x33, 0x82, 0x8C, 0x4D, 0xD6, 0x73, 0x0D, 0xB4, 0x0F,
+    0xEC, 0x6B, 0x06, 0x82, 0x41, 0x4E, 0xB3, 0x6A, 0xB8, 0x79, 0x81, 0x8B,
+    0x29, 0x0C, 0x83, 0x55, 0x04, 0x81, 0x72, 0x86, 0x0C, 0x82, 0x55, 0x82,
+    0x2F, 0x83, 0x7E, 0x72, 0x83, 0x01, 0x8B, 0x7F, 0x81, 0x10, 0x04, 0x97,
+    0x21, 0x82, 0x15, 0x81, 0x17, 0x0E, 0x06, 0x83, 0x14, 0x90, 0x03, 0x09,
+    0x7B, 0x81, 0x00, 0x85, 0x7A, 0x81, 0x06, 0x97, 0x73, 0x81, 0x07, 0x96,
+    0x0B, 0x7B, 0x04, 0x88, 0x6D, 0x07, 0x96, 0x78, 0x99, 0x0C, 0x82, 0xD9,
+    0x14, 0xD5, 0x60, 0x0E, 0x98, 0x02, 0x82, 0xF6, 0x7A, 0xA8, 0x76, 0x0F,
+    0x92, 0x12, 0x81, 0xBE, 0x20, 0xA2, 0x6E, 0x94, 0x5F, 0x8A, 0x15, 0xDC,
+    0x65, 0x84, 0x24, 0x09, 0xDE, 0x7A, 0xA0, 0x76, 0x06, 0x9E, 0x36, 0xD6,
+    0x2D, 0x84, 0x89, 0x4F, 0x94, 0xF2, 0x20, 0xA0, 0x04, 0x0E, 0xA4, 0x00,
+    0x01, 0x70, 0x81, 0x4E, 0x81, 0x33, 0x20, 0x86, 0x4E, 0x85, 0x20, 0x8F,
+    0x71, 0x0F, 0x71, 0x81, 0x4E, 0x8E, 0x46, 0x86, 0x7B, 0x83, 0x60, 0x8E,
+    0x01, 0x40, 0x87, 0x80, 0x3F, 0x40, 0x8B, 0x5B, 0x81, 0x05, 0x91, 0x60,
+    0x40, 0x94, 0x5F, 0x61, 0x01, 0x84, 0x19, 0x8A, 0x7F, 0x67, 0x82, 0x5A,
+    0x81, 0x26, 0x12, 0x9B, 0x2E, 0x81, 0x12, 0x82, 0x7C, 0x04, 0x0A, 0x24,
+    0x32, 0x87, 0x4E, 0x83, 0x55, 0xA0, 0x3C, 0x0F, 0x86, 0xC9, 0x60, 0x31,
+    0x85, 0x6F, 0x86, 0x7F, 0x72, 0x0F, 0x87, 0x7C, 0x8C, 0x44, 0x8C, 0x39,
+    0x81, 0x46, 0xA5, 0x40, 0x81, 0x4F, 0x08, 0x8E, 0x2A, 0x84, 0x79, 0x84,
+    0x55, 0x12, 0x86, 0x1F, 0x8E, 0x7A, 0x81, 0x03, 0x84, 0x04, 0x83, 0x00,
+    0x71, 0x0F, 0x81, 0x01, 0x81, 0x3E, 0x81, 0x0F, 0x83, 0x24, 0x07, 0x84,
+    0x23, 0x8B, 0x64, 0x81, 0x71, 0x8F, 0x0A, 0x8A, 0xD6, 0x74, 0x0A, 0x8A,
+    0x35, 0x9A, 0x44, 0x8B, 0x40, 0x2E, 0x81, 0x6E, 0x04, 0x96, 0x2E, 0x83,
+    0x52, 0x0E, 0x85, 0x21, 0xB6, 0x70, 0x0E, 0x01, 0x87, 0x35, 0x90, 0x3C,
+    0x08, 0x85, 0xC2, 0x41, 0x85, 0xE9, 0x54, 0x87, 0xE6, 0x06, 0x8F, 0xCF,
+    0x28, 0x04, 0x06, 0x86, 0x20, 0x0B, 0x0E, 0x01, 0x32, 0x4E, 0x8E, 0x7F,
+    0x83, 0x61, 0x84, 0x11, 0x0E, 0x01, 0x82, 0x3B, 0x8D, 0x65, 0x81, 0x40,
+    0x40, 0x81, 0x21, 0x1F, 0x32, 0x8B, 0x5F, 0x0A, 0x05, 0x87, 0x5C, 0x15,
+    0x0F, 0x81, 0x40, 0x20, 0x06, 0x82, 0x01, 0x8B, 0x79, 0x11, 0x0F, 0x81,
+    0x40, 0x06, 0x20, 0x28, 0x81, 0x52, 0x9C, 0x00, 0x20, 0x07, 0x81, 0x79,
+    0x20, 0x40, 0x81, 0x00, 0x06, 0x85, 0x00, 0x81, 0x7A, 0x72, 0x83, 0x63,
+    0x4A, 0x83, 0x61, 0x8C, 0x11, 0x0E, 0x01, 0x8F, 0x71, 0x0A, 0x05, 0x92,
+    0x3C, 0x86, 0xB7, 0x24, 0x40, 0x81, 0x00, 0x06, 0x6C, 0x94, 0x20, 0x87,
+    0x2E, 0x06, 0x81, 0x5A, 0x60, 0x06, 0x3A, 0x06, 0x5B, 0x88, 0x1F, 0x94,
+    0x55, 0x82, 0x5C, 0x0F, 0x94, 0x40, 0x82, 0x00, 0x06, 0x81, 0x4F, 0x2B,
+    0x8B, 0x55, 0x2B, 0xB2, 0x06, 0x84, 0xE5, 0x52, 0x82, 0x1A, 0x2E, 0x81,
+    0x12, 0x01, 0x4D, 0x9B, 0x19, 0x08, 0x78, 0x81, 0x5F, 0x02, 0x03, 0x43,
+    0x72, 0x4E, 0x9B, 0x55, 0x5E, 0x81, 0x3F, 0x2E, 0x12, 0x14, 0x3A, 0x39,
+    0x06, 0x01, 0x18, 0x09, 0x11, 0x0E, 0xAD, 0x72, 0x6B, 0x23, 0x32, 0x07,
+    0x19, 0x0A, 0xAF, 0x24, 0xEE, 0x60, 0x86, 0x3B, 0x04, 0x82, 0x45, 0x81,
+    0x11, 0x85, 0x7C, 0x8F, 0x10, 0xA0, 0x1F, 0x86, 0x60, 0x11, 0x0F, 0x81,
+    0x60, 0x06, 0x81, 0x7A, 0x87, 0x00, 0x06, 0x84, 0x4C, 0x03, 0x2B, 0x06,
+    0x0B, 0x0F, 0x40, 0x81, 0x00, 0x81, 0x00, 0x8D, 0x31, 0x0E, 0x01, 0x8F,
+    0x71, 0x0E, 0x01, 0x87, 0x71, 0x0E, 0x01, 0x66, 0x81, 0x7A, 0x06, 0x84,
+    0x4F, 0x81, 0x1D, 0x83, 0x14, 0x8C, 0x0B, 0x0F, 0x9F, 0x7B, 0x8A, 0xD0,
+    0x37, 0xB7, 0x49, 0x87, 0x65, 0x40, 0x86, 0x5B, 0x25, 0x5B, 0x89, 0x45,
+    0x06, 0x86, 0x1A, 0x06, 0x0B, 0x0E, 0x21, 0x81, 0x40, 0x81, 0x55, 0x81,
+    0x71, 0x92, 0x3A, 0x06, 0x81, 0x5A, 0x11, 0x2F, 0x06, 0x81, 0x20, 0x0C,
+    0x0F, 0x14, 0x95, 0x7C, 0x40, 0x85, 0x6A, 0x87, 0x76, 0x84, 0xCF, 0x47,
+    0x83, 0x28, 0x75, 0x9B, 0x23, 0x40, 0x82, 0x68, 0x81, 0x21, 0x9E, 0x53,
+    0x81, 0x2D, 0x11, 0x0E, 0xAE, 0x34, 0x81, 0x3E, 0x03, 0xAE, 0x3F, 0x9D,
+    0x6B, 0x81, 0x67, 0x85, 0xC9, 0x5B, 0x88, 0x05, 0x9C, 0x95, 0x30, 0x83,
+    0xC1, 0x45, 0xA0, 0x0A, 0x99, 0x95, 0x5B, 0x84, 0x82, 0x7A, 0x84, 0x9D,
+    0x5C, 0x84, 0x80, 0x00, 0xE8, 0x00, 0x90, 0x00, 0x0D, 0x02, 0x83, 0x11,
+    0x81, 0x9B, 0x64, 0x82, 0x3F, 0x8F, 0xAC, 0x6D, 0x89, 0x3B, 0x5F, 0xA8,
+    0x7C, 0x96, 0x72, 0x98, 0x12, 0x9E, 0x20, 0x82, 0x40, 0xA5, 0x51, 0x81,
+    0x6F, 0x40, 0x86, 0xCE, 0x40, 0x82, 0x3B, 0x05, 0x21, 0xAC, 0x7F, 0xA9,
+    0x20, 0x81, 0x00, 0xB5, 0x20, 0x89, 0x00, 0x87, 0x88, 0x51, 0xAE, 0x2F,
+    0x8B, 0xB7, 0x1C, 0x90, 0x5D, 0x98, 0x77, 0x10, 0x9E, 0x71, 0x08, 0x07,
+    0x89, 0x40, 0x90, 0x00, 0xA0, 0x00, 0x98, 0x54, 0x81, 0x0C, 0x35, 0x8E,
+    0x0B, 0x8A, 0xDD, 0x4E, 0x82, 0x18, 0xC0, 0x00, 0x90, 0x40, 0xA9, 0x5A,
+    0x97, 0xEF, 0x06, 0x87, 0x90, 0x28, 0x72, 0xFE, 0x40, 0x89, 0x20, 0x06,
+    0x83, 0x1A, 0x87, 0xC0, 0x35, 0x90, 0x0B, 0x40, 0x40, 0x06, 0x92, 0x20,
+    0x85, 0xF9, 0x00, 0x85, 0xF3, 0x13, 0x78, 0x0F, 0x8A, 0x00, 0x95, 0x35,
+};
+
+const uint32_t DictionaryPacked_wordCount = WORD_COUNT;
+const uint32_t DictionaryPacked_flashBytes = 8820;
+
+// Filled in by Dictionary_init()
+uint32_t DictionaryPacked_indexWords[INDEX_ENTRIES];
+uint16_t DictionaryPacked_indexOffsets[INDEX_ENTRIES];
+const uint32_t DictionaryPacked_indexEntries = INDEX_ENTRIES;
+
+#else
+
+// Generated for 5-letter words: no words at any other length
+
+const uint8_t DictionaryPacked_deltas[1] = { 0 };
+
+const uint32_t DictionaryPacked_wordCount = 0;
+const uint32_t DictionaryPacked_flashBytes = 0;
+
+uint32_t DictionaryPacked_indexWords[1];
+uint16_t DictionaryPacked_indexOffsets[1];
+const uint32_t DictionaryPacked_indexEntries = 0;
+
+#endif
+
+#endif
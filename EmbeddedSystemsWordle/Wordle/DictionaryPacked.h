@@ -0,0 +1,42 @@
+/*
+ * DictionaryPacked.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The tables of the packed backend of Dictionary.c. DictionaryPacked.c
+ * defines them and is generated by Host/MakeDictionary; run "make dictionary"
+ * in Host/ after changing Wordle/words.txt.
+ *
+ * The words are packed into 25-bit integers (see Score.h) and sorted. Each is
+ * stored as its difference from the one before (the first from 0), seven bits
+ * per byte with the most significant group first. The top bit of a byte is
+ * set if another byte of the same difference follows. Most differences take
+ * two bytes, and words which share four letters take one.
+ *
+ * A word can only be decoded from the one before it, so Dictionary_init()
+ * walks the differences once and keeps every DICTIONARY_PACKED_STRIDE-th word
+ * and where the difference after it starts in an index in SRAM. A lookup
+ * searches the index and decodes at most one stride of differences.
+ */
+
+#ifndef WORDLE_DICTIONARYPACKED_H_
+#define WORDLE_DICTIONARYPACKED_H_
+
+#include <stdint.h>
+
+// Set on every byte of a difference but its last
+#define DICTIONARY_PACKED_MORE      0x80
+#define DICTIONARY_PACKED_BITS      7
+
+// The differences between consecutive words
+extern const uint8_t DictionaryPacked_deltas[];
+
+extern const uint32_t DictionaryPacked_wordCount;
+extern const uint32_t DictionaryPacked_flashBytes;
+
+// The SRAM index: every DICTIONARY_PACKED_STRIDE-th word, and the offset of the difference after it
+extern uint32_t DictionaryPacked_indexWords[];
+extern uint16_t DictionaryPacked_indexOffsets[];
+extern const uint32_t DictionaryPacked_indexEntries;
+
+#endif /* WORDLE_DICTIONARYPACKED_H_ */
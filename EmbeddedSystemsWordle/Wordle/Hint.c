@@ -0,0 +1,290 @@
+/*
+ * Hint.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Hint.h>
+#include <Wordle/Dictionary.h>
+#include <Wordle/Candidates.h>
+
+// What the search is doing
+enum _HintPhase
+{
+    HINT_IDLE,                  // Not started since the last feedback
+    HINT_FILTERING,             // Collecting a sample of the candidates
+    HINT_RANKING_CANDIDATES,    // Scoring the candidates as guesses
+    HINT_RANKING_WORDS,         // Scoring every dictionary word as a guess
+    HINT_DONE
+};
+typedef enum _HintPhase HintPhase;
+
+// The fraction bits of the logarithms in Hint_weight()
+#define FRACTION_BITS       6
+
+/** log2(1 + i / 64) in 1/256ths of a bit. */
+static const uint8_t log2Fractions[1 << FRACTION_BITS] =
+{
+      0,   6,  11,  17,  22,  28,  33,  38,  44,  49,  54,  59,  63,  68,  73,  78,
+     82,  87,  92,  96, 100, 105, 109, 113, 118, 122, 126, 130, 134, 138, 142, 146,
+    150, 154, 157, 161, 165, 169, 172, 176, 179, 183, 186, 190, 193, 197, 200, 203,
+    207, 210, 213, 216, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247, 250, 253,
+};
+
+// The candidates kept: every sampleStride-th of the consistentCount candidates
+static PackedWord candidates[HINT_SAMPLE_SIZE];
+static uint32_t sampleCount = 0;
+static uint32_t consistentCount = 0;
+static uint32_t sampleStride = 1;
+
+static HintPhase phase = HINT_IDLE;
+static DictionaryCursor cursor;
+static uint32_t wordIndex = 0;
+static uint32_t candidateIndex = 0;
+static uint32_t nextCandidate = 0;
+static uint32_t guessesRanked = 0;
+
+// The guess being ranked: the candidates it has been scored against, or once it has been against all of them, the
+// touched codes summed so far. It is ranked over as many steps as it takes.
+static bool ranking = false;
+static PackedWord rankGuess = 0;
+static uint32_t rankIndex = 0;
+static uint32_t rankSummed = 0;
+static uint32_t rankCost = 0;
+static uint32_t touchedCount = 0;
+
+// The best guess so far and the sum of count * log2(count) over its histogram, which it has the lowest of
+static PackedWord best = 0;
+static uint32_t bestCost = 0;
+
+// The histogram of the guess being ranked, and the codes in it which are not zero
+static uint16_t histogram[HINT_HISTOGRAM_CODES];
+static FeedbackCode touched[HINT_TOUCHED_CODES];
+
+/** Clears the histogram of a guess whose ranking was stopped partway. */
+static void Hint_dropRank(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < touchedCount; i++)
+    {
+        histogram[touched[i]] = 0;
+    }
+    touchedCount = 0;
+    ranking = false;
+}
+
+void Hint_reset(void)
+{
+    Hint_dropRank();
+    phase = HINT_IDLE;
+    best = 0;
+}
+
+void Hint_start(void)
+{
+    Hint_dropRank();
+    cursor = Dictionary_cursor();
+    wordIndex = 0;
+    candidateIndex = 0;
+    sampleCount = 0;
+    consistentCount = Candidates_count();
+    sampleStride = (consistentCount + HINT_SAMPLE_SIZE - 1) / HINT_SAMPLE_SIZE;
+    phase = (consistentCount > 0) ? HINT_FILTERING : HINT_DONE;
+    nextCandidate = 0;
+    guessesRanked = 0;
+    best = 0;
+    bestCost = UINT32_MAX;
+}
+
+/**
+ * Returns count * log2(count) in 1/256ths of a bit. The integer part of the
+ * logarithm is the position of the top bit, and the next FRACTION_BITS bits
+ * look up the fraction, which is within 1/50 of a bit.
+ */
+static uint32_t Hint_weight(uint32_t count)
+{
+    uint32_t exponent = 0;
+    uint32_t fraction;
+
+    while ((count >> exponent) > 1)
+    {
+        exponent++;
+    }
+
+    if (exponent >= FRACTION_BITS)
+    {
+        fraction = count >> (exponent - FRACTION_BITS);
+    }
+    else
+    {
+        fraction = count << (FRACTION_BITS - exponent);
+    }
+
+    return count * ((exponent << 8) + log2Fractions[fraction & ((1 << FRACTION_BITS) - 1)]);
+}
+
+/** Starts ranking a guess; Hint_rank() does the work. */
+static void Hint_startRank(PackedWord guess)
+{
+    ranking = true;
+    rankGuess = guess;
+    rankIndex = 0;
+    rankSummed = 0;
+    rankCost = 0;
+    touchedCount = 0;
+}
+
+/**
+ * Scores the guess being ranked against every candidate. The lower the sum of
+ * count * log2(count) over the histogram, the higher its entropy, which is
+ * log2(candidates) minus that sum over the candidates. Only the codes which
+ * come up are summed and cleared, since late in a game there are far fewer of
+ * them than SCORE_NUM_CODES, and never more than the sample. A score and the
+ * sum of a code are a unit of work each, and the ranking stops where the work
+ * runs out, so a step never goes over by more than one.
+ *
+ * @param work_p:       The work done in this step so far, which is added to
+ * @param maxWork:      The work the step may do
+ */
+static void Hint_rank(uint32_t* work_p, uint32_t maxWork)
+{
+    for (; rankIndex < sampleCount && *work_p < maxWork; rankIndex++, (*work_p)++)
+    {
+        FeedbackCode code = Score_feedback(rankGuess, candidates[rankIndex]);
+
+        if (histogram[code]++ == 0)
+        {
+            touched[touchedCount++] = code;
+        }
+    }
+
+    for (; rankIndex == sampleCount && rankSummed < touchedCount && *work_p < maxWork; rankSummed++, (*work_p)++)
+    {
+        rankCost += Hint_weight(histogram[touched[rankSummed]]);
+        histogram[touched[rankSummed]] = 0;
+    }
+
+    if (rankIndex < sampleCount || rankSummed < touchedCount)
+    {
+        return;
+    }
+
+    // Candidates are ranked first, so they win ties: they might be the answer
+    if (rankCost < bestCost)
+    {
+        bestCost = rankCost;
+        best = rankGuess;
+    }
+    touchedCount = 0;
+    ranking = false;
+    guessesRanked++;
+}
+
+/**
+ * Works through the phases of the search until it has spent the given number
+ * of scores. A guess which is not ranked by the end of a step is carried on
+ * with by the next.
+ *
+ * @param maxScores:    About how many scores to compute
+ * @return true if the search is done, or was never started
+ */
+bool Hint_step(uint32_t maxScores)
+{
+    uint32_t work = 0;
+    PackedWord word;
+
+    while (work < maxScores && phase != HINT_IDLE && phase != HINT_DONE)
+    {
+        if (ranking)
+        {
+            Hint_rank(&work, maxScores);
+            continue;
+        }
+
+        switch (phase)
+        {
+        case HINT_FILTERING:
+            // The candidate set is a bitset over the words in the order the cursor visits them
+            if (Dictionary_next(&cursor, &word))
+            {
+                work++;
+                if (Candidates_contains(wordIndex++) && (candidateIndex++ % sampleStride == 0))
+                {
+                    candidates[sampleCount++] = word;
+                }
+            }
+            else if (sampleCount == 0)
+            {
+                phase = HINT_DONE;
+            }
+            else
+            {
+                phase = HINT_RANKING_CANDIDATES;
+            }
+            break;
+
+        case HINT_RANKING_CANDIDATES:
+            if (nextCandidate < sampleCount)
+            {
+                Hint_startRank(candidates[nextCandidate++]);
+            }
+            else if (consistentCount <= 2)
+            {
+                // Guessing one of two candidates wins half the time; no other guess can do better
+                phase = HINT_DONE;
+            }
+            else
+            {
+                cursor = Dictionary_cursor();
+                phase = HINT_RANKING_WORDS;
+            }
+            break;
+
+        case HINT_RANKING_WORDS:
+            if (Dictionary_next(&cursor, &word))
+            {
+                Hint_startRank(word);
+            }
+            else
+            {
+                phase = HINT_DONE;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return phase == HINT_IDLE || phase == HINT_DONE;
+}
+
+uint32_t Hint_progress(void)
+{
+    uint32_t total = sampleCount + ((consistentCount > 2) ? Dictionary_wordCount() : 0);
+
+    if (phase == HINT_IDLE || phase == HINT_DONE)
+    {
+        return 100;
+    }
+    if (phase == HINT_FILTERING || total == 0)
+    {
+        return 0;
+    }
+    return guessesRanked * 100 / total;
+}
+
+PackedWord Hint_best(void)
+{
+    return best;
+}
+
+uint32_t Hint_bestInformation(void)
+{
+    if (sampleCount == 0 || best == 0 || bestCost >= Hint_weight(sampleCount))
+    {
+        return 0;
+    }
+    return (Hint_weight(sampleCount) - bestCost) / sampleCount;
+}
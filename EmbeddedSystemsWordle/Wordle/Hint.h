@@ -0,0 +1,66 @@
+/*
+ * Hint.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The hint engine: finds the dictionary word which, guessed next, is expected
+ * to tell the most about the answer. It first keeps the dictionary words which
+ * agree with the feedback of every guess so far, the candidates. Then it
+ * scores each possible guess against every candidate into a histogram of the
+ * SCORE_NUM_CODES feedback codes, and picks the guess whose histogram has the
+ * highest entropy: the one which splits the candidates into the most, most even
+ * groups. The candidates come from Candidates.h, so the caller adds the
+ * feedback of every guess there.
+ *
+ * That is millions of scores early in a game, so the work is done a slice at a
+ * time with Hint_step() and the caller decides how long to keep going; the
+ * best guess so far is always available. There is a single engine, since its
+ * candidate buffer is too big for the stack or the Application struct.
+ */
+
+#ifndef WORDLE_HINT_H_
+#define WORDLE_HINT_H_
+
+#include <Wordle/Score.h>
+#include <Wordle/Dictionary.h>
+
+// The most candidates the engine keeps. When more words agree with the feedback,
+// an evenly spaced sample of them is kept, and the histograms are taken over that.
+#define HINT_MAX_CANDIDATES     1024
+
+// The sample and the histogram the engine keeps in SRAM. A guess scored against
+// the sample comes up with at most one code per candidate, so that is all the
+// codes it has to clear. Without a dictionary there is nothing to sample.
+#if DICTIONARY_AVAILABLE
+#define HINT_SAMPLE_SIZE        HINT_MAX_CANDIDATES
+#define HINT_HISTOGRAM_CODES    SCORE_NUM_CODES
+#else
+#define HINT_SAMPLE_SIZE        1
+#define HINT_HISTOGRAM_CODES    1
+#endif
+#define HINT_TOUCHED_CODES      ((HINT_HISTOGRAM_CODES < HINT_SAMPLE_SIZE) ? HINT_HISTOGRAM_CODES : HINT_SAMPLE_SIZE)
+#define HINT_SRAM_BYTES         (HINT_SAMPLE_SIZE * SCORE_PACKED_BYTES + HINT_HISTOGRAM_CODES * 2 \
+                                 + HINT_TOUCHED_CODES * SCORE_CODE_BYTES)
+
+// Work for one Hint_step() call: a granule of about two thousand M4 cycles, so the caller can stop on a deadline
+#define HINT_STEP_SCORES        8
+
+// Stops a search which is in progress and forgets its result. Call it when the candidates change.
+void Hint_reset(void);
+
+// Starts a search over the candidates
+void Hint_start(void);
+
+// Does about maxScores feedback scores of work on the search. Returns true once it is done.
+bool Hint_step(uint32_t maxScores);
+
+// Returns how far the search has come, in percent
+uint32_t Hint_progress(void);
+
+// Returns the best guess found so far, or 0 if there are no candidates
+PackedWord Hint_best(void);
+
+// Returns the expected information of the best guess so far, in 1/256ths of a bit
+uint32_t Hint_bestInformation(void);
+
+#endif /* WORDLE_HINT_H_ */
@@ -0,0 +1,138 @@
+/*
+ * Score.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Score.h>
+
+/** Place values of each letter position inside a FeedbackCode. */
+static const uint16_t positionWeights[SCORE_WORD_LENGTH] = { 1, 3, 9, 27,
+#if SCORE_WORD_LENGTH > 4
+                                                             81,
+#endif
+#if SCORE_WORD_LENGTH > 5
+                                                             243,
+#endif
+#if SCORE_WORD_LENGTH > 6
+                                                             729,
+#endif
+#if SCORE_WORD_LENGTH > 7
+                                                             2187,
+#endif
+};
+
+// Expands STEP(i) once for every letter position, so that each word length
+// gets its own straight-line kernels with every shift and place value constant.
+#if SCORE_WORD_LENGTH == 4
+#define SCORE_EACH_POSITION(STEP)   STEP(0) STEP(1) STEP(2) STEP(3)
+#elif SCORE_WORD_LENGTH == 5
+#define SCORE_EACH_POSITION(STEP)   STEP(0) STEP(1) STEP(2) STEP(3) STEP(4)
+#elif SCORE_WORD_LENGTH == 6
+#define SCORE_EACH_POSITION(STEP)   STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5)
+#elif SCORE_WORD_LENGTH == 7
+#define SCORE_EACH_POSITION(STEP)   STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6)
+#else
+#define SCORE_EACH_POSITION(STEP)   STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7)
+#endif
+
+/**
+ * Packs a word into a single integer. Masking the ASCII value with 0x1F maps
+ * both 'A' and 'a' to 1 and 'Z'/'z' to 26 without any branches, so the caller
+ * does not need to upper case the word first.
+ *
+ * @param word:     The SCORE_WORD_LENGTH letters to pack
+ * @return the packed word
+ */
+PackedWord Score_packWord(const unsigned char* word)
+{
+    PackedWord packed = 0;
+
+#define SCORE_PACK(i)   packed = (packed << SCORE_BITS_PER_LETTER) | (word[i] & SCORE_LETTER_MASK);
+    SCORE_EACH_POSITION(SCORE_PACK)
+#undef SCORE_PACK
+
+    return packed;
+}
+
+/**
+ * Unpacks a word back into upper case ASCII letters.
+ *
+ * @param packed:   The packed word
+ * @param word:     The buffer of SCORE_WORD_LENGTH characters to fill
+ */
+void Score_unpackWord(PackedWord packed, unsigned char* word)
+{
+#define SCORE_UNPACK(i)     word[i] = (unsigned char) ('A' - 1 + SCORE_LETTER(packed, i));
+    SCORE_EACH_POSITION(SCORE_UNPACK)
+#undef SCORE_UNPACK
+}
+
+/**
+ * Scores a guess against an answer in a fixed number of operations. The first
+ * pass marks every GREEN position and builds a histogram of the answer letters
+ * which were not matched exactly. The second pass hands out YELLOWs from left
+ * to right, using up one histogram entry for every YELLOW so that a letter is
+ * never marked more often than it appears in the answer. Both passes only use
+ * comparisons as 0/1 values, so there are no data-dependent branches, and each
+ * pass is expanded for the word length at build time, so there are no loops.
+ *
+ * @param guess:    The packed guess
+ * @param answer:   The packed answer
+ * @return the feedback code of the guess, from 0 (all GRAY) to SCORE_ALL_GREEN
+ */
+FeedbackCode Score_feedback(PackedWord guess, PackedWord answer)
+{
+    uint8_t unmatched[SCORE_ALPHABET_SIZE] = { 0 };
+    uint8_t green[SCORE_WORD_LENGTH];
+    uint32_t code = 0;
+
+#define SCORE_GREEN(i) \
+    { \
+        uint32_t answerLetter = (uint32_t) SCORE_LETTER(answer, i); \
+        green[i] = (SCORE_LETTER(guess, i) == answerLetter); \
+        unmatched[answerLetter] += 1 - green[i]; \
+    }
+#define SCORE_YELLOW(i) \
+    { \
+        uint32_t guessLetter = (uint32_t) SCORE_LETTER(guess, i); \
+        uint8_t yellow = (1 - green[i]) & (unmatched[guessLetter] != 0); \
+        unmatched[guessLetter] -= yellow; \
+        code += positionWeights[i] * ((green[i] * GREEN) + (yellow * YELLOW)); \
+    }
+    SCORE_EACH_POSITION(SCORE_GREEN)
+    SCORE_EACH_POSITION(SCORE_YELLOW)
+#undef SCORE_GREEN
+#undef SCORE_YELLOW
+
+    return (FeedbackCode) code;
+}
+
+/**
+ * Extracts one base-3 digit from a feedback code.
+ *
+ * @param code:     The feedback code returned by Score_feedback()
+ * @param position: The letter position, from 0 to SCORE_WORD_LENGTH - 1
+ * @return the colour of that letter
+ */
+LetterScore Score_letterAt(FeedbackCode code, int position)
+{
+    return (LetterScore) ((code / positionWeights[position]) % 3);
+}
+
+/**
+ * Counts the GREEN digits of a feedback code.
+ *
+ * @param code:     The feedback code returned by Score_feedback()
+ * @return the number of letters in the correct position
+ */
+int Score_greenCount(FeedbackCode code)
+{
+    int greens = 0;
+
+#define SCORE_COUNT_GREEN(i)    greens += (code / positionWeights[i]) % 3 == GREEN;
+    SCORE_EACH_POSITION(SCORE_COUNT_GREEN)
+#undef SCORE_COUNT_GREEN
+
+    return greens;
+}
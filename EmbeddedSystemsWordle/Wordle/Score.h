@@ -0,0 +1,90 @@
+/*
+ * Score.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef WORDLE_SCORE_H_
+#define WORDLE_SCORE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Number of letters in every word, 4 to 8; set at build time with -DSCORE_WORD_LENGTH=n. Application.h sizes its
+// letter buffers, FSM and board layout from this value. The tables MakeDictionary generates are for one length.
+#ifndef SCORE_WORD_LENGTH
+#define SCORE_WORD_LENGTH       5
+#endif
+
+#if SCORE_WORD_LENGTH < 4 || SCORE_WORD_LENGTH > 8
+#error "SCORE_WORD_LENGTH must be 4 to 8"
+#endif
+
+// Each letter is stored as (ASCII & 0x1F), so 'A'/'a' = 1 through 'Z'/'z' = 26.
+#define SCORE_BITS_PER_LETTER   5
+#define SCORE_LETTER_MASK       0x1F
+#define SCORE_ALPHABET_SIZE     32
+
+// Feedback codes are base-3 numbers with one digit per letter position.
+#if SCORE_WORD_LENGTH == 4
+#define SCORE_NUM_CODES         81      // 3^SCORE_WORD_LENGTH
+#elif SCORE_WORD_LENGTH == 5
+#define SCORE_NUM_CODES         243
+#elif SCORE_WORD_LENGTH == 6
+#define SCORE_NUM_CODES         729
+#elif SCORE_WORD_LENGTH == 7
+#define SCORE_NUM_CODES         2187
+#else
+#define SCORE_NUM_CODES         6561
+#endif
+#define SCORE_ALL_GREEN         (SCORE_NUM_CODES - 1)   // Every digit is GREEN
+
+// Extracts the letter at a position of a packed word. Position 0 lives in the
+// most significant letter, so comparing packed words compares them alphabetically.
+#define SCORE_LETTER(packed, position) \
+    (((packed) >> (SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1 - (position)))) & SCORE_LETTER_MASK)
+
+/**
+ * The colour a single letter of a guess receives. The numeric value is also the
+ * base-3 digit stored in a FeedbackCode for that position.
+ */
+enum _LetterScore
+{
+    GRAY = 0, YELLOW = 1, GREEN = 2
+};
+typedef enum _LetterScore LetterScore;
+
+// A word with SCORE_WORD_LENGTH letters packed into SCORE_BITS_PER_LETTER bits each
+#if SCORE_WORD_LENGTH * SCORE_BITS_PER_LETTER <= 32
+typedef uint32_t PackedWord;
+#define SCORE_PACKED_BYTES      4
+#else
+typedef uint64_t PackedWord;
+#define SCORE_PACKED_BYTES      8
+#endif
+
+// The score of a guess against an answer: sum of LetterScore(i) * 3^i, 0 to SCORE_ALL_GREEN
+#if SCORE_NUM_CODES <= 256
+typedef uint8_t FeedbackCode;
+#define SCORE_CODE_BYTES        1
+#else
+typedef uint16_t FeedbackCode;
+#define SCORE_CODE_BYTES        2
+#endif
+
+// Packs SCORE_WORD_LENGTH letters (either case) into a PackedWord
+PackedWord Score_packWord(const unsigned char* word);
+
+// Unpacks a PackedWord into SCORE_WORD_LENGTH upper case letters
+void Score_unpackWord(PackedWord packed, unsigned char* word);
+
+// Scores a guess against an answer, handling repeated letters the same way Wordle does
+FeedbackCode Score_feedback(PackedWord guess, PackedWord answer);
+
+// Returns the colour of the letter at the given position of a feedback code
+LetterScore Score_letterAt(FeedbackCode code, int position);
+
+// Returns how many letters of a feedback code are GREEN
+int Score_greenCount(FeedbackCode code);
+
+#endif /* WORDLE_SCORE_H_ */
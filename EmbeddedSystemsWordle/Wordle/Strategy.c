@@ -0,0 +1,145 @@
+/*
+ * Strategy.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <Wordle/Dictionary.h>
+#include <Wordle/Strategy.h>
+#include <Wordle/StrategyTables.h>
+
+#define FNV_OFFSET_BASIS    0x811C9DC5u
+#define FNV_PRIME           0x01000193u
+
+// The position of a game which has left the tree; no node or leaf has it
+#define OFF_TREE            0xFFFFFFFFu
+
+// The node the game is at, or STRATEGY_LEAF with the one answer left, or OFF_TREE
+static uint32_t position = OFF_TREE;
+
+static bool intact = false;
+
+/** Adds the low bytes of a value, least significant first, to a 32-bit FNV-1a hash. */
+static uint32_t Strategy_hash(uint32_t hash, uint32_t value, int bytes)
+{
+    int i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        hash = (hash ^ ((value >> (8 * i)) & 0xFF)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * Checks the checksum, and that every edge leads forward to a node or to a
+ * leaf, so that a walk cannot run off the tables or go round in a loop.
+ */
+bool Strategy_init(void)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    uint32_t node, edge;
+    bool ok = (StrategyTables_nodeCount > 0) && (StrategyTables_wordCount == Dictionary_wordCount())
+              && (StrategyTables_firstEdges[0] == 0)
+              && (StrategyTables_firstEdges[StrategyTables_nodeCount] == StrategyTables_edgeCount);
+
+    for (node = 0; node < StrategyTables_nodeCount; node++)
+    {
+        hash = Strategy_hash(hash, StrategyTables_guesses[node], 4);
+    }
+    for (node = 0; node <= StrategyTables_nodeCount; node++)
+    {
+        hash = Strategy_hash(hash, StrategyTables_firstEdges[node], 2);
+    }
+    for (edge = 0; edge < StrategyTables_edgeCount; edge++)
+    {
+        hash = Strategy_hash(hash, StrategyTables_codes[edge], sizeof(FeedbackCode));
+    }
+    for (edge = 0; edge < StrategyTables_edgeCount; edge++)
+    {
+        hash = Strategy_hash(hash, StrategyTables_targets[edge], 4);
+    }
+    ok = ok && (hash == StrategyTables_checksum);
+
+    for (node = 0; node < StrategyTables_nodeCount && ok; node++)
+    {
+        uint32_t first = StrategyTables_firstEdges[node];
+        uint32_t end = StrategyTables_firstEdges[node + 1];
+
+        ok = (first <= end);
+        for (edge = first; edge < end && ok; edge++)
+        {
+            uint32_t target = StrategyTables_targets[edge];
+
+            ok = (StrategyTables_codes[edge] < SCORE_ALL_GREEN)
+                 && (edge == first || StrategyTables_codes[edge - 1] < StrategyTables_codes[edge])
+                 && ((target & STRATEGY_LEAF) || (target > node && target < StrategyTables_nodeCount));
+        }
+    }
+
+    intact = ok;
+    Strategy_reset();
+    return intact;
+}
+
+bool Strategy_intact(void)
+{
+    return intact;
+}
+
+void Strategy_reset(void)
+{
+    position = intact ? 0 : OFF_TREE;
+}
+
+bool Strategy_hint(PackedWord* word_p)
+{
+    if (position == OFF_TREE)
+    {
+        return false;
+    }
+
+    *word_p = (position & STRATEGY_LEAF) ? (position & ~STRATEGY_LEAF) : StrategyTables_guesses[position];
+    return true;
+}
+
+void Strategy_addFeedback(PackedWord guess, FeedbackCode code)
+{
+    PackedWord expected;
+    uint32_t low, high;
+
+    // After a leaf's guess, or any guess but the tree's, there is nowhere in the tree to go
+    if (!Strategy_hint(&expected) || guess != expected || (position & STRATEGY_LEAF))
+    {
+        position = OFF_TREE;
+        return;
+    }
+
+    low = StrategyTables_firstEdges[position];
+    high = StrategyTables_firstEdges[position + 1];
+    position = OFF_TREE;
+
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+
+        if (StrategyTables_codes[middle] < code)
+        {
+            low = middle + 1;
+        }
+        else if (StrategyTables_codes[middle] > code)
+        {
+            high = middle;
+        }
+        else
+        {
+            position = StrategyTables_targets[middle];
+            break;
+        }
+    }
+}
+
+uint32_t Strategy_flashBytes(void)
+{
+    return StrategyTables_flashBytes;
+}
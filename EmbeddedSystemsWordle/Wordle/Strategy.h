@@ -0,0 +1,40 @@
+/*
+ * Strategy.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Hints from a decision tree solved on the host and kept in flash (see
+ * StrategyTables.h). As long as the player has made the tree's guesses, the
+ * game's position in the tree is a node, and the hint is that node's guess;
+ * following the feedback to the next node is one binary search over its
+ * edges, so a hint costs no search at all. Once the player guesses anything
+ * else the game is off the tree, and Hint.c has to search.
+ *
+ * There is a single position, for the game in progress.
+ */
+
+#ifndef WORDLE_STRATEGY_H_
+#define WORDLE_STRATEGY_H_
+
+#include <Wordle/Score.h>
+
+// Checks that the tables are whole and were solved for this dictionary, and turns the strategy off if not.
+// Must be called once, after Dictionary_init(), before any other Strategy_*() function. Returns true if they are.
+bool Strategy_init(void);
+
+// Returns true if the tables passed Strategy_init()
+bool Strategy_intact(void);
+
+// Goes back to the opening guess, for a new game
+void Strategy_reset(void);
+
+// Follows the feedback a guess got, or leaves the tree if it was not the tree's guess
+void Strategy_addFeedback(PackedWord guess, FeedbackCode code);
+
+// Returns true, with the tree's next guess, if the game is still on the tree
+bool Strategy_hint(PackedWord* word_p);
+
+// Returns the number of bytes of flash the tree takes up
+uint32_t Strategy_flashBytes(void);
+
+#endif /* WORDLE_STRATEGY_H_ */
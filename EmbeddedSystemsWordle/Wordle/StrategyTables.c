@@ -0,0 +1,1534 @@
+/*
+ * StrategyTables.c
+ *
+ * Generated by Host/MakeStrategy from a tree of Host/MakeDecisionTree. Do not
+ * edit; run "make strategy" in Host/ after changing the word list.
+ *
+ * 5752 answers, 1460 nodes, 6270 edges, 40112 bytes; 3.7947 guesses on average.
+ */
+
+#include <Wordle/StrategyTables.h>
+
+#if SCORE_WORD_LENGTH == 5
+
+const uint32_t StrategyTables_guesses[1460] =
+{
+    0x140C8B3, 0x037D584, 0x064B288, 0x0F425C7, 0x0C485C1, 0x104B1F4, 0x02605C4, 0x0E78999,
+    0x03425CF, 0x0CCA5C7, 0x047A5C7, 0x067D5D4, 0x087AEAD, 0x0263DC4, 0x037D654, 0x07625D4,
+    0x10CB1EE, 0x070D1F2, 0x14089F2, 0x037B4D9, 0x0649D14, 0x14449E2, 0x03655B0, 0x017CA81,
+    0x0CCB608, 0x0180465, 0x0123E45, 0x044B8EF, 0x0665524, 0x1043DC5, 0x07605C4, 0x10605D4,
+    0x1428468, 0x07AB068, 0x0C0D105, 0x1408985, 0x042A465, 0x037D654, 0x104B865, 0x0228644,
+    0x0391614, 0x1490485, 0x030B619, 0x107B879, 0x022CA88, 0x14449E5, 0x062C82C, 0x0363CF3,
+    0x030CA85, 0x02625C4, 0x037D584, 0x047DDD9, 0x012352E, 0x011D0A4, 0x0CCB608, 0x042B0D4,
+    0x0123538, 0x02625C4, 0x044D28F, 0x02AA584, 0x0C4B4A4, 0x0133EAC, 0x0766608, 0x02614A4,
+    0x135A5B0, 0x037D584, 0x022C8B4, 0x0112485, 0x014C8A4, 0x04298B2, 0x1043DD9, 0x0D7D5D4,
+    0x144C279, 0x13406EC, 0x0360674, 0x10CB1EE, 0x104D119, 0x140BA79, 0x107D468, 0x087A674,
+    0x1495674, 0x10AB868, 0x13A2594, 0x1308A41, 0x10A8923, 0x0113EB4, 0x0343DB0, 0x13A4830,
+    0x0168673, 0x132A5C5, 0x1383D2C, 0x142BA65, 0x1060668, 0x13A058B, 0x10AB265, 0x02AB608,
+    0x1043DC5, 0x0391674, 0x034066D, 0x122CC34, 0x120A665, 0x1679EA5, 0x100CA65, 0x177D5C4,
+    0x1382594, 0x0182124, 0x1318584, 0x174CD19, 0x059D0B2, 0x019A0B2, 0x1348B2C, 0x042A465,
+    0x13A48B0, 0x1063DCB, 0x0C78EAD, 0x064B288, 0x0363DB0, 0x0978E8C, 0x0278693, 0x02625C4,
+    0x064B068, 0x03625CB, 0x107D5C4, 0x0793D2E, 0x027A5C7, 0x03925B0, 0x0228644, 0x0ECB608,
+    0x0C0C12E, 0x1209A93, 0x10A8923, 0x10790F9, 0x067D5C4, 0x016D46B, 0x02625C4, 0x03405B0,
+    0x01849EE, 0x1741590, 0x042B92D, 0x0D7BA88, 0x02605C4, 0x1341426, 0x0B4B293, 0x0229659,
+    0x122BA93, 0x174266B, 0x1340644, 0x1428653, 0x02AB608, 0x0180465, 0x142C9B3, 0x050C993,
+    0x02625C4, 0x0C4B44F, 0x104B96F, 0x1A4B068, 0x0D4B068, 0x02AB608, 0x016C185, 0x02AA584,
+    0x01224B5, 0x0194CB3, 0x0728D6F, 0x0C4B44F, 0x144C8B3, 0x02AB608, 0x104A5C7, 0x0B4DD33,
+    0x044B979, 0x0F825C7, 0x0B73C6B, 0x0343C6B, 0x027B8EF, 0x084C219, 0x0E4B459, 0x074B619,
+    0x074B619, 0x03A8923, 0x07AB44F, 0x02AB86F, 0x016D46B, 0x027D4E8, 0x107D468, 0x037D468,
+    0x02625C9, 0x064B1B3, 0x0971938, 0x077BE19, 0x0263C6B, 0x0363DCB, 0x0C7BE19, 0x067B123,
+    0x037B123, 0x07AC219, 0x07AB068, 0x06AB979, 0x03655CB, 0x0249924, 0x0342589, 0x0A7B199,
+    0x0209CAC, 0x08AB18F, 0x04225C7, 0x044B8EF, 0x0479CEF, 0x03791EE, 0x0ECB608, 0x04A8D19,
+    0x04AB44F, 0x044B199, 0x047A599, 0x0249924, 0x1570924, 0x02AB608, 0x0C4C124, 0x0263DC4,
+    0x02AA584, 0x0D7D584, 0x03090B4, 0x067D5D4, 0x107A5D4, 0x0D7D126, 0x0448DF4, 0x02655D4,
+    0x0229D2E, 0x0C48D34, 0x0279DEE, 0x020B899, 0x0B6569A, 0x026269A, 0x027D119, 0x08CB4AE,
+    0x087D299, 0x0443E89, 0x0113C85, 0x020DC93, 0x0D7D688, 0x0E4BA88, 0x01104D4, 0x147BE88,
+    0x14455A2, 0x02AD32C, 0x147C123, 0x144B288, 0x14BA58C, 0x147B923, 0x037C039, 0x01631F9,
+    0x0C78C2C, 0x016C0A4, 0x0162449, 0x03454C6, 0x03625A2, 0x0240549, 0x02625B0, 0x08AB42E,
+    0x0123E14, 0x012352E, 0x017592C, 0x013BDD9, 0x0138605, 0x011046B, 0x10485CF, 0x0161C2C,
+    0x030B613, 0x15B5581, 0x0249D01, 0x034B121, 0x0163D01, 0x0B78581, 0x037B8E1, 0x0B4B881,
+    0x01ABA99, 0x011D12E, 0x014D068, 0x077D281, 0x01A3D8C, 0x01104D4, 0x0123534, 0x01104D4,
+    0x01109F4, 0x14405CB, 0x0D09923, 0x0D0B8E1, 0x0E0A424, 0x0343DEB, 0x030B9EE, 0x090B449,
+    0x0208DEE, 0x072B124, 0x030B82C, 0x020B2AE, 0x030882C, 0x030B181, 0x0B0E42B, 0x030B338,
+    0x10A90F9, 0x03425CB, 0x01825C7, 0x02090E5, 0x011A5C7, 0x012342E, 0x104B0A4, 0x0D0B999,
+    0x0209199, 0x060D199, 0x02625B0, 0x020D12B, 0x0D0BA81, 0x07CD8A4, 0x060A5D4, 0x0609DF4,
+    0x020D068, 0x140B179, 0x03605B0, 0x0263DF0, 0x0345652, 0x0493D8C, 0x037B1F2, 0x0478A4F,
+    0x0293D2C, 0x064BE44, 0x0342650, 0x049258C, 0x034564E, 0x0208DEE, 0x087B9F2, 0x029552E,
+    0x0293DC3, 0x02925CB, 0x07954C6, 0x0133EAC, 0x12490F9, 0x1249DF2, 0x079258C, 0x1093DC7,
+    0x02906EC, 0x0293E88, 0x0D7D1F2, 0x097524F, 0x0396614, 0x07925F4, 0x0265654, 0x02955D4,
+    0x149258C, 0x1493D8C, 0x1443E4E, 0x149546B, 0x034064D, 0x12AB441, 0x1979D23, 0x0C48A41,
+    0x016064D, 0x0878659, 0x01121F2, 0x0D7B032, 0x016BEB2, 0x012352E, 0x1570832, 0x029052E,
+    0x077064C, 0x127B42E, 0x011BE4E, 0x066046B, 0x0448659, 0x044B832, 0x0138653, 0x0165032,
+    0x0175241, 0x040B8F3, 0x0191DF4, 0x149046B, 0x1249D24, 0x011A0A4, 0x0D08E4F, 0x0168745,
+    0x0E09132, 0x120B899, 0x020A64E, 0x02AC8E8, 0x024C868, 0x02ACA4F, 0x027C9EE, 0x107C868,
+    0x04ACAAD, 0x0D7C9EE, 0x02AC999, 0x016064D, 0x10605CB, 0x037C979, 0x0E7CA88, 0x024CA88,
+    0x14AC8D9, 0x0194839, 0x02AC961, 0x01AC82C, 0x067C9A1, 0x011046B, 0x0C0C8EF, 0x030C9D9,
+    0x0B0C9A1, 0x020C9B9, 0x100C979, 0x080C899, 0x1061445, 0x0565485, 0x042B2C5, 0x0366136,
+    0x0342485, 0x042A465, 0x0C496B8, 0x01B9AAC, 0x05715B9, 0x05712A5, 0x03425C5, 0x0E48D05,
+    0x03414B0, 0x030B613, 0x0229EAD, 0x072B124, 0x0229D2E, 0x072B925, 0x05614F9, 0x01B9AAC,
+    0x082A4E8, 0x024B0E5, 0x062A4EE, 0x0160AAD, 0x024B8E5, 0x0363EC5, 0x0428DF9, 0x0366136,
+    0x0F61125, 0x0C7BE19, 0x0E7B865, 0x0763C45, 0x0279D25, 0x020DD93, 0x03415AF, 0x05729F9,
+    0x082B1F4, 0x02AD285, 0x0549D14, 0x11AA685, 0x0C496B4, 0x05A2123, 0x03AD125, 0x042C1F4,
+    0x04B9594, 0x042A699, 0x0428934, 0x1429099, 0x142B609, 0x1428D19, 0x142B868, 0x144B085,
+    0x14415A5, 0x011142D, 0x03455B0, 0x013A585, 0x0162565, 0x0229468, 0x0138605, 0x0629599,
+    0x03625A2, 0x0760465, 0x0F1942E, 0x0229C2E, 0x102B82C, 0x036142E, 0x082B9C1, 0x02285CF,
+    0x0D7B099, 0x0D2902C, 0x0228499, 0x0260485, 0x011D685, 0x062D02C, 0x042B5E2, 0x011A0A4,
+    0x0121614, 0x0261434, 0x02286B4, 0x0428594, 0x01395D4, 0x020A745, 0x02090E5, 0x070D4E5,
+    0x011142D, 0x0309461, 0x11A964E, 0x0133EAC, 0x1229099, 0x122A927, 0x1228924, 0x122A4EE,
+    0x1228DEE, 0x0428DF2, 0x0569659, 0x0229659, 0x10655A2, 0x0493DC5, 0x020A64E, 0x12296C5,
+    0x0648A45, 0x07AB44F, 0x0292485, 0x0343E45, 0x03915A5, 0x122D125, 0x1228E89, 0x016A5C5,
+    0x0D2D24F, 0x0FAD245, 0x0133EAC, 0x05B1654, 0x144164D, 0x1441645, 0x011046B, 0x066146B,
+    0x029142B, 0x030B338, 0x1228832, 0x030C1EE, 0x011046B, 0x1228468, 0x0132645, 0x010C8E8,
+    0x016C199, 0x049142D, 0x0329032, 0x0490565, 0x011A5C7, 0x0161654, 0x060A645, 0x162C8E5,
+    0x102C92C, 0x062C9F8, 0x067C8E5, 0x0E2CAC5, 0x05749EC, 0x03AC925, 0x0653E44, 0x102C979,
+    0x0E2C899, 0x020CA45, 0x020C8E5, 0x0343C6B, 0x0279CB9, 0x082B2C5, 0x032B0A2, 0x022D8AC,
+    0x02614B0, 0x096C0AC, 0x0DA8D79, 0x0B714AC, 0x074D8AE, 0x020B973, 0x03790A3, 0x0D790AC,
+    0x0448CB9, 0x047E4AE, 0x09710B8, 0x0F7B608, 0x0229EAD, 0x0FC09F7, 0x0C7C0A4, 0x0C788A4,
+    0x03654A4, 0x02614A4, 0x160B613, 0x07488A4, 0x044ACA4, 0x067B173, 0x06624A4, 0x087AEAD,
+    0x174B613, 0x0229CB4, 0x037B4B4, 0x11AA4B4, 0x064B0B4, 0x087D0AC, 0x062D0A4, 0x01710A4,
+    0x142B0B8, 0x0160AAD, 0x147C0A5, 0x147ACA4, 0x01108B9, 0x01210A4, 0x01490A4, 0x0171CAC,
+    0x011B8A4, 0x177ACAE, 0x0209CAC, 0x01268A4, 0x020E4A4, 0x0363EEE, 0x011A5C7, 0x037D8AE,
+    0x100B0A1, 0x100E4A4, 0x080DCA4, 0x080B0A4, 0x01849EE, 0x0229EAD, 0x0343DB0, 0x03A88B2,
+    0x0263EF9, 0x0C7D605, 0x03ACAD9, 0x120B613, 0x06488B2, 0x060D9F2, 0x03924B2, 0x02924A6,
+    0x077B8B2, 0x064B8B2, 0x037E615, 0x05610B2, 0x03414AB, 0x05710B2, 0x03914B0, 0x0F908A4,
+    0x016D46B, 0x0428C26, 0x03954B4, 0x0D2D0B2, 0x02605CB, 0x0FAD0B2, 0x01849EE, 0x1449CB2,
+    0x0171CB2, 0x030D8A4, 0x030DCA4, 0x070B4B2, 0x0C08CB2, 0x060E4B2, 0x030C0B2, 0x080D8B2,
+    0x03405B0, 0x140D0B2, 0x03424A6, 0x10AC8A5, 0x0CAC8B2, 0x17424C6, 0x0138605, 0x080C8AD,
+    0x027D068, 0x0248CB0, 0x135A58C, 0x13655B0, 0x020CD33, 0x1340D09, 0x044CC6F, 0x131A1AF,
+    0x131BD84, 0x066246B, 0x1363E68, 0x1343C6B, 0x137246B, 0x024CDEE, 0x1373DE4, 0x1373DF0,
+    0x13655C7, 0x02CCE69, 0x135A5B3, 0x011A5C7, 0x104CE79, 0x0249D01, 0x0160AAD, 0x137C219,
+    0x030B338, 0x0342584, 0x1379A99, 0x024B0E5, 0x07ACE8F, 0x011A0A4, 0x13A25C7, 0x13A55C7,
+    0x0182668, 0x0743E74, 0x03424A6, 0x03405B0, 0x135A5D4, 0x13455D4, 0x019CC39, 0x131D441,
+    0x01985C1, 0x016D46B, 0x010C8E8, 0x134046B, 0x13B852E, 0x1383039, 0x0360670, 0x044B979,
+    0x0180465, 0x134CC2C, 0x136858C, 0x1385681, 0x0D4BA99, 0x13A058B, 0x1343C34, 0x01B0674,
+    0x020CD23, 0x07ACE79, 0x020CC2C, 0x020B261, 0x030BA74, 0x130A5D4, 0x0E0CE99, 0x029266B,
+    0x13BBE44, 0x136D646, 0x1365650, 0x134264B, 0x0162F24, 0x1373E54, 0x127BE74, 0x0792674,
+    0x13B8644, 0x0790670, 0x0133EAC, 0x1318646, 0x1340644, 0x1368654, 0x087CA79, 0x131C9E4,
+    0x13A492D, 0x04ACA74, 0x13A4837, 0x0661668, 0x03405B0, 0x022CDED, 0x0125594, 0x0D2CDEE,
+    0x0DAB068, 0x0363DB0, 0x13A9485, 0x13290E5, 0x099CEA5, 0x13494E5, 0x07AA665, 0x03605B0,
+    0x134B865, 0x1372485, 0x131BDC5, 0x0161608, 0x01A9D14, 0x13195D4, 0x132D2B0, 0x022CDF4,
+    0x0B706C5, 0x042A674, 0x0160AAD, 0x1369594, 0x132902E, 0x132C121, 0x1370565, 0x011046B,
+    0x1360565, 0x0115665, 0x011046B, 0x0D4ACA4, 0x132C281, 0x13A1424, 0x01104D4, 0x0138685,
+    0x030CE85, 0x0395665, 0x131BE45, 0x1381432, 0x1370645, 0x0192665, 0x087CA65, 0x011A5C7,
+    0x13414B0, 0x0D7CCB9, 0x06ACCA5, 0x132B4AE, 0x1342613, 0x0161608, 0x01104D4, 0x0F74CB4,
+    0x0172D13, 0x019ACB7, 0x020CCA4, 0x130D8A4, 0x02286B8, 0x132DCB2, 0x135A4B2, 0x134E0B2,
+    0x0C7CCB2, 0x0D4CCB2, 0x13414B2, 0x050CCB2, 0x055A5C7, 0x137C8B2, 0x08AB524, 0x13BA668,
+    0x0123538, 0x06AB4A4, 0x0C4B613, 0x104B193, 0x131CAAD, 0x1318453, 0x10654F3, 0x037B44F,
+    0x037B613, 0x1078EB3, 0x064B068, 0x0162F2C, 0x087DC99, 0x0341673, 0x02AB608, 0x0342584,
+    0x13B84F3, 0x019CDE3, 0x020DC99, 0x08AB524, 0x0C4B8F3, 0x07488A4, 0x107B893, 0x02790E5,
+    0x13425D3, 0x024A9F5, 0x027D068, 0x0C4BDD3, 0x044CD73, 0x1048D73, 0x131CAA2, 0x0340493,
+    0x067B173, 0x020D068, 0x06A90E5, 0x104B973, 0x03416F9, 0x0B73C53, 0x13425D3, 0x134264B,
+    0x062B1EE, 0x13806EE, 0x0116673, 0x0693E88, 0x0A488A4, 0x0C79A93, 0x0342693, 0x037BE93,
+    0x1375453, 0x0765693, 0x0138605, 0x011D12E, 0x0D7BE93, 0x0DACE93, 0x037B973, 0x14798D3,
+    0x14BA4F3, 0x1448D73, 0x147BE93, 0x1445493, 0x1340499, 0x0229D2E, 0x0340493, 0x0448593,
+    0x024B8E5, 0x047DDD9, 0x047B833, 0x01225F3, 0x0678593, 0x0378593, 0x0171E59, 0x016A673,
+    0x016B5F3, 0x13405B3, 0x07605B3, 0x1370613, 0x060B879, 0x047C033, 0x0116673, 0x0175133,
+    0x01A3DB3, 0x13806EE, 0x011142D, 0x0340693, 0x13824C6, 0x03455B0, 0x0208D73, 0x0343DB0,
+    0x0B4B193, 0x0D0E133, 0x0D0A5B3, 0x13406ED, 0x0766608, 0x020B8F3, 0x037E615, 0x070DE13,
+    0x04091F3, 0x020D493, 0x0443EF3, 0x040B5D3, 0x104D1EE, 0x013B1F7, 0x0D0B293, 0x030BA93,
+    0x01121F2, 0x140B613, 0x029246B, 0x070DD73, 0x174B613, 0x03625A2, 0x12A8D73, 0x0265653,
+    0x132B0D9, 0x124B8F3, 0x0693DD3, 0x0792493, 0x0493E73, 0x047BE53, 0x0229EAD, 0x1249A93,
+    0x016A699, 0x14925B3, 0x0263DC4, 0x0340653, 0x07C88A4, 0x0116673, 0x0C48653, 0x04905B3,
+    0x0690613, 0x0690693, 0x1498653, 0x1208D73, 0x120B613, 0x060A653, 0x047DDD9, 0x107C973,
+    0x066046B, 0x10AC993, 0x077064C, 0x04299E7, 0x0C7C933, 0x012342E, 0x03AC893, 0x067CA93,
+    0x109A037, 0x030C853, 0x060ACA4, 0x0C0C973, 0x0E0C873, 0x170C9D3, 0x03416F9, 0x04B8646,
+    0x04AB44F, 0x042B5EE, 0x13596F3, 0x011B8A4, 0x03414D3, 0x03416F3, 0x072B093, 0x0263DC4,
+    0x019CDE3, 0x042A4D9, 0x0133EAC, 0x055A5C7, 0x102B893, 0x0B2B213, 0x042C288, 0x0665453,
+    0x060D2E1, 0x0248CB0, 0x056C293, 0x0D29693, 0x056A693, 0x14295B3, 0x142CE93, 0x1428D13,
+    0x0129D33, 0x0661433, 0x0828613, 0x0160AAD, 0x0CCB608, 0x01695D3, 0x056BD49, 0x0429C33,
+    0x0828493, 0x0428593, 0x011142D, 0x022D033, 0x122A5D3, 0x170CE13, 0x0162F24, 0x082A653,
+    0x0FA9D14, 0x0AAB0B0, 0x0791733, 0x016064D, 0x12A9C59, 0x027A5CB, 0x0B2C853, 0x022C8F3,
+    0x102C973, 0x0343DB0, 0x03A88B3, 0x027E0B3, 0x07AB213, 0x0C788B3, 0x0678EB3, 0x0D0CD73,
+    0x01386C5, 0x064B1B3, 0x080CE13, 0x06624B3, 0x0E7B865, 0x135A5B0, 0x10790F9, 0x042B0B3,
+    0x131A1AF, 0x04AB8B3, 0x03AD0B3, 0x030CD73, 0x0D2D0B3, 0x011B8A4, 0x14A88B3, 0x0121185,
+    0x147B4B3, 0x02AB608, 0x011B4B3, 0x13826D3, 0x040B8F3, 0x01C25C7, 0x042CCB8, 0x02090E5,
+    0x03ACE13, 0x0BA9355, 0x04299E7, 0x140ACB3, 0x10296C5, 0x07954B3, 0x12AB8B3, 0x0DACD23,
+    0x0180465, 0x07D2613, 0x05CC8B3, 0x0CAC8B3, 0x131A2E1, 0x070CE13, 0x030DCA4, 0x18C6136,
+    0x064EB59, 0x084C219, 0x18C5929, 0x18B2529, 0x0E498D9, 0x0D4B92D, 0x064B9D9, 0x0D4B8F9,
+    0x08CA5C7, 0x064B868, 0x104B96F, 0x024B8EF, 0x0F425C7, 0x0D7B5B9, 0x087B979, 0x0679CF9,
+    0x087BD79, 0x0168745, 0x0E7A1F7, 0x077BCD9, 0x11AA4C6, 0x157412E, 0x02AB608, 0x06AB979,
+    0x02A9CF9, 0x013A5C7, 0x0DAB5B9, 0x10A98D9, 0x0110668, 0x02AB868, 0x0AAB44F, 0x064B1B9,
+    0x02625C7, 0x036246B, 0x03625C7, 0x034D92C, 0x0263EEE, 0x0ECB1EE, 0x10655A2, 0x0C0DDD3,
+    0x0649D14, 0x07D2613, 0x0249099, 0x087DC99, 0x047DC99, 0x01415B3, 0x067D5C4, 0x03A8934,
+    0x0249DF4, 0x047D299, 0x0B4D299, 0x0249D14, 0x084D068, 0x011A5C7, 0x0678C2C, 0x016C199,
+    0x077B824, 0x030B338, 0x06605CB, 0x0B0C201, 0x0D09DA1, 0x080A575, 0x0408D01, 0x0B0B949,
+    0x100B881, 0x0D0B921, 0x0D08D0F, 0x080C219, 0x0428C26, 0x070B5B9, 0x040B899, 0x016C0A4,
+    0x070B6B4, 0x020D299, 0x080D068, 0x0393C6B, 0x08AB5F2, 0x0393DEB, 0x0293DEB, 0x020B173,
+    0x174264C, 0x01A9EB2, 0x069046B, 0x039046B, 0x177C899, 0x0328EAD, 0x0A2B199, 0x034146B,
+    0x174158B, 0x022B068, 0x0629599, 0x0229468, 0x0665565, 0x082B2C5, 0x0A29745, 0x022B125,
+    0x022B868, 0x02A90E5, 0x0A7D585, 0x0263D65, 0x062B1EE, 0x05729F9, 0x027B865, 0x0B2D068,
+    0x022B039, 0x0168745, 0x0E0A6C5, 0x0171E59, 0x1093DC5, 0x1229C2C, 0x07906C5, 0x03906C5,
+    0x02906C5, 0x022CA59, 0x0679CB9, 0x0A7ACB9, 0x037B0B9, 0x0C7D8B9, 0x05C0CAC, 0x037D8AE,
+    0x04790F9, 0x1708D79, 0x037BCA4, 0x01B3EF3, 0x04AC0A4, 0x037C0A4, 0x082DCA4, 0x047B0A4,
+    0x0C7D8A4, 0x044ACA4, 0x0443EF3, 0x0D4ACA4, 0x104ACA4, 0x0C4B4A4, 0x104B0A4, 0x05710A4,
+    0x037B8A4, 0x15718A4, 0x0970CA4, 0x044B8A4, 0x03090E5, 0x030DCA4, 0x01386C5, 0x011046B,
+    0x070B0A1, 0x0C08CA4, 0x0D0E0A4, 0x070C0A4, 0x062DCB2, 0x082DCB2, 0x070DD79, 0x01B3EF3,
+    0x0D7D8B2, 0x12AC0A5, 0x107ACB2, 0x03914AC, 0x0C2D8B2, 0x0C7D8B2, 0x03954AC, 0x064D8B2,
+    0x03098B3, 0x100C037, 0x0C4ACB2, 0x10914AE, 0x0E2D8B2, 0x124C0AE, 0x04298B2, 0x0F210B2,
+    0x047DCB2, 0x12A90B2, 0x044B4B2, 0x127D8A4, 0x06914A4, 0x0D0ACB2, 0x01934B2, 0x03088B2,
+    0x120D8AE, 0x06090B2, 0x120ACA4, 0x0C0B4B2, 0x100C0B2, 0x120D0B2, 0x100C8A4, 0x138D522,
+    0x1366599, 0x013B1F7, 0x08ACD79, 0x03ACD19, 0x01B8644, 0x04ACE99, 0x07ACE99, 0x13A2594,
+    0x13A04C6, 0x13A05C4, 0x1341586, 0x0113C85, 0x1382565, 0x13490A4, 0x13098B2, 0x0345453,
+    0x011046B, 0x0DA8EB3, 0x02498D3, 0x13426D3, 0x0D498D3, 0x13425B3, 0x04498D3, 0x0A488A4,
+    0x07D2613, 0x1385493, 0x1382473, 0x0249D01, 0x0345453, 0x07AB0D3, 0x074B093, 0x04798D3,
+    0x0678EB3, 0x027B453, 0x04791F3, 0x0378DF3, 0x027E9F3, 0x020E5F5, 0x067D593, 0x011142D,
+    0x0C491F3, 0x042B5E2, 0x077B0D3, 0x0C4B1F3, 0x0C78DF3, 0x024BCF3, 0x0343C73, 0x027BDB3,
+    0x0343EF3, 0x016A4EF, 0x067BD93, 0x0363C93, 0x0263EF3, 0x0763C53, 0x011046B, 0x1375453,
+    0x131A2E1, 0x04AB8F3, 0x020DC93, 0x0168673, 0x047DDD3, 0x016A4EF, 0x0B4DD33, 0x01104D4,
+    0x13406ED, 0x02ACD73, 0x0B4B193, 0x0A0B453, 0x070CCB3, 0x0B0B949, 0x0110668, 0x0168934,
+    0x064CE93, 0x0B4D113, 0x135A693, 0x044BA93, 0x013B1F7, 0x10AD293, 0x01204E5, 0x08ABA93,
+    0x1345693, 0x164CC33, 0x13704F3, 0x13404F3, 0x0660579, 0x0660453, 0x0260453, 0x0760493,
+    0x06604F3, 0x027B033, 0x0C78493, 0x0609DF4, 0x0A7DD99, 0x03098D3, 0x0D0B433, 0x070CE13,
+    0x070B193, 0x030B173, 0x080B193, 0x0D0B193, 0x100B193, 0x0653E44, 0x060B8F3, 0x060DDD3,
+    0x0D0CE93, 0x020D293, 0x0D0D113, 0x12498D3, 0x02924F3, 0x0293EF3, 0x127BCD3, 0x1278653,
+    0x07905D3, 0x02905D3, 0x0290493, 0x03904F3, 0x067C973, 0x067C893, 0x047C973, 0x177C973,
+    0x087C9D3, 0x030C973, 0x080C973, 0x0E28D73, 0x060CE93, 0x0428D73, 0x0E2DAB3, 0x011A493,
+    0x0729573, 0x0629493, 0x0A79733, 0x0D2B093, 0x1318453, 0x020CD73, 0x1029573, 0x13826D3,
+    0x0829A93, 0x102B293, 0x0229693, 0x072BA93, 0x1328593, 0x0C284D3, 0x04914F3, 0x0391673,
+    0x0791613, 0x1329653, 0x060DDD3, 0x132E0B3, 0x064EB59, 0x020CD73, 0x087ACB3, 0x06AB4B3,
+    0x0D7D4B3, 0x102ACB3, 0x020CD73, 0x0C7CCB3, 0x131A1AF, 0x05658B3, 0x07654B3, 0x064D8B3,
+    0x0D4B4B3, 0x134E0B3, 0x01B3EF3, 0x0766608, 0x0C4ACB3, 0x104B0B3, 0x0161608, 0x060B9D9,
+    0x042E0B3, 0x0168673, 0x03290B3, 0x03790B3, 0x044ACB3, 0x060ACA4, 0x02299E7, 0x04299E7,
+    0x070B941, 0x062B865, 0x100D8B3, 0x060B4B3, 0x0D0ACB3, 0x0B706C5, 0x13596F3, 0x0408CB3,
+    0x055A5C7, 0x037C8B3, 0x060C8B3, 0x02AEB59, 0x08AB979, 0x0C7B199, 0x05318A4, 0x07AE4A4,
+    0x047E8A4, 0x01A9038, 0x06498A4, 0x060E8A4, 0x06090A4, 0x17090A4, 0x0539CB2, 0x062D8B2,
+    0x0F318B2, 0x06498B2, 0x12490B2, 0x120DCB2, 0x01104D4, 0x134B193, 0x07AB193, 0x077B093,
+    0x027B193, 0x0168673, 0x060B193, 0x0A29613, 0x0A2CE93, 0x1328E93, 0x037D8B3, 0x107C0B3,
+    0x104C0B3, 0x06498B3, 0x172A4E8, 0x01B3EF3, 0x047D8B3, 0x1709DEE, 0x060E0B3, 0x020ACB3,
+    0x0A090B3, 0x130ACB3, 0x100B0B3, 0x03098B3,
+};
+
+const uint16_t StrategyTables_firstEdges[1461] =
+{
+        0,   185,   262,   303,   326,   381,   406,   417,   457,   478,   492,   541,
+      564,   577,   615,   628,   638,   657,   659,   660,   682,   690,   695,   710,
+      711,   727,   731,   735,   798,   829,   848,   885,   907,   911,   930,   933,
+      934,   972,   992,  1005,  1028,  1036,  1041,  1048,  1063,  1066,  1068,  1070,
+     1077,  1078,  1120,  1143,  1158,  1170,  1171,  1187,  1195,  1199,  1234,  1245,
+     1255,  1265,  1268,  1284,  1290,  1294,  1309,  1310,  1314,  1316,  1324,  1369,
+     1397,  1399,  1427,  1445,  1465,  1478,  1479,  1498,  1510,  1511,  1523,  1531,
+     1534,  1547,  1555,  1561,  1565,  1569,  1602,  1620,  1623,  1642,  1655,  1664,
+     1669,  1685,  1689,  1697,  1698,  1699,  1711,  1712,  1730,  1740,  1745,  1751,
+     1763,  1765,  1767,  1773,  1781,  1782,  1837,  1867,  1883,  1913,  1925,  1931,
+     1963,  1975,  1985,  2013,  2021,  2029,  2044,  2049,  2054,  2062,  2063,  2081,
+     2087,  2094,  2098,  2110,  2115,  2119,  2152,  2166,  2173,  2189,  2196,  2200,
+     2216,  2218,  2223,  2232,  2233,  2243,  2246,  2247,  2248,  2275,  2286,  2295,
+     2303,  2316,  2321,  2325,  2337,  2340,  2341,  2345,  2355,  2356,  2361,  2383,
+     2392,  2400,  2413,  2414,  2417,  2436,  2443,  2451,  2468,  2477,  2479,  2486,
+     2487,  2491,  2493,  2494,  2495,  2507,  2512,  2520,  2535,  2536,  2539,  2546,
+     2547,  2548,  2555,  2558,  2566,  2569,  2574,  2575,  2579,  2583,  2584,  2591,
+     2594,  2603,  2604,  2612,  2613,  2615,  2617,  2619,  2620,  2622,  2627,  2629,
+     2631,  2632,  2633,  2640,  2641,  2651,  2652,  2659,  2662,  2668,  2669,  2679,
+     2685,  2687,  2689,  2690,  2695,  2696,  2697,  2702,  2706,  2710,  2711,  2714,
+     2715,  2716,  2722,  2723,  2724,  2725,  2726,  2733,  2749,  2750,  2758,  2760,
+     2770,  2778,  2781,  2786,  2799,  2804,  2806,  2809,  2810,  2814,  2821,  2822,
+     2824,  2834,  2839,  2840,  2842,  2843,  2844,  2846,  2848,  2850,  2853,  2854,
+     2858,  2860,  2864,  2867,  2871,  2872,  2873,  2884,  2895,  2896,  2904,  2907,
+     2908,  2909,  2916,  2918,  2919,  2920,  2921,  2922,  2923,  2934,  2942,  2945,
+     2950,  2953,  2956,  2964,  2965,  2966,  2976,  2981,  2983,  2985,  2989,  2990,
+     2991,  2995,  2996,  3004,  3017,  3024,  3026,  3028,  3030,  3033,  3034,  3044,
+     3045,  3046,  3051,  3052,  3054,  3055,  3056,  3058,  3062,  3063,  3064,  3065,
+     3066,  3070,  3073,  3074,  3075,  3076,  3077,  3078,  3079,  3080,  3081,  3082,
+     3083,  3096,  3097,  3103,  3104,  3105,  3110,  3112,  3114,  3116,  3122,  3123,
+     3124,  3125,  3128,  3129,  3134,  3137,  3139,  3144,  3147,  3148,  3152,  3153,
+     3154,  3163,  3166,  3167,  3170,  3171,  3173,  3174,  3175,  3176,  3177,  3179,
+     3181,  3182,  3183,  3187,  3190,  3196,  3197,  3198,  3199,  3200,  3204,  3205,
+     3206,  3207,  3212,  3213,  3216,  3218,  3219,  3220,  3221,  3243,  3246,  3249,
+     3261,  3265,  3267,  3272,  3275,  3279,  3284,  3288,  3289,  3297,  3301,  3305,
+     3307,  3309,  3310,  3314,  3319,  3321,  3322,  3323,  3327,  3328,  3344,  3345,
+     3352,  3353,  3362,  3366,  3369,  3370,  3374,  3378,  3388,  3394,  3396,  3401,
+     3402,  3403,  3404,  3405,  3407,  3408,  3409,  3410,  3411,  3413,  3414,  3415,
+     3419,  3420,  3427,  3436,  3437,  3440,  3451,  3454,  3461,  3467,  3468,  3473,
+     3474,  3476,  3478,  3480,  3482,  3490,  3495,  3497,  3498,  3499,  3501,  3507,
+     3511,  3512,  3513,  3514,  3515,  3516,  3521,  3523,  3524,  3527,  3528,  3532,
+     3538,  3540,  3541,  3542,  3543,  3544,  3545,  3546,  3547,  3559,  3561,  3566,
+     3568,  3570,  3580,  3581,  3585,  3586,  3587,  3588,  3595,  3596,  3597,  3600,
+     3602,  3603,  3604,  3607,  3615,  3617,  3624,  3625,  3631,  3634,  3635,  3639,
+     3643,  3648,  3649,  3650,  3652,  3655,  3656,  3657,  3662,  3663,  3666,  3668,
+     3669,  3670,  3671,  3677,  3678,  3680,  3681,  3682,  3695,  3696,  3708,  3709,
+     3711,  3712,  3714,  3723,  3726,  3729,  3732,  3735,  3737,  3739,  3740,  3741,
+     3762,  3766,  3770,  3776,  3777,  3778,  3779,  3786,  3787,  3790,  3795,  3796,
+     3803,  3808,  3811,  3812,  3813,  3817,  3818,  3820,  3823,  3825,  3829,  3830,
+     3831,  3832,  3833,  3834,  3835,  3837,  3849,  3855,  3860,  3862,  3867,  3871,
+     3877,  3879,  3881,  3883,  3884,  3888,  3892,  3912,  3915,  3919,  3931,  3936,
+     3943,  3944,  3950,  3953,  3954,  3961,  3967,  3977,  3978,  3984,  3986,  3992,
+     3993,  3997,  4001,  4004,  4008,  4013,  4014,  4018,  4019,  4020,  4029,  4033,
+     4034,  4037,  4038,  4042,  4043,  4048,  4049,  4053,  4054,  4055,  4060,  4063,
+     4064,  4069,  4073,  4084,  4088,  4093,  4097,  4103,  4104,  4109,  4116,  4117,
+     4119,  4121,  4126,  4128,  4129,  4137,  4138,  4152,  4158,  4159,  4164,  4170,
+     4171,  4179,  4186,  4188,  4193,  4194,  4197,  4198,  4199,  4207,  4209,  4214,
+     4218,  4219,  4220,  4224,  4228,  4229,  4237,  4240,  4243,  4246,  4247,  4250,
+     4256,  4259,  4260,  4261,  4263,  4270,  4271,  4273,  4274,  4277,  4284,  4285,
+     4287,  4288,  4289,  4290,  4294,  4296,  4297,  4299,  4300,  4303,  4304,  4305,
+     4306,  4308,  4309,  4313,  4314,  4315,  4316,  4317,  4318,  4319,  4320,  4321,
+     4323,  4328,  4333,  4338,  4339,  4351,  4359,  4360,  4361,  4362,  4363,  4364,
+     4371,  4372,  4373,  4374,  4377,  4382,  4385,  4386,  4387,  4391,  4393,  4396,
+     4397,  4401,  4402,  4405,  4409,  4410,  4412,  4415,  4419,  4421,  4422,  4425,
+     4428,  4429,  4430,  4432,  4433,  4434,  4435,  4436,  4439,  4443,  4444,  4445,
+     4448,  4455,  4459,  4462,  4464,  4467,  4468,  4469,  4470,  4475,  4476,  4478,
+     4479,  4481,  4483,  4484,  4485,  4489,  4491,  4509,  4522,  4527,  4540,  4544,
+     4546,  4554,  4558,  4559,  4576,  4579,  4581,  4596,  4599,  4612,  4617,  4621,
+     4626,  4636,  4639,  4643,  4658,  4660,  4669,  4670,  4674,  4680,  4685,  4691,
+     4692,  4703,  4704,  4712,  4718,  4721,  4725,  4733,  4734,  4740,  4742,  4755,
+     4761,  4765,  4773,  4776,  4783,  4787,  4788,  4789,  4790,  4801,  4802,  4805,
+     4809,  4810,  4813,  4821,  4822,  4823,  4825,  4826,  4828,  4844,  4849,  4850,
+     4855,  4864,  4869,  4877,  4881,  4886,  4887,  4891,  4894,  4895,  4897,  4899,
+     4903,  4907,  4908,  4912,  4913,  4914,  4922,  4925,  4926,  4930,  4945,  4946,
+     4957,  4961,  4962,  4963,  4968,  4975,  4976,  4981,  4985,  4988,  4989,  4993,
+     4994,  5000,  5003,  5004,  5006,  5010,  5011,  5019,  5025,  5029,  5036,  5038,
+     5040,  5045,  5046,  5047,  5048,  5049,  5050,  5054,  5055,  5058,  5059,  5064,
+     5065,  5079,  5083,  5084,  5086,  5088,  5089,  5090,  5091,  5092,  5094,  5103,
+     5104,  5110,  5111,  5116,  5122,  5123,  5127,  5128,  5129,  5138,  5139,  5142,
+     5143,  5144,  5145,  5150,  5154,  5169,  5184,  5185,  5188,  5190,  5191,  5195,
+     5202,  5205,  5211,  5216,  5224,  5232,  5233,  5239,  5248,  5251,  5255,  5256,
+     5258,  5259,  5260,  5261,  5262,  5264,  5265,  5269,  5272,  5278,  5280,  5283,
+     5284,  5285,  5286,  5289,  5290,  5292,  5299,  5303,  5304,  5311,  5315,  5316,
+     5319,  5324,  5329,  5330,  5331,  5332,  5350,  5353,  5354,  5364,  5365,  5372,
+     5379,  5382,  5388,  5392,  5393,  5400,  5405,  5414,  5416,  5421,  5423,  5425,
+     5429,  5430,  5434,  5436,  5439,  5440,  5444,  5445,  5453,  5457,  5461,  5465,
+     5469,  5474,  5478,  5482,  5483,  5487,  5489,  5490,  5494,  5497,  5500,  5502,
+     5503,  5507,  5512,  5516,  5518,  5520,  5522,  5523,  5524,  5526,  5527,  5528,
+     5529,  5530,  5531,  5532,  5533,  5534,  5536,  5537,  5538,  5541,  5544,  5545,
+     5546,  5547,  5548,  5549,  5557,  5558,  5561,  5562,  5563,  5566,  5567,  5568,
+     5570,  5571,  5572,  5573,  5574,  5575,  5576,  5577,  5581,  5585,  5588,  5589,
+     5590,  5591,  5594,  5595,  5596,  5597,  5598,  5599,  5600,  5601,  5604,  5607,
+     5608,  5609,  5612,  5613,  5614,  5616,  5618,  5619,  5620,  5621,  5622,  5627,
+     5629,  5633,  5634,  5635,  5638,  5639,  5640,  5642,  5643,  5644,  5645,  5646,
+     5650,  5651,  5652,  5653,  5654,  5655,  5656,  5658,  5659,  5661,  5662,  5663,
+     5664,  5665,  5666,  5667,  5668,  5669,  5670,  5671,  5672,  5673,  5674,  5675,
+     5676,  5677,  5679,  5680,  5684,  5685,  5686,  5688,  5689,  5690,  5691,  5692,
+     5693,  5695,  5696,  5697,  5698,  5706,  5716,  5717,  5720,  5722,  5724,  5725,
+     5726,  5727,  5731,  5735,  5736,  5738,  5739,  5741,  5742,  5743,  5744,  5745,
+     5747,  5753,  5754,  5757,  5760,  5761,  5762,  5763,  5766,  5775,  5777,  5783,
+     5786,  5788,  5789,  5792,  5793,  5794,  5795,  5796,  5799,  5802,  5806,  5807,
+     5808,  5809,  5810,  5811,  5812,  5814,  5815,  5817,  5818,  5819,  5824,  5827,
+     5828,  5830,  5831,  5832,  5833,  5834,  5835,  5836,  5837,  5838,  5841,  5842,
+     5843,  5846,  5847,  5848,  5849,  5850,  5851,  5852,  5855,  5856,  5857,  5858,
+     5859,  5862,  5863,  5865,  5866,  5867,  5868,  5869,  5873,  5874,  5875,  5876,
+     5880,  5885,  5886,  5888,  5890,  5891,  5892,  5893,  5894,  5895,  5900,  5901,
+     5904,  5905,  5912,  5913,  5914,  5916,  5917,  5918,  5921,  5922,  5925,  5926,
+     5929,  5930,  5931,  5934,  5935,  5939,  5940,  5944,  5947,  5948,  5951,  5952,
+     5955,  5959,  5960,  5961,  5965,  5968,  5972,  5975,  5979,  5980,  5981,  5982,
+     5983,  5986,  5987,  5990,  5991,  5992,  5995,  5998,  5999,  6004,  6005,  6006,
+     6007,  6008,  6009,  6010,  6016,  6020,  6021,  6022,  6025,  6030,  6031,  6032,
+     6034,  6036,  6039,  6040,  6041,  6042,  6043,  6044,  6045,  6046,  6047,  6048,
+     6049,  6050,  6051,  6052,  6053,  6054,  6055,  6056,  6057,  6058,  6060,  6061,
+     6063,  6066,  6067,  6069,  6072,  6074,  6075,  6076,  6077,  6081,  6085,  6086,
+     6090,  6091,  6092,  6093,  6094,  6095,  6096,  6097,  6098,  6099,  6100,  6104,
+     6109,  6113,  6116,  6117,  6119,  6120,  6123,  6126,  6128,  6133,  6134,  6135,
+     6139,  6140,  6141,  6144,  6148,  6149,  6150,  6153,  6157,  6159,  6162,  6163,
+     6164,  6165,  6171,  6175,  6179,  6185,  6190,  6191,  6192,  6193,  6197,  6201,
+     6202,  6206,  6207,  6208,  6209,  6210,  6211,  6212,  6213,  6214,  6217,  6218,
+     6221,  6222,  6223,  6224,  6225,  6226,  6227,  6228,  6229,  6232,  6233,  6235,
+     6236,  6237,  6240,  6241,  6242,  6243,  6244,  6245,  6246,  6247,  6248,  6252,
+     6255,  6256,  6263,  6264,  6265,  6267,  6268,  6269,  6270,
+};
+
+const FeedbackCode StrategyTables_codes[6270] =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+     33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  45,  46,  47,  48,  51,  52,
+     54,  55,  56,  57,  58,  60,  61,  62,  63,  64,  65,  66,  67,  69,  70,  71,
+     72,  73,  74,  75,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+     90,  91,  92,  93,  94,  95,  96,  97,  99, 100, 101, 102, 103, 105, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 120, 121, 123, 126, 128, 129,
+    132, 135, 136, 138, 139, 141, 142, 144, 145, 147, 148, 150, 152, 153, 154, 162,
+    163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+    180, 181, 182, 183, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 198, 199,
+    200, 201, 203, 207, 208, 209, 213, 216, 217, 218, 219, 220, 222, 223, 224, 225,
+    226, 227, 228, 231, 232, 234, 236, 237, 240,   0,   1,   2,   3,   4,   5,   6,
+      7,   8,   9,  10,  11,  12,  13,  14,  15,  17,  20,  24,  25,  26,  27,  28,
+     29,  30,  31,  32,  33,  34,  35,  36,  37,  39,  42,  43,  45,  46,  47,  48,
+     51,  54,  55,  56,  57,  60,  62,  63,  66,  81,  84,  87,  89,  90,  91,  93,
+    102, 105, 111, 114, 118, 135, 138, 141, 144, 162, 165, 171, 173, 186, 189, 192,
+    199, 203, 207, 218, 225, 240,  27,  29,  30,  31,  33,  36,  38,  39,  41,  42,
+     44,  45,  48,  51,  54,  56,  57,  58,  60,  61,  62,  63,  64,  65,  66,  69,
+     75, 108, 111, 114, 116, 117, 123, 135, 138, 189, 195, 216, 222, 224, 225,   0,
+      1,   4,   6,   9,  10,  12,  18,  19,  24,  36,  37,  54,  60,  63,  72,  78,
+     85,  93, 105, 223, 234, 240,   9,  10,  11,  12,  13,  15,  16,  17,  18,  19,
+     20,  21,  22,  36,  37,  39,  40,  42,  43,  45,  48,  49,  63,  64,  66,  72,
+     73,  74,  78,  90,  91,  94,  99, 100, 103, 117, 118, 120, 129, 162, 163, 166,
+    167, 168, 169, 172, 180, 181, 182, 189, 195, 201, 216, 219, 222,  81,  84,  87,
+     89,  91,  92,  96, 108, 109, 114, 117, 162, 163, 165, 166, 168, 171, 173, 174,
+    176, 189, 190, 198, 216, 234,   9,  10,  12,  13,  36,  39,  45,  72,  90,  93,
+     99,   0,   1,   2,   3,   4,   5,   9,  12,  13,  19,  21,  23,  27,  28,  29,
+     30,  31,  37,  45,  54,  57,  63,  81,  82,  84,  93, 108, 162, 163, 164, 171,
+    172, 173, 180, 189, 190, 198, 216, 217, 225,   0,   2,   4,   5,   9,  11,  12,
+     18,  21,  27,  31,  54,  57,  72,  81, 108, 162, 163, 171, 189, 191,   0,   1,
+      3,   4,   9,  27,  28,  54,  57,  72,  81,  99, 108, 111,   0,   1,   2,   3,
+      4,   5,   6,   7,   8,  11,  12,  13,  14,  15,  18,  20,  21,  27,  30,  32,
+     33,  34,  35,  36,  39,  42,  48,  54,  56,  57,  58,  61,  66,  72,  74,  75,
+     81,  84,  87,  88,  91,  93,  99, 111, 120, 154, 216, 219, 234,  81,  83,  84,
+     86,  87,  90, 111, 117, 162, 163, 164, 165, 166, 168, 171, 174, 180, 181, 182,
+    186, 216, 221, 234,   0,   1,   3,   4,   9,  27,  28,  30,  36,  57,  84, 108,
+    111,   0,   1,   2,   3,   4,   5,   6,   9,  10,  11,  12,  13,  18,  24,  27,
+     28,  29,  30,  33,  36,  45,  54,  63,  72,  81,  84,  90,  91, 108, 126, 135,
+    162, 164, 171, 173, 182, 216, 218, 108, 112, 135, 144, 189, 190, 191, 192, 198,
+    216, 218, 219, 225,  81,  84,  90,  91,  93,  99, 102, 117, 162, 171,   0,   1,
+      3,   9,  12,  18,  21,  27,  54,  55,  57,  63,  72,  81,  84, 135, 162, 216,
+    219, 105, 132, 170,   0,   1,   2,   3,   5,   6,   7,   8,   9,  15,  30,  33,
+     42,  82,  90, 162, 164, 168, 170, 171, 177, 189,  83,  87, 108, 110, 114, 116,
+    123, 162,  20,  26,  50,  80, 128,   0,   1,   2,   3,   4,   5,   9,  10,  11,
+     12,  27,  30,  39,  54,  81, 209,   0,   1,   2,   3,   5,   9,  12,  27,  30,
+     54,  84, 138, 162, 164, 171, 189,   1,   4,  10,  37,  28,  31,  37,  55,   0,
+      1,   2,   3,   4,   5,   6,   7,   9,  10,  12,  13,  15,  16,  18,  19,  20,
+     21,  23,  24,  27,  29,  30,  31,  33,  36,  39,  48,  54,  55,  57,  60,  61,
+     64,  66,  68,  72,  78,  81,  83,  84,  85,  86,  87,  89,  90,  91,  92,  93,
+     99, 108, 109, 110, 111, 112, 113, 117, 135, 136, 137, 162, 181, 189,   0,   1,
+      2,   3,   4,   6,   7,   9,  12,  18,  21,  24,  26,  27,  29,  30,  33,  36,
+     39,  54,  55,  57,  63,  81,  84,  85,  90,  99, 108, 135, 218,  81,  82,  84,
+     87,  90,  91, 111, 117, 135, 162, 163, 165, 168, 171, 186, 189, 216, 222, 225,
+      9,  10,  12,  13,  15,  16,  17,  18,  19,  21,  24,  25,  26,  36,  37,  39,
+     40,  42,  44,  45,  63,  69,  72,  75,  78,  90,  93,  99, 100, 105, 107, 117,
+    171, 177, 198, 225, 240,  90,  93,  94,  95,  99, 101, 105, 107, 126, 144, 171,
+    172, 174, 177, 179, 180, 183, 184, 207, 225, 234, 237,  14,  95, 104, 149,   0,
+      1,   2,   3,   4,   5,   9,  10,  11,  18,  21,  27,  28,  36,  45,  54,  63,
+     99, 108, 186, 188, 240, 170,   3,   6,   7,   8,  12,  15,  16,  24,  25,  30,
+     31,  33,  35,  42,  57,  59,  84,  87,  88, 162, 163, 164, 165, 166, 168, 169,
+    171, 172, 180, 181, 182, 189, 190, 192, 207, 219, 222, 234, 108, 109, 111, 112,
+    126, 132, 135, 138, 144, 147, 189, 190, 191, 192, 198, 207, 208, 216, 218, 219,
+     81,  82,  84,  90,  99, 162, 163, 165, 166, 168, 174, 216, 219,  39,  41,  42,
+     43,  48,  50,  51,  66,  70,  75,  77,  78, 120, 123, 124, 129, 132, 147, 159,
+    201, 203, 213, 240,  93,  96,  98, 123, 174, 175, 183, 186,  95,  98, 104, 125,
+    188,   6,   7,   8,  24,  33,  87, 168,   0,   2,   3,   6,   9,  12,  15,  27,
+     56,  60,  81, 162, 164, 171, 216,  51,  75, 159, 101, 209,  51,  78,   0,   1,
+      2,   3,  27,  54,  57, 159,   0,   2,   3,   4,   5,   6,   8,   9,  11,  12,
+     13,  18,  27,  29,  30,  33,  36,  39,  81,  82,  84,  90, 108, 114, 117, 162,
+    163, 164, 165, 166, 168, 170, 171, 172, 173, 174, 180, 186, 189, 191, 198, 201,
+      0,   2,   3,   4,   6,   8,   9,  11,  27,  28,  30,  33,  36,  45,  81,  90,
+    162, 164, 165, 168, 171, 174, 198,   0,   1,   6,   7,   9,  10,  24,  25,  27,
+     28,  33,  34,  36,  82,  88,   1,   2,   5,   8,  14,  32,  35,  50,  83,  86,
+    188, 191, 236,   0,   1,   2,   3,   9,  18,  19,  20,  27,  28,  29,  30,  36,
+     81,  82,  84,  84,  85,  86,  93, 112, 166, 183, 192,   1,   4,  22,  85,   0,
+      1,   2,   3,   4,   6,   8,   9,  10,  11,  12,  18,  20,  21,  24,  27,  29,
+     30,  36,  39,  81,  87,  90,  92,  93,  99, 108, 117, 162, 163, 164, 165, 171,
+    174, 180,   9,  15,  18,  20,  21,  24,  45,  90,  99, 101, 126,   0,   3,   6,
+      7,   9,  18,  36, 162, 165, 180,  54,  55,  63,  72,  78, 135, 136, 141, 216,
+    234,   2,   8,  83,   0,   1,   2,   3,   4,  18,  20,  21,  27,  28,  29,  30,
+     45,  81,  84,  99,  54,  56,  57,  63, 135, 216,   0,   3,  27,  81,   0,   3,
+      6,   8,   9,  11,  33,  36,  81, 162, 164, 168, 170, 173, 198, 237,  81, 108,
+    117, 162,  74,  80, 135, 136, 137, 139, 145, 216, 218, 225,   0,   1,   3,   5,
+      6,   8,   9,  10,  12,  18,  19,  21,  24,  27,  28,  30,  36,  45,  46,  51,
+     54,  55,  63,  81,  85,  86,  91, 111, 117, 162, 163, 164, 165, 167, 168, 171,
+    172, 180, 186, 198, 207, 216, 217, 222, 225,  81,  82,  83,  84,  85,  87,  90,
+     92,  93,  99, 100, 105, 108, 135, 138, 153, 162, 164, 165, 166, 168, 170, 174,
+    186, 192, 201, 216, 234,  59, 236,  10,  11,  13,  19,  20,  22,  23,  25,  26,
+     38,  40,  47,  49,  50,  68,  74,  80,  92, 100, 101, 103, 104, 107, 172, 173,
+    179, 182, 188, 117, 126, 127, 129, 132, 144, 153, 198, 199, 201, 207, 208, 210,
+    213, 225, 234, 236, 240,   0,   2,   3,   4,   9,  12,  18,  21,  23,  27,  36,
+     45,  57,  81,  84,  86,  90, 162, 216, 234,   9,  11,  12,  18,  21,  36,  39,
+     90, 171, 173, 180, 182, 198, 197,   0,   1,   2,   3,   4,   5,   6,  18,  19,
+     28,  30,  39,  45,  81,  84,  90, 165, 180, 207, 108, 111, 117, 189, 192, 193,
+    207, 208, 216, 219, 222, 234, 224,   0,   1,   6,   7,   9,  18,  27,  28,  81,
+     82, 162, 189,   4,   8,  13,  14,  17, 163, 164, 170,  34,  35, 224,   0,   1,
+      3,   4,   6,  12,  55,  81,  84,  87,  93, 135, 136,  81,  90, 135, 162, 171,
+    189, 192, 216,   0,   1,   9,  28,  81, 163,  50,  53,  80, 158,  28,  37,  55,
+     58,   4,   5,   7,   8,  14,  25,  32,  34,  41,  59,  89, 163, 164, 166, 167,
+    169, 170, 172, 173, 176, 181, 182, 188, 190, 193, 196, 197, 200, 208, 209, 218,
+    221, 236,   1,   2,   5,   8,  10,  11,  13,  20,  28,  29,  31,  35,  56,  83,
+     86,  89, 101, 110,  35, 218, 221,  36,  37,  39,  40,  45,  46,  48,  51,  63,
+     72,  75,  78, 117, 126, 127, 129, 153, 155, 237,  14,  17,  22,  23,  26,  41,
+     44,  49,  50,  80, 104, 107, 179, 192, 198, 207, 216, 218, 219, 221, 226, 234,
+      0,   2,   3,  27,  81,  82,  84,  90, 108, 117, 162, 163, 164, 168, 171, 180,
+    181, 182, 186, 189, 207, 120, 129, 201, 240,  36,  42,  45,  46,  51,  63,  72,
+    117, 121, 196,  81,  85,  86, 135, 163, 164, 168, 171, 177, 189, 198, 216, 213,
+      0,   1,   6,   9,  18,  27,  28,  33,  36,  81, 162, 163, 164, 168, 169, 171,
+    180, 195,  83,  86,  92, 110, 163, 164, 169, 172, 191, 199,   2,   5,  20, 164,
+    182,  11,  37, 172, 173, 175, 199,   9,  10,  12,  15,  18,  19,  24,  26,  36,
+     39,  90, 117, 148, 229, 140, 224,   1,   2,  10,  20,  29,  82,   3,   4,  12,
+     13,  30,  87, 165, 192,  80,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+     10,  11,  12,  14,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+     30,  36,  38,  39,  45,  54,  55,  57,  63,  66,  72,  74,  75,  81,  82,  83,
+     84,  90,  92,  93,  99, 102, 108, 110, 111, 117, 126, 135, 138,   0,   1,   2,
+      3,   4,   6,   7,   8,   9,  10,  13,  15,  16,  27,  28,  29,  30,  33,  35,
+     36,  37,  45,  62,  63,  81,  82,  84,  87,  88, 108,  27,  28,  30,  33,  34,
+     36,  39,  45,  51,  54,  55,  57,  60,  78, 108, 111,   0,   1,   2,   3,   6,
+      8,   9,  11,  12,  14,  18,  27,  28,  36,  38,  54,  55,  60,  62,  63,  66,
+     81,  82,  83,  87,  89,  90,  93, 108, 135,  27,  28,  30,  35,  54,  55,  60,
+     63,  69, 108, 111, 135, 198, 199, 204, 207, 213, 234,   0,   1,   2,   3,   4,
+      5,   9,  10,  11,  12,  18,  21,  23,  27,  29,  45,  48,  54,  56,  57,  72,
+     81,  82,  83,  84,  86,  90,  99, 108, 110, 111, 135,   0,   1,   2,   3,   9,
+     18,  27,  29,  81,  82,  90,  99,   0,   1,   3,   9,  21,  27,  81,  82,  84,
+    108,   0,   1,   2,   3,   4,   5,   6,   7,   9,  10,  18,  19,  24,  26,  27,
+     33,  36,  54,  57,  63,  81,  82,  84,  85,  86,  87,  99, 108,   3,  12,  21,
+     30,  33,  35,  48,  84,   0,   3,   6,  18,  21,  57,  81,  99,   3,   4,   5,
+      6,   7,   8,  12,  24,  57,  60,  62,  84,  87,  89, 141,  36,  45,  47,  72,
+    126,   0,   1,   3,   9,  54,   6,  15,  33,  34,  35,  42,  87, 114, 224,   0,
+      1,   2,   6,   8,   9,  15,  16,  27,  29,  30,  36,  54,  62,  81,  82,  87,
+     96,   0,   6,   8,   9,  27,  81,   3,   6,   9,  10,  15,  63,  90,   1,   2,
+     11,  82,   0,   1,   2,   3,   9,  27,  54,  56,  81,  83,  84, 135,   9,  11,
+     12,  36,  90,  19,  22,  73, 100,   9,  10,  11,  12,  18,  19,  20,  21,  24,
+     25,  26,  36,  37,  38,  39,  45,  46,  63,  64,  65,  66,  72,  75,  90,  93,
+     99, 100, 101, 106, 117, 120, 126, 153,   3,   5,   6,   8,  15,  24,  26,  30,
+     31,  32,  60,  84,  87, 111,  27,  28,  36,  45,  54,  72, 108,   9,  15,  18,
+     20,  21,  45,  63,  72,  74,  75,  78,  90,  99, 101, 102, 153,  37,  38,  40,
+     46,  64, 118, 145, 189, 190, 198, 216,  33,  34,  45,  47,  51,  57,  60,  72,
+     74,  75,  78,  80, 126, 153, 155, 156, 220, 224,  27,  28,  36,  54, 108,  37,
+     43,  46,  64,  73,  74,  76, 127, 154, 203,   0,   1,   2,   6,   9,  11,  27,
+     36,  81,  82,  81,  84, 108, 188, 188,   0,   1,   2,   3,   4,   5,   6,   8,
+      9,  10,  11,  12,  14,  18,  24,  27,  29,  36,  39,  81,  83,  84,  90,  92,
+     93, 108, 117,   0,   2,   3,   6,   8,   9,  15,  27,  33,  81,  90,   0,   1,
+      6,  18,  24,  27,  81,  99, 108,   0,   1,   6,   9,  18,  27,  81, 108,   0,
+      1,   2,   9,  10,  18,  20,  27,  29,  36,  81,  82,  99,   0,   2,   9,  27,
+     81,  82,  85, 100, 109,   0,   1,   3,   6,   7,   9,  18,  27,  33,  36,  90,
+     99,  54,  72, 135, 223,   3,   4,  21,  30,   0,   2,   6,   9,  15,  27,  81,
+     83,  90, 108, 236,   0,   2,   9,  27,  81,   3,   6,   7,  12,  18,  21,  28,
+     33,  34,  35,  39,  42,  60,  62,  69,  72,  83,  87,  88,  89, 114, 234,   5,
+      6,   7,   8,  12,  15,  30,  57,  60,   3,   6,  12,  24,  30,  39, 102, 165,
+      2,   4,  10,  13,  28,  37,  40,  43,  47,  58,  91, 118, 236,  36,  17,  26,
+    188,   6,   7,   8,  17,  24,  26,  42,  44,  60,  62,  78,  87,  89,  96, 114,
+    125, 169, 170, 213,   1,   2,   3,   5,  10,  84, 171,   1,   3,   4,  18,  21,
+     72, 162, 180,   3,   4,  30,  33,  72, 162, 163, 164, 165, 171, 172, 180, 182,
+    189, 216, 218, 234,   0,   3,   6,   9,  27,  30, 162, 165, 171,  35,  62,  84,
+     87,  93, 111, 123, 195, 240, 240,  45,  48, 207, 234,  51, 240, 240, 188,   3,
+      6,   7,  12,  14,  26,  39,  75,  78,  80,  93, 174,   9,  14,  24,  26,  51,
+      1,   4,  10,  55,  82, 135, 136, 216,   3,   4,  13,  18,  21,  23,  30,  45,
+     48,  50,  84, 111, 180, 182, 184, 240,  26,  53, 188,   8,  16,  17,  43, 115,
+    170, 188, 231,  26,   3,  24,  51, 168, 169, 222, 231,  42, 231, 240,   3,   4,
+      5,  14,  39,  41, 165, 221,  26,  80, 188,   3,   6,   8,  15,  33,  80, 222,
+    224, 231, 240,  81,  83,  90, 162, 150,  11,  13,  37,  38,  94, 119, 236,  85,
+     88, 169,   7,   8,  17,  61,  62,  80,  88,  89,  97, 125,   0,   1,   3,   4,
+     12,  21,  30,  75, 188,  94, 170, 148, 224, 223, 224, 222, 217, 224,   3,   5,
+     12,  30,  84, 166, 224, 186, 188, 240, 240,  81,  83,  90, 162, 163, 164, 171,
+    122,  94, 171, 174, 177, 183, 198, 199, 201, 234, 240, 144,  88, 141, 168, 170,
+    222, 224, 240,  95, 177, 183,  27,  29,  36,  54, 117, 135, 224,   0,   2,   6,
+      8,   9,  15,  33,  35,  81,  87,  18,  27, 162, 164, 180, 189,  57, 141,  66,
+    240,  66,   1,   2,   4,  10,  82,  58, 147,   0,   3,   9,  12,  27,   0,   2,
+      9,  27, 222, 224, 228, 240, 222,  81,  84, 108, 170,  80,   9,  15,  24,  36,
+     45,  96, 224, 197,  26,  71,  27,  28,  31,  54,  61, 137, 216,   4,   5,   8,
+     19,  31,  32,  34,  35,  49,  62,  74,  80,  89,  98, 100, 167, 224,   2,   5,
+      7,   8,  83,  86, 164, 173,  22, 106,   0,   4,   5,   7,   8,   9,  10,  27,
+    224, 225,   5,   6,   7,   8,  30,  60,  62,  88,  99, 180, 186,  12,  15,  39,
+     42,  96, 108, 120, 135, 138, 144, 145, 147, 153, 216, 218, 219, 234, 237,   1,
+      2,  10,  13,  28, 191, 218, 113, 115, 193,  77,   2,   5,   8,  32,  18,  21,
+     45,  48, 180, 183, 207,  78, 143, 218,   3,   4,   5,  12,  13,  21,  23,  30,
+     57,  59, 189, 190, 193, 216, 217, 168, 177, 186, 224, 207, 207, 234, 177, 186,
+     61,  79,  38,  77, 158,  43,  93, 143, 219, 237,  40, 175, 163, 164, 180, 182,
+    218, 221, 227, 163, 166, 190, 218, 218,  74,   6,   7,   8,  24,  33,  60,  62,
+     80,  87,  89, 224,  24,  26,  43,  78,  96, 105, 123, 177, 186, 188, 213,  17,
+     11,  13,  58,  63,  90,  91, 144, 216,  51, 222, 224,  78, 116,   9,  10,  18,
+     20,  45,  63, 234,  96, 159,  98, 132,  62, 124,  42, 162, 163, 164, 171, 180,
+    182, 189, 192, 201, 216, 225,  27,  28,  29,  30,  54,  56, 108, 111,  28,  31,
+     55,   7,   8,  17,  26,  62,   1,   4,  82,   1,   4,  10,   9,  10,  12,  18,
+     20,  90,  93,  99, 240, 224,  15,  24,  26,  42,  53,  69,  71, 186, 188, 204,
+      0,   2,   3,  27,  81,  51,  69,  69, 123,   0,   2,   9,  81, 240, 222,  15,
+     16,  24,  42, 188,   2,   3,   5,   6,  54,  56, 216, 218,   9,  18,  21,  24,
+     54,  72,  74,  78,  99, 102, 126, 153, 180,  27,  29,  36,  54,  57,  62, 171,
+     26, 188,  88, 114,  62, 116,  39,  48,  75, 212,  45,  46,  47,  72,  78,  80,
+    126, 127, 207, 209,  80, 153, 108, 189, 191, 198, 225,  96, 120, 147, 159,  80,
+     13,  26,  18,  72,  99, 180,  44, 240,  26, 240,   3,   6,   8,  33,  39, 123,
+    240, 240, 238, 165, 204, 209, 240, 185,  26,  50, 188,  36,  37,  38,  45,  46,
+     47,  48,  53,  65,  72,  78,  80, 128, 202,   0,  27,  28,  54,  63,  81, 236,
+     51,  39,  52,  66,  69, 237, 112, 221, 150, 240, 100, 104,  82,  83,  91, 109,
+    163, 217, 158, 188, 120, 193, 220, 224, 208,  18,  47, 180, 182, 207,  47,  74,
+    145, 119, 122,  28,  45,  72,  74,  75,  91,  92, 236, 240,   3,   5,  30,  39,
+    205,  26,   2,   4,   5,  20,  55,  83, 137, 140, 218,   1,  10,  82, 195,   1,
+      4,  28,  88, 179, 188, 240,  24, 234, 132,  24, 132,  51, 240, 105,  26, 186,
+    213, 234, 240,  27,  30,  54,   0,   2,   3,  54,  81,  83, 188, 240, 240, 188,
+     26,  72, 153, 234, 188, 240, 240,   1,   4,  10,  28,  31,  26, 186, 188, 213,
+     51, 213, 213, 188, 188,   9,  11,  12,  18,  21,  22,  24,  36,  39, 100, 101,
+    102, 126, 162, 165, 168, 170, 171, 174, 180, 182, 201, 136, 209, 236,  14, 170,
+    173,  27,  28,  29,  30,  33,  35,  39,  54,  57,  66, 110, 216, 117, 118, 126,
+    234,  17,  26,  15,  16,  24,  69,  96,  81,  84,  90,   7,  24, 166, 184,  13,
+     40,  94,  95, 240, 117, 207, 234, 240, 179,   9,  13,  36,  37,  40,  90, 117,
+    118,   1,   9,  10,  28,  15,  50,  75,  96, 113, 122, 120, 125,  80,  58,  61,
+    217, 220,   0,   3,  27,  36,  81,  78, 240, 231, 159,   0,  27,  30, 108, 240,
+     90,  93,  96,  99, 100, 171, 172, 173, 174, 176, 180, 182, 183, 186, 201, 207,
+     62,  27,  54,  72, 109, 111, 114, 135, 200,   4,   5,   7,  19,  21,  45, 165,
+    180, 207, 102, 103, 237, 240, 118, 172, 188, 201,   0,   2,   9,  27, 171, 173,
+    174, 198,   1,   5,  11,  29,  32,  55,  82, 163, 164, 172,  94,  96, 123, 129,
+    147, 174, 102, 222,  88, 112, 142, 166, 167, 237, 121,  58, 237, 107, 143, 199,
+     49, 224, 170,  80, 116,  35, 188, 164, 167, 179, 182, 224,  11,  17,  63,  66,
+     72,  91, 144,   0,   1,   2,   6,  18,  27,  54,  81, 108, 112,  89, 115, 188,
+      3,   6,   8,  15,  57,  69,  87,  96, 111, 222, 224, 183, 188, 210,  30,  33,
+     42,  57, 195, 196, 222,   6,   7,   8,  60,  87, 141, 188, 117, 126, 145, 225,
+    228, 240, 120, 240, 150, 231, 138, 221,  75,  78,  27,  28,  29,  30,  54,  55,
+     57, 189, 129, 150, 228, 231, 240,  75, 240, 240, 190, 123, 240,   3,   6,   8,
+     15,  30,  84,  28,  37,  40, 109, 199, 240, 183, 237, 236,  87, 169, 177, 186,
+    240, 222, 240, 188,  10,  13,  91,  69,  48,  66,  80, 207,   0,   9,  18,  57,
+     81, 135,  26, 188,  62, 224,  26,  26, 107, 236, 240,   0,   1,   2,   5,   9,
+     18,  20,  54,  72,  81,  83,  93, 170, 188,  27,  28,  29,  54, 135, 169, 197,
+    196, 219,   0,   2,   3,   6,   9,  11,  27,  54,  81,  90, 240, 193, 209, 217,
+    229, 188, 199,  44,  81,  84, 108, 165, 171, 174, 198, 240, 148,   0,   3,  81,
+    234, 236,  74, 191,   0,   3,  81,   9,  18,  21,  45,  51, 180, 182, 207,  77,
+     80,   3,   4,  12,  21,  30,  48, 183,  71,   3,   4,   5,  12,  14,  86,  21,
+     75, 102,  26, 136, 137, 218, 224,  10,  14,  37,  91,   4,  28,  37,  82, 163,
+     80, 231, 187, 188,   1,  10,  82, 236, 195, 180, 186, 188, 234, 240,  23,  53,
+     75, 240, 186, 240,  25,  76, 188,  27,  30,  54,  56,  57, 108, 188, 187, 188,
+    186, 240,   0,   1,   8,   9,  11,  12,  18,  20,  21,  90,  92,  93, 170,  62,
+     12,  21,  23,  39,  41,  93,  94,  96, 123, 174, 186, 204, 144, 218, 224,  62,
+    139, 226,   0,   1,   3,   6,   9,  27,  82, 162, 164, 138, 219, 228, 141, 222,
+    231,   9,  18,  36,  69,  78,  80, 231, 240,  61, 223, 224,  76,   0,   2,   6,
+      7,   8,   9,  15,  16,  18,  24,  27,  33,  34,  36,  42,  81,  87,  89, 105,
+    108, 114,   4,  13,  31,  85,  10,  13,  37,  91, 217, 220, 223, 224, 226, 232,
+    236, 240, 224,   0,   1,   2,   9,  18,  27,  36, 240, 222, 223, 240,   9,  18,
+     20,  21,  36, 240,   0,   3,   6,   8,   9,  27,  45,   3,   6,   8,  15,  33,
+    216, 219, 231, 224, 219, 144, 227, 237, 240, 240, 234, 240, 216, 219, 225,  56,
+     62,   0,   3,  45,  81,  62, 224, 218, 224, 224,  62, 227, 236,  54,  55,  56,
+     72,  74,  75, 135, 137, 153, 218, 236, 237, 141, 143, 150, 222, 224, 231,  55,
+     58, 217, 220, 235,  69, 231,   0,   1,  27,  81, 162,   1,   4,  28,  82,  54,
+     55,  56,  63,  72, 135,  71,  80,  71,  80,  62, 224,  71,   1, 163, 166, 190,
+      3,   5,  12,  84,   0,   2,   3,   8,   9,  10,  11,  12,  13,  18,  36,  38,
+     39,  81,  84,  90,  92,  93, 117, 164, 234, 236, 237,  11,  38,  83,  92,  82,
+     83,  85,  88,  89,  91,  92, 100, 109, 110, 115, 116,   9,  12,  13,  36,  90,
+      1,   2,  10,  19,  28,  29,  37, 240, 162, 163, 164, 171, 180, 189,  78, 235,
+    240,  80, 144, 146, 153, 225, 228, 237, 240, 150, 228, 229, 231, 237, 240,   0,
+      2,   3,   6,   8,  11,  18,  33,  81, 108, 240,  54,  55,  56,  57,  63, 135,
+    237, 240,  57,  60,  66,  78,  80, 138, 238,   0,   3,  27,  81,   4,   5,  13,
+     85, 138, 219, 222, 234, 236, 237, 240,   0,   2,   3,  27,  81, 235,   9,  36,
+     39, 117, 224, 236,  60,  61,  62,  78,  80, 141, 222, 223, 240,  60,  62,  69,
+    222, 224, 142, 223, 224, 159, 159, 231, 232, 240, 224,   9,  11,  12,  36,  90,
+    224,  54,  63,  66, 144,  80,  80,   0,   9,  11,  12,  36,  81,  84, 108,  78,
+      0,   2,   3,  27,  81,  54,  56,  63, 135,   2,  10,  11,  20,  26,  50,  62,
+    173, 218, 224, 236,  83,  86,  95, 218,   9,  11,  90, 117, 126,  17,  35,  88,
+     89,  94,  99, 186, 187, 201, 204,  92,  19,  20,  23,  26,  53,   0,   1,   3,
+      6,  12,  27, 162, 234,  25, 188,   8,  26, 120, 209, 228, 231, 236,  77,  80,
+    158,  62,  74,  80, 218, 224, 226, 227, 236,  94,   1,   2,   4,   5,  11,  14,
+     31,  47,  74,  82,  83,  91,  92, 109,   0,   9,  18,  21,  81,  90, 236,  27,
+     54,  56,  60,  63,   0,   3,   9,  30,  81, 108, 224,   0,   1,   9,  27,  36,
+     45,  81, 108,   0,   1,  10,  27,  30,  90, 162,  62, 224,   0,   2,   6,   9,
+     27, 120,   0,   3,  81,  80,  80,  36,  42,  45,  51,  63, 117, 126, 153, 207,
+    213,   0,   9,  18,  21,  99,   0,   1,   6,  81, 236, 236,   8,  22,  26, 234,
+     95, 101, 128, 164,  21,   1,   4,  10,  31,  82, 163, 217, 223, 163, 167, 190,
+     26, 107, 188,  26,  53, 107,  47,  78, 129, 159,   0,   1,   9,  12,  27, 162,
+     18,  21,  45, 218, 182, 191, 217,  27,  28,  30,  36,  39,  54, 189,  80, 218,
+    236, 234,  15,  16,  70, 171, 172, 174, 180, 216, 234, 236, 188, 132, 240, 195,
+    187, 231,  48, 120, 210, 240,  37,  80,  73, 155, 235,  80,   0,   9,  27, 236,
+    224, 240,  38,  80, 129,   1,   4,  11, 163,  80,  80, 236, 213,  80,  80, 240,
+     80,  45,  72,   0,   6,  27,  81,  82,  15,  24,  51,  52, 105,   0,   3,   9,
+     12,  27,  96,   0,   2,   3,   5,   9,  12,  24,  27,  36,  81,  84, 108,   9,
+     12,  18,  45,  99, 100, 105, 135, 236, 197, 181, 188, 234,   0,   6,   7,  30,
+     60,  81,  82, 188, 188, 236,   9,  36,  90,  81, 162, 168, 177, 189,  98, 101,
+    236,  95, 201, 162, 163, 165, 216, 237, 240,   0,  27,  81, 146,  40,  58, 116,
+    140,  95, 101, 181, 182,  18,  45,  72,  99, 188, 218, 236,  26,  45,  99,  27,
+     28,  36, 108, 113, 116,  80, 180, 183, 207, 207, 210, 234, 240, 237, 208, 236,
+    236, 236, 224, 240,   0,   3,  27,  56,  74, 137, 236, 240,  80, 136, 221, 224,
+      2,  10,  11,  20,  26,  29,  47,   9,  12,  36,  90,   0,   3,  27, 234, 240,
+     81,  90, 108,  62, 240, 224,   3,   4,   6,  30,  87, 236, 235, 236, 224, 234,
+    240, 159, 240, 220, 240,   1,   4,  28,  82,  74, 236,   4,   6,   8,  12,  13,
+     15,  26,  27,  28,  29,  30,  36,  37,  84,  87, 108, 114, 144,   1,  10,  13,
+     19,  28,  29,  40,  47,  82,  85, 100, 103, 128,   0,  18,  45,  54, 135,   0,
+      2,   6,   7,   8,   9,  10,  11,  15,  18,  81,  87,  90, 191, 217, 224, 236,
+    182, 236,   1,  28,  29,  31,  55,  83, 109, 110, 162, 164, 165, 189, 188,   3,
+      6,   7,   8,  12,  15,  21,  26,  33,  39,  78,  80,  84,  87,  89, 105, 114,
+    192, 222, 224, 170, 197,   9,  11,  12,  14,  15,  18,  19,  20,  24,  36,  39,
+     45,  90,  99, 117,   3,  57,  84,   3,   4,   6,   8,  12,  13,  15,  33,  40,
+     60,  62,  69,  84, 164, 165, 168, 170, 195,  27,  30,  54, 108,  27,  54,  56,
+     63, 144, 162, 163, 164, 165, 167, 189, 190, 192, 216, 218,  30,  39, 111,   0,
+      9,  54,  81,   0,   3,   6,  15,  24,  27,  29,  30,  39,  54,  63,  87, 108,
+    110, 117, 172, 236,   0,   1,   2,   3,   6,   9,  10,  82,  90, 188,   3,   4,
+      7,  57, 219, 224, 225, 227, 234, 240,  27,  30,  36,  39, 108,   3,   6,   8,
+     30,  33,  87, 236, 195, 201, 202, 216, 218, 222, 224, 225, 231, 234, 236, 236,
+      1,   2,   4,  28,  29,  31,  82, 109, 162, 163, 164, 166, 189, 190, 210, 231,
+    240,   0,   2,  27,  81,   0,   2,   6,   8,   9,  15,  33,  54, 236,   0,   1,
+      2,   3,  27,  81, 184, 188, 163, 165, 171, 172, 173, 174, 182, 186, 188, 198,
+    201, 207, 209,  10,  11,  13,  19,  20,  91,   9,  10,  18,  90,   1,   2,   5,
+      8,  29,  56,  82,  83, 162, 165, 189,  63,  65,  72,  74, 117, 144, 153,   0,
+      2,   9,  81, 224, 218, 224, 171, 172, 173, 174, 177, 182, 185, 198, 199, 201,
+    236, 240,   0,   3,  27,  18,  36,  45, 117, 197, 202, 224, 229, 162, 165, 168,
+    177, 186, 216, 217, 223, 188, 188, 170, 197, 224, 179, 188,  10,  11,  13,  19,
+     20,  25,  26,  37,  73,  80,  91, 100, 101, 103, 107, 154,   0,   1,   9,  27,
+     81, 182, 198, 207, 228, 236, 240,   0,   1,   2,   3,   9,  27,  36,  54,  56,
+      0,   1,   9,  54,  81, 192, 193, 195, 196, 204, 222, 223, 231, 190, 193, 217,
+    226, 204, 213, 214, 237, 240, 206,   2,   5,   8,  83, 166, 175, 224, 193, 234,
+    240, 231, 240, 199, 209, 212, 236,   3,   5,  12,  84, 204, 163, 190, 193, 199,
+    208, 176,  10,  19,  20,  26,  46,  47,  91, 100,   1,   4,  82, 235,   1,   2,
+      4,  28,   0,   1,   2,   3,   4,   9,  18,  27,  36,  81,  82,  83,  84, 108,
+    110, 224,   0,   1,   2,   3,  12,  18,  27,  56,  81, 108, 135, 180, 181, 216,
+    234, 222, 186,  10,  11,  13,  37,  91,   0,   1,   2,   9,  28,  81,  82, 188,
+      0,   3,   9,  27,  81, 168, 170, 177, 195, 170, 224, 240, 224, 163, 164, 166,
+    190, 224,   9,  11,  18,  72,  90,  92,   1,   4,  82, 240, 223, 224,  10,  13,
+     22,  37, 197,  12,  21,  24,  26,  51,  52,  93, 120, 162, 163, 164, 171, 173,
+    218, 189, 190, 198, 216,   0,   1,   3,  21,  27,  54,  81, 170, 224, 208, 240,
+      1,   2,  10,  28,  82, 188, 240, 192, 184, 214,  27,  28,  36, 108, 193,  27,
+     54, 108, 188,   0,   9,  11,  63,  90, 236,   0,   1,   2,   3,   5,   9,  10,
+     11,  12,  81,  82,  83,  84,  90, 163, 166, 172, 217, 214, 231, 240, 213, 240,
+    240, 236, 170, 224, 213, 240,   6,   7,   8,  15,  16,  33,  60,  84,  87, 188,
+      0,   1,   3,   5,  81,  84, 188,  27,  28,  30,  54, 108,   0,   2,   9,  81,
+     82, 135, 237,   0,   3,   9,  81, 188, 240,  30,  31,  32,  39,  40,  57,  59,
+    111, 112, 240,   6,   7,  15, 187, 188, 240,   0,   2,   3,  27,  81,  36,  38,
+     39, 117,   0,   1,   2,   3,   4,  10,  12,  18,  27,  28,  30,  81,  84,  99,
+    101,   3,   6,   7,   8,  15,  16,  17,  30,  31,  84,  87,  88,  93, 111, 120,
+    234,  27,  36, 108, 186, 188, 240, 177, 213, 231, 240,   3,   6,   8,  15,  57,
+     60,  87,   3,  12,  84,   6,   8,  21,  24,  33,  87,  81,  84,  90, 108, 111,
+      1,   2,   4,  13,  20,  28,  37,  55, 166, 167, 169, 170, 175, 178, 179, 196,
+    240,  30,  39,  57,  66, 111, 138, 162, 163, 164, 165, 166, 167, 173, 189, 192,
+      9,  18,  36,  27,  29,  36, 108, 193, 197, 224, 202, 197, 224, 194, 167, 169,
+    240, 183, 186, 187, 213,  10,  64,  91,   1,   2,  10,  28,  56,  82, 227, 236,
+      1,   4,  28, 220, 240, 214,  10,  13,  91, 240, 170, 197, 162, 163, 164, 171,
+    189, 198, 216,   0,   3,   9,  81, 240,   0,   1,   2,   3,   6,  10,  28,  27,
+     29,  36, 108, 240,  45,  48, 126,   1,   2,  10,  28,  82,   0,   3,  27,  54,
+     81, 240, 188, 188,   0,   1,   3,   9,  11,  12,  24,  27,  36,  38,  39,  81,
+     82,  84,  90,  92,  93, 117, 225, 234, 240, 218, 171, 172, 177, 178, 180, 181,
+    186, 198, 207, 213, 236, 162, 164, 165, 167, 189, 191, 198, 162, 164, 171, 180,
+    182, 189, 191,  81,  84, 108, 177, 183, 186, 188, 204, 213, 162, 171, 172, 198,
+    240,  82,  83,  89,  99, 105, 107, 132,  10,  11,  13,  37,  91,   9,  10,  15,
+     16,  18,  24,  36,  42,  90, 226, 236,   1,   2,   4,  10,  28, 226, 232, 234,
+    240, 162, 164, 171, 189, 236,  54,  57,  63, 135, 218, 224,  81,  99, 108, 224,
+      0,   1,   3,  27, 224, 162, 163, 164, 165, 189, 190, 191, 192, 168, 170, 177,
+    195,   1,   4,  28,  82,  63,  64,  72, 144,  87,  89,  96, 114, 163, 164, 182,
+    190, 191,   0,   1,  18,  27,   3,   5,  12,  84, 224,   3,   4,  21,  30, 232,
+    237, 224,  36,  37,  45, 117,  81,  84, 108, 162, 165, 189, 234, 240, 236,   1,
+      2,  10,  28, 162, 163, 164, 171, 189,  60,  62,  69, 141,  80, 134, 168, 169,
+    222, 240, 224, 236, 169, 170,  43, 240, 240, 240, 240, 107, 240, 236, 168, 240,
+    240, 240,  16, 186, 240,   0,   3,  54,  35, 188,  39,  71, 240, 168, 169, 170,
+    177, 186, 188, 222, 240, 240,  30,  57, 111, 240, 170,   0,   3,  81, 240, 240,
+    177, 213,  80,  26,  80, 158, 240,  78,  80,   1,   2,  10,  28,   0,   2,   9,
+     27,   9,  12,  63, 240, 222, 188,   0,   3,  27, 240, 240, 222, 240, 240, 240,
+    240,   1,   4,  82, 220, 222, 240, 236,  69,   3,   4,  84, 240, 132, 116, 224,
+     15,  17, 186, 105, 186, 188,   6,   7,   8,  24,  34, 222, 240,  28,  29,  37,
+    109, 170, 186,   1,   4,  10, 222, 240,  43, 240, 240, 240,  78,  80,   0,   9,
+     11,  36,  80, 163, 240,  26, 188,  87,  24, 240,  26,  72,  80,  26,  51,  26,
+    188, 177, 180, 234, 240, 240, 213, 186, 240, 224, 240, 240,  51, 180, 182, 240,
+     27,  30,  36,  54, 188, 224, 186, 188, 188, 188, 240, 222, 240,  72, 153,  70,
+    224, 224,   1,  11,  19,  20,  28,  37,  82, 109,   0,   1,   2,   9,  10,  27,
+     36,  81,  90, 108, 240,   9,  12,  36, 231, 237, 231, 240, 224, 240, 224, 222,
+    223, 224, 240,   1,   2,   4,  28, 224, 223, 224, 224, 237, 240, 219, 240, 224,
+    224, 231, 240,  96,  97,  98, 105, 123, 125, 240,  82,  85, 109,  82,  85, 109,
+     80, 224, 224, 231, 232, 240, 141, 216, 218, 219, 221, 222, 223, 224, 225, 218,
+    224,   0,   1,   2,  18,  27,  81,   9,  12,  36, 142, 224,  76, 142, 223, 224,
+    228, 224, 224, 240, 222, 224, 240,  54,  55,  72,   2,  18,  20,  99, 223, 219,
+    224, 224, 220, 236, 142, 224, 237, 223, 224, 224, 240, 141, 222, 223, 224, 240,
+    217, 220, 226, 224,  79,  80, 240, 224, 224, 240, 240, 240,  80, 221,   0,   3,
+     81, 188, 240,   0,   3,  81, 240, 206, 182,  26,  80,  80, 171, 180, 198, 185,
+    224, 224, 188,   0,   3,  27, 170, 165, 240, 176, 166, 240, 170,   0,   2,   9,
+     81, 234, 176, 188,   6,   8,  15,  33, 171, 173, 174, 198, 225, 231, 213, 240,
+    168, 169, 240, 240, 224, 224, 223,  27,  29,  36,  54, 108, 224,   0,   3,  81,
+    224,  27,  28,  29,  36,  37,  54, 108, 240, 240, 178, 188, 234, 186, 186, 188,
+    240, 240,  81,  84, 108, 240, 186, 187, 188, 240, 188,   0,   3,  27, 188,   1,
+      2,   4,  28, 187, 189, 216, 218, 225, 162, 165, 189, 240,  81,  84, 108, 232,
+      0,   3,  27,   1,   4,  28,  82, 240, 187, 162, 164, 171, 189, 162, 164, 171,
+     91, 100, 101, 127,  27,  30, 108,   0,   3,   9,  27, 240, 240, 236, 240,  18,
+     21,  99, 222,   0,   3,  27, 240, 209, 216, 217, 224, 182, 185, 236, 188,  24,
+     26,  80, 105, 107, 240, 188, 188, 240, 240, 188,   8,  15,  16,  24,  60,  78,
+      0,   2,   9,  81, 170, 170, 195, 224, 240, 177, 186, 188, 222, 240, 188, 224,
+    178, 224, 188, 224,   0,   2,   3, 240, 222, 240, 240, 240, 170, 188, 240, 188,
+    240, 188, 188, 214, 188, 188, 240, 188, 188, 240, 186, 240, 188, 168, 169, 162,
+    164, 171, 224, 223, 224, 162, 165, 171, 186, 240, 240, 237, 240, 162, 164, 165,
+    189, 162, 164, 171, 189, 188, 163, 164, 166, 190, 240, 240, 224, 240, 240, 188,
+    186, 240, 240, 240, 165, 167, 174, 192, 216, 217, 222, 223, 240,   0,   2,  18,
+     81, 162, 180, 189, 224, 231, 234, 224, 218, 220, 236, 162, 180, 189, 218, 224,
+      1,  82,  83,  91, 109, 223, 240, 222, 224, 231, 240, 224, 224, 162, 165, 189,
+      0,   9,  27,  81, 224, 240,   9,  36,  90,   9,  18,  20,  45, 218, 236, 162,
+    165, 189, 234, 240, 224,  60,  62,  78,  80, 141, 143,   3,   5,  30,  84,   3,
+      4,  21,  84,   6,   7,   8,  15,  24,  33,   3,   5,  12,  21,  84, 232, 240,
+    224,  90,  91,  93, 117, 171, 173, 174, 198, 240,   1,   4,  28,  82, 240, 240,
+    169, 240, 240, 217, 227, 222,   9,  18,  90, 224, 222, 224, 240, 240, 224, 217,
+    224, 217, 224, 240, 231,   1,   4,  28, 240, 213, 240, 240, 188, 162, 165, 189,
+    240, 240, 240, 224, 224, 224, 240, 224,  12,  14,  39,  93, 162, 165, 189, 224,
+      6,   8,  15,  24,  26,  87,  89, 224, 240, 231, 240, 224, 240, 224,
+};
+
+const uint32_t StrategyTables_targets[6270] =
+{
+    0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007, 0x00000008,
+    0x00000009, 0x0000000A, 0x0000000B, 0x0000000C, 0x0000000D, 0x0000000E, 0x0000000F, 0x00000010,
+    0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017, 0x00000018,
+    0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F, 0x00000020,
+    0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,
+    0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F, 0x00000030,
+    0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038,
+    0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F, 0x00000040,
+    0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x8030C8B4, 0x8140C8A4, 0x00000046,
+    0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x81478674, 0x0000004B, 0x0000004C, 0x0000004D,
+    0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x81490668, 0x00000053, 0x8130D332,
+    0x00000054, 0x00000055, 0x8147CA6F, 0x00000056, 0x00000057, 0x00000058, 0x8140CA69, 0x00000059,
+    0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x81428665, 0x0000005E, 0x0000005F, 0x8140CE85,
+    0x00000060, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x8142CA65, 0x8162CA61,
+    0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x8019CCB4, 0x0000006A, 0x8130D0A4, 0x0000006B,
+    0x0000006C, 0x0000006D, 0x8019D0B2, 0x0000006E, 0x8140CCB2, 0x0000006F, 0x00000070, 0x00000071,
+    0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+    0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F, 0x00000080, 0x00000081,
+    0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087, 0x00000088, 0x00000089,
+    0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x808095B3, 0x0000008F, 0x00000090,
+    0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097, 0x00000098,
+    0x00000099, 0x0000009A, 0x0000009B, 0x801750B3, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x8124D0B3, 0x000000A0, 0x000000A1, 0x000000A2, 0x8120D0B3, 0x000000A3, 0x000000A4, 0x8011C8B3,
+    0x000000A5, 0x000000A6, 0x000000A7, 0x000000A8, 0x000000A9, 0x000000AA, 0x000000AB, 0x000000AC,
+    0x000000AD, 0x000000AE, 0x000000AF, 0x000000B0, 0x000000B1, 0x000000B2, 0x000000B3, 0x80343EB8,
+    0x8087AEAD, 0x8037E615, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7, 0x000000B8, 0x000000B9,
+    0x000000BA, 0x000000BB, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF, 0x000000C0, 0x000000C1,
+    0x000000C2, 0x80743EAC, 0x80D79EAC, 0x80C78EAD, 0x000000C3, 0x8106546B, 0x000000C4, 0x807655EE,
+    0x80C7D4E8, 0x000000C5, 0x8091A599, 0x000000C6, 0x80B73D8C, 0x000000C7, 0x8037E599, 0x000000C8,
+    0x000000C9, 0x000000CA, 0x000000CB, 0x000000CC, 0x000000CD, 0x000000CE, 0x000000CF, 0x000000D0,
+    0x80BCD48F, 0x8047D4E8, 0x8044B08F, 0x80D7B099, 0x80CA9123, 0x000000D1, 0x80F21199, 0x000000D2,
+    0x804AB199, 0x000000D3, 0x80FB3D24, 0x000000D4, 0x803AC124, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x80CA8D24, 0x80363EA4, 0x80665524, 0x80342584, 0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB,
+    0x000000DC, 0x000000DD, 0x000000DE, 0x000000DF, 0x80663EB4, 0x000000E0, 0x806625D4, 0x000000E1,
+    0x8064D199, 0x80DAB074, 0x81573134, 0x8104B1F4, 0x000000E2, 0x8067BE99, 0x81572699, 0x80DA9A89,
+    0x000000E3, 0x80E49A99, 0x80649A99, 0x000000E4, 0x80C79A99, 0x80665699, 0x000000E5, 0x80C4BA99,
+    0x80DAB289, 0x000000E6, 0x809A0D19, 0x000000E7, 0x80649D14, 0x8087D199, 0x80C49D14, 0x000000E8,
+    0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x80649A88, 0x80363E88, 0x000000EE,
+    0x81479099, 0x000000EF, 0x000000F0, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x8147A699,
+    0x8144246B, 0x814AB923, 0x000000F5, 0x814AB9D9, 0x814455CB, 0x8144B9D9, 0x814BA5CB, 0x814425CB,
+    0x8147D4E8, 0x81449D14, 0x814424E8, 0x81443DC7, 0x814CA5C7, 0x814425C7, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x80A4A024, 0x8104B026, 0x80C4B023, 0x000000FB, 0x000000FC,
+    0x80C785B9, 0x000000FD, 0x000000FE, 0x000000FF, 0x00000100, 0x00000101, 0x00000102, 0x8044D82E,
+    0x8064B82C, 0x80B7046B, 0x8034052E, 0x8106052E, 0x00000103, 0x80163DC7, 0x00000104, 0x807A85CF,
+    0x00000105, 0x80C605CF, 0x00000106, 0x801A9038, 0x00000107, 0x801C242C, 0x8011046B, 0x8016046B,
+    0x801B052C, 0x8012342E, 0x8017382C, 0x801B242E, 0x8013852E, 0x00000108, 0x00000109, 0x8167A581,
+    0x80C79D21, 0x0000010A, 0x0000010B, 0x0000010C, 0x807A86C1, 0x0000010D, 0x80C605A1, 0x0000010E,
+    0x0000010F, 0x801725A1, 0x8077B9C1, 0x803425C1, 0x8104B9C1, 0x00000110, 0x00000111, 0x00000112,
+    0x8104D281, 0x80185199, 0x81060699, 0x8164D02C, 0x00000113, 0x801A3E19, 0x8024BE81, 0x00000114,
+    0x00000115, 0x80120614, 0x00000116, 0x80970614, 0x807485D4, 0x80125594, 0x810605D4, 0x801A2594,
+    0x81060534, 0x80113EB4, 0x80123E14, 0x00000117, 0x00000118, 0x801631F4, 0x8147C03A, 0x81448921,
+    0x8147D02C, 0x814A882C, 0x8144D02E, 0x8147B82C, 0x814B852E, 0x00000119, 0x81479039, 0x8144902C,
+    0x81478499, 0x0000011A, 0x0000011B, 0x0000011C, 0x0000011D, 0x0000011E, 0x80E08D0F, 0x0000011F,
+    0x80D0B44F, 0x00000120, 0x8030892E, 0x80B089E2, 0x80E089E2, 0x00000121, 0x00000122, 0x80E0D82C,
+    0x8170B08F, 0x8080B1EE, 0x00000123, 0x00000124, 0x00000125, 0x8080B18F, 0x8020D58B, 0x00000126,
+    0x8040E42E, 0x8190A1EF, 0x8020E5F5, 0x00000127, 0x00000128, 0x00000129, 0x0000012A, 0x0000012B,
+    0x8020B899, 0x80E0B459, 0x0000012C, 0x8100B1B9, 0x80C0B979, 0x0000012D, 0x0000012E, 0x0000012F,
+    0x00000130, 0x00000131, 0x8030D299, 0x00000132, 0x8030D068, 0x00000133, 0x80308E89, 0x80808934,
+    0x80C0A699, 0x8060A688, 0x00000134, 0x80E0D068, 0x00000135, 0x8080D5D4, 0x00000136, 0x00000137,
+    0x8020D1EE, 0x80D0D34F, 0x80608E8F, 0x8100D12F, 0x8100BA8F, 0x8030BA8F, 0x814089EF, 0x81408981,
+    0x00000138, 0x00000139, 0x81408D34, 0x8140E1EE, 0x8140B1EE, 0x8140D5D4, 0x8140DDD9, 0x8140A5D4,
+    0x81409DA1, 0x8140A4E1, 0x8140B8EF, 0x8140B8F9, 0x0000013A, 0x812A9099, 0x80496599, 0x0000013B,
+    0x0000013C, 0x0000013D, 0x0000013E, 0x8127DC99, 0x0000013F, 0x80495524, 0x00000140, 0x00000141,
+    0x80493D24, 0x8087D649, 0x00000142, 0x00000143, 0x810925F2, 0x00000144, 0x00000145, 0x80493EEE,
+    0x00000146, 0x8127B88F, 0x8047B9F2, 0x00000147, 0x80D4B9F2, 0x8127892E, 0x810925EE, 0x812AB9D9,
+    0x804955CB, 0x00000148, 0x80693DC4, 0x8127D5C4, 0x80993DD9, 0x00000149, 0x804925CB, 0x812425CF,
+    0x0000014A, 0x0000014B, 0x8127D4E8, 0x8077D644, 0x0000014C, 0x0000014D, 0x0000014E, 0x80793EEE,
+    0x80793D2E, 0x807925C4, 0x817955C7, 0x0000014F, 0x00000150, 0x8124D359, 0x8069269A, 0x00000151,
+    0x80693E88, 0x00000152, 0x812AD299, 0x00000153, 0x812ABA99, 0x00000154, 0x804924D4, 0x80662654,
+    0x00000155, 0x80393CD4, 0x812789F4, 0x811AA654, 0x80793EB4, 0x00000156, 0x803954D4, 0x80695534,
+    0x8037D654, 0x810925D4, 0x80693DD4, 0x00000157, 0x00000158, 0x81442644, 0x00000159, 0x0000015A,
+    0x8149246B, 0x81495599, 0x81495688, 0x814AD1F2, 0x0000015B, 0x81493EB4, 0x81493DB0, 0x814955B0,
+    0x814AB5F2, 0x0000015C, 0x0000015D, 0x80292432, 0x0000015E, 0x0000015F, 0x802906EC, 0x00000160,
+    0x00000161, 0x00000162, 0x802906CF, 0x00000163, 0x80C78832, 0x00000164, 0x80663E41, 0x00000165,
+    0x00000166, 0x00000167, 0x00000168, 0x81563832, 0x00000169, 0x0000016A, 0x0000016B, 0x80F905C7,
+    0x80B93DC1, 0x0000016C, 0x804906EC, 0x801911F2, 0x80478A41, 0x0000016D, 0x80123E4E, 0x804905CB,
+    0x0000016E, 0x80290524, 0x80878644, 0x80278644, 0x80293C24, 0x807905C4, 0x802905C4, 0x0000016F,
+    0x8011D1F2, 0x00000170, 0x81565241, 0x00000171, 0x80290474, 0x803904D4, 0x00000172, 0x80B906B4,
+    0x80180654, 0x80340654, 0x80113E54, 0x811A8654, 0x00000173, 0x814906EC, 0x81448641, 0x814904E9,
+    0x8149052C, 0x81492424, 0x8149242C, 0x8149052E, 0x81490474, 0x81490534, 0x00000174, 0x8120C124,
+    0x00000175, 0x80C0A644, 0x8120DD99, 0x80D0B032, 0x8120B199, 0x00000176, 0x00000177, 0x8160C1F2,
+    0x80D0E5F2, 0x80C089F2, 0x8160B1F2, 0x00000178, 0x00000179, 0x80D0B9F2, 0x0000017A, 0x812091EE,
+    0x8120E5EE, 0x8120D299, 0x8120D12F, 0x8140C132, 0x0000017B, 0x0000017C, 0x8034CA49, 0x0000017D,
+    0x803AC92F, 0x0000017E, 0x0000017F, 0x8037C8E9, 0x00000180, 0x00000181, 0x806AC9F2, 0x8067C8EF,
+    0x8067CAAD, 0x80CCC923, 0x80DCCA48, 0x00000182, 0x00000183, 0x00000184, 0x00000185, 0x80DAC979,
+    0x8177C9B9, 0x806ACA59, 0x8067CA99, 0x8044CA99, 0x00000186, 0x8067CA88, 0x00000187, 0x8064CA88,
+    0x8074CA88, 0x802AC9D4, 0x00000188, 0x81444AAD, 0x8147C868, 0x814449F7, 0x814AC84F, 0x00000189,
+    0x8011C924, 0x8034C861, 0x8164C82C, 0x8011CB2C, 0x8037C82C, 0x0000018A, 0x801AC923, 0x803AC921,
+    0x0000018B, 0x80D7C839, 0x80D7C82C, 0x80DAC82C, 0x0000018C, 0x801849EE, 0x801A4921, 0x0000018D,
+    0x8030C9EC, 0x0000018E, 0x0000018F, 0x80C0C899, 0x00000190, 0x00000191, 0x8100C961, 0x00000192,
+    0x8030CA09, 0x00000193, 0x8080CA19, 0x8010C8E8, 0x80C0C868, 0x80D0C868, 0x8100C868, 0x8170CA99,
+    0x8100CA99, 0x80B0C834, 0x8030C834, 0x8140CA99, 0x8140C899, 0x8140C9F4, 0x8140CA59, 0x00000194,
+    0x00000195, 0x00000196, 0x00000197, 0x00000198, 0x00000199, 0x0000019A, 0x0000019B, 0x0000019C,
+    0x0000019D, 0x0000019E, 0x80971125, 0x0000019F, 0x806495C4, 0x000001A0, 0x8022B899, 0x804AB865,
+    0x80573AA9, 0x8042B92D, 0x000001A1, 0x000001A2, 0x80428AA7, 0x807AA585, 0x000001A3, 0x8074B5A5,
+    0x80229EAE, 0x000001A4, 0x000001A5, 0x000001A6, 0x000001A7, 0x000001A8, 0x000001A9, 0x80D490E5,
+    0x80EA90E5, 0x000001AA, 0x8042A4EE, 0x000001AB, 0x000001AC, 0x000001AD, 0x000001AE, 0x000001AF,
+    0x000001B0, 0x8042B5E9, 0x8024BDA5, 0x8044BC85, 0x000001B1, 0x805711F7, 0x8042B5EE, 0x80F825C5,
+    0x000001B2, 0x000001B3, 0x8072BC85, 0x804299E7, 0x000001B4, 0x8072BD24, 0x80479D25, 0x80773DA5,
+    0x8077D4E5, 0x000001B5, 0x804790E5, 0x000001B6, 0x80B2B88F, 0x80728D6F, 0x000001B7, 0x80829A99,
+    0x8062D068, 0x000001B8, 0x80C29A99, 0x80561474, 0x803614D4, 0x000001B9, 0x80C2D2B0, 0x80345685,
+    0x805C5594, 0x80565685, 0x80665685, 0x000001BA, 0x8062A5D4, 0x80C4D105, 0x80562685, 0x000001BB,
+    0x000001BC, 0x000001BD, 0x80229934, 0x80C29D34, 0x000001BE, 0x000001BF, 0x000001C0, 0x8042B0D4,
+    0x80428AB4, 0x805A5485, 0x000001C1, 0x000001C2, 0x8062D124, 0x000001C3, 0x000001C4, 0x000001C5,
+    0x814414D4, 0x8142B06F, 0x8142B60F, 0x000001C6, 0x8142B9EE, 0x814295D9, 0x000001C7, 0x814AC185,
+    0x8144D105, 0x000001C8, 0x8147C6A5, 0x81443D85, 0x8144B8E5, 0x814BA5C5, 0x814425C5, 0x8147B9C5,
+    0x000001C9, 0x80F694E1, 0x000001CA, 0x000001CB, 0x000001CC, 0x80161C25, 0x8076142D, 0x000001CD,
+    0x000001CE, 0x000001CF, 0x000001D0, 0x810604E5, 0x000001D1, 0x000001D2, 0x000001D3, 0x000001D4,
+    0x80171D85, 0x000001D5, 0x8076142E, 0x80B706C5, 0x000001D6, 0x80163DC5, 0x000001D7, 0x80C485C5,
+    0x810605C5, 0x000001D8, 0x000001D9, 0x000001DA, 0x801204E5, 0x000001DB, 0x80760485, 0x80173C85,
+    0x80141424, 0x81061424, 0x80B71424, 0x801695C4, 0x805605C4, 0x000001DC, 0x000001DD, 0x80C2C281,
+    0x8102D02C, 0x000001DE, 0x81028699, 0x80560685, 0x81060685, 0x80E28688, 0x801A3DC5, 0x000001DF,
+    0x000001E0, 0x8051B034, 0x000001E1, 0x81061434, 0x000001E2, 0x000001E3, 0x80C28614, 0x80570474,
+    0x000001E4, 0x80D285D4, 0x80C285D4, 0x814B942B, 0x81441681, 0x814405C5, 0x81441461, 0x000001E5,
+    0x000001E6, 0x807098C5, 0x80D0D6C5, 0x81609EA5, 0x000001E7, 0x000001E8, 0x80509D85, 0x80708985,
+    0x8160B2C5, 0x8160B2A5, 0x8030B9E5, 0x803090E5, 0x80308985, 0x8030B2C5, 0x000001E9, 0x80C0B865,
+    0x8080B2C5, 0x80308D05, 0x80D0D285, 0x80C0D285, 0x8020D105, 0x8140D605, 0x000001EA, 0x000001EB,
+    0x000001EC, 0x8042B6B2, 0x80649659, 0x000001ED, 0x000001EE, 0x000001EF, 0x8172A644, 0x8036164B,
+    0x8039148F, 0x000001F0, 0x000001F1, 0x8122B123, 0x8179146B, 0x8049146B, 0x000001F2, 0x000001F3,
+    0x81229499, 0x000001F4, 0x81095485, 0x000001F5, 0x000001F6, 0x80593C85, 0x000001F7, 0x81229325,
+    0x000001F8, 0x812490E5, 0x000001F9, 0x000001FA, 0x804926C5, 0x000001FB, 0x80395485, 0x000001FC,
+    0x803925A5, 0x81091465, 0x81228C65, 0x81092465, 0x000001FD, 0x000001FE, 0x81793E85, 0x81228E8F,
+    0x80295685, 0x8127D685, 0x000001FF, 0x00000200, 0x815A1649, 0x00000201, 0x00000202, 0x80591474,
+    0x80391614, 0x80591DF4, 0x81228AB4, 0x80595614, 0x80595474, 0x00000203, 0x80341654, 0x80FB1654,
+    0x00000204, 0x814B9650, 0x81441532, 0x814915C4, 0x8142B9F2, 0x00000205, 0x81493E05, 0x00000206,
+    0x81492605, 0x8144D245, 0x814925C5, 0x81495465, 0x81492465, 0x00000207, 0x00000208, 0x00000209,
+    0x0000020A, 0x0000020B, 0x0000020C, 0x0000020D, 0x0000020E, 0x81A28A41, 0x0000020F, 0x80260645,
+    0x00000210, 0x00000211, 0x00000212, 0x80428832, 0x00000213, 0x81228499, 0x80123E45, 0x80428659,
+    0x80491424, 0x80291424, 0x81228484, 0x80828644, 0x805C5241, 0x00000214, 0x80390685, 0x81090685,
+    0x80828654, 0x81228474, 0x00000215, 0x80791434, 0x8142D241, 0x81491434, 0x81428659, 0x81491424,
+    0x81490465, 0x00000216, 0x80E08E45, 0x80309245, 0x8120B525, 0x81009245, 0x8060E645, 0x80609659,
+    0x00000217, 0x00000218, 0x00000219, 0x0000021A, 0x0000021B, 0x0000021C, 0x8027C9C5, 0x0000021D,
+    0x8102C868, 0x8067C865, 0x8022CB2C, 0x0000021E, 0x0000021F, 0x00000220, 0x80D2C879, 0x80D2C934,
+    0x8067CA85, 0x8082CA9A, 0x8142CA59, 0x8147CA85, 0x8012C925, 0x8122C82E, 0x00000221, 0x8060C865,
+    0x8030CAC5, 0x8050C999, 0x8070C885, 0x00000222, 0x80C0C8E5, 0x8050CA88, 0x00000223, 0x00000224,
+    0x00000225, 0x00000226, 0x00000227, 0x807654B9, 0x00000228, 0x80D4B4AF, 0x80248CB0, 0x00000229,
+    0x80C488AC, 0x803424A6, 0x0000022A, 0x8027E0AE, 0x0000022B, 0x805658AE, 0x0000022C, 0x0000022D,
+    0x0000022E, 0x804B94A2, 0x0000022F, 0x00000230, 0x00000231, 0x80F610AE, 0x00000232, 0x00000233,
+    0x00000234, 0x00000235, 0x00000236, 0x00000237, 0x00000238, 0x00000239, 0x0000023A, 0x0000023B,
+    0x0000023C, 0x0000023D, 0x809B24A4, 0x0000023E, 0x0000023F, 0x8027B8A4, 0x00000240, 0x80C4B8A4,
+    0x00000241, 0x8034D8B4, 0x80F350AE, 0x80F1D0B4, 0x80D7D0B4, 0x00000242, 0x00000243, 0x803AD0B9,
+    0x00000244, 0x80C48CB4, 0x80FBB0B4, 0x00000245, 0x815730B4, 0x802654B4, 0x802490B4, 0x804AD8B4,
+    0x00000246, 0x8034D0A4, 0x80F850A4, 0x00000247, 0x80DAD0A4, 0x80FAD0A4, 0x80CAD0A4, 0x00000248,
+    0x00000249, 0x0000024A, 0x0000024B, 0x814B94B4, 0x814B94A4, 0x8147DCAC, 0x8147DCA4, 0x8142B8B4,
+    0x814AB8A4, 0x8147ACAE, 0x8147B8A4, 0x814B94AE, 0x814CC0A4, 0x8147E4A4, 0x8067D8A1, 0x0000024C,
+    0x8011A0A4, 0x0000024D, 0x8016C0A4, 0x0000024E, 0x801224B5, 0x8014B4A4, 0x0000024F, 0x00000250,
+    0x801234AE, 0x801624AE, 0x801750A4, 0x00000251, 0x00000252, 0x00000253, 0x00000254, 0x00000255,
+    0x00000256, 0x8030B4AC, 0x80C0B4A4, 0x00000257, 0x00000258, 0x80C0C0AC, 0x00000259, 0x81008CAD,
+    0x0000025A, 0x0000025B, 0x8080E4A4, 0x0000025C, 0x0000025D, 0x8040D0A4, 0x80C0D0B8, 0x8060D0A4,
+    0x803090B4, 0x8160B0B4, 0x80608CB4, 0x8140ACAE, 0x8140C0A4, 0x8140B4A4, 0x8140E0A4, 0x0000025E,
+    0x0000025F, 0x00000260, 0x00000261, 0x812288AC, 0x00000262, 0x802654B2, 0x00000263, 0x00000264,
+    0x8024ACB2, 0x00000265, 0x00000266, 0x00000267, 0x80F924AC, 0x806624B2, 0x00000268, 0x8027B8B2,
+    0x80C7B8B2, 0x00000269, 0x80C4B8B2, 0x0000026A, 0x0000026B, 0x0000026C, 0x802490B2, 0x809230B2,
+    0x804924B2, 0x0000026D, 0x8044B8B2, 0x0000026E, 0x0000026F, 0x802914A4, 0x812AB0A4, 0x00000270,
+    0x8124B0A4, 0x00000271, 0x00000272, 0x8124D8B4, 0x00000273, 0x8042D0B2, 0x809750B2, 0x00000274,
+    0x815A50B2, 0x80FA20B2, 0x00000275, 0x8047D0B2, 0x80FA50B2, 0x00000276, 0x814954B2, 0x814AB8B2,
+    0x814A88B2, 0x00000277, 0x814924B2, 0x8144B0B2, 0x814914A4, 0x814954A4, 0x814924A4, 0x00000278,
+    0x801130B2, 0x801688B2, 0x801934B2, 0x8014B4B2, 0x801210B2, 0x801610B2, 0x801490B2, 0x80190CA4,
+    0x801934A4, 0x801850B2, 0x801350B2, 0x801650B2, 0x00000279, 0x0000027A, 0x0000027B, 0x0000027C,
+    0x80C09CB2, 0x0000027D, 0x8070E4B2, 0x80C0E4B2, 0x0000027E, 0x81009CB2, 0x8070C0B2, 0x8100B0B2,
+    0x8100E4B2, 0x0000027F, 0x8080B0B2, 0x8080E4B2, 0x00000280, 0x8020D0B2, 0x80C0D0B2, 0x8050D0B2,
+    0x8040D0B2, 0x8120D0A4, 0x00000281, 0x8140ACB2, 0x8140B4B2, 0x8140C0B2, 0x00000282, 0x8164C8AF,
+    0x8027C8B2, 0x8037C8B2, 0x00000283, 0x803AC8B2, 0x80D7C8AC, 0x00000284, 0x8044C8B2, 0x00000285,
+    0x8032C8A4, 0x00000286, 0x8037C8A4, 0x803AC8A4, 0x80CAC8A4, 0x8053C8B4, 0x814448B7, 0x814CC8A4,
+    0x8144C8A4, 0x814448A5, 0x8013C8A5, 0x8014C8B2, 0x00000287, 0x00000288, 0x8040C8A4, 0x8050C8A4,
+    0x8060C8A4, 0x00000289, 0x8040C8B2, 0x8060C8B2, 0x0000028A, 0x0000028B, 0x0000028C, 0x81065668,
+    0x0000028D, 0x81042668, 0x0000028E, 0x8044C26F, 0x0000028F, 0x00000290, 0x00000291, 0x00000292,
+    0x00000293, 0x00000294, 0x813ABAB0, 0x80B72668, 0x00000295, 0x00000296, 0x00000297, 0x81343EEE,
+    0x00000298, 0x813855CB, 0x8137D5C4, 0x00000299, 0x813CB208, 0x8109E468, 0x813CCDF0, 0x813CB868,
+    0x813CB9E4, 0x0000029A, 0x0000029B, 0x0000029C, 0x0000029D, 0x810ACD19, 0x81346599, 0x0000029E,
+    0x0000029F, 0x8136BD79, 0x81343EF9, 0x80E7A679, 0x81373EF9, 0x813AB9D9, 0x813825D9, 0x813425D9,
+    0x8137B9D9, 0x000002A0, 0x8136A688, 0x80D4CE99, 0x000002A1, 0x813A3DB0, 0x000002A2, 0x000002A3,
+    0x80DACE99, 0x000002A4, 0x000002A5, 0x813A55B0, 0x8137D688, 0x813CBA88, 0x000002A6, 0x813A3DD9,
+    0x000002A7, 0x000002A8, 0x80D49274, 0x000002A9, 0x8136BD94, 0x000002AA, 0x80D7A674, 0x000002AB,
+    0x80A7D674, 0x81373DF4, 0x81373EB4, 0x000002AC, 0x000002AD, 0x814BA674, 0x8147C279, 0x000002AE,
+    0x000002AF, 0x80182668, 0x000002B0, 0x000002B1, 0x000002B2, 0x81368668, 0x8034066D, 0x000002B3,
+    0x8138D437, 0x8109A037, 0x000002B4, 0x801B8668, 0x813B8668, 0x8131A2E1, 0x813806EE, 0x813406ED,
+    0x000002B5, 0x000002B6, 0x000002B7, 0x000002B8, 0x81360668, 0x81340599, 0x8159D42C, 0x000002B9,
+    0x81343C2C, 0x000002BA, 0x8134058C, 0x000002BB, 0x000002BC, 0x813A046B, 0x000002BD, 0x81360699,
+    0x80175279, 0x813A0668, 0x000002BE, 0x80198DF4, 0x81383034, 0x813404D4, 0x813185D4, 0x81340594,
+    0x813605D4, 0x80171E74, 0x000002BF, 0x80378674, 0x80260674, 0x000002C0, 0x8100CD01, 0x000002C1,
+    0x8130C219, 0x000002C2, 0x81309199, 0x000002C3, 0x8130B199, 0x8100B279, 0x8020CE6F, 0x80C0CE6F,
+    0x8130B2CF, 0x8130D9F9, 0x8130D5C1, 0x8130B899, 0x8100BA79, 0x80E0CC2C, 0x8020CD2E, 0x80D0CDEE,
+    0x8130B1EE, 0x000002C4, 0x8100CE81, 0x000002C5, 0x8060D26F, 0x8130D12E, 0x80809274, 0x8130A688,
+    0x80D0E674, 0x000002C6, 0x8100CE99, 0x8130D039, 0x8100D279, 0x8080CE99, 0x8140CE99, 0x000002C7,
+    0x81382659, 0x8109266D, 0x000002C8, 0x81383DF2, 0x81093E79, 0x8127CD2E, 0x000002C9, 0x000002CA,
+    0x80392670, 0x8131BE4E, 0x8131BEB2, 0x8131D646, 0x000002CB, 0x81343E4E, 0x812ACD19, 0x80693E68,
+    0x80295668, 0x80395668, 0x812ACE99, 0x000002CC, 0x80974E92, 0x81385654, 0x000002CD, 0x81343E54,
+    0x8135A654, 0x81342654, 0x80395674, 0x80693E74, 0x000002CE, 0x000002CF, 0x81496674, 0x000002D0,
+    0x000002D1, 0x813A9C32, 0x813AC241, 0x000002D2, 0x8137B832, 0x000002D3, 0x81318650, 0x000002D4,
+    0x81340650, 0x80290668, 0x80390668, 0x80195279, 0x813A064B, 0x8019D132, 0x8134D032, 0x813A0532,
+    0x81278674, 0x000002D5, 0x813A0654, 0x8120CE19, 0x8130D9F2, 0x81308E41, 0x000002D6, 0x813849E7,
+    0x81344AA7, 0x813CCAB0, 0x813AC999, 0x81344AA2, 0x81384927, 0x000002D7, 0x8131CAAD, 0x803ACA6F,
+    0x8131CAA2, 0x8131C92D, 0x8131C930, 0x000002D8, 0x813A49F0, 0x813A4AAD, 0x8064CA74, 0x8177CA74,
+    0x000002D9, 0x802ACA74, 0x813A4AB4, 0x802ACA61, 0x8131C827, 0x8047CA61, 0x8131C82D, 0x81384839,
+    0x8131C830, 0x8137CA81, 0x813A4921, 0x000002DA, 0x81384834, 0x8130C979, 0x8130C82E, 0x8080CA68,
+    0x80D0CA68, 0x000002DB, 0x000002DC, 0x000002DD, 0x000002DE, 0x8134152B, 0x8042A66D, 0x813416EE,
+    0x000002DF, 0x8135952E, 0x813815C4, 0x81329499, 0x000002E0, 0x000002E1, 0x80F11665, 0x000002E2,
+    0x80729665, 0x000002E3, 0x000002E4, 0x81349185, 0x000002E5, 0x000002E6, 0x000002E7, 0x8132A745,
+    0x80E7BE65, 0x80574EA5, 0x8042BA65, 0x8132BA65, 0x000002E8, 0x80E7A665, 0x000002E9, 0x000002EA,
+    0x813195C5, 0x000002EB, 0x000002EC, 0x000002ED, 0x000002EE, 0x813815D4, 0x000002EF, 0x813A15CF,
+    0x8102CE8F, 0x000002F0, 0x000002F1, 0x000002F2, 0x8104CE85, 0x81382685, 0x813A152E, 0x000002F3,
+    0x81361614, 0x81381594, 0x813A3D85, 0x813A2585, 0x8142CE99, 0x81443E65, 0x81441665, 0x000002F4,
+    0x000002F5, 0x8014CD85, 0x8132C02C, 0x000002F6, 0x000002F7, 0x81318585, 0x000002F8, 0x000002F9,
+    0x000002FA, 0x80C28665, 0x80260665, 0x81341426, 0x000002FB, 0x81340605, 0x81340585, 0x80340665,
+    0x81040665, 0x80C28668, 0x000002FC, 0x000002FD, 0x000002FE, 0x81380685, 0x000002FF, 0x8132D02C,
+    0x813A142C, 0x80C28674, 0x81360685, 0x813A0585, 0x81358685, 0x813A0565, 0x813A142B, 0x8130D465,
+    0x81308985, 0x8130B2C5, 0x80D0BA65, 0x8100CE65, 0x8030D665, 0x8100D665, 0x80C0C265, 0x8060B265,
+    0x00000300, 0x8020CE85, 0x8130D685, 0x8100CE85, 0x8080CE85, 0x8138164D, 0x80691668, 0x8122CDF7,
+    0x8122CD2E, 0x8132B9F2, 0x00000301, 0x81382645, 0x81092665, 0x81342645, 0x8127D665, 0x00000302,
+    0x81383E45, 0x81093E65, 0x81343E45, 0x8124BA65, 0x81373E45, 0x813A3E45, 0x813A164E, 0x8122CD34,
+    0x81791674, 0x00000303, 0x81341432, 0x00000304, 0x81318645, 0x81340645, 0x00000305, 0x80590665,
+    0x81369432, 0x813A0645, 0x81308A45, 0x8132C926, 0x8132CACF, 0x8162CA6F, 0x8132CAAD, 0x8132CAC5,
+    0x8162CA65, 0x00000306, 0x8132C8E5, 0x8077CA65, 0x00000307, 0x813AC8E5, 0x81384AA5, 0x8130C8E5,
+    0x00000308, 0x813B94B0, 0x00000309, 0x0000030A, 0x8138D4A5, 0x0000030B, 0x8134B8B7, 0x80E7CCB9,
+    0x81574CB8, 0x8042CCB8, 0x0000030C, 0x8132DCA4, 0x8174CCA4, 0x0000030D, 0x8137DCA4, 0x0000030E,
+    0x813654A4, 0x80E7CCA4, 0x813A14A4, 0x813A14B0, 0x8134D0A4, 0x813A14AC, 0x0000030F, 0x00000310,
+    0x81584CB4, 0x80974CB4, 0x813614B4, 0x8099B0B4, 0x00000311, 0x8019C0AE, 0x8019A0AE, 0x8019ACA4,
+    0x8019A0A4, 0x8130B4B9, 0x8050CCAC, 0x00000312, 0x00000313, 0x8030CCA4, 0x80C0CCA4, 0x00000314,
+    0x00000315, 0x00000316, 0x00000317, 0x00000318, 0x8122CCB7, 0x00000319, 0x8174CCB2, 0x0000031A,
+    0x813424B2, 0x813664B2, 0x813464B2, 0x8122CCB4, 0x813A14B2, 0x80194CA4, 0x8019ACB2, 0x0000031B,
+    0x0000031C, 0x8020CCB2, 0x813088B2, 0x8130E4B2, 0x80C0CCB2, 0x0000031D, 0x813448A4, 0x8134C8AE,
+    0x8134C8A4, 0x8131C8B7, 0x8132C8B2, 0x813848A5, 0x8131C8A5, 0x813A48B7, 0x0000031E, 0x0000031F,
+    0x00000320, 0x00000321, 0x00000322, 0x00000323, 0x00000324, 0x00000325, 0x00000326, 0x00000327,
+    0x00000328, 0x00000329, 0x0000032A, 0x0000032B, 0x0000032C, 0x0000032D, 0x0000032E, 0x0000032F,
+    0x80C7BE13, 0x8107BD93, 0x00000330, 0x00000331, 0x00000332, 0x00000333, 0x81372613, 0x8104B8F3,
+    0x00000334, 0x00000335, 0x00000336, 0x80C7B8F3, 0x00000337, 0x00000338, 0x813825D3, 0x80C4B5D3,
+    0x00000339, 0x80C7A5D3, 0x0000033A, 0x8104BDD3, 0x0000033B, 0x0000033C, 0x8135A613, 0x0000033D,
+    0x0000033E, 0x0000033F, 0x81078D73, 0x00000340, 0x00000341, 0x80C7BD73, 0x00000342, 0x00000343,
+    0x80C4B973, 0x00000344, 0x00000345, 0x8135A5D3, 0x80B4B1D3, 0x00000346, 0x00000347, 0x00000348,
+    0x00000349, 0x0000034A, 0x0000034B, 0x0000034C, 0x0000034D, 0x0000034E, 0x80362693, 0x80363E93,
+    0x0000034F, 0x8037B293, 0x00000350, 0x00000351, 0x80CACE93, 0x80FACE93, 0x00000352, 0x80C7D693,
+    0x803ABA93, 0x803AB293, 0x804A8E93, 0x80C7D2B3, 0x8091D2B3, 0x00000353, 0x80D4B293, 0x80F6A693,
+    0x00000354, 0x80D7B293, 0x00000355, 0x00000356, 0x00000357, 0x00000358, 0x00000359, 0x814498D3,
+    0x8147BD93, 0x8147A593, 0x8147B193, 0x8144B193, 0x0000035A, 0x814A9A93, 0x814BA693, 0x8144BA93,
+    0x8144B293, 0x0000035B, 0x814425D3, 0x0000035C, 0x0000035D, 0x0000035E, 0x0000035F, 0x00000360,
+    0x00000361, 0x00000362, 0x00000363, 0x00000364, 0x00000365, 0x00000366, 0x00000367, 0x80D48C33,
+    0x00000368, 0x8037B433, 0x00000369, 0x813185B3, 0x0000036A, 0x803605B3, 0x806785B3, 0x80C785B3,
+    0x0000036B, 0x81048C33, 0x80340613, 0x0000036C, 0x80360613, 0x0000036D, 0x80F80593, 0x810AB433,
+    0x813805B3, 0x0000036E, 0x0000036F, 0x00000370, 0x8097D033, 0x00000371, 0x80648693, 0x00000372,
+    0x00000373, 0x80378693, 0x801A3033, 0x801651F3, 0x00000374, 0x814AB833, 0x814A8833, 0x81479C33,
+    0x814406F3, 0x81478493, 0x814B8693, 0x00000375, 0x80A0B453, 0x00000376, 0x00000377, 0x80C0B453,
+    0x00000378, 0x00000379, 0x8090B453, 0x8020CD33, 0x80C0C133, 0x0000037A, 0x0000037B, 0x8020A593,
+    0x0000037C, 0x0000037D, 0x80E0A4D3, 0x80E0A593, 0x0000037E, 0x8020B9D3, 0x80C0DDD3, 0x0000037F,
+    0x00000380, 0x8040D453, 0x00000381, 0x80C0D493, 0x8020B093, 0x81709133, 0x80D0A493, 0x00000382,
+    0x8020B893, 0x80C0B893, 0x00000383, 0x00000384, 0x81709A93, 0x8060CE93, 0x00000385, 0x80C0CE93,
+    0x00000386, 0x00000387, 0x80608E93, 0x00000388, 0x80809A93, 0x80C0D113, 0x8080B293, 0x00000389,
+    0x81408DF3, 0x8140B2B3, 0x8140E133, 0x8140A593, 0x8140B8F3, 0x8140CD73, 0x81408D73, 0x8140B173,
+    0x8140B973, 0x0000038A, 0x80792613, 0x810924F3, 0x0000038B, 0x80393E13, 0x0000038C, 0x0000038D,
+    0x8127B613, 0x0000038E, 0x812AB613, 0x0000038F, 0x81385653, 0x00000390, 0x8107D653, 0x00000391,
+    0x80E7A653, 0x812AB8F3, 0x807925D3, 0x00000392, 0x812AA5D3, 0x00000393, 0x80492613, 0x00000394,
+    0x80493E13, 0x81093C93, 0x00000395, 0x00000396, 0x8124B893, 0x812ACE93, 0x8127D693, 0x8127BE93,
+    0x00000397, 0x81792693, 0x80792693, 0x8124BE93, 0x812ABA93, 0x81495673, 0x00000398, 0x8147D653,
+    0x00000399, 0x814925F3, 0x81493DD3, 0x814954F3, 0x814924F3, 0x0000039A, 0x81318653, 0x0000039B,
+    0x0000039C, 0x80F90C33, 0x0000039D, 0x0000039E, 0x80192433, 0x812785B3, 0x0000039F, 0x803905B3,
+    0x81380653, 0x000003A0, 0x80390613, 0x810905B3, 0x8127D033, 0x000003A1, 0x80290693, 0x813A0653,
+    0x80490693, 0x000003A2, 0x814905D3, 0x81490733, 0x814905B3, 0x81490613, 0x000003A3, 0x000003A4,
+    0x000003A5, 0x8120A593, 0x80C0A653, 0x8100A653, 0x8120B973, 0x8120A5D3, 0x8120BA93, 0x000003A6,
+    0x8077CA13, 0x000003A7, 0x000003A8, 0x000003A9, 0x8067C853, 0x000003AA, 0x802ACA13, 0x000003AB,
+    0x8104C973, 0x8164CAB3, 0x8024C893, 0x000003AC, 0x810AC933, 0x000003AD, 0x8037CA13, 0x000003AE,
+    0x803AC853, 0x808ACA93, 0x000003AF, 0x8107CA93, 0x8044CA93, 0x8074CA93, 0x819ACA93, 0x814CC9F3,
+    0x8147CA93, 0x814ACA13, 0x814AC8D3, 0x8147CAB3, 0x814AC9D3, 0x814AC893, 0x8087C833, 0x80194833,
+    0x801AC833, 0x80F5C833, 0x000003B0, 0x000003B1, 0x000003B2, 0x000003B3, 0x8130C933, 0x000003B4,
+    0x000003B5, 0x8020C9D3, 0x000003B6, 0x8020C893, 0x80C0C893, 0x8040C9D3, 0x000003B7, 0x8030CA93,
+    0x8080CA93, 0x80D0CA93, 0x8100CA93, 0x8140CA93, 0x8140CA13, 0x8140C9F3, 0x8140C9D3, 0x000003B8,
+    0x80D2BEF3, 0x8172B893, 0x8051A1F3, 0x000003B9, 0x000003BA, 0x000003BB, 0x80829493, 0x000003BC,
+    0x000003BD, 0x817415D3, 0x000003BE, 0x80C2DD33, 0x8172B093, 0x8082B1B3, 0x000003BF, 0x000003C0,
+    0x000003C1, 0x80D2DD93, 0x8172B193, 0x8082B193, 0x000003C2, 0x80829593, 0x000003C3, 0x8082B613,
+    0x000003C4, 0x813816F3, 0x81729613, 0x810416F3, 0x000003C5, 0x8082B213, 0x81061453, 0x81029593,
+    0x000003C6, 0x804A9693, 0x000003C7, 0x80428A93, 0x000003C8, 0x000003C9, 0x8042BA93, 0x805C2693,
+    0x80522693, 0x80449693, 0x8192D133, 0x000003CA, 0x000003CB, 0x000003CC, 0x8142B193, 0x000003CD,
+    0x814295D3, 0x8142B893, 0x000003CE, 0x8142BA93, 0x000003CF, 0x000003D0, 0x000003D1, 0x000003D2,
+    0x000003D3, 0x000003D4, 0x80E28613, 0x000003D5, 0x000003D6, 0x802285D3, 0x80C285D3, 0x805605D3,
+    0x000003D7, 0x000003D8, 0x80228493, 0x000003D9, 0x804285D3, 0x000003DA, 0x81328693, 0x80828693,
+    0x80111693, 0x000003DB, 0x80628693, 0x8062D033, 0x814285B3, 0x81428573, 0x81428593, 0x81428693,
+    0x000003DC, 0x81228AB3, 0x000003DD, 0x802916F3, 0x000003DE, 0x8056A653, 0x000003DF, 0x000003E0,
+    0x80249653, 0x805B9653, 0x000003E1, 0x80229653, 0x000003E2, 0x804C9653, 0x802C9653, 0x805C9653,
+    0x80691693, 0x8122CE93, 0x81491733, 0x814916F3, 0x81449653, 0x81491673, 0x81491573, 0x80191433,
+    0x81241433, 0x000003E3, 0x801B1653, 0x000003E4, 0x81328653, 0x80828653, 0x81228493, 0x80428653,
+    0x81491433, 0x000003E5, 0x000003E6, 0x000003E7, 0x805AC9F3, 0x8072C9B3, 0x8022C9B3, 0x000003E8,
+    0x8102C9B3, 0x8082C893, 0x8082C853, 0x8162CA93, 0x8102CA93, 0x8032CA93, 0x8142C9D3, 0x8050C9D3,
+    0x000003E9, 0x000003EA, 0x000003EB, 0x000003EC, 0x000003ED, 0x8027B0B3, 0x000003EE, 0x802654B3,
+    0x000003EF, 0x000003F0, 0x8024ACB3, 0x000003F1, 0x8024B0B3, 0x000003F2, 0x000003F3, 0x000003F4,
+    0x8027B8B3, 0x000003F5, 0x80C4B8B3, 0x000003F6, 0x802790B3, 0x000003F7, 0x000003F8, 0x802490B3,
+    0x809230B3, 0x000003F9, 0x8044B8B3, 0x000003FA, 0x80CAD0B3, 0x813A24B3, 0x000003FB, 0x80C4D0B3,
+    0x000003FC, 0x80D4D0B3, 0x802CD0B3, 0x8024D0B3, 0x000003FD, 0x80D7D0B3, 0x000003FE, 0x814CC0B3,
+    0x000003FF, 0x814AB8B3, 0x8144B8B3, 0x814CACB3, 0x00000400, 0x8147B8B3, 0x8147ACB3, 0x00000401,
+    0x801268B3, 0x801490B3, 0x80163CB3, 0x801C30B3, 0x00000402, 0x8019A0B3, 0x8011A0B3, 0x00000403,
+    0x00000404, 0x00000405, 0x00000406, 0x80C0B4B3, 0x00000407, 0x80D0B0B3, 0x00000408, 0x80D08CB3,
+    0x80C08CB3, 0x00000409, 0x8080B4B3, 0x8080B0B3, 0x0000040A, 0x8020D0B3, 0x80D0D0B3, 0x8100D0B3,
+    0x8080D0B3, 0x0000040B, 0x8140B4B3, 0x8140C0B3, 0x8140B0B3, 0x0000040C, 0x812788B3, 0x0000040D,
+    0x0000040E, 0x812A88B3, 0x0000040F, 0x00000410, 0x8127B0B3, 0x812AB0B3, 0x8124B0B3, 0x812490B3,
+    0x804924B3, 0x814914B3, 0x814924B3, 0x814954B3, 0x802904B3, 0x00000411, 0x81209CB3, 0x81208CB3,
+    0x8120ACB3, 0x00000412, 0x00000413, 0x00000414, 0x80D2C8B3, 0x80D4C8B3, 0x802CC8B3, 0x00000415,
+    0x80C7C8B3, 0x80D7C8B3, 0x8027C8B3, 0x814CC8B3, 0x00000416, 0x8020C8B3, 0x80D0C8B3, 0x8100C8B3,
+    0x8080C8B3, 0x00000417, 0x00000418, 0x00000419, 0x0000041A, 0x817424C6, 0x0000041B, 0x80ECB608,
+    0x0000041C, 0x80E4C219, 0x8104B979, 0x80971938, 0x0000041D, 0x0000041E, 0x8104B9D9, 0x80A4B9C9,
+    0x817425D9, 0x810C9DB9, 0x80649CF9, 0x8074B619, 0x81049CF9, 0x0000041F, 0x00000420, 0x80B7246B,
+    0x00000421, 0x81048D79, 0x80B48D79, 0x81742468, 0x8174B868, 0x8091A5C7, 0x8181D929, 0x80D4B523,
+    0x803425B0, 0x8034D923, 0x803425C7, 0x8034B868, 0x8034246B, 0x803425CB, 0x803CB923, 0x803426D9,
+    0x80FC09F7, 0x81743DF0, 0x8024B44F, 0x8084C20F, 0x80B73EEE, 0x809709F8, 0x00000422, 0x809841EE,
+    0x80F725EE, 0x81043DD9, 0x8074E9AF, 0x00000423, 0x00000424, 0x80F43523, 0x803425CF, 0x80343DB0,
+    0x80343DEB, 0x00000425, 0x80878859, 0x80278859, 0x8027A5CB, 0x00000426, 0x8027B9D9, 0x8077A5C7,
+    0x8027A5C7, 0x00000427, 0x80279CF9, 0x80A7B8E7, 0x00000428, 0x00000429, 0x0000042A, 0x0000042B,
+    0x80279DEE, 0x8197884F, 0x802798CF, 0x8077BB4F, 0x80D7BC68, 0x8087BC68, 0x8097B923, 0x8087A46B,
+    0x8107BC68, 0x81979D23, 0x8107B879, 0x8037B868, 0x80378C69, 0x8037B923, 0x8037B60F, 0x8037B523,
+    0x8037B44F, 0x80378D79, 0x8037B4D9, 0x0000042C, 0x806AB8E9, 0x0000042D, 0x8104BAB0, 0x0000042E,
+    0x0000042F, 0x00000430, 0x00000431, 0x815724D9, 0x80DAEB59, 0x80DA9CF9, 0x00000432, 0x807AB5B9,
+    0x00000433, 0x810AC219, 0x807AC219, 0x00000434, 0x00000435, 0x811AA46B, 0x80648D15, 0x80DAB868,
+    0x810AB868, 0x810A8923, 0x819A8D79, 0x80AAA479, 0x80DA8D79, 0x803AA5C7, 0x803AB52E, 0x815725EE,
+    0x811ABD2E, 0x80F826AD, 0x8024A9F5, 0x802AE1ED, 0x802A98CF, 0x00000436, 0x80AAB86F, 0x803454C6,
+    0x803455B0, 0x803455CB, 0x8034546B, 0x8197D5C7, 0x8087D4E8, 0x8167D468, 0x8037D4E8, 0x80CCB608,
+    0x80766608, 0x80666459, 0x00000437, 0x8024B059, 0x802625B0, 0x8164BB2C, 0x80CCA5C7, 0x806625C7,
+    0x00000438, 0x81649D2C, 0x80CC5929, 0x80CCB868, 0x8066246B, 0x81A4B068, 0x8064B068, 0x80D4B068,
+    0x00000439, 0x0000043A, 0x803624C6, 0x0000043B, 0x803662C9, 0x80366136, 0x80366129, 0x80366138,
+    0x80C4B44F, 0x80C4B8EF, 0x8093B1EF, 0x0000043C, 0x80263DED, 0x80763DED, 0x810431F8, 0x81063DCB,
+    0x80263DF0, 0x80763DF0, 0x0000043D, 0x810CB1EE, 0x80263EF9, 0x80763EF9, 0x80F63CF9, 0x80663C6B,
+    0x80363DB0, 0x80363EEE, 0x80363C6B, 0x80C79D2E, 0x8067B12F, 0x80C79DEE, 0x8107B12F, 0x8107B330,
+    0x80C78859, 0x80C7BDD9, 0x80C79D23, 0x8037B1EE, 0x809626AD, 0x80CAC12E, 0x810AC12C, 0x802AB179,
+    0x802AB0F9, 0x80CAB619, 0x810AB219, 0x80CA8D79, 0x80CAB868, 0x80DAB068, 0x0000043E, 0x802654C6,
+    0x806654C6, 0x806655C7, 0x810655CB, 0x806655CB, 0x810655B9, 0x80665579, 0x803655B0, 0x803655C7,
+    0x8036546B, 0x8096C199, 0x0000043F, 0x8024B199, 0x8064B199, 0x8164B189, 0x8034258C, 0x80E78999,
+    0x80A7DD99, 0x80C7DD99, 0x00000440, 0x806AB199, 0x802AB199, 0x807AB199, 0x811AA58C, 0x811ABD8C,
+    0x00000441, 0x00000442, 0x8174B899, 0x8044B979, 0x80749099, 0x8044B8F9, 0x804CA5C7, 0x809225ED,
+    0x817491F7, 0x80B4908F, 0x00000443, 0x00000444, 0x8047A5C7, 0x810790F9, 0x804790F9, 0x80479CF9,
+    0x00000445, 0x8047BDB9, 0x8077BC99, 0x8037B88F, 0x80BA9355, 0x806AB889, 0x802A9099, 0x804AB9D9,
+    0x80DA9099, 0x804AB5B9, 0x810A90F9, 0x804AB619, 0x804A8D79, 0x80F226AD, 0x804AB9CF, 0x8092658C,
+    0x8044B599, 0x80779199, 0x8047B199, 0x8164D924, 0x808AB524, 0x81571124, 0x00000446, 0x8027D5C4,
+    0x80D7D5C4, 0x8107D5C4, 0x8087D5C4, 0x802625C4, 0x80C4D924, 0x80663DE4, 0x80263DE4, 0x807AA584,
+    0x8177D584, 0x80FAD0EF, 0x803AD2B0, 0x80FAD08F, 0x80D7D5D4, 0x81570EB4, 0x8037D5D4, 0x8047D454,
+    0x806AD1EE, 0x80F85123, 0x00000447, 0x811ABD34, 0x8167B534, 0x809225F4, 0x80973934, 0x809742B4,
+    0x80971DF4, 0x811AA5D4, 0x80A7A5D4, 0x81571934, 0x80E4D124, 0x8104D1EE, 0x8104C134, 0x80449D34,
+    0x00000448, 0x8044D9F4, 0x81048DF4, 0x802AD32C, 0x80363EB4, 0x80D7D594, 0x811AA594, 0x802AA594,
+    0x807AA594, 0x80CCD123, 0x807625D4, 0x8157512C, 0x80C4B534, 0x810AD299, 0x802AD299, 0x00000449,
+    0x8027D299, 0x807AD299, 0x8077D699, 0x80D7D28F, 0x8027BE99, 0x80EAD299, 0x8037BA84, 0x8104BA8F,
+    0x8044D28F, 0x0000044A, 0x8024D299, 0x80D4BA99, 0x8044D299, 0x80C7D28F, 0x81A63E99, 0x80978E8C,
+    0x8076269A, 0x80FA9D14, 0x0000044B, 0x80849D14, 0x8104D119, 0x80D49D14, 0x80E49D14, 0x81043E8F,
+    0x8087A699, 0x808AD068, 0x802AD068, 0x80E7D068, 0x8027D068, 0x804AD068, 0x0000044C, 0x8024D068,
+    0x8174D068, 0x8044D068, 0x8027BE88, 0x80D7BA88, 0x811ABE88, 0x8197D688, 0x81749288, 0x814AB5B9,
+    0x814A8859, 0x814A9A99, 0x8147D468, 0x814455B0, 0x8144B524, 0x814AB524, 0x814AD289, 0x8144EB59,
+    0x8144D299, 0x814AB130, 0x8147E123, 0x8144D068, 0x814BA714, 0x8147E12E, 0x8011575A, 0x8016D46B,
+    0x8011A1EF, 0x80DAE82B, 0x81678C22, 0x803C8C24, 0x802CDC39, 0x0000044D, 0x801B9AAC, 0x80160AAD,
+    0x807AB027, 0x0000044E, 0x80133EAC, 0x80363C2B, 0x80163EA4, 0x80D7B02C, 0x80163DE6, 0x8013B1F7,
+    0x801631F7, 0x80162F24, 0x80162F2C, 0x802CB037, 0x0000044F, 0x80C7E42C, 0x80131938, 0x801C25ED,
+    0x8156A42B, 0x8016A4EF, 0x801A912F, 0x80123538, 0x801B3D24, 0x80182124, 0x8104242C, 0x80962423,
+    0x810D075A, 0x81078468, 0x80378468, 0x8174046B, 0x803405B0, 0x811A8579, 0x811A846B, 0x806785B9,
+    0x803404C6, 0x811A84C6, 0x8034058B, 0x80660579, 0x8066046B, 0x8036046B, 0x811A858D, 0x806605B9,
+    0x803605B0, 0x8026046B, 0x809684EF, 0x80F58609, 0x80B40569, 0x811A852C, 0x8066052C, 0x8076852C,
+    0x8036052D, 0x81060524, 0x801739F9, 0x80173AAD, 0x00000450, 0x81570C30, 0x80D7B824, 0x80DCB828,
+    0x8157282D, 0x80E7B424, 0x80279C2E, 0x80879C2E, 0x8157082E, 0x8177B42E, 0x8157342E, 0x81573039,
+    0x80173AAC, 0x81A7B82C, 0x80E7902C, 0x81573030, 0x801725EE, 0x801AE12E, 0x801624EE, 0x80973039,
+    0x8097B82C, 0x8016BDC7, 0x8016A5CF, 0x00000451, 0x8013A5C7, 0x801825C7, 0x807605C4, 0x802605C4,
+    0x803605C7, 0x802605C3, 0x00000452, 0x802605CB, 0x803605CB, 0x816485C4, 0x80163039, 0x8018402C,
+    0x81679161, 0x819A8C61, 0x80378DE1, 0x80479DA1, 0x80D78D01, 0x80D7B5A1, 0x8037B5A1, 0x810AAD61,
+    0x8107C201, 0x803AC201, 0x8107B161, 0x803AB201, 0x816AB2C1, 0x81046581, 0x802AB181, 0x8104EB41,
+    0x8164BD81, 0x8164B181, 0x80164101, 0x81060741, 0x807ABB21, 0x80DAB8E1, 0x80E49CE1, 0x80E4B941,
+    0x807AD281, 0x80AABA81, 0x8016A699, 0x801A5123, 0x80175123, 0x80448E81, 0x801A3DD9, 0x80778699,
+    0x811ABE81, 0x80FAD281, 0x80C78688, 0x80F1D02C, 0x804A8C34, 0x801A9D14, 0x803405D4, 0x801B05D4,
+    0x801B8534, 0x801A9134, 0x80168934, 0x80763C34, 0x80263C34, 0x80663C34, 0x80163CD4, 0x80133DF4,
+    0x814B85C7, 0x00000453, 0x8070B5A1, 0x00000454, 0x80A098C1, 0x00000455, 0x8160C124, 0x80D0E12D,
+    0x80D09921, 0x00000456, 0x80D08C37, 0x80D09D23, 0x00000457, 0x80D0B923, 0x8070B52E, 0x8080B8E9,
+    0x80A0C02E, 0x8100B838, 0x81009C2E, 0x8060D5C1, 0x00000458, 0x00000459, 0x8070B941, 0x80E0D927,
+    0x80308C2F, 0x80D08D0F, 0x8080D9E3, 0x8170E9EF, 0x80F0AEAD, 0x81708D6F, 0x80B0E9EF, 0x80B0C1EB,
+    0x80D0B8EF, 0x81709DEE, 0x8030C1EE, 0x80D0B441, 0x8020B94F, 0x8100C02C, 0x80C0D4E8, 0x8080B02C,
+    0x8070B028, 0x8100B209, 0x8030D92C, 0x8160B124, 0x80C0C12E, 0x80C0B829, 0x8020B82C, 0x80C08921,
+    0x8030D58B, 0x8190AD61, 0x80C0E6B0, 0x0000045A, 0x0000045B, 0x8100C219, 0x804098D9, 0x0000045C,
+    0x81009099, 0x0000045D, 0x8070D759, 0x8070D499, 0x80A09CF9, 0x80409CF9, 0x0000045E, 0x8060B879,
+    0x8030B899, 0x8080B899, 0x8060B9D9, 0x8030B9D9, 0x0000045F, 0x8080B979, 0x80E0DAD9, 0x80E0C219,
+    0x80E0B9D9, 0x8100B459, 0x80208C79, 0x8020DC99, 0x80209099, 0x80209CF9, 0x81908859, 0x80308859,
+    0x80708859, 0x8020B179, 0x8020B099, 0x8020B1B9, 0x80C0E199, 0x8080C199, 0x8070A599, 0x8170B199,
+    0x8100B199, 0x80D09199, 0x8040A599, 0x8040B199, 0x8170B999, 0x8020B199, 0x00000460, 0x8040D2AD,
+    0x8060D2E1, 0x8170B29A, 0x8060D02C, 0x8160D594, 0x8060D594, 0x00000461, 0x8060D299, 0x80D0B299,
+    0x00000462, 0x8020D068, 0x80C0D068, 0x80D0D068, 0x8100D068, 0x80D0D029, 0x8040D934, 0x80E0D299,
+    0x80E0D02C, 0x80A0D5D4, 0x8070D5D4, 0x8160D5D4, 0x8040D5D4, 0x8100A5D4, 0x80A089F4, 0x814098D9,
+    0x81408859, 0x8140D299, 0x81408D79, 0x8140B199, 0x80345652, 0x81796599, 0x8034564C, 0x80265642,
+    0x812AB5B9, 0x803955A2, 0x806955B0, 0x803955B0, 0x80F18EB2, 0x00000463, 0x81743E4C, 0x80663EB2,
+    0x00000464, 0x00000465, 0x00000466, 0x80663DF2, 0x81093F19, 0x81093EEC, 0x81093DAF, 0x81093DE6,
+    0x80393EB0, 0x80293DE4, 0x80393EE4, 0x81093EA4, 0x80653E44, 0x808C924F, 0x80343E44, 0x80F23EB2,
+    0x80493DF0, 0x80493DEC, 0x81278D79, 0x8127BDB9, 0x8047DE59, 0x8047B1F2, 0x80D48E4F, 0x809B3E59,
+    0x80343D32, 0x80693D24, 0x00000467, 0x8029246B, 0x8039246B, 0x811AA64B, 0x00000468, 0x80342652,
+    0x810926D9, 0x8109246B, 0x810925B0, 0x803925B0, 0x80492599, 0x80B7564C, 0x80E93CC6, 0x80693EEE,
+    0x80293EEE, 0x80393EEE, 0x80393DEE, 0x80D7D64E, 0x80970EB2, 0x812AB923, 0x80393DD9, 0x802925D9,
+    0x812A9C59, 0x807955B0, 0x80793DED, 0x80793EB0, 0x80763E59, 0x80793EEC, 0x81249D24, 0x81649DF2,
+    0x807925B9, 0x81793DC7, 0x812AA5C7, 0x809925C7, 0x802925C7, 0x817925C7, 0x8164D24F, 0x80F9510F,
+    0x81793E88, 0x8127D1F2, 0x80E4D24F, 0x81249D14, 0x80F90934, 0x80295534, 0x807955D4, 0x814BA64C,
+    0x81493DF0, 0x81493E88, 0x814955CB, 0x00000469, 0x81648C32, 0x80349C32, 0x807906D9, 0x0000046A,
+    0x0000046B, 0x80790608, 0x80340532, 0x80395641, 0x811A864B, 0x81740646, 0x80340659, 0x803905B0,
+    0x81568A41, 0x80B9042C, 0x8124D82C, 0x8124E42C, 0x8069052C, 0x8079052C, 0x803906EC, 0x80CA8A41,
+    0x80660532, 0x801935F2, 0x81278468, 0x80139E4F, 0x8037C241, 0x80FB0659, 0x80378A41, 0x801909F2,
+    0x8127E42C, 0x8107B032, 0x80393C2B, 0x80193DA1, 0x81570659, 0x80171E59, 0x8157064D, 0x80971A41,
+    0x810906EE, 0x8079052E, 0x8159082E, 0x802906EE, 0x80CAB832, 0x80191DEE, 0x80F91C2E, 0x8127DC2E,
+    0x80793C2E, 0x810905C7, 0x806905C3, 0x810905CB, 0x806905CB, 0x803905CB, 0x804905A1, 0x804B8646,
+    0x808C9241, 0x804906EE, 0x8049052E, 0x80496424, 0x806906A4, 0x80340644, 0x801B8644, 0x807A8644,
+    0x81790688, 0x80192688, 0x801A5032, 0x80975241, 0x80B904D4, 0x804904D4, 0x807904D4, 0x807905D4,
+    0x80793C34, 0x814905B0, 0x8120A828, 0x80B0D649, 0x81208849, 0x81209CE1, 0x8060AD32, 0x81209032,
+    0x81209138, 0x81209129, 0x81208924, 0x8060A659, 0x8080A659, 0x8040A659, 0x8120912F, 0x8060D9F2,
+    0x80D0A9F2, 0x8120E9F2, 0x8120B868, 0x8120A5D9, 0x8120B8F9, 0x8030A64E, 0x80CAC924, 0x80CAC868,
+    0x80AAC9F2, 0x8177C984, 0x8107C9CF, 0x8027C923, 0x81A7C868, 0x80DACA49, 0x80D7CA08, 0x808ACA59,
+    0x80CAC8F9, 0x8074C999, 0x808AC999, 0x803ACAD9, 0x803AC999, 0x803ACA59, 0x0000046C, 0x8107C8F9,
+    0x80C7CA59, 0x8087C9D9, 0x8047C979, 0x8107C979, 0x8037C9D9, 0x8177CA88, 0x80D4CA88, 0x814ACAD9,
+    0x801949F7, 0x8027C838, 0x808CC838, 0x8067C839, 0x802ACA21, 0x812AC82C, 0x80B7C9A1, 0x8160C938,
+    0x8020C9EE, 0x8060C824, 0x8030C8EF, 0x8030C9E2, 0x80C0CAC1, 0x8020C8F9, 0x8030CA59, 0x80E0C979,
+    0x8030C9ED, 0x80D0C921, 0x80D0CA59, 0x8100CA59, 0x8080CA59, 0x0000046D, 0x8102C219, 0x0000046E,
+    0x0000046F, 0x00000470, 0x81741590, 0x8066146B, 0x8022DAD9, 0x00000471, 0x81729619, 0x81029619,
+    0x00000472, 0x00000473, 0x803465A5, 0x803C8D85, 0x00000474, 0x810655A5, 0x8062B5A5, 0x00000475,
+    0x00000476, 0x810296C5, 0x8022B185, 0x81729499, 0x80525465, 0x805C5485, 0x804B958C, 0x8042D465,
+    0x804AC185, 0x80968AA5, 0x80AAA465, 0x803425A5, 0x81742585, 0x809616AD, 0x803625A5, 0x805C2585,
+    0x8058D530, 0x00000477, 0x8082B138, 0x803426C5, 0x8058D536, 0x8022912D, 0x80D29123, 0x805224D9,
+    0x80562485, 0x8042D92C, 0x8042A4D9, 0x80648D05, 0x80248985, 0x81049465, 0x8104C6A5, 0x8104E125,
+    0x81949584, 0x81749584, 0x80649584, 0x81570D85, 0x80B7158C, 0x80E2DD99, 0x817295D9, 0x802615C4,
+    0x815815C4, 0x80E29499, 0x805695C4, 0x815712A5, 0x8056192E, 0x80B724C5, 0x811AA5C5, 0x817425C5,
+    0x80E49465, 0x80A2B9D9, 0x00000478, 0x8162BAA5, 0x8062B865, 0x8082B865, 0x8102B9D9, 0x8102B9C5,
+    0x8102B865, 0x8174B865, 0x80D4B965, 0x80D4B865, 0x8104B865, 0x80729579, 0x802A9D85, 0x806A9EA5,
+    0x8072B5B9, 0x807AA485, 0x80762485, 0x8055A5C7, 0x8022A5C7, 0x8072B929, 0x802AB0E5, 0x80B654E5,
+    0x81029CF9, 0x80C29CF9, 0x808290E5, 0x817290E5, 0x00000479, 0x806A90E5, 0x80C290E5, 0x8022A4E5,
+    0x8172A4E8, 0x80C494E5, 0x80E2A4E8, 0x8082B8E5, 0x807AB8E5, 0x80CAB8E5, 0x80DAB8E5, 0x8084B8E5,
+    0x802289F0, 0x8022B1F7, 0x805609F7, 0x80583F19, 0x80583C68, 0x8102ADE5, 0x80278C65, 0x8037D605,
+    0x0000047A, 0x80378985, 0x8027BF45, 0x80343D65, 0x81743D85, 0x0000047B, 0x80FB5585, 0x805B3D65,
+    0x8042B5E2, 0x8056BD49, 0x8027DD25, 0x80D7E125, 0x8167A465, 0x8167A585, 0x80F626C5, 0x80D7D925,
+    0x80FC2485, 0x0000047C, 0x80C2B5EE, 0x80E78985, 0x80363DC5, 0x80FD3DC5, 0x81043DC5, 0x0000047D,
+    0x80513DD9, 0x8102BDD9, 0x8162B9ED, 0x8182B9EE, 0x80FAB865, 0x0000047E, 0x802299E7, 0x81679EA5,
+    0x80763EC5, 0x80F3A6C5, 0x808790E5, 0x802790E5, 0x817790E5, 0x80C790E5, 0x80A2B18F, 0x8032B18F,
+    0x8082B18F, 0x80D2EB4F, 0x0000047F, 0x805B15D4, 0x80551474, 0x8056BE85, 0x805A21CF, 0x80229DF4,
+    0x80B16685, 0x8102D299, 0x8056C299, 0x80A2D299, 0x805A232C, 0x8172D199, 0x80C2BA8F, 0x8167B285,
+    0x805C51EC, 0x80B71594, 0x8072D2B0, 0x811ABE85, 0x81049699, 0x81742685, 0x8174D105, 0x80971614,
+    0x805B2474, 0x81572685, 0x815A2585, 0x8102DD34, 0x81575125, 0x8042C288, 0x8042D1F8, 0x8162B094,
+    0x80522474, 0x8042B534, 0x8142B199, 0x8142B614, 0x8142C124, 0x81429688, 0x8142BA88, 0x814AC6A5,
+    0x814BA465, 0x8144D185, 0x814AB185, 0x814465A5, 0x801BBD65, 0x80113EC5, 0x810AC025, 0x80B28822,
+    0x80341430, 0x80D28C61, 0x8037B425, 0x00000480, 0x80628C2C, 0x80328C2C, 0x8174142C, 0x8058D42C,
+    0x80168985, 0x80C2B5A1, 0x80184185, 0x8016C185, 0x80C29C2C, 0x80161608, 0x8026142B, 0x801626C5,
+    0x00000481, 0x81028579, 0x802286B8, 0x817286C5, 0x80180465, 0x81028465, 0x808286D9, 0x808286C5,
+    0x803404C5, 0x81028468, 0x80228468, 0x809684E5, 0x801386C5, 0x810404E5, 0x8056852C, 0x80C28468,
+    0x80C286C5, 0x81740585, 0x80C28579, 0x80C284D9, 0x80D28599, 0x80660565, 0x81060465, 0x803606C5,
+    0x806605A5, 0x80260745, 0x802605A5, 0x80760745, 0x801725A5, 0x805715A1, 0x80E7D825, 0x8022B42E,
+    0x81028C2E, 0x81629C2E, 0x80172D85, 0x8162B82C, 0x81563825, 0x8056582E, 0x8016A5C5, 0x808C95C1,
+    0x809705C5, 0x80D285D9, 0x80428C26, 0x805215A1, 0x80D29121, 0x80123C45, 0x80112485, 0x8016A485,
+    0x80113C85, 0x80428C39, 0x80121185, 0x8042B039, 0x8092142C, 0x80428C2C, 0x8102902C, 0x805B0485,
+    0x80828499, 0x80360485, 0x8164D025, 0x8042B281, 0x80D2D02C, 0x80138685, 0x80828688, 0x80428688,
+    0x80D28699, 0x80FB0685, 0x80110685, 0x80229C34, 0x81741434, 0x80341434, 0x80429834, 0x805C4034,
+    0x80361434, 0x805C0474, 0x805C0594, 0x801715D4, 0x8100942E, 0x80D0E445, 0x8060AD25, 0x00000482,
+    0x80D0A745, 0x80D0B8E5, 0x817090E5, 0x8070D745, 0x80C09185, 0x80608985, 0x80D0C185, 0x8040B865,
+    0x812416AD, 0x805C5642, 0x811A9659, 0x806915EE, 0x8082BA59, 0x80E29E4F, 0x8122BE47, 0x8062B6B2,
+    0x8122C199, 0x80C2B6B2, 0x812291F8, 0x81229199, 0x8122B538, 0x81229124, 0x8122A569, 0x81228EB2,
+    0x80428E59, 0x805B1659, 0x80C29659, 0x00000483, 0x80793E05, 0x00000484, 0x81093D85, 0x81279EA5,
+    0x8127D4E5, 0x810955C5, 0x812465A5, 0x807955A5, 0x80293D65, 0x81093C45, 0x812A8985, 0x80495605,
+    0x80493EC5, 0x812415A5, 0x80791445, 0x802916C5, 0x81741645, 0x80F71645, 0x8072BA45, 0x8122DAA5,
+    0x81249985, 0x80975645, 0x81092745, 0x80792605, 0x815925C5, 0x811AA645, 0x810925A5, 0x807925A5,
+    0x802925C5, 0x80292445, 0x80E7A645, 0x80D7A645, 0x81092485, 0x812A8D05, 0x80393DC5, 0x80CA8E45,
+    0x80F1A245, 0x80391605, 0x81792685, 0x8122D068, 0x8122D259, 0x818A164D, 0x80575259, 0x80D2D245,
+    0x80C4D245, 0x80D4D245, 0x80E4D245, 0x8122D24F, 0x815A164F, 0x8122B534, 0x81229934, 0x8122B134,
+    0x80971654, 0x805C1654, 0x814B964B, 0x81493EC5, 0x81492685, 0x81492445, 0x81492565, 0x80191EA5,
+    0x801915C1, 0x8019142C, 0x8039142D, 0x80361432, 0x8179142B, 0x8069142B, 0x8039142B, 0x80261432,
+    0x8029142D, 0x8122B430, 0x81228C30, 0x00000485, 0x8162B032, 0x8122C039, 0x8122B039, 0x8122B038,
+    0x8122A022, 0x00000486, 0x80790465, 0x00000487, 0x80790605, 0x80390605, 0x803905C5, 0x00000488,
+    0x80290465, 0x80290565, 0x8122858D, 0x80F81641, 0x80181659, 0x801D5645, 0x80133E45, 0x80660645,
+    0x801B8645, 0x80760645, 0x81740645, 0x8122864D, 0x80C2864E, 0x8102864C, 0x8192864E, 0x81728659,
+    0x80491432, 0x8042DC32, 0x80790485, 0x80490605, 0x80F90685, 0x80990685, 0x80790685, 0x801B1654,
+    0x8120B8E5, 0x806ACB45, 0x8052C925, 0x8162CAC5, 0x8044C8E5, 0x80D2C8E5, 0x810AC8E5, 0x8062CA4F,
+    0x805949F2, 0x8182C9F8, 0x8087C885, 0x8077C8E5, 0x8122CAAE, 0x8082C9EE, 0x803ACAC5, 0x8082C859,
+    0x80A2C979, 0x00000489, 0x8062CA59, 0x80A2CA59, 0x8042C859, 0x8102CA59, 0x8062C9D9, 0x80E2CAD9,
+    0x80D0C825, 0x80D0C8E5, 0x8102DCA5, 0x80568CA5, 0x803414B0, 0x0000048A, 0x8037D8B9, 0x8087B4B9,
+    0x8077BCB9, 0x8037BCA5, 0x8087BCB9, 0x0000048B, 0x8037ACB9, 0x8087ACB9, 0x803414AB, 0x8027ACA8,
+    0x8197ACAC, 0x0000048C, 0x8087B0B9, 0x0000048D, 0x8087D8AC, 0x0000048E, 0x817414AC, 0x80A2DCAC,
+    0x80C2D8AC, 0x80CC8CA5, 0x80D2B0A5, 0x80C2D8A5, 0x815688AC, 0x8027DCAC, 0x8022E8AC, 0x802654B9,
+    0x80C4B4B9, 0x8104E0AC, 0x8177D8AE, 0x8177B4AE, 0x815740A7, 0x811A94AE, 0x0000048F, 0x8177ACAE,
+    0x808CB4AE, 0x8087B8B9, 0x80D7B8B9, 0x80CAB4AE, 0x80E7D8AC, 0x80E2DCAC, 0x8104B8B9, 0x8174E8AE,
+    0x8164E0AE, 0x80C4D8AE, 0x80C4B8AE, 0x80C4ACAE, 0x8047C0B9, 0x80D790AD, 0x803790B8, 0x8047DCAC,
+    0x819790AC, 0x816490AF, 0x808490B9, 0x8047E8AE, 0x817490AE, 0x00000490, 0x80F318A4, 0x00000491,
+    0x00000492, 0x80F7E8A4, 0x80D2DCA4, 0x00000493, 0x80D7BCA4, 0x806AB4A4, 0x8047B4A4, 0x00000494,
+    0x00000495, 0x8107BCA4, 0x8156C0A4, 0x80D7C0A4, 0x00000496, 0x8087ACA4, 0x80F7A0A4, 0x8087B4A4,
+    0x808CC0A4, 0x8087C0A4, 0x805108A4, 0x807C88A4, 0x803A88A4, 0x805688A4, 0x802790A4, 0x8027E0A4,
+    0x8027BCA4, 0x8027DCA4, 0x80DAB0A4, 0x80F3B0A4, 0x00000497, 0x00000498, 0x810AB0A4, 0x8107B0A4,
+    0x80CA88A4, 0x807654A4, 0x802654A4, 0x00000499, 0x0000049A, 0x81648CA4, 0x0000049B, 0x80D4B4A4,
+    0x0000049C, 0x8096C0A4, 0x80A488A4, 0x8024C0A4, 0x802490A4, 0x8024ACA4, 0x0000049D, 0x0000049E,
+    0x8064B0A4, 0x80F4B0A4, 0x80C4ACA4, 0x810624A4, 0x0000049F, 0x80FBB8A4, 0x000004A0, 0x8087B8A4,
+    0x80B714A4, 0x000004A1, 0x80EAACA4, 0x000004A2, 0x000004A3, 0x8174B8A4, 0x80D4B8A4, 0x8104B8A4,
+    0x8104C0B4, 0x8056B4B4, 0x8072B8B4, 0x8037D8B4, 0x815734B4, 0x8022D0AC, 0x806614B4, 0x809730B4,
+    0x8074B0B4, 0x80D7D0AC, 0x80B4D0A4, 0x80D2D0A4, 0x8167D0A4, 0x80E7D0A4, 0x8047D0A4, 0x814424A6,
+    0x8142C0A5, 0x814490A4, 0x8144B0A4, 0x814A88A4, 0x8144B4A4, 0x8147D0AD, 0x8147D0A4, 0x801630B9,
+    0x801268A4, 0x8014B0A4, 0x801738B8, 0x801710A4, 0x801BB8A4, 0x000004A4, 0x000004A5, 0x000004A6,
+    0x000004A7, 0x8170ACA4, 0x80F0ACA4, 0x8030B8A4, 0x8170B8A4, 0x80E0ACA4, 0x8170E0AE, 0x8170ACAE,
+    0x80F0ACAE, 0x8170B0A4, 0x8020B0A4, 0x000004A8, 0x80E0D8AC, 0x802088AC, 0x8070D8AC, 0x80C088AC,
+    0x80C090AE, 0x000004A9, 0x80C090A4, 0x80C0E8A4, 0x80309CB9, 0x8190DCA4, 0x000004AA, 0x80D08CA4,
+    0x80D0DCA4, 0x80D0B8A4, 0x80D0D8AE, 0x8060B4A4, 0x8030B4AF, 0x80E0B4A4, 0x8070B4A4, 0x000004AB,
+    0x81008CA4, 0x8030C0A4, 0x8160C0A4, 0x8100D8A4, 0x8100B8A4, 0x8100B8AC, 0x8100B0A4, 0x81008CB9,
+    0x8100E4A5, 0x8080D8AE, 0x8080E8A4, 0x8080E8AC, 0x80D0D0B9, 0x8050D0AE, 0x8100D0AE, 0x80F0D0AE,
+    0x8080D0A4, 0x8020D0A4, 0x8070D0A4, 0x80D0D0A4, 0x000004AC, 0x803914AB, 0x000004AD, 0x803414B2,
+    0x000004AE, 0x80F1ACB2, 0x000004AF, 0x8087D8B2, 0x80F1A0B2, 0x8177BCB2, 0x000004B0, 0x8037B4B2,
+    0x8087B4B2, 0x000004B1, 0x808CC0B2, 0x000004B2, 0x8037C0B2, 0x8087C0B2, 0x80D7C0B2, 0x803914B0,
+    0x805688B2, 0x803C88B2, 0x815688B2, 0x8027E0B2, 0x8027DCB2, 0x802AE4B2, 0x8027E4B2, 0x000004B3,
+    0x000004B4, 0x80F3B0B2, 0x8127DCAC, 0x000004B5, 0x812AB0B2, 0x80CA9CB2, 0x000004B6, 0x8122C0AC,
+    0x80C2C0B2, 0x8107B0B2, 0x80C7C0B2, 0x806614B2, 0x807654B2, 0x81560CB2, 0x805658B2, 0x806664B2,
+    0x000004B7, 0x000004B8, 0x80D4E0B2, 0x80D4B4B2, 0x000004B9, 0x8124C0B2, 0x8096C0B2, 0x807488B2,
+    0x000004BA, 0x80C498B2, 0x8064B0B2, 0x8164B0B2, 0x80C4D8B2, 0x80F4B0B2, 0x807924A6, 0x8091A4B2,
+    0x810924B2, 0x802924B2, 0x000004BB, 0x807914AE, 0x8122B8B7, 0x000004BC, 0x80F70CB2, 0x80FBB8B2,
+    0x8087B8B2, 0x000004BD, 0x80972CB2, 0x809718B2, 0x80E48CB2, 0x809738B2, 0x80D4B8B2, 0x000004BE,
+    0x803290B2, 0x000004BF, 0x000004C0, 0x803790B2, 0x803C90B2, 0x804964B2, 0x8047C0B2, 0x000004C1,
+    0x804AC0B2, 0x80F610B2, 0x000004C2, 0x80448CB2, 0x803490B2, 0x808490B2, 0x805490B2, 0x8044ACB2,
+    0x80EA90B2, 0x815710B2, 0x000004C3, 0x81591CA4, 0x8122DCA4, 0x000004C4, 0x803914A4, 0x8127C0A4,
+    0x812788A4, 0x8124D8A4, 0x8124B4A4, 0x81248CA4, 0x80992CA4, 0x810924A4, 0x804924A4, 0x803924A4,
+    0x806924A4, 0x805A20B2, 0x8122D8B4, 0x807914B4, 0x803AD0B2, 0x80DAD0B2, 0x805750B2, 0x8102D0B2,
+    0x80D4D0B2, 0x8024D0B2, 0x80C4D0B2, 0x80E4D0B2, 0x80B4D0B2, 0x8167D0B2, 0x814B94B2, 0x8147DCB2,
+    0x8147C0B2, 0x8147B8B2, 0x8144B4B2, 0x801A9CB2, 0x000004C5, 0x000004C6, 0x000004C7, 0x000004C8,
+    0x8030D8B2, 0x000004C9, 0x000004CA, 0x81208CA4, 0x8120D8A4, 0x80509CB2, 0x80309CB2, 0x81709CB2,
+    0x81209CA4, 0x8070E8B2, 0x8120D8AC, 0x8020B0B2, 0x000004CB, 0x8120E4A4, 0x8120C0A4, 0x8100D8B2,
+    0x81008CB2, 0x000004CC, 0x8080E8B2, 0x000004CD, 0x8030D0B2, 0x8080D0B2, 0x80D0D0B2, 0x8100D0B2,
+    0x8140E0B2, 0x80D2C8B2, 0x8174C8B2, 0x8084C8B2, 0x8064C8B2, 0x810AC8B2, 0x80CAC8B8, 0x805948A4,
+    0x80D4C8A4, 0x8174C8A4, 0x8084C8A4, 0x8064C8A4, 0x8027C8A4, 0x8077C8A4, 0x8107C8A4, 0x8170C8BA,
+    0x000004CE, 0x8020C8A4, 0x80F0C8A4, 0x8030C8A4, 0x8080C8A4, 0x8120C8B2, 0x8020C8B2, 0x8030C8B2,
+    0x8100C8B2, 0x8131D4C6, 0x80DACD23, 0x000004CF, 0x813BA75A, 0x8135A4C6, 0x8136246B, 0x8135D58B,
+    0x81349D2C, 0x8131D58C, 0x8135D58C, 0x813BA58C, 0x813824C6, 0x8138258C, 0x813AC20C, 0x8135A5B0,
+    0x80665668, 0x80265668, 0x81365668, 0x813BA668, 0x813ACD09, 0x8134546B, 0x81345668, 0x8174266B,
+    0x8134258C, 0x8137B124, 0x8027CDED, 0x8074CDAF, 0x80D4CC8F, 0x81378D2F, 0x81348D6F, 0x8137D4E8,
+    0x80B4BE6B, 0x8136BD6F, 0x8136BC6B, 0x8131BCC6, 0x8131BEEC, 0x813BBDF0, 0x81383DE6, 0x81383DEC,
+    0x81363DF0, 0x81383D2C, 0x8131BDF0, 0x81383DEB, 0x8177BE68, 0x81743E6F, 0x81343DEB, 0x813754C6,
+    0x813724C6, 0x8137B923, 0x8027CEAE, 0x8131A5EE, 0x8134B5EE, 0x8027CDEE, 0x813BBDEE, 0x81373DEB,
+    0x81383DEE, 0x813625CB, 0x8135D5CB, 0x813655CB, 0x813BA5C7, 0x813625C7, 0x8159A5C7, 0x813AA5C7,
+    0x813BD5C7, 0x81348B2C, 0x802ACC59, 0x000004D0, 0x804ACD79, 0x813AB179, 0x8134B199, 0x8134B179,
+    0x80DACD79, 0x8136A599, 0x813625B9, 0x000004D1, 0x813A9279, 0x8034CE79, 0x8134CE79, 0x80DACE79,
+    0x813855B9, 0x8174CE19, 0x81382579, 0x81382479, 0x807CC279, 0x8074C279, 0x810ACE79, 0x000004D2,
+    0x000004D3, 0x802ACD19, 0x000004D4, 0x807ACD19, 0x81379CF9, 0x80C7CE79, 0x8027CE79, 0x80C7D679,
+    0x80D7CE79, 0x80D7D679, 0x8137D619, 0x813A24C6, 0x813A246B, 0x813A258C, 0x8044D279, 0x813A6589,
+    0x8134B299, 0x8134E288, 0x8134E299, 0x813A3DF0, 0x813A3C6B, 0x813A3D23, 0x813A3DEC, 0x81363E88,
+    0x813A112F, 0x813A3DE4, 0x8137BE88, 0x8137BE99, 0x000004D5, 0x802ACE99, 0x80A4D275, 0x80CACE99,
+    0x000004D6, 0x813A3EB0, 0x813A54C6, 0x813A546B, 0x813A5499, 0x813A25CB, 0x813A55CB, 0x8164CD34,
+    0x81383134, 0x000004D7, 0x81382594, 0x80449274, 0x81349D14, 0x813424D4, 0x81742674, 0x8131BDF4,
+    0x81343DF4, 0x8027BE74, 0x8107CD34, 0x80A7A674, 0x8087A674, 0x8067A674, 0x813A3EB4, 0x8131BEB4,
+    0x81343EB4, 0x81383EB4, 0x813A25D4, 0x813A55D4, 0x8019C123, 0x8067CE61, 0x8019CDE3, 0x81574C39,
+    0x813AB423, 0x8138D424, 0x8138D422, 0x81349DA1, 0x811A8669, 0x81378619, 0x8138066D, 0x813704D5,
+    0x813185B0, 0x81370579, 0x813805CB, 0x8137046B, 0x8136846B, 0x811A8668, 0x80110668, 0x80770668,
+    0x81340499, 0x81340579, 0x813405CB, 0x813B85B0, 0x813B85A9, 0x813B85CB, 0x813AB0C1, 0x8066066B,
+    0x8109858D, 0x8106066D, 0x81318590, 0x81318584, 0x813605C7, 0x8136052E, 0x8136046B, 0x81318599,
+    0x80660668, 0x81060668, 0x80360668, 0x8135BC2C, 0x8137052C, 0x813A3DA1, 0x8164CE81, 0x000004D8,
+    0x813A05B0, 0x813A0524, 0x000004D9, 0x813A052E, 0x813B8688, 0x813A04F9, 0x813A058C, 0x8138D434,
+    0x813A3C34, 0x80278674, 0x81309115, 0x8130B441, 0x8130A122, 0x8130DAD9, 0x81309CF9, 0x8130D479,
+    0x8170CD19, 0x8040A679, 0x8130CE79, 0x8070CE79, 0x8020CD2C, 0x8130B024, 0x8130B261, 0x813089F4,
+    0x8170A674, 0x8130B299, 0x813BA64C, 0x8124CD79, 0x8136A64B, 0x8069266B, 0x8164CDF2, 0x813BBE4E,
+    0x8159D659, 0x8138564E, 0x8159D650, 0x81342652, 0x813A3E4D, 0x813A3E4B, 0x813A3E59, 0x81383E54,
+    0x8127D674, 0x81792674, 0x8137B032, 0x813B864D, 0x8138064B, 0x8137064B, 0x81370646, 0x80194DEE,
+    0x8137064C, 0x81318659, 0x8134064B, 0x813B8654, 0x8137CA59, 0x8131C9E7, 0x813A4930, 0x817ACA74,
+    0x813A4839, 0x810996A4, 0x81079679, 0x813B958C, 0x000004DA, 0x8136958C, 0x8138158C, 0x8138146B,
+    0x8172B268, 0x8102CD79, 0x8072CE6F, 0x80C2CC4F, 0x80D2CE79, 0x8132C1F9, 0x813290F9, 0x81328AAD,
+    0x813292AD, 0x8132B0D9, 0x80E2DE79, 0x000004DB, 0x80D7BE65, 0x8047D665, 0x80D7D665, 0x80C7BE65,
+    0x80C7D665, 0x810AB265, 0x8037C265, 0x80363E65, 0x81743E65, 0x8087D665, 0x80343E65, 0x8137D665,
+    0x8137B2C5, 0x81343EC5, 0x8136BD65, 0x81383D65, 0x8131BE05, 0x81363E05, 0x813855A5, 0x813B9485,
+    0x81329EA5, 0x80C4CD85, 0x813496C5, 0x8107A665, 0x8135A6C5, 0x81362485, 0x81362465, 0x8136A585,
+    0x813625A5, 0x000004DC, 0x81382465, 0x8134B8E5, 0x81372605, 0x81343DC5, 0x813BA5C5, 0x813825C5,
+    0x813425C5, 0x81A2CE99, 0x81729674, 0x811A9674, 0x807A9674, 0x80341674, 0x8131D685, 0x813A9699,
+    0x813A15D4, 0x813B9614, 0x80479674, 0x8136BE85, 0x813A3D65, 0x813A3DC5, 0x813A3EC5, 0x805C2674,
+    0x8082A674, 0x8135A685, 0x813AA685, 0x8136A685, 0x813A6585, 0x8019A485, 0x8059CC39, 0x8132B9C1,
+    0x8137142B, 0x8138142B, 0x813285B9, 0x815984E5, 0x813A86C5, 0x81380485, 0x81318605, 0x81380465,
+    0x81380565, 0x813606C5, 0x80172665, 0x8016D665, 0x80110665, 0x80328665, 0x81558665, 0x813406C5,
+    0x813405A5, 0x81340565, 0x81340485, 0x813B9434, 0x8132D025, 0x813A142D, 0x81928674, 0x80228674,
+    0x80628674, 0x813A06C5, 0x813A04E5, 0x813A0685, 0x8170CE85, 0x8122D665, 0x80293E65, 0x813BBE45,
+    0x813B9432, 0x81380645, 0x80193E65, 0x8177CA65, 0x810ACA65, 0x803ACA65, 0x80EACA65, 0x8135E4B9,
+    0x813614AB, 0x813824AC, 0x813614B0, 0x8107CCB9, 0x806ACCAC, 0x80E4CCA9, 0x813414AE, 0x8132D8AE,
+    0x8132E0A4, 0x8164CCA4, 0x000004DD, 0x8135A4A4, 0x813424A4, 0x813814A4, 0x813824A4, 0x8047CCA4,
+    0x8137B0A4, 0x8107CCA4, 0x8087CCA4, 0x80DACCA4, 0x802ACCA4, 0x806ACCA4, 0x8022CCB4, 0x81574CB4,
+    0x813B94B4, 0x813594B4, 0x813414B4, 0x8019CCAE, 0x8050CCA4, 0x8130DCA4, 0x813714B2, 0x813788B2,
+    0x8132D8B2, 0x813AC0B2, 0x8132E0B2, 0x8137DCB2, 0x80F9A4B2, 0x813624B2, 0x8134E8B2, 0x80DACCB2,
+    0x8107CCB2, 0x8124CCAE, 0x8124CCB2, 0x8159A0B2, 0x80D0CCB2, 0x000004DE, 0x8130ACB2, 0x8130B8B2,
+    0x81309CB2, 0x813448B7, 0x813AC8B2, 0x000004DF, 0x000004E0, 0x808A98D3, 0x8131D5B3, 0x803455B3,
+    0x000004E1, 0x808AB6B3, 0x000004E2, 0x000004E3, 0x80849D13, 0x80648EB3, 0x000004E4, 0x000004E5,
+    0x8131D493, 0x804A98D3, 0x000004E6, 0x811AA493, 0x80D49133, 0x000004E7, 0x8074B613, 0x8174B613,
+    0x000004E8, 0x803ACE13, 0x000004E9, 0x8174CE13, 0x000004EA, 0x808AB613, 0x81745613, 0x80342613,
+    0x81742613, 0x81342613, 0x810A98D3, 0x810AB613, 0x8104B613, 0x810A8933, 0x810CE133, 0x000004EB,
+    0x8064B193, 0x000004EC, 0x000004ED, 0x806AB193, 0x80D4B193, 0x80D4B0D3, 0x8064B1B3, 0x80DAB193,
+    0x80C4B453, 0x000004EE, 0x804AB193, 0x80D4B093, 0x80CAC2B3, 0x807AB213, 0x80C4CE13, 0x80CAB613,
+    0x810AB213, 0x810AB193, 0x80262673, 0x80665453, 0x813654F3, 0x80365453, 0x809632B3, 0x813625B3,
+    0x807655B3, 0x813655B3, 0x80662613, 0x81362613, 0x80362613, 0x80262613, 0x810655B3, 0x80AA91F3,
+    0x000004EF, 0x000004F0, 0x8037A4D3, 0x80FB55B3, 0x80D792B3, 0x813AB5F3, 0x8037B5B3, 0x80279EB3,
+    0x815689F3, 0x000004F1, 0x8037B453, 0x80FAE9F3, 0x000004F2, 0x000004F3, 0x8087B5F3, 0x000004F4,
+    0x808CC1F3, 0x8137D613, 0x8037D613, 0x8107B613, 0x8107D4D3, 0x000004F5, 0x000004F6, 0x000004F7,
+    0x8067A593, 0x000004F8, 0x000004F9, 0x000004FA, 0x8067B093, 0x000004FB, 0x000004FC, 0x8037A593,
+    0x8037B093, 0x8087DD93, 0x8087B093, 0x80C78D13, 0x8107B1F3, 0x8107B333, 0x8107B193, 0x000004FD,
+    0x000004FE, 0x000004FF, 0x8087BCD3, 0x8131BEF3, 0x00000500, 0x8177BCD3, 0x8047BDB3, 0x80443EF3,
+    0x00000501, 0x8087BC93, 0x8177BC93, 0x802ABF33, 0x8037BE13, 0x8087BE13, 0x81743E13, 0x80343E13,
+    0x81343E13, 0x8107BCD3, 0x8104BEB3, 0x8107BE13, 0x8107BD13, 0x80C7BDB3, 0x00000502, 0x8037BD93,
+    0x8164BD93, 0x80923D93, 0x00000503, 0x80663E73, 0x81363C53, 0x00000504, 0x81363EF3, 0x00000505,
+    0x80763E73, 0x80763EF3, 0x00000506, 0x81363CF3, 0x80663E13, 0x81363E13, 0x80363E13, 0x81063E13,
+    0x81063EF3, 0x81063C93, 0x81063F33, 0x813CB873, 0x00000507, 0x802AB8F3, 0x80DAB8F3, 0x80EAB453,
+    0x00000508, 0x8084B8F3, 0x8134BAB3, 0x80D4BAB3, 0x8064B933, 0x80D4B933, 0x00000509, 0x0000050A,
+    0x8084B893, 0x80D4B893, 0x80EAB193, 0x80CAB8F3, 0x80D7B9F3, 0x0000050B, 0x8077B8F3, 0x809719F3,
+    0x8174B9F3, 0x8027BAB3, 0x8027B8F3, 0x8047B8F3, 0x8027B893, 0x8107B8F3, 0x81373EF3, 0x81373C53,
+    0x80E7BC53, 0x81373CF3, 0x808CB5D3, 0x813455D3, 0x80A4B9D3, 0x81349DD3, 0x811AA5D3, 0x803425D3,
+    0x0000050C, 0x8037A5D3, 0x80A7A1D3, 0x80A7A5D3, 0x80E7D5D3, 0x80DABDD3, 0x0000050D, 0x8027BDD3,
+    0x8091BDD3, 0x8037BDD3, 0x8087BDD3, 0x80C7BDD3, 0x0000050E, 0x8135A5B3, 0x8135A493, 0x0000050F,
+    0x804A8D73, 0x00000510, 0x80448D73, 0x813A8D73, 0x81348D73, 0x00000511, 0x804ACD73, 0x810A8D73,
+    0x00000512, 0x8134B173, 0x80C48D73, 0x808AB173, 0x813AB173, 0x80CA8D73, 0x8024B173, 0x802AB173,
+    0x8137D573, 0x00000513, 0x80378D73, 0x80878D73, 0x80BA91F3, 0x80478D73, 0x80B4B1F3, 0x80C78D73,
+    0x8197B173, 0x00000514, 0x8027BD73, 0x8037BD73, 0x8087BD73, 0x00000515, 0x8064B973, 0x00000516,
+    0x806AB973, 0x80B4B893, 0x804AB973, 0x807AB973, 0x80B4B8F3, 0x810AB973, 0x00000517, 0x80E78D73,
+    0x8037B973, 0x8087B973, 0x8177B973, 0x8197B973, 0x80E7BD73, 0x80B73EF3, 0x8109CE93, 0x808A5213,
+    0x80749A93, 0x00000518, 0x81349A93, 0x00000519, 0x0000051A, 0x81742693, 0x81342693, 0x0000051B,
+    0x8084BA93, 0x80B72693, 0x81372693, 0x0000051C, 0x8134B293, 0x8084B293, 0x80662693, 0x81362693,
+    0x80B4B293, 0x80C4CE93, 0x80C49A93, 0x80C4B293, 0x80C4BA93, 0x80F12693, 0x81343E93, 0x813A3E13,
+    0x81383E93, 0x813BBE93, 0x813A3EF3, 0x80B73E93, 0x81373E93, 0x81063E93, 0x80263E93, 0x81363E93,
+    0x8107CE93, 0x8067BA93, 0x8027BE93, 0x8067BE93, 0x8077D113, 0x8087CE93, 0x8087BE93, 0x8167B293,
+    0x80A7B293, 0x8027B293, 0x8047B293, 0x80C7BE93, 0x803CCE93, 0x8037CE93, 0x0000051D, 0x0000051E,
+    0x813AA693, 0x0000051F, 0x81572693, 0x00000520, 0x813A55D3, 0x802AD293, 0x802ACE93, 0x802ABA93,
+    0x813A5453, 0x81365693, 0x8027D693, 0x8077D693, 0x8107D693, 0x80DCD113, 0x80D4CE93, 0x80D4D293,
+    0x80D4BA93, 0x80D7D113, 0x813A55B3, 0x80DAD293, 0x8136D693, 0x814AD2B3, 0x814CC1F3, 0x8147B453,
+    0x8147DDD3, 0x8147B8F3, 0x814ACD73, 0x814A8D73, 0x81478D73, 0x81479AB3, 0x814BA5D3, 0x8144B8F3,
+    0x8144AD33, 0x8147D693, 0x81443EB3, 0x814454F3, 0x00000521, 0x8135D433, 0x80172D13, 0x807706F3,
+    0x00000522, 0x80B405D3, 0x00000523, 0x8044D833, 0x811A8493, 0x81340493, 0x80116673, 0x811A8733,
+    0x813B8733, 0x801C8513, 0x81340733, 0x804C8493, 0x81318493, 0x81318453, 0x813184F3, 0x8011A493,
+    0x813185D3, 0x803C85D3, 0x808AB033, 0x80CA86B3, 0x801C2593, 0x804A8593, 0x81648593, 0x00000524,
+    0x00000525, 0x00000526, 0x80162433, 0x806605D3, 0x00000527, 0x807605D3, 0x00000528, 0x802604F3,
+    0x80360673, 0x80360493, 0x803606F3, 0x803605D3, 0x80360733, 0x80F58733, 0x801225F3, 0x81378573,
+    0x80778493, 0x80B785D3, 0x81379833, 0x81379033, 0x80E7D833, 0x80378C33, 0x80379033, 0x803405F3,
+    0x803485F3, 0x00000529, 0x0000052A, 0x80C784D3, 0x80FB0593, 0x80778593, 0x8037B033, 0x801B3EF3,
+    0x801C3DD3, 0x80173DD3, 0x80143F33, 0x80DCB833, 0x80D4B833, 0x80168673, 0x80D785D3, 0x809685B3,
+    0x817405B3, 0x801655B3, 0x813605B3, 0x80184D33, 0x81380733, 0x813805D3, 0x813B8613, 0x81360613,
+    0x80660613, 0x810605D3, 0x81060733, 0x81378613, 0x815A05D3, 0x813A04F3, 0x813A0453, 0x813A0733,
+    0x8104D033, 0x801AD1F3, 0x80115693, 0x80740693, 0x813A0693, 0x81380693, 0x81740693, 0x813B8693,
+    0x801ABA93, 0x80770693, 0x80778693, 0x80278693, 0x80D78693, 0x81318693, 0x80260693, 0x81360693,
+    0x81060693, 0x80660693, 0x0000052B, 0x0000052C, 0x0000052D, 0x8080DD73, 0x80808D73, 0x81609EB3,
+    0x8070D673, 0x0000052E, 0x80D09EB3, 0x0000052F, 0x81008D73, 0x8030C1F3, 0x8080CE13, 0x8160B613,
+    0x8030B613, 0x8020CD73, 0x00000530, 0x80C08D73, 0x00000531, 0x00000532, 0x8080B1F3, 0x8070BD93,
+    0x00000533, 0x8030B1B3, 0x00000534, 0x80C0B613, 0x8100B1B3, 0x8020B1B3, 0x8020B173, 0x8020DD93,
+    0x8020B193, 0x80F0CD33, 0x8170A4D3, 0x00000535, 0x8130A593, 0x8080A593, 0x8170A593, 0x80D0A593,
+    0x8170B973, 0x00000536, 0x8070B8F3, 0x8190B973, 0x8100B8F3, 0x8080B973, 0x8080B8F3, 0x8020B973,
+    0x00000537, 0x80B0BDD3, 0x8190DDD3, 0x8100DDD3, 0x8060D5D3, 0x80D0A5D3, 0x8070A5D3, 0x8170A5D3,
+    0x8100A5D3, 0x8040B613, 0x80409DF3, 0x806091F3, 0x8020DC93, 0x8130B893, 0x8040B8F3, 0x8080B893,
+    0x8170B893, 0x8040DDD3, 0x00000538, 0x8100CE93, 0x00000539, 0x80A0D1F3, 0x8170BA93, 0x8100BA93,
+    0x8020A693, 0x8070A693, 0x8170A693, 0x8130B293, 0x81008E93, 0x8030CE93, 0x0000053A, 0x8020D113,
+    0x8020A293, 0x80F0D113, 0x8140C033, 0x0000053B, 0x81742653, 0x806924F3, 0x0000053C, 0x80392673,
+    0x80392453, 0x8124CD73, 0x81248D73, 0x80393E73, 0x80693CF3, 0x80793E73, 0x0000053D, 0x80793EF3,
+    0x80793D73, 0x81093CD3, 0x81093EF3, 0x81093DB3, 0x81093E13, 0x0000053E, 0x81278D73, 0x8127B193,
+    0x8127A593, 0x80D7BE53, 0x8127BDB3, 0x8027BE53, 0x812A98D3, 0x812ACD73, 0x80795453, 0x81365653,
+    0x8087D653, 0x8137D653, 0x80C7D653, 0x8067D653, 0x8197D653, 0x8124B973, 0x80993DD3, 0x80824653,
+    0x80F23E53, 0x8127BC93, 0x80395493, 0x80495453, 0x804954F3, 0x804955B3, 0x813A2653, 0x81493EF3,
+    0x81493E93, 0x81493F33, 0x81492613, 0x80138653, 0x0000053F, 0x80278653, 0x812785D3, 0x81278493,
+    0x803D0653, 0x80F90593, 0x806904F3, 0x00000540, 0x80690733, 0x80790733, 0x00000541, 0x802904F3,
+    0x80790453, 0x80290733, 0x804906F3, 0x804904F3, 0x80790493, 0x80490733, 0x00000542, 0x00000543,
+    0x80390453, 0x80390733, 0x80390673, 0x81248593, 0x801955B3, 0x807905B3, 0x81090733, 0x81790613,
+    0x81090693, 0x814D0653, 0x81209C33, 0x8120CE13, 0x8120A493, 0x8080A653, 0x00000544, 0x00000545,
+    0x00000546, 0x00000547, 0x8177C893, 0x80E7C9B3, 0x00000548, 0x807CC9F3, 0x8197C973, 0x8107C9D3,
+    0x807ACAB3, 0x813AC8D3, 0x808AC993, 0x806AC993, 0x80DAC973, 0x80CAC973, 0x810ACA53, 0x802AC853,
+    0x802AC8F3, 0x802AC9D3, 0x802ACA53, 0x802AC993, 0x80B4C973, 0x8044C973, 0x8064C9B3, 0x8074C993,
+    0x8074C893, 0x8074C9F3, 0x80F94933, 0x8037C973, 0x8037C893, 0x8037C9B3, 0x8037C9D3, 0x803AC993,
+    0x8137CA93, 0x00000549, 0x8030CA13, 0x8100C973, 0x0000054A, 0x8080CA13, 0x80D0C833, 0x8100C833,
+    0x8170C9B3, 0x8170CA13, 0x8070C853, 0x8020C853, 0x8020C8D3, 0x8020C973, 0x80D0C993, 0x80E0C973,
+    0x8190C9D3, 0x8040C973, 0x8030C893, 0x8080C893, 0x8170C893, 0x8190C893, 0x80B0CA93, 0x8040CA93,
+    0x8170CA93, 0x8060CA93, 0x0000054B, 0x0000054C, 0x0000054D, 0x0000054E, 0x8062D493, 0x80D2B893,
+    0x80D2BAB3, 0x8132B533, 0x80228D73, 0x8022B893, 0x81A28AB3, 0x80E2BDD3, 0x80F28EB3, 0x80D2B5F3,
+    0x8042B5F3, 0x0000054F, 0x00000550, 0x00000551, 0x80429493, 0x813295B3, 0x80D29493, 0x804295B3,
+    0x00000552, 0x80379493, 0x805B15D3, 0x80B295D3, 0x80E29493, 0x80D495D3, 0x80FB15D3, 0x80F695D3,
+    0x816496F3, 0x81729573, 0x817295D3, 0x81729493, 0x81341493, 0x80341673, 0x813416F3, 0x80C2E133,
+    0x8042B133, 0x80C2B893, 0x00000553, 0x80C29573, 0x803614D3, 0x80261673, 0x80F615F3, 0x80C495D3,
+    0x807615D3, 0x81361493, 0x806616F3, 0x813616F3, 0x803616F3, 0x00000554, 0x8042B193, 0x805B2593,
+    0x8162A593, 0x8062B193, 0x8192B193, 0x80B29593, 0x80629593, 0x80E79593, 0x804A9593, 0x806A9593,
+    0x8102CDF3, 0x805C41F3, 0x81028D73, 0x80B2C133, 0x80582473, 0x8102B893, 0x8102B933, 0x8102BDD3,
+    0x81381473, 0x810795B3, 0x00000555, 0x00000556, 0x80F815D3, 0x80E29613, 0x810295D3, 0x80429613,
+    0x8192B213, 0x813A16F3, 0x813A1613, 0x813A1693, 0x81079693, 0x805A21F3, 0x81741693, 0x00000557,
+    0x00000558, 0x8062CE93, 0x00000559, 0x80C29A93, 0x8062B293, 0x8062D2B3, 0x0000055A, 0x8022B293,
+    0x80E2CE93, 0x80E2D293, 0x80E2DE93, 0x0000055B, 0x8022BA93, 0x8032BA93, 0x8102BA93, 0x813A15B3,
+    0x80D2D113, 0x80D2B293, 0x809A15B3, 0x8142B613, 0x8142E293, 0x814416F3, 0x801415B3, 0x80D2CC33,
+    0x81061433, 0x805C05B3, 0x813285B3, 0x81928513, 0x81028573, 0x80228573, 0x802286B3, 0x802285B3,
+    0x0000055C, 0x0000055D, 0x80D28593, 0x81028593, 0x80C28613, 0x80828593, 0x8012BDD3, 0x801B15D3,
+    0x817285D3, 0x80D285D3, 0x80A285D3, 0x80921433, 0x80D28493, 0x80C28493, 0x81028693, 0x80228693,
+    0x80D28693, 0x81A2D033, 0x8122C1F3, 0x8122B893, 0x0000055E, 0x803916F3, 0x817915D3, 0x0000055F,
+    0x810915B3, 0x81091673, 0x00000560, 0x812294D3, 0x81229593, 0x81229573, 0x81229493, 0x8172A653,
+    0x81049653, 0x80479653, 0x80FB1653, 0x81599653, 0x813A9653, 0x80779653, 0x80879653, 0x00000561,
+    0x80A29653, 0x80C29653, 0x81029653, 0x81091733, 0x81228613, 0x81228593, 0x812285B3, 0x00000562,
+    0x81228653, 0x80728653, 0x80228653, 0x81928653, 0x8132C8D3, 0x81A2C9F3, 0x80E2C893, 0x8062C9D3,
+    0x80A2C973, 0x8162C853, 0x8022C973, 0x8102CAD3, 0x00000563, 0x80628CB3, 0x8082E0B3, 0x00000564,
+    0x00000565, 0x00000566, 0x81343CB3, 0x00000567, 0x00000568, 0x8037B4B3, 0x8087B4B3, 0x00000569,
+    0x810A8CB3, 0x808CC0B3, 0x0000056A, 0x8037C0B3, 0x8087C0B3, 0x80D7C0B3, 0x80F13CB3, 0x807C88B3,
+    0x810A88B3, 0x802ACCB3, 0x0000056B, 0x80C79CB3, 0x80CAE0B3, 0x80CA9CB3, 0x0000056C, 0x80F3B0B3,
+    0x80DAB0B3, 0x80C7C0B3, 0x8107B0B3, 0x810AB0B3, 0x80CA88B3, 0x0000056D, 0x806614B3, 0x81363CB3,
+    0x80663CB3, 0x0000056E, 0x806654B3, 0x803654B3, 0x0000056F, 0x00000570, 0x00000571, 0x00000572,
+    0x80D4CCB3, 0x00000573, 0x80D4ACB3, 0x80A488B3, 0x807488B3, 0x816488B3, 0x00000574, 0x8099B0B3,
+    0x00000575, 0x8064B0B3, 0x80C4B4B3, 0x80D4B0B3, 0x809B24B3, 0x8135A4B3, 0x813424B3, 0x813824B3,
+    0x810624B3, 0x80B714B3, 0x80EAACB3, 0x80E7CCB3, 0x8072B8B3, 0x00000576, 0x80E7B8B3, 0x8037B8B3,
+    0x00000577, 0x8134B8B3, 0x80B4B8B3, 0x80D4B8B3, 0x8104B8B3, 0x00000578, 0x804AC0B3, 0x00000579,
+    0x8047C0B3, 0x0000057A, 0x0000057B, 0x80521CB3, 0x80479CB3, 0x804CACB3, 0x80C790B3, 0x8047B0B3,
+    0x0000057C, 0x813490B3, 0x80448CB3, 0x808490B3, 0x8044B4B3, 0x80E790B3, 0x80EA90B3, 0x8062D0B3,
+    0x80AAD0B3, 0x8074D0B3, 0x8034D0B3, 0x8134D0B3, 0x80B4D0B3, 0x80DAD0B3, 0x8167D0B3, 0x8037D0B3,
+    0x80E7D0B3, 0x8047D0B3, 0x814414B3, 0x814AE0B3, 0x8144B4B3, 0x814490B3, 0x8144B0B3, 0x8147D0B3,
+    0x8019CCB3, 0x801108B3, 0x8013D4B3, 0x80184CB3, 0x8011B8B3, 0x0000057D, 0x0000057E, 0x0000057F,
+    0x00000580, 0x00000581, 0x8160CCB3, 0x8130D8B3, 0x00000582, 0x00000583, 0x8040B4B3, 0x80E0B4B3,
+    0x8070B4B3, 0x00000584, 0x80D0E0B3, 0x80D0B8B3, 0x80D09CB3, 0x00000585, 0x80C090B3, 0x80C0CCB3,
+    0x80C0E0B3, 0x00000586, 0x8020B0B3, 0x8040B0B3, 0x8070B0B3, 0x00000587, 0x00000588, 0x8030CCB3,
+    0x81008CB3, 0x8030C0B3, 0x8080D8B3, 0x8080ACB3, 0x808090B3, 0x8080E8B3, 0x8130D0B3, 0x8040D0B3,
+    0x8060D0B3, 0x8070D0B3, 0x8140E0B3, 0x8127CCB3, 0x8127C0B3, 0x806914B3, 0x8127D8B3, 0x81591CB3,
+    0x8127D4B3, 0x812ACCB3, 0x8124D8B3, 0x8124B4B3, 0x8124CCB3, 0x81248CB3, 0x806924B3, 0x810924B3,
+    0x803924B3, 0x8120D8B3, 0x8120E8B3, 0x8120C0B3, 0x803AC8B3, 0x810CC8B3, 0x80CCC8B3, 0x8064C8B3,
+    0x8134C8B3, 0x8084C8B3, 0x8174C8B3, 0x00000589, 0x80F3C8B3, 0x8077C8B3, 0x8137C8B3, 0x8107C8B3,
+    0x0000058A, 0x8030C8B3, 0x8170C8B3, 0x8040C8B3, 0x818C6138, 0x818C62C9, 0x80A4B5B9, 0x80A498D9,
+    0x8174B619, 0x81A4C219, 0x818C6129, 0x818C2529, 0x80B4B979, 0x80E4B459, 0x80E4B449, 0x80E4B9D9,
+    0x81A4B8F9, 0x816CA5C7, 0x8104B868, 0x8104B9EE, 0x80A4B8EF, 0x80FBA5C7, 0x8107C219, 0x8107B5B9,
+    0x8177B979, 0x80D79CF9, 0x80F7B608, 0x8177BF59, 0x80B7BD79, 0x8027BC59, 0x8027BDB9, 0x8027BF59,
+    0x80E7BD79, 0x8077BE19, 0x81571938, 0x81576930, 0x808AB608, 0x0000058B, 0x808A98D9, 0x806AEB59,
+    0x80EA8859, 0x802AB9D9, 0x806AB9D9, 0x819AAD79, 0x0000058C, 0x806A9CF9, 0x807AB979, 0x807AB9D9,
+    0x807AB8F9, 0x819AB5B9, 0x810AB979, 0x80AAB619, 0x802AB619, 0x808AB619, 0x808AB868, 0x80DAB44F,
+    0x80C4C219, 0x80D4B179, 0x802625CB, 0x803625A2, 0x803625CB, 0x80365929, 0x80663EEE, 0x818CB1EC,
+    0x810655B0, 0x8084B199, 0x80C4B199, 0x8174B199, 0x80E4B199, 0x0000058D, 0x8067B199, 0x8077B199,
+    0x8087B199, 0x8044DAD9, 0x8044EB59, 0x8044C219, 0x80D49099, 0x80E79099, 0x8047DDD9, 0x8177BC99,
+    0x8087BC99, 0x80D7BC99, 0x8177D5C4, 0x811A8934, 0x8104D9F4, 0x8107D299, 0x8174D299, 0x81749D14,
+    0x8104D068, 0x810AC02C, 0x804A8C2C, 0x806A9C2C, 0x80F3182C, 0x80D7902C, 0x81678C2C, 0x80184199,
+    0x80E7DC39, 0x801BA5C7, 0x8011A5C7, 0x801C25C7, 0x810605CB, 0x8100C037, 0x80D0902D, 0x80D0B5A1,
+    0x8100C209, 0x8080A949, 0x81608EA1, 0x8100B923, 0x8170B9C1, 0x80D0B9C1, 0x80A0EB59, 0x80A0B5B9,
+    0x80D0B5B9, 0x81708D79, 0x8080B5B9, 0x8030B619, 0x81A0C219, 0x81709099, 0x80409099, 0x80309099,
+    0x80609099, 0x8070DD79, 0x80D0B8F9, 0x8170B979, 0x80D0B979, 0x8100B979, 0x80B0C2B4, 0x8100D299,
+    0x81908D14, 0x8170D068, 0x80693C6B, 0x812AB5F2, 0x81693DED, 0x80293DED, 0x8069275A, 0x8069258C,
+    0x8029258C, 0x80B9258C, 0x81742652, 0x80692432, 0x8179046B, 0x80390759, 0x8177CA59, 0x80A2B5B9,
+    0x8162B2AD, 0x8172B199, 0x803416F9, 0x811A958C, 0x8174158D, 0x8022B199, 0x80C29468, 0x802294D9,
+    0x806655A5, 0x80C2B5A5, 0x811A96A5, 0x80BCB125, 0x8172B868, 0x80AA90E5, 0x80C7D605, 0x80563E05,
+    0x80D2B1EE, 0x805759F9, 0x8107B865, 0x8162D068, 0x8062B181, 0x811A8565, 0x801B8565, 0x8170A6C5,
+    0x80693F45, 0x80B93DC5, 0x80793EC5, 0x81743E45, 0x81093EC5, 0x8122B82C, 0x806905A5, 0x80790745,
+    0x80390745, 0x80290745, 0x80D2CA59, 0x80D7C0B9, 0x8107ACB9, 0x80AAB0B0, 0x818CB0AD, 0x8167DCAC,
+    0x805C40AC, 0x8037E8AE, 0x0000058E, 0x8042DCA4, 0x803290A4, 0x804A90A4, 0x80539CA4, 0x80521CA4,
+    0x80B2E4A4, 0x0000058F, 0x00000590, 0x8167DCA4, 0x8177DCA4, 0x00000591, 0x8037DCA4, 0x80A7ACA4,
+    0x8037ACA4, 0x80A7E4A4, 0x8037E4A4, 0x8197ACA4, 0x8177BCA4, 0x80D7D4A4, 0x80D7D8A4, 0x80D7DCA4,
+    0x810AACA4, 0x815840A4, 0x8107ACA4, 0x8047C0A4, 0x8082E0A4, 0x8087B0A4, 0x80C7DCA4, 0x00000592,
+    0x808490A4, 0x80448CA4, 0x8084ACA4, 0x80A4D8A4, 0x8044D8A4, 0x8084D8A4, 0x8174D8A4, 0x80D4E0A4,
+    0x8174C0A4, 0x8104C0A4, 0x80C4D8A4, 0x809230A4, 0x8174B0A4, 0x810BB8A4, 0x81A7B8A4, 0x81575CA4,
+    0x80972CA4, 0x80E4E0A4, 0x8064B8A4, 0x00000593, 0x80608CA4, 0x8030D8A4, 0x00000594, 0x8070E8A4,
+    0x80309CA4, 0x80A0DCA4, 0x00000595, 0x81709CA4, 0x8170D8A4, 0x8060ACA4, 0x8020ACA4, 0x8030ACA4,
+    0x8070B0AE, 0x80C0D8A4, 0x80D0E8A4, 0x8100DCA4, 0x81009CA4, 0x80A0C0A4, 0x81229CB8, 0x807AE4B2,
+    0x806964B2, 0x00000596, 0x806914B2, 0x80B2E4B2, 0x812298B2, 0x00000597, 0x817964B2, 0x808A9CB2,
+    0x8082E0B2, 0x00000598, 0x81279CB2, 0x807798B2, 0x8127DCB2, 0x80A7ACB2, 0x8067E4B2, 0x8037E4B2,
+    0x8037D8B2, 0x8037DCB2, 0x8127B4AF, 0x80D7DCB2, 0x815840B2, 0x8127C0B9, 0x8127C0B2, 0x8107DCB2,
+    0x8122D8AC, 0x80C2E0B2, 0x80C7DCB2, 0x807954AC, 0x8084ACB2, 0x00000599, 0x8074D8B2, 0x8124D8B2,
+    0x81248CB2, 0x812498B2, 0x8104ACB2, 0x8164C0B2, 0x8104C0B2, 0x8174C0B2, 0x80D4B0B2, 0x812AB4AE,
+    0x80E2DCB2, 0x8124D8AE, 0x80521CB2, 0x80F910B2, 0x812790AF, 0x8047E8B2, 0x815210B2, 0x0000059A,
+    0x8044D8B2, 0x8127DCA4, 0x807914A4, 0x8120B8A5, 0x0000059B, 0x80E0B4B2, 0x80D0E8B2, 0x0000059C,
+    0x80608CB2, 0x81208CB2, 0x80D08CB2, 0x8030B8B2, 0x8170D8B2, 0x8120D8B2, 0x817090B2, 0x8120E8A4,
+    0x80C0E0B2, 0x8120C0B2, 0x8170D0B2, 0x8120C8A4, 0x8138D524, 0x813AB199, 0x806ACE79, 0x807ACE79,
+    0x817ACE79, 0x808ACE79, 0x80DACD19, 0x8064CD19, 0x8174CD19, 0x8044CD19, 0x806ACE99, 0x807AD279,
+    0x813BA4D4, 0x813A0608, 0x813A05CB, 0x8134158C, 0x8107CE65, 0x8077BE65, 0x8047DE65, 0x813BA605,
+    0x8134E8A4, 0x8130D8B2, 0x803454F3, 0x807A98D3, 0x802A98D3, 0x803A98D3, 0x80DA98D3, 0x813BA4F3,
+    0x80A498D3, 0x81349D13, 0x813BA5B3, 0x817425B3, 0x8044CC73, 0x80DAB613, 0x80AAB613, 0x802AB613,
+    0x804AB613, 0x811AA613, 0x813AB613, 0x813826D3, 0x0000059D, 0x8024B193, 0x8074B193, 0x8084B193,
+    0x0000059E, 0x803AB193, 0x808AB193, 0x802AB193, 0x802AB053, 0x80CA98D3, 0x8044B193, 0x8174B093,
+    0x81979D33, 0x8167A493, 0x80878EB3, 0x8177B453, 0x8047A9F3, 0x8037A1F3, 0x808789F3, 0x80A7DD93,
+    0x8027DD93, 0x8197DD93, 0x80C79DF3, 0x8137D593, 0x8067DD93, 0x8137A593, 0x8027A593, 0x80D7A593,
+    0x80C4B5F3, 0x80C7B193, 0x0000059F, 0x8047B193, 0x80D7B193, 0x80D7B093, 0x8137B1F3, 0x000005A0,
+    0x8177B0D3, 0x8134B1F3, 0x8037DD93, 0x80C78EB3, 0x8136BCF3, 0x81343DF3, 0x8077BCD3, 0x8027BC53,
+    0x81A7BDB3, 0x81343EF3, 0x8067BC93, 0x80D7BC93, 0x8077BC93, 0x8177BD93, 0x80263C53, 0x80263C73,
+    0x80363F33, 0x80663EF3, 0x80763DB3, 0x80663CF3, 0x80263CF3, 0x80363CF3, 0x813754F3, 0x81A4B8F3,
+    0x8134B8F3, 0x81A4B873, 0x8174B8F3, 0x806AB893, 0x8044B8F3, 0x8064B893, 0x8024B893, 0x8174B893,
+    0x80E7B8F3, 0x80D7B8F3, 0x8137B8F3, 0x8077DDD3, 0x80E7BDD3, 0x80D7BDD3, 0x8077BDD3, 0x8174AD33,
+    0x80DA8D73, 0x802A8D73, 0x806A8D73, 0x80B48D73, 0x80848D73, 0x81748D73, 0x80D48D73, 0x808ACD73,
+    0x80D4B173, 0x81378D73, 0x80A78D73, 0x80D78D73, 0x80278D73, 0x80B7BD73, 0x8077BD73, 0x8137BD73,
+    0x80E48D73, 0x000005A1, 0x80B4B973, 0x80A4B973, 0x80AAB973, 0x802AB973, 0x808AB973, 0x8077B973,
+    0x80D7B973, 0x8027B973, 0x80F4B973, 0x8074CE93, 0x8104D113, 0x81382693, 0x8104BA93, 0x80A4B293,
+    0x8074B293, 0x8174B293, 0x811AA693, 0x80AACE93, 0x804ACE93, 0x807ACE93, 0x810ABA93, 0x813A5493,
+    0x8018D433, 0x801B1C33, 0x8164D833, 0x813B8453, 0x813B85D3, 0x813B84F3, 0x81340513, 0x813606F3,
+    0x806606F3, 0x80660573, 0x81360733, 0x80660733, 0x81360453, 0x80260513, 0x80760673, 0x813604F3,
+    0x80B7B033, 0x80C785D3, 0x806098D3, 0x8070DD73, 0x807098D3, 0x81309C33, 0x80B0E5F3, 0x81309DF3,
+    0x81308D73, 0x80A08D73, 0x81708D73, 0x81908D73, 0x8030CD73, 0x80D0CD73, 0x8100C033, 0x8070DE13,
+    0x8170CE13, 0x80C0D833, 0x8170B173, 0x8070B033, 0x8190DD93, 0x000005A2, 0x8030B193, 0x8080D593,
+    0x80C0B433, 0x80D0D593, 0x8100B213, 0x8100DD93, 0x8100A593, 0x8060A593, 0x80A0A593, 0x8130B8F3,
+    0x80E085D3, 0x8160CE93, 0x8170D293, 0x8100D113, 0x8124B193, 0x802925B3, 0x80393EF3, 0x8127BD73,
+    0x81378653, 0x80790673, 0x80290673, 0x80490453, 0x803906F3, 0x8067C9B3, 0x80C7C893, 0x8047C9B3,
+    0x8177C9B3, 0x80D7C9D3, 0x8060C9B3, 0x80D0C973, 0x8080C9B3, 0x81929CF3, 0x8162A5D3, 0x8162B893,
+    0x8062B893, 0x8132B893, 0x8042CD73, 0x8072BAB3, 0x80E2E2B3, 0x807A9673, 0x805C1473, 0x806494D3,
+    0x802294D3, 0x81329573, 0x81329493, 0x80F11733, 0x8162B093, 0x80A2B193, 0x8132B193, 0x8032B193,
+    0x8022B193, 0x000005A3, 0x80229613, 0x81329613, 0x80B29613, 0x81029613, 0x000005A4, 0x000005A5,
+    0x8102CE93, 0x8162CE93, 0x81729A93, 0x8172B293, 0x8022CE93, 0x8162BA93, 0x81728593, 0x80C28573,
+    0x818914D3, 0x80491673, 0x81091613, 0x81629653, 0x81028653, 0x80628653, 0x81728653, 0x80E28653,
+    0x807CD8B3, 0x806ACCB3, 0x81629CB3, 0x8192CCB3, 0x8162E0B3, 0x80A7ACB3, 0x8067E0B3, 0x80F7E8B3,
+    0x8197ACB3, 0x000005A6, 0x8037CCB3, 0x8037ACB3, 0x8087CCB3, 0x80DACCB3, 0x80D2B4B3, 0x80D7D8B3,
+    0x810CE0B3, 0x805814B3, 0x810AACB3, 0x000005A7, 0x8107CCB3, 0x8107ACB3, 0x80C2E0B3, 0x80C7D8B3,
+    0x80BCB0B3, 0x8167B0B3, 0x8137B0B3, 0x8087B0B3, 0x80D7B0B3, 0x807614B3, 0x813654B3, 0x000005A8,
+    0x000005A9, 0x81648CB3, 0x000005AA, 0x80D4E0B3, 0x8134E8B3, 0x8134CCB3, 0x8164CCB3, 0x8174CCB3,
+    0x80B4ACB3, 0x8194ACB3, 0x8104ACB3, 0x8084ACB3, 0x80C4D8B3, 0x8174B0B3, 0x81A7B8B3, 0x8107B8B3,
+    0x8087B8B3, 0x80E4E0B3, 0x000005AB, 0x8064B8B3, 0x80E4B8B3, 0x804AACB3, 0x804AE0B3, 0x000005AC,
+    0x8047B4B3, 0x8047CCB3, 0x804A90B3, 0x80D790B3, 0x8044D8B3, 0x000005AD, 0x000005AE, 0x000005AF,
+    0x8060ACB3, 0x000005B0, 0x806090B3, 0x8050CCB3, 0x8020CCB3, 0x80F0CCB3, 0x8070CCB3, 0x000005B1,
+    0x813090B3, 0x813098B3, 0x81309CB3, 0x8100E0B3, 0x81009CB3, 0x8070C0B3, 0x80E0C0B3, 0x8100B8B3,
+    0x80A0C0B3, 0x8170D8B3, 0x8060D8B3, 0x80E0D8B3, 0x8160B8B3, 0x8050D8B3, 0x8160C0B3, 0x8130B4B3,
+    0x80D0E8B3, 0x80C0E8B3, 0x80C0ACB3, 0x80C0B8B3, 0x80C0D8B3, 0x000005B2, 0x8130B0B3, 0x80B0B0B3,
+    0x8170B0B3, 0x80608CB3, 0x000005B3, 0x8030ACB3, 0x8030B8B3, 0x80309CB3, 0x8067C8B3, 0x8120C8B3,
+    0x808A8859, 0x80AAB979, 0x80D7B199, 0x8162E0A4, 0x807CD8A4, 0x8067E0A4, 0x8037D8A4, 0x803790A4,
+    0x8037E0A4, 0x8064E0A4, 0x802084A4, 0x8060E0A4, 0x8040E8A4, 0x80A090A4, 0x8170E0A4, 0x811A94B2,
+    0x8062E4B2, 0x8127D8B2, 0x8064E0B2, 0x817490B2, 0x817098B2, 0x8120ACB2, 0x8020ACB2, 0x8060ACB2,
+    0x8174B193, 0x80CAB2B3, 0x80CAB193, 0x8177B093, 0x8027B2B3, 0x8174B973, 0x80D4B973, 0x8134B973,
+    0x8170B193, 0x81629613, 0x81A2CE93, 0x8132D293, 0x8037E0B3, 0x8107E0B3, 0x8174C0B3, 0x8064E0B3,
+    0x80A4D8B3, 0x8174D8B3, 0x8074D8B3, 0x8084D8B3, 0x81A4B8B3, 0x8164B8B3, 0x8174B8B3, 0x8047E8B3,
+    0x802088B3, 0x8170E0B3, 0x8070E8B3, 0x80709CB3, 0x81709CB3, 0x8020B8B3, 0x8170B8B3, 0x8060E8B3,
+    0x8170ACB3, 0x8040E8B3, 0x817090B3, 0x8130E0B3, 0x8160B0B3, 0x8030D8B3,
+};
+
+const uint32_t StrategyTables_nodeCount = 1460;
+const uint32_t StrategyTables_edgeCount = 6270;
+const uint32_t StrategyTables_wordCount = 5752;
+const uint32_t StrategyTables_totalGuesses = 21827;
+const uint32_t StrategyTables_flashBytes = 40112;
+const uint32_t StrategyTables_checksum = 0x20CC04E5;
+
+#else
+
+// Solved for 5-letter words: no tree, so Strategy_init() turns the strategy off
+
+const uint32_t StrategyTables_guesses[1] = { 0 };
+const uint16_t StrategyTables_firstEdges[1] = { 0 };
+const FeedbackCode StrategyTables_codes[1] = { 0 };
+const uint32_t StrategyTables_targets[1] = { 0 };
+
+const uint32_t StrategyTables_nodeCount = 0;
+const uint32_t StrategyTables_edgeCount = 0;
+const uint32_t StrategyTables_wordCount = 0;
+const uint32_t StrategyTables_totalGuesses = 0;
+const uint32_t StrategyTables_flashBytes = 0;
+const uint32_t StrategyTables_checksum = 0x811C9DC5;
+
+#endif
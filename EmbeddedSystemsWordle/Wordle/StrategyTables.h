@@ -0,0 +1,48 @@
+/*
+ * StrategyTables.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The decision tree behind Strategy.c. StrategyTables.c defines it and is
+ * generated by Host/MakeStrategy from the tree Host/MakeDecisionTree writes;
+ * run "make strategy" in Host/ after changing Wordle/words.txt.
+ *
+ * A node is a guess and the edges for the feedback it can get, other than all
+ * green. Node 0 is the opening guess, and every node comes after its parent.
+ * The edges of node n are firstEdges[n] to firstEdges[n + 1] - 1, in
+ * ascending order of feedback code, so the edge for a code is found by binary
+ * search in at most 8 probes. An edge leads to another node, or, when a single
+ * answer is left, straight to that answer's word with STRATEGY_LEAF set.
+ *
+ * The tree is solved for one word length. Built for another, the tables are
+ * empty and Strategy_init() turns the strategy off.
+ */
+
+#ifndef WORDLE_STRATEGYTABLES_H_
+#define WORDLE_STRATEGYTABLES_H_
+
+#include <Wordle/Score.h>
+
+// Set in an edge target which is an answer's packed word rather than a node
+#define STRATEGY_LEAF               0x80000000u
+
+// The packed word each node guesses
+extern const uint32_t StrategyTables_guesses[];
+
+// For every node and one past the last, the index of its first edge
+extern const uint16_t StrategyTables_firstEdges[];
+
+// The feedback code and the node or STRATEGY_LEAF answer of every edge
+extern const FeedbackCode StrategyTables_codes[];
+extern const uint32_t StrategyTables_targets[];
+
+extern const uint32_t StrategyTables_nodeCount;
+extern const uint32_t StrategyTables_edgeCount;
+extern const uint32_t StrategyTables_wordCount;        // Dictionary words the tree was solved for
+extern const uint32_t StrategyTables_totalGuesses;     // Guesses it takes over all of them
+extern const uint32_t StrategyTables_flashBytes;
+
+// 32-bit FNV-1a of the tables, each element little-endian, in the order above
+extern const uint32_t StrategyTables_checksum;
+
+#endif /* WORDLE_STRATEGYTABLES_H_ */
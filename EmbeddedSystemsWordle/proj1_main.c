@@ -30,16 +30,55 @@ static void PollNonBlockingLED()
     }
 }
 
+#if DICTIONARY_RUN_BENCHMARK
+#define DICTIONARY_BENCHMARK_ROUNDS 1000
+
+// Times Dictionary_contains() on words which are in the list and words which
+// are not, and sends the average cost of a lookup (loop overhead included) and
+// the memory the dictionary uses over UART.
+static void ReportDictionaryBenchmark(UART *uart_p)
+{
+    static const char* const words[] = { "CRANE", "FUZZY", "ALLOY", "CRANX", "QWERT", "ZZZZZ" };
+    const uint32_t numWords = sizeof(words) / sizeof(words[0]);
+    PackedWord packed[sizeof(words) / sizeof(words[0])];
+    SWTimer timer = SWTimer_construct(0);
+    volatile uint32_t found = 0;
+    char message[128];
+    uint32_t i, round;
+
+    for (i = 0; i < numWords; i++)
+    {
+        packed[i] = Score_packWord((const unsigned char*) words[i]);
+    }
+
+    SWTimer_start(&timer);
+    for (round = 0; round < DICTIONARY_BENCHMARK_ROUNDS; round++)
+    {
+        for (i = 0; i < numWords; i++)
+        {
+            found += Dictionary_contains(packed[i]);
+        }
+    }
+    uint64_t cycles = SWTimer_elapsedCycles(&timer);
+
+    snprintf(message, sizeof(message), "Dictionary: %lu words, %lu bytes flash, %lu bytes SRAM, %lu cycles per lookup\r\n",
+             (unsigned long) Dictionary_wordCount(), (unsigned long) Dictionary_flashBytes(),
+             (unsigned long) Dictionary_ramBytes(),
+             (unsigned long) (cycles / (DICTIONARY_BENCHMARK_ROUNDS * numWords)));
+    UART_sendString(uart_p, message);
+
+    while (UART_txPending(uart_p) > 0);
+}
+#endif
+
 /**
- * The main entry point of your project. The main function should immediately
- * stop the Watchdog timer, call the Application constructor, and then
- * repeatedly call the main super-loop function. The Application constructor
- * should be responsible for initializing all hardware components as well as all
- * other finite state machines you choose to use in this project.
- *
- * THIS FUNCTION IS ALREADY COMPLETE. Unless you want to wordorarily experiment
- * with some behavior of a code snippet you may have, we DO NOT RECOMMEND
- * modifying this function in any way.
+ * The main entry point of the project. It stops the Watchdog timer, constructs
+ * the HAL and the Application, and hands the game to the scheduler as tasks
+ * (see Application_schedule()). From then on it is event driven: each time
+ * round, HAL_takeEvents() signals the tasks the interrupts since the last pass
+ * have work for, and Scheduler_runNext() runs the most urgent ready task to
+ * completion. Once no task is ready, HAL_sleep() puts the CPU in LPM0 until
+ * the next event, and signals the tasks it woke for.
  */
 int main(void)
 {
@@ -53,19 +92,149 @@ int main(void)
     // Initialize the main Application object and HAL object
     HAL hal = HAL_construct();
     Application app = Application_construct();
+    Dictionary_init();
+
+    // Hints come from the strategy tree in flash, unless it fails its check and they have to be searched for
+    if (!Strategy_init())
+    {
+        UART_sendString(&hal.uart, "Strategy tree damaged, hints will search\r\n");
+    }
+#if DICTIONARY_RUN_BENCHMARK
+    ReportDictionaryBenchmark(&hal.uart);
+#endif
 
     // Do not remove this line. This is your non-blocking check.
     InitNonBlockingLED();
 
-    // Main super-loop! In a polling architecture, this function should call
-    // your main FSM function over and over.
+    // Split the super-loop into tasks, see Application_schedule()
+    Application_schedule(&app, &hal);
+
+    // Main super-loop! Each time round it runs the most urgent task which has
+    // something to do, a bounded piece of work. Once no task has, the CPU
+    // sleeps until a character, a button edge, a timer or the LCD wakes it.
     while (true)
     {
         // Do not remove this line. This is your non-blocking check.
         PollNonBlockingLED();
-        HAL_refresh(&hal);
-        Application_loop(&app, &hal);
+        Scheduler_signal(HAL_takeEvents(&hal));
+
+        if (!Scheduler_runNext())
+        {
+            Scheduler_signal(HAL_sleep(&hal));
+        }
+    }
+}
+
+/**
+ * The tasks of the super-loop, and what they work on. They live here for
+ * good, since the scheduler holds them by their addresses.
+ */
+static struct
+{
+    Application* app_p;
+    HAL* hal_p;
+    Task input;
+    Task game;
+    Task render;
+    Task telemetry;
+} tasks;
+
+/**
+ * Runs out the timers due and refreshes the buttons. A tap is kept until the
+ * game task takes it, so the game is signalled to look.
+ */
+static bool Application_inputTask(void* context)
+{
+    (void) context;
+
+    HAL_refreshInputs(tasks.hal_p);
+    Task_signal(&tasks.game);
+    return false;
+}
+
+/**
+ * Handles what came in and does one slice of a search, then has what it drew
+ * sent and, if Ctrl-P came in, the profiling table. It yields between slices.
+ */
+static bool Application_gameTask(void* context)
+{
+    bool more = Application_update(tasks.app_p, tasks.hal_p);
+
+    (void) context;
+    Task_signal(&tasks.render);
+#if PROFILE_ENABLED
+    if (Profile_isDumping())
+    {
+        Task_signal(&tasks.telemetry);
     }
+#endif
+    return more;
+}
+
+/**
+ * Draws a slice of what the game queued on the display list, and once all of
+ * it is drawn, starts sending the next dirty rectangle of the framebuffer.
+ * While the DMA sends one, the task waits for EVENT_LCD instead, so a full
+ * redraw never holds up the tasks above it for longer than a slice of drawing
+ * or a window setup.
+ */
+static bool Application_renderTask(void* context)
+{
+    (void) context;
+
+    if (!DisplayList_isEmpty())
+    {
+        DisplayList_step(&tasks.hal_p->g_sContext, Clock_cycles() + Clock_fromUs(TASK_SLICE_US));
+        return true;
+    }
+    return HAL_flushStep(tasks.hal_p);
+}
+
+/**
+ * Queues as much of the profiling table as the transmit buffer has room for.
+ * Rather than yield and spin while the UART sends it, the task waits for
+ * EVENT_UART_TX, so the CPU can sleep until the buffer is empty.
+ */
+static bool Application_telemetryTask(void* context)
+{
+    (void) context;
+
+#if PROFILE_ENABLED
+    Profile_dumpStep(&tasks.hal_p->uart);
+#endif
+    return false;
+}
+
+/**
+ * Splits the super-loop into four tasks, in order of priority: the inputs, the game, drawing and sending the framebuffer to
+ * the LCD, and the profiling table. Only the input task and the game's characters are
+ * urgent; a full redraw takes milliseconds to draw and milliseconds on the SPI
+ * bus, and now is drawn a slice and goes out a rectangle at a time behind them.
+ *
+ * @param app_p:  A pointer to the main Application object, which must not move
+ * @param hal_p:  A pointer to the main HAL object, which must not move
+ */
+void Application_schedule(Application *app_p, HAL *hal_p)
+{
+    tasks.app_p = app_p;
+    tasks.hal_p = hal_p;
+
+    tasks.input = Task_construct("input", Application_inputTask, NULL, TASK_INPUT_PRIORITY,
+                                 EVENT_BUTTON | EVENT_TIMER, TASK_INPUT_BUDGET_US);
+    tasks.game = Task_construct("game", Application_gameTask, NULL, TASK_GAME_PRIORITY,
+                                EVENT_UART_RX, TASK_GAME_BUDGET_US);
+    tasks.render = Task_construct("render", Application_renderTask, NULL, TASK_RENDER_PRIORITY,
+                                  EVENT_LCD, TASK_RENDER_BUDGET_US);
+    tasks.telemetry = Task_construct("telemetry", Application_telemetryTask, NULL, TASK_TELEMETRY_PRIORITY,
+                                     EVENT_UART_TX, TASK_TELEMETRY_BUDGET_US);
+
+    Scheduler_add(&tasks.input);
+    Scheduler_add(&tasks.game);
+    Scheduler_add(&tasks.render);
+    Scheduler_add(&tasks.telemetry);
+
+    // The first run shows the title screen
+    Task_signal(&tasks.game);
 }
 
 /**
@@ -97,34 +266,74 @@ Application Application_construct()
     app.counter = 0;
     app.correct = 0;
     app.word = 0;
+    app.statusShown = false;
+    app.hinting = false;
+    app.hintProgress = 0;
+    app.hintTimer = WheelTimer_construct(NULL);
+    app.judging = false;
+    app.narrowing = false;
+    Candidates_reset();
+    Strategy_reset();
+    Hint_reset();
 
     return app;
 }
 
 /**
- * The main super-loop function of the application. We place this inside of a
- * single infinite loop in main. In this way, we can model a polling system of
- * FSMs. Every cycle of this loop function, we poll each of the FSMs one time,
- * followed by refreshing all inputs to the system through a convenient
- * [HAL_refresh()] call.
+ * The work of the game task, which models a polling system of FSMs: every run
+ * polls each of the FSMs one time. It takes the taps, a character from the
+ * UART, and a slice of the narrowing of the candidates, the hint search or
+ * the board's choice in ABSURDLE. Each slice stops after TASK_SLICE_US, so a
+ * run fits in TASK_GAME_BUDGET_US, and typing waits in the UART buffer a
+ * character per call.
  *
  * @param app_p:  A pointer to the main Application object.
  * @param hal_p:  A pointer to the main HAL object
+ *
+ * @return true while a search or the narrowing is in progress or a character is waiting
  */
-void Application_loop(Application *app_p, HAL *hal_p)
+bool Application_update(Application *app_p, HAL *hal_p)
 {
+    PROFILE_BEGIN(PROFILE_APPLICATION_UPDATE);
+
     if (app_p->firstCall)
     {
         Application_showTitleScreen(app_p, hal_p); // Display Title screen during its first time launch
         Application_updateCommunications(app_p, hal_p); // When app is just called, update communication
     }
-    if (Button_isTapped(&hal_p->boosterpackS2))
+    if (Button_takeTap(&hal_p->boosterpackS2))
     {
         Application_updateCommunications(app_p, hal_p); // Update Baudrate
 
     }
-    if (Button_isTapped(&hal_p->boosterpackS1))
+    if (Button_takeTap(&hal_p->boosterpackJS)
+            && ((app_p->state == GUESS_WORD) || (app_p->state == ABSURDLE))
+            && (app_p->guess < RESULT) && !app_p->hinting && !app_p->judging && DICTIONARY_AVAILABLE)
     {
+        Application_startHint(app_p, hal_p); // Look for the most telling next guess
+    }
+    if (app_p->narrowing)
+    {
+        Application_updateNarrowing(app_p, hal_p); // A hint or judging starts once the candidates are narrowed
+    }
+    else if (app_p->hinting)
+    {
+        Application_updateHint(app_p, hal_p); // One slice of the search per loop, so input keeps flowing
+    }
+    else if (app_p->judging)
+    {
+        Application_updateAbsurdle(app_p, hal_p); // One slice of the board's choice per loop, likewise
+    }
+    if (Button_takeTap(&hal_p->boosterpackS1))
+    {
+        if ((app_p->state == TITLE_SCREEN) && DICTIONARY_AVAILABLE)
+        {
+            // Transition from Title Screen to Absurdle: the board plays player 1, so it needs the word list
+            app_p->state = ABSURDLE;
+            app_p->letter = FIRST;
+            app_p->counter = 0;
+            Application_showAbsurdle(app_p, hal_p);
+        }
         if ((app_p->state == CREATE_WORD) && (app_p->letter == END))
         {
             // Transition from Create Word state to Guess Word State
@@ -133,7 +342,8 @@ void Application_loop(Application *app_p, HAL *hal_p)
             app_p->counter = 0;
             Application_showGuessWord(app_p, hal_p); // Display Guess Word state
         }
-        if ((app_p->state == GUESS_WORD) && (app_p->letter == END))
+        if ((app_p->state == GUESS_WORD) && (app_p->letter == END)
+                && Application_checkGuess(app_p, hal_p))
         {
             // Run through Wordle algorithm and display the boxes
             Application_wordleAlgo(app_p, hal_p);
@@ -142,11 +352,25 @@ void Application_loop(Application *app_p, HAL *hal_p)
             app_p->counter = 0;
             app_p->guess = (GuessAmount) ((int) app_p->guess + 1);
         }
+        if ((app_p->state == ABSURDLE) && (app_p->letter == END) && (app_p->guess < RESULT)
+                && !app_p->judging && Application_checkGuess(app_p, hal_p))
+        {
+            // The board sorts the candidates a slice per loop; Application_updateAbsurdle() moves to the next guess
+            Application_startAbsurdle(app_p, hal_p);
+        }
     }
     // When UART has a character in the terminal, is goes to changing the states of the app
-    if (UART_hasChar(&hal_p->uart))
+    // While the board is choosing its feedback the guess can't change, so typing waits in the UART buffer
+    if (UART_hasChar(&hal_p->uart) && !app_p->judging)
     {
         Application_begin(app_p, hal_p);
+#if PROFILE_ENABLED
+        if (app_p->word == PROFILE_DUMP_KEY)
+        {
+            Profile_startDump(); // Ctrl-P asks for the profiling table, it is not a key of the game
+        }
+        else
+#endif
         switch (app_p->state)
         {
         case TITLE_SCREEN:
@@ -161,10 +385,18 @@ void Application_loop(Application *app_p, HAL *hal_p)
             Application_handleGameScreen(app_p, hal_p); // Go to guess word function
             break;
 
+        case ABSURDLE:
+            Application_handleGameScreen(app_p, hal_p); // Same as guess word, the board answers instead
+            break;
+
         default:
             break;
         }
     }
+
+    PROFILE_END(PROFILE_APPLICATION_UPDATE);
+
+    return app_p->hinting || app_p->judging || app_p->narrowing || UART_hasChar(&hal_p->uart);
 }
 
 /**
@@ -289,35 +521,11 @@ void Application_handleCreateWord(Application *app_p, HAL *hal_p)
 {
     if (UART_canSend(&hal_p->uart))
     {
-        // Each state represents the position of the imaginary cursor
+        // Each state represents the position of the imaginary cursor, FIRST to END for MAX_LETTERS letters
         // Once it reaches end, you can still backspace, or if the button 1 is pressed it will switch states
-        switch (app_p->letter)
+        if (app_p->letter <= END)
         {
-        case FIRST:
-            Application_letterUpdate(app_p, hal_p);
-            break;
-
-        case SECOND:
-            Application_letterUpdate(app_p, hal_p);
-            break;
-
-        case THIRD:
             Application_letterUpdate(app_p, hal_p);
-            break;
-
-        case FOURTH:
-            Application_letterUpdate(app_p, hal_p);
-            break;
-
-        case FIFTH:
-            Application_letterUpdate(app_p, hal_p);
-            break;
-
-        case END:
-            Application_letterUpdate(app_p, hal_p);
-            break;
-        default:
-            break;
         }
     }
 }
@@ -328,38 +536,13 @@ void Application_handleGameScreen(Application *app_p, HAL *hal_p)
 {
     if (UART_canSend(&hal_p->uart))
     {
-        // Each state represents the number of guesses player 2 is on
+        // Each state represents the number of guesses player 2 is on, ONE to LAST_GUESS
         // Dependent: If each case reaches a certain count, state will change to result
-        // Auto: Once it reaches case six and Button 1 is pressed, it will
+        // Auto: Once it reaches the last guess and Button 1 is pressed, it will
         // return the resulting screen (main loop)
-        switch (app_p->guess)
+        if (app_p->guess < RESULT)
         {
-        case ONE:
-            Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        case TWO:
-            Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        case THREE:
-            Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        case FOUR:
-            Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        case FIVE:
             Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        case SIX:
-            Application_handleCreateWord(app_p, hal_p);
-            break;
-
-        default:
-            break;
         }
     }
 }
@@ -368,31 +551,38 @@ void Application_handleGameScreen(Application *app_p, HAL *hal_p)
  */
 void Application_showTitleScreen(Application *app, HAL *hal_p)
 {
-    Graphics_clearDisplay(&hal_p->g_sContext);
+    (void) app;
+
+    PROFILE_BEGIN(PROFILE_SHOW_TITLE_SCREEN);
+
+    DisplayList_clear(&hal_p->g_sContext);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontCmss12b);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "WordMaster", -1, 25, 0,
+    DisplayList_drawString(&hal_p->g_sContext, "WordMaster", -1, 25, 0,
     true);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontFixed6x8);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Spring 22 Project 1", -1,
-                        0, 15, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Kyle Takeuchi", -1, 0,
-                        24, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "-----How To Play-----",
-                        -1, 0, 35, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Player 1 Creates Word",
-                        -1, 0, 47, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Player 2 has 6 tries ",
-                        -1, 0, 59, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "to guess the word.", -1,
-                        0, 71, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "BB1: Confirm Word", -1,
-                        0, 83, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "BB2: Baudrate Select",
-                        -1, 0, 95, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "UART: Type Word", -1, 0,
-                        107, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "PRESS ANY KEY TO PLAY",
-                        -1, 0, 119, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Spring 22 Project 1", -1,
+                           0, 15, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Kyle Takeuchi", -1, 0,
+                           24, true);
+    DisplayList_drawString(&hal_p->g_sContext, "-----How To Play-----",
+                           -1, 0, 35, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Player 1 Creates Word",
+                           -1, 0, 47, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Player 2 has " APPLICATION_STRING(MAX_GUESSES) " tries ",
+                           -1, 0, 59, true);
+    DisplayList_drawString(&hal_p->g_sContext, "to guess the word.", -1,
+                           0, 71, true);
+    DisplayList_drawString(&hal_p->g_sContext,
+                           (DICTIONARY_AVAILABLE ? "BB1: Confirm/Absurdle" : "BB1: Confirm"), -1,
+                           0, 83, true);
+    DisplayList_drawString(&hal_p->g_sContext, "BB2: Baudrate Select",
+                           -1, 0, 95, true);
+    DisplayList_drawString(&hal_p->g_sContext, "UART: Type Word", -1, 0,
+                           107, true);
+    DisplayList_drawString(&hal_p->g_sContext, "PRESS ANY KEY TO PLAY",
+                           -1, 0, 119, true);
+
+    PROFILE_END(PROFILE_SHOW_TITLE_SCREEN);
 }
 
 /**
@@ -400,30 +590,36 @@ void Application_showTitleScreen(Application *app, HAL *hal_p)
  */
 void Application_showCreateWord(Application *app, HAL *hal_p)
 {
-    Graphics_clearDisplay(&hal_p->g_sContext);
+    (void) app;
+
+    PROFILE_BEGIN(PROFILE_SHOW_CREATE_WORD);
+
+    DisplayList_clear(&hal_p->g_sContext);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc14);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "PLAYER 1", -1, 25, 0,
+    DisplayList_drawString(&hal_p->g_sContext, "PLAYER 1", -1, 25, 0,
     true);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc12);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Create Word", -1, 18, 18,
+    DisplayList_drawString(&hal_p->g_sContext, "Create Word", -1, 18, 18,
     true);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontFixed6x8);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Word: ", -1, 30, 35,
+    DisplayList_drawString(&hal_p->g_sContext, "Word: ", -1, 30, 35,
     true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "------BAUDRATES------",
-                        -1, 0, 47, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Red: 9600", -1, 0, 59,
+    DisplayList_drawString(&hal_p->g_sContext, "------BAUDRATES------",
+                           -1, 0, 47, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Red: 9600", -1, 0, 59,
     true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Green: 19200", -1, 0, 71,
+    DisplayList_drawString(&hal_p->g_sContext, "Green: 19200", -1, 0, 71,
     true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Blue: 38400", -1, 0, 83,
+    DisplayList_drawString(&hal_p->g_sContext, "Blue: 38400", -1, 0, 83,
     true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "White: 57600", -1, 0, 95,
+    DisplayList_drawString(&hal_p->g_sContext, "White: 57600", -1, 0, 95,
     true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "BB1: Confirm Word", -1,
-                        0, 107, true);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "BB2: Change Baudrate",
-                        -1, 0, 119, true);
+    DisplayList_drawString(&hal_p->g_sContext, "BB1: Confirm Word", -1,
+                           0, 107, true);
+    DisplayList_drawString(&hal_p->g_sContext, "BB2: Change Baudrate",
+                           -1, 0, 119, true);
+
+    PROFILE_END(PROFILE_SHOW_CREATE_WORD);
 }
 
 /**
@@ -431,11 +627,35 @@ void Application_showCreateWord(Application *app, HAL *hal_p)
  */
 void Application_showGuessWord(Application *app, HAL *hal_p)
 {
-    Graphics_clearDisplay(&hal_p->g_sContext);
+    (void) app;
+
+    PROFILE_BEGIN(PROFILE_SHOW_GUESS_WORD);
+
+    DisplayList_clear(&hal_p->g_sContext);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc14);
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Guess Word", -1, 20, 0,
+    DisplayList_drawString(&hal_p->g_sContext, "Guess Word", -1, 20, 0,
     true);
     Graphics_setFont(&hal_p->g_sContext, &g_sFontFixed6x8);
+
+    PROFILE_END(PROFILE_SHOW_GUESS_WORD);
+}
+
+/**
+ * Showing Absurdle state, the guess screen with the board as player 1
+ */
+void Application_showAbsurdle(Application *app, HAL *hal_p)
+{
+    (void) app;
+
+    PROFILE_BEGIN(PROFILE_SHOW_ABSURDLE);
+
+    DisplayList_clear(&hal_p->g_sContext);
+    Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc14);
+    DisplayList_drawString(&hal_p->g_sContext, "Absurdle", -1, 25, 0,
+    true);
+    Graphics_setFont(&hal_p->g_sContext, &g_sFontFixed6x8);
+
+    PROFILE_END(PROFILE_SHOW_ABSURDLE);
 }
 
 char Application_upperCase(char rxChar)
@@ -462,7 +682,7 @@ void Application_letterUpdate(Application *app_p, HAL *hal_p)
             Application_letterDisplay(app_p, hal_p);
             app_p->counter = app_p->counter + 1;
         }
-        else if (app_p->state == GUESS_WORD) // Changes the guessWord char everytime / rewrites it
+        else if ((app_p->state == GUESS_WORD) || (app_p->state == ABSURDLE)) // Changes the guessWord char everytime / rewrites it
         {
             app_p->guessWord[app_p->counter] = Application_upperCase(
                     app_p->word); // Make everything upper, even if it is already upper
@@ -483,7 +703,7 @@ void Application_letterUpdate(Application *app_p, HAL *hal_p)
                 app_p->answer[app_p->counter] = 0x20; // Replace with space (ASCII)
                 Application_letterDisplay(app_p, hal_p);
             }
-            else if (app_p->state == GUESS_WORD)
+            else if ((app_p->state == GUESS_WORD) || (app_p->state == ABSURDLE))
             {
                 app_p->guessWord[app_p->counter] = 0x20;
                 Application_guessDisplay(app_p, hal_p);
@@ -500,8 +720,8 @@ void Application_letterDisplay(Application *app_p, HAL *hal_p)
     int increment;
     word[0] = app_p->answer[app_p->counter];
     increment = app_p->counter;
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) word, 1,
-                        (60 + (increment * 6)), 35, true);
+    DisplayList_drawString(&hal_p->g_sContext, word, 1,
+                           (60 + (increment * 6)), 35, true);
 }
 /**
  * Displays guessing words from UART and whatever is assigned from App struct
@@ -514,8 +734,9 @@ void Application_guessDisplay(Application *app_p, HAL *hal_p)
     word[0] = app_p->guessWord[app_p->counter];
     increment = app_p->counter;
     vertical = (int) app_p->guess;
-    Graphics_drawString(&hal_p->g_sContext, (int8_t*) word, 1,
-                        13 + (increment * 6), 20 + (vertical * 12), true);
+    DisplayList_drawString(&hal_p->g_sContext, word, 1,
+                           LAYOUT_TEXT_X + (increment * LAYOUT_CHAR_WIDTH),
+                           LAYOUT_FIRST_ROW_Y + (vertical * LAYOUT_ROW_PITCH), true);
 }
 
 /**
@@ -523,60 +744,293 @@ void Application_guessDisplay(Application *app_p, HAL *hal_p)
  */
 void Application_begin(Application *app_p, HAL *hal_p)
 {
-    char rxChar = UART_getChar(&hal_p->uart);
-    char txChar = Application_interpretIncomingChar(rxChar);
-    app_p->word = rxChar;
+    app_p->word = UART_getChar(&hal_p->uart);
+}
+
+/**
+ * Looks the guess up in the dictionary before it is scored. A word which is
+ * not in the list does not use up a guess: a message says so and the letters
+ * stay on screen to be backspaced. The next guess that is accepted clears it.
+ * Built for a word length without a dictionary, every guess is accepted.
+ */
+bool Application_checkGuess(Application *app_p, HAL *hal_p)
+{
+    bool inList = !DICTIONARY_AVAILABLE || Dictionary_contains(Score_packWord(app_p->guessWord));
+
+    Application_showStatus(app_p, hal_p, inList ? "" : "Not in word list");
+    return inList;
+}
+
+/**
+ * Shows a message centred on the status line below the guesses, or clears the
+ * line if the message is empty. The whole line is drawn, so whatever was on it
+ * before is gone.
+ */
+void Application_showStatus(Application *app_p, HAL *hal_p, const char* text)
+{
+    char line[STATUS_CHARACTERS];
+    int length = (int) strlen(text);
+    int start;
+
+    if ((length == 0) && !app_p->statusShown)
+    {
+        return;
+    }
+
+    PROFILE_BEGIN(PROFILE_SHOW_STATUS);
+    length = (length > STATUS_CHARACTERS) ? STATUS_CHARACTERS : length;
+    start = (STATUS_CHARACTERS - length) / 2;
+    memset(line, ' ', STATUS_CHARACTERS);
+    memcpy(&line[start], text, length);
+
+    DisplayList_drawString(&hal_p->g_sContext, line, STATUS_CHARACTERS, 1, 120, true);
+    app_p->statusShown = (length > 0);
+    PROFILE_END(PROFILE_SHOW_STATUS);
+}
+
+/**
+ * Starts the hint. If the candidates are still being narrowed by the last
+ * feedback, it shows that it is thinking and Application_updateNarrowing()
+ * starts it once they are.
+ */
+void Application_startHint(Application *app_p, HAL *hal_p)
+{
+    app_p->hinting = true;
+    app_p->hintProgress = 0;
+    if (app_p->narrowing)
+    {
+        Application_showStatus(app_p, hal_p, "Hint: thinking 0%");
+        return;
+    }
+    Application_beginHint(app_p, hal_p);
+}
+
+/**
+ * Shows the strategy tree's next guess if the player has kept to the tree.
+ * Otherwise starts the hint engine on the feedback so far. The search runs a
+ * slice per super-loop from Application_updateHint(), for at most
+ * HINT_BUDGET_MS.
+ */
+void Application_beginHint(Application *app_p, HAL *hal_p)
+{
+    PackedWord word;
+
+    // While the player follows the strategy tree, its next guess is the hint and there is nothing to search
+    if (Strategy_hint(&word))
+    {
+        app_p->hinting = false;
+        Application_showHint(app_p, hal_p, word);
+        return;
+    }
+
+    Hint_start();
+    WheelTimer_arm(&app_p->hintTimer, HINT_BUDGET_MS, NULL);
+    Application_showStatus(app_p, hal_p, "Hint: thinking 0%");
+}
+
+/**
+ * Runs one slice of the hint search and shows how far it has come. When the
+ * search is done, or its time is up, the best guess it found is shown.
+ */
+void Application_updateHint(Application *app_p, HAL *hal_p)
+{
+    char text[STATUS_CHARACTERS + 1];
+    uint64_t deadline = Clock_cycles() + Clock_fromUs(TASK_SLICE_US);
+    bool done;
+
+    do
+    {
+        done = Hint_step(HINT_STEP_SCORES);
+    } while (!done && (Clock_cycles() < deadline));
+
+    if (done || !WheelTimer_isArmed(&app_p->hintTimer))
+    {
+        WheelTimer_cancel(&app_p->hintTimer);
+        app_p->hinting = false;
+        Application_showHint(app_p, hal_p, Hint_best());
+    }
+    else if (Hint_progress() != app_p->hintProgress)
+    {
+        app_p->hintProgress = Hint_progress();
+        snprintf(text, sizeof(text), "Hint: thinking %u%%", (unsigned) app_p->hintProgress);
+        Application_showStatus(app_p, hal_p, text);
+    }
+}
+
+/**
+ * Runs one slice of narrowing the candidates by the last feedback. Once they
+ * are narrowed, a hint or the board's choice which was waiting for them
+ * starts, or, when the board has won in ABSURDLE, it shows the word it owns
+ * up to.
+ */
+void Application_updateNarrowing(Application *app_p, HAL *hal_p)
+{
+    uint64_t deadline = Clock_cycles() + Clock_fromUs(TASK_SLICE_US);
+    bool done;
+
+    do
+    {
+        done = Candidates_step(CANDIDATES_STEP_CHUNKS);
+    } while (!done && (Clock_cycles() < deadline));
+
+    if (!done)
+    {
+        return;
+    }
+
+    app_p->narrowing = false;
+    if ((app_p->state == ABSURDLE) && (app_p->guess >= RESULT) && (app_p->correct != MAX_LETTERS))
+    {
+        Score_unpackWord(Absurdle_answer(), app_p->answer);
+        Application_showLoss(app_p, hal_p);
+    }
+    if (app_p->hinting)
+    {
+        Application_beginHint(app_p, hal_p);
+    }
+    if (app_p->judging)
+    {
+        Absurdle_start(Score_packWord(app_p->guessWord));
+    }
+}
+
+/**
+ * Shows a hinted word and how many answers are still possible, or that no
+ * word fits if the word is 0.
+ */
+void Application_showHint(Application *app_p, HAL *hal_p, PackedWord word)
+{
+    char text[STATUS_CHARACTERS + 1];
+    unsigned char letters[MAX_LETTERS];
+    PROFILE_BEGIN(PROFILE_SHOW_HINT);
+
+    if (word == 0)
+    {
+        Application_showStatus(app_p, hal_p, "Hint: no word fits");
+    }
+    else
+    {
+        Score_unpackWord(word, letters);
+        snprintf(text, sizeof(text), "Hint: %.*s %u left", MAX_LETTERS, letters, (unsigned) Candidates_count());
+        Application_showStatus(app_p, hal_p, text);
+    }
+    PROFILE_END(PROFILE_SHOW_HINT);
 }
 
-// TWO FUNCTIONS FOR THE GUESSING PART: Algorithm and display: FIX THE SQUARES AND THE ALGORITHM FOR ADDING UP THE CORRECT AMOUNT
+/**
+ * Scores the guess with the packed-word kernel against player 1's word and
+ * shows the feedback.
+ */
 void Application_wordleAlgo(Application *app_p, HAL *hal_p)
 {
-    app_p->correct = 0; // Resets Correct app struct variable whenever WordleAlgo is called
-    int i, j;
+    PROFILE_BEGIN(PROFILE_WORDLE_ALGO);
+    FeedbackCode code = Score_feedback(Score_packWord(app_p->guessWord),
+                                       Score_packWord(app_p->answer));
+    Application_showFeedback(app_p, hal_p, code);
+    PROFILE_END(PROFILE_WORDLE_ALGO);
+}
+
+/**
+ * Starts the board choosing the feedback for the guess in Absurdle. It sorts
+ * the candidates a slice per super-loop from Application_updateAbsurdle(),
+ * once Application_updateNarrowing() has them narrowed by the last feedback.
+ */
+void Application_startAbsurdle(Application *app_p, HAL *hal_p)
+{
+    Hint_reset(); // A hint still thinking would be about the old candidates by the time it is done
+    WheelTimer_cancel(&app_p->hintTimer);
+    app_p->hinting = false;
+    if (!app_p->narrowing)
+    {
+        Absurdle_start(Score_packWord(app_p->guessWord));
+    }
+    app_p->judging = true;
+    app_p->hintProgress = 0;
+    Application_showStatus(app_p, hal_p, "Judging 0%");
+}
+
+/**
+ * Runs one slice of the board's choice and shows how far it has come. When it
+ * is done, the feedback it chose is shown and the next guess begins.
+ */
+void Application_updateAbsurdle(Application *app_p, HAL *hal_p)
+{
+    char text[STATUS_CHARACTERS + 1];
+    uint64_t deadline = Clock_cycles() + Clock_fromUs(TASK_SLICE_US);
+    bool done;
+
+    PROFILE_BEGIN(PROFILE_ABSURDLE_STEP); // Its row of the profiling table is the cycles of a slice on the M4
+    do
+    {
+        done = Absurdle_step(ABSURDLE_STEP_WORDS);
+    } while (!done && (Clock_cycles() < deadline));
+    PROFILE_END(PROFILE_ABSURDLE_STEP);
+
+    if (done)
+    {
+        app_p->judging = false;
+        Application_showStatus(app_p, hal_p, "");
+        Application_showFeedback(app_p, hal_p, Absurdle_feedback());
+        // Reset the letter state and update guess state to next guess
+        app_p->letter = FIRST;
+        app_p->counter = 0;
+        app_p->guess = (GuessAmount) ((int) app_p->guess + 1);
+    }
+    else if (Absurdle_progress() != app_p->hintProgress)
+    {
+        app_p->hintProgress = Absurdle_progress();
+        snprintf(text, sizeof(text), "Judging %u%%", (unsigned) app_p->hintProgress);
+        Application_showStatus(app_p, hal_p, text);
+    }
+}
+
+/**
+ * Starts narrowing the candidates by the feedback the guess got, which
+ * Application_updateNarrowing() does a slice at a time, and draws one
+ * coloured square per letter, so each square is painted exactly once.
+ */
+void Application_showFeedback(Application *app_p, HAL *hal_p, FeedbackCode code)
+{
+    int i;
     int vert;
+    PROFILE_BEGIN(PROFILE_SHOW_FEEDBACK);
     vert = (int) app_p->guess; // Guess state
     Graphics_Rectangle R;
-    // Reinitialize every time bc its not supposed to carry on guess by guess
-    int correctAmt = 0; // Local variable to later set to correct app struct
+    Candidates_startFeedback(Score_packWord(app_p->guessWord), code); // Narrows the possible answers
+    app_p->narrowing = true;
+    Strategy_addFeedback(Score_packWord(app_p->guessWord), code); // Follows the strategy tree, or leaves it
+    Hint_reset(); // Stops a hint which is still thinking about the old ones
+    WheelTimer_cancel(&app_p->hintTimer);
+    app_p->hinting = false;
     for (i = 0; i < MAX_LETTERS; i++)
     {
-        bool status = false; // Used to determine if this position is already filled with a square or not, reinitializes every time it loops
-        R.xMin = 55 + (i * 12);
-        R.xMax = 62 + (i * 12);
-        R.yMin = 18 + (vert * 12);
-        R.yMax = 25 + (vert * 12);
-        if (app_p->guessWord[i] == app_p->answer[i]) // Compares the guessingWord struct var to the answer letter by letter
+        R.xMin = LAYOUT_TILE_X + (i * LAYOUT_TILE_PITCH);
+        R.xMax = R.xMin + LAYOUT_TILE_SIZE - 1;
+        R.yMin = LAYOUT_FIRST_ROW_Y - 2 + (vert * LAYOUT_ROW_PITCH);
+        R.yMax = R.yMin + LAYOUT_TILE_HEIGHT - 1;
+        switch (Score_letterAt(code, i))
         {
-            // Green box
+        case GREEN:
             Graphics_setForegroundColor(&hal_p->g_sContext,
             GRAPHICS_COLOR_GREEN);
-            Graphics_fillRectangle(&hal_p->g_sContext, &R);
-            status = true;
-            correctAmt = correctAmt + 1; // When they get it right, it adds to the local variable
-        }
-        for (j = 0; j < MAX_LETTERS; j++) // Nested for loop to run through all answer letter by letter and compare to each letter from guessWord
-        {
-            if (status != true)
-            {
-                // Gray box
-                Graphics_setForegroundColor(&hal_p->g_sContext,
-                GRAPHICS_COLOR_GRAY);
-                Graphics_fillRectangle(&hal_p->g_sContext, &R);
-                if ((app_p->guessWord[i] == app_p->answer[j]))
-                {
-                    // Yellow Box
-                    Graphics_setForegroundColor(&hal_p->g_sContext,
-                    GRAPHICS_COLOR_YELLOW);
-                    Graphics_fillRectangle(&hal_p->g_sContext, &R);
-                    status = true; // Since it is filled with a color that's not gray
-                }
-            }
-        }
+            break;
+
+        case YELLOW:
+            Graphics_setForegroundColor(&hal_p->g_sContext,
+            GRAPHICS_COLOR_YELLOW);
+            break;
 
+        default:
+            Graphics_setForegroundColor(&hal_p->g_sContext,
+            GRAPHICS_COLOR_GRAY);
+            break;
+        }
+        DisplayList_fillRectangle(&hal_p->g_sContext, &R);
     }
     Graphics_setForegroundColor(&hal_p->g_sContext, GRAPHICS_COLOR_WHITE); // Reinitialize the foreground color for the text
-    app_p->correct = app_p->correct + correctAmt; // Adds the correct Amt to a struct variable
+    app_p->correct = Score_greenCount(code); // Number of letters in the right place
     Application_correctResult(app_p, hal_p); // Dislays the conditions for winning, losing, or neither
+    PROFILE_END(PROFILE_SHOW_FEEDBACK);
 }
 
 /**
@@ -585,24 +1039,38 @@ void Application_wordleAlgo(Application *app_p, HAL *hal_p)
 void Application_correctResult(Application *app_p, HAL *hal_p)
 {
     // This needs to be checked everycase.
-    if (app_p->correct == 5) // If Player 2 guesses the correct answer within 6 tries
+    if (app_p->correct == MAX_LETTERS) // If Player 2 guesses the correct answer within MAX_GUESSES tries
     {
         Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc14);
-        Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Player 2 Wins", -1,
-                            13, 94, true);
+        DisplayList_drawString(&hal_p->g_sContext, "Player 2 Wins", -1,
+                               13, LAYOUT_RESULT_Y, true);
         app_p->guess = RESULT;
     }
-    else if ((app_p->guess == SIX) && (app_p->correct != 5)) // If Player 2 doesn't get it within 6 tries
+    else if ((app_p->guess == LAST_GUESS) && (app_p->correct != MAX_LETTERS)) // If Player 2 doesn't get it within MAX_GUESSES tries
     {
-        Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc12);
-        Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Player 1 Wins", -1,
-                            15, 94, true);
-        Graphics_drawString(&hal_p->g_sContext, (int8_t*) "Word : ", -1, 15,
-                            109, true);
-        Graphics_drawString(&hal_p->g_sContext, (int8_t*) app_p->answer, 5, 65,
-                            109, true);
+        // In ABSURDLE the board owns up to one of the words it still had open, which it only knows once
+        // Application_updateNarrowing() has them narrowed by this feedback; that shows the result then
+        if (app_p->state != ABSURDLE)
+        {
+            Application_showLoss(app_p, hal_p);
+        }
         app_p->guess = RESULT;
     }
     // Everything else will just run through this without changing anything.
 
 }
+
+/**
+ * Displays that player 2 has run out of guesses, and the word.
+ */
+void Application_showLoss(Application *app_p, HAL *hal_p)
+{
+    Graphics_setFont(&hal_p->g_sContext, &g_sFontCmsc12);
+    DisplayList_drawString(&hal_p->g_sContext,
+                           ((app_p->state == ABSURDLE) ? "Board Wins" : "Player 1 Wins"), -1,
+                           15, LAYOUT_RESULT_Y, true);
+    DisplayList_drawString(&hal_p->g_sContext, "Word : ", -1, 15,
+                           LAYOUT_RESULT_Y + LAYOUT_RESULT_PITCH, true);
+    DisplayList_drawString(&hal_p->g_sContext, (const char*) app_p->answer, MAX_LETTERS, 65,
+                           LAYOUT_RESULT_Y + LAYOUT_RESULT_PITCH, true);
+}
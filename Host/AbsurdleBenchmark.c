@@ -0,0 +1,259 @@
+/*
+ * AbsurdleBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the adversarial board in Wordle/Absurdle.c. The
+ * board's longest choice is the first, over every dictionary word, so it first
+ * judges every OPENER_STRIDE-th word as an opening guess in ABSURDLE_STEP_WORDS
+ * steps, the granules the game's slices are made of, and reports the worst and
+ * average time per guess, the number of steps and the longest step. Then it
+ * plays a game from each of a few openers, guessing the hint every time after,
+ * and reports how long the board held out, and the time of Absurdle_answer()
+ * at the end. Every choice is checked against a plain count of the
+ * candidates' feedback: it must be a largest group, and the candidates must
+ * narrow to it. The answer must be the first candidate of a walk over the
+ * dictionary.
+ *
+ * Host times are only a guide to the MSP432: the number of words per step is
+ * what bounds how far a slice runs over TASK_SLICE_US on the board, and the
+ * Absurdle_step row of the board's profiling table (Ctrl-P) has the cycles of
+ * a slice on the M4.
+ *
+ *   AbsurdleBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Wordle/Absurdle.h>
+#include <Wordle/Candidates.h>
+#include <Wordle/Dictionary.h>
+#include <Wordle/Hint.h>
+
+// Every OPENER_STRIDE-th dictionary word is judged as an opening guess
+#define OPENER_STRIDE       7
+
+// The game's number of guesses
+#define MAX_GUESSES         6
+
+// A game against the board which is not won after this many guesses is given up
+#define PLAY_LIMIT          12
+
+static const char* const openers[] = { "CRANE", "SLATE", "TARES", "AUDIO", "FUZZY" };
+
+#define NUM_OPENERS (sizeof(openers) / sizeof(openers[0]))
+
+struct _JudgeTime
+{
+    double totalNs;     // Time of the whole choice
+    double maxStepNs;   // Time of the longest Absurdle_step()
+    uint32_t steps;     // Number of Absurdle_step() calls
+};
+typedef struct _JudgeTime JudgeTime;
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Runs the board's choice to the end in steps, the way Application_updateAbsurdle()'s slices do, and times it. */
+static JudgeTime runJudge(PackedWord guess)
+{
+    JudgeTime time = { 0.0, 0.0, 0 };
+    double start = nowNs();
+    bool done = false;
+
+    Absurdle_start(guess);
+    while (!done)
+    {
+        double stepStart = nowNs();
+        double stepNs;
+
+        done = Absurdle_step(ABSURDLE_STEP_WORDS);
+        stepNs = nowNs() - stepStart;
+
+        time.steps++;
+        if (stepNs > time.maxStepNs)
+        {
+            time.maxStepNs = stepNs;
+        }
+    }
+    time.totalNs = nowNs() - start;
+
+    return time;
+}
+
+/** Returns true if the board's choice for a guess is a largest group of the candidates' feedback. */
+static bool checkChoice(PackedWord guess)
+{
+    uint32_t histogram[SCORE_NUM_CODES] = { 0 };
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+    uint32_t index = 0, largest = 0, code;
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        if (Candidates_contains(index++))
+        {
+            histogram[Score_feedback(guess, word)]++;
+        }
+    }
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        largest = (histogram[code] > largest) ? histogram[code] : largest;
+    }
+    return histogram[Absurdle_feedback()] == largest && Absurdle_remaining() == largest;
+}
+
+/** Times a choice, checks it and narrows the candidates to it. Returns false if the check fails. */
+static bool judge(PackedWord guess, JudgeTime* time_p)
+{
+    unsigned char letters[SCORE_WORD_LENGTH];
+
+    *time_p = runJudge(guess);
+    if (!checkChoice(guess))
+    {
+        Score_unpackWord(guess, letters);
+        fprintf(stderr, "%.5s: the board did not keep a largest group\n", letters);
+        return false;
+    }
+    Candidates_addFeedback(guess, Absurdle_feedback());
+    if (Candidates_count() != Absurdle_remaining())
+    {
+        Score_unpackWord(guess, letters);
+        fprintf(stderr, "%.5s: the candidates did not narrow to the group the board kept\n", letters);
+        return false;
+    }
+    return true;
+}
+
+/** Returns the first candidate of a walk over the whole dictionary, or 0. */
+static PackedWord firstCandidate(void)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+    uint32_t index = 0;
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        if (Candidates_contains(index++))
+        {
+            return word;
+        }
+    }
+    return 0;
+}
+
+/** Runs a hint search to the end, without a time limit. */
+static PackedWord searchHint(void)
+{
+    Hint_reset();
+    Hint_start();
+    while (!Hint_step(HINT_STEP_SCORES))
+    {
+    }
+    return Hint_best();
+}
+
+int main(void)
+{
+    unsigned char letters[SCORE_WORD_LENGTH];
+    DictionaryCursor cursor;
+    PackedWord word, worstWord = 0;
+    JudgeTime time, worst = { 0.0, 0.0, 0 };
+    double start;
+    double totalNs = 0.0, maxStepNs = 0.0, answerNs = 0.0;
+    uint32_t index = 0, judged = 0, largestLeft = 0, i;
+
+    Dictionary_init();
+
+    printf("Absurdle board, %u words, %d words per step:\n", Dictionary_wordCount(), ABSURDLE_STEP_WORDS);
+
+    cursor = Dictionary_cursor();
+    while (Dictionary_next(&cursor, &word))
+    {
+        if (index++ % OPENER_STRIDE != 0)
+        {
+            continue;
+        }
+
+        Candidates_reset();
+        if (!judge(word, &time))
+        {
+            return EXIT_FAILURE;
+        }
+
+        if (Absurdle_answer() != firstCandidate())
+        {
+            Score_unpackWord(word, letters);
+            fprintf(stderr, "%.5s: the board's answer is not its first candidate\n", letters);
+            return EXIT_FAILURE;
+        }
+
+        judged++;
+        totalNs += time.totalNs;
+        maxStepNs = (time.maxStepNs > maxStepNs) ? time.maxStepNs : maxStepNs;
+        largestLeft = (Absurdle_remaining() > largestLeft) ? Absurdle_remaining() : largestLeft;
+        if (time.totalNs > worst.totalNs)
+        {
+            worst = time;
+            worstWord = word;
+        }
+    }
+
+    Score_unpackWord(worstWord, letters);
+    printf("  %u opening guesses judged over %u candidates, %.2f ms on average\n", judged, Dictionary_wordCount(),
+           totalNs / judged / 1e6);
+    printf("  worst guess %.5s: %.2f ms over %u steps; longest step of any guess %.1f us\n", letters,
+           worst.totalNs / 1e6, worst.steps, maxStepNs / 1e3);
+    printf("  most candidates kept after an opening guess: %u\n", largestLeft);
+
+    for (i = 0; i < NUM_OPENERS; i++)
+    {
+        PackedWord guess = Score_packWord((const unsigned char*) openers[i]);
+        double gameNs = 0.0, gameWorstNs = 0.0;
+        uint32_t guesses = 0;
+
+        Candidates_reset();
+        printf("  %s:", openers[i]);
+        for (;;)
+        {
+            if (!judge(guess, &time))
+            {
+                return EXIT_FAILURE;
+            }
+            guesses++;
+            gameNs += time.totalNs;
+            gameWorstNs = (time.totalNs > gameWorstNs) ? time.totalNs : gameWorstNs;
+            printf(" %u", Absurdle_remaining());
+
+            if (Absurdle_feedback() == SCORE_ALL_GREEN || guesses == PLAY_LIMIT)
+            {
+                break;
+            }
+            guess = searchHint();
+        }
+        Score_unpackWord(guess, letters);
+        printf(" left; %s %.5s in %u guesses, board took %.2f ms, %.2f ms at worst\n",
+               (Absurdle_feedback() == SCORE_ALL_GREEN) ? "solved" : "gave up on", letters, guesses,
+               gameNs / 1e6, gameWorstNs / 1e6);
+
+        start = nowNs();
+        word = Absurdle_answer();
+        answerNs = (nowNs() - start > answerNs) ? nowNs() - start : answerNs;
+        if (word != firstCandidate())
+        {
+            fprintf(stderr, "%s: the board's answer is not its first candidate\n", openers[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    printf("  Absurdle_answer() at the end of a game: %.1f us at worst\n", answerNs / 1e3);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,349 @@
+/*
+ * BatchScore.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The vector kernels score every answer of a batch the way Score_feedback()
+ * does, without its table of unmatched letters, which does not vectorise.
+ * For a fixed guess, a letter at position i which is not GREEN is YELLOW if
+ * the answer has more unmatched copies of it than there are earlier positions
+ * of the guess with the same letter which are not GREEN either, since those
+ * take the copies first. Both counts are sums of lane-wise comparisons, and
+ * which earlier positions repeat a letter only depends on the guess, so it is
+ * worked out once per batch.
+ */
+
+#include <string.h>
+
+#include <Analysis/BatchScore.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+// The kernels' loops over letter positions are unrolled, so that every vector stays in a register.
+// Eight covers any word length the game can have.
+#define UNROLL              _Pragma("GCC unroll 8")
+
+// How many codes BatchScore_histogram() scores at a time before counting them
+#define HISTOGRAM_BLOCK     256
+
+// What the kernels need to know about a guess
+struct _GuessPlan
+{
+    PackedWord guess;
+    uint32_t letters[SCORE_WORD_LENGTH];
+    uint32_t weights[SCORE_WORD_LENGTH];    // Place value of each position in a FeedbackCode
+    uint8_t earlier[SCORE_WORD_LENGTH];     // Bit j set if position j < i has the same letter as i
+};
+typedef struct _GuessPlan GuessPlan;
+
+typedef void (*CodesFunction)(const GuessPlan* plan, const PackedWord* answers, uint32_t count, FeedbackCode* codes);
+
+static BatchScoreIsa selected = BATCH_SCORE_NUM_ISAS;
+
+static const char* const names[BATCH_SCORE_NUM_ISAS] = { "scalar", "SSE4.2", "AVX2" };
+
+static void BatchScore_plan(PackedWord guess, GuessPlan* plan)
+{
+    uint32_t weight = 1;
+    int i, j;
+
+    plan->guess = guess;
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        plan->letters[i] = SCORE_LETTER(guess, i);
+        plan->weights[i] = weight;
+        plan->earlier[i] = 0;
+        for (j = 0; j < i; j++)
+        {
+            plan->earlier[i] |= (uint8_t) ((plan->letters[j] == plan->letters[i]) << j);
+        }
+        weight *= 3;
+    }
+}
+
+static void BatchScore_codesScalar(const GuessPlan* plan, const PackedWord* answers, uint32_t count,
+                                   FeedbackCode* codes)
+{
+    uint32_t n;
+
+    for (n = 0; n < count; n++)
+    {
+        codes[n] = Score_feedback(plan->guess, answers[n]);
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+
+/**
+ * Scores four answers. Comparisons give -1 for true, so subtracting them
+ * counts. The guess letters and the values of GREEN and YELLOW at each
+ * position come in broadcast to every lane, since they are the same for the
+ * whole batch.
+ */
+__attribute__((target("sse4.2")))
+static inline __m128i BatchScore_kernelSse42(__m128i answer, const GuessPlan* plan, const __m128i* guessLetters,
+                                             const __m128i* greenWeights, const __m128i* yellowWeights)
+{
+    const __m128i letterMask = _mm_set1_epi32(SCORE_LETTER_MASK);
+    const __m128i ones = _mm_set1_epi32(-1);
+    __m128i letters[SCORE_WORD_LENGTH], green[SCORE_WORD_LENGTH];
+    __m128i code = _mm_setzero_si128();
+    int i, j;
+
+    UNROLL
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        letters[i] = _mm_and_si128(_mm_srli_epi32(answer, SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1 - i)),
+                                   letterMask);
+        green[i] = _mm_cmpeq_epi32(letters[i], guessLetters[i]);
+    }
+
+    UNROLL
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        __m128i unmatched = _mm_setzero_si128();
+        __m128i earlier = _mm_setzero_si128();
+        __m128i yellow;
+
+        UNROLL
+        for (j = 0; j < SCORE_WORD_LENGTH; j++)
+        {
+            unmatched = _mm_sub_epi32(unmatched,
+                                      _mm_andnot_si128(green[j], _mm_cmpeq_epi32(letters[j], guessLetters[i])));
+        }
+        UNROLL
+        for (j = 0; j < i; j++)
+        {
+            if (plan->earlier[i] & (1 << j))
+            {
+                earlier = _mm_sub_epi32(earlier, _mm_andnot_si128(green[j], ones));
+            }
+        }
+        yellow = _mm_andnot_si128(green[i], _mm_cmpgt_epi32(unmatched, earlier));
+
+        code = _mm_add_epi32(code, _mm_and_si128(green[i], greenWeights[i]));
+        code = _mm_add_epi32(code, _mm_and_si128(yellow, yellowWeights[i]));
+    }
+
+    return code;
+}
+
+__attribute__((target("sse4.2")))
+static void BatchScore_codesSse42(const GuessPlan* plan, const PackedWord* answers, uint32_t count,
+                                  FeedbackCode* codes)
+{
+    __m128i guessLetters[SCORE_WORD_LENGTH], greenWeights[SCORE_WORD_LENGTH], yellowWeights[SCORE_WORD_LENGTH];
+    uint32_t n;
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        guessLetters[i] = _mm_set1_epi32((int) plan->letters[i]);
+        greenWeights[i] = _mm_set1_epi32((int) (GREEN * plan->weights[i]));
+        yellowWeights[i] = _mm_set1_epi32((int) (YELLOW * plan->weights[i]));
+    }
+
+    for (n = 0; n + 4 <= count; n += 4)
+    {
+        __m128i code = BatchScore_kernelSse42(_mm_loadu_si128((const __m128i*) &answers[n]), plan, guessLetters,
+                                              greenWeights, yellowWeights);
+        int32_t packed;
+
+        code = _mm_packus_epi32(code, code);
+        code = _mm_packus_epi16(code, code);
+        packed = _mm_cvtsi128_si32(code);
+        memcpy(&codes[n], &packed, sizeof(packed));
+    }
+
+    BatchScore_codesScalar(plan, &answers[n], count - n, &codes[n]);
+}
+
+/** Scores eight answers, the same way as BatchScore_kernelSse42(). */
+__attribute__((target("avx2")))
+static inline __m256i BatchScore_kernelAvx2(__m256i answer, const GuessPlan* plan, const __m256i* guessLetters,
+                                            const __m256i* greenWeights, const __m256i* yellowWeights)
+{
+    const __m256i letterMask = _mm256_set1_epi32(SCORE_LETTER_MASK);
+    const __m256i ones = _mm256_set1_epi32(-1);
+    __m256i letters[SCORE_WORD_LENGTH], green[SCORE_WORD_LENGTH];
+    __m256i code = _mm256_setzero_si256();
+    int i, j;
+
+    UNROLL
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        letters[i] = _mm256_and_si256(_mm256_srli_epi32(answer, SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - 1 - i)),
+                                      letterMask);
+        green[i] = _mm256_cmpeq_epi32(letters[i], guessLetters[i]);
+    }
+
+    UNROLL
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        __m256i unmatched = _mm256_setzero_si256();
+        __m256i earlier = _mm256_setzero_si256();
+        __m256i yellow;
+
+        UNROLL
+        for (j = 0; j < SCORE_WORD_LENGTH; j++)
+        {
+            unmatched = _mm256_sub_epi32(unmatched,
+                                         _mm256_andnot_si256(green[j], _mm256_cmpeq_epi32(letters[j], guessLetters[i])));
+        }
+        UNROLL
+        for (j = 0; j < i; j++)
+        {
+            if (plan->earlier[i] & (1 << j))
+            {
+                earlier = _mm256_sub_epi32(earlier, _mm256_andnot_si256(green[j], ones));
+            }
+        }
+        yellow = _mm256_andnot_si256(green[i], _mm256_cmpgt_epi32(unmatched, earlier));
+
+        code = _mm256_add_epi32(code, _mm256_and_si256(green[i], greenWeights[i]));
+        code = _mm256_add_epi32(code, _mm256_and_si256(yellow, yellowWeights[i]));
+    }
+
+    return code;
+}
+
+__attribute__((target("avx2")))
+static void BatchScore_codesAvx2(const GuessPlan* plan, const PackedWord* answers, uint32_t count,
+                                 FeedbackCode* codes)
+{
+    __m256i guessLetters[SCORE_WORD_LENGTH], greenWeights[SCORE_WORD_LENGTH], yellowWeights[SCORE_WORD_LENGTH];
+    uint32_t n;
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        guessLetters[i] = _mm256_set1_epi32((int) plan->letters[i]);
+        greenWeights[i] = _mm256_set1_epi32((int) (GREEN * plan->weights[i]));
+        yellowWeights[i] = _mm256_set1_epi32((int) (YELLOW * plan->weights[i]));
+    }
+
+    for (n = 0; n + 8 <= count; n += 8)
+    {
+        __m256i code = BatchScore_kernelAvx2(_mm256_loadu_si256((const __m256i*) &answers[n]), plan, guessLetters,
+                                             greenWeights, yellowWeights);
+        __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(code), _mm256_extracti128_si256(code, 1));
+
+        _mm_storel_epi64((__m128i*) &codes[n], _mm_packus_epi16(packed, packed));
+    }
+
+    BatchScore_codesScalar(plan, &answers[n], count - n, &codes[n]);
+}
+
+#endif /* HAVE_X86_SIMD */
+
+bool BatchScore_supported(BatchScoreIsa isa)
+{
+    switch (isa)
+    {
+    case BATCH_SCORE_SCALAR:
+        return true;
+#ifdef HAVE_X86_SIMD
+    case BATCH_SCORE_SSE42:
+        return __builtin_cpu_supports("sse4.2");
+    case BATCH_SCORE_AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+BatchScoreIsa BatchScore_isa(void)
+{
+    int isa;
+
+    if (selected == BATCH_SCORE_NUM_ISAS)
+    {
+        for (isa = BATCH_SCORE_NUM_ISAS - 1; !BatchScore_supported((BatchScoreIsa) isa); isa--)
+        {
+        }
+        selected = (BatchScoreIsa) isa;
+    }
+    return selected;
+}
+
+bool BatchScore_select(BatchScoreIsa isa)
+{
+    if (!BatchScore_supported(isa))
+    {
+        return false;
+    }
+    selected = isa;
+    return true;
+}
+
+const char* BatchScore_name(BatchScoreIsa isa)
+{
+    return (isa < BATCH_SCORE_NUM_ISAS) ? names[isa] : "unknown";
+}
+
+static CodesFunction BatchScore_function(void)
+{
+    switch (BatchScore_isa())
+    {
+#ifdef HAVE_X86_SIMD
+    case BATCH_SCORE_SSE42:
+        return BatchScore_codesSse42;
+    case BATCH_SCORE_AVX2:
+        return BatchScore_codesAvx2;
+#endif
+    default:
+        return BatchScore_codesScalar;
+    }
+}
+
+void BatchScore_codes(PackedWord guess, const PackedWord* answers, uint32_t count, FeedbackCode* codes)
+{
+    GuessPlan plan;
+
+    BatchScore_plan(guess, &plan);
+    BatchScore_function()(&plan, answers, count, codes);
+}
+
+/**
+ * Scores a block at a time into a small buffer and counts its codes. The
+ * counts are spread over four histograms, so that runs of the same code do not
+ * wait on each other's increments, and added up at the end.
+ */
+void BatchScore_histogram(PackedWord guess, const PackedWord* answers, uint32_t count, uint32_t* histogram)
+{
+    CodesFunction codesFunction = BatchScore_function();
+    FeedbackCode codes[HISTOGRAM_BLOCK];
+    uint32_t partial[4][SCORE_NUM_CODES];
+    GuessPlan plan;
+    uint32_t n, i, block;
+
+    BatchScore_plan(guess, &plan);
+    memset(partial, 0, sizeof(partial));
+
+    for (n = 0; n < count; n += block)
+    {
+        block = (count - n < HISTOGRAM_BLOCK) ? count - n : HISTOGRAM_BLOCK;
+        codesFunction(&plan, &answers[n], block, codes);
+
+        for (i = 0; i + 4 <= block; i += 4)
+        {
+            partial[0][codes[i]]++;
+            partial[1][codes[i + 1]]++;
+            partial[2][codes[i + 2]]++;
+            partial[3][codes[i + 3]]++;
+        }
+        for (; i < block; i++)
+        {
+            partial[0][codes[i]]++;
+        }
+    }
+
+    for (i = 0; i < SCORE_NUM_CODES; i++)
+    {
+        histogram[i] = partial[0][i] + partial[1][i] + partial[2][i] + partial[3][i];
+    }
+}
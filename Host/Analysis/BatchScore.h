@@ -0,0 +1,51 @@
+/*
+ * BatchScore.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host-only batch scoring for analysis tools: one guess against a whole array
+ * of packed answers per call, with the same results as Score_feedback(). On
+ * x86 the work is done 8 answers at a time with AVX2 or 4 at a time with
+ * SSE4.2, whichever the CPU has, picked when the first batch is scored.
+ * Anywhere else, or on a CPU with neither, it is a loop over Score_feedback().
+ */
+
+#ifndef ANALYSIS_BATCHSCORE_H_
+#define ANALYSIS_BATCHSCORE_H_
+
+#include <Wordle/Score.h>
+
+// The SIMD paths keep a packed word in a 32-bit lane
+#if SCORE_WORD_LENGTH * SCORE_BITS_PER_LETTER > 32
+#error "the batch scorer only takes words of up to 6 letters"
+#endif
+
+// The ways a batch can be scored, slowest first
+enum _BatchScoreIsa
+{
+    BATCH_SCORE_SCALAR,
+    BATCH_SCORE_SSE42,
+    BATCH_SCORE_AVX2,
+    BATCH_SCORE_NUM_ISAS
+};
+typedef enum _BatchScoreIsa BatchScoreIsa;
+
+// Returns true if the CPU can run the given way of scoring
+bool BatchScore_supported(BatchScoreIsa isa);
+
+// Returns the way batches are scored
+BatchScoreIsa BatchScore_isa(void);
+
+// Makes batches be scored a given way, for comparing them. Returns false if the CPU cannot run it.
+bool BatchScore_select(BatchScoreIsa isa);
+
+// Returns a short name of a way of scoring, such as "AVX2"
+const char* BatchScore_name(BatchScoreIsa isa);
+
+// Scores a guess against count answers, writing one feedback code per answer
+void BatchScore_codes(PackedWord guess, const PackedWord* answers, uint32_t count, FeedbackCode* codes);
+
+// Scores a guess against count answers and counts how many got each of the SCORE_NUM_CODES feedback codes
+void BatchScore_histogram(PackedWord guess, const PackedWord* answers, uint32_t count, uint32_t* histogram);
+
+#endif /* ANALYSIS_BATCHSCORE_H_ */
@@ -0,0 +1,737 @@
+/*
+ * DecisionTree.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Analysis/DecisionTree.h>
+#include <Analysis/WorkPool.h>
+
+// Guesses summed over the answers of a set; INFEASIBLE if it cannot be done, or was cut off
+typedef uint32_t Cost;
+#define INFEASIBLE      UINT32_MAX
+
+#define MEMO_WAYS       4
+#define MEMO_LOCKS      1024
+
+// The best guess for a set of answers with a number of guesses left, keyed by a hash of both
+struct _MemoEntry
+{
+    uint64_t key;
+    Cost cost;
+    uint16_t guess;
+    uint16_t used;
+};
+typedef struct _MemoEntry MemoEntry;
+
+// Everything the tasks of one search share
+struct _Solver
+{
+    const FeedbackMatrix* matrix;
+    WorkPool* pool;
+    uint32_t topGuesses;
+    uint16_t* answerGuesses;    // The guess index of each answer
+    double* weights;            // count * log2(count), for every count up to answerCount
+
+    MemoEntry* memo;            // Buckets of MEMO_WAYS entries
+    uint64_t memoMask;          // Buckets - 1
+    pthread_mutex_t locks[MEMO_LOCKS];
+
+    uint64_t nodes;
+    uint64_t memoHits;
+    int outOfMemory;
+};
+typedef struct _Solver Solver;
+
+// One of the guesses tried at a node
+struct _GuessJob
+{
+    Solver* solver;
+    const uint16_t* set;
+    uint32_t count;
+    uint32_t left;
+    uint16_t guess;
+    Cost* best;
+    Cost cost;
+};
+typedef struct _GuessJob GuessJob;
+
+// The subtree for one feedback of a guess
+struct _SubtreeJob
+{
+    Solver* solver;
+    const uint16_t* set;
+    uint32_t count;
+    uint32_t left;
+    Cost cost;
+};
+typedef struct _SubtreeJob SubtreeJob;
+
+static Cost Solver_solve(Solver* solver, const uint16_t* set, uint32_t count, uint32_t left, uint16_t* bestGuess);
+
+static double DecisionTree_nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static Cost Solver_add(Cost a, Cost b)
+{
+    return (a == INFEASIBLE || b == INFEASIBLE) ? INFEASIBLE : a + b;
+}
+
+/** Hashes a set of answers, which is always in ascending order, together with the guesses left. */
+static uint64_t Solver_key(const uint16_t* set, uint32_t count, uint32_t left)
+{
+    uint64_t key = (((uint64_t) count << 8) | left) * 0x9E3779B97F4A7C15ull;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        key = (key ^ set[i]) * 0xFF51AFD7ED558CCDull;
+        key ^= key >> 32;
+    }
+    return key;
+}
+
+static bool Solver_recall(Solver* solver, uint64_t key, Cost* cost, uint16_t* guess)
+{
+    uint64_t bucket = key & solver->memoMask;
+    MemoEntry* entries = &solver->memo[bucket * MEMO_WAYS];
+    pthread_mutex_t* lock = &solver->locks[bucket % MEMO_LOCKS];
+    bool found = false;
+    uint32_t way;
+
+    pthread_mutex_lock(lock);
+    for (way = 0; way < MEMO_WAYS && !found; way++)
+    {
+        if (entries[way].used && entries[way].key == key)
+        {
+            *cost = entries[way].cost;
+            *guess = entries[way].guess;
+            found = true;
+        }
+    }
+    pthread_mutex_unlock(lock);
+    return found;
+}
+
+/** Stores a result in a free way of its bucket, or over one picked by the key when the bucket is full. */
+static void Solver_remember(Solver* solver, uint64_t key, Cost cost, uint16_t guess)
+{
+    uint64_t bucket = key & solver->memoMask;
+    MemoEntry* entries = &solver->memo[bucket * MEMO_WAYS];
+    pthread_mutex_t* lock = &solver->locks[bucket % MEMO_LOCKS];
+    uint32_t way;
+
+    pthread_mutex_lock(lock);
+    for (way = 0; way < MEMO_WAYS; way++)
+    {
+        if (!entries[way].used || entries[way].key == key)
+        {
+            break;
+        }
+    }
+    if (way == MEMO_WAYS)
+    {
+        way = (uint32_t) (key >> 62) % MEMO_WAYS;
+    }
+    entries[way].key = key;
+    entries[way].cost = cost;
+    entries[way].guess = guess;
+    entries[way].used = 1;
+    pthread_mutex_unlock(lock);
+}
+
+/**
+ * Ranks every guess by count * log2(count) summed over the feedback it gets
+ * from the set, the lower the more entropy, as Hint_rank() does on the board.
+ * Guesses which leave the set whole are skipped. Keeps the best wanted in
+ * order and returns how many there are.
+ */
+static uint32_t Solver_rank(const Solver* solver, const uint16_t* set, uint32_t count, uint16_t* top,
+                            uint32_t wanted)
+{
+    const FeedbackMatrix* matrix = solver->matrix;
+    uint32_t histogram[SCORE_NUM_CODES] = { 0 };
+    double scores[DECISION_TREE_MAX_TOP];
+    bool candidates[DECISION_TREE_MAX_TOP];
+    uint32_t kept = 0, guess, i, j;
+
+    for (guess = 0; guess < matrix->guessCount; guess++)
+    {
+        const FeedbackCode* row = FeedbackMatrix_row(matrix, guess);
+        uint32_t largest = 0;
+        double score = 0;
+        bool candidate;
+
+        for (i = 0; i < count; i++)
+        {
+            uint32_t size = ++histogram[row[set[i]]];
+            largest = (size > largest) ? size : largest;
+        }
+        candidate = (histogram[SCORE_ALL_GREEN] != 0);
+
+        // Only the codes which come up are summed and cleared
+        for (i = 0; i < count; i++)
+        {
+            FeedbackCode code = row[set[i]];
+
+            if (histogram[code] != 0)
+            {
+                score += solver->weights[histogram[code]];
+                histogram[code] = 0;
+            }
+        }
+
+        if (largest == count)
+        {
+            continue;
+        }
+
+        // Candidates win ties, since they might be the answer
+        for (j = kept; j > 0; j--)
+        {
+            if (score > scores[j - 1] || (score == scores[j - 1] && (candidates[j - 1] || !candidate)))
+            {
+                break;
+            }
+        }
+        if (j >= wanted)
+        {
+            continue;
+        }
+
+        kept += (kept < wanted);
+        for (i = kept - 1; i > j; i--)
+        {
+            scores[i] = scores[i - 1];
+            candidates[i] = candidates[i - 1];
+            top[i] = top[i - 1];
+        }
+        scores[j] = score;
+        candidates[j] = candidate;
+        top[j] = (uint16_t) guess;
+    }
+    return kept;
+}
+
+/**
+ * With two guesses left, the next guess has to tell every answer apart, so
+ * ranking is no help: returns the cost of the first guess which does, or
+ * better of the first which is also one of the answers, or INFEASIBLE if none
+ * does.
+ */
+static Cost Solver_split(const Solver* solver, const uint16_t* set, uint32_t count, uint16_t* bestGuess)
+{
+    const FeedbackMatrix* matrix = solver->matrix;
+    uint8_t seen[SCORE_NUM_CODES] = { 0 };
+    Cost bestCost = INFEASIBLE;
+    uint32_t guess, i;
+
+    for (guess = 0; guess < matrix->guessCount && bestCost != 2 * count - 1; guess++)
+    {
+        const FeedbackCode* row = FeedbackMatrix_row(matrix, guess);
+        bool apart = true;
+
+        for (i = 0; i < count && apart; i++)
+        {
+            apart = !seen[row[set[i]]];
+            seen[row[set[i]]] = 1;
+        }
+        for (i = 0; i < count; i++)
+        {
+            seen[row[set[i]]] = 0;
+        }
+
+        // Each answer takes this guess and then itself, but for the one this guess is
+        if (apart)
+        {
+            bool hit = false;
+
+            for (i = 0; i < count; i++)
+            {
+                hit = hit || (row[set[i]] == SCORE_ALL_GREEN);
+            }
+            if (bestCost == INFEASIBLE || hit)
+            {
+                bestCost = hit ? 2 * count - 1 : 2 * count;
+                *bestGuess = (uint16_t) guess;
+            }
+        }
+    }
+    return bestCost;
+}
+
+static void Solver_subtreeJob(void* argument)
+{
+    SubtreeJob* job = argument;
+    uint16_t guess;
+
+    job->cost = Solver_solve(job->solver, job->set, job->count, job->left, &guess);
+}
+
+/**
+ * Returns the cost of a guess at a set: one guess for every answer, plus the
+ * best subtree for every feedback but all green. Gives up, returning
+ * INFEASIBLE, once the cost is known to be over *best, and lowers *best, which
+ * may be shared with other tasks trying other guesses, when it does better.
+ */
+static Cost Solver_try(Solver* solver, const uint16_t* set, uint32_t count, uint32_t left, uint16_t guess,
+                       Cost* best)
+{
+    const FeedbackCode* row = FeedbackMatrix_row(solver->matrix, guess);
+    uint32_t sizes[SCORE_NUM_CODES] = { 0 };
+    uint32_t starts[SCORE_NUM_CODES];
+    uint16_t* parts;
+    SubtreeJob* jobs = NULL;
+    WorkGroup group = { 0 };
+    uint32_t jobCount = 0, start = 0, code, i;
+    Cost cost = count, seen;
+
+    for (i = 0; i < count; i++)
+    {
+        sizes[row[set[i]]]++;
+    }
+
+    // Every answer it does not hit takes another guess, and all but one of each feedback at least two more
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        if (code != SCORE_ALL_GREEN && sizes[code] != 0)
+        {
+            cost += 2 * sizes[code] - 1;
+        }
+    }
+    if (cost > __atomic_load_n(best, __ATOMIC_RELAXED))
+    {
+        return INFEASIBLE;
+    }
+
+    parts = malloc(count * sizeof(uint16_t));
+    if (count >= DECISION_TREE_PARALLEL_MIN)
+    {
+        jobs = malloc((count / DECISION_TREE_PARALLEL_MIN) * sizeof(SubtreeJob));
+    }
+    if (parts == NULL || (count >= DECISION_TREE_PARALLEL_MIN && jobs == NULL))
+    {
+        __atomic_store_n(&solver->outOfMemory, 1, __ATOMIC_RELAXED);
+        free(parts);
+        free(jobs);
+        return INFEASIBLE;
+    }
+
+    // Splits the set by feedback, each part still in ascending order
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        starts[code] = start;
+        start += sizes[code];
+    }
+    for (i = 0; i < count; i++)
+    {
+        parts[starts[row[set[i]]]++] = set[i];
+    }
+
+    cost = count;
+    start = 0;
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        const uint16_t* part = &parts[start];
+
+        start += sizes[code];
+        if (code == SCORE_ALL_GREEN || sizes[code] == 0)
+        {
+            continue;
+        }
+
+        // Big parts go to the pool; the rest are searched here while they run
+        if (sizes[code] >= DECISION_TREE_PARALLEL_MIN)
+        {
+            SubtreeJob* job = &jobs[jobCount++];
+
+            job->solver = solver;
+            job->set = part;
+            job->count = sizes[code];
+            job->left = left - 1;
+            WorkPool_spawn(solver->pool, &group, Solver_subtreeJob, job);
+        }
+        else if (cost != INFEASIBLE)
+        {
+            uint16_t subtreeGuess;
+
+            cost = Solver_add(cost, Solver_solve(solver, part, sizes[code], left - 1, &subtreeGuess));
+            if (cost != INFEASIBLE && cost > __atomic_load_n(best, __ATOMIC_RELAXED))
+            {
+                cost = INFEASIBLE;
+            }
+        }
+    }
+
+    WorkPool_wait(solver->pool, &group);
+    for (i = 0; i < jobCount; i++)
+    {
+        cost = Solver_add(cost, jobs[i].cost);
+    }
+    free(jobs);
+    free(parts);
+
+    seen = __atomic_load_n(best, __ATOMIC_RELAXED);
+    while (cost < seen && !__atomic_compare_exchange_n(best, &seen, cost, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+    return cost;
+}
+
+static void Solver_guessJob(void* argument)
+{
+    GuessJob* job = argument;
+
+    job->cost = Solver_try(job->solver, job->set, job->count, job->left, job->guess, job->best);
+}
+
+/**
+ * Tries the guesses top[first] to top[end - 1] at a set and returns the cost
+ * of the best. Of guesses which tie, the one ranked first wins, so every
+ * number of threads finds the same tree.
+ */
+static Cost Solver_search(Solver* solver, const uint16_t* set, uint32_t count, uint32_t left, const uint16_t* top,
+                          uint32_t first, uint32_t end, uint16_t* bestGuess)
+{
+    Cost bestCost = INFEASIBLE, shared = INFEASIBLE;
+    uint32_t i;
+
+    if (count >= DECISION_TREE_PARALLEL_MIN)
+    {
+        GuessJob jobs[DECISION_TREE_MAX_TOP];
+        WorkGroup group = { 0 };
+
+        for (i = first; i < end; i++)
+        {
+            jobs[i].solver = solver;
+            jobs[i].set = set;
+            jobs[i].count = count;
+            jobs[i].left = left;
+            jobs[i].guess = top[i];
+            jobs[i].best = &shared;
+            WorkPool_spawn(solver->pool, &group, Solver_guessJob, &jobs[i]);
+        }
+        WorkPool_wait(solver->pool, &group);
+
+        for (i = first; i < end; i++)
+        {
+            if (jobs[i].cost < bestCost)
+            {
+                bestCost = jobs[i].cost;
+                *bestGuess = top[i];
+            }
+        }
+    }
+    else
+    {
+        for (i = first; i < end; i++)
+        {
+            Cost cost = Solver_try(solver, set, count, left, top[i], &shared);
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                *bestGuess = top[i];
+            }
+        }
+    }
+    return bestCost;
+}
+
+/**
+ * Returns the fewest guesses summed over a set of answers, in ascending
+ * order, with the given number of guesses left, and the guess which gets them.
+ */
+static Cost Solver_solve(Solver* solver, const uint16_t* set, uint32_t count, uint32_t left, uint16_t* bestGuess)
+{
+    uint16_t top[DECISION_TREE_MAX_TOP];
+    Cost bestCost;
+    uint32_t kept;
+    uint64_t key;
+
+    *bestGuess = 0;
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (left == 0)
+    {
+        return INFEASIBLE;
+    }
+    if (count == 1)
+    {
+        *bestGuess = solver->answerGuesses[set[0]];
+        return 1;
+    }
+    if (left == 1)
+    {
+        return INFEASIBLE;
+    }
+    if (count == 2)
+    {
+        *bestGuess = solver->answerGuesses[set[0]];
+        return 3;
+    }
+
+    key = Solver_key(set, count, left);
+    if (Solver_recall(solver, key, &bestCost, bestGuess))
+    {
+        __atomic_add_fetch(&solver->memoHits, 1, __ATOMIC_RELAXED);
+        return bestCost;
+    }
+    __atomic_add_fetch(&solver->nodes, 1, __ATOMIC_RELAXED);
+
+    if (left == 2)
+    {
+        bestCost = Solver_split(solver, set, count, bestGuess);
+    }
+    else
+    {
+        kept = Solver_rank(solver, set, count, top, solver->topGuesses);
+        bestCost = Solver_search(solver, set, count, left, top, 0, kept, bestGuess);
+
+        // When none of them fits in the guesses left, the ones ranked after them might
+        if (bestCost == INFEASIBLE && kept == solver->topGuesses && kept < DECISION_TREE_MAX_TOP)
+        {
+            kept = Solver_rank(solver, set, count, top, DECISION_TREE_MAX_TOP);
+            bestCost = Solver_search(solver, set, count, left, top, solver->topGuesses, kept, bestGuess);
+        }
+    }
+
+    Solver_remember(solver, key, bestCost, *bestGuess);
+    return bestCost;
+}
+
+/** Writes the guess of every node down to the answers of a set, from the memo where it can. */
+static void DecisionTree_walk(Solver* solver, DecisionTree* tree, const uint16_t* set, uint32_t count,
+                              uint32_t left, uint32_t depth)
+{
+    const FeedbackCode* row;
+    uint32_t sizes[SCORE_NUM_CODES] = { 0 };
+    uint32_t starts[SCORE_NUM_CODES];
+    uint32_t start = 0, code, i;
+    uint16_t* parts;
+    uint16_t guess;
+
+    Solver_solve(solver, set, count, left, &guess);
+    row = FeedbackMatrix_row(solver->matrix, guess);
+
+    parts = malloc(count * sizeof(uint16_t));
+    if (parts == NULL)
+    {
+        solver->outOfMemory = 1;
+        return;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        tree->paths[(size_t) set[i] * tree->maxGuesses + depth] = guess;
+        sizes[row[set[i]]]++;
+    }
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        starts[code] = start;
+        start += sizes[code];
+    }
+    for (i = 0; i < count; i++)
+    {
+        parts[starts[row[set[i]]]++] = set[i];
+    }
+
+    start = 0;
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        if (code == SCORE_ALL_GREEN && sizes[code] != 0)
+        {
+            tree->depths[parts[start]] = (uint8_t) (depth + 1);
+        }
+        else if (sizes[code] != 0)
+        {
+            DecisionTree_walk(solver, tree, &parts[start], sizes[code], left - 1, depth + 1);
+        }
+        start += sizes[code];
+    }
+    free(parts);
+}
+
+DecisionTreeOptions DecisionTree_defaults(void)
+{
+    DecisionTreeOptions options;
+
+    options.maxGuesses = 6;        // MAX_GUESSES in Application.h
+    options.topGuesses = 4;
+    options.threads = 0;
+    options.memoBits = 18;
+    return options;
+}
+
+DecisionTreeStatus DecisionTree_solve(DecisionTree* tree, const FeedbackMatrix* matrix,
+                                      const DecisionTreeOptions* options, DecisionTreeStats* stats)
+{
+    DecisionTreeStatus status = DECISION_TREE_OK;
+    Solver* solver;
+    WorkPoolStats workStats;
+    uint16_t* all;
+    uint16_t guess;
+    uint32_t i;
+    double start;
+    Cost cost;
+
+    memset(tree, 0, sizeof(DecisionTree));
+    memset(stats, 0, sizeof(DecisionTreeStats));
+    tree->matrix = matrix;
+    tree->maxGuesses = options->maxGuesses;
+
+    if (matrix->guessCount > UINT16_MAX + 1u || matrix->answerCount > UINT16_MAX + 1u)
+    {
+        return DECISION_TREE_TOO_LARGE;
+    }
+
+    solver = calloc(1, sizeof(Solver));
+    all = malloc(matrix->answerCount * sizeof(uint16_t) + 1);
+    tree->paths = calloc((size_t) matrix->answerCount * options->maxGuesses + 1, sizeof(uint16_t));
+    tree->depths = calloc(matrix->answerCount + 1, sizeof(uint8_t));
+    if (solver == NULL || all == NULL || tree->paths == NULL || tree->depths == NULL)
+    {
+        free(solver);
+        free(all);
+        DecisionTree_free(tree);
+        return DECISION_TREE_NO_MEMORY;
+    }
+
+    solver->matrix = matrix;
+    solver->topGuesses = options->topGuesses;
+    if (solver->topGuesses < 1 || solver->topGuesses > DECISION_TREE_MAX_TOP)
+    {
+        solver->topGuesses = (solver->topGuesses < 1) ? 1 : DECISION_TREE_MAX_TOP;
+    }
+    solver->answerGuesses = malloc(matrix->answerCount * sizeof(uint16_t) + 1);
+    solver->weights = malloc((matrix->answerCount + 1) * sizeof(double));
+    solver->memo = calloc((size_t) MEMO_WAYS << options->memoBits, sizeof(MemoEntry));
+    solver->memoMask = ((uint64_t) 1 << options->memoBits) - 1;
+    stats->memoBytes = ((size_t) MEMO_WAYS << options->memoBits) * sizeof(MemoEntry);
+    for (i = 0; i < MEMO_LOCKS; i++)
+    {
+        pthread_mutex_init(&solver->locks[i], NULL);
+    }
+
+    if (solver->answerGuesses == NULL || solver->weights == NULL || solver->memo == NULL)
+    {
+        status = DECISION_TREE_NO_MEMORY;
+    }
+
+    for (i = 0; i < matrix->answerCount && status == DECISION_TREE_OK; i++)
+    {
+        int32_t index = FeedbackMatrix_findGuess(matrix, matrix->answers[i]);
+
+        if (index < 0)
+        {
+            status = DECISION_TREE_NOT_GUESSABLE;
+        }
+        solver->answerGuesses[i] = (uint16_t) index;
+        all[i] = (uint16_t) i;
+    }
+
+    if (status == DECISION_TREE_OK)
+    {
+        for (i = 0; i <= matrix->answerCount; i++)
+        {
+            solver->weights[i] = (i > 1) ? i * log2(i) : 0;
+        }
+
+        start = DecisionTree_nowNs();
+        solver->pool = WorkPool_create(options->threads);
+        if (solver->pool == NULL)
+        {
+            status = DECISION_TREE_NO_MEMORY;
+        }
+    }
+
+    if (status == DECISION_TREE_OK)
+    {
+        cost = Solver_solve(solver, all, matrix->answerCount, options->maxGuesses, &guess);
+        stats->seconds = (DecisionTree_nowNs() - start) / 1e9;
+
+        workStats = WorkPool_stats(solver->pool);
+        stats->threads = WorkPool_threads(solver->pool);
+        stats->nodes = solver->nodes;
+        stats->memoHits = solver->memoHits;
+        stats->tasks = workStats.tasks;
+        stats->steals = workStats.steals;
+
+        if (cost != INFEASIBLE && matrix->answerCount > 0)
+        {
+            DecisionTree_walk(solver, tree, all, matrix->answerCount, options->maxGuesses, 0);
+        }
+        WorkPool_destroy(solver->pool);
+
+        if (solver->outOfMemory)
+        {
+            status = DECISION_TREE_NO_MEMORY;
+        }
+        else if (cost == INFEASIBLE)
+        {
+            status = DECISION_TREE_INFEASIBLE;
+        }
+    }
+
+    for (i = 0; i < matrix->answerCount; i++)
+    {
+        tree->totalGuesses += tree->depths[i];
+    }
+
+    for (i = 0; i < MEMO_LOCKS; i++)
+    {
+        pthread_mutex_destroy(&solver->locks[i]);
+    }
+    free(solver->memo);
+    free(solver->weights);
+    free(solver->answerGuesses);
+    free(solver);
+    free(all);
+
+    if (status != DECISION_TREE_OK)
+    {
+        DecisionTree_free(tree);
+    }
+    return status;
+}
+
+void DecisionTree_free(DecisionTree* tree)
+{
+    free(tree->paths);
+    free(tree->depths);
+    tree->paths = NULL;
+    tree->depths = NULL;
+}
+
+const char* DecisionTree_statusName(DecisionTreeStatus status)
+{
+    switch (status)
+    {
+    case DECISION_TREE_OK:
+        return "ok";
+    case DECISION_TREE_NO_MEMORY:
+        return "out of memory";
+    case DECISION_TREE_TOO_LARGE:
+        return "more than 65536 guesses or answers";
+    case DECISION_TREE_NOT_GUESSABLE:
+        return "an answer is not among the guesses";
+    case DECISION_TREE_INFEASIBLE:
+        return "no tree within the guess limit among the guesses tried";
+    default:
+        return "unknown decision tree status";
+    }
+}
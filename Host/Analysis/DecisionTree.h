@@ -0,0 +1,105 @@
+/*
+ * DecisionTree.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A decision tree which plays every answer of a feedback matrix in the fewest
+ * guesses on average, within a guess limit. At each node it guesses a word
+ * and moves to the child for the feedback; the answers left at a node are the
+ * ones which gave the same feedback to every guess on the way down.
+ *
+ * Trying every guess at every node is out of reach for thousands of words, so
+ * at a node only the topGuesses guesses which split its answers with the most
+ * entropy are tried, each with an exhaustive search below it. With a top of 1
+ * this is the greedy entropy tree; every guess added can only lower the
+ * average. A branch is cut as soon as a lower bound on its cost is worse than
+ * the best guess found so far.
+ *
+ * Subtrees are searched in parallel on a WorkPool, and the best guess for a
+ * set of answers and a number of guesses left is memoised by a hash of the set,
+ * since different paths often leave the same answers. Sets of fewer than
+ * DECISION_TREE_PARALLEL_MIN answers are searched inline by the worker which
+ * reaches them.
+ */
+
+#ifndef ANALYSIS_DECISIONTREE_H_
+#define ANALYSIS_DECISIONTREE_H_
+
+#include <Analysis/FeedbackMatrix.h>
+
+// Most guesses tried at a node
+#define DECISION_TREE_MAX_TOP           64
+
+// Sets with at least this many answers have their guesses and subtrees searched as separate tasks
+#ifndef DECISION_TREE_PARALLEL_MIN
+#define DECISION_TREE_PARALLEL_MIN      64
+#endif
+
+// What went wrong with a search
+enum _DecisionTreeStatus
+{
+    DECISION_TREE_OK,
+    DECISION_TREE_NO_MEMORY,
+    DECISION_TREE_TOO_LARGE,            // More guesses or answers than a 16-bit index holds
+    DECISION_TREE_NOT_GUESSABLE,        // An answer is not among the guesses
+    DECISION_TREE_INFEASIBLE            // No tree within the guess limit was found among the guesses tried
+};
+typedef enum _DecisionTreeStatus DecisionTreeStatus;
+
+struct _DecisionTreeOptions
+{
+    uint32_t maxGuesses;        // MAX_GUESSES in Application.h
+    uint32_t topGuesses;        // Guesses tried at each node, 1 to DECISION_TREE_MAX_TOP
+    uint32_t threads;           // Workers, 0 for one per CPU
+    uint32_t memoBits;          // The memo holds 4 << memoBits sets
+};
+typedef struct _DecisionTreeOptions DecisionTreeOptions;
+
+// What a search did
+struct _DecisionTreeStats
+{
+    uint32_t threads;
+    uint64_t nodes;             // Sets of answers whose guesses were ranked and tried
+    uint64_t memoHits;          // Sets found in the memo instead
+    uint64_t tasks;             // WorkPool tasks run
+    uint64_t steals;            // Of which were stolen
+    size_t memoBytes;
+    double seconds;
+};
+typedef struct _DecisionTreeStats DecisionTreeStats;
+
+// The solved tree, as the guesses it makes for each answer of the matrix
+struct _DecisionTree
+{
+    const FeedbackMatrix* matrix;
+    uint32_t maxGuesses;
+    uint64_t totalGuesses;      // Over every answer; the average is this over matrix->answerCount
+    uint16_t* paths;            // answerCount rows of maxGuesses guess indices
+    uint8_t* depths;            // Guesses taken by each answer, the last of which is the answer
+};
+typedef struct _DecisionTree DecisionTree;
+
+// Returns the options the tools use unless told otherwise
+DecisionTreeOptions DecisionTree_defaults(void);
+
+// Searches for the tree. On success the tree must be freed with DecisionTree_free().
+DecisionTreeStatus DecisionTree_solve(DecisionTree* tree, const FeedbackMatrix* matrix,
+                                      const DecisionTreeOptions* options, DecisionTreeStats* stats);
+
+void DecisionTree_free(DecisionTree* tree);
+
+// Returns a short description of a status
+const char* DecisionTree_statusName(DecisionTreeStatus status);
+
+// Returns the guess indices the tree plays against an answer, DecisionTree_depth() of them
+static inline const uint16_t* DecisionTree_path(const DecisionTree* tree, uint32_t answer)
+{
+    return &tree->paths[(size_t) answer * tree->maxGuesses];
+}
+
+static inline uint32_t DecisionTree_depth(const DecisionTree* tree, uint32_t answer)
+{
+    return tree->depths[answer];
+}
+
+#endif /* ANALYSIS_DECISIONTREE_H_ */
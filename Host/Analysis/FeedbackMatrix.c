@@ -0,0 +1,358 @@
+/*
+ * FeedbackMatrix.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Analysis/BatchScore.h>
+#include <Analysis/FeedbackMatrix.h>
+
+#define FNV_OFFSET_BASIS    0xCBF29CE484222325ull
+#define FNV_PRIME           0x100000001B3ull
+
+// The rows one thread scores
+struct _Worker
+{
+    pthread_t thread;
+    const PackedWord* guesses;
+    const PackedWord* answers;
+    uint32_t answerCount;
+    uint32_t firstRow;
+    uint32_t endRow;
+    FeedbackCode* cells;
+};
+typedef struct _Worker Worker;
+
+static uint64_t FeedbackMatrix_checksum(const uint8_t* data, size_t bytes)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    size_t i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static bool FeedbackMatrix_sorted(const PackedWord* words, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 1; i < count; i++)
+    {
+        if (words[i - 1] >= words[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void* FeedbackMatrix_work(void* argument)
+{
+    Worker* worker = argument;
+    uint32_t row;
+
+    for (row = worker->firstRow; row < worker->endRow; row++)
+    {
+        BatchScore_codes(worker->guesses[row], worker->answers, worker->answerCount,
+                         &worker->cells[(size_t) row * worker->answerCount]);
+    }
+    return NULL;
+}
+
+/** Splits the rows into one contiguous share per thread and waits for them all. */
+static FeedbackMatrixStatus FeedbackMatrix_score(const PackedWord* guesses, uint32_t guessCount,
+                                                 const PackedWord* answers, uint32_t answerCount,
+                                                 uint32_t threads, FeedbackCode* cells)
+{
+    Worker* workers;
+    uint32_t started, i;
+    int error = 0;
+
+    if (threads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (uint32_t) cpus : 1;
+    }
+    if (threads > guessCount)
+    {
+        threads = guessCount ? guessCount : 1;
+    }
+
+    workers = calloc(threads, sizeof(Worker));
+    if (workers == NULL)
+    {
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+
+    // Pick the scoring kernel before the threads could race to
+    BatchScore_isa();
+
+    for (started = 0; started < threads && error == 0; started++)
+    {
+        Worker* worker = &workers[started];
+
+        worker->guesses = guesses;
+        worker->answers = answers;
+        worker->answerCount = answerCount;
+        worker->firstRow = (uint32_t) ((uint64_t) guessCount * started / threads);
+        worker->endRow = (uint32_t) ((uint64_t) guessCount * (started + 1) / threads);
+        worker->cells = cells;
+        error = pthread_create(&worker->thread, NULL, FeedbackMatrix_work, worker);
+    }
+    if (error != 0)
+    {
+        started--;
+    }
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+    free(workers);
+
+    errno = error;
+    return (error == 0) ? FEEDBACK_MATRIX_OK : FEEDBACK_MATRIX_IO_ERROR;
+}
+
+FeedbackMatrixStatus FeedbackMatrix_create(const char* path, const PackedWord* guesses, uint32_t guessCount,
+                                           const PackedWord* answers, uint32_t answerCount, uint32_t threads)
+{
+    FeedbackMatrixHeader header;
+    FeedbackMatrixStatus status;
+    size_t pathLength = strlen(path);
+    char* temporary;
+    uint8_t* base;
+    int fd;
+
+    if (!FeedbackMatrix_sorted(guesses, guessCount) || !FeedbackMatrix_sorted(answers, answerCount))
+    {
+        return FEEDBACK_MATRIX_BAD_LAYOUT;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FEEDBACK_MATRIX_MAGIC, sizeof(header.magic));
+    header.version = FEEDBACK_MATRIX_VERSION;
+    header.headerBytes = sizeof(header);
+    header.wordLength = SCORE_WORD_LENGTH;
+    header.guessCount = guessCount;
+    header.answerCount = answerCount;
+    header.guessesOffset = sizeof(header);
+    header.answersOffset = header.guessesOffset + (uint64_t) guessCount * sizeof(PackedWord);
+    header.cellsOffset = header.answersOffset + (uint64_t) answerCount * sizeof(PackedWord);
+    header.cellsOffset = (header.cellsOffset + FEEDBACK_MATRIX_ALIGNMENT - 1) / FEEDBACK_MATRIX_ALIGNMENT
+                         * FEEDBACK_MATRIX_ALIGNMENT;
+    header.fileBytes = header.cellsOffset + (uint64_t) guessCount * answerCount;
+
+    temporary = malloc(pathLength + sizeof(".tmp"));
+    if (temporary == NULL)
+    {
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+    memcpy(temporary, path, pathLength);
+    memcpy(&temporary[pathLength], ".tmp", sizeof(".tmp"));
+
+    fd = open(temporary, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, (off_t) header.fileBytes) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        free(temporary);
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+    base = mmap(NULL, header.fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        unlink(temporary);
+        free(temporary);
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+
+    memcpy(&base[header.guessesOffset], guesses, (size_t) guessCount * sizeof(PackedWord));
+    memcpy(&base[header.answersOffset], answers, (size_t) answerCount * sizeof(PackedWord));
+    status = FeedbackMatrix_score(guesses, guessCount, answers, answerCount, threads, &base[header.cellsOffset]);
+
+    // The header goes in last, so a file whose writer died is never taken for a whole one
+    if (status == FEEDBACK_MATRIX_OK)
+    {
+        header.checksum = FeedbackMatrix_checksum(&base[header.headerBytes], header.fileBytes - header.headerBytes);
+        memcpy(base, &header, sizeof(header));
+    }
+
+    if (munmap(base, header.fileBytes) != 0 && status == FEEDBACK_MATRIX_OK)
+    {
+        status = FEEDBACK_MATRIX_IO_ERROR;
+    }
+    if (status == FEEDBACK_MATRIX_OK && rename(temporary, path) != 0)
+    {
+        status = FEEDBACK_MATRIX_IO_ERROR;
+    }
+    if (status != FEEDBACK_MATRIX_OK)
+    {
+        int error = errno;
+
+        unlink(temporary);
+        errno = error;
+    }
+
+    free(temporary);
+    return status;
+}
+
+/** Checks that a header describes a file of the given size which this build can read. */
+static FeedbackMatrixStatus FeedbackMatrix_check(const FeedbackMatrixHeader* header, size_t bytes)
+{
+    if (memcmp(header->magic, FEEDBACK_MATRIX_MAGIC, sizeof(header->magic)) != 0)
+    {
+        return FEEDBACK_MATRIX_BAD_MAGIC;
+    }
+    if (header->version != FEEDBACK_MATRIX_VERSION)
+    {
+        return FEEDBACK_MATRIX_BAD_VERSION;
+    }
+    if (header->headerBytes != sizeof(FeedbackMatrixHeader) || header->wordLength != SCORE_WORD_LENGTH
+        || header->fileBytes != bytes
+        || header->guessesOffset < header->headerBytes
+        || header->answersOffset < header->guessesOffset + (uint64_t) header->guessCount * sizeof(PackedWord)
+        || header->cellsOffset < header->answersOffset + (uint64_t) header->answerCount * sizeof(PackedWord)
+        || header->guessesOffset % sizeof(PackedWord) != 0 || header->answersOffset % sizeof(PackedWord) != 0
+        || header->fileBytes != header->cellsOffset + (uint64_t) header->guessCount * header->answerCount)
+    {
+        return FEEDBACK_MATRIX_BAD_LAYOUT;
+    }
+    return FEEDBACK_MATRIX_OK;
+}
+
+FeedbackMatrixStatus FeedbackMatrix_open(FeedbackMatrix* matrix, const char* path)
+{
+    FeedbackMatrixStatus status;
+    struct stat info;
+    void* base;
+    int fd;
+
+    memset(matrix, 0, sizeof(*matrix));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+    if ((size_t) info.st_size < sizeof(FeedbackMatrixHeader))
+    {
+        close(fd);
+        return FEEDBACK_MATRIX_BAD_LAYOUT;
+    }
+
+    base = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        return FEEDBACK_MATRIX_IO_ERROR;
+    }
+
+    matrix->base = base;
+    matrix->bytes = (size_t) info.st_size;
+    matrix->header = base;
+
+    status = FeedbackMatrix_check(matrix->header, matrix->bytes);
+    if (status != FEEDBACK_MATRIX_OK)
+    {
+        FeedbackMatrix_close(matrix);
+        return status;
+    }
+
+    matrix->guesses = (const PackedWord*) &matrix->base[matrix->header->guessesOffset];
+    matrix->answers = (const PackedWord*) &matrix->base[matrix->header->answersOffset];
+    matrix->cells = &matrix->base[matrix->header->cellsOffset];
+    matrix->guessCount = matrix->header->guessCount;
+    matrix->answerCount = matrix->header->answerCount;
+
+    return FEEDBACK_MATRIX_OK;
+}
+
+FeedbackMatrixStatus FeedbackMatrix_verify(const FeedbackMatrix* matrix)
+{
+    const FeedbackMatrixHeader* header = matrix->header;
+
+    if (FeedbackMatrix_checksum(&matrix->base[header->headerBytes], header->fileBytes - header->headerBytes)
+        != header->checksum)
+    {
+        return FEEDBACK_MATRIX_BAD_CHECKSUM;
+    }
+    return FEEDBACK_MATRIX_OK;
+}
+
+void FeedbackMatrix_close(FeedbackMatrix* matrix)
+{
+    if (matrix->base != NULL)
+    {
+        munmap((void*) matrix->base, matrix->bytes);
+    }
+    memset(matrix, 0, sizeof(*matrix));
+}
+
+const char* FeedbackMatrix_statusName(FeedbackMatrixStatus status)
+{
+    switch (status)
+    {
+    case FEEDBACK_MATRIX_OK:
+        return "ok";
+    case FEEDBACK_MATRIX_IO_ERROR:
+        return strerror(errno);
+    case FEEDBACK_MATRIX_BAD_MAGIC:
+        return "not a feedback matrix";
+    case FEEDBACK_MATRIX_BAD_VERSION:
+        return "unsupported feedback matrix version";
+    case FEEDBACK_MATRIX_BAD_LAYOUT:
+        return "feedback matrix layout does not match";
+    case FEEDBACK_MATRIX_BAD_CHECKSUM:
+        return "feedback matrix checksum mismatch";
+    default:
+        return "unknown feedback matrix status";
+    }
+}
+
+static int FeedbackMatrix_compare(const void* a, const void* b)
+{
+    PackedWord x = *(const PackedWord*) a, y = *(const PackedWord*) b;
+
+    return (x > y) - (x < y);
+}
+
+int32_t FeedbackMatrix_findGuess(const FeedbackMatrix* matrix, PackedWord guess)
+{
+    const PackedWord* found = bsearch(&guess, matrix->guesses, matrix->guessCount, sizeof(PackedWord),
+                                      FeedbackMatrix_compare);
+
+    return (found != NULL) ? (int32_t) (found - matrix->guesses) : -1;
+}
+
+int32_t FeedbackMatrix_findAnswer(const FeedbackMatrix* matrix, PackedWord answer)
+{
+    const PackedWord* found = bsearch(&answer, matrix->answers, matrix->answerCount, sizeof(PackedWord),
+                                      FeedbackMatrix_compare);
+
+    return (found != NULL) ? (int32_t) (found - matrix->answers) : -1;
+}
@@ -0,0 +1,118 @@
+/*
+ * FeedbackMatrix.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A file with the feedback code of every guess against every answer, one
+ * byte per cell, which host tools map read-only and look codes up in instead
+ * of scoring. Processes which map the same file share its pages, and opening
+ * it only checks the header, so there is nothing to parse.
+ *
+ * The file is in the byte order of the host which wrote it; on one with the
+ * other order, the version does not match. It holds:
+ *   FeedbackMatrixHeader
+ *   the guesses, guessCount packed words
+ *   the answers, answerCount packed words
+ *   padding up to the next FEEDBACK_MATRIX_ALIGNMENT bytes
+ *   the cells, guessCount rows of answerCount codes
+ * The checksum covers everything after the header, so a file which was cut
+ * short or written by a different scorer is caught by FeedbackMatrix_verify().
+ */
+
+#ifndef ANALYSIS_FEEDBACKMATRIX_H_
+#define ANALYSIS_FEEDBACKMATRIX_H_
+
+#include <stddef.h>
+
+#include <Wordle/Score.h>
+
+#define FEEDBACK_MATRIX_MAGIC       "WRDLFBMX"
+#define FEEDBACK_MATRIX_VERSION     1
+
+// A cell is one byte
+#if SCORE_NUM_CODES > 256
+#error "the feedback matrix only holds the codes of words of up to 5 letters"
+#endif
+
+// The cells start on a page boundary
+#define FEEDBACK_MATRIX_ALIGNMENT   4096
+
+struct _FeedbackMatrixHeader
+{
+    char magic[8];              // FEEDBACK_MATRIX_MAGIC, without its terminator
+    uint32_t version;           // FEEDBACK_MATRIX_VERSION
+    uint32_t headerBytes;       // sizeof(FeedbackMatrixHeader)
+    uint32_t wordLength;        // SCORE_WORD_LENGTH
+    uint32_t guessCount;
+    uint32_t answerCount;
+    uint32_t reserved;
+    uint64_t guessesOffset;
+    uint64_t answersOffset;
+    uint64_t cellsOffset;
+    uint64_t fileBytes;
+    uint64_t checksum;          // 64-bit FNV-1a of bytes headerBytes to fileBytes
+};
+typedef struct _FeedbackMatrixHeader FeedbackMatrixHeader;
+
+// What went wrong with a matrix file
+enum _FeedbackMatrixStatus
+{
+    FEEDBACK_MATRIX_OK,
+    FEEDBACK_MATRIX_IO_ERROR,           // See errno
+    FEEDBACK_MATRIX_BAD_MAGIC,
+    FEEDBACK_MATRIX_BAD_VERSION,
+    FEEDBACK_MATRIX_BAD_LAYOUT,         // The header does not match the file or this build
+    FEEDBACK_MATRIX_BAD_CHECKSUM
+};
+typedef enum _FeedbackMatrixStatus FeedbackMatrixStatus;
+
+// An open matrix file. The pointers are into the read-only mapping.
+struct _FeedbackMatrix
+{
+    const uint8_t* base;
+    size_t bytes;
+    const FeedbackMatrixHeader* header;
+    const PackedWord* guesses;
+    const PackedWord* answers;
+    const FeedbackCode* cells;
+    uint32_t guessCount;
+    uint32_t answerCount;
+};
+typedef struct _FeedbackMatrix FeedbackMatrix;
+
+// Scores every guess against every answer on the given number of threads (0 for one per CPU) and writes the
+// file. Both lists must be sorted. The file is written under a temporary name and renamed, so a process which
+// has the old one open keeps seeing it whole.
+FeedbackMatrixStatus FeedbackMatrix_create(const char* path, const PackedWord* guesses, uint32_t guessCount,
+                                           const PackedWord* answers, uint32_t answerCount, uint32_t threads);
+
+// Maps a matrix file and checks its header
+FeedbackMatrixStatus FeedbackMatrix_open(FeedbackMatrix* matrix, const char* path);
+
+// Checks the checksum of an open matrix, which reads the whole file
+FeedbackMatrixStatus FeedbackMatrix_verify(const FeedbackMatrix* matrix);
+
+void FeedbackMatrix_close(FeedbackMatrix* matrix);
+
+// Returns a short description of a status
+const char* FeedbackMatrix_statusName(FeedbackMatrixStatus status);
+
+// Returns the index of a guess, or -1 if it is not in the matrix
+int32_t FeedbackMatrix_findGuess(const FeedbackMatrix* matrix, PackedWord guess);
+
+// Returns the index of an answer, or -1 if it is not in the matrix
+int32_t FeedbackMatrix_findAnswer(const FeedbackMatrix* matrix, PackedWord answer);
+
+// Returns the codes of one guess against every answer
+static inline const FeedbackCode* FeedbackMatrix_row(const FeedbackMatrix* matrix, uint32_t guess)
+{
+    return &matrix->cells[(size_t) guess * matrix->answerCount];
+}
+
+// Returns the code of a guess against an answer, by their indices
+static inline FeedbackCode FeedbackMatrix_code(const FeedbackMatrix* matrix, uint32_t guess, uint32_t answer)
+{
+    return matrix->cells[(size_t) guess * matrix->answerCount + answer];
+}
+
+#endif /* ANALYSIS_FEEDBACKMATRIX_H_ */
@@ -0,0 +1,304 @@
+/*
+ * WorkPool.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <Analysis/WorkPool.h>
+
+// Rounds without a task before an idle worker sleeps between looks instead of yielding
+#define WORK_POOL_IDLE_SPINS    64
+#define WORK_POOL_IDLE_NS       50000
+
+struct _Task
+{
+    WorkFunction function;
+    void* argument;
+    WorkGroup* group;
+    uint32_t spawner;
+};
+typedef struct _Task Task;
+
+// One worker's thread, deque and counters. Only the lock and the deque are touched by other workers.
+struct _Worker
+{
+    pthread_mutex_t lock;
+    uint32_t top;               // The oldest task, which thieves take
+    uint32_t bottom;            // One past the newest task, which the owner takes
+    Task tasks[WORK_POOL_DEQUE_CAPACITY];
+
+    WorkPool* pool;
+    uint32_t index;
+    uint32_t random;
+    pthread_t thread;
+    uint64_t executed;
+    uint64_t stolen;
+};
+typedef struct _Worker Worker;
+
+struct _WorkPool
+{
+    Worker* workers;
+    uint32_t threads;
+    int stopping;
+};
+
+// The worker the calling thread is, in the pool it belongs to
+static __thread WorkPool* currentPool;
+static __thread uint32_t currentWorker;
+
+static Worker* WorkPool_self(WorkPool* pool)
+{
+    return &pool->workers[(currentPool == pool) ? currentWorker : 0];
+}
+
+static bool WorkPool_push(Worker* worker, const Task* task)
+{
+    bool pushed = false;
+
+    pthread_mutex_lock(&worker->lock);
+    if (worker->bottom - worker->top < WORK_POOL_DEQUE_CAPACITY)
+    {
+        worker->tasks[worker->bottom % WORK_POOL_DEQUE_CAPACITY] = *task;
+        worker->bottom++;
+        pushed = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+    return pushed;
+}
+
+static bool WorkPool_pop(Worker* worker, Task* task)
+{
+    bool popped = false;
+
+    pthread_mutex_lock(&worker->lock);
+    if (worker->bottom != worker->top)
+    {
+        worker->bottom--;
+        *task = worker->tasks[worker->bottom % WORK_POOL_DEQUE_CAPACITY];
+        popped = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+    return popped;
+}
+
+static bool WorkPool_steal(Worker* victim, Task* task)
+{
+    bool stolen = false;
+
+    pthread_mutex_lock(&victim->lock);
+    if (victim->bottom != victim->top)
+    {
+        *task = victim->tasks[victim->top % WORK_POOL_DEQUE_CAPACITY];
+        victim->top++;
+        stolen = true;
+    }
+    pthread_mutex_unlock(&victim->lock);
+    return stolen;
+}
+
+/** Takes the newest task of the worker's own deque, or else the oldest of another's, starting at a random one. */
+static bool WorkPool_find(Worker* self, Task* task)
+{
+    uint32_t threads = __atomic_load_n(&self->pool->threads, __ATOMIC_ACQUIRE);
+    uint32_t first, i;
+
+    if (WorkPool_pop(self, task))
+    {
+        return true;
+    }
+
+    self->random ^= self->random << 13;
+    self->random ^= self->random >> 17;
+    self->random ^= self->random << 5;
+    first = self->random % threads;
+
+    for (i = 0; i < threads; i++)
+    {
+        Worker* victim = &self->pool->workers[(first + i) % threads];
+
+        if (victim != self && WorkPool_steal(victim, task))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void WorkPool_run(Worker* self, const Task* task)
+{
+    task->function(task->argument);
+
+    self->executed++;
+    self->stolen += (task->spawner != self->index);
+
+    // Whatever the task wrote is visible to the thread which sees its group finish
+    __atomic_sub_fetch(&task->group->pending, 1, __ATOMIC_ACQ_REL);
+}
+
+static void* WorkPool_work(void* argument)
+{
+    Worker* self = argument;
+    WorkPool* pool = self->pool;
+    uint32_t idle = 0;
+    Task task;
+
+    currentPool = pool;
+    currentWorker = self->index;
+
+    while (!__atomic_load_n(&pool->stopping, __ATOMIC_ACQUIRE))
+    {
+        if (WorkPool_find(self, &task))
+        {
+            WorkPool_run(self, &task);
+            idle = 0;
+        }
+        else if (++idle < WORK_POOL_IDLE_SPINS)
+        {
+            sched_yield();
+        }
+        else
+        {
+            struct timespec pause = { 0, WORK_POOL_IDLE_NS };
+            nanosleep(&pause, NULL);
+        }
+    }
+    return NULL;
+}
+
+WorkPool* WorkPool_create(uint32_t threads)
+{
+    WorkPool* pool;
+    pthread_attr_t attributes;
+    uint32_t i;
+
+    if (threads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (uint32_t) cpus : 1;
+    }
+
+    pool = calloc(1, sizeof(WorkPool));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    pool->workers = calloc(threads, sizeof(Worker));
+    if (pool->workers == NULL)
+    {
+        free(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < threads; i++)
+    {
+        Worker* worker = &pool->workers[i];
+
+        pthread_mutex_init(&worker->lock, NULL);
+        worker->pool = pool;
+        worker->index = i;
+        worker->random = 2463534242u + i * 2654435761u;
+    }
+
+    currentPool = pool;
+    currentWorker = 0;
+
+    // If a thread cannot be started, the pool makes do with the ones which were
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, WORK_POOL_STACK_BYTES);
+    pool->threads = 1;
+    for (i = 1; i < threads; i++)
+    {
+        if (pthread_create(&pool->workers[i].thread, &attributes, WorkPool_work, &pool->workers[i]) != 0)
+        {
+            break;
+        }
+        __atomic_store_n(&pool->threads, i + 1, __ATOMIC_RELEASE);
+    }
+    pthread_attr_destroy(&attributes);
+
+    return pool;
+}
+
+void WorkPool_destroy(WorkPool* pool)
+{
+    uint32_t i;
+
+    __atomic_store_n(&pool->stopping, 1, __ATOMIC_RELEASE);
+    for (i = 1; i < pool->threads; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    for (i = 0; i < pool->threads; i++)
+    {
+        pthread_mutex_destroy(&pool->workers[i].lock);
+    }
+
+    if (currentPool == pool)
+    {
+        currentPool = NULL;
+    }
+    free(pool->workers);
+    free(pool);
+}
+
+uint32_t WorkPool_threads(const WorkPool* pool)
+{
+    return pool->threads;
+}
+
+void WorkPool_spawn(WorkPool* pool, WorkGroup* group, WorkFunction function, void* argument)
+{
+    Worker* self = WorkPool_self(pool);
+    Task task;
+
+    task.function = function;
+    task.argument = argument;
+    task.group = group;
+    task.spawner = self->index;
+
+    __atomic_add_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+    if (!WorkPool_push(self, &task))
+    {
+        WorkPool_run(self, &task);
+    }
+}
+
+void WorkPool_wait(WorkPool* pool, WorkGroup* group)
+{
+    Worker* self = WorkPool_self(pool);
+    Task task;
+
+    while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) != 0)
+    {
+        if (WorkPool_find(self, &task))
+        {
+            WorkPool_run(self, &task);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+WorkPoolStats WorkPool_stats(const WorkPool* pool)
+{
+    WorkPoolStats stats = { 0, 0 };
+    uint32_t i;
+
+    for (i = 0; i < pool->threads; i++)
+    {
+        stats.tasks += pool->workers[i].executed;
+        stats.steals += pool->workers[i].stolen;
+    }
+    return stats;
+}
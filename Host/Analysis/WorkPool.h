@@ -0,0 +1,71 @@
+/*
+ * WorkPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A work-stealing thread pool for host analysis tools whose work splits into
+ * tasks of very different sizes, such as the subtrees of a search. Every
+ * worker has a deque of tasks: it pushes and pops its own at the bottom, last
+ * in first out, and when it runs dry it steals the oldest task from the top of
+ * another worker's deque, which is usually the biggest.
+ *
+ * The thread which creates the pool is worker 0. Tasks are spawned into a
+ * WorkGroup, and WorkPool_wait() runs tasks, its own or stolen ones, until
+ * every task of the group has finished, so a task may spawn and wait for tasks
+ * of its own without tying up its thread.
+ */
+
+#ifndef ANALYSIS_WORKPOOL_H_
+#define ANALYSIS_WORKPOOL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tasks one worker can have queued; a task spawned onto a full deque is run at once instead
+#ifndef WORK_POOL_DEQUE_CAPACITY
+#define WORK_POOL_DEQUE_CAPACITY    4096
+#endif
+
+// Stack of each worker thread. Waiting tasks run other tasks on top of themselves, so it is more than the default.
+#ifndef WORK_POOL_STACK_BYTES
+#define WORK_POOL_STACK_BYTES       (64u << 20)
+#endif
+
+typedef void (*WorkFunction)(void* argument);
+
+// Tasks which one waits for together
+struct _WorkGroup
+{
+    uint32_t pending;           // Spawned and not yet finished
+};
+typedef struct _WorkGroup WorkGroup;
+
+// What the workers have done since the pool was created
+struct _WorkPoolStats
+{
+    uint64_t tasks;             // Tasks run
+    uint64_t steals;            // Tasks run by a worker other than the one which spawned them
+};
+typedef struct _WorkPoolStats WorkPoolStats;
+
+typedef struct _WorkPool WorkPool;
+
+// Starts a pool with the given number of workers (0 for one per CPU), the calling thread being one of them.
+// Returns NULL if it is out of memory.
+WorkPool* WorkPool_create(uint32_t threads);
+
+// Stops the workers. Every group must have been waited for.
+void WorkPool_destroy(WorkPool* pool);
+
+// Returns the number of workers, counting the thread which created the pool
+uint32_t WorkPool_threads(const WorkPool* pool);
+
+// Queues function(argument) in the group on the calling worker's deque
+void WorkPool_spawn(WorkPool* pool, WorkGroup* group, WorkFunction function, void* argument);
+
+// Runs tasks until every task of the group has finished
+void WorkPool_wait(WorkPool* pool, WorkGroup* group);
+
+WorkPoolStats WorkPool_stats(const WorkPool* pool);
+
+#endif /* ANALYSIS_WORKPOOL_H_ */
@@ -0,0 +1,210 @@
+/*
+ * BatchScoreBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the batch scorer in Analysis/BatchScore.c.
+ * Every way of scoring the CPU supports is checked against Score_feedback()
+ * on every guess/answer pair of the dictionary, and on random words from a
+ * reduced alphabet so that repeated letters come up often, in batches whose
+ * lengths are not multiples of the vector width. The run fails on any
+ * difference.
+ *
+ * Then each one scores every dictionary word as a guess against the whole
+ * dictionary, into codes and into histograms, and reports the throughput in
+ * scores per second. It runs on a single thread, so that is per core.
+ *
+ *   BatchScoreBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Analysis/BatchScore.h>
+#include <Wordle/Dictionary.h>
+
+#define NUM_RANDOM_GUESSES  512
+#define NUM_RANDOM_ANSWERS  1001
+
+// Letters of the random words: 'A' to 'A' + RANDOM_LETTERS - 1
+#define RANDOM_LETTERS      6
+
+static PackedWord* words;
+static uint32_t wordCount;
+static FeedbackCode* codes;
+
+static PackedWord randomGuesses[NUM_RANDOM_GUESSES];
+static PackedWord randomAnswers[NUM_RANDOM_ANSWERS];
+
+/** A small linear congruential generator, so every run checks the same words. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static PackedWord randomWord(uint32_t* state)
+{
+    unsigned char word[SCORE_WORD_LENGTH];
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        word[i] = (unsigned char) ('A' + nextRandom(state) % RANDOM_LETTERS);
+    }
+
+    return Score_packWord(word);
+}
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void readDictionary(void)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+
+    wordCount = 0;
+    words = malloc(Dictionary_wordCount() * sizeof(PackedWord));
+    codes = malloc(Dictionary_wordCount() * sizeof(FeedbackCode));
+    if (words == NULL || codes == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        words[wordCount++] = word;
+    }
+}
+
+/** Scores guesses against answers in batches of every length up to count. Returns the number of wrong codes. */
+static uint32_t checkPairs(const PackedWord* guesses, uint32_t guessCount, const PackedWord* answers, uint32_t count)
+{
+    uint32_t histogram[SCORE_NUM_CODES];
+    uint32_t wrong = 0, g, i, total;
+
+    for (g = 0; g < guessCount; g++)
+    {
+        // Batches of count - g % 16 answers end at every offset of the vectors
+        uint32_t length = count - g % 16;
+
+        BatchScore_codes(guesses[g], answers, length, codes);
+        BatchScore_histogram(guesses[g], answers, length, histogram);
+
+        for (i = 0; i < length; i++)
+        {
+            FeedbackCode expected = Score_feedback(guesses[g], answers[i]);
+
+            if (codes[i] != expected)
+            {
+                if (wrong++ < 10)
+                {
+                    unsigned char guessText[SCORE_WORD_LENGTH], answerText[SCORE_WORD_LENGTH];
+
+                    Score_unpackWord(guesses[g], guessText);
+                    Score_unpackWord(answers[i], answerText);
+                    fprintf(stderr, "%s: %.5s against %.5s gave %u, not %u\n", BatchScore_name(BatchScore_isa()),
+                            guessText, answerText, codes[i], expected);
+                }
+            }
+            histogram[expected]--;
+        }
+        for (i = 0, total = 0; i < SCORE_NUM_CODES; i++)
+        {
+            total |= histogram[i];
+        }
+        if (total != 0 && wrong++ < 10)
+        {
+            fprintf(stderr, "%s: the histogram does not match the codes\n", BatchScore_name(BatchScore_isa()));
+        }
+    }
+
+    return wrong;
+}
+
+/** Scores every dictionary word against the whole dictionary. Returns scores per second. */
+static double timeDictionary(bool histograms)
+{
+    uint32_t histogram[SCORE_NUM_CODES];
+    uint32_t sink = 0, g;
+    double start = nowNs(), elapsed;
+
+    for (g = 0; g < wordCount; g++)
+    {
+        if (histograms)
+        {
+            BatchScore_histogram(words[g], words, wordCount, histogram);
+            sink += histogram[SCORE_ALL_GREEN];
+        }
+        else
+        {
+            BatchScore_codes(words[g], words, wordCount, codes);
+            sink += codes[g];
+        }
+    }
+    elapsed = nowNs() - start;
+
+    // Every word is the answer to itself once
+    if (sink != (histograms ? wordCount : wordCount * SCORE_ALL_GREEN))
+    {
+        fprintf(stderr, "the timed scores are wrong\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return (double) wordCount * wordCount / elapsed * 1e9;
+}
+
+int main(void)
+{
+    uint32_t seed = 4242, wrong = 0, i;
+    int isa;
+
+    Dictionary_init();
+    readDictionary();
+
+    for (i = 0; i < NUM_RANDOM_GUESSES; i++)
+    {
+        randomGuesses[i] = randomWord(&seed);
+    }
+    for (i = 0; i < NUM_RANDOM_ANSWERS; i++)
+    {
+        randomAnswers[i] = randomWord(&seed);
+    }
+
+    printf("Batch scoring, %u x %u dictionary words, one thread:\n", wordCount, wordCount);
+    for (isa = 0; isa < BATCH_SCORE_NUM_ISAS; isa++)
+    {
+        uint32_t isaWrong;
+
+        if (!BatchScore_select((BatchScoreIsa) isa))
+        {
+            printf("  %-8s not supported by this CPU\n", BatchScore_name((BatchScoreIsa) isa));
+            continue;
+        }
+
+        isaWrong = checkPairs(words, wordCount, words, wordCount)
+                   + checkPairs(randomGuesses, NUM_RANDOM_GUESSES, randomAnswers, NUM_RANDOM_ANSWERS);
+        wrong += isaWrong;
+
+        printf("  %-8s %7.1f M scores/s into codes, %7.1f M scores/s into histograms, %u wrong\n",
+               BatchScore_name((BatchScoreIsa) isa), timeDictionary(false) / 1e6, timeDictionary(true) / 1e6,
+               isaWrong);
+    }
+
+    if (wrong > 0)
+    {
+        fprintf(stderr, "the batch scorer does not match Score_feedback()\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+/*
+ * CandidatesBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the candidate set in Wordle/Candidates.c. It
+ * plays games of pseudo-random guesses against every ANSWER_STRIDE-th
+ * dictionary word, and after every guess compares the candidate set with the
+ * words which rescoring every guess so far says are still possible, so the
+ * run fails if a constraint is wrong or the bitset is sized for another list.
+ *
+ * Then it times Candidates_addFeedback() against narrowing the same set by
+ * rescoring each remaining word with Score_feedback(), and fails if the set
+ * is not the faster of the two, as then it would not be worth its flash. It
+ * reports the SRAM the set takes up and the flash of its packed words; "make
+ * flash" reports the firmware's flash as a whole.
+ *
+ *   CandidatesBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Wordle/Candidates.h>
+#include <Wordle/Dictionary.h>
+
+// A game is played against every ANSWER_STRIDE-th dictionary word
+#define ANSWER_STRIDE       13
+
+// Guesses per game
+#define NUM_GUESSES         6
+
+#define NUM_ROUNDS          20
+
+static PackedWord* words;
+static uint32_t wordCount;
+
+// The words still possible when rescoring, as a flag per word
+static bool* possible;
+
+/** A small linear congruential generator, so every run plays the same games. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Reads the dictionary into an array, in the order of its bits in the candidate set. */
+static void readDictionary(void)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+
+    wordCount = 0;
+    words = malloc(Dictionary_wordCount() * sizeof(PackedWord));
+    possible = malloc(Dictionary_wordCount() * sizeof(bool));
+    if (words == NULL || possible == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        words[wordCount++] = word;
+    }
+}
+
+/** Drops the possible words which would have given a guess different feedback. Returns how many are left. */
+static uint32_t rescore(PackedWord guess, FeedbackCode code)
+{
+    uint32_t count = 0, i;
+
+    for (i = 0; i < wordCount; i++)
+    {
+        possible[i] = possible[i] && (Score_feedback(guess, words[i]) == code);
+        count += possible[i];
+    }
+    return count;
+}
+
+/** Returns the number of words on which the candidate set and the rescored flags disagree. */
+static uint32_t compare(void)
+{
+    uint32_t wrong = 0, i;
+
+    for (i = 0; i < wordCount; i++)
+    {
+        wrong += (Candidates_contains(i) != possible[i]);
+    }
+    return wrong;
+}
+
+/** Plays the checked games. Returns the number of guesses after which the sets disagree. */
+static uint32_t checkGames(uint32_t* guesses_p)
+{
+    uint32_t seed = 2026, wrong = 0, answer, i;
+    int guess;
+
+    *guesses_p = 0;
+    for (answer = 0; answer < wordCount; answer += ANSWER_STRIDE)
+    {
+        Candidates_reset();
+        for (i = 0; i < wordCount; i++)
+        {
+            possible[i] = true;
+        }
+
+        for (guess = 0; guess < NUM_GUESSES; guess++)
+        {
+            PackedWord word = words[nextRandom(&seed) % wordCount];
+            FeedbackCode code = Score_feedback(word, words[answer]);
+            uint32_t count;
+
+            Candidates_addFeedback(word, code);
+            count = rescore(word, code);
+            (*guesses_p)++;
+
+            if (compare() != 0 || count != Candidates_count() || !Candidates_contains(answer))
+            {
+                unsigned char guessText[SCORE_WORD_LENGTH], answerText[SCORE_WORD_LENGTH];
+
+                Score_unpackWord(word, guessText);
+                Score_unpackWord(words[answer], answerText);
+                if (wrong++ < 10)
+                {
+                    fprintf(stderr, "%.5s against %.5s: %u candidates, %u when rescoring\n",
+                            guessText, answerText, Candidates_count(), count);
+                }
+            }
+        }
+    }
+
+    return wrong;
+}
+
+/**
+ * Times the first NUM_GUESSES guesses of a game against every
+ * ANSWER_STRIDE-th word, narrowed by the candidate set or by rescoring.
+ */
+static double timeGames(bool useCandidates)
+{
+    uint32_t seed = 17, answer, i;
+    uint32_t feedbacks = 0;
+    int round, guess;
+    double elapsed = 0.0;
+
+    for (round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (answer = 0; answer < wordCount; answer += ANSWER_STRIDE)
+        {
+            Candidates_reset();
+            for (i = 0; i < wordCount; i++)
+            {
+                possible[i] = true;
+            }
+
+            for (guess = 0; guess < NUM_GUESSES; guess++)
+            {
+                PackedWord word = words[nextRandom(&seed) % wordCount];
+                FeedbackCode code = Score_feedback(word, words[answer]);
+                double start = nowNs();
+
+                if (useCandidates)
+                {
+                    Candidates_addFeedback(word, code);
+                }
+                else
+                {
+                    rescore(word, code);
+                }
+                elapsed += nowNs() - start;
+                feedbacks++;
+            }
+        }
+    }
+
+    return elapsed / feedbacks;
+}
+
+int main(void)
+{
+    uint32_t wrong, guesses;
+    double candidatesNs, rescoringNs;
+
+    Dictionary_init();
+    readDictionary();
+
+    wrong = checkGames(&guesses);
+    printf("Candidate set, %u words:\n", wordCount);
+    printf("  %u bytes of SRAM, %u bytes of flash\n", Candidates_ramBytes(), Candidates_flashBytes());
+    printf("  %u guesses checked against rescoring: %u wrong\n", guesses, wrong);
+
+    if (wrong > 0 || Candidates_bitsetWords() * 32 < wordCount)
+    {
+        fprintf(stderr, "the candidate set does not match rescoring; run make dictionary\n");
+        return EXIT_FAILURE;
+    }
+
+    candidatesNs = timeGames(true);
+    rescoringNs = timeGames(false);
+    printf("  Candidates_addFeedback       %8.1f ns/guess\n", candidatesNs);
+    printf("  rescoring every word         %8.1f ns/guess\n", rescoringNs);
+
+    if (candidatesNs >= rescoringNs)
+    {
+        fprintf(stderr, "the candidate set is slower than rescoring\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,230 @@
+/*
+ * ClockBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check of the clock in HAL/Clock.c, built from the firmware's source
+ * against the simulator in Sim/, and of the fixed-point conversions in
+ * HAL/Clock.h. It lets the virtual clock run up to ROLLOVERS rollovers of the
+ * hardware timer, and around each one reads the clock at every cycle from
+ * WINDOW cycles before to WINDOW cycles after the counter reloads: with
+ * interrupts on; with them off from before the rollover, as in a critical
+ * section; and after the rollover with its interrupt still waiting, as in a
+ * handler of higher priority. A read must fall between the simulator's time
+ * before and after it, so a read paired with the wrong rollover shows up as
+ * 2^32 cycles off. The conversions are checked against exact 128-bit
+ * arithmetic on edge and pseudo-random values, and SWTimer_percentElapsedInt()
+ * against SWTimer_percentElapsed() over a timer's wait.
+ *
+ * It reports the bus cycles a read costs and the largest conversion error,
+ * and fails on any read outside its window, any read earlier than the one
+ * before, a conversion off by more than Clock.h promises, or a whole percentage
+ * more than one off the double one.
+ *
+ *   ClockBenchmark
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <HAL/Clock.h>
+#include <HAL/Timer.h>
+#include <Sim/Sim.h>
+
+#define ROLLOVERS           6
+#define WINDOW              48
+#define CONVERSIONS         1000000
+
+// The largest values converted; a time in nanoseconds overflows 64 bits at 2^59 cycles, 380 years
+#define MAX_VALUE_BITS      58
+
+// The wait of the timer whose progress is checked, and how many times it is checked across it
+#define PERCENT_WAIT_MS     7
+#define PERCENT_CHECKS      1000
+
+// How long a handler of higher priority runs on after the rollover, with the rollover's interrupt waiting
+#define HELD_CYCLES         (WINDOW * 4)
+
+/** The simulated time the counter started at, within the bounds a quiet read gives. */
+static uint64_t startEarliest, startLatest;
+
+static uint64_t reads = 0, badReads = 0, backwardReads = 0;
+static uint64_t lastRead = 0;
+
+/** Reads the clock and checks the read against the simulator's time around it. */
+static void checkedRead(void)
+{
+    uint64_t before = Sim_now();
+    uint64_t cycles = Clock_cycles();
+    uint64_t after = Sim_now();
+
+    reads++;
+    if (cycles + startEarliest > after || cycles + startLatest < before)
+    {
+        if (badReads++ == 0)
+        {
+            fprintf(stderr, "read %llu cycles between %llu and %llu, counter started at %llu-%llu\n",
+                    (unsigned long long) cycles, (unsigned long long) before, (unsigned long long) after,
+                    (unsigned long long) startEarliest, (unsigned long long) startLatest);
+        }
+    }
+    backwardReads += cycles < lastRead;
+    lastRead = cycles;
+}
+
+/** Lets the virtual clock run to the given time, or not at all if it is already past it. */
+static void runTo(uint64_t time)
+{
+    uint64_t now = Sim_now();
+
+    if (time > now)
+    {
+        Sim_advance(time - now);
+    }
+}
+
+/**
+ * Reads once at each cycle offset around the reload which ends rollover n.
+ * Each read starts at its own offset, so the time the reads themselves take
+ * does not push the later ones past the window.
+ */
+static void sweepRollover(uint64_t n, bool masked, bool held)
+{
+    uint64_t reload = startEarliest + (n << 32);
+    int64_t offset;
+
+    for (offset = -WINDOW; offset <= WINDOW; offset++)
+    {
+        // Jump back a turn for the next offset, so every offset gets a rollover of its own
+        reload += (uint64_t) 1 << 32;
+
+        if (held)
+        {
+            // Off until well after the reload, the interrupt waits
+            runTo(reload - WINDOW * 2);
+            Interrupt_disableMaster();
+            runTo(reload + HELD_CYCLES + offset);
+            checkedRead();
+            Interrupt_enableMaster();
+        }
+        else if (masked)
+        {
+            runTo(reload - WINDOW * 2);
+            Interrupt_disableMaster();
+            runTo(reload + offset);
+            checkedRead();
+            Interrupt_enableMaster();
+        }
+        else
+        {
+            runTo(reload + offset);
+            checkedRead();
+        }
+        checkedRead();
+    }
+}
+
+/** The exact value * numerator / denominator, rounded down. */
+static uint64_t exact(uint64_t value, uint64_t numerator, uint64_t denominator)
+{
+    return (uint64_t) ((unsigned __int128) value * numerator / denominator);
+}
+
+static uint64_t maxError = 0, badConversions = 0;
+
+/** Checks a conversion is within one of exact, plus one per 2^33 units converted. */
+static void checkConversion(uint64_t value, uint64_t converted, uint64_t numerator, uint64_t denominator)
+{
+    uint64_t want = exact(value, numerator, denominator);
+    uint64_t error = (converted > want) ? converted - want : want - converted;
+
+    maxError = (value < (1ull << 33) && error > maxError) ? error : maxError;
+    badConversions += error > 1 + (value >> 33);
+}
+
+/**
+ * Checks a timer's whole percentage against 100 times its double one, from
+ * its start to past its wait. Returns how many are more than one off.
+ */
+static uint32_t checkPercentages(void)
+{
+    SWTimer timer = SWTimer_construct(PERCENT_WAIT_MS);
+    uint32_t wrong = 0, i;
+
+    SWTimer_start(&timer);
+    for (i = 0; i <= PERCENT_CHECKS + PERCENT_CHECKS / 10; i++)
+    {
+        double percent = SWTimer_percentElapsed(&timer) * 100.0;
+        uint32_t whole = SWTimer_percentElapsedInt(&timer);
+
+        wrong += (whole > percent + 1.0) || (whole + 1.0 < percent);
+        Sim_advance(Clock_fromMs(PERCENT_WAIT_MS) / PERCENT_CHECKS);
+    }
+    return wrong;
+}
+
+static void checkConversions(uint64_t value)
+{
+    checkConversion(value, Clock_toNs(value), 1000000000u, CLOCK_HZ);
+    checkConversion(value, Clock_toUs(value), US_DIVISION_FACTOR, CLOCK_HZ);
+    checkConversion(value, Clock_toMs(value), MS_DIVISION_FACTOR, CLOCK_HZ);
+    checkConversion(value, Clock_fromNs(value), CLOCK_HZ, 1000000000u);
+}
+
+int main(void)
+{
+    uint64_t state = 2026, value, before, after, busCycles;
+    uint64_t n;
+    uint32_t i, shift, badPercentages;
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+
+    // A read far from any rollover pins down when the counter started
+    Sim_advance(1000);
+    before = Sim_now();
+    value = Clock_cycles();
+    after = Sim_now();
+    startEarliest = before - value;
+    startLatest = after - value;
+    busCycles = after - before;
+
+    for (n = 0; n < ROLLOVERS; n += 3)
+    {
+        sweepRollover(n * (2 * WINDOW + 1), false, false);
+        sweepRollover((n + 1) * (2 * WINDOW + 1), true, false);
+        sweepRollover((n + 2) * (2 * WINDOW + 1), false, true);
+    }
+
+    printf("Clock, %u Hz:\n", CLOCK_HZ);
+    printf("  a read costs %llu bus cycles\n", (unsigned long long) busCycles);
+    printf("  %llu reads around %u rollovers, with interrupts on, off, and waiting: %llu wrong, %llu backwards\n",
+           (unsigned long long) reads, ROLLOVERS * (2 * WINDOW + 1), (unsigned long long) badReads,
+           (unsigned long long) backwardReads);
+
+    for (shift = 0; shift <= MAX_VALUE_BITS; shift++)
+    {
+        checkConversions(1ull << shift);
+        checkConversions((1ull << shift) - 1);
+    }
+    for (i = 0; i < CONVERSIONS; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        checkConversions((state >> (state & 63)) & ((1ull << MAX_VALUE_BITS) - 1));
+    }
+    printf("  %u conversions each way: %llu out of bounds, at most %llu off below 2^33\n",
+           CONVERSIONS + 2 * (MAX_VALUE_BITS + 1), (unsigned long long) badConversions, (unsigned long long) maxError);
+
+    badPercentages = checkPercentages();
+    printf("  %u percentages of a %u ms timer: %u more than one off\n",
+           PERCENT_CHECKS + PERCENT_CHECKS / 10 + 1, PERCENT_WAIT_MS, badPercentages);
+
+    if (badReads > 0 || backwardReads > 0 || badConversions > 0 || reads == 0 || badPercentages > 0)
+    {
+        fprintf(stderr, "the clock read wrong around a rollover, or a conversion or percentage is off\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*
+ * DecisionTreeBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host benchmark of the decision tree search in Analysis/DecisionTree.c over
+ * a feedback matrix written by MakeFeedbackMatrix. It searches the same tree
+ * on 1, 2, 4, ... threads up to one per CPU, and at least 2 so that stealing
+ * is exercised on a single CPU, and reports the time, nodes per second and
+ * speedup of each, with the peak resident memory. It fails if any number of
+ * threads finds a different tree than one thread does.
+ *
+ *   DecisionTreeBenchmark feedback.matrix [top]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <Analysis/DecisionTree.h>
+#include <Analysis/FeedbackMatrix.h>
+
+// Guesses tried at each node unless given a number; enough to search in seconds
+#define BENCHMARK_TOP   2
+
+/** Doubles the threads, but ends on the most there are even when it is not a power of two. */
+static uint32_t nextThreads(uint32_t threads, uint32_t maxThreads)
+{
+    return (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2;
+}
+
+static bool DecisionTree_same(const DecisionTree* a, const DecisionTree* b)
+{
+    uint32_t answers = a->matrix->answerCount;
+
+    return a->totalGuesses == b->totalGuesses && memcmp(a->depths, b->depths, answers) == 0
+           && memcmp(a->paths, b->paths, (size_t) answers * a->maxGuesses * sizeof(uint16_t)) == 0;
+}
+
+int main(int argc, char** argv)
+{
+    DecisionTreeOptions options = DecisionTree_defaults();
+    DecisionTreeStats stats;
+    DecisionTreeStatus status;
+    DecisionTree first, tree;
+    FeedbackMatrix matrix;
+    FeedbackMatrixStatus matrixStatus;
+    struct rusage usage;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t maxThreads = (cpus > 2) ? (uint32_t) cpus : 2;
+    uint32_t threads;
+    double oneThread = 0;
+    bool failed = false;
+
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "usage: %s feedback.matrix [top]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    options.topGuesses = (argc == 3) ? (uint32_t) strtoul(argv[2], NULL, 10) : BENCHMARK_TOP;
+
+    matrixStatus = FeedbackMatrix_open(&matrix, argv[1]);
+    if (matrixStatus != FEEDBACK_MATRIX_OK)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], FeedbackMatrix_statusName(matrixStatus));
+        return EXIT_FAILURE;
+    }
+
+    printf("Decision tree, %u answers, top %u guesses per node, at most %u guesses, %ld CPUs:\n",
+           matrix.answerCount, options.topGuesses, options.maxGuesses, cpus);
+
+    for (threads = 1; threads <= maxThreads && !failed; threads = nextThreads(threads, maxThreads))
+    {
+        options.threads = threads;
+        status = DecisionTree_solve((threads == 1) ? &first : &tree, &matrix, &options, &stats);
+        if (status != DECISION_TREE_OK)
+        {
+            fprintf(stderr, "%u threads: %s\n", threads, DecisionTree_statusName(status));
+            failed = true;
+            break;
+        }
+
+        if (threads == 1)
+        {
+            oneThread = stats.seconds;
+            printf("  %.4f guesses on average, memo %.1f MB\n", (double) first.totalGuesses / matrix.answerCount,
+                   stats.memoBytes / 1e6);
+        }
+        else
+        {
+            failed = !DecisionTree_same(&first, &tree);
+            DecisionTree_free(&tree);
+        }
+
+        getrusage(RUSAGE_SELF, &usage);
+        printf("  %2u threads: %6.2f s, %6lu nodes, %6.0f nodes/s, %.2fx, %4lu of %4lu tasks stolen, "
+               "peak resident %.1f MB%s\n", stats.threads, stats.seconds, (unsigned long) stats.nodes,
+               stats.nodes / stats.seconds, oneThread / stats.seconds, (unsigned long) stats.steals,
+               (unsigned long) stats.tasks, usage.ru_maxrss / 1e3, failed ? ", DIFFERENT TREE" : "");
+    }
+
+    if (oneThread > 0)
+    {
+        DecisionTree_free(&first);
+    }
+    FeedbackMatrix_close(&matrix);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,278 @@
+/*
+ * DictionaryBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the guess dictionary in Wordle/Dictionary.c,
+ * built with whichever backend DICTIONARY_BACKEND selects. Every one of the
+ * 26^5 possible words is looked up and compared with a binary search over
+ * Wordle/words.txt itself, and a walk with Dictionary_next() must visit the
+ * list in order, so the run fails if the backend or its tables are wrong, or
+ * the tables were not regenerated after the list changed.
+ *
+ * Then it times lookups of a pseudo-random mix of listed and random words and
+ * reports the cost of one Dictionary_contains() call in nanoseconds and (on
+ * x86) timestamp counter cycles, next to a binary search over the packed
+ * list, and the flash and SRAM the backend takes up.
+ *
+ *   DictionaryBenchmark [words.txt]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Wordle/Dictionary.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define DEFAULT_WORD_LIST   "../EmbeddedSystemsWordle/Wordle/words.txt"
+#define MAX_LINE_LENGTH     64
+
+#define NUM_LOOKUPS         4096
+#define NUM_ROUNDS          2000
+
+// The chance, in percent, that a looked up word is from the list
+#define LISTED_CHANCE       50
+
+static PackedWord* listed;
+static uint32_t listedCount;
+
+static PackedWord lookups[NUM_LOOKUPS];
+
+/** A small linear congruential generator, so every run looks up the same words. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static int comparePacked(const void* a, const void* b)
+{
+    PackedWord x = *(const PackedWord*) a, y = *(const PackedWord*) b;
+
+    return (x > y) - (x < y);
+}
+
+/** Reads the word list the same way MakeDictionary does. */
+static void readWords(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    char line[MAX_LINE_LENGTH];
+    uint32_t capacity = 1024, unique, i;
+
+    if (file == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    listed = malloc(capacity * sizeof(PackedWord));
+    listedCount = 0;
+    while (listed != NULL && fgets(line, sizeof(line), file) != NULL)
+    {
+        if (strcspn(line, "\r\n") != SCORE_WORD_LENGTH || line[0] == '#')
+        {
+            continue;
+        }
+        if (listedCount == capacity)
+        {
+            capacity *= 2;
+            listed = realloc(listed, capacity * sizeof(PackedWord));
+        }
+        if (listed != NULL)
+        {
+            listed[listedCount++] = Score_packWord((const unsigned char*) line);
+        }
+    }
+    fclose(file);
+
+    if (listed == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    qsort(listed, listedCount, sizeof(PackedWord), comparePacked);
+    for (unique = listedCount ? 1 : 0, i = 1; i < listedCount; i++)
+    {
+        if (listed[i] != listed[unique - 1])
+        {
+            listed[unique++] = listed[i];
+        }
+    }
+    listedCount = unique;
+}
+
+static bool listContains(PackedWord word)
+{
+    return bsearch(&word, listed, listedCount, sizeof(PackedWord), comparePacked) != NULL;
+}
+
+/**
+ * Walks the dictionary and compares it with the sorted list, then starts a
+ * walk at every word and checks the two words it visits first. Returns the
+ * number of words out of place.
+ */
+static uint32_t checkWalk(void)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+    uint32_t count = 0, wrong = 0, i;
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        if (count >= listedCount || word != listed[count])
+        {
+            wrong++;
+        }
+        count++;
+    }
+
+    for (i = 0; i < listedCount; i++)
+    {
+        cursor = Dictionary_cursorAt(listed[i]);
+        wrong += !Dictionary_next(&cursor, &word) || word != listed[i];
+        wrong += (Dictionary_next(&cursor, &word) != (i + 1 < listedCount))
+                 || (i + 1 < listedCount && word != listed[i + 1]);
+    }
+
+    return wrong + ((count < listedCount) ? listedCount - count : 0);
+}
+
+/** Looks up every word of letters 'A' to 'Z'. Returns the number of words the dictionary gets wrong. */
+static uint32_t checkAllWords(uint32_t* found)
+{
+    unsigned char word[SCORE_WORD_LENGTH];
+    uint32_t index, total = 1, wrong = 0;
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        total *= 26;
+    }
+
+    *found = 0;
+    for (index = 0; index < total; index++)
+    {
+        uint32_t rest = index;
+        PackedWord packed;
+        bool contained;
+
+        for (i = SCORE_WORD_LENGTH - 1; i >= 0; i--)
+        {
+            word[i] = (unsigned char) ('A' + rest % 26);
+            rest /= 26;
+        }
+        packed = Score_packWord(word);
+        contained = Dictionary_contains(packed);
+
+        *found += contained;
+        if (contained != listContains(packed))
+        {
+            if (wrong++ < 10)
+            {
+                fprintf(stderr, "%.5s: dictionary says %s\n", word, contained ? "listed" : "not listed");
+            }
+        }
+    }
+
+    return wrong;
+}
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Times one way of looking up every word in lookups[], NUM_ROUNDS times. */
+static void timeLookups(const char* name, bool (*contains)(PackedWord))
+{
+    uint32_t found = 0;
+    int i, round;
+
+    double start = nowNs();
+#ifdef HAVE_TSC
+    uint64_t startTsc = __rdtsc();
+#endif
+    for (round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_LOOKUPS; i++)
+        {
+            found += contains(lookups[i]);
+        }
+    }
+#ifdef HAVE_TSC
+    uint64_t tsc = __rdtsc() - startTsc;
+#endif
+    double elapsed = nowNs() - start;
+    double count = (double) NUM_LOOKUPS * NUM_ROUNDS;
+
+    printf("  %-28s %6.2f ns/lookup", name, elapsed / count);
+#ifdef HAVE_TSC
+    printf(", %6.2f TSC cycles/lookup", (double) tsc / count);
+#endif
+    printf(", %.1f%% found\n", 100.0 * found / count);
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t seed = 12345;
+    uint32_t found, wrong, walkWrong;
+    int i, j;
+
+    readWords((argc > 1) ? argv[1] : DEFAULT_WORD_LIST);
+    Dictionary_init();
+
+    wrong = checkAllWords(&found);
+    walkWrong = checkWalk();
+#if DICTIONARY_BACKEND == DICTIONARY_PACKED
+    printf("Dictionary, packed with an index entry every %d words:\n", DICTIONARY_PACKED_STRIDE);
+#else
+    printf("Dictionary, DAWG:\n");
+#endif
+    printf("  %u words in %u bytes of flash (%.2f bytes/word) and %u bytes of SRAM\n",
+           Dictionary_wordCount(), Dictionary_flashBytes(), (double) Dictionary_flashBytes() / Dictionary_wordCount(),
+           Dictionary_ramBytes());
+    printf("  an array of packed words would be %u bytes, text %u bytes\n", listedCount * (uint32_t) sizeof(PackedWord),
+           listedCount * (SCORE_WORD_LENGTH + 1));
+    printf("  all 26^%d words checked against the list: %u found, %u wrong\n", SCORE_WORD_LENGTH, found, wrong);
+    printf("  a walk over the dictionary, and from each word: %u words out of place\n", walkWrong);
+
+    if (wrong > 0 || walkWrong > 0 || found != listedCount || Dictionary_wordCount() != listedCount)
+    {
+        fprintf(stderr, "the dictionary tables do not match the word list; run make dictionary\n");
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < NUM_LOOKUPS; i++)
+    {
+        if (nextRandom(&seed) % 100 < LISTED_CHANCE)
+        {
+            lookups[i] = listed[nextRandom(&seed) % listedCount];
+        }
+        else
+        {
+            unsigned char word[SCORE_WORD_LENGTH];
+
+            for (j = 0; j < SCORE_WORD_LENGTH; j++)
+            {
+                word[j] = (unsigned char) ('A' + nextRandom(&seed) % 26);
+            }
+            lookups[i] = Score_packWord(word);
+        }
+    }
+
+    timeLookups("Dictionary_contains", Dictionary_contains);
+    timeLookups("bsearch over packed list", listContains);
+
+    return EXIT_SUCCESS;
+}
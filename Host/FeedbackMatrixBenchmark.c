@@ -0,0 +1,182 @@
+/*
+ * FeedbackMatrixBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of a feedback matrix file written by
+ * MakeFeedbackMatrix. It times opening the file and verifying its checksum,
+ * checks every CHECK_STRIDE-th row cell by cell against Score_feedback(), and
+ * fails if the file does not match the dictionary or the scorer.
+ *
+ * Then it reports the cost of looking up a pseudo-random guess/answer pair
+ * next to scoring it, and of a histogram of one guess against every answer
+ * counted from its row next to one from Analysis/BatchScore.c.
+ *
+ *   FeedbackMatrixBenchmark feedback.matrix
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Analysis/BatchScore.h>
+#include <Analysis/FeedbackMatrix.h>
+#include <Wordle/Dictionary.h>
+
+#define CHECK_STRIDE        16
+#define NUM_LOOKUPS         (1 << 16)
+#define NUM_ROUNDS          100
+
+static uint32_t lookupGuesses[NUM_LOOKUPS];
+static uint32_t lookupAnswers[NUM_LOOKUPS];
+
+/** A small linear congruential generator, so every run looks up the same pairs. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Checks that the matrix holds the dictionary as both lists. Returns the number of words which differ. */
+static uint32_t checkWords(const FeedbackMatrix* matrix)
+{
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word;
+    uint32_t index = 0, wrong = 0;
+
+    while (Dictionary_next(&cursor, &word))
+    {
+        wrong += (index >= matrix->guessCount || matrix->guesses[index] != word);
+        wrong += (index >= matrix->answerCount || matrix->answers[index] != word);
+        index++;
+    }
+    return wrong + (matrix->guessCount - (index < matrix->guessCount ? index : matrix->guessCount))
+           + (matrix->answerCount - (index < matrix->answerCount ? index : matrix->answerCount));
+}
+
+static uint32_t checkCells(const FeedbackMatrix* matrix)
+{
+    uint32_t wrong = 0, guess, answer;
+
+    for (guess = 0; guess < matrix->guessCount; guess += CHECK_STRIDE)
+    {
+        const FeedbackCode* row = FeedbackMatrix_row(matrix, guess);
+
+        for (answer = 0; answer < matrix->answerCount; answer++)
+        {
+            wrong += (row[answer] != Score_feedback(matrix->guesses[guess], matrix->answers[answer]));
+        }
+    }
+    return wrong;
+}
+
+int main(int argc, char** argv)
+{
+    FeedbackMatrix matrix;
+    FeedbackMatrixStatus status;
+    uint32_t histogram[SCORE_NUM_CODES];
+    uint32_t seed = 99, sink = 0, wrong, i, round, guess;
+    double start, openNs, verifyNs, lookupNs, scoreNs, rowNs, batchNs;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s feedback.matrix\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Dictionary_init();
+
+    start = nowNs();
+    status = FeedbackMatrix_open(&matrix, argv[1]);
+    openNs = nowNs() - start;
+    if (status != FEEDBACK_MATRIX_OK)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], FeedbackMatrix_statusName(status));
+        return EXIT_FAILURE;
+    }
+
+    start = nowNs();
+    status = FeedbackMatrix_verify(&matrix);
+    verifyNs = nowNs() - start;
+
+    wrong = checkWords(&matrix) + checkCells(&matrix);
+
+    printf("Feedback matrix, %u x %u cells, %.1f MB:\n", matrix.guessCount, matrix.answerCount,
+           matrix.bytes / 1e6);
+    printf("  opened in %.1f us, checksum %s in %.1f ms, every %dth row checked: %u wrong\n", openNs / 1e3,
+           FeedbackMatrix_statusName(status), verifyNs / 1e6, CHECK_STRIDE, wrong);
+
+    if (status != FEEDBACK_MATRIX_OK || wrong > 0)
+    {
+        fprintf(stderr, "the matrix does not match the dictionary or the scorer; run MakeFeedbackMatrix\n");
+        FeedbackMatrix_close(&matrix);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < NUM_LOOKUPS; i++)
+    {
+        lookupGuesses[i] = nextRandom(&seed) % matrix.guessCount;
+        lookupAnswers[i] = nextRandom(&seed) % matrix.answerCount;
+    }
+
+    start = nowNs();
+    for (round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_LOOKUPS; i++)
+        {
+            sink += FeedbackMatrix_code(&matrix, lookupGuesses[i], lookupAnswers[i]);
+        }
+    }
+    lookupNs = (nowNs() - start) / ((double) NUM_LOOKUPS * NUM_ROUNDS);
+
+    start = nowNs();
+    for (round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_LOOKUPS; i++)
+        {
+            sink -= Score_feedback(matrix.guesses[lookupGuesses[i]], matrix.answers[lookupAnswers[i]]);
+        }
+    }
+    scoreNs = (nowNs() - start) / ((double) NUM_LOOKUPS * NUM_ROUNDS);
+
+    start = nowNs();
+    for (guess = 0; guess < matrix.guessCount; guess++)
+    {
+        const FeedbackCode* row = FeedbackMatrix_row(&matrix, guess);
+
+        memset(histogram, 0, sizeof(histogram));
+        for (i = 0; i < matrix.answerCount; i++)
+        {
+            histogram[row[i]]++;
+        }
+        sink += histogram[SCORE_ALL_GREEN];
+    }
+    rowNs = (nowNs() - start) / matrix.guessCount;
+
+    start = nowNs();
+    for (guess = 0; guess < matrix.guessCount; guess++)
+    {
+        BatchScore_histogram(matrix.guesses[guess], matrix.answers, matrix.answerCount, histogram);
+        sink -= histogram[SCORE_ALL_GREEN];
+    }
+    batchNs = (nowNs() - start) / matrix.guessCount;
+
+    printf("  random pair: %.2f ns looked up, %.2f ns scored\n", lookupNs, scoreNs);
+    printf("  histogram of a guess: %.1f us counted from its row, %.1f us scored with %s\n", rowNs / 1e3,
+           batchNs / 1e3, BatchScore_name(BatchScore_isa()));
+
+    FeedbackMatrix_close(&matrix);
+
+    // Both ways saw the same codes
+    return (sink == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
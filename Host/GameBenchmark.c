@@ -0,0 +1,283 @@
+/*
+ * GameBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host throughput benchmark of the game itself. proj1_main.c's Application FSM
+ * runs in the firmware's own scheduled super-loop (Application_schedule())
+ * against the POSIX HAL in headless mode, with scripted input: any key on
+ * the title screen, a secret word and S1, then up to six guesses with S1 after
+ * each, and a fresh Application once the result is shown. Some guesses are
+ * first typed as a word which is not in the dictionary, which must not use up
+ * a guess, and backspaced. Every game is
+ * checked to have ended the way its script says it should.
+ *
+ * The words are five letters, the length of the dictionary. Built for another
+ * SCORE_WORD_LENGTH ("make lengths"), each is cut short or repeated to fit,
+ * and since the game has no dictionary then, nothing is rejected.
+ *
+ * It reports games and super-loop iterations per second, and the time spent
+ * in each FSM state handler and rendering call. Those come from
+ * -finstrument-functions hooks on proj1_main.c, so they are inclusive (a
+ * handler's time contains the calls it makes) and carry a few tens of
+ * nanoseconds of timer overhead per call.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Application.h>
+#include <Posix/PosixHAL.h>
+
+#define NUM_GAMES           10000
+
+// The chance, in percent, that a guess is the answer
+#define WIN_CHANCE          25
+
+// The chance, in percent, that a guess is preceded by one the dictionary rejects
+#if DICTIONARY_AVAILABLE
+#define REJECTED_CHANCE     10
+#else
+#define REJECTED_CHANCE     0
+#endif
+
+// A game that has consumed its whole script but not shown a result after this many loops is stuck
+#define MAX_IDLE_LOOPS      100
+
+#define MAX_CALL_DEPTH      16
+
+static const char* const words[] =
+{
+    "CRANE", "SLATE", "HELLO", "WORLD", "PIANO", "GHOST", "BRICK", "LEMON",
+    "MANGO", "QUEEN", "RIVER", "STONE", "TIGER", "VIVID", "WALTZ", "YEAST",
+    "ABBEY", "EERIE", "LLAMA", "SASSY", "CREEP", "ALLOY", "ROBOT", "FUZZY",
+};
+
+#define NUM_WORDS (sizeof(words) / sizeof(words[0]))
+
+static const char* const nonWords[] =
+{
+    "QWERT", "ZZZZZ", "CRANX", "HELOL", "AEIOU", "WORDL",
+};
+
+#define NUM_NON_WORDS (sizeof(nonWords) / sizeof(nonWords[0]))
+
+/** The functions of proj1_main.c which get timed, with what they cost so far. */
+static struct
+{
+    const char* name;
+    void* function;
+    uint64_t calls;
+    double ns;
+} timed[] =
+{
+    { "Application_update",             (void*) Application_update, 0, 0 },
+    { "Application_handleTitleScreen",  (void*) Application_handleTitleScreen, 0, 0 },
+    { "Application_handleCreateWord",   (void*) Application_handleCreateWord, 0, 0 },
+    { "Application_handleGameScreen",   (void*) Application_handleGameScreen, 0, 0 },
+    { "Application_updateCommunications", (void*) Application_updateCommunications, 0, 0 },
+    { "Application_showTitleScreen",    (void*) Application_showTitleScreen, 0, 0 },
+    { "Application_showCreateWord",     (void*) Application_showCreateWord, 0, 0 },
+    { "Application_showGuessWord",      (void*) Application_showGuessWord, 0, 0 },
+    { "Application_letterUpdate",       (void*) Application_letterUpdate, 0, 0 },
+    { "Application_checkGuess",         (void*) Application_checkGuess, 0, 0 },
+    { "Application_wordleAlgo",         (void*) Application_wordleAlgo, 0, 0 },
+    { "Application_correctResult",      (void*) Application_correctResult, 0, 0 },
+};
+
+#define NUM_TIMED (sizeof(timed) / sizeof(timed[0]))
+
+/** The timed calls in progress. */
+static struct
+{
+    uint32_t index;
+    double start;
+} callStack[MAX_CALL_DEPTH];
+static uint32_t callDepth = 0;
+
+__attribute__((no_instrument_function))
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+__attribute__((no_instrument_function))
+static uint32_t timedIndex(void* function)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_TIMED && timed[i].function != function; i++)
+    {
+    }
+    return i;
+}
+
+__attribute__((no_instrument_function))
+void __cyg_profile_func_enter(void* function, void* callSite)
+{
+    uint32_t index = timedIndex(function);
+
+    (void) callSite;
+
+    if (index < NUM_TIMED && callDepth < MAX_CALL_DEPTH)
+    {
+        callStack[callDepth].index = index;
+        callStack[callDepth].start = nowNs();
+        callDepth++;
+    }
+}
+
+__attribute__((no_instrument_function))
+void __cyg_profile_func_exit(void* function, void* callSite)
+{
+    (void) callSite;
+
+    if (callDepth > 0 && timed[callStack[callDepth - 1].index].function == function)
+    {
+        callDepth--;
+        timed[callStack[callDepth].index].ns += nowNs() - callStack[callDepth].start;
+        timed[callStack[callDepth].index].calls++;
+    }
+}
+
+/** A small linear congruential generator, so every run plays the same games. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/** Types a word in lower case, as a player would, and taps S1. */
+static uint32_t typeWord(char* script, const char* word)
+{
+    size_t length = strlen(word);
+    int i;
+
+    for (i = 0; i < MAX_LETTERS; i++)
+    {
+        script[i] = (char) (word[i % length] - 'A' + 'a');
+    }
+    script[MAX_LETTERS] = '\n';
+    return MAX_LETTERS + 1;
+}
+
+/**
+ * Feeds the input of one game into the HAL and returns whether player 2 wins
+ * it. A rejected guess is backspaced letter by letter before the next one.
+ */
+static bool feedGame(uint32_t* seed)
+{
+    char script[MAX_LETTERS + 2 + MAX_GUESSES * (3 * MAX_LETTERS + 2)];
+    const char* answer = words[nextRandom(seed) % NUM_WORDS];
+    uint32_t length = 0;
+    int guess, i;
+
+    script[length++] = 'x';
+    length += typeWord(&script[length], answer);
+
+    for (guess = 0; guess < MAX_GUESSES; guess++)
+    {
+        const char* word = (nextRandom(seed) % 100 < WIN_CHANCE) ? answer : words[nextRandom(seed) % NUM_WORDS];
+
+        if ((int) (nextRandom(seed) % 100) < REJECTED_CHANCE)
+        {
+            length += typeWord(&script[length], nonWords[nextRandom(seed) % NUM_NON_WORDS]);
+            for (i = 0; i < MAX_LETTERS; i++)
+            {
+                script[length++] = '\b';
+            }
+        }
+        length += typeWord(&script[length], word);
+
+        if (word == answer)
+        {
+            break;
+        }
+    }
+
+    PosixHAL_feed(script, length);
+    return guess < MAX_GUESSES;
+}
+
+int main(void)
+{
+    uint32_t seed = 12345;
+    uint32_t games = 0, wins = 0, wrongResults = 0;
+    uint32_t idleLoops = 0;
+    uint64_t iterations = 0;
+    bool expectWin;
+    uint32_t i;
+
+    PosixHAL_setHeadless();
+    WDT_A_holdTimer();
+    InitSystemTiming();
+
+    HAL hal = HAL_construct();
+    Application app = Application_construct();
+    Dictionary_init();
+    Application_schedule(&app, &hal);
+
+    expectWin = feedGame(&seed);
+
+    double start = nowNs();
+    while (games < NUM_GAMES)
+    {
+        // The super-loop of main(); the headless HAL never sleeps, it only takes the events again
+        Scheduler_signal(HAL_takeEvents(&hal));
+        if (!Scheduler_runNext())
+        {
+            Scheduler_signal(HAL_sleep(&hal));
+        }
+        iterations++;
+
+        if (!PosixHAL_inputDone())
+        {
+            continue;
+        }
+
+        // Application_update() moves on to the next guess after the one that shows the result, so it ends up past RESULT
+        if (app.guess >= RESULT)
+        {
+            bool won = app.correct == MAX_LETTERS;
+
+            wins += won;
+            wrongResults += won != expectWin;
+            games++;
+
+            app = Application_construct(); // In place, since the tasks hold its address
+            expectWin = feedGame(&seed);
+            idleLoops = 0;
+        }
+        else if (++idleLoops > MAX_IDLE_LOOPS)
+        {
+            fprintf(stderr, "game %u consumed its input but never showed a result\n", games);
+            return EXIT_FAILURE;
+        }
+    }
+    double elapsed = nowNs() - start;
+
+    printf("Game loop: %u games (%u won by player 2) in %.1f ms\n", games, wins, elapsed / 1e6);
+    printf("  %.0f games/s, %.2f M super-loop iterations/s, %.1f iterations/game\n",
+           games / elapsed * 1e9, iterations / elapsed * 1e3, (double) iterations / games);
+    printf("  %llu UART characters echoed\n", (unsigned long long) PosixHAL_charsSent());
+    printf("  %-36s %10s %12s\n", "inclusive time per call", "calls", "ns/call");
+    for (i = 0; i < NUM_TIMED; i++)
+    {
+        printf("  %-36s %10llu %12.1f\n", timed[i].name, (unsigned long long) timed[i].calls,
+               timed[i].calls ? timed[i].ns / timed[i].calls : 0.0);
+    }
+
+    if (wrongResults > 0)
+    {
+        fprintf(stderr, "%u games ended differently than scripted\n", wrongResults);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
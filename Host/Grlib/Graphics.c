@@ -0,0 +1,257 @@
+/*
+ * Graphics.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host implementation of the grlib calls declared in Host/include/ti/grlib/grlib.h.
+ * Every call is clipped to the display and handed to the display driver's
+ * primitives, the same way grlib does it, so a driver table behaves the same
+ * whether the board or the host is drawing through it.
+ */
+
+#include <string.h>
+
+#include <ti/grlib/grlib.h>
+
+/** Classic 5x7 glyphs for ' ' to '~', one byte per column, least significant bit on top. */
+static const uint8_t font5x7[95 * 5] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00,   0x00, 0x00, 0x5F, 0x00, 0x00,   0x00, 0x07, 0x00, 0x07, 0x00,
+    0x14, 0x7F, 0x14, 0x7F, 0x14,   0x24, 0x2A, 0x7F, 0x2A, 0x12,   0x23, 0x13, 0x08, 0x64, 0x62,
+    0x36, 0x49, 0x55, 0x22, 0x50,   0x00, 0x05, 0x03, 0x00, 0x00,   0x00, 0x1C, 0x22, 0x41, 0x00,
+    0x00, 0x41, 0x22, 0x1C, 0x00,   0x08, 0x2A, 0x1C, 0x2A, 0x08,   0x08, 0x08, 0x3E, 0x08, 0x08,
+    0x00, 0x50, 0x30, 0x00, 0x00,   0x08, 0x08, 0x08, 0x08, 0x08,   0x00, 0x60, 0x60, 0x00, 0x00,
+    0x20, 0x10, 0x08, 0x04, 0x02,   0x3E, 0x51, 0x49, 0x45, 0x3E,   0x00, 0x42, 0x7F, 0x40, 0x00,
+    0x42, 0x61, 0x51, 0x49, 0x46,   0x21, 0x41, 0x45, 0x4B, 0x31,   0x18, 0x14, 0x12, 0x7F, 0x10,
+    0x27, 0x45, 0x45, 0x45, 0x39,   0x3C, 0x4A, 0x49, 0x49, 0x30,   0x01, 0x71, 0x09, 0x05, 0x03,
+    0x36, 0x49, 0x49, 0x49, 0x36,   0x06, 0x49, 0x49, 0x29, 0x1E,   0x00, 0x36, 0x36, 0x00, 0x00,
+    0x00, 0x56, 0x36, 0x00, 0x00,   0x08, 0x14, 0x22, 0x41, 0x00,   0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x41, 0x22, 0x14, 0x08,   0x02, 0x01, 0x51, 0x09, 0x06,   0x32, 0x49, 0x79, 0x41, 0x3E,
+    0x7E, 0x11, 0x11, 0x11, 0x7E,   0x7F, 0x49, 0x49, 0x49, 0x36,   0x3E, 0x41, 0x41, 0x41, 0x22,
+    0x7F, 0x41, 0x41, 0x22, 0x1C,   0x7F, 0x49, 0x49, 0x49, 0x41,   0x7F, 0x09, 0x09, 0x09, 0x01,
+    0x3E, 0x41, 0x49, 0x49, 0x7A,   0x7F, 0x08, 0x08, 0x08, 0x7F,   0x00, 0x41, 0x7F, 0x41, 0x00,
+    0x20, 0x40, 0x41, 0x3F, 0x01,   0x7F, 0x08, 0x14, 0x22, 0x41,   0x7F, 0x40, 0x40, 0x40, 0x40,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,   0x7F, 0x04, 0x08, 0x10, 0x7F,   0x3E, 0x41, 0x41, 0x41, 0x3E,
+    0x7F, 0x09, 0x09, 0x09, 0x06,   0x3E, 0x41, 0x51, 0x21, 0x5E,   0x7F, 0x09, 0x19, 0x29, 0x46,
+    0x46, 0x49, 0x49, 0x49, 0x31,   0x01, 0x01, 0x7F, 0x01, 0x01,   0x3F, 0x40, 0x40, 0x40, 0x3F,
+    0x1F, 0x20, 0x40, 0x20, 0x1F,   0x3F, 0x40, 0x38, 0x40, 0x3F,   0x63, 0x14, 0x08, 0x14, 0x63,
+    0x07, 0x08, 0x70, 0x08, 0x07,   0x61, 0x51, 0x49, 0x45, 0x43,   0x00, 0x7F, 0x41, 0x41, 0x00,
+    0x02, 0x04, 0x08, 0x10, 0x20,   0x00, 0x41, 0x41, 0x7F, 0x00,   0x04, 0x02, 0x01, 0x02, 0x04,
+    0x40, 0x40, 0x40, 0x40, 0x40,   0x00, 0x01, 0x02, 0x04, 0x00,   0x20, 0x54, 0x54, 0x54, 0x78,
+    0x7F, 0x48, 0x44, 0x44, 0x38,   0x38, 0x44, 0x44, 0x44, 0x20,   0x38, 0x44, 0x44, 0x48, 0x7F,
+    0x38, 0x54, 0x54, 0x54, 0x18,   0x08, 0x7E, 0x09, 0x01, 0x02,   0x0C, 0x52, 0x52, 0x52, 0x3E,
+    0x7F, 0x08, 0x04, 0x04, 0x78,   0x00, 0x44, 0x7D, 0x40, 0x00,   0x20, 0x40, 0x44, 0x3D, 0x00,
+    0x7F, 0x10, 0x28, 0x44, 0x00,   0x00, 0x41, 0x7F, 0x40, 0x00,   0x7C, 0x04, 0x18, 0x04, 0x78,
+    0x7C, 0x08, 0x04, 0x04, 0x78,   0x38, 0x44, 0x44, 0x44, 0x38,   0x7C, 0x14, 0x14, 0x14, 0x08,
+    0x08, 0x14, 0x14, 0x18, 0x7C,   0x7C, 0x08, 0x04, 0x04, 0x08,   0x48, 0x54, 0x54, 0x54, 0x20,
+    0x04, 0x3F, 0x44, 0x40, 0x20,   0x3C, 0x40, 0x40, 0x20, 0x7C,   0x1C, 0x20, 0x40, 0x20, 0x1C,
+    0x3C, 0x40, 0x30, 0x40, 0x3C,   0x44, 0x28, 0x10, 0x28, 0x44,   0x0C, 0x50, 0x50, 0x50, 0x3C,
+    0x44, 0x64, 0x54, 0x4C, 0x44,   0x00, 0x08, 0x36, 0x41, 0x00,   0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0x41, 0x36, 0x08, 0x00,   0x08, 0x04, 0x08, 0x10, 0x08,
+};
+
+const Graphics_Font g_sFontFixed6x8 = { 5, 8, 6, ' ', '~', font5x7 };
+const Graphics_Font g_sFontCmss12b  = { 5, 8, 6, ' ', '~', font5x7 };
+const Graphics_Font g_sFontCmsc12   = { 5, 8, 6, ' ', '~', font5x7 };
+const Graphics_Font g_sFontCmsc14   = { 5, 8, 6, ' ', '~', font5x7 };
+
+/**
+ * Initializes a context to draw on the whole of a display, white on black
+ * in the fixed font.
+ */
+void Graphics_initContext(Graphics_Context *context, Graphics_Display *display,
+                          const Graphics_Display_Functions *fxns)
+{
+    context->size = sizeof(Graphics_Context);
+    context->display = display;
+    context->displayFunctions = fxns;
+
+    context->clipRegion.xMin = 0;
+    context->clipRegion.yMin = 0;
+    context->clipRegion.xMax = display->width - 1;
+    context->clipRegion.yMax = display->heigth - 1;
+
+    context->font = &g_sFontFixed6x8;
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_WHITE);
+    Graphics_setBackgroundColor(context, GRAPHICS_COLOR_BLACK);
+}
+
+/** Colors are translated by the driver once, when they are set. */
+void Graphics_setForegroundColor(Graphics_Context *context, int32_t value)
+{
+    context->foreground = context->displayFunctions->pfnColorTranslate(context->display, value);
+}
+
+void Graphics_setBackgroundColor(Graphics_Context *context, int32_t value)
+{
+    context->background = context->displayFunctions->pfnColorTranslate(context->display, value);
+}
+
+void Graphics_setFont(Graphics_Context *context, const Graphics_Font *font)
+{
+    context->font = font;
+}
+
+void Graphics_clearDisplay(const Graphics_Context *context)
+{
+    context->displayFunctions->pfnClearDisplay(context->display, context->background);
+}
+
+void Graphics_flushBuffer(const Graphics_Context *context)
+{
+    context->displayFunctions->pfnFlush(context->display);
+}
+
+/**
+ * Clips a rectangle to the clip region of the context.
+ *
+ * @return false if nothing of the rectangle is left
+ */
+static bool clipRectangle(const Graphics_Context *context, Graphics_Rectangle *rect)
+{
+    const Graphics_Rectangle *clip = &context->clipRegion;
+
+    if (rect->xMin < clip->xMin) rect->xMin = clip->xMin;
+    if (rect->yMin < clip->yMin) rect->yMin = clip->yMin;
+    if (rect->xMax > clip->xMax) rect->xMax = clip->xMax;
+    if (rect->yMax > clip->yMax) rect->yMax = clip->yMax;
+
+    return rect->xMin <= rect->xMax && rect->yMin <= rect->yMax;
+}
+
+void Graphics_drawPixel(const Graphics_Context *context, int32_t x, int32_t y)
+{
+    Graphics_Rectangle rect = { (int16_t) x, (int16_t) y, (int16_t) x, (int16_t) y };
+
+    if (clipRectangle(context, &rect))
+    {
+        context->displayFunctions->pfnPixelDraw(context->display, rect.xMin, rect.yMin,
+                                                context->foreground);
+    }
+}
+
+void Graphics_drawLineH(const Graphics_Context *context, int32_t x1, int32_t x2, int32_t y)
+{
+    Graphics_Rectangle rect = { (int16_t) x1, (int16_t) y, (int16_t) x2, (int16_t) y };
+
+    if (clipRectangle(context, &rect))
+    {
+        context->displayFunctions->pfnLineDrawH(context->display, rect.xMin, rect.xMax, rect.yMin,
+                                                context->foreground);
+    }
+}
+
+void Graphics_drawLineV(const Graphics_Context *context, int32_t x, int32_t y1, int32_t y2)
+{
+    Graphics_Rectangle rect = { (int16_t) x, (int16_t) y1, (int16_t) x, (int16_t) y2 };
+
+    if (clipRectangle(context, &rect))
+    {
+        context->displayFunctions->pfnLineDrawV(context->display, rect.xMin, rect.yMin, rect.yMax,
+                                                context->foreground);
+    }
+}
+
+void Graphics_fillRectangle(const Graphics_Context *context, const Graphics_Rectangle *rect)
+{
+    Graphics_Rectangle clipped = *rect;
+
+    if (clipRectangle(context, &clipped))
+    {
+        context->displayFunctions->pfnRectFill(context->display, &clipped, context->foreground);
+    }
+}
+
+/**
+ * Draws a string with its top left corner at (x, y). Each glyph row is one
+ * 1 bit per pixel run, drawn with PixelDrawMultiple and a two-entry palette
+ * when the background is opaque, and pixel by pixel otherwise. A length of
+ * -1 draws up to the terminating null.
+ */
+void Graphics_drawString(const Graphics_Context *context, int8_t *string, int32_t length,
+                         int32_t x, int32_t y, bool opaque)
+{
+    const Graphics_Font *font = context->font;
+    const Graphics_Rectangle *clip = &context->clipRegion;
+    uint32_t palette[2] = { context->background, context->foreground };
+    int32_t i, row, column;
+
+    if (length < 0)
+    {
+        length = (int32_t) strlen((const char *) string);
+    }
+
+    for (i = 0; i < length; i++, x += font->advance)
+    {
+        uint8_t c = (uint8_t) string[i];
+        const uint8_t *glyph;
+
+        if (c < font->first || c > font->last)
+        {
+            c = ' ';
+        }
+        glyph = &font->glyphs[(c - font->first) * font->width];
+
+        for (row = 0; row < font->height; row++)
+        {
+            uint8_t bits = 0;
+            int32_t start = x, count = font->advance;
+
+            if (y + row < clip->yMin || y + row > clip->yMax)
+            {
+                continue;
+            }
+
+            // Columns beyond the stored glyph width are the spacing column
+            for (column = 0; column < font->width; column++)
+            {
+                bits |= ((glyph[column] >> row) & 1) << (7 - column);
+            }
+
+            if (start < clip->xMin)
+            {
+                count -= clip->xMin - start;
+                start = clip->xMin;
+            }
+            if (start + count - 1 > clip->xMax)
+            {
+                count = clip->xMax - start + 1;
+            }
+            if (count <= 0)
+            {
+                continue;
+            }
+
+            if (opaque)
+            {
+                context->displayFunctions->pfnPixelDrawMultiple(context->display, (int16_t) start,
+                                                                (int16_t) (y + row),
+                                                                (int16_t) (start - x), (int16_t) count,
+                                                                1, &bits, palette);
+            }
+            else
+            {
+                for (column = start - x; column < start - x + count; column++)
+                {
+                    if (bits & (0x80 >> column))
+                    {
+                        context->displayFunctions->pfnPixelDraw(context->display,
+                                                                (int16_t) (x + column),
+                                                                (int16_t) (y + row),
+                                                                context->foreground);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** The width in pixels of a string in the current font. A length of -1 measures up to the terminating null. */
+int32_t Graphics_getStringWidth(const Graphics_Context *context, int8_t *string, int32_t length)
+{
+    if (length < 0)
+    {
+        length = (int32_t) strlen((const char *) string);
+    }
+    return length * context->font->advance;
+}
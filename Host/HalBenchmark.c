@@ -0,0 +1,359 @@
+/*
+ * HalBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Runs the firmware's own HAL sources, including the LCD driver, against the
+ * register-level simulator in Host/Sim and reports what each HAL call costs in
+ * MCLK cycles. Then it checks every baudrate UART_SetBaud_Enable() offers: the
+ * rate the divider tables really produce, and whether characters survive a
+ * round trip to a PC set to the nominal rate. It fails if any of them do not.
+ * Last it has the profiling table of HAL/Profile.c sent over UART as CSV, and
+ * fails unless the PC receives a whole row for every region, which agrees with
+ * the table, and the regions timed so far. Last of all it puts a button on
+ * each port with pin interrupts, and fails unless pressing it wakes the loop.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <HAL/HAL.h>
+#include <Sim/Sim.h>
+
+#define ROUND_TRIP_TEXT     "Wordle"
+#define ROUND_TRIP_LENGTH   (sizeof(ROUND_TRIP_TEXT) - 1)
+
+// How long to wait for the PC to receive the round trip text
+#define RECEIVE_TIMEOUT_MS  100
+
+// Room for the profiling table as CSV, and the number of fields in each of its lines
+#define PROFILE_CSV_SIZE    8192
+#define PROFILE_CSV_FIELDS  (6 + PROFILE_BUCKETS)
+
+static const uint32_t nominalBauds[NUM_BAUD_CHOICES] = { 9600, 19200, 38400, 57600 };
+
+static uint64_t markTime;
+
+static void mark(void)
+{
+    markTime = Sim_now();
+}
+
+static void report(const char* what)
+{
+    uint64_t cycles = Sim_now() - markTime;
+
+    printf("  %-44s %10llu cycles %10.1f us\n", what, (unsigned long long) cycles,
+           cycles * 1e6 / Sim_mclkFrequency());
+}
+
+/** Lets time pass until the PC has received length bytes, or until the timeout. */
+static uint32_t receiveFromBoard(uint8_t* data, uint32_t length)
+{
+    uint64_t deadline = Sim_now() + (uint64_t) Sim_mclkFrequency() * RECEIVE_TIMEOUT_MS / 1000;
+    uint32_t received = 0;
+
+    while (received < length && Sim_now() < deadline)
+    {
+        Sim_advance(SYSTEM_CLOCK / US_DIVISION_FACTOR);
+        received += SimUART_receive(data + received, length - received);
+    }
+    return received;
+}
+
+static void waitForLcd(void)
+{
+    while (!Crystalfontz128x128_TransferDone())
+    {
+        Sim_spin();
+    }
+}
+
+static void measureCalls(HAL* hal)
+{
+    SWTimer timer = SWTimer_construct(10);
+    uint8_t echo[64];
+    int x, y;
+    bool lcdCleared = true;
+
+    printf("HAL call costs (MCLK at %u Hz):\n", Sim_mclkFrequency());
+
+    mark();
+    HAL_refresh(hal);
+    report("HAL_refresh, nothing to draw");
+
+    mark();
+    Button_refresh(&hal->boosterpackS1);
+    report("Button_refresh");
+
+    SWTimer_start(&timer);
+    mark();
+    SWTimer_expired(&timer);
+    report("SWTimer_expired");
+
+    mark();
+    TimerWheel_service();
+    report("TimerWheel_service");
+
+    mark();
+    LED_toggle(&hal->launchpadLED1);
+    report("LED_toggle");
+
+    mark();
+    UART_sendChar(&hal->uart, 'x');
+    report("UART_sendChar");
+
+    mark();
+    UART_sendString(&hal->uart, "0123456789abcdef0123456789abcdef");
+    report("UART_sendString, 32 characters");
+
+    mark();
+    while (UART_txPending(&hal->uart) > 0)
+    {
+        Sim_spin();
+    }
+    report("  then until the transmit buffer is empty");
+    receiveFromBoard(echo, sizeof(echo));
+
+    mark();
+    Graphics_clearDisplay(&hal->g_sContext);
+    report("Graphics_clearDisplay");
+
+    mark();
+    Graphics_flushBuffer(&hal->g_sContext);
+    report("Graphics_flushBuffer, full screen");
+
+    mark();
+    waitForLcd();
+    report("  then until the LCD transfer is done");
+
+    for (y = 0; y < LCD_VERTICAL_MAX; y++)
+    {
+        for (x = 0; x < LCD_HORIZONTAL_MAX; x++)
+        {
+            lcdCleared &= SimLcd_getPixel(x, y) == 0x0000;
+        }
+    }
+
+    mark();
+    Graphics_drawString(&hal->g_sContext, (int8_t*) "HELLO", -1, 10, 10, true);
+    HAL_refresh(hal);
+    waitForLcd();
+    report("Graphics_drawString and flush, 5 letters");
+
+    printf("  LCD panel %s after the clear, %llu SPI bytes sent, %u lost\n",
+           lcdCleared ? "matches" : "DOES NOT match",
+           (unsigned long long) SimSPI_bytesSent(), SimSPI_overwrites());
+}
+
+static bool checkBaudrates(HAL* hal)
+{
+    bool allPassed = true;
+    UART_Baudrate choice;
+
+    printf("UART baudrates:\n");
+
+    for (choice = BAUD_9600; choice < NUM_BAUD_CHOICES; choice++)
+    {
+        uint8_t received[ROUND_TRIP_LENGTH];
+        uint32_t lineErrors = SimUART_lineErrors();
+        uint32_t toBoard = 0, toPc;
+        double actual;
+
+        UART_SetBaud_Enable(&hal->uart, choice);
+        SimUART_setLineBaud(nominalBauds[choice]);
+        actual = SimUART_baudRate();
+
+        // PC to board
+        SimUART_send((const uint8_t*) ROUND_TRIP_TEXT, ROUND_TRIP_LENGTH);
+        while (SimUART_sending() > 0)
+        {
+            Sim_spin();
+        }
+        while (UART_hasChar(&hal->uart))
+        {
+            received[toBoard % ROUND_TRIP_LENGTH] = UART_getChar(&hal->uart);
+            toBoard++;
+        }
+        bool boardOk = toBoard == ROUND_TRIP_LENGTH &&
+                       memcmp(received, ROUND_TRIP_TEXT, ROUND_TRIP_LENGTH) == 0;
+
+        // Board to PC
+        UART_sendString(&hal->uart, ROUND_TRIP_TEXT);
+        toPc = receiveFromBoard(received, ROUND_TRIP_LENGTH);
+        bool pcOk = toPc == ROUND_TRIP_LENGTH && SimUART_lineErrors() == lineErrors &&
+                    memcmp(received, ROUND_TRIP_TEXT, ROUND_TRIP_LENGTH) == 0;
+
+        printf("  %6u: divider gives %9.1f baud (%+.2f%%), PC to board %s, board to PC %s\n",
+               nominalBauds[choice], actual, 100.0 * (actual / nominalBauds[choice] - 1.0),
+               boardOk ? "ok" : "GARBLED", pcOk ? "ok" : "GARBLED");
+
+        allPassed &= boardOk && pcOk;
+    }
+
+    return allPassed;
+}
+
+/**
+ * Puts a button on a spare pin of every port with pin interrupts, P1 to P6,
+ * presses it and checks that the port's interrupt posts EVENT_BUTTON and
+ * the press is seen once it settles. A port with no handler stops the
+ * simulator, as it would hang the board.
+ */
+static bool checkButtonPorts(void)
+{
+    static const uint8_t ports[] = { GPIO_PORT_P1, GPIO_PORT_P2, GPIO_PORT_P3,
+                                     GPIO_PORT_P4, GPIO_PORT_P5, GPIO_PORT_P6 };
+    bool allPassed = true;
+    uint32_t i;
+
+    printf("Button interrupts:\n");
+
+    for (i = 0; i < sizeof(ports) / sizeof(ports[0]); i++)
+    {
+        Button button = Button_construct(ports[i], GPIO_PIN7);
+        bool woke, pressed;
+
+        Event_take();
+        SimGPIO_setInput(ports[i], GPIO_PIN7, false);
+        Sim_advance(Sim_mclkFrequency() / US_DIVISION_FACTOR);
+        woke = (Event_take() & EVENT_BUTTON) != 0;
+
+        Button_refresh(&button);
+        Sim_advance((DEBOUNCE_TIME_MS + 2) * (Sim_mclkFrequency() / MS_DIVISION_FACTOR));
+        TimerWheel_service();
+        Button_refresh(&button);
+        pressed = Button_isPressed(&button);
+        SimGPIO_setInput(ports[i], GPIO_PIN7, true);
+
+        printf("  P%u.7: %s, %s\n", ports[i], woke ? "wakes the loop" : "DOES NOT wake the loop",
+               pressed ? "pressed" : "NOT pressed");
+        allPassed &= woke && pressed;
+    }
+
+    return allPassed;
+}
+
+/** Counts the fields of a line of CSV, and returns the number in the given field. */
+static uint32_t csvFields(const char* line, uint32_t field, unsigned long long* value)
+{
+    uint32_t fields = 1;
+
+    *value = 0;
+    for (; *line != '\0' && *line != '\r'; line++)
+    {
+        if (*line == ',')
+        {
+            fields++;
+        }
+        else if (fields == field + 1 && *line >= '0' && *line <= '9')
+        {
+            *value = *value * 10 + (*line - '0');
+        }
+    }
+    return fields;
+}
+
+/**
+ * Sends the profiling table the way the application does, a little per loop,
+ * and reads it back on the PC: a header and a row per region, each with every
+ * field, and with the count the table has for its region.
+ */
+static bool checkProfileDump(HAL* hal)
+{
+    static char csv[PROFILE_CSV_SIZE];
+    uint32_t length = 0, loops = 0, lines = 0, i;
+    uint64_t start = Sim_now(), elapsed;
+    unsigned long long count;
+    const ProfileStats* refresh = Profile_stats(PROFILE_HAL_REFRESH_INPUTS);
+    const ProfileStats* rectFill = Profile_stats(PROFILE_LCD_RECT_FILL);
+    char* line;
+    bool ok = true;
+
+    printf("Profiling table over UART at %u baud:\n", nominalBauds[BAUD_57600]);
+    printf("  HAL_refreshInputs %lu times, %llu-%llu cycles, mean %llu\n", (unsigned long) refresh->count,
+           (unsigned long long) refresh->min, (unsigned long long) refresh->max,
+           (unsigned long long) (refresh->total / refresh->count));
+
+    UART_SetBaud_Enable(&hal->uart, BAUD_57600);
+    SimUART_setLineBaud(nominalBauds[BAUD_57600]);
+
+    Profile_startDump();
+    while (Profile_dumpStep(&hal->uart) || UART_txPending(&hal->uart) > 0)
+    {
+        Sim_advance(SYSTEM_CLOCK / US_DIVISION_FACTOR * 100);
+        length += SimUART_receive((uint8_t*) csv + length, sizeof(csv) - 1 - length);
+        loops++;
+    }
+    elapsed = Sim_now() - start;
+
+    // The last character is still on the wire once the transmit buffer is empty
+    Sim_advance(SYSTEM_CLOCK / US_DIVISION_FACTOR * 1000);
+    length += SimUART_receive((uint8_t*) csv + length, sizeof(csv) - 1 - length);
+    csv[length] = '\0';
+
+    for (line = csv; *line != '\0'; line = strchr(line, '\n') + 1, lines++)
+    {
+        ok &= csvFields(line, 2, &count) == PROFILE_CSV_FIELDS;
+        if (lines > 0 && lines <= PROFILE_REGIONS)
+        {
+            ok &= strncmp(line, Profile_name(lines - 1), strlen(Profile_name(lines - 1))) == 0
+                  && count == Profile_stats(lines - 1)->count;
+        }
+        if (strchr(line, '\n') == NULL)
+        {
+            ok = false;
+            break;
+        }
+    }
+
+    printf("  %u bytes in %u lines, sent over %u loops of 100 us in %.1f ms, %u dropped: %s\n",
+           length, lines, loops, elapsed * 1e3 / Sim_mclkFrequency(),
+           UART_getTxDropCount(&hal->uart), (ok && lines == PROFILE_REGIONS + 1) ? "ok" : "GARBLED");
+
+    for (i = 0; i < PROFILE_REGIONS; i++)
+    {
+        ok &= Profile_stats(i)->count == 0 || Profile_stats(i)->min <= Profile_stats(i)->max;
+    }
+    return ok && lines == PROFILE_REGIONS + 1 && refresh->count > 0 && rectFill->count > 0
+           && UART_getTxDropCount(&hal->uart) == 0;
+}
+
+int main(void)
+{
+    HAL hal;
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+
+    mark();
+    hal = HAL_construct();
+    report("HAL_construct, including the LCD reset");
+    printf("\n");
+
+    measureCalls(&hal);
+    printf("\n");
+
+    if (!checkBaudrates(&hal))
+    {
+        fprintf(stderr, "UART_SetBaud_Enable() produces a wrong baudrate\n");
+        return EXIT_FAILURE;
+    }
+    printf("\n");
+
+    if (!checkProfileDump(&hal))
+    {
+        fprintf(stderr, "the profiling table did not arrive whole\n");
+        return EXIT_FAILURE;
+    }
+    printf("\n");
+
+    if (!checkButtonPorts())
+    {
+        fprintf(stderr, "a button does not wake the loop on every port with pin interrupts\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
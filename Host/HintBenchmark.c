@@ -0,0 +1,192 @@
+/*
+ * HintBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host benchmark of the hint engine in Wordle/Hint.c. It first runs the search
+ * for the opening guess, the longest one, in HINT_STEP_SCORES steps, the
+ * granules the game's slices are made of, and reports its total time, the
+ * number of steps and the longest step. Then it plays a game against every
+ * ANSWER_STRIDE-th dictionary word, always guessing the hint, and reports how
+ * many guesses the games took and the average search time for each guess.
+ *
+ * Host times are only a guide to the MSP432: a score costs a few dozen
+ * instructions either way, so the number of scores per step is what bounds
+ * how far a slice runs over TASK_SLICE_US on the board.
+ *
+ *   HintBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Wordle/Hint.h>
+#include <Wordle/Dictionary.h>
+#include <Wordle/Candidates.h>
+
+// A game is played against every ANSWER_STRIDE-th dictionary word
+#define ANSWER_STRIDE       57
+
+// The game's number of guesses; a game which needs more is a failure
+#define MAX_GUESSES         6
+
+// A game which has not been solved after this many guesses is given up
+#define PLAY_LIMIT          10
+
+// The feedback code of a guess which is the answer
+#define ALL_CORRECT         (SCORE_NUM_CODES - 1)
+
+struct _SearchTime
+{
+    double totalNs;     // Time of the whole search
+    double maxStepNs;   // Time of the longest Hint_step()
+    uint32_t steps;     // Number of Hint_step() calls
+};
+typedef struct _SearchTime SearchTime;
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Runs a search to the end in steps, the way Application_updateHint()'s slices do, and times it. */
+static SearchTime runSearch(void)
+{
+    SearchTime time = { 0.0, 0.0, 0 };
+    double start = nowNs();
+    bool done = false;
+
+    Hint_start();
+    while (!done)
+    {
+        double stepStart = nowNs();
+        double stepNs;
+
+        done = Hint_step(HINT_STEP_SCORES);
+        stepNs = nowNs() - stepStart;
+
+        time.steps++;
+        if (stepNs > time.maxStepNs)
+        {
+            time.maxStepNs = stepNs;
+        }
+    }
+    time.totalNs = nowNs() - start;
+
+    return time;
+}
+
+int main(void)
+{
+    unsigned char word[SCORE_WORD_LENGTH];
+    uint32_t distribution[MAX_GUESSES + 1] = { 0 };
+    double guessNs[MAX_GUESSES + 1] = { 0.0 };
+    uint32_t guessSearches[MAX_GUESSES + 1] = { 0 };
+    double maxStepNs;
+    uint32_t games = 0, index = 0, failures = 0, guessTotal = 0;
+    DictionaryCursor cursor;
+    PackedWord opener, answer;
+    SearchTime time;
+    int i;
+
+    Dictionary_init();
+
+    Candidates_reset();
+    Hint_reset();
+    time = runSearch();
+    opener = Hint_best();
+    maxStepNs = time.maxStepNs;
+    Score_unpackWord(opener, word);
+
+    printf("Hint engine, %u words, at most %d candidates, %d scores per step:\n",
+           Dictionary_wordCount(), HINT_MAX_CANDIDATES, HINT_STEP_SCORES);
+    printf("  opening hint %.5s, %.2f bits, found in %.1f ms over %u steps, longest step %.1f us\n",
+           word, Hint_bestInformation() / 256.0, time.totalNs / 1e6, time.steps, time.maxStepNs / 1e3);
+
+    if (opener == 0)
+    {
+        fprintf(stderr, "the hint engine found no opening guess\n");
+        return EXIT_FAILURE;
+    }
+
+    cursor = Dictionary_cursor();
+    while (Dictionary_next(&cursor, &answer))
+    {
+        PackedWord guess = opener;
+        int guesses = 1;
+
+        if (index++ % ANSWER_STRIDE != 0)
+        {
+            continue;
+        }
+
+        Candidates_reset();
+        for (;;)
+        {
+            FeedbackCode code = Score_feedback(guess, answer);
+
+            if (code == ALL_CORRECT || guesses == PLAY_LIMIT)
+            {
+                break;
+            }
+
+            Candidates_addFeedback(guess, code);
+            Hint_reset();
+            time = runSearch();
+            guess = Hint_best();
+            guesses++;
+
+            if (guesses <= MAX_GUESSES)
+            {
+                guessNs[guesses] += time.totalNs;
+                guessSearches[guesses]++;
+            }
+            if (time.maxStepNs > maxStepNs)
+            {
+                maxStepNs = time.maxStepNs;
+            }
+
+            // The answer always agrees with its own feedback, so there is always a hint
+            if (guess == 0)
+            {
+                Score_unpackWord(answer, word);
+                fprintf(stderr, "%.5s: the hint engine found no guess\n", word);
+                return EXIT_FAILURE;
+            }
+        }
+
+        games++;
+        guessTotal += guesses;
+        if (guesses > MAX_GUESSES)
+        {
+            failures++;
+        }
+        else
+        {
+            distribution[guesses]++;
+        }
+    }
+
+    printf("  %u games, %.2f guesses on average, %u not solved in %d:", games, (double) guessTotal / games,
+           failures, MAX_GUESSES);
+    for (i = 1; i <= MAX_GUESSES; i++)
+    {
+        printf(" %u", distribution[i]);
+    }
+    printf("\n  average search for guess");
+    for (i = 2; i <= MAX_GUESSES; i++)
+    {
+        if (guessSearches[i] > 0)
+        {
+            printf(" %d: %.2f ms", i, guessNs[i] / guessSearches[i] / 1e6);
+        }
+    }
+    printf("\n  longest step of any search %.1f us\n", maxStepNs / 1e3);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+/*
+ * MakeDecisionTree.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host tool which searches for the decision tree of Analysis/DecisionTree.h
+ * over a feedback matrix written by MakeFeedbackMatrix, with the game's limit
+ * of MAX_GUESSES, and writes it out for the board's hints. It tries the top
+ * DecisionTree_defaults() guesses at each node unless given a number, on one
+ * thread per CPU unless given a number.
+ *
+ * The tree file is text: a comment line starting with '#', then one line per
+ * answer, in the matrix's order, with the guesses the tree makes against it,
+ * the last of which is the answer:
+ *   SALET CRONY CRANE
+ *
+ *   MakeDecisionTree feedback.matrix decision.tree [top [threads]]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+#include <Analysis/DecisionTree.h>
+#include <Analysis/FeedbackMatrix.h>
+
+/** Checks that every path ends in its answer, within the limit, and that it does not pass it on the way. */
+static uint32_t DecisionTree_check(const DecisionTree* tree)
+{
+    const FeedbackMatrix* matrix = tree->matrix;
+    uint32_t wrong = 0, answer, depth;
+
+    for (answer = 0; answer < matrix->answerCount; answer++)
+    {
+        const uint16_t* path = DecisionTree_path(tree, answer);
+        uint32_t guesses = DecisionTree_depth(tree, answer);
+        bool bad = (guesses < 1 || guesses > tree->maxGuesses);
+
+        for (depth = 0; depth < guesses && !bad; depth++)
+        {
+            bool hit = (FeedbackMatrix_code(matrix, path[depth], answer) == SCORE_ALL_GREEN);
+            bad = (hit != (depth == guesses - 1));
+        }
+        wrong += bad;
+    }
+    return wrong;
+}
+
+static bool DecisionTree_write(const DecisionTree* tree, const char* path, uint32_t top)
+{
+    const FeedbackMatrix* matrix = tree->matrix;
+    unsigned char letters[SCORE_WORD_LENGTH];
+    uint32_t answer, depth;
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    fprintf(file, "# %u answers, top %u guesses per node, at most %u guesses: %lu guesses, %.4f on average\n",
+            matrix->answerCount, top, tree->maxGuesses, (unsigned long) tree->totalGuesses,
+            (double) tree->totalGuesses / matrix->answerCount);
+
+    for (answer = 0; answer < matrix->answerCount; answer++)
+    {
+        const uint16_t* guesses = DecisionTree_path(tree, answer);
+
+        for (depth = 0; depth < DecisionTree_depth(tree, answer); depth++)
+        {
+            Score_unpackWord(matrix->guesses[guesses[depth]], letters);
+            fprintf(file, "%s%.*s", depth ? " " : "", SCORE_WORD_LENGTH, (const char*) letters);
+        }
+        fputc('\n', file);
+    }
+
+    return (fclose(file) == 0);
+}
+
+int main(int argc, char** argv)
+{
+    DecisionTreeOptions options = DecisionTree_defaults();
+    DecisionTreeStats stats;
+    DecisionTreeStatus status;
+    DecisionTree tree;
+    FeedbackMatrix matrix;
+    FeedbackMatrixStatus matrixStatus;
+    struct rusage usage;
+    uint32_t histogram[256] = { 0 };
+    unsigned char letters[SCORE_WORD_LENGTH];
+    uint32_t answer, depth, wrong;
+
+    if (argc < 3 || argc > 5)
+    {
+        fprintf(stderr, "usage: %s feedback.matrix decision.tree [top [threads]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc >= 4)
+    {
+        options.topGuesses = (uint32_t) strtoul(argv[3], NULL, 10);
+    }
+    if (argc == 5)
+    {
+        options.threads = (uint32_t) strtoul(argv[4], NULL, 10);
+    }
+
+    matrixStatus = FeedbackMatrix_open(&matrix, argv[1]);
+    if (matrixStatus != FEEDBACK_MATRIX_OK)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], FeedbackMatrix_statusName(matrixStatus));
+        return EXIT_FAILURE;
+    }
+
+    status = DecisionTree_solve(&tree, &matrix, &options, &stats);
+    if (status != DECISION_TREE_OK)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], DecisionTree_statusName(status));
+        FeedbackMatrix_close(&matrix);
+        return EXIT_FAILURE;
+    }
+
+    wrong = DecisionTree_check(&tree);
+    if (wrong > 0 || !DecisionTree_write(&tree, argv[2], options.topGuesses))
+    {
+        fprintf(stderr, wrong ? "%s: %u paths do not end in their answer\n" : "%s: cannot write the tree\n",
+                argv[2], wrong);
+        DecisionTree_free(&tree);
+        FeedbackMatrix_close(&matrix);
+        return EXIT_FAILURE;
+    }
+
+    for (answer = 0; answer < matrix.answerCount; answer++)
+    {
+        histogram[DecisionTree_depth(&tree, answer)]++;
+    }
+    getrusage(RUSAGE_SELF, &usage);
+
+    Score_unpackWord(matrix.guesses[DecisionTree_path(&tree, 0)[0]], letters);
+    printf("%s: %u answers in %lu guesses, %.4f on average, opening with %.*s\n", argv[2], matrix.answerCount,
+           (unsigned long) tree.totalGuesses, (double) tree.totalGuesses / matrix.answerCount, SCORE_WORD_LENGTH,
+           (const char*) letters);
+    printf("  guesses:");
+    for (depth = 1; depth <= tree.maxGuesses; depth++)
+    {
+        printf(" %u:%u", depth, histogram[depth]);
+    }
+    printf("\n  top %u, %u threads: %.2f s, %lu nodes, %.0f nodes/s, %lu memo hits, %lu tasks, %lu stolen\n",
+           options.topGuesses, stats.threads, stats.seconds, (unsigned long) stats.nodes, stats.nodes / stats.seconds,
+           (unsigned long) stats.memoHits, (unsigned long) stats.tasks, (unsigned long) stats.steals);
+    printf("  memo %.1f MB, peak resident %.1f MB\n", stats.memoBytes / 1e6, usage.ru_maxrss / 1e3);
+
+    DecisionTree_free(&tree);
+    FeedbackMatrix_close(&matrix);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,551 @@
+/*
+ * MakeDictionary.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Build-time tool which compiles a word list into the tables of every
+ * dictionary backend: the DAWG of Wordle/DictionaryDawg.c and the packed
+ * differences of Wordle/DictionaryPacked.c, and into the packed words the
+ * candidate bitset of Wordle/CandidatesTables.c checks. See DictionaryDawg.h, DictionaryPacked.h
+ * and CandidatesTables.h for their layouts.
+ *
+ *   MakeDictionary words.txt DictionaryDawg.c DictionaryPacked.c CandidatesTables.c
+ *
+ * The list has one word per line, in either case. Empty lines and lines
+ * starting with '#' are skipped; any other line which is not exactly
+ * SCORE_WORD_LENGTH letters is an error. The tables are only built at that
+ * length; at every other one they are empty, so the game builds without a
+ * dictionary.
+ *
+ * The DAWG is built from the sorted words one depth at a time, deepest
+ * first. A node is its mask and its list of children, and since those
+ * children are already merged, two nodes with the same mask and children
+ * stand for the same set of word endings and become one. A hash table on each
+ * depth finds them.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Wordle/Score.h>
+#include <Wordle/Dictionary.h>
+
+// The game knows which length it has a dictionary at from Dictionary.h
+#if SCORE_WORD_LENGTH != DICTIONARY_WORD_LENGTH
+#error "set DICTIONARY_WORD_LENGTH in Wordle/Dictionary.h to the length of the word list"
+#endif
+
+#define MAX_LINE_LENGTH     64
+
+// The tables index nodes, edges and bytes of differences with 16 bits
+#define MAX_INDEX           0xFFFF
+
+// How many bytes of a packed difference there can be
+#define MAX_DELTA_BYTES     4
+
+struct _Node
+{
+    uint32_t mask;
+    uint32_t firstChild;    // Into the children of its depth, for every depth but the last
+};
+typedef struct _Node Node;
+
+/** The merged nodes of one depth. */
+struct _Depth
+{
+    Node* nodes;
+    uint32_t nodeCount;
+
+    // The children of every node, as indices into the next depth
+    uint32_t* children;
+    uint32_t childCount;
+
+    // Open addressing hash table of node index + 1, 0 for an empty slot
+    uint32_t* table;
+    uint32_t tableSize;
+};
+typedef struct _Depth Depth;
+
+static Depth depths[SCORE_WORD_LENGTH];
+
+static void* allocate(size_t count, size_t size)
+{
+    void* memory = calloc(count ? count : 1, size);
+
+    if (memory == NULL)
+    {
+        fprintf(stderr, "MakeDictionary: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static int comparePacked(const void* a, const void* b)
+{
+    PackedWord x = *(const PackedWord*) a, y = *(const PackedWord*) b;
+
+    return (x > y) - (x < y);
+}
+
+/** Reads, packs, sorts and de-duplicates the word list. Returns the number of words. */
+static uint32_t readWords(const char* path, PackedWord** words_p)
+{
+    FILE* file = fopen(path, "r");
+    char line[MAX_LINE_LENGTH];
+    PackedWord* words = NULL;
+    uint32_t count = 0, capacity = 0, lineNumber = 0, unique, i;
+
+    if (file == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        size_t length = strcspn(line, "\r\n");
+        bool valid = length == SCORE_WORD_LENGTH;
+
+        lineNumber++;
+        line[length] = '\0';
+        if (length == 0 || line[0] == '#')
+        {
+            continue;
+        }
+
+        for (i = 0; i < length && valid; i++)
+        {
+            valid = isalpha((unsigned char) line[i]) != 0;
+        }
+        if (!valid)
+        {
+            fprintf(stderr, "%s:%u: \"%s\" is not a word of %d letters\n", path, lineNumber, line,
+                    SCORE_WORD_LENGTH);
+            exit(EXIT_FAILURE);
+        }
+
+        if (count == capacity)
+        {
+            capacity = capacity ? 2 * capacity : 1024;
+            words = realloc(words, capacity * sizeof(PackedWord));
+            if (words == NULL)
+            {
+                fprintf(stderr, "MakeDictionary: out of memory\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+        words[count++] = Score_packWord((const unsigned char*) line);
+    }
+    fclose(file);
+
+    if (count == 0)
+    {
+        fprintf(stderr, "%s: no words\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    qsort(words, count, sizeof(PackedWord), comparePacked);
+    for (unique = 1, i = 1; i < count; i++)
+    {
+        if (words[i] != words[unique - 1])
+        {
+            words[unique++] = words[i];
+        }
+    }
+
+    *words_p = words;
+    return unique;
+}
+
+static uint32_t hashNode(uint32_t mask, const uint32_t* children, uint32_t childCount)
+{
+    uint32_t hash = mask * 0x9E3779B1u;
+    uint32_t i;
+
+    for (i = 0; i < childCount; i++)
+    {
+        hash = (hash ^ children[i]) * 0x9E3779B1u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+/**
+ * Returns the index of the node with this mask and these children on a depth,
+ * adding it if there is none yet. The children are copied.
+ */
+static uint32_t mergeNode(Depth* depth, uint32_t mask, const uint32_t* children, uint32_t childCount)
+{
+    uint32_t slot = hashNode(mask, children, childCount) & (depth->tableSize - 1);
+
+    while (depth->table[slot] != 0)
+    {
+        Node* node = &depth->nodes[depth->table[slot] - 1];
+
+        if (node->mask == mask &&
+            memcmp(&depth->children[node->firstChild], children, childCount * sizeof(uint32_t)) == 0)
+        {
+            return depth->table[slot] - 1;
+        }
+        slot = (slot + 1) & (depth->tableSize - 1);
+    }
+
+    depth->nodes[depth->nodeCount].mask = mask;
+    depth->nodes[depth->nodeCount].firstChild = depth->childCount;
+    memcpy(&depth->children[depth->childCount], children, childCount * sizeof(uint32_t));
+    depth->childCount += childCount;
+
+    depth->table[slot] = ++depth->nodeCount;
+    return depth->nodeCount - 1;
+}
+
+/** The first letters of a packed word, which every word below a node at that depth shares. */
+static PackedWord prefix(PackedWord word, int length)
+{
+    return word >> (SCORE_BITS_PER_LETTER * (SCORE_WORD_LENGTH - length));
+}
+
+/**
+ * Builds the merged nodes of every depth. groupNodes holds, for each distinct
+ * prefix one letter longer than the current depth, the node it was merged
+ * into; the prefixes of the current depth then collect those as children.
+ */
+static void buildGraph(const PackedWord* words, uint32_t count)
+{
+    uint32_t* groupNodes = allocate(count, sizeof(uint32_t));
+    uint32_t* nextGroupNodes = allocate(count, sizeof(uint32_t));
+    uint32_t children[SCORE_ALPHABET_SIZE];
+    int level;
+
+    for (level = SCORE_WORD_LENGTH - 1; level >= 0; level--)
+    {
+        Depth* depth = &depths[level];
+        uint32_t groups = 0, childGroup = 0, i = 0;
+
+        depth->nodes = allocate(count, sizeof(Node));
+        depth->children = allocate(count, sizeof(uint32_t));
+        for (depth->tableSize = 1; depth->tableSize < 2 * count; depth->tableSize *= 2)
+        {
+        }
+        depth->table = allocate(depth->tableSize, sizeof(uint32_t));
+
+        while (i < count)
+        {
+            PackedWord group = prefix(words[i], level);
+            uint32_t mask = 0, childCount = 0;
+
+            // Every distinct next letter of the prefix is one child
+            while (i < count && prefix(words[i], level) == group)
+            {
+                PackedWord next = prefix(words[i], level + 1);
+
+                mask |= 1u << SCORE_LETTER(words[i], level);
+                if (level < SCORE_WORD_LENGTH - 1)
+                {
+                    children[childCount++] = groupNodes[childGroup++];
+                }
+                while (i < count && prefix(words[i], level + 1) == next)
+                {
+                    i++;
+                }
+            }
+
+            nextGroupNodes[groups++] = mergeNode(depth, mask, children, childCount);
+        }
+
+        uint32_t* swap = groupNodes;
+        groupNodes = nextGroupNodes;
+        nextGroupNodes = swap;
+    }
+
+    free(groupNodes);
+    free(nextGroupNodes);
+}
+
+static void writeTable(FILE* file, const char* declaration, const uint32_t* values, uint32_t count,
+                       const char* format, uint32_t perLine)
+{
+    uint32_t i;
+
+    fprintf(file, "%s[%u] =\n{", declaration, count);
+    for (i = 0; i < count; i++)
+    {
+        fprintf(file, "%s", (i % perLine == 0) ? "\n    " : " ");
+        fprintf(file, format, values[i]);
+        fprintf(file, ",");
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+/**
+ * Creates a generated source file and writes its header comment, which ends
+ * with a summary line, then, for the tables of a dictionary backend, the part
+ * which only builds it for that backend, and the part which only builds the
+ * tables for the word length they are for.
+ */
+static FILE* createSource(const char* path, const char* listPath, const char* backend, const char* summary)
+{
+    const char* fileName = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    const char* listName = strrchr(listPath, '/') ? strrchr(listPath, '/') + 1 : listPath;
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(file, "/*\n");
+    fprintf(file, " * %s\n", fileName);
+    fprintf(file, " *\n");
+    fprintf(file, " * Generated by Host/MakeDictionary from Wordle/%s. Do not edit; run\n", listName);
+    fprintf(file, " * \"make dictionary\" in Host/ after changing the word list.\n");
+    fprintf(file, " *\n");
+    fprintf(file, " * %s\n", summary);
+    fprintf(file, " */\n\n");
+    fprintf(file, "#include <Wordle/%s.h>\n", (backend != NULL) ? "Dictionary" : "Score");
+    fprintf(file, "#include <Wordle/%.*s.h>\n\n", (int) (strlen(fileName) - 2), fileName);
+    if (backend != NULL)
+    {
+        fprintf(file, "#if DICTIONARY_BACKEND == %s\n\n", backend);
+    }
+    fprintf(file, "#if SCORE_WORD_LENGTH == %d\n\n", SCORE_WORD_LENGTH);
+
+    return file;
+}
+
+/**
+ * Closes a generated source file. Built for another word length, it has the
+ * empty tables instead, so the game builds at every length, without a
+ * dictionary (see DICTIONARY_AVAILABLE).
+ */
+static void closeSource(FILE* file, const char* path, const char* backend, const char* emptyTables)
+{
+    fprintf(file, "\n#else\n\n");
+    fprintf(file, "// Generated for %d-letter words: no words at any other length\n\n", SCORE_WORD_LENGTH);
+    fprintf(file, "%s", emptyTables);
+    fprintf(file, "\n#endif\n");
+    if (backend != NULL)
+    {
+        fprintf(file, "\n#endif\n");
+    }
+
+    if (fclose(file) != 0)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void writeDawgSource(const char* path, const char* listPath, uint32_t wordCount)
+{
+    uint32_t depthStart[SCORE_WORD_LENGTH + 1];
+    uint32_t edgeStart[SCORE_WORD_LENGTH];
+    uint32_t nodeCount, innerCount, edgeCount, flashBytes;
+    uint32_t *masks, *firstEdges, *edges;
+    char summary[MAX_LINE_LENGTH];
+    FILE* file;
+    int level;
+    uint32_t i;
+
+    depthStart[0] = 0;
+    edgeStart[0] = 0;
+    for (level = 0; level < SCORE_WORD_LENGTH; level++)
+    {
+        depthStart[level + 1] = depthStart[level] + depths[level].nodeCount;
+        if (level + 1 < SCORE_WORD_LENGTH)
+        {
+            edgeStart[level + 1] = edgeStart[level] + depths[level].childCount;
+        }
+    }
+    nodeCount = depthStart[SCORE_WORD_LENGTH];
+    innerCount = depthStart[SCORE_WORD_LENGTH - 1];
+    edgeCount = edgeStart[SCORE_WORD_LENGTH - 1];
+
+    if (nodeCount - 1 > MAX_INDEX || edgeCount > MAX_INDEX)
+    {
+        fprintf(stderr, "MakeDictionary: %u nodes and %u edges do not fit 16-bit indices\n",
+                nodeCount, edgeCount);
+        exit(EXIT_FAILURE);
+    }
+
+    masks = allocate(nodeCount, sizeof(uint32_t));
+    firstEdges = allocate(innerCount, sizeof(uint32_t));
+    edges = allocate(edgeCount, sizeof(uint32_t));
+
+    for (level = 0; level < SCORE_WORD_LENGTH; level++)
+    {
+        const Depth* depth = &depths[level];
+
+        for (i = 0; i < depth->nodeCount; i++)
+        {
+            masks[depthStart[level] + i] = depth->nodes[i].mask;
+            if (level < SCORE_WORD_LENGTH - 1)
+            {
+                firstEdges[depthStart[level] + i] = edgeStart[level] + depth->nodes[i].firstChild;
+            }
+        }
+        for (i = 0; i < depth->childCount && level < SCORE_WORD_LENGTH - 1; i++)
+        {
+            edges[edgeStart[level] + i] = depthStart[level + 1] + depth->children[i];
+        }
+    }
+
+    flashBytes = nodeCount * sizeof(uint32_t) + (innerCount + edgeCount) * sizeof(uint16_t);
+
+    snprintf(summary, sizeof(summary), "%u words, %u nodes, %u edges, %u bytes.",
+             wordCount, nodeCount, edgeCount, flashBytes);
+    file = createSource(path, listPath, "DICTIONARY_DAWG", summary);
+
+    writeTable(file, "const uint32_t DictionaryDawg_masks", masks, nodeCount, "0x%07X", 8);
+    writeTable(file, "const uint16_t DictionaryDawg_firstEdge", firstEdges, innerCount, "%5u", 12);
+    writeTable(file, "const uint16_t DictionaryDawg_edges", edges, edgeCount, "%5u", 12);
+
+    fprintf(file, "const uint32_t DictionaryDawg_wordCount = %u;\n", wordCount);
+    fprintf(file, "const uint32_t DictionaryDawg_flashBytes = %u;\n", flashBytes);
+
+    closeSource(file, path, "DICTIONARY_DAWG",
+                "const uint32_t DictionaryDawg_masks[1] = { 0 };\n"
+                "const uint16_t DictionaryDawg_firstEdge[1] = { 0 };\n"
+                "const uint16_t DictionaryDawg_edges[1] = { 0 };\n\n"
+                "const uint32_t DictionaryDawg_wordCount = 0;\n"
+                "const uint32_t DictionaryDawg_flashBytes = 0;\n");
+
+    printf("%s: %u words, %u nodes (", path, wordCount, nodeCount);
+    for (level = 0; level < SCORE_WORD_LENGTH; level++)
+    {
+        printf("%s%u", level ? " + " : "", depths[level].nodeCount);
+    }
+    printf("), %u edges, %u bytes of flash\n", edgeCount, flashBytes);
+
+    free(masks);
+    free(firstEdges);
+    free(edges);
+}
+
+/** Writes the difference of a word from the one before it, most significant seven bits first. */
+static uint32_t encodeDelta(uint32_t delta, uint32_t* bytes)
+{
+    uint32_t groups[MAX_DELTA_BYTES];
+    uint32_t count = 0, i;
+
+    do
+    {
+        groups[count++] = delta & 0x7F;
+        delta >>= 7;
+    } while (delta != 0);
+
+    for (i = 0; i < count; i++)
+    {
+        bytes[i] = groups[count - 1 - i] | ((i < count - 1) ? 0x80 : 0);
+    }
+    return count;
+}
+
+static void writePackedSource(const char* path, const char* listPath, const PackedWord* words, uint32_t wordCount)
+{
+    uint32_t* deltas = allocate(wordCount, MAX_DELTA_BYTES * sizeof(uint32_t));
+    uint32_t byteCount = 0, i;
+    char summary[MAX_LINE_LENGTH];
+    FILE* file;
+
+    for (i = 0; i < wordCount; i++)
+    {
+        byteCount += encodeDelta(words[i] - (i ? words[i - 1] : 0), &deltas[byteCount]);
+    }
+
+    // The SRAM index keeps the offsets of differences in 16 bits
+    if (byteCount > MAX_INDEX)
+    {
+        fprintf(stderr, "MakeDictionary: %u bytes of differences do not fit 16-bit offsets\n", byteCount);
+        exit(EXIT_FAILURE);
+    }
+
+    snprintf(summary, sizeof(summary), "%u words, %u bytes.", wordCount, byteCount);
+    file = createSource(path, listPath, "DICTIONARY_PACKED", summary);
+
+    fprintf(file, "#define WORD_COUNT      %u\n", wordCount);
+    fprintf(file, "#define INDEX_ENTRIES   ((WORD_COUNT + DICTIONARY_PACKED_STRIDE - 1) / DICTIONARY_PACKED_STRIDE)\n\n");
+
+    writeTable(file, "const uint8_t DictionaryPacked_deltas", deltas, byteCount, "0x%02X", 12);
+
+    fprintf(file, "const uint32_t DictionaryPacked_wordCount = WORD_COUNT;\n");
+    fprintf(file, "const uint32_t DictionaryPacked_flashBytes = %u;\n\n", byteCount);
+
+    fprintf(file, "// Filled in by Dictionary_init()\n");
+    fprintf(file, "uint32_t DictionaryPacked_indexWords[INDEX_ENTRIES];\n");
+    fprintf(file, "uint16_t DictionaryPacked_indexOffsets[INDEX_ENTRIES];\n");
+    fprintf(file, "const uint32_t DictionaryPacked_indexEntries = INDEX_ENTRIES;\n");
+
+    closeSource(file, path, "DICTIONARY_PACKED",
+                "const uint8_t DictionaryPacked_deltas[1] = { 0 };\n\n"
+                "const uint32_t DictionaryPacked_wordCount = 0;\n"
+                "const uint32_t DictionaryPacked_flashBytes = 0;\n\n"
+                "uint32_t DictionaryPacked_indexWords[1];\n"
+                "uint16_t DictionaryPacked_indexOffsets[1];\n"
+                "const uint32_t DictionaryPacked_indexEntries = 0;\n");
+
+    printf("%s: %u words, %u bytes of flash (%.2f bytes/word)\n", path, wordCount, byteCount,
+           (double) byteCount / wordCount);
+
+    free(deltas);
+}
+
+static void writeCandidatesSource(const char* path, const char* listPath, const PackedWord* words, uint32_t wordCount)
+{
+    uint32_t bitsetWords = (wordCount + 31) / 32;
+    uint32_t flashBytes = wordCount * (uint32_t) sizeof(PackedWord);
+    char summary[MAX_LINE_LENGTH];
+    FILE* file;
+    uint32_t i;
+
+    snprintf(summary, sizeof(summary), "%u words, %u bytes of flash, %u bytes of SRAM.",
+             wordCount, flashBytes, bitsetWords * (uint32_t) sizeof(uint32_t));
+    file = createSource(path, listPath, NULL, summary);
+
+    fprintf(file, "#define BITSET_WORDS    %u\n\n", bitsetWords);
+
+    fprintf(file, "const PackedWord CandidatesTables_words[%u] =\n{", wordCount);
+    for (i = 0; i < wordCount; i++)
+    {
+        fprintf(file, "%s0x%07llX,", (i % 6 == 0) ? "\n    " : " ", (unsigned long long) words[i]);
+    }
+    fprintf(file, "\n};\n\n");
+
+    fprintf(file, "const uint32_t CandidatesTables_wordCount = %u;\n", wordCount);
+    fprintf(file, "const uint32_t CandidatesTables_bitsetWords = BITSET_WORDS;\n\n");
+
+    fprintf(file, "// Filled in by Candidates_reset()\n");
+    fprintf(file, "uint32_t CandidatesTables_live[BITSET_WORDS];\n");
+
+    closeSource(file, path, NULL,
+                "const PackedWord CandidatesTables_words[1] = { 0 };\n\n"
+                "const uint32_t CandidatesTables_wordCount = 0;\n"
+                "const uint32_t CandidatesTables_bitsetWords = 0;\n\n"
+                "uint32_t CandidatesTables_live[1];\n");
+
+    printf("%s: %u words, %u bytes of flash, %u bytes of SRAM\n", path, wordCount, flashBytes,
+           bitsetWords * (uint32_t) sizeof(uint32_t));
+}
+
+int main(int argc, char** argv)
+{
+    PackedWord* words;
+    uint32_t count;
+
+    if (argc != 5)
+    {
+        fprintf(stderr, "usage: %s words.txt DictionaryDawg.c DictionaryPacked.c CandidatesTables.c\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    count = readWords(argv[1], &words);
+    buildGraph(words, count);
+    writeDawgSource(argv[2], argv[1], count);
+    writePackedSource(argv[3], argv[1], words, count);
+    writeCandidatesSource(argv[4], argv[1], words, count);
+
+    free(words);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/*
+ * MakeFeedbackMatrix.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host tool which writes the feedback matrix file of Analysis/FeedbackMatrix.h
+ * for the game's dictionary: every dictionary word is both a guess and a
+ * possible answer, as in proj1_main.c. The rows are split across threads,
+ * one per CPU unless a number is given, and scored with Analysis/BatchScore.c.
+ *
+ *   MakeFeedbackMatrix feedback.matrix [threads]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Analysis/BatchScore.h>
+#include <Analysis/FeedbackMatrix.h>
+#include <Wordle/Dictionary.h>
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char** argv)
+{
+    DictionaryCursor cursor;
+    FeedbackMatrixStatus status;
+    PackedWord* words;
+    PackedWord word;
+    uint32_t count = 0, threads = 0;
+    double start, elapsed;
+
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "usage: %s feedback.matrix [threads]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 3)
+    {
+        threads = (uint32_t) strtoul(argv[2], NULL, 10);
+    }
+
+    Dictionary_init();
+    words = malloc(Dictionary_wordCount() * sizeof(PackedWord));
+    if (words == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    cursor = Dictionary_cursor();
+    while (Dictionary_next(&cursor, &word))
+    {
+        words[count++] = word;
+    }
+
+    start = nowNs();
+    status = FeedbackMatrix_create(argv[1], words, count, words, count, threads);
+    elapsed = nowNs() - start;
+
+    if (status != FEEDBACK_MATRIX_OK)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], FeedbackMatrix_statusName(status));
+        free(words);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s: %u x %u cells in %.1f ms with %s, %.1f M scores/s\n", argv[1], count, count, elapsed / 1e6,
+           BatchScore_name(BatchScore_isa()), (double) count * count / elapsed * 1e3);
+
+    free(words);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,397 @@
+/*
+ * MakeStrategy.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Build-time tool which compiles a decision tree written by MakeDecisionTree
+ * into the flash tables of Wordle/StrategyTables.c. See StrategyTables.h for
+ * their layout.
+ *
+ *   MakeStrategy decision.tree StrategyTables.c
+ *
+ * Every line of the tree file but comments is the guesses the tree makes
+ * against one answer, which is the last of them. The lines are merged into a
+ * tree by the feedback each guess gets from its line's answer; two lines
+ * which get the same feedback must make the same next guess. The nodes are
+ * numbered breadth first, so every node comes after its parent.
+ *
+ * The tables are for the word length MakeStrategy is built for. A game built
+ * for another length gets an empty tree instead, which Strategy_init() turns
+ * down, so its hints are all searched for.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Wordle/Score.h>
+
+// The tables keep a feedback code in a byte and a word in the 31 bits below STRATEGY_LEAF
+#if SCORE_NUM_CODES > 256 || SCORE_WORD_LENGTH * SCORE_BITS_PER_LETTER > 31
+#error "the strategy tables only hold words of up to 5 letters"
+#endif
+
+#define MAX_LINE_LENGTH     256
+
+// The game's number of guesses, MAX_GUESSES in Application.h
+#define MAX_GUESSES         6
+
+// The tables index edges with 16 bits
+#define MAX_INDEX           0xFFFF
+
+#define FNV_OFFSET_BASIS    0x811C9DC5u
+#define FNV_PRIME           0x01000193u
+
+// Set in an edge target which is an answer's packed word, as in StrategyTables.h
+#define STRATEGY_LEAF       0x80000000u
+
+#define NO_CHILD            (-1)
+
+struct _BuildNode
+{
+    PackedWord guess;
+    int32_t children[SCORE_NUM_CODES];
+    uint32_t childCount;
+    uint32_t index;         // Its number in the tables, if it has children or is the root
+    bool answered;          // Some line ends here
+};
+typedef struct _BuildNode BuildNode;
+
+static BuildNode* nodes = NULL;
+static uint32_t nodeCount = 0;
+static uint32_t nodeCapacity = 0;
+
+static void fail(const char* path, uint32_t line, const char* message)
+{
+    fprintf(stderr, "%s:%u: %s\n", path, line, message);
+    exit(EXIT_FAILURE);
+}
+
+static int32_t newNode(PackedWord guess)
+{
+    BuildNode* node;
+    int code;
+
+    if (nodeCount == nodeCapacity)
+    {
+        nodeCapacity = nodeCapacity ? nodeCapacity * 2 : 1024;
+        nodes = realloc(nodes, nodeCapacity * sizeof(BuildNode));
+        if (nodes == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    node = &nodes[nodeCount];
+    node->guess = guess;
+    node->childCount = 0;
+    node->index = 0;
+    node->answered = false;
+    for (code = 0; code < SCORE_NUM_CODES; code++)
+    {
+        node->children[code] = NO_CHILD;
+    }
+    return (int32_t) nodeCount++;
+}
+
+/** Splits a line into packed words. Returns how many there are, or -1 if one is not a word. */
+static int parseLine(char* line, PackedWord* words)
+{
+    char* token;
+    int count = 0;
+    int i;
+
+    for (token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n"))
+    {
+        if (count == MAX_GUESSES || strlen(token) != SCORE_WORD_LENGTH)
+        {
+            return -1;
+        }
+        for (i = 0; i < SCORE_WORD_LENGTH; i++)
+        {
+            if (!isalpha((unsigned char) token[i]))
+            {
+                return -1;
+            }
+        }
+        words[count++] = Score_packWord((const unsigned char*) token);
+    }
+    return count;
+}
+
+/** Merges one answer's guesses into the tree. Returns an error message, or NULL. */
+static const char* addPath(const PackedWord* words, int count)
+{
+    PackedWord answer = words[count - 1];
+    int32_t node;
+    int depth;
+
+    if (nodeCount == 0)
+    {
+        newNode(words[0]);
+    }
+    if (nodes[0].guess != words[0])
+    {
+        return "opens with a different guess than the lines before";
+    }
+
+    node = 0;
+    for (depth = 0; depth + 1 < count; depth++)
+    {
+        FeedbackCode code = Score_feedback(words[depth], answer);
+        int32_t child;
+
+        if (code == SCORE_ALL_GREEN)
+        {
+            return "guesses its answer before the end of the line";
+        }
+
+        child = nodes[node].children[code];
+        if (child == NO_CHILD)
+        {
+            child = newNode(words[depth + 1]);
+            nodes[node].children[code] = child;
+            nodes[node].childCount++;
+        }
+        else if (nodes[child].guess != words[depth + 1])
+        {
+            return "makes a different guess than a line with the same feedback";
+        }
+        node = child;
+    }
+
+    if (nodes[node].answered)
+    {
+        return "the answer is on an earlier line too";
+    }
+    nodes[node].answered = true;
+    return NULL;
+}
+
+static uint32_t checksum(uint32_t hash, uint32_t value, int bytes)
+{
+    int i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        hash = (hash ^ ((value >> (8 * i)) & 0xFF)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void writeTable(FILE* file, const char* declaration, const uint32_t* values, uint32_t count,
+                       const char* format, uint32_t perLine)
+{
+    uint32_t i;
+
+    fprintf(file, "%s[%u] =\n{", declaration, count);
+    for (i = 0; i < count; i++)
+    {
+        fprintf(file, "%s", (i % perLine == 0) ? "\n    " : " ");
+        fprintf(file, format, values[i]);
+        fprintf(file, ",");
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+int main(int argc, char** argv)
+{
+    char line[MAX_LINE_LENGTH];
+    char summary[MAX_LINE_LENGTH];
+    PackedWord words[MAX_GUESSES];
+    uint32_t *order, *guesses, *firstEdges, *codes, *targets;
+    uint32_t lineNumber = 0, answers = 0, totalGuesses = 0;
+    uint32_t tableNodes = 0, edgeCount = 0, flashBytes, hash = FNV_OFFSET_BASIS;
+    uint32_t i, code;
+    const char* fileName;
+    FILE* file;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s decision.tree StrategyTables.c\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    file = fopen(argv[1], "r");
+    if (file == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        const char* error;
+        int count;
+
+        lineNumber++;
+        if (line[0] == '#')
+        {
+            continue;
+        }
+
+        count = parseLine(line, words);
+        if (count < 0)
+        {
+            fail(argv[1], lineNumber, "not a line of words, or more than MAX_GUESSES of them");
+        }
+        if (count == 0)
+        {
+            continue;
+        }
+
+        error = addPath(words, count);
+        if (error != NULL)
+        {
+            fail(argv[1], lineNumber, error);
+        }
+        answers++;
+        totalGuesses += count;
+    }
+    fclose(file);
+
+    if (answers == 0)
+    {
+        fail(argv[1], lineNumber, "no answers");
+    }
+
+    // Numbers the root and every node with children breadth first; the others are leaves
+    order = malloc(nodeCount * sizeof(uint32_t));
+    guesses = malloc(nodeCount * sizeof(uint32_t));
+    firstEdges = malloc((nodeCount + 1) * sizeof(uint32_t));
+    codes = malloc(nodeCount * sizeof(uint32_t));
+    targets = malloc(nodeCount * sizeof(uint32_t));
+    if (order == NULL || guesses == NULL || firstEdges == NULL || codes == NULL || targets == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    order[tableNodes++] = 0;
+    for (i = 0; i < tableNodes; i++)
+    {
+        BuildNode* node = &nodes[order[i]];
+
+        for (code = 0; code < SCORE_NUM_CODES; code++)
+        {
+            int32_t child = node->children[code];
+
+            if (child != NO_CHILD && nodes[child].childCount > 0)
+            {
+                nodes[child].index = tableNodes;
+                order[tableNodes++] = (uint32_t) child;
+            }
+        }
+    }
+
+    for (i = 0; i < tableNodes; i++)
+    {
+        BuildNode* node = &nodes[order[i]];
+
+        guesses[i] = node->guess;
+        firstEdges[i] = edgeCount;
+        for (code = 0; code < SCORE_NUM_CODES; code++)
+        {
+            int32_t child = node->children[code];
+
+            if (child != NO_CHILD)
+            {
+                codes[edgeCount] = code;
+                targets[edgeCount] = (nodes[child].childCount > 0) ? nodes[child].index
+                                                                   : (STRATEGY_LEAF | nodes[child].guess);
+                edgeCount++;
+            }
+        }
+    }
+    firstEdges[tableNodes] = edgeCount;
+
+    if (edgeCount > MAX_INDEX)
+    {
+        fprintf(stderr, "%s: %u edges, more than a 16-bit index holds\n", argv[1], edgeCount);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < tableNodes; i++)
+    {
+        hash = checksum(hash, guesses[i], 4);
+    }
+    for (i = 0; i <= tableNodes; i++)
+    {
+        hash = checksum(hash, firstEdges[i], 2);
+    }
+    for (i = 0; i < edgeCount; i++)
+    {
+        hash = checksum(hash, codes[i], sizeof(FeedbackCode));
+    }
+    for (i = 0; i < edgeCount; i++)
+    {
+        hash = checksum(hash, targets[i], 4);
+    }
+
+    flashBytes = tableNodes * 4 + (tableNodes + 1) * 2 + edgeCount * (1 + 4);
+    snprintf(summary, sizeof(summary), "%u answers, %u nodes, %u edges, %u bytes; %.4f guesses on average.", answers,
+             tableNodes, edgeCount, flashBytes, (double) totalGuesses / answers);
+
+    fileName = strrchr(argv[2], '/') ? strrchr(argv[2], '/') + 1 : argv[2];
+    file = fopen(argv[2], "w");
+    if (file == NULL)
+    {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file, "/*\n");
+    fprintf(file, " * %s\n", fileName);
+    fprintf(file, " *\n");
+    fprintf(file, " * Generated by Host/MakeStrategy from a tree of Host/MakeDecisionTree. Do not\n");
+    fprintf(file, " * edit; run \"make strategy\" in Host/ after changing the word list.\n");
+    fprintf(file, " *\n");
+    fprintf(file, " * %s\n", summary);
+    fprintf(file, " */\n\n");
+    fprintf(file, "#include <Wordle/StrategyTables.h>\n\n");
+    fprintf(file, "#if SCORE_WORD_LENGTH == %d\n\n", SCORE_WORD_LENGTH);
+
+    writeTable(file, "const uint32_t StrategyTables_guesses", guesses, tableNodes, "0x%07X", 8);
+    writeTable(file, "const uint16_t StrategyTables_firstEdges", firstEdges, tableNodes + 1, "%5u", 12);
+    writeTable(file, "const FeedbackCode StrategyTables_codes", codes, edgeCount, "%3u", 16);
+    writeTable(file, "const uint32_t StrategyTables_targets", targets, edgeCount, "0x%08X", 8);
+
+    fprintf(file, "const uint32_t StrategyTables_nodeCount = %u;\n", tableNodes);
+    fprintf(file, "const uint32_t StrategyTables_edgeCount = %u;\n", edgeCount);
+    fprintf(file, "const uint32_t StrategyTables_wordCount = %u;\n", answers);
+    fprintf(file, "const uint32_t StrategyTables_totalGuesses = %u;\n", totalGuesses);
+    fprintf(file, "const uint32_t StrategyTables_flashBytes = %u;\n", flashBytes);
+    fprintf(file, "const uint32_t StrategyTables_checksum = 0x%08X;\n", hash);
+
+    fprintf(file, "\n#else\n\n");
+    fprintf(file, "// Solved for %d-letter words: no tree, so Strategy_init() turns the strategy off\n\n",
+            SCORE_WORD_LENGTH);
+    fprintf(file, "const uint32_t StrategyTables_guesses[1] = { 0 };\n");
+    fprintf(file, "const uint16_t StrategyTables_firstEdges[1] = { 0 };\n");
+    fprintf(file, "const FeedbackCode StrategyTables_codes[1] = { 0 };\n");
+    fprintf(file, "const uint32_t StrategyTables_targets[1] = { 0 };\n\n");
+    fprintf(file, "const uint32_t StrategyTables_nodeCount = 0;\n");
+    fprintf(file, "const uint32_t StrategyTables_edgeCount = 0;\n");
+    fprintf(file, "const uint32_t StrategyTables_wordCount = 0;\n");
+    fprintf(file, "const uint32_t StrategyTables_totalGuesses = 0;\n");
+    fprintf(file, "const uint32_t StrategyTables_flashBytes = 0;\n");
+    fprintf(file, "const uint32_t StrategyTables_checksum = 0x%08X;\n", FNV_OFFSET_BASIS);
+    fprintf(file, "\n#endif\n");
+
+    if (fclose(file) != 0)
+    {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s: %s\n", argv[2], summary);
+
+    free(order);
+    free(guesses);
+    free(firstEdges);
+    free(codes);
+    free(targets);
+    free(nodes);
+    return EXIT_SUCCESS;
+}
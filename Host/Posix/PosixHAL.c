@@ -0,0 +1,772 @@
+/*
+ * PosixHAL.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A Linux implementation of everything HAL.h promises, so proj1_main.c can be
+ * built and played on a PC without a Launchpad:
+ *
+ *   - UART:    characters are read from stdin and written to stdout, or from a
+ *              pseudo-terminal when WORDLE_PTY is set, so a serial terminal
+ *              program can be pointed at it like at the XDS110 port.
+ *   - LCD:     grlib draws into the framebuffer in PosixLcd.c. When WORDLE_PPM
+ *              is set, the screen is written there as a PPM when the game exits.
+ *   - Buttons: some control keys in the input stand for button taps, so a game
+ *              can be scripted as one stream of characters:
+ *                  Enter   Boosterpack S1      Ctrl-A  Launchpad S1
+ *                  Tab     Boosterpack S2      Ctrl-S  Launchpad S2
+ *                  Ctrl-X  Boosterpack joystick button
+ *              Ctrl-P, like on the board, dumps the profiling table as CSV.
+ *   - Timers:  Clock_cycles() counts 48 MHz "cycles" derived from CLOCK_MONOTONIC,
+ *              for SWTimers and the timer wheel in HAL/TimerWheel.c.
+ *   - Sleep:   HAL_sleep() blocks in poll() until there is input or the next
+ *              timer on the wheel is due, where the board sleeps in LPM0.
+ *              Input waiting posts EVENT_UART_RX and EVENT_BUTTON, for the
+ *              scheduler in HAL/Scheduler.c.
+ *
+ * Input is handed out in order: a tap only happens once every character in
+ * front of it has been read by the application, and once the application has
+ * looked for a character since the tap before, so that it has taken that tap.
+ * When the input ends and everything in it has been handled, the program
+ * exits.
+ *
+ * A headless HAL (see PosixHAL.h) has no console: its input is fed in by the
+ * program and its UART output is only counted.
+ */
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <HAL/Clock.h>
+#include <HAL/HAL.h>
+#include <Posix/PosixHAL.h>
+#include <Posix/PosixLcd.h>
+
+#define KEY_CTRL_A          0x01
+#define KEY_CTRL_S          0x13
+#define KEY_CTRL_X          0x18
+
+// Size of the queue of input characters and taps which have not been handed out yet
+#define INPUT_QUEUE_SIZE    4096
+
+/** The file descriptors UART characters are read from and written to. */
+static int inputFd = STDIN_FILENO;
+static FILE* output = NULL;
+
+/** Whether the program feeds the input itself, and how many characters the application sent. */
+static bool headless = false;
+static uint64_t charsSent = 0;
+
+/** The input which has been read but not handed out yet. */
+static char inputQueue[INPUT_QUEUE_SIZE];
+static uint32_t inputHead = 0;
+static uint32_t inputTail = 0;
+static bool inputEnded = false;
+
+/** Whether the application has looked for a character since the last tap was handed out. */
+static bool inputLooked = true;
+
+/** The terminal settings to restore on exit, if stdin was put into raw mode. */
+static struct termios savedTermios;
+static bool restoreTermios = false;
+
+/** The state of every GPIO output and input pin, indexed by port. Inputs idle high, like pulled-up buttons. */
+static uint16_t pinOutputs[GPIO_NUM_PORTS + 1];
+static uint16_t pinInputs[GPIO_NUM_PORTS + 1];
+
+/** The CLOCK_MONOTONIC time at which InitSystemTiming() was called. */
+static struct timespec timingStart;
+
+/** The baud rate most recently selected with UART_SetBaud_Enable(). */
+static UART_Baudrate currentBaud = BAUD_9600;
+
+// -----------------------------------------------------------------------------
+// Input
+// -----------------------------------------------------------------------------
+
+static bool Input_isEmpty()
+{
+    return inputHead == inputTail;
+}
+
+static char Input_peek()
+{
+    return inputQueue[inputTail % INPUT_QUEUE_SIZE];
+}
+
+static char Input_pop()
+{
+    return inputQueue[inputTail++ % INPUT_QUEUE_SIZE];
+}
+
+/**
+ * Moves whatever input is available into the queue. If there is none, waits up
+ * to timeout milliseconds for some, or for ever if timeout is negative.
+ */
+static void Input_poll(int timeout)
+{
+    struct pollfd pfd = { inputFd, POLLIN, 0 };
+
+    while (!inputEnded && inputHead - inputTail < INPUT_QUEUE_SIZE && poll(&pfd, 1, timeout) > 0)
+    {
+        char data[256];
+        uint32_t space = INPUT_QUEUE_SIZE - (inputHead - inputTail);
+        ssize_t count = read(inputFd, data, space < sizeof(data) ? space : sizeof(data));
+        ssize_t i;
+
+        if (count <= 0)
+        {
+            inputEnded = true;
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            inputQueue[inputHead++ % INPUT_QUEUE_SIZE] = data[i];
+        }
+        timeout = 0;
+    }
+}
+
+/** Returns the button input pin which a key taps, or false if the key is an ordinary character. */
+static bool Input_keyToButton(char key, uint8_t* port, uint16_t* pin)
+{
+    switch (key)
+    {
+        case '\n':
+        case '\r':
+            *port = BOOSTERPACK_S1_PORT;
+            *pin = BOOSTERPACK_S1_PIN;
+            return true;
+        case '\t':
+            *port = BOOSTERPACK_S2_PORT;
+            *pin = BOOSTERPACK_S2_PIN;
+            return true;
+        case KEY_CTRL_X:
+            *port = BOOSTERPACK_JS_PORT;
+            *pin = BOOSTERPACK_JS_PIN;
+            return true;
+        case KEY_CTRL_A:
+            *port = LAUNCHPAD_S1_PORT;
+            *pin = LAUNCHPAD_S1_PIN;
+            return true;
+        case KEY_CTRL_S:
+            *port = LAUNCHPAD_S2_PORT;
+            *pin = LAUNCHPAD_S2_PIN;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Puts the terminal back the way we found it and writes out the screen if asked to. */
+static void Posix_exit()
+{
+    const char* ppmPath = getenv("WORDLE_PPM");
+
+    if (output != NULL)
+    {
+        fflush(output);
+    }
+    if (restoreTermios)
+    {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &savedTermios);
+    }
+    if (ppmPath != NULL && !PosixLcd_dumpPPM(ppmPath))
+    {
+        perror(ppmPath);
+    }
+}
+
+/**
+ * Chooses where UART characters come from and go to. With WORDLE_PTY set, a
+ * pseudo-terminal is opened and its name printed on stderr. Otherwise stdin
+ * and stdout are used, and a terminal on stdin is switched to raw mode so that
+ * every key, including the control keys that stand for buttons, arrives as
+ * soon as it is typed.
+ */
+static void Posix_openConsole()
+{
+    struct termios raw;
+
+    if (getenv("WORDLE_PTY") != NULL)
+    {
+        int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+        if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+        {
+            perror("posix_openpt");
+            exit(EXIT_FAILURE);
+        }
+
+        if (tcgetattr(master, &raw) == 0)
+        {
+            cfmakeraw(&raw);
+            tcsetattr(master, TCSANOW, &raw);
+        }
+
+        fprintf(stderr, "UART on %s\n", ptsname(master));
+        inputFd = master;
+        output = fdopen(master, "w");
+    }
+    else
+    {
+        output = stdout;
+
+        if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &savedTermios) == 0)
+        {
+            raw = savedTermios;
+            raw.c_lflag &= ~(ICANON | ECHO);
+            raw.c_iflag &= ~(IXON | ICRNL);
+            raw.c_cc[VMIN] = 1;
+            raw.c_cc[VTIME] = 0;
+            tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+            restoreTermios = true;
+        }
+    }
+
+    atexit(Posix_exit);
+}
+
+void PosixHAL_setHeadless(void)
+{
+    headless = true;
+}
+
+uint32_t PosixHAL_feed(const char* input, uint32_t length)
+{
+    uint32_t count = 0;
+
+    while (count < length && inputHead - inputTail < INPUT_QUEUE_SIZE)
+    {
+        inputQueue[inputHead++ % INPUT_QUEUE_SIZE] = input[count++];
+    }
+    return count;
+}
+
+bool PosixHAL_inputDone(void)
+{
+    return Input_isEmpty();
+}
+
+uint64_t PosixHAL_charsSent(void)
+{
+    return charsSent;
+}
+
+// -----------------------------------------------------------------------------
+// HAL
+// -----------------------------------------------------------------------------
+
+void InitGraphics(Graphics_Context *g_sContext_p);
+
+HAL HAL_construct()
+{
+    HAL hal;
+
+    if (!headless)
+    {
+        Posix_openConsole();
+    }
+
+    Profile_init();
+
+    hal.launchpadLED1 = LED_construct(LAUNCHPAD_LED1_PORT, LAUNCHPAD_LED1_PIN);
+
+    hal.launchpadLED2Red   = LED_construct(LAUNCHPAD_LED2_RED_PORT  , LAUNCHPAD_LED2_RED_PIN  );
+    hal.launchpadLED2Green = LED_construct(LAUNCHPAD_LED2_GREEN_PORT, LAUNCHPAD_LED2_GREEN_PIN);
+    hal.launchpadLED2Blue  = LED_construct(LAUNCHPAD_LED2_BLUE_PORT , LAUNCHPAD_LED2_BLUE_PIN );
+
+    hal.boosterpackRed   = LED_construct(BOOSTERPACK_LED_RED_PORT  , BOOSTERPACK_LED_RED_PIN  );
+    hal.boosterpackGreen = LED_construct(BOOSTERPACK_LED_GREEN_PORT, BOOSTERPACK_LED_GREEN_PIN);
+    hal.boosterpackBlue  = LED_construct(BOOSTERPACK_LED_BLUE_PORT , BOOSTERPACK_LED_BLUE_PIN );
+
+    hal.launchpadS1 = Button_construct(LAUNCHPAD_S1_PORT, LAUNCHPAD_S1_PIN);
+    hal.launchpadS2 = Button_construct(LAUNCHPAD_S2_PORT, LAUNCHPAD_S2_PIN);
+
+    hal.boosterpackS1 = Button_construct(BOOSTERPACK_S1_PORT, BOOSTERPACK_S1_PIN);
+    hal.boosterpackS2 = Button_construct(BOOSTERPACK_S2_PORT, BOOSTERPACK_S2_PIN);
+    hal.boosterpackJS = Button_construct(BOOSTERPACK_JS_PORT, BOOSTERPACK_JS_PIN);
+
+    hal.uart = UART_construct(USB_UART_INSTANCE, USB_UART_PORT, USB_UART_PINS);
+    UART_SetBaud_Enable(&hal.uart, BAUD_9600);
+
+    InitGraphics(&hal.g_sContext);
+
+    return hal;
+}
+
+/**
+ * Reads new input. Once the input has ended and all of it has been handled,
+ * the last tap included, the program exits.
+ */
+static void Posix_readInput()
+{
+    if (!headless)
+    {
+        fflush(output);
+        Input_poll(0);
+
+        if (inputEnded && Input_isEmpty() && inputLooked)
+        {
+            exit(EXIT_SUCCESS);
+        }
+    }
+}
+
+/**
+ * Releases every button and, if the next thing in the input is a tap, holds
+ * that button down for this one refresh.
+ */
+static void Posix_refreshButtons(HAL* hal)
+{
+    uint8_t port;
+    uint16_t pin;
+
+    TimerWheel_service();
+
+    pinInputs[LAUNCHPAD_S1_PORT]   |= LAUNCHPAD_S1_PIN;
+    pinInputs[LAUNCHPAD_S2_PORT]   |= LAUNCHPAD_S2_PIN;
+    pinInputs[BOOSTERPACK_S1_PORT] |= BOOSTERPACK_S1_PIN;
+    pinInputs[BOOSTERPACK_S2_PORT] |= BOOSTERPACK_S2_PIN;
+    pinInputs[BOOSTERPACK_JS_PORT] |= BOOSTERPACK_JS_PIN;
+
+    if (inputLooked && !Input_isEmpty() && Input_keyToButton(Input_peek(), &port, &pin))
+    {
+        Input_pop();
+        pinInputs[port] &= ~pin;
+        inputLooked = false;
+    }
+
+    Button_refresh(&hal->launchpadS1);
+    Button_refresh(&hal->launchpadS2);
+
+    Button_refresh(&hal->boosterpackS1);
+    Button_refresh(&hal->boosterpackS2);
+    Button_refresh(&hal->boosterpackJS);
+}
+
+void HAL_refresh(HAL* hal)
+{
+    HAL_refreshInputs(hal);
+    DisplayList_step(&hal->g_sContext, UINT64_MAX);
+    Graphics_flushBuffer(&hal->g_sContext);
+}
+
+void HAL_refreshInputs(HAL* hal)
+{
+    Posix_readInput();
+
+    PROFILE_BEGIN(PROFILE_HAL_REFRESH_INPUTS);
+    Posix_refreshButtons(hal);
+    PROFILE_END(PROFILE_HAL_REFRESH_INPUTS);
+}
+
+/** The framebuffer is in memory and costs nothing to send, so it all goes at once. */
+bool HAL_flushStep(HAL* hal)
+{
+    PROFILE_BEGIN(PROFILE_HAL_FLUSH_STEP);
+    Graphics_flushBuffer(&hal->g_sContext);
+    PROFILE_END(PROFILE_HAL_FLUSH_STEP);
+    return false;
+}
+
+/**
+ * A character at the front of the input signals the UART, and a tap there the
+ * buttons, once the refresh would hand it out. The end of the input signals
+ * the buttons, so that the next refresh exits.
+ */
+EventSet HAL_takeEvents(HAL* hal)
+{
+    EventSet events = (TimerWheel_cyclesUntilDue() == 0) ? EVENT_TIMER : 0;
+    uint8_t port;
+    uint16_t pin;
+
+    (void) hal;
+
+    if (!headless)
+    {
+        Input_poll(0);
+    }
+    if (Input_isEmpty())
+    {
+        events |= (inputEnded && inputLooked) ? EVENT_BUTTON : 0;
+    }
+    else if (!Input_keyToButton(Input_peek(), &port, &pin))
+    {
+        events |= EVENT_UART_RX;
+    }
+    else if (inputLooked)
+    {
+        events |= EVENT_BUTTON;
+    }
+    return events;
+}
+
+/**
+ * Waits for input, but only as long as the timer wheel has nothing due, and
+ * never while input is still waiting to be handed out. The wait is timed as
+ * PROFILE_SLEEP, like the board's time in LPM0.
+ */
+EventSet HAL_sleep(HAL* hal)
+{
+    uint64_t until = TimerWheel_cyclesUntilDue();
+    int timeout;
+
+    if (headless || !Input_isEmpty() || until == 0)
+    {
+        return HAL_takeEvents(hal);
+    }
+
+    fflush(output);
+    timeout = (until == TIMER_WHEEL_IDLE) ? -1 : (int) ((Clock_toUs(until) + 999) / 1000);
+
+    PROFILE_BEGIN(PROFILE_SLEEP);
+    Input_poll(timeout);
+    PROFILE_END(PROFILE_SLEEP);
+
+    return HAL_takeEvents(hal);
+}
+
+void InitGraphics(Graphics_Context *g_sContext_p)
+{
+    Graphics_initContext(g_sContext_p, &g_sCrystalfontz128x128, &g_sCrystalfontz128x128_funcs);
+    Graphics_setForegroundColor(g_sContext_p, GRAPHICS_COLOR_WHITE);
+    Graphics_setBackgroundColor(g_sContext_p, GRAPHICS_COLOR_BLACK);
+    Graphics_setFont(g_sContext_p, &g_sFontFixed6x8);
+
+    Graphics_clearDisplay(g_sContext_p);
+    Graphics_flushBuffer(g_sContext_p);
+}
+
+// -----------------------------------------------------------------------------
+// LEDs and Buttons
+// -----------------------------------------------------------------------------
+
+LED LED_construct(uint8_t port, uint16_t pin)
+{
+    LED led;
+
+    led.isLit = false;
+    led.port  = port;
+    led.pin   = pin;
+
+    GPIO_setAsOutputPin(led.port, led.pin);
+    GPIO_setOutputLowOnPin(led.port, led.pin);
+
+    return led;
+}
+
+void LED_turnOn(LED* led)
+{
+    led->isLit = true;
+    GPIO_setOutputHighOnPin(led->port, led->pin);
+}
+
+void LED_turnOff(LED* led)
+{
+    led->isLit = false;
+    GPIO_setOutputLowOnPin(led->port, led->pin);
+}
+
+void LED_toggle(LED* led)
+{
+    led->isLit = !led->isLit;
+    GPIO_toggleOutputOnPin(led->port, led->pin);
+}
+
+bool LED_isLit(LED* led)
+{
+    return led->isLit;
+}
+
+Button Button_construct(uint8_t port, uint16_t pin)
+{
+    Button button;
+
+    button.port = port;
+    button.pin = pin;
+    button.debounceState = StableR;
+    button.timer = WheelTimer_construct(NULL);
+    button.pushState = RELEASED;
+    button.isTapped = false;
+    button.tapLatched = false;
+
+    GPIO_setAsInputPinWithPullUpResistor(port, pin);
+
+    return button;
+}
+
+bool Button_isPressed(Button* button)
+{
+    return button->pushState == PRESSED;
+}
+
+bool Button_isTapped(Button* button)
+{
+    return button->isTapped;
+}
+
+bool Button_takeTap(Button* button)
+{
+    bool tapped = button->tapLatched;
+
+    button->tapLatched = false;
+    return tapped;
+}
+
+/**
+ * Key presses never bounce, so there is nothing to debounce: a button counts
+ * as tapped in the one cycle HAL_refreshInputs() holds its pin low.
+ */
+void Button_refresh(Button* button)
+{
+    button->pushState = GPIO_getInputPinValue(button->port, button->pin);
+    button->debounceState = button->pushState == PRESSED ? StableP : StableR;
+    button->isTapped = button->pushState == PRESSED;
+    button->tapLatched = button->tapLatched || button->isTapped;
+}
+
+// -----------------------------------------------------------------------------
+// UART
+// -----------------------------------------------------------------------------
+
+UART UART_construct(uint32_t moduleInstance, uint32_t port, uint32_t pins)
+{
+    UART uart;
+
+    memset(&uart, 0, sizeof(uart));
+    uart.moduleInstance = moduleInstance;
+    uart.port = port;
+    uart.pins = pins;
+
+    return uart;
+}
+
+/** There is no line to clock, so only the choice is remembered. */
+void UART_SetBaud_Enable(UART *uart_p, UART_Baudrate baudrate)
+{
+    (void) uart_p;
+
+    currentBaud = baudrate;
+}
+
+void UART_updateBaud(UART* uart_p, UART_Baudrate baudChoice)
+{
+    UART_SetBaud_Enable(uart_p, baudChoice);
+}
+
+/** Only a character at the front of the input counts; a tap in front of it has to happen first. */
+bool UART_hasChar(UART* uart_p)
+{
+    uint8_t port;
+    uint16_t pin;
+
+    (void) uart_p;
+
+    inputLooked = true;
+    return !Input_isEmpty() && !Input_keyToButton(Input_peek(), &port, &pin);
+}
+
+char UART_getChar(UART* uart_p)
+{
+    return UART_hasChar(uart_p) ? Input_pop() : 0;
+}
+
+bool UART_canSend(UART* uart_p)
+{
+    (void) uart_p;
+
+    return true;
+}
+
+void UART_sendChar(UART* uart_p, char c)
+{
+    (void) uart_p;
+
+    charsSent++;
+    if (!headless)
+    {
+        fputc(c, output);
+    }
+}
+
+uint32_t UART_sendBytes(UART* uart_p, const uint8_t* data, uint32_t length)
+{
+    (void) uart_p;
+
+    charsSent += length;
+    return headless ? length : fwrite(data, 1, length, output);
+}
+
+uint32_t UART_sendString(UART* uart_p, const char* string)
+{
+    return UART_sendBytes(uart_p, (const uint8_t*) string, strlen(string));
+}
+
+uint32_t UART_getOverrunCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return 0;
+}
+
+uint32_t UART_getRxDropCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return 0;
+}
+
+uint32_t UART_txPending(UART* uart_p)
+{
+    (void) uart_p;
+
+    return 0;
+}
+
+uint32_t UART_getTxHighWater(UART* uart_p)
+{
+    (void) uart_p;
+
+    return 0;
+}
+
+uint32_t UART_getTxDropCount(UART* uart_p)
+{
+    (void) uart_p;
+
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Timers
+// -----------------------------------------------------------------------------
+
+void Clock_init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &timingStart);
+}
+
+/** The time since Clock_init() in cycles of the 48 MHz system clock. CLOCK_MONOTONIC has no rollovers to race with. */
+uint64_t Clock_cycles(void)
+{
+    struct timespec now;
+    uint64_t ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = (uint64_t) (now.tv_sec - timingStart.tv_sec) * 1000000000u
+       + (uint64_t) now.tv_nsec - (uint64_t) timingStart.tv_nsec;
+
+    return Clock_fromNs(ns);
+}
+
+void InitSystemTiming()
+{
+    Clock_init();
+}
+
+SWTimer SWTimer_construct(uint64_t waitTime_ms)
+{
+    SWTimer timer;
+
+    timer.startCycles = 0;
+    timer.cyclesToWait = Clock_fromMs(waitTime_ms);
+    timer.percentPerCycle = (timer.cyclesToWait == 0) ? 0 : CLOCK_Q32(100, timer.cyclesToWait);
+
+    return timer;
+}
+
+void SWTimer_start(SWTimer* timer_p)
+{
+    timer_p->startCycles = Clock_cycles();
+}
+
+uint64_t SWTimer_elapsedCycles(SWTimer* timer_p)
+{
+    return Clock_cycles() - timer_p->startCycles;
+}
+
+bool SWTimer_expired(SWTimer* timer_p)
+{
+    return SWTimer_elapsedCycles(timer_p) >= timer_p->cyclesToWait;
+}
+
+uint64_t SWTimer_elapsedTimeUS(SWTimer* timer_p)
+{
+    return Clock_toUs(SWTimer_elapsedCycles(timer_p));
+}
+
+double SWTimer_percentElapsed(SWTimer* timer_p)
+{
+    if (timer_p->cyclesToWait == 0) {
+        return 1.0;
+    }
+
+    double result = (double) SWTimer_elapsedCycles(timer_p) / (double) timer_p->cyclesToWait;
+
+    return (result > 1.0) ? 1.0 : result;
+}
+
+uint32_t SWTimer_percentElapsedInt(SWTimer* timer_p)
+{
+    uint64_t elapsedCycles = SWTimer_elapsedCycles(timer_p);
+
+    return (elapsedCycles >= timer_p->cyclesToWait) ? 100 : (uint32_t) Clock_scale(elapsedCycles, timer_p->percentPerCycle);
+}
+
+// -----------------------------------------------------------------------------
+// driverlib
+// -----------------------------------------------------------------------------
+
+void WDT_A_holdTimer(void)
+{
+}
+
+void GPIO_setAsOutputPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    (void) selectedPort;
+    (void) selectedPins;
+}
+
+void GPIO_setAsInputPinWithPullUpResistor(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    pinInputs[selectedPort] |= selectedPins;
+}
+
+void GPIO_setAsPeripheralModuleFunctionOutputPin(uint_fast8_t selectedPort,
+                                                 uint_fast16_t selectedPins, uint_fast8_t mode)
+{
+    (void) selectedPort;
+    (void) selectedPins;
+    (void) mode;
+}
+
+void GPIO_setOutputHighOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    pinOutputs[selectedPort] |= selectedPins;
+}
+
+void GPIO_setOutputLowOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    pinOutputs[selectedPort] &= ~selectedPins;
+}
+
+void GPIO_toggleOutputOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    pinOutputs[selectedPort] ^= selectedPins;
+}
+
+uint8_t GPIO_getInputPinValue(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    return (pinInputs[selectedPort] & selectedPins) ? GPIO_INPUT_PIN_HIGH : GPIO_INPUT_PIN_LOW;
+}
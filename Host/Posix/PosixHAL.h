@@ -0,0 +1,31 @@
+/*
+ * PosixHAL.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Extras of the POSIX HAL for programs which drive the game themselves rather
+ * than through a terminal, such as benchmarks.
+ */
+
+#ifndef POSIX_POSIXHAL_H_
+#define POSIX_POSIXHAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Makes the HAL headless. Must be called before HAL_construct(). No console is
+// opened and nothing is printed; input only comes from PosixHAL_feed(), and the
+// program keeps running when it runs out.
+void PosixHAL_setHeadless(void);
+
+// Appends characters to the input, with the same control keys for button taps as
+// a terminal. Returns how many fit into the input queue.
+uint32_t PosixHAL_feed(const char* input, uint32_t length);
+
+// Returns whether all input has been handed out to the application
+bool PosixHAL_inputDone(void);
+
+// Returns how many characters the application has sent over the UART
+uint64_t PosixHAL_charsSent(void);
+
+#endif /* POSIX_POSIXHAL_H_ */
@@ -0,0 +1,198 @@
+/*
+ * PosixLcd.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host display backend. It defines g_sCrystalfontz128x128 and
+ * g_sCrystalfontz128x128_funcs, the names HAL.c hands to grlib, so that every
+ * drawing call lands in an in-memory framebuffer instead of going over SPI.
+ */
+
+#include <stdio.h>
+
+#include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
+#include <HAL/Profile.h>
+#include <Posix/PosixLcd.h>
+
+/** The screen, indexed [y][x], in RGB565. */
+static uint16_t framebuffer[LCD_VERTICAL_MAX][LCD_HORIZONTAL_MAX];
+
+/** The number of primitives drawn, so benchmarks can relate time to drawing work. */
+static uint64_t primitives = 0;
+
+static void PosixLcd_pixelDraw(const Graphics_Display *pDisplay, int16_t lX, int16_t lY,
+                               uint16_t ulValue)
+{
+    (void) pDisplay;
+
+    framebuffer[lY][lX] = ulValue;
+    primitives++;
+}
+
+/**
+ * Draws a run of pixels. Like the LCD driver, 1 bit per pixel data uses the
+ * two translated palette entries and 16 bit per pixel data is native RGB565.
+ */
+static void PosixLcd_pixelDrawMultiple(const Graphics_Display *pDisplay, int16_t lX, int16_t lY,
+                                       int16_t lX0, int16_t lCount, int16_t lBPP,
+                                       const uint8_t *pucData, const uint32_t *pucPalette)
+{
+    int16_t i;
+
+    (void) pDisplay;
+
+    PROFILE_BEGIN(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
+
+    for (i = 0; i < lCount && lX + i < LCD_HORIZONTAL_MAX; i++)
+    {
+        uint16_t bit = (uint16_t) (lX0 + i) * lBPP;
+
+        switch (lBPP)
+        {
+            case 1:
+                framebuffer[lY][lX + i] = pucPalette[(pucData[bit >> 3] >> (7 - (bit & 7))) & 1];
+                break;
+            case 4:
+                framebuffer[lY][lX + i] = pucPalette[(pucData[bit >> 3] >> (4 - (bit & 7))) & 15];
+                break;
+            case 8:
+                framebuffer[lY][lX + i] = pucPalette[pucData[i]];
+                break;
+            case 16:
+                framebuffer[lY][lX + i] = ((const uint16_t *) pucData)[i];
+                break;
+        }
+    }
+    primitives++;
+    PROFILE_END(PROFILE_LCD_PIXEL_DRAW_MULTIPLE);
+}
+
+static void PosixLcd_lineDrawH(const Graphics_Display *pDisplay, int16_t lX1, int16_t lX2,
+                               int16_t lY, uint16_t ulValue)
+{
+    int16_t x;
+
+    (void) pDisplay;
+
+    for (x = lX1; x <= lX2; x++)
+    {
+        framebuffer[lY][x] = ulValue;
+    }
+    primitives++;
+}
+
+static void PosixLcd_lineDrawV(const Graphics_Display *pDisplay, int16_t lX, int16_t lY1,
+                               int16_t lY2, uint16_t ulValue)
+{
+    int16_t y;
+
+    (void) pDisplay;
+
+    for (y = lY1; y <= lY2; y++)
+    {
+        framebuffer[y][lX] = ulValue;
+    }
+    primitives++;
+}
+
+static void PosixLcd_rectFill(const Graphics_Display *pDisplay, const Graphics_Rectangle *pRect,
+                              uint16_t ulValue)
+{
+    int16_t x, y;
+
+    (void) pDisplay;
+
+    PROFILE_BEGIN(PROFILE_LCD_RECT_FILL);
+
+    for (y = pRect->sYMin; y <= pRect->sYMax; y++)
+    {
+        for (x = pRect->sXMin; x <= pRect->sXMax; x++)
+        {
+            framebuffer[y][x] = ulValue;
+        }
+    }
+    primitives++;
+    PROFILE_END(PROFILE_LCD_RECT_FILL);
+}
+
+/** The same 24-bit RGB to RGB565 translation as the LCD driver. */
+static uint32_t PosixLcd_colorTranslate(const Graphics_Display *pDisplay, uint32_t ulValue)
+{
+    (void) pDisplay;
+
+    return ((ulValue & 0x00f80000) >> 8) |
+           ((ulValue & 0x0000fc00) >> 5) |
+           ((ulValue & 0x000000f8) >> 3);
+}
+
+static void PosixLcd_flush(const Graphics_Display *pDisplay)
+{
+    (void) pDisplay;
+}
+
+static void PosixLcd_clearScreen(const Graphics_Display *pDisplay, uint16_t ulValue)
+{
+    Graphics_Rectangle rect = { 0, 0, LCD_HORIZONTAL_MAX - 1, LCD_VERTICAL_MAX - 1 };
+    PosixLcd_rectFill(pDisplay, &rect, ulValue);
+}
+
+Graphics_Display g_sCrystalfontz128x128 =
+{
+    sizeof(Graphics_Display),
+    0,
+    LCD_VERTICAL_MAX,
+    LCD_HORIZONTAL_MAX,
+};
+
+const Graphics_Display_Functions g_sCrystalfontz128x128_funcs =
+{
+    PosixLcd_pixelDraw,
+    PosixLcd_pixelDrawMultiple,
+    PosixLcd_lineDrawH,
+    PosixLcd_lineDrawV,
+    PosixLcd_rectFill,
+    PosixLcd_colorTranslate,
+    PosixLcd_flush,
+    PosixLcd_clearScreen
+};
+
+uint16_t PosixLcd_getPixel(int x, int y)
+{
+    return framebuffer[y][x];
+}
+
+uint64_t PosixLcd_primitiveCount(void)
+{
+    return primitives;
+}
+
+/**
+ * Writes the framebuffer as a binary (P6) PPM, expanding each RGB565 channel
+ * to 8 bits by repeating its top bits.
+ */
+bool PosixLcd_dumpPPM(const char* path)
+{
+    FILE* file = fopen(path, "wb");
+    int x, y;
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", LCD_HORIZONTAL_MAX, LCD_VERTICAL_MAX);
+    for (y = 0; y < LCD_VERTICAL_MAX; y++)
+    {
+        for (x = 0; x < LCD_HORIZONTAL_MAX; x++)
+        {
+            uint16_t pixel = framebuffer[y][x];
+            uint8_t r = (pixel >> 11) & 0x1F, g = (pixel >> 5) & 0x3F, b = pixel & 0x1F;
+
+            fputc((r << 3) | (r >> 2), file);
+            fputc((g << 2) | (g >> 4), file);
+            fputc((b << 3) | (b >> 2), file);
+        }
+    }
+
+    return fclose(file) == 0;
+}
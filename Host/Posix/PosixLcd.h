@@ -0,0 +1,27 @@
+/*
+ * PosixLcd.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host display backend: a 128x128 RGB565 framebuffer in memory, standing in
+ * for the Crystalfontz LCD so the game's grlib calls can be inspected.
+ */
+
+#ifndef POSIX_POSIXLCD_H_
+#define POSIX_POSIXLCD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <ti/grlib/grlib.h>
+
+// Returns the RGB565 value of a pixel
+uint16_t PosixLcd_getPixel(int x, int y);
+
+// Writes the screen to a binary PPM file. Returns false if the file could not be written.
+bool PosixLcd_dumpPPM(const char* path);
+
+// Returns how many driver primitives have been called since the program started
+uint64_t PosixLcd_primitiveCount(void);
+
+#endif /* POSIX_POSIXLCD_H_ */
@@ -0,0 +1,678 @@
+/*
+ * SchedulerBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check of the run-to-completion scheduler in HAL/Scheduler.c with the
+ * game's own tasks: proj1_main.c with its main() renamed, built from the
+ * firmware's HAL against the simulator in Sim/, and scheduled by
+ * Application_schedule() with the priorities and budgets from Application.h.
+ * The benchmark plays Absurdle at 57600 baud the way a quick player would.
+ * Each guess after the first asks the joystick for a hint, so a hint search is
+ * running while the guess is typed in one burst, and S1 then has the board
+ * judge it. The first guess of a game asks for the profiling table with
+ * Ctrl-P as well. Throughout, bouncy presses of the LaunchPad S1 button, which
+ * the game leaves alone, come in.
+ *
+ * The simulator charges only for the hardware, so the benchmark charges for
+ * the game's own work. Before the run, it times each call into the Wordle
+ * engine or grlib that does more than a few instructions, over many calls in
+ * the host's CPU time, and turns that into M4 cycles: per score of a hint
+ * step, per word of an Absurdle step, per chunk of a narrowing step, per call
+ * of the others, per pixel of a fill and per character of a string. Through
+ * --wrap, each of these calls during the run is charged that cost as it
+ * returns, so the slices stop on Clock_cycles() as they do on the board, the
+ * display list's drawing is charged to the render task, and a run with the
+ * same seed and costs charges the same. The costs are printed with the result.
+ *
+ * The target is that a character, or an edge of a button, is handled within
+ * one character time of arriving. A character is timed from when the
+ * simulator delivers it to when the game reads it, and an edge to when the
+ * input task next refreshes the buttons; the benchmark sees both through the
+ * linker's --wrap. It fails if either misses the target, if a task runs over
+ * its budget, if a press is missed or counted twice, a character is lost or
+ * wrong, no character is read during a hint search or no input is handled
+ * during a judgement, a profiling table does not go out, or the LCD has not
+ * been sent everything drawn once the input stops.
+ *
+ *   SchedulerBenchmark [seconds] [seed] [M4 cycles per host ns]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Application.h>
+#include <HAL/HAL.h>
+#include <Sim/Sim.h>
+#include <Sim/SimStimulus.h>
+
+#define DEFAULT_SECONDS     10
+#define DEFAULT_SEED        2026
+
+// The M4 cycles charged for a nanosecond of the host's CPU time: the M4 runs about an instruction a cycle at 48 MHz,
+// where a host core at a few GHz runs several a cycle
+#define DEFAULT_CYCLES_PER_NS   8.0
+
+// How often the charged calls are timed before the run, the most steps or draws timed at a time, and the guess
+#define CALIBRATE_ROUNDS    9
+#define CALIBRATE_CALLS     1000
+#define CALIBRATE_GUESS     "RAISE"
+
+// Presses of the LaunchPad S1 button: the gap between them and how long they are held
+#define PRESS_GAP_MS        100, 1000
+#define PRESS_HOLD_MS       30, 300
+
+// The player: how long a press of S1 or the joystick is held, how long after a release the player waits before
+// anything else, which is longer than the debounce, how long after typing a guess S1 is pressed, and how long after
+// the feedback the joystick is
+#define PLAYER_HOLD_MS      40, 120
+#define PLAYER_RELEASE_MS   (DEBOUNCE_TIME_MS + 10)
+#define PLAYER_SUBMIT_MS    5, 50
+#define PLAYER_HINT_MS      0, 40
+#define LINE_BAUD           57600
+
+// How long the player waits for the hint search to start before typing anyway, and looks at the result
+#define HINT_WAIT_MS        100
+#define RESULT_MS           200
+
+// How often the player looks at the game, and how long the tasks may take to finish once the input stops
+#define PLAYER_TICK_MS      5
+#define DRAIN_MS            (HINT_BUDGET_MS + 1000)
+
+static HAL hal;
+static Application app;
+static uint64_t cyclesPerMs;
+static uint64_t cyclesPerUs;
+static double cyclesPerHostNs;
+
+/** What the run measured. */
+static struct
+{
+    uint32_t presses, taps;
+    uint32_t charsSent, charsReceived, charErrors, charsLost;
+    uint64_t charLatencyMax, edgeLatencyMax;
+    uint32_t charsWhileHinting, inputsWhileJudging;
+    uint32_t games, guesses, dumps;
+} run;
+
+// The calls of the game that the benchmark charges for, as they do more than a few instructions
+enum _Charged
+{
+    CHARGED_HINT_STEP,                  // Per score
+    CHARGED_ABSURDLE_STEP,              // Per dictionary word visited
+    CHARGED_CANDIDATES_STEP,            // Per chunk
+    CHARGED_HINT_START,
+    CHARGED_ABSURDLE_START,
+    CHARGED_ABSURDLE_ANSWER,
+    CHARGED_CANDIDATES_START,
+    CHARGED_DICTIONARY_CONTAINS,
+    CHARGED_FILL,                       // Per pixel
+    CHARGED_STRING,                     // Per character
+    CHARGED_COUNT
+};
+typedef enum _Charged Charged;
+
+/** The cost of each kind of call, in M4 cycles per unit, and what was charged for it. */
+static struct
+{
+    const char* name;
+    double cycles;
+    uint32_t calls;
+    uint64_t total, longest;
+} charges[CHARGED_COUNT] =
+{
+    { "Hint_step", 0, 0, 0, 0 }, { "Absurdle_step", 0, 0, 0, 0 }, { "Candidates_step", 0, 0, 0, 0 },
+    { "Hint_start", 0, 0, 0, 0 }, { "Absurdle_start", 0, 0, 0, 0 }, { "Absurdle_answer", 0, 0, 0, 0 },
+    { "Candidates_startFeedback", 0, 0, 0, 0 }, { "Dictionary_contains", 0, 0, 0, 0 },
+    { "Graphics_fillRectangle", 0, 0, 0, 0 }, { "Graphics_drawString", 0, 0, 0, 0 }
+};
+
+// What the player does next
+enum _PlayerStep
+{
+    PLAYER_START,       // Presses S1 on the title screen
+    PLAYER_STARTING,    // Waits for the game screen
+    PLAYER_HINT,        // Presses the joystick, or starts a new game once this one is over
+    PLAYER_TYPE,        // Waits for the hint search to start, then types the guess
+    PLAYER_SUBMIT,      // Waits for the guess to be read, then presses S1
+    PLAYER_JUDGED,      // Waits for the board's feedback
+    PLAYER_OVER         // Looks at the result, then starts a new game
+};
+typedef enum _PlayerStep PlayerStep;
+
+static struct
+{
+    PlayerStep step;
+    uint64_t waitUntil;     // Nothing is done before this
+    GuessAmount guess;      // The guess being judged
+} player;
+
+static WheelTimer playerTimer;
+static bool inputStopped = false;
+
+// The functions the game calls which the benchmark stands in front of, with -Wl,--wrap
+char __real_UART_getChar(UART* uart_p);
+void __real_HAL_refreshInputs(HAL* hal_p);
+
+/** Checks and times every character the game reads. */
+char __wrap_UART_getChar(UART* uart_p)
+{
+    char data = __real_UART_getChar(uart_p);
+    uint64_t latency;
+
+    run.charErrors += !SimStimulus_checkChar(data, &latency);
+    run.charsReceived++;
+    run.charLatencyMax = (latency > run.charLatencyMax) ? latency : run.charLatencyMax;
+    run.charsWhileHinting += app.hinting && !app.narrowing;
+    return data;
+}
+
+/** Times the first edge since the input task last refreshed the buttons. */
+void __wrap_HAL_refreshInputs(HAL* hal_p)
+{
+    uint64_t start = Sim_now();
+    uint64_t edgeTime;
+
+    // An edge which came after the task sampled the pins waits for its next run
+    if (SimStimulus_takeEdge(start, &edgeTime))
+    {
+        uint64_t latency = start - edgeTime;
+
+        run.edgeLatencyMax = (latency > run.edgeLatencyMax) ? latency : run.edgeLatencyMax;
+    }
+    run.inputsWhileJudging += app.judging;
+    __real_HAL_refreshInputs(hal_p);
+}
+
+// The calls into the Wordle engine and grlib the game makes, which the benchmark charges for
+bool __real_Hint_step(uint32_t maxScores);
+bool __real_Absurdle_step(uint32_t maxWords);
+bool __real_Candidates_step(uint32_t maxChunks);
+void __real_Hint_start(void);
+void __real_Absurdle_start(PackedWord word);
+PackedWord __real_Absurdle_answer(void);
+void __real_Candidates_startFeedback(PackedWord guess, FeedbackCode code);
+bool __real_Dictionary_contains(PackedWord word);
+void __real_Graphics_fillRectangle(const Graphics_Context *context, const Graphics_Rectangle *rect);
+void __real_Graphics_drawString(const Graphics_Context *context, int8_t *string, int32_t length,
+                                int32_t x, int32_t y, bool opaque);
+
+/** Charges the simulator for units of a kind of call, at the same point of the run as the game does them. */
+static void charge(Charged kind, uint32_t units)
+{
+    uint64_t cycles = (uint64_t) (charges[kind].cycles * units);
+
+    charges[kind].calls++;
+    charges[kind].total += cycles;
+    charges[kind].longest = (cycles > charges[kind].longest) ? cycles : charges[kind].longest;
+    Sim_advance(cycles);
+}
+
+bool __wrap_Hint_step(uint32_t maxScores)
+{
+    bool done = __real_Hint_step(maxScores);
+
+    charge(CHARGED_HINT_STEP, maxScores);
+    return done;
+}
+
+bool __wrap_Absurdle_step(uint32_t maxWords)
+{
+    bool done = __real_Absurdle_step(maxWords);
+
+    charge(CHARGED_ABSURDLE_STEP, maxWords);
+    return done;
+}
+
+bool __wrap_Candidates_step(uint32_t maxChunks)
+{
+    bool done = __real_Candidates_step(maxChunks);
+
+    charge(CHARGED_CANDIDATES_STEP, maxChunks);
+    return done;
+}
+
+void __wrap_Hint_start(void)
+{
+    __real_Hint_start();
+    charge(CHARGED_HINT_START, 1);
+}
+
+void __wrap_Absurdle_start(PackedWord word)
+{
+    __real_Absurdle_start(word);
+    charge(CHARGED_ABSURDLE_START, 1);
+}
+
+PackedWord __wrap_Absurdle_answer(void)
+{
+    PackedWord answer = __real_Absurdle_answer();
+
+    charge(CHARGED_ABSURDLE_ANSWER, 1);
+    return answer;
+}
+
+void __wrap_Candidates_startFeedback(PackedWord guess, FeedbackCode code)
+{
+    __real_Candidates_startFeedback(guess, code);
+    charge(CHARGED_CANDIDATES_START, 1);
+}
+
+bool __wrap_Dictionary_contains(PackedWord word)
+{
+    bool found = __real_Dictionary_contains(word);
+
+    charge(CHARGED_DICTIONARY_CONTAINS, 1);
+    return found;
+}
+
+void __wrap_Graphics_fillRectangle(const Graphics_Context *context, const Graphics_Rectangle *rect)
+{
+    __real_Graphics_fillRectangle(context, rect);
+    charge(CHARGED_FILL, (uint32_t) ((rect->xMax - rect->xMin + 1) * (rect->yMax - rect->yMin + 1)));
+}
+
+void __wrap_Graphics_drawString(const Graphics_Context *context, int8_t *string, int32_t length,
+                                int32_t x, int32_t y, bool opaque)
+{
+    __real_Graphics_drawString(context, string, length, x, y, opaque);
+    charge(CHARGED_STRING, (uint32_t) ((length < 0) ? (int32_t) strlen((const char*) string) : length));
+}
+
+/** The CPU time the host has spent in this thread, in ns. */
+static double hostNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * Sets the cost of a kind of call from the quickest of its CALIBRATE_ROUNDS
+ * timings, in ns per unit: the host only ever adds to a call's time, by
+ * other work, interrupts or a cold cache, so that is the nearest to the
+ * call's own.
+ */
+static void calibrated(Charged kind, const double* ns)
+{
+    double quickest = ns[0];
+    uint32_t round;
+
+    for (round = 1; round < CALIBRATE_ROUNDS; round++)
+    {
+        quickest = (ns[round] < quickest) ? ns[round] : quickest;
+    }
+    charges[kind].cycles = quickest * cyclesPerHostNs;
+}
+
+/**
+ * Times the charged calls the way a game makes them, warm, before the run:
+ * the board judges an opening guess against the whole dictionary, the
+ * candidates are narrowed by its feedback and a hint search starts over them,
+ * each CALIBRATE_ROUNDS times. Steps and drawing are timed over many calls,
+ * so that reading the clock hardly counts. Leaves the engines as they were
+ * at reset, and the framebuffer drawn on.
+ */
+static void calibrate(const Graphics_Context* context_p)
+{
+    double ns[CHARGED_COUNT][CALIBRATE_ROUNDS];
+    PackedWord guess = Score_packWord((const unsigned char*) CALIBRATE_GUESS);
+    Graphics_Rectangle band = { 0, 0, 0, DISPLAY_BAND_ROWS - 1 };
+    uint32_t round, steps, i;
+    double start, started;
+
+    band.xMax = (int16_t) (context_p->display->width - 1);
+
+    for (round = 0; round < CALIBRATE_ROUNDS; round++)
+    {
+        FeedbackCode code;
+
+        Candidates_reset();
+        Hint_reset();
+
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Absurdle_start(guess);
+        }
+        ns[CHARGED_ABSURDLE_START][round] = (hostNs() - start) / CALIBRATE_CALLS;
+        start = hostNs();
+        for (steps = 1; !__real_Absurdle_step(ABSURDLE_STEP_WORDS); steps++)
+        {
+        }
+        ns[CHARGED_ABSURDLE_STEP][round] = (hostNs() - start) / steps / ABSURDLE_STEP_WORDS;
+        code = Absurdle_feedback();
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Absurdle_answer();
+        }
+        ns[CHARGED_ABSURDLE_ANSWER][round] = (hostNs() - start) / CALIBRATE_CALLS;
+
+        // Started again, a narrowing would first finish the one before, so the set is reset in between, and the
+        // resets are timed on their own and taken off
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            Candidates_reset();
+            __real_Candidates_startFeedback(guess, code);
+        }
+        started = hostNs() - start;
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            Candidates_reset();
+        }
+        ns[CHARGED_CANDIDATES_START][round] = (started - (hostNs() - start)) / CALIBRATE_CALLS;
+        Candidates_reset();
+        __real_Candidates_startFeedback(guess, code);
+        start = hostNs();
+        for (steps = 1; !__real_Candidates_step(CANDIDATES_STEP_CHUNKS); steps++)
+        {
+        }
+        ns[CHARGED_CANDIDATES_STEP][round] = (hostNs() - start) / steps / CANDIDATES_STEP_CHUNKS;
+
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Hint_start();
+        }
+        ns[CHARGED_HINT_START][round] = (hostNs() - start) / CALIBRATE_CALLS;
+        start = hostNs();
+        for (steps = 1; (steps < CALIBRATE_CALLS) && !__real_Hint_step(HINT_STEP_SCORES); steps++)
+        {
+        }
+        ns[CHARGED_HINT_STEP][round] = (hostNs() - start) / steps / HINT_STEP_SCORES;
+
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Dictionary_contains(guess + i);
+        }
+        ns[CHARGED_DICTIONARY_CONTAINS][round] = (hostNs() - start) / CALIBRATE_CALLS;
+
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Graphics_fillRectangle(context_p, &band);
+        }
+        ns[CHARGED_FILL][round] = (hostNs() - start) / CALIBRATE_CALLS / ((band.xMax + 1) * DISPLAY_BAND_ROWS);
+        start = hostNs();
+        for (i = 0; i < CALIBRATE_CALLS; i++)
+        {
+            __real_Graphics_drawString(context_p, (int8_t*) CALIBRATE_GUESS, 1, (int32_t) (i % 100), 0, true);
+        }
+        ns[CHARGED_STRING][round] = (hostNs() - start) / CALIBRATE_CALLS;
+    }
+
+    for (i = 0; i < CHARGED_COUNT; i++)
+    {
+        calibrated((Charged) i, ns[i]);
+    }
+    Candidates_reset();
+    Hint_reset();
+}
+
+/** Wakes the loop now and then, so the player can look at the game. */
+static void playerExpired(void* context)
+{
+    (void) context;
+
+    if (!inputStopped)
+    {
+        WheelTimer_arm(&playerTimer, PLAYER_TICK_MS, NULL);
+    }
+}
+
+/** Presses a button of the player's after a delay and releases it, both with contact bounce, then waits. */
+static void playerPress(uint_fast8_t port, uint_fast16_t pin, uint64_t delay)
+{
+    uint64_t time = SimStimulus_scheduleEdge(Sim_now() + delay, port, pin, false);
+
+    time += SimStimulus_randomBetween(PLAYER_HOLD_MS) * cyclesPerMs;
+    player.waitUntil = SimStimulus_scheduleEdge(time, port, pin, true) + PLAYER_RELEASE_MS * cyclesPerMs;
+}
+
+/** Types a random dictionary word, after Ctrl-P on the first guess of a game. */
+static void playerType(void)
+{
+    char text[MAX_LETTERS + 1];
+    uint32_t length = 0;
+    uint32_t index = SimStimulus_random() % Dictionary_wordCount();
+    DictionaryCursor cursor = Dictionary_cursor();
+    PackedWord word = 0;
+
+    if (app.guess == ONE)
+    {
+        text[length++] = PROFILE_DUMP_KEY;
+    }
+    do
+    {
+        Dictionary_next(&cursor, &word);
+    } while (index-- > 0);
+    Score_unpackWord(word, (unsigned char*) &text[length]);
+    length += MAX_LETTERS;
+
+    SimStimulus_scheduleText(Sim_now(), text, length, LINE_BAUD);
+    run.charsSent += length;
+}
+
+/** Takes the player's next step once what it waits for has happened. */
+static void playerStep(void)
+{
+    uint64_t now = Sim_now();
+
+    if (now < player.waitUntil)
+    {
+        return;
+    }
+
+    switch (player.step)
+    {
+    case PLAYER_START:
+        playerPress(BOOSTERPACK_S1_PORT, BOOSTERPACK_S1_PIN, 1);
+        player.step = PLAYER_STARTING;
+        break;
+
+    case PLAYER_STARTING:
+        player.step = (app.state == ABSURDLE) ? PLAYER_HINT : PLAYER_STARTING;
+        break;
+
+    case PLAYER_HINT:
+        if (app.guess >= RESULT)
+        {
+            // In a game the board won, the result is shown once the candidates are narrowed by the last feedback
+            if (!app.narrowing)
+            {
+                run.games++;
+                player.waitUntil = now + RESULT_MS * cyclesPerMs;
+                player.step = PLAYER_OVER;
+            }
+            break;
+        }
+        // The strategy tree has the hint for the opening guess, so that one is not asked for
+        if (app.guess != ONE)
+        {
+            playerPress(BOOSTERPACK_JS_PORT, BOOSTERPACK_JS_PIN,
+                        SimStimulus_randomBetween(PLAYER_HINT_MS) * cyclesPerMs);
+        }
+        player.step = PLAYER_TYPE;
+        break;
+
+    case PLAYER_TYPE:
+        if ((app.guess == ONE) || app.hinting || (now > player.waitUntil + HINT_WAIT_MS * cyclesPerMs))
+        {
+            playerType();
+            player.step = PLAYER_SUBMIT;
+        }
+        break;
+
+    case PLAYER_SUBMIT:
+        if ((SimStimulus_charRoom() == SIM_STIMULUS_CHARS_SIZE) && (app.letter == END))
+        {
+            player.guess = app.guess;
+            playerPress(BOOSTERPACK_S1_PORT, BOOSTERPACK_S1_PIN,
+                        SimStimulus_randomBetween(PLAYER_SUBMIT_MS) * cyclesPerMs);
+            player.step = PLAYER_JUDGED;
+        }
+        break;
+
+    case PLAYER_JUDGED:
+        if ((app.guess != player.guess) && !app.judging)
+        {
+            run.guesses++;
+            player.step = PLAYER_HINT;
+        }
+        break;
+
+    case PLAYER_OVER:
+        // A new game starts on the title screen, at the same baudrate
+        app = Application_construct();
+        app.baudChoice = BAUD_57600;
+        player.step = PLAYER_START;
+        break;
+    }
+}
+
+/** One time round the super-loop, as in proj1_main.c. */
+static void scheduledLoop(void)
+{
+    Scheduler_signal(HAL_takeEvents(&hal));
+    if (!Scheduler_runNext())
+    {
+        Scheduler_signal(HAL_sleep(&hal));
+    }
+}
+
+/** Plays for the given time with the LaunchPad S1 button pressed now and then. */
+static void play(uint64_t duration)
+{
+    uint64_t end = Sim_now() + duration;
+    uint64_t lastPress = (duration > 1000 * cyclesPerMs) ? end - 1000 * cyclesPerMs : Sim_now();
+    bool dumping = false;
+
+    // Every press is released well before the end, so each one should count as exactly one tap
+    run.presses = SimStimulus_schedulePresses(Sim_now(), lastPress,
+                                              LAUNCHPAD_S1_PORT, LAUNCHPAD_S1_PIN, PRESS_GAP_MS, PRESS_HOLD_MS);
+    WheelTimer_arm(&playerTimer, PLAYER_TICK_MS, NULL);
+
+    while (Sim_now() < end)
+    {
+        playerStep();
+        scheduledLoop();
+
+        run.taps += Button_takeTap(&hal.launchpadS1);
+        run.dumps += dumping && !Profile_isDumping();
+        dumping = Profile_isDumping();
+    }
+}
+
+/** Lets the tasks finish what they have with no new input. Returns false if they never do. */
+static bool drain(void)
+{
+    uint64_t deadline = Sim_now() + DRAIN_MS * cyclesPerMs;
+
+    inputStopped = true;
+    WheelTimer_cancel(&playerTimer);
+
+    while (Sim_now() < deadline)
+    {
+        Scheduler_signal(HAL_takeEvents(&hal));
+        if (!Scheduler_runNext() && Crystalfontz128x128_TransferDone() && !Profile_isDumping())
+        {
+            run.taps += Button_takeTap(&hal.launchpadS1);
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : DEFAULT_SECONDS;
+    uint64_t seed = (argc > 2) ? strtoull(argv[2], NULL, 0) : DEFAULT_SEED;
+    uint64_t duration, charTime, overruns = 0;
+    bool drained, met;
+    Task* task_p;
+    Charged kind;
+
+    cyclesPerHostNs = (argc > 3) ? atof(argv[3]) : DEFAULT_CYCLES_PER_NS;
+    SimStimulus_seed(seed);
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+    hal = HAL_construct();
+    Dictionary_init();
+    Strategy_init();
+    calibrate(&hal.g_sContext);
+    app = Application_construct();
+
+    // As if BoosterPack S2 had been tapped three times; the first run of the game sets it
+    app.baudChoice = BAUD_57600;
+    SimUART_setLineBaud(LINE_BAUD);
+
+    cyclesPerMs = Sim_mclkFrequency() / MS_DIVISION_FACTOR;
+    cyclesPerUs = Sim_mclkFrequency() / US_DIVISION_FACTOR;
+    charTime = (uint64_t) Sim_mclkFrequency() * SIM_STIMULUS_BITS_PER_CHAR / LINE_BAUD;
+    duration = (uint64_t) (seconds * 1000) * cyclesPerMs;
+
+    playerTimer = WheelTimer_construct(playerExpired);
+    Application_schedule(&app, &hal);
+
+    printf("Scheduler with the game's tasks, seed %llu, Absurdle at %u baud with a hint for every guess:\n",
+           (unsigned long long) seed, LINE_BAUD);
+
+    play(duration);
+    drained = drain();
+
+    // A character still waiting long after it arrived was lost
+    run.charsLost = SimStimulus_lostChars(cyclesPerMs);
+    met = (run.charLatencyMax < charTime) && (run.edgeLatencyMax < charTime);
+
+    printf("  %.0f simulated seconds: %u games, %u guesses judged, %u profiling tables sent\n",
+           (double) duration / Sim_mclkFrequency(), run.games, run.guesses, run.dumps);
+    printf("  button: %u presses, %u taps; edge to the input task getting to it: %.1f us at most\n",
+           run.presses, run.taps, (double) run.edgeLatencyMax / cyclesPerUs);
+    printf("  UART: %u characters sent, %u received, %u wrong, %u lost; read %.1f us after arriving at most\n",
+           run.charsSent, run.charsReceived, run.charErrors, run.charsLost,
+           (double) run.charLatencyMax / cyclesPerUs);
+    printf("  %u characters read during a hint search, %u input task runs during a judgement\n",
+           run.charsWhileHinting, run.inputsWhileJudging);
+    printf("  target: within one character time, %.1f us: %s\n", (double) charTime / cyclesPerUs,
+           met ? "met" : "missed");
+
+    printf("  charged at %.1f M4 cycles per host ns: cost per unit, calls, longest and mean call:\n",
+           cyclesPerHostNs);
+    for (kind = 0; kind < CHARGED_COUNT; kind++)
+    {
+        printf("    %-24s %10.1f cycles %9u calls %10.1f us %10.2f us\n", charges[kind].name, charges[kind].cycles,
+               charges[kind].calls, (double) charges[kind].longest / cyclesPerUs,
+               charges[kind].calls ? (double) charges[kind].total / charges[kind].calls / cyclesPerUs : 0.0);
+    }
+
+    printf("  %-10s %9s %10s %10s %12s %12s %12s\n", "task", "runs", "overruns", "budget us", "longest us",
+           "mean us", "wait us");
+    for (task_p = Scheduler_next(NULL); task_p != NULL; task_p = Scheduler_next(task_p))
+    {
+        const TaskStats* stats = Task_stats(task_p);
+
+        printf("  %-10s %9u %10u %10.1f %12.1f %12.2f %12.1f\n", task_p->name, stats->runs, stats->overruns,
+               (double) Task_budgetCycles(task_p) / cyclesPerUs, (double) stats->longestRun / cyclesPerUs,
+               stats->runs ? (double) stats->total / stats->runs / cyclesPerUs : 0.0,
+               (double) stats->longestWait / cyclesPerUs);
+        overruns += stats->overruns;
+    }
+    printf("  LCD after the input stops: %s, %llu pixels written, %u SPI bytes lost\n",
+           drained ? "all sent" : "still sending", (unsigned long long) SimLcd_pixelsWritten(), SimSPI_overwrites());
+
+    if (!met || overruns > 0 || run.taps != run.presses || run.charErrors > 0 || run.charsLost > 0 ||
+        run.charsReceived == 0 || run.charsWhileHinting == 0 || run.inputsWhileJudging == 0 || run.games == 0 ||
+        run.dumps == 0 || !drained || SimSPI_overwrites() > 0)
+    {
+        fprintf(stderr, "the game's tasks missed their latency target, overran a budget or lost input\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
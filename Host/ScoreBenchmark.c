@@ -0,0 +1,145 @@
+/*
+ * ScoreBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host benchmark of the packed-word scoring kernel in Wordle/Score.c. Scores a
+ * fixed pseudo-random set of guess/answer pairs and reports the cost of one
+ * Score_feedback() call in nanoseconds and (on x86) timestamp counter cycles.
+ * Before timing, the kernel is checked against a straightforward two-pass
+ * reference scorer on the same pairs. The kernel is specialised for the word
+ * length at build time, so the Makefile builds one ScoreBenchmarkN for each
+ * supported length N.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Wordle/Score.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define NUM_PAIRS   4096
+#define NUM_ROUNDS  2000
+
+static PackedWord guesses[NUM_PAIRS];
+static PackedWord answers[NUM_PAIRS];
+
+/** A small linear congruential generator, so every run scores the same pairs. */
+static uint32_t nextRandom(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/**
+ * Builds a random word from a reduced alphabet, so that repeated letters (the
+ * case the old nested loop got wrong) show up often.
+ */
+static PackedWord randomWord(uint32_t* state)
+{
+    unsigned char word[SCORE_WORD_LENGTH];
+    int i;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        word[i] = (unsigned char) ('A' + nextRandom(state) % 8);
+    }
+
+    return Score_packWord(word);
+}
+
+/** Reference scorer: exact matches first, then yellows against unused letters. */
+static FeedbackCode referenceFeedback(PackedWord guess, PackedWord answer)
+{
+    int used[SCORE_WORD_LENGTH] = { 0 };
+    int score[SCORE_WORD_LENGTH] = { 0 };
+    int code = 0;
+    int weight = 1;
+    int i, j;
+
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        if (SCORE_LETTER(guess, i) == SCORE_LETTER(answer, i))
+        {
+            score[i] = GREEN;
+            used[i] = 1;
+        }
+    }
+    for (i = 0; i < SCORE_WORD_LENGTH; i++)
+    {
+        for (j = 0; j < SCORE_WORD_LENGTH && score[i] != GREEN; j++)
+        {
+            if (!used[j] && SCORE_LETTER(guess, i) == SCORE_LETTER(answer, j))
+            {
+                score[i] = YELLOW;
+                used[j] = 1;
+                break;
+            }
+        }
+        code += score[i] * weight;
+        weight *= 3;
+    }
+
+    return (FeedbackCode) code;
+}
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void)
+{
+    uint32_t seed = 12345;
+    uint32_t checksum = 0;
+    int i, round;
+
+    for (i = 0; i < NUM_PAIRS; i++)
+    {
+        guesses[i] = randomWord(&seed);
+        answers[i] = randomWord(&seed);
+        if (Score_feedback(guesses[i], answers[i]) != referenceFeedback(guesses[i], answers[i]))
+        {
+            unsigned char guess[SCORE_WORD_LENGTH], answer[SCORE_WORD_LENGTH];
+            Score_unpackWord(guesses[i], guess);
+            Score_unpackWord(answers[i], answer);
+            fprintf(stderr, "mismatch: %.*s vs %.*s\n", SCORE_WORD_LENGTH, guess, SCORE_WORD_LENGTH, answer);
+            return EXIT_FAILURE;
+        }
+    }
+
+    double start = nowNs();
+#ifdef HAVE_TSC
+    uint64_t startTsc = __rdtsc();
+#endif
+    for (round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_PAIRS; i++)
+        {
+            checksum += Score_feedback(guesses[i], answers[(i + round) % NUM_PAIRS]);
+        }
+    }
+#ifdef HAVE_TSC
+    uint64_t tsc = __rdtsc() - startTsc;
+#endif
+    double elapsed = nowNs() - start;
+    double scores = (double) NUM_PAIRS * NUM_ROUNDS;
+
+    printf("Score_feedback, %d letters: %.0f scores in %.1f ms\n", SCORE_WORD_LENGTH, scores, elapsed / 1e6);
+    printf("  %.2f ns/score, %.1f Mscores/s\n", elapsed / scores, scores / elapsed * 1e3);
+#ifdef HAVE_TSC
+    printf("  %.2f TSC cycles/score\n", (double) tsc / scores);
+#endif
+    printf("  checksum %u\n", checksum);
+
+    return EXIT_SUCCESS;
+}
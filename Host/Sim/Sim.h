@@ -0,0 +1,128 @@
+/*
+ * Sim.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A register-level simulator of the MSP432 peripherals the HAL uses, for host
+ * builds. It implements the driverlib calls and registers declared in
+ * Host/include, so the HAL sources and the LCD driver compile and run
+ * unmodified on Linux against a virtual clock:
+ *
+ *   - GPIO pins, with inputs the test side can drive and edge interrupts
+ *   - Timer32 counting down at MCLK with rollover interrupts
+ *   - eUSCI_A0 as a UART, bit-timed from its prescaler and modulation registers
+ *   - eUSCI_B0 as the LCD's SPI master, paced by its clock divider, and the
+ *     uDMA channel which feeds it
+ *   - the ST7735 controller on the other end of the SPI bus
+ *   - the clock system, flash wait states and the NVIC
+ *   - LPM0, which PCM_gotoLPM0() sleeps in until an interrupt is raised
+ *
+ * Time only passes when the code touches the hardware: every driverlib call and
+ * register access costs a fixed number of cycles, and busy-wait loops cost as
+ * long as the hardware takes to become ready. The C code between those
+ * accesses is free, so cycle counts are a lower bound dominated by waiting on
+ * peripherals. Interrupt handlers run, with entry and exit costs, whenever an
+ * enabled peripheral raises its interrupt, as long as the code keeps touching
+ * the hardware.
+ *
+ * The test side drives the board through a schedule of events at given
+ * cycles, and lets an idle super-loop skip ahead to the next one with
+ * Sim_idle(). Nothing depends on the host's clock, so a run is exactly the
+ * same every time, however long the simulated time.
+ *
+ * Configuration mistakes that would hang or brick the board, such as an
+ * unhandled interrupt or a clock faster than the flash wait states allow,
+ * stop the program with a message.
+ */
+
+#ifndef SIM_SIM_H_
+#define SIM_SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A time which never comes
+#define SIM_NEVER                   UINT64_MAX
+
+// Returns the number of MCLK cycles since reset
+uint64_t Sim_now(void);
+
+// Lets the given number of MCLK cycles pass, as if the CPU were busy, running interrupts as they occur
+void Sim_advance(uint64_t cycles);
+
+// Lets time pass until the next hardware event, as a CPU spinning on a flag set by an interrupt would
+void Sim_spin(void);
+
+// Lets time pass until the next hardware or scheduled event, but no more than maxCycles.
+// This is the super-loop with nothing to do: since nothing it polls can change before
+// the next event, jumping straight there gives the same result as polling all the way,
+// and hours of simulated time pass in milliseconds.
+void Sim_idle(uint64_t maxCycles);
+
+// Something the outside world does to the board at a given time. The argument is free for the handler's use.
+typedef void (*SimEventHandler)(void* context, uint32_t argument);
+
+// Runs handler at the given time, before the hardware advances past it. Events at the same
+// time run in the order they were scheduled, so the same schedule always gives the same run.
+void Sim_schedule(uint64_t time, SimEventHandler handler, void* context, uint32_t argument);
+
+// Returns how many scheduled events have not happened yet
+uint32_t Sim_scheduledEvents(void);
+
+// Returns how many cycles the CPU has spent asleep in LPM0, waiting for an interrupt
+uint64_t Sim_sleptCycles(void);
+
+// Returns the frequencies the clock system currently runs MCLK and SMCLK at
+uint32_t Sim_mclkFrequency(void);
+uint32_t Sim_smclkFrequency(void);
+
+// Drives the given input pins high or low. Inputs are pulled up until they are driven.
+void SimGPIO_setInput(uint_fast8_t port, uint_fast16_t pins, bool high);
+
+// Drives the given input pins high or low at a later time
+void SimGPIO_scheduleInput(uint64_t time, uint_fast8_t port, uint_fast16_t pins, bool high);
+
+// Returns whether an output pin is driven high
+bool SimGPIO_getOutput(uint_fast8_t port, uint_fast16_t pin);
+
+// Sets the baudrate of the PC at the other end of the UART. Defaults to 9600.
+void SimUART_setLineBaud(uint32_t baud);
+
+// The PC sends bytes to eUSCI_A0, back to back from now on or after those it is already sending
+void SimUART_send(const uint8_t* data, uint32_t length);
+
+// The PC sends a byte at a later time, or after those it is still sending then
+void SimUART_scheduleSend(uint64_t time, uint8_t data);
+
+// Returns how many bytes the PC is still sending
+uint32_t SimUART_sending(void);
+
+// Moves up to length bytes the PC has received from eUSCI_A0 into data. Returns how many were moved.
+uint32_t SimUART_receive(uint8_t* data, uint32_t length);
+
+// Returns how many bytes the PC received with a framing error, because the baudrates do not match
+uint32_t SimUART_lineErrors(void);
+
+// Returns the baudrate eUSCI_A0 is configured for, computed from its clock and divider settings
+double SimUART_baudRate(void);
+
+// Returns how many bytes eUSCI_B0 has shifted out
+uint64_t SimSPI_bytesSent(void);
+
+// Returns how many bytes were written into eUSCI_B0's transmit buffer while it was still full and so were lost
+uint32_t SimSPI_overwrites(void);
+
+// Returns a pixel of the LCD panel, as RGB565, in the upright orientation the HAL uses
+uint16_t SimLcd_getPixel(int x, int y);
+
+// Returns how many pixels the LCD panel has written into its memory
+uint64_t SimLcd_pixelsWritten(void);
+
+// Used by the LCD driver's wait loops, see HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h
+#define HAL_LCD_spinWait()          Sim_spin()
+
+// The counter of the profiling regions, see HAL/Profile.h
+#define PROFILE_NOW()               Sim_now()
+#define PROFILE_UNIT                "cycles"
+
+#endif /* SIM_SIM_H_ */
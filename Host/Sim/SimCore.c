@@ -0,0 +1,467 @@
+/*
+ * SimCore.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The simulator's clock, interrupt controller, clock system and power
+ * control, and the driverlib calls which configure them.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Sim/SimInternal.h>
+
+// Frequencies of the clock sources after reset
+#define DCO_RESET_FREQUENCY         3000000
+#define REFO_FREQUENCY              32768
+
+// The fastest MCLK each number of flash wait states supports at core voltage level 1
+#define FLASH_MAX_FREQUENCY_0_WAIT  16000000
+#define FLASH_MAX_FREQUENCY_1_WAIT  32000000
+
+// How many times in a row one interrupt may be taken before it counts as stuck
+#define MAX_BACK_TO_BACK_IRQS       1000000
+
+// Interrupt handlers, resolved against the HAL sources which are linked in.
+// Like the weak aliases in the startup file, a missing handler is allowed
+// until its interrupt actually fires.
+extern void EUSCIA0_IRQHandler(void) __attribute__((weak));
+extern void T32_INT1_IRQHandler(void) __attribute__((weak));
+extern void T32_INT2_IRQHandler(void) __attribute__((weak));
+extern void DMA_INT3_IRQHandler(void) __attribute__((weak));
+extern void DMA_INT2_IRQHandler(void) __attribute__((weak));
+extern void DMA_INT1_IRQHandler(void) __attribute__((weak));
+extern void DMA_INT0_IRQHandler(void) __attribute__((weak));
+extern void PORT1_IRQHandler(void) __attribute__((weak));
+extern void PORT2_IRQHandler(void) __attribute__((weak));
+extern void PORT3_IRQHandler(void) __attribute__((weak));
+extern void PORT4_IRQHandler(void) __attribute__((weak));
+extern void PORT5_IRQHandler(void) __attribute__((weak));
+extern void PORT6_IRQHandler(void) __attribute__((weak));
+
+static bool Sim_uartPending(uint32_t unused)
+{
+    (void) unused;
+
+    return SimUART_interruptPending();
+}
+
+/** Every interrupt source the simulator models, in NVIC priority order. */
+static const struct
+{
+    uint32_t number;
+    bool (*pending)(uint32_t argument);
+    uint32_t argument;
+    void (*handler)(void);
+} interrupts[] =
+{
+    { INT_EUSCIA0,  Sim_uartPending,             0,            EUSCIA0_IRQHandler  },
+    { INT_T32_INT1, SimTimer32_interruptPending, 0,            T32_INT1_IRQHandler },
+    { INT_T32_INT2, SimTimer32_interruptPending, 1,            T32_INT2_IRQHandler },
+    { INT_DMA_INT3, SimDMA_interruptPending,     INT_DMA_INT3, DMA_INT3_IRQHandler },
+    { INT_DMA_INT2, SimDMA_interruptPending,     INT_DMA_INT2, DMA_INT2_IRQHandler },
+    { INT_DMA_INT1, SimDMA_interruptPending,     INT_DMA_INT1, DMA_INT1_IRQHandler },
+    { INT_DMA_INT0, SimDMA_interruptPending,     INT_DMA_INT0, DMA_INT0_IRQHandler },
+    { INT_PORT1,    SimGPIO_interruptPending,    GPIO_PORT_P1, PORT1_IRQHandler    },
+    { INT_PORT2,    SimGPIO_interruptPending,    GPIO_PORT_P2, PORT2_IRQHandler    },
+    { INT_PORT3,    SimGPIO_interruptPending,    GPIO_PORT_P3, PORT3_IRQHandler    },
+    { INT_PORT4,    SimGPIO_interruptPending,    GPIO_PORT_P4, PORT4_IRQHandler    },
+    { INT_PORT5,    SimGPIO_interruptPending,    GPIO_PORT_P5, PORT5_IRQHandler    },
+    { INT_PORT6,    SimGPIO_interruptPending,    GPIO_PORT_P6, PORT6_IRQHandler    },
+};
+
+#define NUM_INTERRUPTS (sizeof(interrupts) / sizeof(interrupts[0]))
+
+/** MCLK cycles since reset. */
+static uint64_t simNow = 0;
+
+/** The NVIC: PRIMASK, the enable bit of every interrupt, and whether a handler is running. */
+static bool masterEnabled = true;
+static uint64_t nvicEnabled = 0;
+static bool inHandler = false;
+
+/** Whether the CPU is asleep in LPM0 and since when, and the cycles it has slept for in all. */
+static bool sleeping = false;
+static uint64_t sleepStart = 0;
+static uint64_t sleptCycles = 0;
+
+/** The clock system. Each clock signal is a source and a power-of-two divider. */
+static uint32_t dcoFrequency = DCO_RESET_FREQUENCY;
+static uint32_t mclkSource = CS_DCOCLK_SELECT, mclkDivider = CS_CLOCK_DIVIDER_1;
+static uint32_t smclkSource = CS_DCOCLK_SELECT, smclkDivider = CS_CLOCK_DIVIDER_1;
+
+/** The flash wait states of both banks. */
+static uint32_t flashWaitStates[2] = { 0, 0 };
+
+void Sim_fail(const char* format, ...)
+{
+    va_list args;
+
+    fprintf(stderr, "sim: at cycle %llu: ", (unsigned long long) simNow);
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+
+    exit(EXIT_FAILURE);
+}
+
+static uint64_t Sim_nextEvent(void)
+{
+    uint64_t next = SimTimer32_nextEvent();
+    uint64_t uart = SimUART_nextEvent();
+    uint64_t spi = SimSPI_nextEvent();
+    uint64_t scheduled = SimSchedule_nextEvent();
+
+    if (uart < next)
+    {
+        next = uart;
+    }
+    if (spi < next)
+    {
+        next = spi;
+    }
+    if (scheduled < next)
+    {
+        next = scheduled;
+    }
+    return next;
+}
+
+/** The outside world acts first, so a byte or an edge scheduled at a time is seen by the hardware at that time. */
+static void Sim_advancePeripherals(void)
+{
+    SimSchedule_advanceTo(simNow);
+    SimTimer32_advanceTo(simNow);
+    SimUART_advanceTo(simNow);
+    SimSPI_advanceTo(simNow);
+}
+
+static void Sim_runUntil(uint64_t target);
+
+/** Whether an interrupt enabled in the NVIC is raised, which wakes the CPU from WFI even with PRIMASK set. */
+static bool Sim_interruptPending(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_INTERRUPTS; i++)
+    {
+        if ((nvicEnabled & (1ull << (interrupts[i].number - 16))) && interrupts[i].pending(interrupts[i].argument))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Ends a sleep in LPM0, counting the cycles it lasted. */
+static void Sim_wake(void)
+{
+    if (sleeping)
+    {
+        sleeping = false;
+        sleptCycles += simNow - sleepStart;
+    }
+}
+
+/**
+ * Takes every pending, enabled interrupt, highest priority first. Handlers do
+ * not nest: while one runs, new interrupts wait until it returns.
+ */
+void Sim_dispatch(void)
+{
+    uint32_t backToBack = 0;
+    uint32_t last = NUM_INTERRUPTS;
+    uint32_t i;
+
+    if (!masterEnabled || inHandler)
+    {
+        return;
+    }
+
+    for (i = 0; i < NUM_INTERRUPTS; i++)
+    {
+        if (!(nvicEnabled & (1ull << (interrupts[i].number - 16))) ||
+            !interrupts[i].pending(interrupts[i].argument))
+        {
+            continue;
+        }
+
+        if (interrupts[i].handler == NULL)
+        {
+            Sim_fail("interrupt %u fired, but there is no handler for it", interrupts[i].number);
+        }
+
+        backToBack = (i == last) ? backToBack + 1 : 0;
+        if (backToBack > MAX_BACK_TO_BACK_IRQS)
+        {
+            Sim_fail("interrupt %u is taken over and over; its handler never clears its cause",
+                     interrupts[i].number);
+        }
+        last = i;
+
+        // Taking an interrupt wakes the CPU, and its handler runs awake
+        Sim_wake();
+        inHandler = true;
+        Sim_runUntil(simNow + SIM_CYCLES_IRQ_ENTRY);
+        interrupts[i].handler();
+        Sim_runUntil(simNow + SIM_CYCLES_IRQ_EXIT);
+        inHandler = false;
+
+        // Start over, since the handler may have raised a higher priority interrupt
+        i = (uint32_t) -1;
+    }
+}
+
+/** Steps the clock from hardware event to hardware event until target, taking interrupts on the way. */
+static void Sim_runUntil(uint64_t target)
+{
+    SimSPI_commit();
+    Sim_dispatch();
+
+    for (;;)
+    {
+        uint64_t next = Sim_nextEvent();
+
+        if (next > target)
+        {
+            break;
+        }
+        if (next > simNow)
+        {
+            simNow = next;
+        }
+        Sim_advancePeripherals();
+        Sim_dispatch();
+    }
+
+    if (target > simNow)
+    {
+        simNow = target;
+        Sim_advancePeripherals();
+        Sim_dispatch();
+    }
+}
+
+void Sim_charge(uint32_t cycles)
+{
+    Sim_runUntil(simNow + cycles);
+}
+
+uint64_t Sim_now(void)
+{
+    SimSPI_commit();
+    return simNow;
+}
+
+void Sim_advance(uint64_t cycles)
+{
+    Sim_runUntil(simNow + cycles);
+}
+
+void Sim_spin(void)
+{
+    uint64_t next;
+
+    SimSPI_commit();
+    next = Sim_nextEvent();
+
+    if (next == SIM_NEVER)
+    {
+        Sim_fail("the CPU is waiting for an interrupt, but no hardware or scheduled event is coming");
+    }
+    if (next < simNow + SIM_CYCLES_REGISTER)
+    {
+        next = simNow + SIM_CYCLES_REGISTER;
+    }
+    Sim_runUntil(next);
+}
+
+void Sim_idle(uint64_t maxCycles)
+{
+    uint64_t next, limit;
+
+    SimSPI_commit();
+    next = Sim_nextEvent();
+    limit = (maxCycles > SIM_NEVER - simNow) ? SIM_NEVER : simNow + maxCycles;
+
+    if (next > limit)
+    {
+        next = limit;
+    }
+    if (next == SIM_NEVER)
+    {
+        Sim_fail("the super-loop is idle with nothing scheduled and no limit, so time would never end");
+    }
+    if (next < simNow + SIM_CYCLES_REGISTER)
+    {
+        next = simNow + SIM_CYCLES_REGISTER;
+    }
+    Sim_runUntil(next);
+}
+
+// -----------------------------------------------------------------------------
+// Clock system
+// -----------------------------------------------------------------------------
+
+static uint32_t Sim_clockFrequency(uint32_t source, uint32_t divider)
+{
+    uint32_t frequency = (source == CS_REFOCLK_SELECT) ? REFO_FREQUENCY : dcoFrequency;
+    return frequency >> divider;
+}
+
+uint32_t Sim_mclkFrequency(void)
+{
+    return Sim_clockFrequency(mclkSource, mclkDivider);
+}
+
+uint32_t Sim_smclkFrequency(void)
+{
+    return Sim_clockFrequency(smclkSource, smclkDivider);
+}
+
+double Sim_smclkToMclk(double smclkCycles)
+{
+    return smclkCycles * Sim_mclkFrequency() / Sim_smclkFrequency();
+}
+
+/** On the board, running MCLK faster than the flash can keep up with makes the CPU execute garbage. */
+static void Sim_checkFlashWaitStates(void)
+{
+    uint32_t mclk = Sim_mclkFrequency();
+    uint32_t required = (mclk > FLASH_MAX_FREQUENCY_1_WAIT) ? 2 : (mclk > FLASH_MAX_FREQUENCY_0_WAIT) ? 1 : 0;
+
+    if (flashWaitStates[0] < required || flashWaitStates[1] < required)
+    {
+        Sim_fail("MCLK runs at %u Hz, which needs %u flash wait states, but the banks have %u and %u",
+                 mclk, required, flashWaitStates[0], flashWaitStates[1]);
+    }
+}
+
+void FlashCtl_setWaitState(uint32_t bank, uint32_t waitState)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    flashWaitStates[bank & 1] = waitState;
+}
+
+void CS_setDCOFrequency(uint32_t frequency)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    dcoFrequency = frequency;
+    Sim_checkFlashWaitStates();
+}
+
+void CS_initClockSignal(uint32_t selectedClockSignal, uint32_t clockSource, uint32_t clockSourceDivider)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if (selectedClockSignal == CS_MCLK)
+    {
+        mclkSource = clockSource;
+        mclkDivider = clockSourceDivider;
+        Sim_checkFlashWaitStates();
+    }
+    else if (selectedClockSignal == CS_SMCLK)
+    {
+        smclkSource = clockSource;
+        smclkDivider = clockSourceDivider;
+    }
+}
+
+uint32_t CS_getMCLK(void)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    return Sim_mclkFrequency();
+}
+
+uint32_t CS_getSMCLK(void)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    return Sim_smclkFrequency();
+}
+
+// -----------------------------------------------------------------------------
+// Interrupt controller, watchdog and delays
+// -----------------------------------------------------------------------------
+
+bool Interrupt_enableMaster(void)
+{
+    bool wasDisabled = !masterEnabled;
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    masterEnabled = true;
+    Sim_dispatch();
+
+    return wasDisabled;
+}
+
+bool Interrupt_disableMaster(void)
+{
+    bool wasDisabled = !masterEnabled;
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    masterEnabled = false;
+
+    return wasDisabled;
+}
+
+void Interrupt_enableInterrupt(uint32_t interruptNumber)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    nvicEnabled |= 1ull << (interruptNumber - 16);
+    Sim_dispatch();
+}
+
+void Interrupt_disableInterrupt(uint32_t interruptNumber)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    nvicEnabled &= ~(1ull << (interruptNumber - 16));
+}
+
+void WDT_A_holdTimer(void)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+}
+
+uint64_t Sim_sleptCycles(void)
+{
+    return sleptCycles + (sleeping ? simNow - sleepStart : 0);
+}
+
+/**
+ * WFI in LPM0: the CPU stops until an interrupt enabled in the NVIC is raised,
+ * while the peripherals run on. With PRIMASK clear the interrupt is taken
+ * before this returns; with it set, the CPU wakes and leaves the interrupt
+ * waiting for the code to enable interrupts again.
+ */
+bool PCM_gotoLPM0(void)
+{
+    uint64_t next;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimSPI_commit();
+
+    sleeping = true;
+    sleepStart = simNow;
+
+    while (sleeping && !Sim_interruptPending())
+    {
+        next = Sim_nextEvent();
+        if (next == SIM_NEVER)
+        {
+            Sim_fail("the CPU went to sleep, but no hardware or scheduled event will ever wake it");
+        }
+        Sim_runUntil((next > simNow) ? next : simNow + 1);
+    }
+
+    Sim_wake();
+    return true;
+}
+
+/** The delay loop of the LCD driver: three cycles per iteration. */
+void SysCtlDelay(uint32_t count)
+{
+    Sim_advance(3ull * count);
+}
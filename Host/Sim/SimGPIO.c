@@ -0,0 +1,173 @@
+/*
+ * SimGPIO.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Simulated GPIO ports. Each port has an output register and the levels on its
+ * input pins, which float high (every button has a pull-up) until the test side
+ * drives them. Like the hardware, an edge on an input pin in the direction its
+ * edge select asks for sets the pin's interrupt flag, whether or not its
+ * interrupt is enabled, and ports 1 to 6 raise their interrupt while an enabled
+ * pin has its flag set.
+ */
+
+#include <Sim/SimInternal.h>
+
+static uint16_t outputs[GPIO_NUM_PORTS + 1];
+static uint16_t inputs[GPIO_NUM_PORTS + 1] =
+{
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+/** The interrupt registers: PxIE, PxIES (set for high-to-low) and PxIFG. */
+static uint16_t interruptEnables[GPIO_NUM_PORTS + 1];
+static uint16_t edgeSelects[GPIO_NUM_PORTS + 1];
+static uint16_t interruptFlags[GPIO_NUM_PORTS + 1];
+
+static void SimGPIO_checkPort(uint_fast8_t port)
+{
+    if (port < GPIO_PORT_P1 || port > GPIO_NUM_PORTS)
+    {
+        Sim_fail("GPIO port %u does not exist", port);
+    }
+}
+
+void SimGPIO_setInput(uint_fast8_t port, uint_fast16_t pins, bool high)
+{
+    uint16_t before;
+
+    SimGPIO_checkPort(port);
+    before = inputs[port];
+
+    if (high)
+    {
+        inputs[port] |= pins;
+    }
+    else
+    {
+        inputs[port] &= ~pins;
+    }
+
+    // Rising edges on pins which select low-to-high, falling edges on those which select high-to-low
+    interruptFlags[port] |= (~before & inputs[port] & ~edgeSelects[port]) |
+                            (before & ~inputs[port] & edgeSelects[port]);
+}
+
+bool SimGPIO_interruptPending(uint32_t port)
+{
+    return (interruptFlags[port] & interruptEnables[port]) != 0;
+}
+
+bool SimGPIO_getOutput(uint_fast8_t port, uint_fast16_t pin)
+{
+    SimGPIO_checkPort(port);
+    return (outputs[port] & pin) != 0;
+}
+
+void GPIO_setAsOutputPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    (void) selectedPins;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+}
+
+void GPIO_setAsInputPinWithPullUpResistor(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    (void) selectedPins;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+}
+
+void GPIO_setAsPeripheralModuleFunctionInputPin(uint_fast8_t selectedPort,
+                                                uint_fast16_t selectedPins, uint_fast8_t mode)
+{
+    (void) selectedPins;
+    (void) mode;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+}
+
+void GPIO_setAsPeripheralModuleFunctionOutputPin(uint_fast8_t selectedPort,
+                                                 uint_fast16_t selectedPins, uint_fast8_t mode)
+{
+    (void) selectedPins;
+    (void) mode;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+}
+
+void GPIO_setOutputHighOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    outputs[selectedPort] |= selectedPins;
+}
+
+void GPIO_setOutputLowOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    outputs[selectedPort] &= ~selectedPins;
+}
+
+void GPIO_toggleOutputOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    outputs[selectedPort] ^= selectedPins;
+}
+
+uint8_t GPIO_getInputPinValue(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    return (inputs[selectedPort] & selectedPins) ? GPIO_INPUT_PIN_HIGH : GPIO_INPUT_PIN_LOW;
+}
+
+void GPIO_enableInterrupt(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    interruptEnables[selectedPort] |= selectedPins;
+    Sim_dispatch();
+}
+
+void GPIO_disableInterrupt(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    interruptEnables[selectedPort] &= ~selectedPins;
+}
+
+void GPIO_interruptEdgeSelect(uint_fast8_t selectedPort, uint_fast16_t selectedPins, uint_fast8_t edgeSelect)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+
+    if (edgeSelect == GPIO_HIGH_TO_LOW_TRANSITION)
+    {
+        edgeSelects[selectedPort] |= selectedPins;
+    }
+    else
+    {
+        edgeSelects[selectedPort] &= ~selectedPins;
+    }
+}
+
+void GPIO_clearInterruptFlag(uint_fast8_t selectedPort, uint_fast16_t selectedPins)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    interruptFlags[selectedPort] &= ~selectedPins;
+}
+
+uint_fast16_t GPIO_getEnabledInterruptStatus(uint_fast8_t selectedPort)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimGPIO_checkPort(selectedPort);
+    return interruptFlags[selectedPort] & interruptEnables[selectedPort];
+}
@@ -0,0 +1,74 @@
+/*
+ * SimInternal.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * What the simulated peripherals share with the simulator core. Every
+ * peripheral keeps its own state and provides three functions to the core:
+ *
+ *   nextEvent()   the earliest time at which it changes on its own, or SIM_NEVER
+ *   advanceTo(t)  handles everything that happens up to and including time t
+ *   ...Pending()  whether one of its interrupt lines is raised
+ *
+ * The core steps the clock from event to event, so interrupts are taken at the
+ * moment their cause happens.
+ */
+
+#ifndef SIM_SIMINTERNAL_H_
+#define SIM_SIMINTERNAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <Sim/Sim.h>
+
+// The cost of one register access, including the loop around it when polling
+#define SIM_CYCLES_REGISTER         4
+
+// The cost of a driverlib call, which does a few register read-modify-writes
+#define SIM_CYCLES_DRIVERLIB_CALL   24
+
+// The cost of entering and leaving an interrupt handler on the Cortex-M4F
+#define SIM_CYCLES_IRQ_ENTRY        12
+#define SIM_CYCLES_IRQ_EXIT         12
+
+// The time from a uDMA request to the transfer of its byte
+#define SIM_CYCLES_DMA_TRANSFER     6
+
+// Reports a problem which would make the firmware misbehave on the board, and stops
+void Sim_fail(const char* format, ...);
+
+// Charges the cost of an access to the hardware, letting peripherals and interrupts run meanwhile
+void Sim_charge(uint32_t cycles);
+
+// Takes any interrupts which became pending because of a register write
+void Sim_dispatch(void);
+
+// Converts a number of SMCLK cycles into MCLK cycles, the simulator's time base
+double Sim_smclkToMclk(double smclkCycles);
+
+// Peripherals
+uint64_t SimTimer32_nextEvent(void);
+void SimTimer32_advanceTo(uint64_t now);
+bool SimTimer32_interruptPending(uint32_t timerIndex);
+
+uint64_t SimUART_nextEvent(void);
+void SimUART_advanceTo(uint64_t now);
+bool SimUART_interruptPending(void);
+
+uint64_t SimSPI_nextEvent(void);
+void SimSPI_advanceTo(uint64_t now);
+void SimSPI_commit(void);
+bool SimDMA_interruptPending(uint32_t interruptNumber);
+
+bool SimGPIO_interruptPending(uint32_t port);
+
+uint64_t SimSchedule_nextEvent(void);
+void SimSchedule_advanceTo(uint64_t now);
+
+// The LCD panel, which receives every byte eUSCI_B0 shifts out
+void SimLcd_receive(uint8_t data, bool isData);
+
+#endif /* SIM_SIMINTERNAL_H_ */
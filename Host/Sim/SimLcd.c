@@ -0,0 +1,124 @@
+/*
+ * SimLcd.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The ST7735 controller of the Crystalfontz panel, as far as the driver uses
+ * it: CASET and RASET set the address window, RAMWR streams 16-bit pixels into
+ * it row by row, and every other command and its parameters are accepted and
+ * ignored. Pixels are kept by their column and row address, which is what the
+ * driver computes; the panel's scan direction does not change what is stored.
+ */
+
+#include <Sim/SimInternal.h>
+#include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
+
+// The size of the controller's memory, and where the upright 128x128 screen sits in it
+#define GRAM_COLUMNS        132
+#define GRAM_ROWS           162
+#define SCREEN_COLUMN_OFFSET 2
+#define SCREEN_ROW_OFFSET   3
+
+static uint16_t gram[GRAM_ROWS][GRAM_COLUMNS];
+
+/** The command whose parameters are being received, and how many have arrived. */
+static uint8_t command = CM_NOP;
+static uint32_t parameterCount = 0;
+static uint8_t parameters[4];
+
+/** The address window and the next address RAMWR writes to. */
+static uint16_t columnStart = 0, columnEnd = GRAM_COLUMNS - 1;
+static uint16_t rowStart = 0, rowEnd = GRAM_ROWS - 1;
+static uint16_t column, row;
+
+/** The first byte of a pixel, until the second arrives. */
+static uint8_t pixelHigh;
+
+static uint64_t pixelsWritten = 0;
+
+static void SimLcd_writePixel(uint16_t pixel)
+{
+    if (column < GRAM_COLUMNS && row < GRAM_ROWS)
+    {
+        gram[row][column] = pixel;
+    }
+    pixelsWritten++;
+
+    if (++column > columnEnd)
+    {
+        column = columnStart;
+        if (++row > rowEnd)
+        {
+            row = rowStart;
+        }
+    }
+}
+
+void SimLcd_receive(uint8_t data, bool isData)
+{
+    if (!isData)
+    {
+        command = data;
+        parameterCount = 0;
+
+        if (command == CM_RAMWR)
+        {
+            column = columnStart;
+            row = rowStart;
+        }
+        return;
+    }
+
+    switch (command)
+    {
+        case CM_CASET:
+        case CM_RASET:
+            if (parameterCount < 4)
+            {
+                parameters[parameterCount] = data;
+            }
+            if (++parameterCount == 4)
+            {
+                uint16_t start = (parameters[0] << 8) | parameters[1];
+                uint16_t end = (parameters[2] << 8) | parameters[3];
+
+                if (command == CM_CASET)
+                {
+                    columnStart = start;
+                    columnEnd = end;
+                }
+                else
+                {
+                    rowStart = start;
+                    rowEnd = end;
+                }
+            }
+            break;
+
+        case CM_RAMWR:
+            if (parameterCount++ % 2 == 0)
+            {
+                pixelHigh = data;
+            }
+            else
+            {
+                SimLcd_writePixel((pixelHigh << 8) | data);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint16_t SimLcd_getPixel(int x, int y)
+{
+    Sim_now();
+    return gram[y + SCREEN_ROW_OFFSET][x + SCREEN_COLUMN_OFFSET];
+}
+
+uint64_t SimLcd_pixelsWritten(void)
+{
+    Sim_now();
+    return pixelsWritten;
+}
@@ -0,0 +1,392 @@
+/*
+ * SimSPI.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * eUSCI_B0 simulated as the LCD's SPI master, and the uDMA channel that can
+ * feed it.
+ *
+ * The transmitter is a transmit buffer in front of a shift register. A byte
+ * written into the empty buffer moves into the idle shift register at once,
+ * which empties the buffer again (UCTXIFG) while the byte takes 8 SPI clocks to
+ * shift out; UCBUSY stays set as long as either holds a byte. A byte written
+ * while UCTXIFG is clear replaces the one waiting in the buffer, which is lost
+ * and counted.
+ *
+ * The LCD driver writes UCB0TXBUF through a pointer, so the simulator only
+ * learns the value at the next access to the hardware. Since no simulated time
+ * passes in between, the write is then applied at the time it was made.
+ *
+ * Channel 0 of the uDMA controller, mapped to the eUSCI_B0 transmit trigger,
+ * moves one byte into the transmit buffer every time UCTXIFG is set, until its
+ * transfer is done; then it raises the interrupt it was assigned to.
+ */
+
+#include <Sim/SimInternal.h>
+#include <HAL/LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h>
+
+#define SPI_TXBUF_ADDRESS           (EUSCI_B0_BASE + 0x0E)
+#define SPI_NO_WRITE                0xFFFF
+
+#define DMA_NUM_CHANNELS            8
+#define DMA_MAX_TRANSFER            1024
+#define DMA_CONTROL_TABLE_ALIGNMENT 1024
+#define DMA_SPI_CHANNEL             0
+#define DMA_SPI_MAPPING             (DMA_CH0_EUSCIB0TX0 >> 24)
+
+/** The SPI module. It starts out held in reset. */
+static bool spiEnabled = false;
+static uint32_t spiPrescaler = 1;
+static bool txifg = true;
+static bool rxifg = false;
+
+/** The value of the last write to UCB0TXBUF, until it has been applied. */
+static volatile uint16_t stagedWrite = SPI_NO_WRITE;
+
+/** The transmitter. Each byte is shifted out with the state of the LCD's DC and CS lines at its start. */
+static uint8_t txbuf;
+static bool txbufFull = false;
+static bool shifting = false;
+static uint8_t shiftByte;
+static bool shiftIsData;
+static bool shiftSelected;
+static uint64_t shiftEnd;
+
+static uint64_t bytesSent = 0;
+static uint32_t overwrites = 0;
+
+/** The uDMA controller. */
+static bool dmaEnabled = false;
+static uint8_t dmaMapping[DMA_NUM_CHANNELS];
+static uint32_t dmaAttributes[DMA_NUM_CHANNELS];
+static uint32_t dmaInterruptFlags = 0;
+static uint32_t dmaInterruptChannel[3] = { DMA_NUM_CHANNELS, DMA_NUM_CHANNELS, DMA_NUM_CHANNELS };
+
+/** The transfer on the SPI channel, and the time of its next byte if a request is waiting. */
+static bool channelEnabled = false;
+static uint32_t channelControl;
+static const volatile uint8_t* channelSource;
+static uint32_t channelRemaining = 0;
+static bool requestPending = false;
+static uint64_t requestTime;
+
+/** Raises a uDMA request for the SPI channel if it is armed and the transmit buffer is empty. */
+static void SimDMA_request(uint64_t now)
+{
+    if (dmaEnabled && channelEnabled && channelRemaining > 0 && txifg && !requestPending &&
+        !(dmaAttributes[DMA_SPI_CHANNEL] & UDMA_ATTR_REQMASK))
+    {
+        requestPending = true;
+        requestTime = now + SIM_CYCLES_DMA_TRANSFER;
+    }
+}
+
+static void SimSPI_startShift(uint64_t now)
+{
+    shiftByte = txbuf;
+    shiftIsData = SimGPIO_getOutput(LCD_DC_PORT, LCD_DC_PIN);
+    shiftSelected = !SimGPIO_getOutput(LCD_CS_PORT, LCD_CS_PIN);
+    txbufFull = false;
+    txifg = true;
+
+    shifting = true;
+    shiftEnd = now + (uint64_t) (Sim_smclkToMclk(8.0 * spiPrescaler) + 0.5);
+
+    SimDMA_request(now);
+}
+
+/** A write into the transmit buffer, by the CPU or the uDMA controller. */
+static void SimSPI_write(uint8_t data, uint64_t now)
+{
+    if (!spiEnabled)
+    {
+        return;
+    }
+
+    if (!txifg)
+    {
+        overwrites++;
+    }
+
+    txbuf = data;
+    txbufFull = true;
+    txifg = false;
+
+    if (!shifting)
+    {
+        SimSPI_startShift(now);
+    }
+}
+
+void SimSPI_commit(void)
+{
+    if (stagedWrite != SPI_NO_WRITE)
+    {
+        uint8_t data = (uint8_t) stagedWrite;
+
+        stagedWrite = SPI_NO_WRITE;
+        SimSPI_write(data, Sim_now());
+    }
+}
+
+uint64_t SimSPI_nextEvent(void)
+{
+    uint64_t next = SIM_NEVER;
+
+    if (shifting)
+    {
+        next = shiftEnd;
+    }
+    if (requestPending && requestTime < next)
+    {
+        next = requestTime;
+    }
+    return next;
+}
+
+void SimSPI_advanceTo(uint64_t now)
+{
+    for (;;)
+    {
+        if (shifting && shiftEnd <= now && (!requestPending || shiftEnd <= requestTime))
+        {
+            if (shiftSelected)
+            {
+                SimLcd_receive(shiftByte, shiftIsData);
+            }
+            bytesSent++;
+            rxifg = true;
+
+            shifting = false;
+            if (txbufFull)
+            {
+                SimSPI_startShift(shiftEnd);
+            }
+        }
+        else if (requestPending && requestTime <= now)
+        {
+            uint64_t time = requestTime;
+            uint8_t data = *channelSource;
+
+            requestPending = false;
+            if (!(channelControl & UDMA_SRC_INC_NONE))
+            {
+                channelSource++;
+            }
+
+            if (--channelRemaining == 0)
+            {
+                channelEnabled = false;
+                dmaInterruptFlags |= 1u << DMA_SPI_CHANNEL;
+            }
+
+            SimSPI_write(data, time);
+            SimDMA_request(time);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+uint64_t SimSPI_bytesSent(void)
+{
+    Sim_now();
+    return bytesSent;
+}
+
+uint32_t SimSPI_overwrites(void)
+{
+    Sim_now();
+    return overwrites;
+}
+
+// -----------------------------------------------------------------------------
+// Registers and driverlib
+// -----------------------------------------------------------------------------
+
+volatile uint16_t *SimSPI_txbuf(void)
+{
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return &stagedWrite;
+}
+
+uint16_t SimSPI_statw(void)
+{
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return (shifting || txbufFull) ? UCBUSY : 0;
+}
+
+uint16_t SimSPI_ifg(void)
+{
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return (txifg ? UCTXIFG : 0) | (rxifg ? UCRXIFG : 0);
+}
+
+bool SPI_initMaster(uint32_t moduleInstance, const eUSCI_SPI_MasterConfig *config)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if (moduleInstance != EUSCI_B0_BASE)
+    {
+        Sim_fail("only eUSCI_B0 is simulated as an SPI master, not %#x", moduleInstance);
+    }
+    if (config->desiredSpiClock == 0 || config->clockSourceFrequency < config->desiredSpiClock)
+    {
+        Sim_fail("SPI_initMaster() cannot make a %u Hz clock from %u Hz",
+                 config->desiredSpiClock, config->clockSourceFrequency);
+    }
+
+    spiPrescaler = config->clockSourceFrequency / config->desiredSpiClock;
+    spiEnabled = false;
+    txifg = true;
+    txbufFull = false;
+    shifting = false;
+
+    return true;
+}
+
+void SPI_enableModule(uint32_t moduleInstance)
+{
+    (void) moduleInstance;
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    spiEnabled = true;
+}
+
+uint32_t SPI_getTransmitBufferAddressForDMA(uint32_t moduleInstance)
+{
+    (void) moduleInstance;
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    return SPI_TXBUF_ADDRESS;
+}
+
+void DMA_enableModule(void)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    dmaEnabled = true;
+}
+
+/** The controller requires its control table to be aligned to 1024 bytes. */
+void DMA_setControlBase(void *controlTable)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if ((uintptr_t) controlTable % DMA_CONTROL_TABLE_ALIGNMENT != 0)
+    {
+        Sim_fail("the uDMA control table at %p is not aligned to %u bytes",
+                 controlTable, DMA_CONTROL_TABLE_ALIGNMENT);
+    }
+}
+
+void DMA_assignChannel(uint32_t mapping)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    dmaMapping[(mapping & 0xFF) % DMA_NUM_CHANNELS] = mapping >> 24;
+}
+
+void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    dmaAttributes[channelNum & 0x07] &= ~attr;
+}
+
+void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if (interruptNumber < DMA_INT3 || interruptNumber > DMA_INT1)
+    {
+        Sim_fail("DMA_assignInterrupt() only routes channels to DMA_INT1..3, not %u", interruptNumber);
+    }
+    dmaInterruptChannel[DMA_INT1 - interruptNumber] = channel;
+}
+
+void DMA_clearInterruptFlag(uint32_t intChannel)
+{
+    Sim_charge(SIM_CYCLES_REGISTER);
+    dmaInterruptFlags &= ~(1u << (intChannel & 0x07));
+}
+
+/** DMA_INT1..3 follow the channel assigned to them, DMA_INT0 every other channel. */
+bool SimDMA_interruptPending(uint32_t interruptNumber)
+{
+    uint32_t flags = dmaInterruptFlags;
+    uint32_t i;
+
+    if (interruptNumber != DMA_INT0)
+    {
+        uint32_t channel = dmaInterruptChannel[DMA_INT1 - interruptNumber];
+        return channel < DMA_NUM_CHANNELS && (flags & (1u << channel));
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        if (dmaInterruptChannel[i] < DMA_NUM_CHANNELS)
+        {
+            flags &= ~(1u << dmaInterruptChannel[i]);
+        }
+    }
+    return flags != 0;
+}
+
+static void SimDMA_checkChannel(uint32_t channelStructIndex)
+{
+    if ((channelStructIndex & 0x07) != DMA_SPI_CHANNEL || (channelStructIndex & UDMA_ALT_SELECT))
+    {
+        Sim_fail("only the primary structure of uDMA channel %u is simulated", DMA_SPI_CHANNEL);
+    }
+}
+
+void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimDMA_checkChannel(channelStructIndex);
+    channelControl = control;
+}
+
+void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode,
+                            void *srcAddr, void *dstAddr, uint32_t transferSize)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimDMA_checkChannel(channelStructIndex);
+
+    if (mode != UDMA_MODE_BASIC)
+    {
+        Sim_fail("only basic mode uDMA transfers are simulated");
+    }
+    if ((uintptr_t) dstAddr != SPI_TXBUF_ADDRESS || !(channelControl & UDMA_DST_INC_NONE))
+    {
+        Sim_fail("uDMA channel %u can only write to the eUSCI_B0 transmit buffer", DMA_SPI_CHANNEL);
+    }
+    if (transferSize == 0 || transferSize > DMA_MAX_TRANSFER)
+    {
+        Sim_fail("a uDMA transfer must move 1 to %u items, not %u", DMA_MAX_TRANSFER, transferSize);
+    }
+
+    channelSource = (const volatile uint8_t*) srcAddr;
+    channelRemaining = transferSize;
+}
+
+void DMA_enableChannel(uint32_t channelNum)
+{
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    SimDMA_checkChannel(channelNum);
+
+    if (dmaMapping[DMA_SPI_CHANNEL] != DMA_SPI_MAPPING)
+    {
+        Sim_fail("uDMA channel %u is enabled without being mapped to the eUSCI_B0 transmit trigger",
+                 DMA_SPI_CHANNEL);
+    }
+
+    channelEnabled = true;
+    SimDMA_request(Sim_now());
+}
+
+bool DMA_isChannelEnabled(uint32_t channelNum)
+{
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return (channelNum & 0x07) == DMA_SPI_CHANNEL && channelEnabled;
+}
@@ -0,0 +1,161 @@
+/*
+ * SimSchedule.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Events the test side schedules ahead of time: a button going down, a byte
+ * from the PC, anything that happens to the board from the outside. They are
+ * kept in a binary min-heap by time, and events at the same time by the order
+ * they were scheduled, so a run with the same schedule is the same run every
+ * time. To the core they are one more peripheral whose next event is the top
+ * of the heap.
+ */
+
+#include <stdlib.h>
+
+#include <Sim/SimInternal.h>
+
+#define INITIAL_CAPACITY 64
+
+struct _SimEvent
+{
+    uint64_t time;
+    uint64_t sequence;      // Breaks ties between events at the same time
+    SimEventHandler handler;
+    void* context;
+    uint32_t argument;
+};
+typedef struct _SimEvent SimEvent;
+
+static SimEvent* heap = NULL;
+static uint32_t heapSize = 0, heapCapacity = 0;
+static uint64_t nextSequence = 0;
+
+static bool SimSchedule_before(const SimEvent* a, const SimEvent* b)
+{
+    return a->time < b->time || (a->time == b->time && a->sequence < b->sequence);
+}
+
+static void SimSchedule_swap(uint32_t i, uint32_t j)
+{
+    SimEvent event = heap[i];
+
+    heap[i] = heap[j];
+    heap[j] = event;
+}
+
+static void SimSchedule_siftUp(uint32_t i)
+{
+    while (i > 0 && SimSchedule_before(&heap[i], &heap[(i - 1) / 2]))
+    {
+        SimSchedule_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+static void SimSchedule_siftDown(uint32_t i)
+{
+    for (;;)
+    {
+        uint32_t smallest = i;
+        uint32_t left = 2 * i + 1, right = 2 * i + 2;
+
+        if (left < heapSize && SimSchedule_before(&heap[left], &heap[smallest]))
+        {
+            smallest = left;
+        }
+        if (right < heapSize && SimSchedule_before(&heap[right], &heap[smallest]))
+        {
+            smallest = right;
+        }
+        if (smallest == i)
+        {
+            return;
+        }
+        SimSchedule_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+void Sim_schedule(uint64_t time, SimEventHandler handler, void* context, uint32_t argument)
+{
+    if (time < Sim_now())
+    {
+        Sim_fail("an event was scheduled at cycle %llu, which has already passed",
+                 (unsigned long long) time);
+    }
+
+    if (heapSize == heapCapacity)
+    {
+        uint32_t capacity = heapCapacity ? 2 * heapCapacity : INITIAL_CAPACITY;
+        SimEvent* grown = realloc(heap, capacity * sizeof(SimEvent));
+
+        if (grown == NULL)
+        {
+            Sim_fail("out of memory for %u scheduled events", capacity);
+        }
+        heap = grown;
+        heapCapacity = capacity;
+    }
+
+    heap[heapSize].time = time;
+    heap[heapSize].sequence = nextSequence++;
+    heap[heapSize].handler = handler;
+    heap[heapSize].context = context;
+    heap[heapSize].argument = argument;
+    SimSchedule_siftUp(heapSize++);
+}
+
+uint32_t Sim_scheduledEvents(void)
+{
+    return heapSize;
+}
+
+uint64_t SimSchedule_nextEvent(void)
+{
+    return heapSize ? heap[0].time : SIM_NEVER;
+}
+
+/** Runs every event due by now. An event may schedule more, which run in this call if they are due too. */
+void SimSchedule_advanceTo(uint64_t now)
+{
+    while (heapSize > 0 && heap[0].time <= now)
+    {
+        SimEvent event = heap[0];
+
+        heap[0] = heap[--heapSize];
+        SimSchedule_siftDown(0);
+
+        event.handler(event.context, event.argument);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Common events
+// -----------------------------------------------------------------------------
+
+static void SimGPIO_inputEvent(void* context, uint32_t argument)
+{
+    (void) context;
+
+    SimGPIO_setInput(argument >> 24, (argument >> 1) & 0xFFFF, argument & 1);
+}
+
+void SimGPIO_scheduleInput(uint64_t time, uint_fast8_t port, uint_fast16_t pins, bool high)
+{
+    Sim_schedule(time, SimGPIO_inputEvent, NULL, ((uint32_t) port << 24) | ((uint32_t) pins << 1) | high);
+}
+
+static void SimUART_sendEvent(void* context, uint32_t argument)
+{
+    uint8_t data = (uint8_t) argument;
+
+    (void) context;
+
+    SimUART_send(&data, 1);
+}
+
+void SimUART_scheduleSend(uint64_t time, uint8_t data)
+{
+    Sim_schedule(time, SimUART_sendEvent, NULL, data);
+}
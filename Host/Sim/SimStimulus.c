@@ -0,0 +1,170 @@
+/*
+ * SimStimulus.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stddef.h>
+
+#include <Sim/Sim.h>
+#include <Sim/SimStimulus.h>
+
+// A small xorshift generator; its state must never be zero
+static uint64_t randomState = 1;
+
+// When a button pin last changed, and the first change the benchmark has not taken yet
+static uint64_t lastEdge = 0;
+static uint64_t firstEdge = 0;
+static bool edgeWaiting = false;
+
+// The characters the PC sent, with the time each is complete at the board
+static struct
+{
+    char data;
+    uint64_t ready;
+} expectedChars[SIM_STIMULUS_CHARS_SIZE];
+static uint32_t expectedHead = 0, expectedTail = 0;
+
+void SimStimulus_seed(uint64_t seed)
+{
+    randomState = seed | 1;
+}
+
+uint32_t SimStimulus_random(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    return (uint32_t) (randomState >> 32);
+}
+
+uint64_t SimStimulus_randomBetween(uint64_t low, uint64_t high)
+{
+    return low + SimStimulus_random() % (high - low + 1);
+}
+
+/** The argument holds the port, the pin and the level. */
+static void SimStimulus_edge(void* context, uint32_t argument)
+{
+    (void) context;
+
+    SimGPIO_setInput(argument >> 24, (argument >> 8) & 0xFFFF, argument & 1);
+
+    lastEdge = Sim_now();
+    if (!edgeWaiting)
+    {
+        edgeWaiting = true;
+        firstEdge = lastEdge;
+    }
+}
+
+uint64_t SimStimulus_scheduleEdge(uint64_t time, uint_fast8_t port, uint_fast16_t pin, bool high)
+{
+    uint64_t cyclesPerUs = Sim_mclkFrequency() / 1000000;
+    uint32_t pinArgument = ((uint32_t) port << 24) | ((uint32_t) pin << 8);
+    uint32_t bounces = SimStimulus_random() % (SIM_STIMULUS_MAX_BOUNCES + 1);
+    uint32_t i;
+
+    for (i = 0; i < 2 * bounces; i++)
+    {
+        Sim_schedule(time, SimStimulus_edge, NULL, pinArgument | ((i % 2 == 0) ? high : !high));
+        time += SimStimulus_randomBetween(SIM_STIMULUS_BOUNCE_GAP_US) * cyclesPerUs;
+    }
+    Sim_schedule(time, SimStimulus_edge, NULL, pinArgument | high);
+    return time;
+}
+
+uint32_t SimStimulus_schedulePresses(uint64_t start, uint64_t end, uint_fast8_t port, uint_fast16_t pin,
+                                     uint32_t gapMsLow, uint32_t gapMsHigh,
+                                     uint32_t holdMsLow, uint32_t holdMsHigh)
+{
+    uint64_t cyclesPerMs = Sim_mclkFrequency() / 1000;
+    uint32_t presses = 0;
+    uint64_t time;
+
+    for (time = start + SimStimulus_randomBetween(gapMsLow, gapMsHigh) * cyclesPerMs; time < end;
+         time += SimStimulus_randomBetween(gapMsLow, gapMsHigh) * cyclesPerMs)
+    {
+        time = SimStimulus_scheduleEdge(time, port, pin, false) +
+               SimStimulus_randomBetween(holdMsLow, holdMsHigh) * cyclesPerMs;
+        time = SimStimulus_scheduleEdge(time, port, pin, true);
+        presses++;
+    }
+    return presses;
+}
+
+uint64_t SimStimulus_lastEdge(void)
+{
+    return lastEdge;
+}
+
+bool SimStimulus_takeEdge(uint64_t before, uint64_t* time_p)
+{
+    if (!edgeWaiting || firstEdge > before)
+    {
+        return false;
+    }
+
+    edgeWaiting = false;
+    *time_p = firstEdge;
+    return true;
+}
+
+/**
+ * The receiver raises its flag in the middle of the stop bit, which is when
+ * the board can first read a character.
+ */
+static void SimStimulus_scheduleChar(uint64_t time, uint32_t index, char data, uint32_t baud)
+{
+    expectedChars[expectedHead % SIM_STIMULUS_CHARS_SIZE].data = data;
+    expectedChars[expectedHead % SIM_STIMULUS_CHARS_SIZE].ready =
+        time + (uint64_t) Sim_mclkFrequency() * (2 * SIM_STIMULUS_BITS_PER_CHAR * (index + 1) - 1) / (2 * baud);
+    expectedHead++;
+
+    SimUART_scheduleSend(time, data);
+}
+
+void SimStimulus_scheduleChars(uint64_t time, uint32_t count, uint32_t baud)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        SimStimulus_scheduleChar(time, i, 'a' + SimStimulus_random() % 26, baud);
+    }
+}
+
+void SimStimulus_scheduleText(uint64_t time, const char* text, uint32_t length, uint32_t baud)
+{
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        SimStimulus_scheduleChar(time, i, text[i], baud);
+    }
+}
+
+uint32_t SimStimulus_charRoom(void)
+{
+    return SIM_STIMULUS_CHARS_SIZE - (expectedHead - expectedTail);
+}
+
+bool SimStimulus_checkChar(char data, uint64_t* latency_p)
+{
+    bool match = data == expectedChars[expectedTail % SIM_STIMULUS_CHARS_SIZE].data;
+
+    *latency_p = Sim_now() - expectedChars[expectedTail % SIM_STIMULUS_CHARS_SIZE].ready;
+    expectedTail++;
+    return match;
+}
+
+uint32_t SimStimulus_lostChars(uint64_t graceCycles)
+{
+    uint32_t lost = 0;
+
+    for (; expectedTail != expectedHead; expectedTail++)
+    {
+        lost += expectedChars[expectedTail % SIM_STIMULUS_CHARS_SIZE].ready + graceCycles < Sim_now();
+    }
+    return lost;
+}
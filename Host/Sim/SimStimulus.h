@@ -0,0 +1,72 @@
+/*
+ * SimStimulus.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The outside world the simulator benchmarks share: a seeded generator, so a
+ * schedule is the same on every host, presses of a button with contact
+ * bounce, and characters from the PC together with the queue of what was
+ * sent, which the benchmark checks what the board reads against. Each
+ * benchmark keeps only its own checks.
+ */
+
+#ifndef SIM_SIMSTIMULUS_H_
+#define SIM_SIMSTIMULUS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The contact bounce before each edge of a press: up to this many bounces, this many us apart
+#define SIM_STIMULUS_MAX_BOUNCES        5
+#define SIM_STIMULUS_BOUNCE_GAP_US      20, 300
+
+// How many characters may be sent and not yet read
+#define SIM_STIMULUS_CHARS_SIZE         256
+
+// The bits of a character on the line: start, 8 data bits, stop
+#define SIM_STIMULUS_BITS_PER_CHAR      10
+
+// Seeds the generator. The same seed gives the same schedule on every host.
+void SimStimulus_seed(uint64_t seed);
+
+// Returns the next number of the generator
+uint32_t SimStimulus_random(void);
+
+// Returns a number of the generator from low to high, both included
+uint64_t SimStimulus_randomBetween(uint64_t low, uint64_t high);
+
+// Schedules an edge of a button pin, preceded by contact bounce. Returns the time the level settles.
+uint64_t SimStimulus_scheduleEdge(uint64_t time, uint_fast8_t port, uint_fast16_t pin, bool high);
+
+// Schedules presses of a button from start on, each gapMs apart and held for holdMs, both drawn from
+// low to high. Every press is released before end, so each should count as exactly one tap. Returns
+// how many presses were scheduled.
+uint32_t SimStimulus_schedulePresses(uint64_t start, uint64_t end, uint_fast8_t port, uint_fast16_t pin,
+                                     uint32_t gapMsLow, uint32_t gapMsHigh,
+                                     uint32_t holdMsLow, uint32_t holdMsHigh);
+
+// Returns the time a button pin last changed, bounce included
+uint64_t SimStimulus_lastEdge(void);
+
+// Takes the first edge since the last one taken, if it came no later than the given time, and
+// returns true with its time. An edge which came later is left for the next call.
+bool SimStimulus_takeEdge(uint64_t before, uint64_t* time_p);
+
+// Schedules count random letters, sent back to back from the given time at the given baudrate
+void SimStimulus_scheduleChars(uint64_t time, uint32_t count, uint32_t baud);
+
+// Schedules the given characters, sent back to back from the given time at the given baudrate
+void SimStimulus_scheduleText(uint64_t time, const char* text, uint32_t length, uint32_t baud);
+
+// Returns how many more characters may be scheduled before the queue of those sent is full
+uint32_t SimStimulus_charRoom(void);
+
+// Checks a character the board read against the oldest one sent. Returns whether it matches, and
+// sets *latency_p to the cycles since the character was complete at the board.
+bool SimStimulus_checkChar(char data, uint64_t* latency_p);
+
+// Empties the queue of characters sent, and returns how many of them were complete at the board
+// more than graceCycles ago and were never read
+uint32_t SimStimulus_lostChars(uint64_t graceCycles);
+
+#endif /* SIM_SIMSTIMULUS_H_ */
@@ -0,0 +1,207 @@
+/*
+ * SimTimer32.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * The two simulated Timer32 down-counters, clocked by MCLK. Like the hardware,
+ * a counter raises its interrupt when it reaches zero, and on the next tick
+ * either reloads (periodic mode), wraps to its maximum (free-running mode) or
+ * stops (one-shot). The counter value is computed from the time it was started,
+ * so reading it costs nothing no matter how long the timer has been running.
+ */
+
+#include <Sim/SimInternal.h>
+
+#define NUM_TIMERS 2
+
+struct _SimTimer32
+{
+    uint32_t load;          // The reload value
+    uint32_t mask;          // 0xFFFF in 16-bit mode, 0xFFFFFFFF in 32-bit mode
+    uint32_t prescaleShift; // log2 of the prescaler
+    bool periodic;          // Reload from load (true) or wrap to mask (false) after zero
+    bool oneShot;           // Stop at zero
+
+    bool running;
+    uint32_t startValue;    // The counter value when it was started, or its value while halted
+    uint64_t startTime;     // The time it was started
+
+    uint64_t nextZeroTick;  // The number of ticks after startTime at which it next reaches zero
+    bool interruptFlag;
+};
+typedef struct _SimTimer32 SimTimer32;
+
+static SimTimer32 timers[NUM_TIMERS] =
+{
+    { 0, 0xFFFFFFFF, 0, false, false, false, 0xFFFFFFFF, 0, 0, false },
+    { 0, 0xFFFFFFFF, 0, false, false, false, 0xFFFFFFFF, 0, 0, false },
+};
+
+static SimTimer32* SimTimer32_get(uint32_t timer)
+{
+    switch (timer)
+    {
+        case TIMER32_0_BASE:
+            return &timers[0];
+        case TIMER32_1_BASE:
+            return &timers[1];
+        default:
+            Sim_fail("%#x is not a Timer32 base address", timer);
+            return NULL;
+    }
+}
+
+/** The number of ticks from one zero to the next. */
+static uint64_t SimTimer32_period(SimTimer32* t)
+{
+    return (uint64_t) (t->periodic ? t->load : t->mask) + 1;
+}
+
+static uint64_t SimTimer32_timeOfTick(SimTimer32* t, uint64_t tick)
+{
+    return t->startTime + (tick << t->prescaleShift);
+}
+
+static uint32_t SimTimer32_value(SimTimer32* t, uint64_t now)
+{
+    uint64_t ticks;
+
+    if (!t->running)
+    {
+        return t->startValue;
+    }
+
+    ticks = (now - t->startTime) >> t->prescaleShift;
+    if (ticks <= t->startValue)
+    {
+        return t->startValue - (uint32_t) ticks;
+    }
+
+    return (t->periodic ? t->load : t->mask) -
+           (uint32_t) ((ticks - t->startValue - 1) % SimTimer32_period(t));
+}
+
+/** Restarts counting down from value, as a write to the load register does. */
+static void SimTimer32_restart(SimTimer32* t, uint32_t value)
+{
+    t->startValue = value & t->mask;
+    t->startTime = Sim_now();
+    t->nextZeroTick = t->startValue;
+}
+
+uint64_t SimTimer32_nextEvent(void)
+{
+    uint64_t next = SIM_NEVER;
+    uint32_t i;
+
+    for (i = 0; i < NUM_TIMERS; i++)
+    {
+        if (timers[i].running)
+        {
+            uint64_t zero = SimTimer32_timeOfTick(&timers[i], timers[i].nextZeroTick);
+            next = (zero < next) ? zero : next;
+        }
+    }
+    return next;
+}
+
+void SimTimer32_advanceTo(uint64_t now)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_TIMERS; i++)
+    {
+        SimTimer32* t = &timers[i];
+
+        while (t->running && SimTimer32_timeOfTick(t, t->nextZeroTick) <= now)
+        {
+            t->interruptFlag = true;
+
+            if (t->oneShot)
+            {
+                t->running = false;
+                t->startValue = 0;
+            }
+            else
+            {
+                t->nextZeroTick += SimTimer32_period(t);
+            }
+        }
+    }
+}
+
+bool SimTimer32_interruptPending(uint32_t timerIndex)
+{
+    return timers[timerIndex].interruptFlag;
+}
+
+void Timer32_initModule(uint32_t timer, uint32_t preScaler, uint32_t resolution, uint32_t mode)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    t->startValue = SimTimer32_value(t, Sim_now());
+    t->running = false;
+    t->prescaleShift = (preScaler == TIMER32_PRESCALER_256) ? 8 : (preScaler == TIMER32_PRESCALER_16) ? 4 : 0;
+    t->mask = (resolution == TIMER32_32BIT) ? 0xFFFFFFFF : 0xFFFF;
+    t->periodic = (mode == TIMER32_PERIODIC_MODE);
+}
+
+void Timer32_setCount(uint32_t timer, uint32_t count)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+
+    t->load = count & t->mask;
+    SimTimer32_restart(t, count);
+}
+
+void Timer32_startTimer(uint32_t timer, bool oneShot)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    t->oneShot = oneShot;
+    if (!t->running)
+    {
+        t->running = true;
+        SimTimer32_restart(t, t->startValue);
+    }
+}
+
+void Timer32_haltTimer(uint32_t timer)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    t->startValue = SimTimer32_value(t, Sim_now());
+    t->running = false;
+}
+
+uint32_t Timer32_getValue(uint32_t timer)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return SimTimer32_value(t, Sim_now());
+}
+
+void Timer32_clearInterruptFlag(uint32_t timer)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    t->interruptFlag = false;
+}
+
+uint32_t Timer32_getInterruptStatus(uint32_t timer)
+{
+    SimTimer32* t = SimTimer32_get(timer);
+
+    Sim_charge(SIM_CYCLES_REGISTER);
+    return t->interruptFlag;
+}
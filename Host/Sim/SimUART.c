@@ -0,0 +1,381 @@
+/*
+ * SimUART.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * eUSCI_A0 simulated as a UART, connected to a PC running at a fixed baudrate.
+ *
+ * The module's bit time comes from its registers exactly as on the chip: in
+ * oversampling mode 16 * UCBRx + UCBRFx clocks, plus one clock on the bits
+ * UCBRSx selects. Each frame is a start bit, 8 data bits and a stop bit, and a
+ * receiver samples the middle of each bit by its own bit time. If the two ends
+ * disagree on the baudrate, the receiver samples the wrong bits and misses the
+ * stop bit, just as a real terminal shows garbage, so a wrong entry in the
+ * baudrate tables of UART_SetBaud_Enable() shows up without a board.
+ */
+
+#include <Sim/SimInternal.h>
+
+// Size of the queues between the PC and the module. Must be powers of two.
+#define LINE_QUEUE_SIZE     1024
+#define PC_RECEIVE_SIZE     4096
+
+#define BITS_PER_FRAME      10
+
+#define UART_IFG_RX         EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG
+#define UART_IFG_TX         EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG
+
+/** The module's registers. It starts out held in reset. */
+static eUSCI_UART_ConfigV1 config;
+static bool enabled = false;
+static uint8_t ie = 0;
+static uint8_t ifg = UART_IFG_TX;
+static uint8_t statw = 0;
+static uint8_t rxbuf = 0;
+
+/** The transmitter: the transmit buffer and the byte being shifted out, with the bit time it goes out at. */
+static uint8_t txbuf;
+static bool txbufFull = false;
+static bool shifting = false;
+static uint8_t shiftByte;
+static double shiftBitCycles;
+static uint64_t shiftEnd;
+
+/** The PC side of the line. */
+static uint32_t lineBaud = 9600;
+static uint64_t lineFreeAt = 0;
+
+/** Bytes the PC is sending, with the time their start bit begins. */
+static struct
+{
+    uint8_t data;
+    uint64_t start;
+} lineQueue[LINE_QUEUE_SIZE];
+static uint32_t lineHead = 0, lineTail = 0;
+
+/** Bytes the PC has received. */
+static uint8_t pcReceived[PC_RECEIVE_SIZE];
+static uint32_t pcHead = 0, pcTail = 0;
+static uint32_t pcFramingErrors = 0;
+
+static void SimUART_check(uint32_t moduleInstance)
+{
+    if (moduleInstance != EUSCI_A0_BASE)
+    {
+        Sim_fail("only eUSCI_A0 is simulated as a UART, not %#x", moduleInstance);
+    }
+}
+
+static uint32_t SimUART_clockFrequency(void)
+{
+    return (config.selectClockSource == EUSCI_A_UART_CLOCKSOURCE_SMCLK) ? Sim_smclkFrequency() : 32768;
+}
+
+/** The bit time the module's divider settings produce, in cycles of its clock. */
+static double SimUART_bitClocks(void)
+{
+    double modulation = __builtin_popcount(config.secondModReg) / 8.0;
+
+    if (config.overSampling == EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION)
+    {
+        return 16.0 * config.clockPrescalar + config.firstModReg + modulation;
+    }
+    return config.clockPrescalar + modulation;
+}
+
+/** The module's bit time in MCLK cycles. */
+static double SimUART_bitCycles(void)
+{
+    return SimUART_bitClocks() * Sim_mclkFrequency() / SimUART_clockFrequency();
+}
+
+/** The PC's bit time in MCLK cycles. */
+static double SimUART_lineBitCycles(void)
+{
+    return (double) Sim_mclkFrequency() / lineBaud;
+}
+
+/** The level a frame carrying data has a number of sender bit times after its start edge. */
+static bool SimUART_levelAt(uint8_t data, double bitPosition)
+{
+    int bit = (int) bitPosition;
+
+    if (bit == 0)
+    {
+        return false;
+    }
+    if (bit <= 8)
+    {
+        return (data >> (bit - 1)) & 1;
+    }
+    return true;
+}
+
+/** What a receiver with one bit time reads from a frame sent with another. */
+static uint8_t SimUART_sample(uint8_t data, double senderBit, double receiverBit, bool* framingError)
+{
+    uint8_t result = 0;
+    int bit;
+
+    for (bit = 0; bit < 8; bit++)
+    {
+        if (SimUART_levelAt(data, (bit + 1.5) * receiverBit / senderBit))
+        {
+            result |= 1 << bit;
+        }
+    }
+
+    *framingError = !SimUART_levelAt(data, 9.5 * receiverBit / senderBit);
+    return result;
+}
+
+/** Moves the transmit buffer into the shift register at time start. */
+static void SimUART_startShift(uint64_t start)
+{
+    shiftByte = txbuf;
+    txbufFull = false;
+    ifg |= UART_IFG_TX;
+
+    shifting = true;
+    shiftBitCycles = SimUART_bitCycles();
+    shiftEnd = start + (uint64_t) (BITS_PER_FRAME * shiftBitCycles + 0.5);
+}
+
+/** The time at which the module samples the stop bit of the next byte from the PC. */
+static uint64_t SimUART_nextArrival(void)
+{
+    if (lineHead == lineTail)
+    {
+        return SIM_NEVER;
+    }
+    return lineQueue[lineTail % LINE_QUEUE_SIZE].start + (uint64_t) (9.5 * SimUART_bitCycles() + 0.5);
+}
+
+uint64_t SimUART_nextEvent(void)
+{
+    uint64_t next = SimUART_nextArrival();
+
+    if (shifting && shiftEnd < next)
+    {
+        next = shiftEnd;
+    }
+    return next;
+}
+
+void SimUART_advanceTo(uint64_t now)
+{
+    for (;;)
+    {
+        uint64_t arrival = SimUART_nextArrival();
+        bool framingError;
+
+        if (shifting && shiftEnd <= now && shiftEnd <= arrival)
+        {
+            uint8_t seen = SimUART_sample(shiftByte, shiftBitCycles, SimUART_lineBitCycles(), &framingError);
+
+            pcFramingErrors += framingError;
+            if (pcHead - pcTail < PC_RECEIVE_SIZE)
+            {
+                pcReceived[pcHead++ % PC_RECEIVE_SIZE] = seen;
+            }
+
+            shifting = false;
+            if (txbufFull)
+            {
+                SimUART_startShift(shiftEnd);
+            }
+        }
+        else if (arrival <= now)
+        {
+            uint8_t sent = lineQueue[lineTail++ % LINE_QUEUE_SIZE].data;
+
+            // A module held in reset does not receive
+            if (enabled)
+            {
+                rxbuf = SimUART_sample(sent, SimUART_lineBitCycles(), SimUART_bitCycles(), &framingError);
+
+                if (ifg & UART_IFG_RX)
+                {
+                    statw |= EUSCI_A_UART_OVERRUN_ERROR;
+                }
+                if (framingError)
+                {
+                    statw |= EUSCI_A_UART_FRAMING_ERROR;
+                }
+                ifg |= UART_IFG_RX;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+bool SimUART_interruptPending(void)
+{
+    return enabled && (ifg & ie);
+}
+
+// -----------------------------------------------------------------------------
+// The PC side
+// -----------------------------------------------------------------------------
+
+void SimUART_setLineBaud(uint32_t baud)
+{
+    lineBaud = baud;
+}
+
+void SimUART_send(const uint8_t* data, uint32_t length)
+{
+    uint64_t now = Sim_now();
+    uint32_t i;
+
+    for (i = 0; i < length && lineHead - lineTail < LINE_QUEUE_SIZE; i++)
+    {
+        uint64_t start = (lineFreeAt > now) ? lineFreeAt : now;
+
+        lineQueue[lineHead % LINE_QUEUE_SIZE].data = data[i];
+        lineQueue[lineHead % LINE_QUEUE_SIZE].start = start;
+        lineHead++;
+
+        lineFreeAt = start + (uint64_t) (BITS_PER_FRAME * SimUART_lineBitCycles() + 0.5);
+    }
+}
+
+uint32_t SimUART_sending(void)
+{
+    return lineHead - lineTail;
+}
+
+uint32_t SimUART_receive(uint8_t* data, uint32_t length)
+{
+    uint32_t count = 0;
+
+    Sim_now();
+    while (count < length && pcTail != pcHead)
+    {
+        data[count++] = pcReceived[pcTail++ % PC_RECEIVE_SIZE];
+    }
+    return count;
+}
+
+uint32_t SimUART_lineErrors(void)
+{
+    return pcFramingErrors;
+}
+
+double SimUART_baudRate(void)
+{
+    return SimUART_clockFrequency() / SimUART_bitClocks();
+}
+
+// -----------------------------------------------------------------------------
+// driverlib
+// -----------------------------------------------------------------------------
+
+bool UART_initModule(uint32_t moduleInstance, const eUSCI_UART_ConfigV1 *config_p)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if (config_p->clockPrescalar == 0)
+    {
+        Sim_fail("UART_initModule() with a clock prescaler of 0");
+    }
+
+    // Setting UCSWRST stops the module, clears its interrupt enables and empties the transmitter
+    config = *config_p;
+    enabled = false;
+    ie = 0;
+    ifg = UART_IFG_TX;
+    statw = 0;
+    txbufFull = false;
+    shifting = false;
+
+    return true;
+}
+
+void UART_enableModule(uint32_t moduleInstance)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_REGISTER);
+    enabled = true;
+    Sim_dispatch();
+}
+
+void UART_disableModule(uint32_t moduleInstance)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_REGISTER);
+    enabled = false;
+}
+
+/** Like driverlib, waits for room in the transmit buffer unless the transmit interrupt is enabled. */
+void UART_transmitData(uint32_t moduleInstance, uint_fast8_t transmitData)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    if (!(ie & EUSCI_A_UART_TRANSMIT_INTERRUPT))
+    {
+        while (enabled && !(ifg & UART_IFG_TX))
+        {
+            Sim_charge(SIM_CYCLES_REGISTER);
+        }
+    }
+
+    if (!enabled)
+    {
+        return;
+    }
+
+    txbuf = transmitData;
+    txbufFull = true;
+    ifg &= ~UART_IFG_TX;
+    if (!shifting)
+    {
+        SimUART_startShift(Sim_now());
+    }
+    Sim_dispatch();
+}
+
+/** Reading the receive buffer clears the receive flag and the error flags. */
+uint8_t UART_receiveData(uint32_t moduleInstance)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+
+    ifg &= ~UART_IFG_RX;
+    statw &= ~(EUSCI_A_UART_OVERRUN_ERROR | EUSCI_A_UART_FRAMING_ERROR);
+    return rxbuf;
+}
+
+void UART_enableInterrupt(uint32_t moduleInstance, uint_fast8_t mask)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    ie |= mask;
+    Sim_dispatch();
+}
+
+void UART_disableInterrupt(uint32_t moduleInstance, uint_fast8_t mask)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    ie &= ~mask;
+}
+
+uint_fast8_t UART_getEnabledInterruptStatus(uint32_t moduleInstance)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    return ifg & ie;
+}
+
+uint_fast8_t UART_queryStatusFlags(uint32_t moduleInstance, uint_fast8_t mask)
+{
+    SimUART_check(moduleInstance);
+    Sim_charge(SIM_CYCLES_DRIVERLIB_CALL);
+    return statw & mask;
+}
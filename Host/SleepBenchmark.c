@@ -0,0 +1,196 @@
+/*
+ * SleepBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check of the event-driven super-loop, built from the firmware's HAL
+ * against the simulator in Sim/. A loop which does everything in turn calls
+ * HAL_refresh(), handles what came in, and then HAL_sleep(), which sleeps in
+ * LPM0 until the UART, a button edge or the timer wheel posts an event. Unlike the soak
+ * test's loop, which is told when the next event is due, this one has only the
+ * events to go by. A seeded schedule presses the BoosterPack S1 button with
+ * contact bounce and types bursts of characters at 57600 baud, which the loop
+ * echoes, while a timer on the wheel runs out every second.
+ *
+ * It reports the share of the time the CPU is awake, and from it the current
+ * the MSP432 would draw, against a loop which polls all the time. The figures
+ * are the simulator's: only hardware accesses cost cycles, so the time awake
+ * is a lower bound. It fails if a press is missed or counted twice, a
+ * character is lost or not echoed, a timer runs out more than two ticks late,
+ * or the loop reads a character one character time or more after it arrived.
+ *
+ *   SleepBenchmark [hours] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <HAL/HAL.h>
+#include <Sim/Sim.h>
+#include <Sim/SimStimulus.h>
+
+#define DEFAULT_HOURS       1
+#define DEFAULT_SEED        2026
+
+// Button presses: the gap between them and how long they are held
+#define PRESS_GAP_MS        500, 5000
+#define PRESS_HOLD_MS       30, 600
+
+// Characters from the PC: bursts of back-to-back characters, as a paste or a fast typist sends
+#define BURST_GAP_MS        200, 3000
+#define MAX_BURST_CHARS     8
+#define LINE_BAUD           57600
+
+#define TIMEOUT_MS          1000
+
+// Typical supply current of the MSP432P401R at 48 MHz, core voltage level 1 and the LDO: running
+// from flash, and asleep in LPM0 with the peripherals clocked. Assumed, not measured on a unit.
+#define ACTIVE_MA           4.6
+#define LPM0_MA             1.4
+
+static uint64_t cyclesPerMs;
+static uint64_t cyclesPerUs;
+
+/** A timer on the wheel which runs out every TIMEOUT_MS, and how late it ran out. */
+static WheelTimer timeout;
+static uint64_t timeoutDeadline;
+static uint32_t timeouts = 0, earlyTimeouts = 0;
+static uint64_t timeoutLatenessMax = 0;
+
+static void timeoutExpired(void* context)
+{
+    uint64_t now = Sim_now();
+
+    (void) context;
+
+    if (now < timeoutDeadline)
+    {
+        earlyTimeouts++;
+    }
+    else if (now - timeoutDeadline > timeoutLatenessMax)
+    {
+        timeoutLatenessMax = now - timeoutDeadline;
+    }
+    timeouts++;
+
+    timeoutDeadline = Sim_now() + TIMEOUT_MS * cyclesPerMs;
+    WheelTimer_arm(&timeout, TIMEOUT_MS, NULL);
+}
+
+int main(int argc, char** argv)
+{
+    double hours = (argc > 1) ? atof(argv[1]) : DEFAULT_HOURS;
+    uint64_t seed = (argc > 2) ? strtoull(argv[2], NULL, 0) : DEFAULT_SEED;
+    HAL hal;
+    uint64_t start, end, nextBurst, sleptStart, charTime;
+    uint32_t presses = 0, taps = 0;
+    uint32_t charsSent = 0, charsReceived = 0, charErrors = 0, charsLost = 0, echoed = 0;
+    uint64_t latencyTotal = 0, latencyMin = SIM_NEVER, latencyMax = 0;
+    uint64_t wakes = 0;
+    uint8_t echo[64];
+    uint32_t i, count, burst;
+
+    SimStimulus_seed(seed);
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+    hal = HAL_construct();
+    UART_SetBaud_Enable(&hal.uart, BAUD_57600);
+    SimUART_setLineBaud(LINE_BAUD);
+
+    cyclesPerMs = Sim_mclkFrequency() / MS_DIVISION_FACTOR;
+    cyclesPerUs = Sim_mclkFrequency() / US_DIVISION_FACTOR;
+    charTime = (uint64_t) Sim_mclkFrequency() * SIM_STIMULUS_BITS_PER_CHAR / LINE_BAUD;
+    start = Sim_now();
+    sleptStart = Sim_sleptCycles();
+    end = start + (uint64_t) (hours * 3600 * 1000) * cyclesPerMs;
+
+    // Every press is released well before the end, so each one should count as exactly one tap
+    presses = SimStimulus_schedulePresses(start, end - 10 * TIMEOUT_MS * cyclesPerMs,
+                                          BOOSTERPACK_S1_PORT, BOOSTERPACK_S1_PIN, PRESS_GAP_MS, PRESS_HOLD_MS);
+
+    timeout = WheelTimer_construct(timeoutExpired);
+    timeoutDeadline = Sim_now() + TIMEOUT_MS * cyclesPerMs;
+    WheelTimer_arm(&timeout, TIMEOUT_MS, NULL);
+
+    nextBurst = start + SimStimulus_randomBetween(BURST_GAP_MS) * cyclesPerMs;
+
+    while (Sim_now() < end)
+    {
+        // Characters are scheduled a few at a time, since their latency is measured against a queue
+        while (nextBurst < end - TIMEOUT_MS * cyclesPerMs && SimStimulus_charRoom() > MAX_BURST_CHARS)
+        {
+            burst = SimStimulus_randomBetween(1, MAX_BURST_CHARS);
+            SimStimulus_scheduleChars(nextBurst, burst, LINE_BAUD);
+            charsSent += burst;
+            nextBurst += SimStimulus_randomBetween(BURST_GAP_MS) * cyclesPerMs;
+        }
+
+        HAL_refresh(&hal);
+
+        taps += Button_isTapped(&hal.boosterpackS1);
+
+        while (UART_hasChar(&hal.uart))
+        {
+            char data = UART_getChar(&hal.uart);
+            uint64_t latency;
+
+            charErrors += !SimStimulus_checkChar(data, &latency);
+            charsReceived++;
+
+            latencyTotal += latency;
+            latencyMin = (latency < latencyMin) ? latency : latencyMin;
+            latencyMax = (latency > latencyMax) ? latency : latencyMax;
+
+            UART_sendChar(&hal.uart, data);
+        }
+
+        // The echoes come back to the PC while the CPU sleeps
+        while ((count = SimUART_receive(echo, sizeof(echo))) > 0)
+        {
+            for (i = 0; i < count; i++)
+            {
+                echoed += echo[i] >= 'a' && echo[i] <= 'z';
+            }
+        }
+
+        HAL_sleep(&hal);
+        wakes++;
+    }
+
+    // A character still waiting long after it arrived was lost
+    charsLost = SimStimulus_lostChars(cyclesPerMs);
+
+    uint64_t elapsed = Sim_now() - start;
+    uint64_t slept = Sim_sleptCycles() - sleptStart;
+    double awake = 1.0 - (double) slept / elapsed;
+    double current = awake * ACTIVE_MA + (1.0 - awake) * LPM0_MA;
+    const ProfileStats* sleep = Profile_stats(PROFILE_SLEEP);
+
+    printf("Event-driven super-loop, seed %llu, %.1f simulated hours:\n", (unsigned long long) seed,
+           (double) elapsed / Sim_mclkFrequency() / 3600);
+    printf("  %llu wakes, one per %.1f ms; awake %.3f%% of the time, %u sleeps in the profiling table\n",
+           (unsigned long long) wakes, (double) elapsed / wakes / cyclesPerMs, awake * 100, sleep->count);
+    printf("  estimated current: %.2f mA, against %.2f mA polling all the time (%.1f mA awake, %.1f mA in LPM0, assumed)\n",
+           current, ACTIVE_MA, ACTIVE_MA, LPM0_MA);
+    printf("  button: %u presses, %u taps\n", presses, taps);
+    printf("  UART: %u characters sent, %u received, %u wrong, %u lost, %u echoed\n",
+           charsSent, charsReceived, charErrors, charsLost, echoed);
+    if (charsReceived > 0)
+    {
+        printf("  wake to read a character: %.1f us min, %.1f us mean, %.1f us max; a character takes %.1f us\n",
+               (double) latencyMin / cyclesPerUs, (double) latencyTotal / charsReceived / cyclesPerUs,
+               (double) latencyMax / cyclesPerUs, (double) charTime / cyclesPerUs);
+    }
+    printf("  timer: %u timeouts, %u early, %.1f us late at most\n",
+           timeouts, earlyTimeouts, (double) timeoutLatenessMax / cyclesPerUs);
+
+    if (taps != presses || charErrors > 0 || charsLost > 0 || echoed != charsReceived || charsReceived == 0 ||
+        latencyMax >= charTime || earlyTimeouts > 0 || timeouts == 0 ||
+        timeoutLatenessMax > 2 * TIMER_TICK_CYCLES || sleep->count == 0)
+    {
+        fprintf(stderr, "the loop missed an event, or woke too late for one\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,204 @@
+/*
+ * SoakBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A long soak test of the firmware's timing code, run on the simulator's
+ * virtual clock. A super-loop which does everything in turn calls
+ * HAL_refresh() while a seeded schedule presses the BoosterPack S1 button
+ * with contact bounce, sends characters from the PC and lets a one-second SWTimer run out over and
+ * over, across Timer32 rollovers. Whenever nothing is due, the loop skips
+ * ahead to the next event, so a day of simulated time takes well under a
+ * second and the same seed always gives the same run, down to the cycle.
+ *
+ * The run fails if a press is missed or counted twice, a character is lost or
+ * a timeout fires early or more than a millisecond late. It reports the
+ * latency from a character arriving to the loop reading it, and a digest of
+ * every observation to compare runs by.
+ *
+ *   SoakBenchmark [hours] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <HAL/HAL.h>
+#include <Sim/Sim.h>
+#include <Sim/SimStimulus.h>
+
+#define DEFAULT_HOURS       24
+#define DEFAULT_SEED        2026
+
+// Button presses: the gap between them and how long they are held
+#define PRESS_GAP_MS        500, 5000
+#define PRESS_HOLD_MS       30, 600
+
+// Characters from the PC
+#define CHAR_GAP_MS         200, 3000
+#define LINE_BAUD           9600
+
+#define TIMEOUT_MS          1000
+#define MAX_TIMEOUT_LATENESS_MS 1
+
+// The loop polls once more this long after the debounce time of the last edge
+#define POLL_MARGIN_US      100
+#define DEBOUNCE_WAIT_US    (DEBOUNCE_TIME_MS * 1000 + POLL_MARGIN_US)
+
+static uint64_t cyclesPerMs;
+static uint64_t cyclesPerUs;
+
+/** What the loop observed, folded into an FNV-1a digest. */
+static uint64_t digest = 0xcbf29ce484222325ull;
+
+static void observe(uint32_t kind, uint64_t time)
+{
+    uint64_t value = ((uint64_t) kind << 56) ^ time;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        digest = (digest ^ ((value >> (8 * i)) & 0xFF)) * 0x100000001b3ull;
+    }
+}
+
+// Sim/Sim.h is included ahead of everything, too early to ask for POSIX clocks; CPU time is what counts here anyway
+static double nowSeconds(void)
+{
+    return (double) clock() / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char** argv)
+{
+    double hours = (argc > 1) ? atof(argv[1]) : DEFAULT_HOURS;
+    HAL hal;
+    SWTimer timeout = SWTimer_construct(TIMEOUT_MS);
+    uint64_t seed = (argc > 2) ? strtoull(argv[2], NULL, 0) : DEFAULT_SEED;
+    uint64_t start, end, nextChar, timeoutDeadline;
+    uint32_t presses = 0, taps = 0;
+    uint32_t charsSent = 0, charsReceived = 0, charErrors = 0, charsLost = 0;
+    uint64_t latencyTotal = 0, latencyMin = SIM_NEVER, latencyMax = 0;
+    uint32_t timeouts = 0, earlyTimeouts = 0;
+    uint64_t latenessMax = 0;
+    uint64_t iterations = 0;
+    double wallStart;
+
+    SimStimulus_seed(seed);
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+    hal = HAL_construct();
+
+    cyclesPerMs = Sim_mclkFrequency() / MS_DIVISION_FACTOR;
+    cyclesPerUs = Sim_mclkFrequency() / US_DIVISION_FACTOR;
+    start = Sim_now();
+    end = start + (uint64_t) (hours * 3600 * 1000) * cyclesPerMs;
+
+    // Every press is released well before the end, so each one should count as exactly one tap
+    presses = SimStimulus_schedulePresses(start, end - 10 * TIMEOUT_MS * cyclesPerMs,
+                                          BOOSTERPACK_S1_PORT, BOOSTERPACK_S1_PIN, PRESS_GAP_MS, PRESS_HOLD_MS);
+
+    wallStart = nowSeconds();
+
+    nextChar = start + SimStimulus_randomBetween(CHAR_GAP_MS) * cyclesPerMs;
+    SWTimer_start(&timeout);
+    timeoutDeadline = Sim_now() + TIMEOUT_MS * cyclesPerMs;
+
+    while (Sim_now() < end)
+    {
+        uint64_t now, wake;
+
+        // Characters are scheduled a few at a time, since their latency is measured against a queue
+        while (nextChar < end && SimStimulus_charRoom() > 0)
+        {
+            SimStimulus_scheduleChars(nextChar, 1, LINE_BAUD);
+            charsSent++;
+            nextChar += SimStimulus_randomBetween(CHAR_GAP_MS) * cyclesPerMs;
+        }
+
+        HAL_refresh(&hal);
+        iterations++;
+
+        if (Button_isTapped(&hal.boosterpackS1))
+        {
+            taps++;
+            observe(1, Sim_now());
+        }
+
+        while (UART_hasChar(&hal.uart))
+        {
+            uint64_t latency;
+
+            charErrors += !SimStimulus_checkChar(UART_getChar(&hal.uart), &latency);
+            charsReceived++;
+
+            latencyTotal += latency;
+            latencyMin = (latency < latencyMin) ? latency : latencyMin;
+            latencyMax = (latency > latencyMax) ? latency : latencyMax;
+            observe(2, Sim_now());
+        }
+
+        if (SWTimer_expired(&timeout))
+        {
+            now = Sim_now();
+            if (now < timeoutDeadline)
+            {
+                earlyTimeouts++;
+            }
+            else if (now - timeoutDeadline > latenessMax)
+            {
+                latenessMax = now - timeoutDeadline;
+            }
+            timeouts++;
+            observe(3, now);
+
+            SWTimer_start(&timeout);
+            timeoutDeadline = Sim_now() + TIMEOUT_MS * cyclesPerMs;
+        }
+
+        // Nothing the loop polls changes before the next event, except that a button
+        // timer runs out after an edge and a timeout comes due. The button timers are
+        // on the timer wheel, which may run them out up to two ticks late.
+        now = Sim_now();
+        wake = (timeoutDeadline > now) ? timeoutDeadline : now;
+        if (SimStimulus_lastEdge() + DEBOUNCE_WAIT_US * cyclesPerUs + 2 * TIMER_TICK_CYCLES > now)
+        {
+            uint64_t debounced = SimStimulus_lastEdge() + DEBOUNCE_WAIT_US * cyclesPerUs + 2 * TIMER_TICK_CYCLES;
+            wake = (debounced < wake) ? debounced : wake;
+        }
+        Sim_idle(wake - now);
+    }
+
+    double wall = nowSeconds() - wallStart;
+
+    // A character still waiting long after it arrived was lost
+    charsLost = SimStimulus_lostChars(cyclesPerMs);
+
+    double simulated = (double) (Sim_now() - start) / Sim_mclkFrequency();
+
+    printf("Soak test, seed %llu:\n", (unsigned long long) seed);
+    printf("  %.1f simulated hours in %.0f ms (%.0fx real time), %llu loop iterations\n",
+           simulated / 3600, wall * 1000, simulated / wall, (unsigned long long) iterations);
+    printf("  %llu Timer32 rollovers\n", (unsigned long long) ((Sim_now() >> 32)));
+    printf("  button: %u presses, %u taps\n", presses, taps);
+    printf("  UART: %u characters sent, %u received, %u wrong, %u lost\n",
+           charsSent, charsReceived, charErrors, charsLost);
+    if (charsReceived > 0)
+    {
+        printf("  UART latency: %.1f us min, %.1f us mean, %.1f us max\n",
+               (double) latencyMin / cyclesPerUs, (double) latencyTotal / charsReceived / cyclesPerUs,
+               (double) latencyMax / cyclesPerUs);
+    }
+    printf("  timeouts: %u, %u early, %.1f us late at most\n",
+           timeouts, earlyTimeouts, (double) latenessMax / cyclesPerUs);
+    printf("  digest %016llx\n", (unsigned long long) digest);
+
+    if (taps != presses || charErrors > 0 || charsLost > 0 ||
+        earlyTimeouts > 0 || latenessMax > MAX_TIMEOUT_LATENESS_MS * cyclesPerMs)
+    {
+        fprintf(stderr, "soak test failed\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
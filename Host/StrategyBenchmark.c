@@ -0,0 +1,122 @@
+/*
+ * StrategyBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the flash decision tree in Wordle/Strategy.c.
+ * It times the integrity check the board runs at boot, then plays a game
+ * against every dictionary word always guessing the tree's hint, and fails if
+ * a game loses the tree, takes more than MAX_GUESSES, or the games take more
+ * guesses than the tables say. It reports the time of a step down the tree,
+ * and the flash of the generated tables. The firmware's flash as a whole,
+ * code included, is what "make flash" reports.
+ *
+ *   StrategyBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Wordle/Dictionary.h>
+#include <Wordle/Strategy.h>
+#include <Wordle/StrategyTables.h>
+
+// The game's number of guesses; a game which needs more is a failure
+#define MAX_GUESSES         6
+
+// The MSP432P401R's flash
+#define FLASH_BYTES         (256u * 1024)
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** Plays a game against an answer on hints alone. Returns the guesses it took, or 0 if it lost the tree. */
+static uint32_t playGame(PackedWord answer, uint32_t* steps)
+{
+    PackedWord guess;
+    uint32_t guesses = 0;
+
+    Strategy_reset();
+    while (guesses < MAX_GUESSES && Strategy_hint(&guess))
+    {
+        FeedbackCode code = Score_feedback(guess, answer);
+
+        guesses++;
+        if (code == SCORE_ALL_GREEN)
+        {
+            return guesses;
+        }
+        Strategy_addFeedback(guess, code);
+        (*steps)++;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    DictionaryCursor cursor;
+    PackedWord word, guess;
+    uint32_t histogram[MAX_GUESSES + 1] = { 0 };
+    uint32_t totalGuesses = 0, steps = 0, lost = 0, words = 0, tables, guesses, i;
+    bool intact, offTree;
+    double start, initNs, playNs;
+
+    Dictionary_init();
+
+    start = nowNs();
+    intact = Strategy_init();
+    initNs = nowNs() - start;
+
+    printf("Strategy tree, %u nodes, %u edges:\n", StrategyTables_nodeCount, StrategyTables_edgeCount);
+    printf("  integrity check at boot: %s in %.1f us\n", intact ? "intact" : "DAMAGED", initNs / 1e3);
+    if (!intact)
+    {
+        fprintf(stderr, "the strategy tables are damaged or were solved for another dictionary; run make strategy\n");
+        return EXIT_FAILURE;
+    }
+
+    start = nowNs();
+    cursor = Dictionary_cursor();
+    while (Dictionary_next(&cursor, &word))
+    {
+        guesses = playGame(word, &steps);
+        histogram[guesses]++;
+        totalGuesses += guesses;
+        lost += (guesses == 0);
+        words++;
+    }
+    playNs = nowNs() - start;
+
+    // Any guess but the tree's leaves it, and the hint with it
+    Strategy_reset();
+    Strategy_hint(&guess);
+    Strategy_addFeedback(guess ^ 1, 0);
+    offTree = !Strategy_hint(&guess);
+    Strategy_reset();
+
+    printf("  %u games on hints alone, %.4f guesses on average, %u lost:", words, (double) totalGuesses / words, lost);
+    for (i = 1; i <= MAX_GUESSES; i++)
+    {
+        printf(" %u:%u", i, histogram[i]);
+    }
+    printf("\n  %.1f ns per guess and step down the tree, hint %s off the tree\n", playNs / (totalGuesses + steps),
+           offTree ? "withdrawn" : "STILL GIVEN");
+
+    tables = Dictionary_flashBytes() + Strategy_flashBytes();
+    printf("  flash tables: strategy %u + dictionary %u = %u bytes of %u; see make flash for the firmware\n",
+           Strategy_flashBytes(), Dictionary_flashBytes(), tables, FLASH_BYTES);
+
+    if (lost > 0 || totalGuesses != StrategyTables_totalGuesses || !offTree || tables > FLASH_BYTES)
+    {
+        fprintf(stderr, "the strategy tree does not play as generated, or does not fit the flash\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,345 @@
+/*
+ * TimerBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host check and benchmark of the timer wheel in HAL/TimerWheel.c against a
+ * SWTimer per timeout, both built from the firmware's sources against the
+ * simulator in Sim/. A super-loop runs every LOOP_US of simulated time with 5
+ * and then 64 timers, each restarted with a pseudo-random timeout whenever it
+ * runs out: once polling every SWTimer each loop, and once servicing the wheel,
+ * whose callbacks arm the timers again, and asking it how long the loop may
+ * sleep, as Event_take() does on every loop.
+ *
+ * It reports the host time per loop spent on the timers, over that of an empty
+ * loop, and the bus cycles the simulator charges for it, which is what the
+ * hardware timer reads cost on the board. It fails if a timer runs out early,
+ * a SWTimer is seen more than a loop late, a wheel timer more than two ticks
+ * and a loop late, a cancelled timer runs out at all, or
+ * TimerWheel_cyclesUntilDue() would let the loop sleep past a timer's tick.
+ *
+ *   TimerBenchmark
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <HAL/Timer.h>
+#include <HAL/TimerWheel.h>
+#include <Sim/Sim.h>
+#include <Sim/SimStimulus.h>
+
+#define MAX_TIMERS          64
+#define LOOP_US             50
+#define SIMULATED_MS        20000
+#define TIMEOUT_MS          5, 1000
+#define RUNS                3
+
+// How late a check may come after the loop's own time, for the bus cycles the loop itself takes
+#define SLACK_US            20
+
+static uint64_t cyclesPerMs;
+static uint64_t cyclesPerUs;
+
+// How late a wheel timer may run out, from its tick rounding and a loop
+static uint64_t wheelLateness;
+
+// Where the timed loop puts what TimerWheel_cyclesUntilDue() returns, as Event_take() uses it
+static volatile uint64_t sleepCycles;
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** What one run saw: how often the timers ran out, and how far off. */
+struct _Result
+{
+    double ns;
+    uint64_t busCycles;
+    uint64_t loops;
+    uint32_t expiries;
+    uint32_t early;
+    uint64_t latenessMax;
+};
+typedef struct _Result Result;
+
+/** The timers of a run, each with the time it should run out at. */
+static SWTimer swTimers[MAX_TIMERS];
+static WheelTimer wheelTimers[MAX_TIMERS];
+static uint64_t deadlines[MAX_TIMERS];
+static Result* running;
+
+static void check(uint32_t timer)
+{
+    uint64_t now = Sim_now();
+
+    running->expiries++;
+    if (now < deadlines[timer])
+    {
+        running->early++;
+    }
+    else if (now - deadlines[timer] > running->latenessMax)
+    {
+        running->latenessMax = now - deadlines[timer];
+    }
+}
+
+static void restartSWTimer(uint32_t timer)
+{
+    uint32_t timeout = SimStimulus_randomBetween(TIMEOUT_MS);
+
+    swTimers[timer] = SWTimer_construct(timeout);
+    SWTimer_start(&swTimers[timer]);
+    deadlines[timer] = Sim_now() + timeout * cyclesPerMs;
+}
+
+static void armWheelTimer(uint32_t timer)
+{
+    uint32_t timeout = SimStimulus_randomBetween(TIMEOUT_MS);
+
+    deadlines[timer] = Sim_now() + timeout * cyclesPerMs;
+    WheelTimer_arm(&wheelTimers[timer], timeout, &wheelTimers[timer]);
+}
+
+static void wheelTimerExpired(void* context)
+{
+    uint32_t timer = (WheelTimer*) context - wheelTimers;
+
+    check(timer);
+    armWheelTimer(timer);
+}
+
+/** Returns the timer with the earliest deadline. */
+static uint32_t earliest(uint32_t timers)
+{
+    uint32_t first = 0, i;
+
+    for (i = 1; i < timers; i++)
+    {
+        first = (deadlines[i] < deadlines[first]) ? i : first;
+    }
+    return first;
+}
+
+enum _Mode { EMPTY, POLLING, WHEEL };
+typedef enum _Mode Mode;
+
+/**
+ * Runs the super-loop for SIMULATED_MS. The time the loop spends letting
+ * simulated time pass is the same in every mode, so subtracting the empty
+ * loop's time leaves the timers' own.
+ */
+static Result run(Mode mode, uint32_t timers)
+{
+    Result result = { 0 };
+    uint64_t end, busStart;
+    double start;
+    uint32_t i;
+
+    // Every run sees the same timeouts
+    SimStimulus_seed(2026);
+    running = &result;
+    for (i = 0; i < timers; i++)
+    {
+        if (mode == POLLING)
+        {
+            restartSWTimer(i);
+        }
+        else if (mode == WHEEL)
+        {
+            wheelTimers[i] = WheelTimer_construct(wheelTimerExpired);
+            armWheelTimer(i);
+        }
+    }
+
+    end = Sim_now() + SIMULATED_MS * cyclesPerMs;
+    busStart = Sim_now();
+    start = nowNs();
+
+    while (Sim_now() < end)
+    {
+        if (mode == POLLING)
+        {
+            for (i = 0; i < timers; i++)
+            {
+                if (SWTimer_expired(&swTimers[i]))
+                {
+                    check(i);
+                    restartSWTimer(i);
+                }
+            }
+        }
+        else if (mode == WHEEL)
+        {
+            TimerWheel_service();
+            sleepCycles = TimerWheel_cyclesUntilDue();
+        }
+
+        Sim_advance(LOOP_US * cyclesPerUs);
+        result.loops++;
+    }
+
+    result.ns = nowNs() - start;
+    result.busCycles = Sim_now() - busStart - result.loops * LOOP_US * cyclesPerUs;
+
+    for (i = 0; i < timers && mode == WHEEL; i++)
+    {
+        WheelTimer_cancel(&wheelTimers[i]);
+    }
+    return result;
+}
+
+/** The fastest of a few runs, since other work on the host only ever makes a run slower. */
+static Result bestRun(Mode mode, uint32_t timers)
+{
+    Result best = run(mode, timers);
+    uint32_t i;
+
+    for (i = 1; i < RUNS; i++)
+    {
+        Result next = run(mode, timers);
+        best = (next.ns < best.ns) ? next : best;
+    }
+    return best;
+}
+
+static void cancelledExpired(void* context)
+{
+    (*(uint32_t*) context)++;
+}
+
+/** Arms every timer, cancels every other one in a shuffled order, and checks only the rest run out. */
+static bool checkCancel(void)
+{
+    uint32_t order[MAX_TIMERS];
+    uint32_t fired[MAX_TIMERS] = { 0 };
+    uint64_t end;
+    uint32_t i, swap, temp;
+    bool ok = true;
+
+    for (i = 0; i < MAX_TIMERS; i++)
+    {
+        wheelTimers[i] = WheelTimer_construct(cancelledExpired);
+        WheelTimer_arm(&wheelTimers[i], SimStimulus_randomBetween(TIMEOUT_MS), &fired[i]);
+        order[i] = i;
+    }
+    for (i = MAX_TIMERS - 1; i > 0; i--)
+    {
+        swap = SimStimulus_random() % (i + 1);
+        temp = order[i];
+        order[i] = order[swap];
+        order[swap] = temp;
+    }
+    for (i = 0; i < MAX_TIMERS; i++)
+    {
+        if (order[i] % 2 == 1)
+        {
+            WheelTimer_cancel(&wheelTimers[order[i]]);
+        }
+    }
+
+    end = Sim_now() + 2000 * cyclesPerMs;
+    while (Sim_now() < end)
+    {
+        TimerWheel_service();
+        Sim_advance(LOOP_US * cyclesPerUs);
+    }
+
+    for (i = 0; i < MAX_TIMERS; i++)
+    {
+        ok = ok && (fired[i] == (i % 2 == 0)) && !WheelTimer_isArmed(&wheelTimers[i]);
+    }
+    return ok && TimerWheel_armedCount() == 0;
+}
+
+/**
+ * Runs the wheel with every timer, as the timed runs do, and counts the loops
+ * after which TimerWheel_cyclesUntilDue() says the loop may sleep past the
+ * deadline of the timer due first, and how late its wheel tick may be.
+ */
+static uint32_t checkSleep(void)
+{
+    Result result = { 0 };
+    uint32_t sleptPast = 0, i;
+    uint64_t end;
+
+    running = &result;
+    for (i = 0; i < MAX_TIMERS; i++)
+    {
+        wheelTimers[i] = WheelTimer_construct(wheelTimerExpired);
+        armWheelTimer(i);
+    }
+
+    end = Sim_now() + SIMULATED_MS * cyclesPerMs;
+    while (Sim_now() < end)
+    {
+        TimerWheel_service();
+        sleptPast += (Sim_now() + TimerWheel_cyclesUntilDue() > deadlines[earliest(MAX_TIMERS)] + wheelLateness);
+        Sim_advance(LOOP_US * cyclesPerUs);
+    }
+
+    for (i = 0; i < MAX_TIMERS; i++)
+    {
+        WheelTimer_cancel(&wheelTimers[i]);
+    }
+    return sleptPast;
+}
+
+int main(void)
+{
+    static const uint32_t counts[] = { 5, MAX_TIMERS };
+    uint64_t pollingLateness;
+    Result empty, polling, wheel;
+    bool ok, cancelled;
+    uint32_t i, sleptPast;
+
+    WDT_A_holdTimer();
+    InitSystemTiming();
+
+    cyclesPerMs = Sim_mclkFrequency() / MS_DIVISION_FACTOR;
+    cyclesPerUs = Sim_mclkFrequency() / US_DIVISION_FACTOR;
+    pollingLateness = (LOOP_US + SLACK_US) * cyclesPerUs;
+    wheelLateness = 2 * TIMER_TICK_CYCLES + pollingLateness;
+
+    printf("Timer service, a loop every %u us for %u simulated ms, timeouts of %u-%u ms:\n",
+           LOOP_US, SIMULATED_MS, TIMEOUT_MS);
+    printf("  wheel of %u slots, tick %.1f us\n", TIMER_WHEEL_SLOTS, (double) TIMER_TICK_CYCLES / cyclesPerUs);
+
+    empty = bestRun(EMPTY, 0);
+    ok = true;
+
+    for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+    {
+        polling = bestRun(POLLING, counts[i]);
+        wheel = bestRun(WHEEL, counts[i]);
+
+        printf("  %2u timers, SWTimer each: %7.1f ns and %5.1f bus cycles per loop, %u expiries, %.1f us late at most\n",
+               counts[i], (polling.ns - empty.ns) / polling.loops, (double) polling.busCycles / polling.loops,
+               polling.expiries, (double) polling.latenessMax / cyclesPerUs);
+        printf("  %2u timers, timer wheel:  %7.1f ns and %5.1f bus cycles per loop, %u expiries, %.1f us late at most\n",
+               counts[i], (wheel.ns - empty.ns) / wheel.loops, (double) wheel.busCycles / wheel.loops,
+               wheel.expiries, (double) wheel.latenessMax / cyclesPerUs);
+
+        ok = ok && polling.early == 0 && wheel.early == 0 && wheel.latenessMax <= wheelLateness
+             && polling.latenessMax <= pollingLateness && wheel.expiries > 0;
+    }
+
+    cancelled = checkCancel();
+    printf("  cancel: %s\n", cancelled ? "only the timers left armed ran out" : "A CANCELLED TIMER RAN OUT");
+
+    sleptPast = checkSleep();
+    printf("  sleep: %u loops would have slept past a timer\n", sleptPast);
+
+    if (!ok || !cancelled || sleptPast > 0)
+    {
+        fprintf(stderr, "a timer ran out early, late or after it was cancelled, or the loop would sleep past one\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
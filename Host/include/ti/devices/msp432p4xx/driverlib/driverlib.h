@@ -0,0 +1,272 @@
+/*
+ * driverlib.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host stand-in for the MSP432 driverlib header. It declares the part of the
+ * driverlib API which the game and the HAL headers use, with the same names,
+ * values and signatures, so those sources compile unmodified on Linux. The
+ * functions themselves are provided by the host backend that is linked in:
+ * Host/Posix implements the GPIO and watchdog calls the game makes, and the
+ * simulator in Host/Sim implements all of it, including the registers the LCD
+ * driver accesses directly.
+ */
+
+#ifndef HOST_DRIVERLIB_H_
+#define HOST_DRIVERLIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// GPIO ports and pins
+#define GPIO_PORT_P1                    1
+#define GPIO_PORT_P2                    2
+#define GPIO_PORT_P3                    3
+#define GPIO_PORT_P4                    4
+#define GPIO_PORT_P5                    5
+#define GPIO_PORT_P6                    6
+#define GPIO_PORT_PJ                    11
+#define GPIO_NUM_PORTS                  11
+
+#define GPIO_PIN0                       (0x0001)
+#define GPIO_PIN1                       (0x0002)
+#define GPIO_PIN2                       (0x0004)
+#define GPIO_PIN3                       (0x0008)
+#define GPIO_PIN4                       (0x0010)
+#define GPIO_PIN5                       (0x0020)
+#define GPIO_PIN6                       (0x0040)
+#define GPIO_PIN7                       (0x0080)
+
+#define GPIO_PRIMARY_MODULE_FUNCTION    (0x01)
+#define GPIO_INPUT_PIN_HIGH             (0x01)
+#define GPIO_INPUT_PIN_LOW              (0x00)
+
+#define GPIO_LOW_TO_HIGH_TRANSITION     (0x00)
+#define GPIO_HIGH_TO_LOW_TRANSITION     (0x01)
+
+// Interrupt numbers, as used by the Interrupt_* calls
+#define INT_EUSCIA0                     (32)
+#define INT_T32_INT1                    (41)
+#define INT_T32_INT2                    (42)
+#define INT_DMA_INT3                    (47)
+#define INT_DMA_INT2                    (48)
+#define INT_DMA_INT1                    (49)
+#define INT_DMA_INT0                    (50)
+#define INT_PORT1                       (51)
+#define INT_PORT2                       (52)
+#define INT_PORT3                       (53)
+#define INT_PORT4                       (54)
+#define INT_PORT5                       (55)
+#define INT_PORT6                       (56)
+
+// Flash controller
+#define FLASH_BANK0                     0x00
+#define FLASH_BANK1                     0x01
+
+// Clock system
+#define CS_ACLK                         0x01
+#define CS_MCLK                         0x02
+#define CS_HSMCLK                       0x04
+#define CS_SMCLK                        0x08
+
+#define CS_REFOCLK_SELECT               0x02
+#define CS_DCOCLK_SELECT                0x03
+
+#define CS_CLOCK_DIVIDER_1              0x00
+#define CS_CLOCK_DIVIDER_2              0x01
+#define CS_CLOCK_DIVIDER_4              0x02
+#define CS_CLOCK_DIVIDER_8              0x03
+#define CS_CLOCK_DIVIDER_16             0x04
+#define CS_CLOCK_DIVIDER_32             0x05
+#define CS_CLOCK_DIVIDER_64             0x06
+#define CS_CLOCK_DIVIDER_128            0x07
+
+// Timer32
+#define TIMER32_0_BASE                  0x4000C000
+#define TIMER32_1_BASE                  0x4000C040
+
+#define TIMER32_PRESCALER_1             0x00
+#define TIMER32_PRESCALER_16            0x04
+#define TIMER32_PRESCALER_256           0x08
+
+#define TIMER32_16BIT                   0x00
+#define TIMER32_32BIT                   0x02
+
+#define TIMER32_FREE_RUN_MODE           0x00
+#define TIMER32_PERIODIC_MODE           0x40
+
+// eUSCI module instances
+#define EUSCI_A0_BASE                   0x40001000
+#define EUSCI_B0_BASE                   0x40002000
+
+// UART configuration, laid out like eUSCI_UART_ConfigV1
+typedef struct _eUSCI_UART_ConfigV1
+{
+    uint_fast8_t selectClockSource;
+    uint_fast16_t clockPrescalar;
+    uint_fast8_t firstModReg;
+    uint_fast8_t secondModReg;
+    uint_fast8_t parity;
+    uint_fast16_t msborLsbFirst;
+    uint_fast16_t numberofStopBits;
+    uint_fast16_t uartMode;
+    uint_fast8_t overSampling;
+    uint_fast16_t dataLength;
+} eUSCI_UART_ConfigV1;
+
+#define EUSCI_A_UART_CLOCKSOURCE_SMCLK                  0x80
+#define EUSCI_A_UART_NO_PARITY                          0x00
+#define EUSCI_A_UART_LSB_FIRST                          0x00
+#define EUSCI_A_UART_ONE_STOP_BIT                       0x00
+#define EUSCI_A_UART_MODE                               0x00
+#define EUSCI_A_UART_8_BIT_LEN                          0x00
+#define EUSCI_A_UART_LOW_FREQUENCY_BAUDRATE_GENERATION  0x00
+#define EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION   0x01
+
+#define EUSCI_A_UART_RECEIVE_INTERRUPT                  0x01
+#define EUSCI_A_UART_TRANSMIT_INTERRUPT                 0x02
+#define EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG             0x01
+#define EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG            0x02
+
+#define EUSCI_A_UART_OVERRUN_ERROR                      0x20
+#define EUSCI_A_UART_FRAMING_ERROR                      0x40
+
+// SPI master configuration, laid out like eUSCI_SPI_MasterConfig
+typedef struct _eUSCI_SPI_MasterConfig
+{
+    uint_fast8_t selectClockSource;
+    uint32_t clockSourceFrequency;
+    uint32_t desiredSpiClock;
+    uint_fast16_t msbFirst;
+    uint_fast16_t clockPhase;
+    uint_fast16_t clockPolarity;
+    uint_fast16_t spiMode;
+} eUSCI_SPI_MasterConfig;
+
+#define EUSCI_B_SPI_CLOCKSOURCE_SMCLK                           0x80
+#define EUSCI_B_SPI_MSB_FIRST                                   0x2000
+#define EUSCI_B_SPI_PHASE_DATA_CAPTURED_ONFIRST_CHANGED_ON_NEXT 0x8000
+#define EUSCI_B_SPI_CLOCKPOLARITY_INACTIVITY_LOW                0x00
+#define EUSCI_B_SPI_3PIN                                        0x00
+
+// eUSCI_B0 registers which the LCD driver accesses directly, and their bits
+extern volatile uint16_t *SimSPI_txbuf(void);
+extern uint16_t SimSPI_statw(void);
+extern uint16_t SimSPI_ifg(void);
+
+#define UCB0TXBUF                       (*SimSPI_txbuf())
+#define UCB0STATW                       (SimSPI_statw())
+#define UCB0IFG                         (SimSPI_ifg())
+
+#define UCBUSY                          (0x0001)
+#define UCRXIFG                         (0x0001)
+#define UCTXIFG                         (0x0002)
+#define UCOE                            (0x0020)
+
+// uDMA
+typedef struct _DMA_ControlTable
+{
+    volatile void *srcEndAddr;
+    volatile void *dstEndAddr;
+    volatile uint32_t control;
+    volatile uint32_t spare;
+} DMA_ControlTable;
+
+#define DMA_CH0_EUSCIB0TX0              0x01000000
+
+#define DMA_INT0                        INT_DMA_INT0
+#define DMA_INT1                        INT_DMA_INT1
+#define DMA_INT2                        INT_DMA_INT2
+#define DMA_INT3                        INT_DMA_INT3
+
+#define UDMA_PRI_SELECT                 0x00000000
+#define UDMA_ALT_SELECT                 0x00000020
+
+#define UDMA_ATTR_USEBURST              0x00000001
+#define UDMA_ATTR_ALTSELECT             0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY         0x00000004
+#define UDMA_ATTR_REQMASK               0x00000008
+
+#define UDMA_MODE_STOP                  0x00000000
+#define UDMA_MODE_BASIC                 0x00000001
+
+#define UDMA_DST_INC_8                  0x00000000
+#define UDMA_DST_INC_NONE               0xc0000000
+#define UDMA_SRC_INC_8                  0x00000000
+#define UDMA_SRC_INC_NONE               0x0c000000
+#define UDMA_SIZE_8                     0x00000000
+#define UDMA_ARB_1                      0x00000000
+
+// Watchdog
+extern void WDT_A_holdTimer(void);
+
+// Interrupts
+extern bool Interrupt_enableMaster(void);
+extern bool Interrupt_disableMaster(void);
+extern void Interrupt_enableInterrupt(uint32_t interruptNumber);
+extern void Interrupt_disableInterrupt(uint32_t interruptNumber);
+
+// Power control
+extern bool PCM_gotoLPM0(void);
+
+// Clock system and flash controller
+extern void FlashCtl_setWaitState(uint32_t bank, uint32_t waitState);
+extern void CS_setDCOFrequency(uint32_t dcoFrequency);
+extern void CS_initClockSignal(uint32_t selectedClockSignal, uint32_t clockSource, uint32_t clockSourceDivider);
+extern uint32_t CS_getMCLK(void);
+extern uint32_t CS_getSMCLK(void);
+
+// Timer32
+extern void Timer32_initModule(uint32_t timer, uint32_t preScaler, uint32_t resolution, uint32_t mode);
+extern void Timer32_setCount(uint32_t timer, uint32_t count);
+extern void Timer32_startTimer(uint32_t timer, bool oneShot);
+extern void Timer32_haltTimer(uint32_t timer);
+extern uint32_t Timer32_getValue(uint32_t timer);
+extern void Timer32_clearInterruptFlag(uint32_t timer);
+extern uint32_t Timer32_getInterruptStatus(uint32_t timer);
+
+// UART
+extern bool UART_initModule(uint32_t moduleInstance, const eUSCI_UART_ConfigV1 *config);
+extern void UART_enableModule(uint32_t moduleInstance);
+extern void UART_disableModule(uint32_t moduleInstance);
+extern void UART_transmitData(uint32_t moduleInstance, uint_fast8_t transmitData);
+extern uint8_t UART_receiveData(uint32_t moduleInstance);
+extern void UART_enableInterrupt(uint32_t moduleInstance, uint_fast8_t mask);
+extern void UART_disableInterrupt(uint32_t moduleInstance, uint_fast8_t mask);
+extern uint_fast8_t UART_getEnabledInterruptStatus(uint32_t moduleInstance);
+extern uint_fast8_t UART_queryStatusFlags(uint32_t moduleInstance, uint_fast8_t mask);
+
+// SPI
+extern bool SPI_initMaster(uint32_t moduleInstance, const eUSCI_SPI_MasterConfig *config);
+extern void SPI_enableModule(uint32_t moduleInstance);
+extern uint32_t SPI_getTransmitBufferAddressForDMA(uint32_t moduleInstance);
+
+// uDMA
+extern void DMA_enableModule(void);
+extern void DMA_setControlBase(void *controlTable);
+extern void DMA_assignChannel(uint32_t mapping);
+extern void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr);
+extern void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel);
+extern void DMA_clearInterruptFlag(uint32_t intChannel);
+extern void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control);
+extern void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode,
+                                   void *srcAddr, void *dstAddr, uint32_t transferSize);
+extern void DMA_enableChannel(uint32_t channelNum);
+extern bool DMA_isChannelEnabled(uint32_t channelNum);
+
+// GPIO
+extern void GPIO_setAsOutputPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_setAsInputPinWithPullUpResistor(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_setAsPeripheralModuleFunctionInputPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins, uint_fast8_t mode);
+extern void GPIO_setAsPeripheralModuleFunctionOutputPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins, uint_fast8_t mode);
+extern void GPIO_setOutputHighOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_setOutputLowOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_toggleOutputOnPin(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern uint8_t GPIO_getInputPinValue(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_enableInterrupt(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_disableInterrupt(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern void GPIO_interruptEdgeSelect(uint_fast8_t selectedPort, uint_fast16_t selectedPins, uint_fast8_t edgeSelect);
+extern void GPIO_clearInterruptFlag(uint_fast8_t selectedPort, uint_fast16_t selectedPins);
+extern uint_fast16_t GPIO_getEnabledInterruptStatus(uint_fast8_t selectedPort);
+
+#endif /* HOST_DRIVERLIB_H_ */
@@ -0,0 +1,112 @@
+/*
+ * grlib.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Host stand-in for the TI graphics library header. It provides the grlib
+ * types the LCD driver implements (Graphics_Display, Graphics_Display_Functions)
+ * and the drawing calls the game makes, with the same names and signatures.
+ * Like the real library, every call is turned into the driver primitives of
+ * the display the context was initialized with. Host/Grlib/Graphics.c holds
+ * the implementation.
+ */
+
+#ifndef HOST_GRLIB_H_
+#define HOST_GRLIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A rectangle, inclusive of both corners. The LCD driver uses the legacy member names.
+typedef struct Graphics_Rectangle
+{
+    int16_t xMin;
+    int16_t yMin;
+    int16_t xMax;
+    int16_t yMax;
+} Graphics_Rectangle;
+
+#define sXMin xMin
+#define sYMin yMin
+#define sXMax xMax
+#define sYMax yMax
+
+// The size and driver data of a display
+typedef struct Graphics_Display
+{
+    int32_t size;
+    void *displayData;
+    uint16_t width;
+    uint16_t heigth;
+} Graphics_Display;
+
+// The primitives a display driver provides to the library
+typedef struct Graphics_Display_Functions
+{
+    void (*pfnPixelDraw)(const Graphics_Display *pDisplay, int16_t lX, int16_t lY, uint16_t ulValue);
+    void (*pfnPixelDrawMultiple)(const Graphics_Display *pDisplay, int16_t lX, int16_t lY, int16_t lX0,
+                                 int16_t lCount, int16_t lBPP, const uint8_t *pucData,
+                                 const uint32_t *pucPalette);
+    void (*pfnLineDrawH)(const Graphics_Display *pDisplay, int16_t lX1, int16_t lX2, int16_t lY, uint16_t ulValue);
+    void (*pfnLineDrawV)(const Graphics_Display *pDisplay, int16_t lX, int16_t lY1, int16_t lY2, uint16_t ulValue);
+    void (*pfnRectFill)(const Graphics_Display *pDisplay, const Graphics_Rectangle *pRect, uint16_t ulValue);
+    uint32_t (*pfnColorTranslate)(const Graphics_Display *pDisplay, uint32_t ulValue);
+    void (*pfnFlush)(const Graphics_Display *pDisplay);
+    void (*pfnClearDisplay)(const Graphics_Display *pDisplay, uint16_t ulValue);
+} Graphics_Display_Functions;
+
+// A fixed-width bitmap font. Each glyph is stored as columns, least significant bit on top.
+typedef struct Graphics_Font
+{
+    uint8_t width;          // Columns stored per glyph
+    uint8_t height;         // Rows stored per glyph
+    uint8_t advance;        // Horizontal distance from one glyph to the next
+    uint8_t first;          // First character in the table
+    uint8_t last;           // Last character in the table
+    const uint8_t *glyphs;  // (last - first + 1) * width column bytes
+} Graphics_Font;
+
+// The drawing state the game passes to every call
+typedef struct Graphics_Context
+{
+    int32_t size;
+    const Graphics_Display *display;
+    Graphics_Rectangle clipRegion;
+    uint32_t foreground;
+    uint32_t background;
+    const Graphics_Font *font;
+    const Graphics_Display_Functions *displayFunctions;
+} Graphics_Context;
+
+// 24-bit RGB colors, with the same values as grlib
+#define GRAPHICS_COLOR_BLACK            0x00000000
+#define GRAPHICS_COLOR_WHITE            0x00FFFFFF
+#define GRAPHICS_COLOR_RED              0x00FF0000
+#define GRAPHICS_COLOR_GREEN            0x00008000
+#define GRAPHICS_COLOR_BLUE             0x000000FF
+#define GRAPHICS_COLOR_YELLOW           0x00FFFF00
+#define GRAPHICS_COLOR_GRAY             0x00808080
+
+// The host has a single 6x8 glyph set; every grlib font name the game uses refers to it
+extern const Graphics_Font g_sFontFixed6x8;
+extern const Graphics_Font g_sFontCmss12b;
+extern const Graphics_Font g_sFontCmsc12;
+extern const Graphics_Font g_sFontCmsc14;
+
+extern void Graphics_initContext(Graphics_Context *context, Graphics_Display *display,
+                                 const Graphics_Display_Functions *fxns);
+extern void Graphics_setForegroundColor(Graphics_Context *context, int32_t value);
+extern void Graphics_setBackgroundColor(Graphics_Context *context, int32_t value);
+extern void Graphics_setFont(Graphics_Context *context, const Graphics_Font *font);
+
+extern void Graphics_clearDisplay(const Graphics_Context *context);
+extern void Graphics_drawPixel(const Graphics_Context *context, int32_t x, int32_t y);
+extern void Graphics_drawLineH(const Graphics_Context *context, int32_t x1, int32_t x2, int32_t y);
+extern void Graphics_drawLineV(const Graphics_Context *context, int32_t x, int32_t y1, int32_t y2);
+extern void Graphics_fillRectangle(const Graphics_Context *context, const Graphics_Rectangle *rect);
+extern void Graphics_drawString(const Graphics_Context *context, int8_t *string, int32_t length,
+                                int32_t x, int32_t y, bool opaque);
+extern int32_t Graphics_getStringWidth(const Graphics_Context *context, int8_t *string, int32_t length);
+extern void Graphics_flushBuffer(const Graphics_Context *context);
+
+#endif /* HOST_GRLIB_H_ */